@@ -138,6 +138,9 @@ void Bezier_curve::BuildWakeTECurve( const Bezier_curve &lecrv, double endx, dou
 
     int nsect = m_Curve.number_segments();
 
+    // Same as ComputeWakeTrailEdgePnt, with the slope taken once for every control point
+    double slope = tan( DEG2RAD( angle ) );
+
     for ( int i = 0; i < nsect; i++ )
     {
         curve_segment_type c;
@@ -146,7 +149,8 @@ void Bezier_curve::BuildWakeTECurve( const Bezier_curve &lecrv, double endx, dou
         for ( int j = 0; j <= c.degree(); j++ )
         {
             curve_point_type cp = c.get_control_point( j );
-            curve_point_type newpt = ComputeWakeTrailEdgePnt( cp, endx, angle );
+            curve_point_type newpt;
+            newpt << endx, cp.y(), cp.z() + ( endx - cp.x() ) * slope;
             c.set_control_point( newpt, j );
         }
         m_Curve.replace( c, i );
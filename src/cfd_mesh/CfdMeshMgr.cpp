@@ -10,8 +10,14 @@
 #include "CfdMeshMgr.h"
 #include "Util.h"
 #include "SubSurfaceMgr.h"
+#include "TMesh.h"
+#include "FileUtil.h"
+#include "StlHelper.h"
+#include "UsingCpp11.h"
 #include "main.h"
 
+#include <algorithm>
+
 #ifdef DEBUG_CFD_MESH
 #include <direct.h>
 #endif
@@ -110,7 +116,9 @@ void Wake::BuildSurfs(  )
             s->SetSurfID( m_SurfVec.size() );
             s->SetWakeParentSurfID( wakeParentSurfID );
             s->GetSurfCore()->MakeWakeSurf( le_crv, m_WakeMgrPtr->GetEndX(), m_WakeMgrPtr->GetAngle() );
-            s->GetSurfCore()->BuildPatches( s );
+
+            // Unchanged lifting surfaces and wake settings give the same wake, so its patches are reused
+            CfdMeshMgr.BuildSurfPatches( s );
 
             m_SurfVec.push_back( s );
         }
@@ -139,6 +147,18 @@ vec3d WakeMgr::ComputeTrailEdgePnt( vec3d p )
     return vec3d( m_EndX, p[1], z );
 }
 
+void WakeMgr::ComputeTrailEdgePnts( const vector< vec3d > & le_vec, vector< vec3d > & te_vec )
+{
+    double slope = tan( DEG2RAD( m_Angle ) );
+
+    te_vec.resize( le_vec.size() );
+    for ( int i = 0 ; i < ( int )le_vec.size() ; i++ )
+    {
+        const vec3d & p = le_vec[i];
+        te_vec[i].set_xyz( m_EndX, p.y(), p.z() + ( m_EndX - p.x() ) * slope );
+    }
+}
+
 void WakeMgr::SetLeadingEdges( vector < vector < vec3d > > & wake_leading_edges )
 {
     m_LeadingEdgeVec = wake_leading_edges;
@@ -272,17 +292,11 @@ void WakeMgr::AppendWakeSurfs( vector< Surf* > & surf_vec )
 
 }
 
-void WakeMgr::StretchWakes()
+//==== Stretch the Simp Pnts of One Wake Surface's Mesh ====//
+void WakeMgr::StretchWake( Mesh* msh )
 {
     double scale = CfdMeshMgr.GetCfdSettingsPtr()->m_WakeScale;
-    for ( int i = 0 ; i < ( int )m_WakeVec.size() ; i++ )
-    {
-        for ( int j = 0 ; j < ( int )m_WakeVec[i]->m_SurfVec.size() ; j++ )
-        {
-            Mesh* msh = m_WakeVec[i]->m_SurfVec[j]->GetMesh();
-            msh->StretchSimpPnts( m_StartStretchX, m_EndX, scale, m_Angle );
-        }
-    }
+    msh->StretchSimpPnts( m_StartStretchX, m_EndX, scale, m_Angle );
 }
 
 /*
@@ -317,19 +331,23 @@ void WakeMgr::LoadDrawObjs( vector< DrawObj* > & draw_obj_vec )
     double scale = CfdMeshMgr.GetCfdSettingsPtr()->m_WakeScale;
     double factor = scale - 1.0;
 
+    double slope = tan( DEG2RAD( m_Angle ) );
+
     vector< vec3d > wakeData;
+    vector< vec3d > te_vec;
     for ( int e = 0; e < ( int )m_LeadingEdgeVec.size(); e++ )
     {
+        ComputeTrailEdgePnts( m_LeadingEdgeVec[e], te_vec );
+
         for ( int i = 0; i < ( int )m_LeadingEdgeVec[e].size(); i++ )
         {
-            vec3d le = m_LeadingEdgeVec[e][i];
-            wakeData.push_back( le );
+            wakeData.push_back( m_LeadingEdgeVec[e][i] );
 
-            vec3d te = ComputeTrailEdgePnt( le );
+            const vec3d & te = te_vec[i];
             double numer = te.x() - m_StartStretchX;
             double fract = numer / ( m_EndX - m_StartStretchX );
             double xx = m_StartStretchX + numer * ( 1.0 + factor * fract * fract );
-            double zz = te.z() + ( xx - te.x() ) * tan( DEG2RAD( m_Angle ) );
+            double zz = te.z() + ( xx - te.x() ) * slope;
             wakeData.push_back( vec3d( xx, te.y(), zz ) );
         }
     }
@@ -360,6 +378,7 @@ CfdMeshMgrSingleton::CfdMeshMgrSingleton() : SurfaceIntersectionSingleton()
     m_MeshInProgress = false;
 
     m_MessageName = "CFDMessage";
+    m_StageResultsName = "CFD_Mesh_Timing";
 
 #ifdef DEBUG_CFD_MESH
     m_DebugDir  = Stringc( "MeshDebug/" );
@@ -386,10 +405,12 @@ CfdMeshMgrSingleton::~CfdMeshMgrSingleton()
 void CfdMeshMgrSingleton::GenerateMesh()
 {
     m_MeshInProgress = true;
+    SetCancelFlag( false );
+    ClearMeshStages();
 
     TransferMeshSettings();
 
-    addOutputText( "Fetching Bezier Surfaces\n" );
+    StartMeshStage( "Fetching Bezier Surfaces" );
 
     vector< XferSurf > xfersurfs;
     FetchSurfs( xfersurfs );
@@ -398,7 +419,7 @@ void CfdMeshMgrSingleton::GenerateMesh()
     m_Vehicle->HideAll();
 
     CleanUp();
-    addOutputText( "Loading Bezier Surfaces\n" );
+    StartMeshStage( "Loading Bezier Surfaces" );
     LoadSurfs( xfersurfs );
 
     TransferSubSurfData();
@@ -408,6 +429,7 @@ void CfdMeshMgrSingleton::GenerateMesh()
     if ( m_SurfVec.size() == 0 )
     {
         addOutputText( "No Surfaces To Mesh\n" );
+        WriteMeshStageResults();
         m_MeshInProgress = false;
         return;
     }
@@ -416,25 +438,49 @@ void CfdMeshMgrSingleton::GenerateMesh()
     UpdateDomain();
     BuildDomain();
 
-    addOutputText( "Build Grid\n" );
+    if ( !StartMeshStage( "Build Grid" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     BuildGrid();
 
-    addOutputText( "Intersect\n" );
+    if ( !StartMeshStage( "Intersect" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     Intersect();
     addOutputText( "Finished Intersect\n" );
 
-    addOutputText( "Binary Adaptation Curve Approximation\n" );
+    if ( !StartMeshStage( "Binary Adaptation Curve Approximation" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     BinaryAdaptIntCurves();
 
-    addOutputText( "Build Target Map\n" );
+    if ( !StartMeshStage( "Build Target Map" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     BuildTargetMap( CfdMeshMgrSingleton::VOCAL_OUTPUT );
 
-    addOutputText( "InitMesh\n" );
+    if ( !StartMeshStage( "InitMesh" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     InitMesh( );
 
     SubTagTris();
 
-    addOutputText( "Remesh\n" );
+    if ( !StartMeshStage( "Remesh" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     Remesh( CfdMeshMgrSingleton::VOCAL_OUTPUT );
 
     //addOutputText( "Triangle Quality\n");
@@ -443,12 +489,26 @@ void CfdMeshMgrSingleton::GenerateMesh()
 
     SubSurfaceMgr.BuildSingleTagMap();
 
-    addOutputText( "Exporting Files\n" );
+    if ( !StartMeshStage( "Exporting Files" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     ExportFiles();
 
-    addOutputText( "Check Water Tight\n" );
-    string resultTxt = CheckWaterTight();
-    addOutputText( resultTxt );
+    StartMeshStage( "Check Water Tight" );
+    if ( m_SimpMeshStore.HasStored() )
+    {
+        // Welding every surface would bring the out-of-core meshes back in to memory
+        addOutputText( "Water Tight Check Skipped for Out-of-Core Mesh\n" );
+    }
+    else
+    {
+        string resultTxt = CheckWaterTight();
+        addOutputText( resultTxt );
+    }
+
+    WriteMeshStageResults();
 
 //  addOutputText( "Mesh Complete\n");
 
@@ -472,10 +532,29 @@ void CfdMeshMgrSingleton::TransferMeshSettings()
     m_CfdGridDensity.CopyFrom( m_Vehicle->GetCfdGridDensityPtr() );
 }
 
+size_t CfdMeshMgrSingleton::MemoryUsage() const
+{
+    size_t bytes = SurfaceIntersectionSingleton::MemoryUsage();
+
+    bytes += vector_mem_bytes( m_nodeStore ) + m_nodeStore.size() * sizeof( Node );
+    bytes += vector_mem_bytes( m_BadEdges ) + m_BadEdges.size() * sizeof( Edge );
+    bytes += vector_mem_bytes( m_BadTris ) + m_BadTris.size() * sizeof( Tri );
+
+    bytes += m_MeshBadEdgeDO.MemoryUsage() + m_MeshBadTriDO.MemoryUsage();
+    for ( int i = 0 ; i < ( int )m_TagDO.size() ; i++ )
+    {
+        bytes += m_TagDO[i].MemoryUsage();
+    }
+
+    return bytes;
+}
+
 void CfdMeshMgrSingleton::CleanUp()
 {
     SurfaceIntersectionSingleton::CleanUp();
 
+    m_SimpMeshStore.Clear();
+
     int i;
     //==== Delete Stored Ndoes ====//
     for ( i = 0 ; i < ( int )m_nodeStore.size() ; i++ )
@@ -780,6 +859,7 @@ void CfdMeshMgrSingleton::UpdateSourcesAndWakes()
             }
         }
     }
+    GetGridDensityPtr()->BuildSourceTree();
 
     m_WakeMgr.SetLeadingEdges( wake_leading_edges );
     m_Vehicle->UpdateBBox();
@@ -968,7 +1048,13 @@ void CfdMeshMgrSingleton::BuildTargetMap( int output_type )
     for ( i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         m_SurfVec[i]->BuildTargetMap( allsources, i );
-        m_SurfVec[i]->LimitTargetMap();
+    }
+
+    //==== Each Surface Map Is Limited On Its Own ====//
+    #pragma omp parallel for schedule( dynamic )
+    for ( int isurf = 0 ; isurf < ( int )m_SurfVec.size() ; isurf++ )
+    {
+        m_SurfVec[isurf]->LimitTargetMap();
     }
 
     // Set up split sources to provide a source at the endpoint of curves where
@@ -1061,49 +1147,54 @@ void CfdMeshMgrSingleton::Remesh( int output_type )
     char str[256];
     int total_num_tris = 0;
     int nsurf = ( int )m_SurfVec.size();
-    for ( int i = 0 ; i < nsurf ; ++i )
-    {
-        int num_tris = 0;
 
-        int num_rev_removed = 0;
+    //==== Each Surface Mesh Owns Copies of Its Border Nodes - Remesh Surfaces in Parallel ====//
+    vector< vector< string > > msg_vec( nsurf );
+    vector< int > num_tris_vec( nsurf, 0 );
 
-        for ( int iter = 0 ; iter < 10 ; ++iter )
-        {
-            num_tris = 0;
-            m_SurfVec[i]->GetMesh()->Remesh();
+    //==== Finish Each Surface in the Loop, So Uncondensed Simp Tris Never Pile Up ====//
+    bool store_flag = GetCfdSettingsPtr()->m_OutOfCoreFlag;
+    m_SimpMeshStore.Clear();
 
-            num_rev_removed = m_SurfVec[i]->GetMesh()->RemoveRevTris();
+    #pragma omp parallel for schedule( dynamic )
+    for ( int i = 0 ; i < nsurf ; ++i )
+    {
+        Mesh* mesh = m_SurfVec[i]->GetMesh();
 
+        num_tris_vec[i] = RemeshSurf( i, true, msg_vec[i] );
 
-            num_tris += m_SurfVec[i]->GetMesh()->GetTriList().size();
+        mesh->LoadSimpTris();
+        mesh->Clear();
 
-            sprintf( str, "Surf %d/%d Iter %d/10 Num Tris = %d\n", i + 1, nsurf, iter + 1, num_tris );
-            if ( output_type != CfdMeshMgrSingleton::QUIET_OUTPUT )
-            {
-                addOutputText( str, output_type );
-            }
+        if ( GetSettingsPtr()->m_IntersectSubSurfs )
+        {
+            Subtag( m_SurfVec[i] );
         }
-        total_num_tris += num_tris;
+        mesh->CondenseSimpTris();
 
-        if ( num_rev_removed > 0 )
+        if ( m_SurfVec[i]->GetWakeFlag() )
         {
-            sprintf( str, "%d Reversed tris collapsed in final iteration.\n", num_rev_removed );
-            if ( output_type != CfdMeshMgrSingleton::QUIET_OUTPUT )
-            {
-                addOutputText( str, output_type );
-            }
+            m_WakeMgr.StretchWake( mesh );
         }
 
-        m_SurfVec[i]->GetMesh()->LoadSimpTris();
-        m_SurfVec[i]->GetMesh()->Clear();
-        if ( GetSettingsPtr()->m_IntersectSubSurfs )
+        if ( store_flag )
         {
-            Subtag( m_SurfVec[i] );
+            m_SimpMeshStore.Store( i, mesh );
         }
-        m_SurfVec[i]->GetMesh()->CondenseSimpTris();
     }
 
-    m_WakeMgr.StretchWakes();
+    //==== Output in Surface Order ====//
+    for ( int i = 0 ; i < nsurf ; ++i )
+    {
+        if ( output_type != CfdMeshMgrSingleton::QUIET_OUTPUT )
+        {
+            for ( int m = 0 ; m < ( int )msg_vec[i].size() ; m++ )
+            {
+                addOutputText( msg_vec[i][m], output_type );
+            }
+        }
+        total_num_tris += num_tris_vec[i];
+    }
 
     sprintf( str, "Total Num Tris = %d\n", total_num_tris );
     addOutputText( str, output_type );
@@ -1114,26 +1205,30 @@ void CfdMeshMgrSingleton::RemeshSingleComp( int comp_id, int output_type )
     char str[256];
     int total_num_tris = 0;
     int nsurf = ( int )m_SurfVec.size();
+
+    vector< vector< string > > msg_vec( nsurf );
+    vector< int > num_tris_vec( nsurf, 0 );
+
+    #pragma omp parallel for schedule( dynamic )
     for ( int i = 0 ; i < nsurf ; i++ )
     {
-        int num_tris = 0;
         if ( m_SurfVec[i]->GetCompID() == comp_id )
         {
-            for ( int iter = 0 ; iter < 10 ; iter++ )
-            {
-                num_tris = 0;
-                m_SurfVec[i]->GetMesh()->Remesh();
-
-                num_tris += m_SurfVec[i]->GetMesh()->GetTriList().size();
-
-                sprintf( str, "Surf %d/%d Iter %d/10 Num Tris = %d\n", i + 1, nsurf, iter + 1, num_tris );
-                addOutputText( str, output_type );
-            }
-            total_num_tris += num_tris;
+            num_tris_vec[i] = RemeshSurf( i, false, msg_vec[i] );
         }
 
         m_SurfVec[i]->GetMesh()->LoadSimpTris();
         m_SurfVec[i]->GetMesh()->Clear();
+    }
+
+    for ( int i = 0 ; i < nsurf ; i++ )
+    {
+        for ( int m = 0 ; m < ( int )msg_vec[i].size() ; m++ )
+        {
+            addOutputText( msg_vec[i][m], output_type );
+        }
+        total_num_tris += num_tris_vec[i];
+
         if ( GetSettingsPtr()->m_IntersectSubSurfs )
         {
             Subtag( m_SurfVec[i] );
@@ -1145,6 +1240,44 @@ void CfdMeshMgrSingleton::RemeshSingleComp( int comp_id, int output_type )
     addOutputText( str, output_type );
 }
 
+//==== Remesh One Surface - Touches Only That Surface's Mesh, Output Is Saved in msg_vec ====//
+int CfdMeshMgrSingleton::RemeshSurf( int isurf, bool remove_rev_tris, vector< string > & msg_vec )
+{
+    char str[256];
+    int nsurf = ( int )m_SurfVec.size();
+    int num_tris = 0;
+    int num_rev_removed = 0;
+    Mesh* mesh = m_SurfVec[isurf]->GetMesh();
+
+    for ( int iter = 0 ; iter < 10 ; ++iter )
+    {
+        if ( GetCancelFlag() )
+        {
+            break;
+        }
+
+        mesh->Remesh();
+
+        if ( remove_rev_tris )
+        {
+            num_rev_removed = mesh->RemoveRevTris();
+        }
+
+        num_tris = mesh->GetTriList().size();
+
+        sprintf( str, "Surf %d/%d Iter %d/10 Num Tris = %d\n", isurf + 1, nsurf, iter + 1, num_tris );
+        msg_vec.push_back( str );
+    }
+
+    if ( num_rev_removed > 0 )
+    {
+        sprintf( str, "%d Reversed tris collapsed in final iteration.\n", num_rev_removed );
+        msg_vec.push_back( str );
+    }
+
+    return num_tris;
+}
+
 string CfdMeshMgrSingleton::GetQualString()
 {
     //list< Tri* >::iterator t;
@@ -1184,8 +1317,315 @@ string CfdMeshMgrSingleton::GetQualString()
     return "";
 }
 
+//==== Parallel Text Formatters For Mesh Export ====//
+// Used with WriteChunked, these only read the mesh data so items can be
+// formatted concurrently.
+class CfdPntFormatter
+{
+public:
+    // Writes x, y, z or, when swap_yz is set, x, z, -y.  Lines start with the
+    // matching entry of ind_vec when it is given, or with i + 1 when index_flag is set.
+    CfdPntFormatter( const vector< vec3d* > & pnt_vec, const char* format, bool swap_yz = false,
+                     bool index_flag = false, const vector< int > * ind_vec = NULL ) :
+        m_PntVec( pnt_vec ), m_Format( format ), m_SwapYZ( swap_yz ), m_IndexFlag( index_flag ), m_IndVec( ind_vec )     {}
+
+    void operator()( int i, string & buf ) const
+    {
+        const vec3d & p = *m_PntVec[i];
+        double y = m_SwapYZ ? p.z() : p.y();
+        double z = m_SwapYZ ? -p.y() : p.z();
+
+        if ( m_IndVec )
+        {
+            AppendFormat( buf, m_Format, ( *m_IndVec )[i], p.x(), y, z );
+        }
+        else if ( m_IndexFlag )
+        {
+            AppendFormat( buf, m_Format, i + 1, p.x(), y, z );
+        }
+        else
+        {
+            AppendFormat( buf, m_Format, p.x(), y, z );
+        }
+    }
+
+protected:
+    const vector< vec3d* > & m_PntVec;
+    const char* m_Format;
+    bool m_SwapYZ;
+    bool m_IndexFlag;
+    const vector< int > * m_IndVec;
+};
+
+class CfdTriFormatter
+{
+public:
+    enum { DAT_TRI, OBJ_TRI, CART3D_TRI, CART3D_TAG, GMSH_TRI, POLY_TRI };
+
+    // tag_vec is only read for the DAT_TRI and CART3D_TAG types
+    CfdTriFormatter( const vector< SimpTri > & tri_vec, const vector< int > & tag_vec, int type ) :
+        m_TriVec( tri_vec ), m_TagVec( tag_vec ), m_Type( type )      {}
+
+    void operator()( int i, string & buf ) const
+    {
+        const SimpTri & t = m_TriVec[i];
+
+        switch ( m_Type )
+        {
+            case DAT_TRI:
+                AppendFormat( buf, "%d %d %d %d.0\n", t.ind0, t.ind2, t.ind1, m_TagVec[i] );
+                break;
+
+            case OBJ_TRI:
+                AppendFormat( buf, "f %d %d %d \n", t.ind0, t.ind1, t.ind2 );
+                break;
+
+            case CART3D_TRI:
+                AppendFormat( buf, "%d %d %d \n", t.ind0, t.ind1, t.ind2 );
+                break;
+
+            case CART3D_TAG:
+                AppendFormat( buf, "%d \n", m_TagVec[i] );
+                break;
+
+            case GMSH_TRI:
+                AppendFormat( buf, "%d 2 0 %d %d %d \n", i + 1, t.ind0, t.ind1, t.ind2 );
+                break;
+
+            case POLY_TRI:
+                AppendFormat( buf, "1\n3 %d %d %d\n", t.ind0, t.ind1, t.ind2 );
+                break;
+        }
+    }
+
+protected:
+    const vector< SimpTri > & m_TriVec;
+    const vector< int > & m_TagVec;
+    int m_Type;
+};
+
+//==== Xpatch Facets Of One Small Part - Tris Taken From order_vec Starting At start ====//
+class CfdFacetFormatter
+{
+public:
+    CfdFacetFormatter( const vector< SimpTri > & tri_vec, const vector< int > & order_vec, int start, int material_id, unsigned int comp_id ) :
+        m_TriVec( tri_vec ), m_OrderVec( order_vec ), m_Start( start ), m_MaterialID( material_id ), m_CompID( comp_id )       {}
+
+    void operator()( int i, string & buf ) const
+    {
+        const SimpTri & t = m_TriVec[ m_OrderVec[ m_Start + i ] ];
+
+        // 3 nodes of facet, material ID, component ID, running facet #:
+        AppendFormat( buf, "%d %d %d %d %u %d\n", t.ind0, t.ind1, t.ind2, m_MaterialID, m_CompID, m_Start + i + 1 );
+    }
+
+protected:
+    const vector< SimpTri > & m_TriVec;
+    const vector< int > & m_OrderVec;
+    int m_Start;
+    int m_MaterialID;
+    unsigned int m_CompID;
+};
+
+//==== Look Up The Tag Of Each Tri ====//
+static void FindTriTags( const vector< SimpTri > & tri_vec, vector< int > & tag_vec )
+{
+    tag_vec.resize( tri_vec.size() );
+
+    // GetTag only reads the tag map, so the lookups can run concurrently
+    #pragma omp parallel for
+    for ( int i = 0 ; i < ( int )tri_vec.size() ; i++ )
+    {
+        tag_vec[i] = SubSurfaceMgr.GetTag( tri_vec[i].m_Tags );
+    }
+}
+
+//==== Group Tri Indices By Tag In The Order Of tags ====//
+// Tris of tags[i] are order_vec[start_vec[i]] to order_vec[start_vec[i+1] - 1], in
+// their original order.  Tris with an unlisted tag are left out.
+static void GroupTrisByTag( const vector< int > & tri_tag_vec, const vector< int > & tags, vector< int > & order_vec, vector< int > & start_vec )
+{
+    map< int, int > tag_ind_map;
+    for ( int i = 0 ; i < ( int )tags.size() ; i++ )
+    {
+        tag_ind_map.insert( pair< int, int >( tags[i], i ) );
+    }
+
+    vector< int > group_vec( tri_tag_vec.size(), -1 );
+    start_vec.assign( tags.size() + 1, 0 );
+    for ( int t = 0 ; t < ( int )tri_tag_vec.size() ; t++ )
+    {
+        map< int, int >::iterator mi = tag_ind_map.find( tri_tag_vec[t] );
+        if ( mi != tag_ind_map.end() )
+        {
+            group_vec[t] = mi->second;
+            start_vec[ mi->second + 1 ]++;
+        }
+    }
+
+    for ( int i = 0 ; i < ( int )tags.size() ; i++ )
+    {
+        start_vec[i + 1] += start_vec[i];
+    }
+
+    vector< int > fill_vec( start_vec );
+    order_vec.resize( start_vec.back() );
+    for ( int t = 0 ; t < ( int )group_vec.size() ; t++ )
+    {
+        if ( group_vec[t] >= 0 )
+        {
+            order_vec[ fill_vec[ group_vec[t] ]++ ] = t;
+        }
+    }
+}
+
+//==== Fortran Unformatted Record - Byte Count, Data, Byte Count ====//
+static void WriteFortranRecord( FILE* fp, const void* data, int num_bytes )
+{
+    fwrite( &num_bytes, sizeof( int ), 1, fp );
+    if ( num_bytes > 0 )
+    {
+        fwrite( data, 1, num_bytes, fp );
+    }
+    fwrite( &num_bytes, sizeof( int ), 1, fp );
+}
+
+//==== Cart3D Unformatted TRI - Native Byte Order, Double Precision Points ====//
+// Readers tell the precision and byte order from the record markers.  Tri
+// indices in tri_vec are one based.
+static void WriteBinaryTri( FILE* fp, const vector< vec3d* > & pnt_vec, const vector< SimpTri > & tri_vec, const vector< int > & tag_vec )
+{
+    int num_pnt = ( int )pnt_vec.size();
+    int num_tri = ( int )tri_vec.size();
+
+    int cnt[2] = { num_pnt, num_tri };
+    WriteFortranRecord( fp, cnt, sizeof( cnt ) );
+
+    vector< double > xyz_vec( 3 * num_pnt + 1 );
+    #pragma omp parallel for
+    for ( int i = 0 ; i < num_pnt ; i++ )
+    {
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            xyz_vec[ 3 * i + k ] = ( *pnt_vec[i] )[k];
+        }
+    }
+    WriteFortranRecord( fp, &xyz_vec[0], 3 * num_pnt * ( int )sizeof( double ) );
+
+    vector< int > ind_vec( 3 * num_tri + 1 );
+    #pragma omp parallel for
+    for ( int i = 0 ; i < num_tri ; i++ )
+    {
+        ind_vec[ 3 * i ] = tri_vec[i].ind0;
+        ind_vec[ 3 * i + 1 ] = tri_vec[i].ind1;
+        ind_vec[ 3 * i + 2 ] = tri_vec[i].ind2;
+    }
+    WriteFortranRecord( fp, &ind_vec[0], 3 * num_tri * ( int )sizeof( int ) );
+
+    WriteFortranRecord( fp, tag_vec.empty() ? NULL : &tag_vec[0], num_tri * ( int )sizeof( int ) );
+}
+
+//==== Gmsh MSH 4.1 Binary - One Surface Entity Holds All Nodes And Tris ====//
+// Written in native byte order, which readers detect from the integer one in
+// the $MeshFormat section.  Tri indices in tri_vec are one based node tags.
+static void WriteBinaryGmsh( FILE* fp, const vector< vec3d* > & pnt_vec, const vector< SimpTri > & tri_vec )
+{
+    size_t num_pnt = pnt_vec.size();
+    size_t num_tri = tri_vec.size();
+    int one = 1;
+    int ent_tag = 1;
+    size_t zero = 0;
+
+    fprintf( fp, "$MeshFormat\n" );
+    fprintf( fp, "4.1 1 %d\n", ( int )sizeof( size_t ) );
+    fwrite( &one, sizeof( int ), 1, fp );
+    fprintf( fp, "\n$EndMeshFormat\n" );
+
+    //==== Write Entities ====//
+    BndBox box;
+    for ( size_t i = 0 ; i < num_pnt ; i++ )
+    {
+        box.Update( *pnt_vec[i] );
+    }
+
+    size_t ent_cnt[4] = { 0, 0, 1, 0 };                 // Points, curves, surfaces, volumes
+    double ent_box[6] = { box.GetMin( 0 ), box.GetMin( 1 ), box.GetMin( 2 ),
+                          box.GetMax( 0 ), box.GetMax( 1 ), box.GetMax( 2 ) };
+
+    fprintf( fp, "$Entities\n" );
+    fwrite( ent_cnt, sizeof( size_t ), 4, fp );
+    fwrite( &ent_tag, sizeof( int ), 1, fp );
+    fwrite( ent_box, sizeof( double ), 6, fp );
+    fwrite( &zero, sizeof( size_t ), 1, fp );          // Physical tags
+    fwrite( &zero, sizeof( size_t ), 1, fp );          // Bounding curves
+    fprintf( fp, "\n$EndEntities\n" );
+
+    //==== Write Nodes ====//
+    size_t node_head[4] = { 1, num_pnt, ( size_t )( num_pnt > 0 ? 1 : 0 ), num_pnt }; // Blocks, nodes, min tag, max tag
+    int node_block[3] = { 2, ent_tag, 0 };                                            // Entity dim, entity tag, parametric
+
+    vector< size_t > node_tag_vec( num_pnt + 1 );
+    vector< double > xyz_vec( 3 * num_pnt + 1 );
+    #pragma omp parallel for
+    for ( int i = 0 ; i < ( int )num_pnt ; i++ )
+    {
+        node_tag_vec[i] = i + 1;
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            xyz_vec[ 3 * i + k ] = ( *pnt_vec[i] )[k];
+        }
+    }
+
+    fprintf( fp, "$Nodes\n" );
+    fwrite( node_head, sizeof( size_t ), 4, fp );
+    fwrite( node_block, sizeof( int ), 3, fp );
+    fwrite( &num_pnt, sizeof( size_t ), 1, fp );
+    fwrite( &node_tag_vec[0], sizeof( size_t ), num_pnt, fp );
+    fwrite( &xyz_vec[0], sizeof( double ), 3 * num_pnt, fp );
+    fprintf( fp, "\n$EndNodes\n" );
+
+    //==== Write Tris ====//
+    size_t ele_head[4] = { 1, num_tri, ( size_t )( num_tri > 0 ? 1 : 0 ), num_tri }; // Blocks, elements, min tag, max tag
+    int ele_block[3] = { 2, ent_tag, 2 };                                            // Entity dim, entity tag, 3 node tri
+
+    vector< size_t > ele_vec( 4 * num_tri + 1 );
+    #pragma omp parallel for
+    for ( int i = 0 ; i < ( int )num_tri ; i++ )
+    {
+        ele_vec[ 4 * i ] = i + 1;
+        ele_vec[ 4 * i + 1 ] = tri_vec[i].ind0;
+        ele_vec[ 4 * i + 2 ] = tri_vec[i].ind1;
+        ele_vec[ 4 * i + 3 ] = tri_vec[i].ind2;
+    }
+
+    fprintf( fp, "$Elements\n" );
+    fwrite( ele_head, sizeof( size_t ), 4, fp );
+    fwrite( ele_block, sizeof( int ), 3, fp );
+    fwrite( &num_tri, sizeof( size_t ), 1, fp );
+    fwrite( &ele_vec[0], sizeof( size_t ), 4 * num_tri, fp );
+    fprintf( fp, "\n$EndElements\n" );
+}
+
 void CfdMeshMgrSingleton::ExportFiles()
 {
+    //==== Out-of-Core Meshes - Plain STL Streams From the Store, Writers That Weld Points Need Every Mesh Loaded ====//
+    if ( m_SimpMeshStore.HasStored() )
+    {
+        bool tagged_stl = GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_STL_FILE_NAME ) && m_Vehicle->m_STLMultiSolid();
+
+        if ( tagged_stl ||
+             GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_POLY_FILE_NAME ) ||
+             GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_DAT_FILE_NAME ) ||
+             GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_KEY_FILE_NAME ) ||
+             GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_OBJ_FILE_NAME ) ||
+             GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_TRI_FILE_NAME ) ||
+             GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_GMSH_FILE_NAME ) ||
+             GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_FACET_FILE_NAME ) )
+        {
+            LoadStoredMeshes();
+        }
+    }
+
     if ( GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_STL_FILE_NAME ) )
     {
         if ( !m_Vehicle->m_STLMultiSolid() )
@@ -1306,41 +1746,56 @@ void CfdMeshMgrSingleton::WriteTaggedSTL( const string &filename )
         }
     }
 
+    //==== Group Tris By Tag ====//
+    std::vector< int > tags = SubSurfaceMgr.GetAllTags();
+    vector< int > tri_tag_vec, order_vec, start_vec;
+    FindTriTags( allTriVec, tri_tag_vec );
+    GroupTrisByTag( tri_tag_vec, tags, order_vec, start_vec );
+
+    if ( m_Vehicle->m_STLBinary() )
+    {
+        // Binary STL has no solids, the tag of each facet goes in its attribute word
+        vector< vec3d > pnt_vec;
+        vector< int > attr_vec;
+        pnt_vec.reserve( 3 * order_vec.size() );
+        attr_vec.reserve( order_vec.size() );
+        for ( int j = 0; j < ( int ) order_vec.size(); j++ )
+        {
+            SimpTri* stri = &allTriVec[ order_vec[j] ];
+            pnt_vec.push_back( *allUsedPntVec[stri->ind0] );
+            pnt_vec.push_back( *allUsedPntVec[stri->ind1] );
+            pnt_vec.push_back( *allUsedPntVec[stri->ind2] );
+            attr_vec.push_back( tri_tag_vec[ order_vec[j] ] );
+        }
+
+        FILE* file_id = fopen( filename.c_str(), "wb" );
+        if ( file_id )
+        {
+            WriteBinarySTL( file_id, pnt_vec, attr_vec );
+            fclose( file_id );
+        }
+        return;
+    }
+
     FILE* file_id = fopen( filename.c_str(), "w" );
     if ( file_id )
     {
-        std::vector< int > tags = SubSurfaceMgr.GetAllTags();
+        vector< vec3d > pnt_vec;
         for ( int i = 0; i < ( int ) tags.size(); i++ )
         {
             std::string tagname = SubSurfaceMgr.GetTagNames( i );
             fprintf( file_id, "solid %s\n", tagname.c_str() );
 
-            for ( int j = 0; j < ( int ) allTriVec.size(); j++ )
+            pnt_vec.clear();
+            for ( int j = start_vec[i]; j < start_vec[i + 1]; j++ )
             {
-                SimpTri* stri = &allTriVec[j];
-                int t = SubSurfaceMgr.GetTag( stri->m_Tags );
-
-                if ( t == tags[i] )
-                {
-                    vec3d* p0 = allUsedPntVec[stri->ind0];
-                    vec3d* p1 = allUsedPntVec[stri->ind1];
-                    vec3d* p2 = allUsedPntVec[stri->ind2];
-                    vec3d v10 = *p1 - *p0;
-                    vec3d v20 = *p2 - *p1;
-                    vec3d norm = cross( v10, v20 );
-                    norm.normalize();
-
-                    fprintf( file_id, " facet normal  %2.10le %2.10le %2.10le\n",  norm.x(), norm.y(), norm.z() );
-                    fprintf( file_id, "   outer loop\n" );
-
-                    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p0->x(), p0->y(), p0->z() );
-                    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p1->x(), p1->y(), p1->z() );
-                    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p2->x(), p2->y(), p2->z() );
-
-                    fprintf( file_id, "   endloop\n" );
-                    fprintf( file_id, " endfacet\n" );
-                }
+                SimpTri* stri = &allTriVec[ order_vec[j] ];
+                pnt_vec.push_back( *allUsedPntVec[stri->ind0] );
+                pnt_vec.push_back( *allUsedPntVec[stri->ind1] );
+                pnt_vec.push_back( *allUsedPntVec[stri->ind2] );
             }
+            WriteSTLFacets( file_id, pnt_vec );
+
             fprintf( file_id, "endsolid %s\n", tagname.c_str() );
         }
 
@@ -1348,38 +1803,163 @@ void CfdMeshMgrSingleton::WriteTaggedSTL( const string &filename )
     }
 }
 
-void CfdMeshMgrSingleton::WriteSTL( const string &filename )
+//==== Read Every Out-of-Core Mesh Back In to Its Surface ====//
+void CfdMeshMgrSingleton::LoadStoredMeshes()
 {
-    FILE* file_id = fopen( filename.c_str(), "w" );
-    if ( file_id )
+    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    {
+        if ( m_SimpMeshStore.IsStored( i ) )
+        {
+            m_SimpMeshStore.Load( i, m_SurfVec[i]->GetMesh() );
+        }
+    }
+    m_SimpMeshStore.Clear();
+}
+
+//==== Facets of One Surface, Read From the Store When It Is Out of Core ====//
+void CfdMeshMgrSingleton::LoadSurfSTLTris( int isurf, vector< vec3d > & pnt_vec )
+{
+    Mesh* mesh = m_SurfVec[isurf]->GetMesh();
+
+    if ( m_SimpMeshStore.IsStored( isurf ) && m_SimpMeshStore.Load( isurf, mesh ) )
+    {
+        mesh->LoadSTLTris( pnt_vec );
+        mesh->ClearSimpData();
+    }
+    else
+    {
+        mesh->LoadSTLTris( pnt_vec );
+    }
+}
+
+//==== Plain STL Written One Surface at a Time ====//
+void CfdMeshMgrSingleton::WriteStoredSTL( const string &filename )
+{
+    bool binary_flag = m_Vehicle->m_STLBinary();
+
+    FILE* file_id = fopen( filename.c_str(), binary_flag ? "wb" : "w" );
+    if ( !file_id )
+    {
+        return;
+    }
+
+    int nsurf = ( int )m_SurfVec.size();
+    vector< vec3d > pnt_vec;
+
+    if ( binary_flag )
+    {
+        // Binary STL has no solids, wake facets follow the others with an attribute word of one
+        unsigned int num_facet = 0;
+        for ( int i = 0 ; i < nsurf ; i++ )
+        {
+            num_facet += m_SimpMeshStore.IsStored( i ) ? m_SimpMeshStore.GetNumTris( i ) : m_SurfVec[i]->GetMesh()->GetSimpTriVec().size();
+        }
+        WriteBinarySTLHeader( file_id, num_facet );
+
+        for ( int pass = 0 ; pass < 2 ; pass++ )
+        {
+            for ( int i = 0 ; i < nsurf ; i++ )
+            {
+                if ( m_SurfVec[i]->GetWakeFlag() == ( pass == 1 ) )
+                {
+                    pnt_vec.clear();
+                    LoadSurfSTLTris( i, pnt_vec );
+                    WriteBinarySTLFacets( file_id, pnt_vec, vector< int >( pnt_vec.size() / 3, pass ) );
+                }
+            }
+        }
+    }
+    else
     {
-        int numwake = 0;
+        bool wake_flag = false;
+
         fprintf( file_id, "solid\n" );
-        for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+        for ( int i = 0 ; i < nsurf ; i++ )
         {
             if ( !m_SurfVec[i]->GetWakeFlag() )
             {
-                m_SurfVec[i]->GetMesh()->WriteSTL( file_id );
+                pnt_vec.clear();
+                LoadSurfSTLTris( i, pnt_vec );
+                WriteSTLFacets( file_id, pnt_vec );
             }
             else
             {
-                numwake++;
+                wake_flag = true;
             }
         }
         fprintf( file_id, "endsolid\n" );
 
-        if( numwake > 0 )
+        if ( wake_flag )
         {
             fprintf( file_id, "solid wake\n" );
-            for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+            for ( int i = 0 ; i < nsurf ; i++ )
             {
                 if ( m_SurfVec[i]->GetWakeFlag() )
                 {
-                    m_SurfVec[i]->GetMesh()->WriteSTL( file_id );
+                    pnt_vec.clear();
+                    LoadSurfSTLTris( i, pnt_vec );
+                    WriteSTLFacets( file_id, pnt_vec );
                 }
             }
             fprintf( file_id, "endsolid wake\n" );
         }
+    }
+
+    fclose( file_id );
+}
+
+void CfdMeshMgrSingleton::WriteSTL( const string &filename )
+{
+    if ( m_SimpMeshStore.HasStored() )
+    {
+        WriteStoredSTL( filename );
+        return;
+    }
+
+    //==== Gather Facets - Wakes Are Kept Apart ====//
+    vector< vec3d > pnt_vec;
+    vector< vec3d > wake_pnt_vec;
+    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    {
+        if ( !m_SurfVec[i]->GetWakeFlag() )
+        {
+            m_SurfVec[i]->GetMesh()->LoadSTLTris( pnt_vec );
+        }
+        else
+        {
+            m_SurfVec[i]->GetMesh()->LoadSTLTris( wake_pnt_vec );
+        }
+    }
+
+    if ( m_Vehicle->m_STLBinary() )
+    {
+        // Binary STL has no solids, wake facets follow the others with an attribute word of one
+        vector< int > attr_vec( pnt_vec.size() / 3, 0 );
+        attr_vec.resize( ( pnt_vec.size() + wake_pnt_vec.size() ) / 3, 1 );
+        pnt_vec.insert( pnt_vec.end(), wake_pnt_vec.begin(), wake_pnt_vec.end() );
+
+        FILE* file_id = fopen( filename.c_str(), "wb" );
+        if ( file_id )
+        {
+            WriteBinarySTL( file_id, pnt_vec, attr_vec );
+            fclose( file_id );
+        }
+        return;
+    }
+
+    FILE* file_id = fopen( filename.c_str(), "w" );
+    if ( file_id )
+    {
+        fprintf( file_id, "solid\n" );
+        WriteSTLFacets( file_id, pnt_vec );
+        fprintf( file_id, "endsolid\n" );
+
+        if( wake_pnt_vec.size() > 0 )
+        {
+            fprintf( file_id, "solid wake\n" );
+            WriteSTLFacets( file_id, wake_pnt_vec );
+            fprintf( file_id, "endsolid wake\n" );
+        }
         fclose( file_id );
     }
 }
@@ -1414,18 +1994,24 @@ void CfdMeshMgrSingleton::WriteTetGen( const string &filename )
     fprintf( fp, "%d 3 0 0\n", numPnts );
 
     //==== Write Model Pnts ====//
+    vector< vec3d* > usedPntVec;
+    vector< int > usedIndVec;
     for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
     {
         if ( pntShift[i] >= 0 )
         {
-            fprintf( fp, "%d %.16g %.16g %.16g\n", i + 1, allPntVec[i]->x(), allPntVec[i]->y(), allPntVec[i]->z() );
+            usedPntVec.push_back( allPntVec[i] );
+            usedIndVec.push_back( i + 1 );
         }
     }
+    WriteChunked( fp, ( int )usedPntVec.size(), CfdPntFormatter( usedPntVec, "%d %.16g %.16g %.16g\n", false, false, &usedIndVec ) );
 
     //==== Write Tris ====//
     fprintf( fp, "# Part 2 - facet list\n" );
     fprintf( fp, "%d 0\n", tri_cnt );
 
+    vector< SimpTri > allTriVec;
+    allTriVec.reserve( tri_cnt );
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         vector < SimpTri >& sTriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
@@ -1435,14 +2021,15 @@ void CfdMeshMgrSingleton::WriteTetGen( const string &filename )
             int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], allPntVec, indMap );
             int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], allPntVec, indMap );
             int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], allPntVec, indMap );
-            int ind1 = pntShift[i0] + 1;
-            int ind2 = pntShift[i1] + 1;
-            int ind3 = pntShift[i2] + 1;
-
-            fprintf( fp, "1\n" );
-            fprintf( fp, "3 %d %d %d\n", ind1, ind2, ind3 );
+            SimpTri stri;
+            stri.ind0 = pntShift[i0] + 1;
+            stri.ind1 = pntShift[i1] + 1;
+            stri.ind2 = pntShift[i2] + 1;
+            allTriVec.push_back( stri );
         }
     }
+    vector< int > no_tag_vec;
+    WriteChunked( fp, ( int )allTriVec.size(), CfdTriFormatter( allTriVec, no_tag_vec, CfdTriFormatter::POLY_TRI ) );
 
     fprintf( fp, "# Part 3 - Hole List\n" );
 
@@ -1637,6 +2224,13 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
         }
     }
 
+    //==== Tags Of All Tris ====//
+    vector< int > allTagVec;
+    if ( dat_fn.length() != 0 || tri_fn.length() != 0 )
+    {
+        FindTriTags( allTriVec, allTagVec );
+    }
+
     //=====================================================================================//
     //==== Write NASCART File =================================================================//
     //=====================================================================================//
@@ -1650,18 +2244,10 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
             fprintf( fp, "%d %d\n", ( int )allUsedPntVec.size(), ( int )allTriVec.size() );
 
             //==== Write Pnts ====//
-            for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
-            {
-                fprintf( fp, "%.16g %.16g %.16g\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->z(), -allUsedPntVec[i]->y() );
-            }
+            WriteChunked( fp, ( int )allUsedPntVec.size(), CfdPntFormatter( allUsedPntVec, "%.16g %.16g %.16g\n", true ) );
 
             //==== Write Tris ====//
-            for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
-            {
-                fprintf( fp, "%d %d %d %d.0\n",
-                         allTriVec[i].ind0, allTriVec[i].ind2, allTriVec[i].ind1,
-                         SubSurfaceMgr.GetTag( allTriVec[i].m_Tags ) );
-            }
+            WriteChunked( fp, ( int )allTriVec.size(), CfdTriFormatter( allTriVec, allTagVec, CfdTriFormatter::DAT_TRI ) );
             fclose( fp );
         }
     }
@@ -1681,17 +2267,11 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
         if ( fp )
         {
             //==== Write Pnts ====//
-            for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
-            {
-                fprintf( fp, "v %16.10f %16.10f %16.10f\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->z(), -allUsedPntVec[i]->y() );
-            }
+            WriteChunked( fp, ( int )allUsedPntVec.size(), CfdPntFormatter( allUsedPntVec, "v %16.10f %16.10f %16.10f\n", true ) );
             fprintf( fp, "\n" );
 
             //==== Write Tris ====//
-            for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
-            {
-                fprintf( fp, "f %d %d %d \n", allTriVec[i].ind0, allTriVec[i].ind1, allTriVec[i].ind2 );
-            }
+            WriteChunked( fp, ( int )allTriVec.size(), CfdTriFormatter( allTriVec, allTagVec, CfdTriFormatter::OBJ_TRI ) );
             fclose( fp );
         }
     }
@@ -1700,7 +2280,17 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
     //=====================================================================================//
     //==== Write TRI File for Cart3D ======================================================//
     //=====================================================================================//
-    if ( tri_fn.length() != 0 )
+    if ( tri_fn.length() != 0 && GetCfdSettingsPtr()->m_ExportBinaryFlag )
+    {
+        FILE* fp = fopen( tri_fn.c_str(), "wb" );
+
+        if ( fp )
+        {
+            WriteBinaryTri( fp, allUsedPntVec, allTriVec, allTagVec );
+            fclose( fp );
+        }
+    }
+    else if ( tri_fn.length() != 0 )
     {
         FILE* fp = fopen( tri_fn.c_str(), "w" );
 
@@ -1710,22 +2300,13 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
             fprintf( fp, "%d %d\n", ( int )allUsedPntVec.size(), ( int )allTriVec.size() );
 
             //==== Write Pnts ====//
-            for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
-            {
-                fprintf( fp, "%16.10g %16.10g %16.10g\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->y(), allUsedPntVec[i]->z() );
-            }
+            WriteChunked( fp, ( int )allUsedPntVec.size(), CfdPntFormatter( allUsedPntVec, "%16.10g %16.10g %16.10g\n" ) );
 
             //==== Write Tris ====//
-            for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
-            {
-                fprintf( fp, "%d %d %d \n", allTriVec[i].ind0, allTriVec[i].ind1, allTriVec[i].ind2 );
-            }
+            WriteChunked( fp, ( int )allTriVec.size(), CfdTriFormatter( allTriVec, allTagVec, CfdTriFormatter::CART3D_TRI ) );
 
             //==== Write Component ID ====//
-            for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
-            {
-                fprintf( fp, "%d \n", SubSurfaceMgr.GetTag( allTriVec[i].m_Tags ) );
-            }
+            WriteChunked( fp, ( int )allTriVec.size(), CfdTriFormatter( allTriVec, allTagVec, CfdTriFormatter::CART3D_TAG ) );
 
             fclose( fp );
         }
@@ -1734,7 +2315,16 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
     //=====================================================================================//
     //==== Write gmsh File           ======================================================//
     //=====================================================================================//
-    if ( gmsh_fn.length() != 0 )
+    if ( gmsh_fn.length() != 0 && GetCfdSettingsPtr()->m_ExportBinaryFlag )
+    {
+        FILE* fp = fopen( gmsh_fn.c_str(), "wb" );
+        if ( fp )
+        {
+            WriteBinaryGmsh( fp, allUsedPntVec, allTriVec );
+            fclose( fp );
+        }
+    }
+    else if ( gmsh_fn.length() != 0 )
     {
         FILE* fp = fopen( gmsh_fn.c_str(), "w" );
         if ( fp )
@@ -1746,23 +2336,15 @@ void CfdMeshMgrSingleton::WriteNASCART_Obj_Tri_Gmsh( const string &dat_fn, const
             //==== Write Nodes ====//
             fprintf( fp, "$Nodes\n" );
             fprintf( fp, "%d\n", ( int )allUsedPntVec.size() );
-            for ( int i = 0 ; i < ( int )allUsedPntVec.size() ; i++ )
-            {
-                fprintf( fp, "%d %16.10f %16.10f %16.10f\n", i + 1,
-                         allUsedPntVec[i]->x(), allUsedPntVec[i]->y(), allUsedPntVec[i]->z() );
-            }
+            WriteChunked( fp, ( int )allUsedPntVec.size(), CfdPntFormatter( allUsedPntVec, "%d %16.10f %16.10f %16.10f\n", false, true ) );
             fprintf( fp, "$EndNodes\n" );
 
             //==== Write Tris ====//
             fprintf( fp, "$Elements\n" );
             fprintf( fp, "%d\n", ( int )allTriVec.size() );
 
-            int ele_cnt = 1;
-            for ( int i = 0 ; i < ( int )allTriVec.size() ; i++ )
-            {
-                fprintf( fp, "%d 2 0 %d %d %d \n", ele_cnt, allTriVec[i].ind0, allTriVec[i].ind1, allTriVec[i].ind2 );
-                ele_cnt++;
-            }
+            vector< int > no_tag_vec;
+            WriteChunked( fp, ( int )allTriVec.size(), CfdTriFormatter( allTriVec, no_tag_vec, CfdTriFormatter::GMSH_TRI ) );
 
             fprintf( fp, "$EndElements\n" );
             fclose( fp );
@@ -1847,61 +2429,32 @@ void CfdMeshMgrSingleton::WriteFacet( const string &facet_fn )
             fprintf( fp, "%d \n", (int)allUsedPntVec.size() ); // # of nodes in "Big" part
 
             //==== Write All Pnts (Nodes) ====//
-            for ( int i = 0; i < (int)allUsedPntVec.size(); i++ )
-            {
-                fprintf( fp, "%16.10g %16.10g %16.10g\n", allUsedPntVec[i]->x(), allUsedPntVec[i]->y(), allUsedPntVec[i]->z() );
-            }
-
-            vector < int > tri_offset; // vector of number of tris for each tag
+            WriteChunked( fp, ( int )allUsedPntVec.size(), CfdPntFormatter( allUsedPntVec, "%16.10g %16.10g %16.10g\n" ) );
 
             int materialID = 0; // Default Material ID of PEC (Referred to as "iCoat" in XPatch facet file documentation)
 
             vector < int > all_tag_vec = SubSurfaceMgr.GetAllTags(); // vector of tags, where each tag identifies a part or group of facets
 
-            //==== Get # of facets for each part ====//
-            for ( unsigned int i = 0; i < all_tag_vec.size(); i++ )
-            {
-                int tag_count = 0;
-
-                for ( unsigned int j = 0; j < allTriVec.size(); j++ )
-                {
-                    if ( all_tag_vec[i] == SubSurfaceMgr.GetTag( allTriVec[j].m_Tags ) )
-                    {
-                        tag_count++;
-                    }
-                }
-
-                tri_offset.push_back( tag_count );
-            }
-
-            fprintf( fp, "%zu \n", tri_offset.size() ); // # of "Small" parts
+            //==== Group facets by part ====//
+            vector < int > tri_tag_vec, order_vec;
+            vector < int > tri_offset; // start of the tris of each tag in order_vec
+            FindTriTags( allTriVec, tri_tag_vec );
+            GroupTrisByTag( tri_tag_vec, all_tag_vec, order_vec, tri_offset );
 
-            int facet_count = 0; // counter for number of tris/facets
+            fprintf( fp, "%zu \n", all_tag_vec.size() ); // # of "Small" parts
 
-                                 //==== Write Out Tris ====//
+            //==== Write Out Tris ====//
             for ( unsigned int i = 0; i < all_tag_vec.size(); i++ )
             {
-                int curr_tag = all_tag_vec[i];
-                bool new_section = true; // flag to write small part section header
-
-                for ( unsigned int j = 0; j < allTriVec.size(); j++ )
+                int num_facet = tri_offset[i + 1] - tri_offset[i];
+                if ( num_facet > 0 )
                 {
-                    if ( curr_tag == SubSurfaceMgr.GetTag( allTriVec[j].m_Tags ) ) // only write out current tris for surrent tag
-                    {
-                        if ( new_section ) // write small part header and get material ID for small part
-                        {
-                            string name = SubSurfaceMgr.GetTagNames( allTriVec[j].m_Tags );
-                            fprintf( fp, "%s\n", name.c_str() ); // Write name of small part
-                            fprintf( fp, "%d 3\n", tri_offset[i] ); // Number of facets for the part, 3 nodes per facet
-
-                            new_section = false;
-                        }
-
-                        facet_count++;
+                    // Write small part header and facets for the current tag
+                    string name = SubSurfaceMgr.GetTagNames( allTriVec[ order_vec[ tri_offset[i] ] ].m_Tags );
+                    fprintf( fp, "%s\n", name.c_str() ); // Write name of small part
+                    fprintf( fp, "%d 3\n", num_facet ); // Number of facets for the part, 3 nodes per facet
 
-                        // 3 nodes of facet, material ID, component ID, running facet #:
-                        fprintf( fp, "%d %d %d %d %u %d\n", allTriVec[j].ind0, allTriVec[j].ind1, allTriVec[j].ind2, materialID, i + 1, facet_count );
-                    }
+                    WriteChunked( fp, num_facet, CfdFacetFormatter( allTriVec, order_vec, tri_offset[i], materialID, i + 1 ) );
                 }
             }
             fclose( fp );
@@ -1911,122 +2464,165 @@ void CfdMeshMgrSingleton::WriteFacet( const string &facet_fn )
 
 string CfdMeshMgrSingleton::CheckWaterTight()
 {
-    vector< Tri* > triVec;
+    //==== Surfaces Included in the Check ====//
+    vector< int > surf_ind_vec;
+    vector< int > pnt_offset;
+    vector< int > tri_offset;
+    int num_pnts = 0;
+    int num_tris = 0;
 
-    int tri_cnt = 0;
-    vector< vec3d* > allPntVec;
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         if( m_SurfVec[i]->GetSurfaceCfdType() != vsp::CFD_TRANSPARENT || m_SurfVec[i]->GetFarFlag() || m_SurfVec[i]->GetSymPlaneFlag() )
         {
-            vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-            for ( int v = 0 ; v < ( int )sPntVec.size() ; v++ )
-            {
-                allPntVec.push_back( &sPntVec[v] );
-            }
-            tri_cnt += m_SurfVec[i]->GetMesh()->GetSimpTriVec().size();
+            surf_ind_vec.push_back( i );
+            pnt_offset.push_back( num_pnts );
+            tri_offset.push_back( num_tris );
+            num_pnts += m_SurfVec[i]->GetMesh()->GetSimpPntVec().size();
+            num_tris += m_SurfVec[i]->GetMesh()->GetSimpTriVec().size();
         }
     }
+    int num_surf = ( int )surf_ind_vec.size();
 
-    //==== Build Map ====//
-    map< int, vector< int > > indMap;
-    vector< int > pntShift;
-    BuildIndMap( allPntVec, indMap, pntShift );
+    //==== Weld Coincident Points Across Surfaces With the KD-Tree ====//
+    PntNodeCloud cloud;
+    cloud.ReserveMorePntNodes( num_pnts );
+    for ( int s = 0 ; s < num_surf ; s++ )
+    {
+        cloud.AddPntNodes( m_SurfVec[surf_ind_vec[s]]->GetMesh()->GetSimpPntVec() );
+    }
+    IndexPntNodes( cloud, 1.0e-12 );
 
     //==== Create Nodes ====//
-    for ( int i = 0 ; i < ( int )allPntVec.size() ; i++ )
+    int node_offset = ( int )m_nodeStore.size();
+    for ( int i = 0 ; i < num_pnts ; i++ )
     {
-        if ( pntShift[i] >= 0 )
+        if ( cloud.UsedNode( i ) )
         {
             Node* n = new Node();
-            n->pnt = *allPntVec[i];
+            n->pnt = cloud.m_PntNodes[i].m_Pnt;
             m_nodeStore.push_back( n );
         }
     }
 
-    //==== Create Edges and Tris ====//
-    int moreThanTwoTriPerEdge = 0;
-    map< int, vector<Edge*> > edgeMap;
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    //==== Welded Indices of Each Tri Corner ====//
+    vector< int > corner_vec( 3 * num_tris );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int s = 0 ; s < num_surf ; s++ )
     {
-        if( m_SurfVec[i]->GetSurfaceCfdType() != vsp::CFD_TRANSPARENT || m_SurfVec[i]->GetFarFlag() || m_SurfVec[i]->GetSymPlaneFlag() )
+        vector < SimpTri >& sTriVec = m_SurfVec[surf_ind_vec[s]]->GetMesh()->GetSimpTriVec();
+        for ( int t = 0 ; t < ( int )sTriVec.size() ; t++ )
         {
-            vector < SimpTri >& sTriVec = m_SurfVec[i]->GetMesh()->GetSimpTriVec();
-            vector< vec3d >& sPntVec = m_SurfVec[i]->GetMesh()->GetSimpPntVec();
-            for ( int t = 0 ; t <  ( int )sTriVec.size() ; t++ )
-            {
-                int i0 = FindPntIndex( sPntVec[sTriVec[t].ind0], allPntVec, indMap );
-                int i1 = FindPntIndex( sPntVec[sTriVec[t].ind1], allPntVec, indMap );
-                int i2 = FindPntIndex( sPntVec[sTriVec[t].ind2], allPntVec, indMap );
-                int ind1 = pntShift[i0];
-                int ind2 = pntShift[i1];
-                int ind3 = pntShift[i2];
+            int c = 3 * ( tri_offset[s] + t );
+            corner_vec[c    ] = cloud.GetNodeUsedIndex( pnt_offset[s] + sTriVec[t].ind0 );
+            corner_vec[c + 1] = cloud.GetNodeUsedIndex( pnt_offset[s] + sTriVec[t].ind1 );
+            corner_vec[c + 2] = cloud.GetNodeUsedIndex( pnt_offset[s] + sTriVec[t].ind2 );
+        }
+    }
 
-                Edge* e0 = FindAddEdge( edgeMap, m_nodeStore, ind1, ind2 );
-                Edge* e1 = FindAddEdge( edgeMap, m_nodeStore, ind2, ind3 );
-                Edge* e2 = FindAddEdge( edgeMap, m_nodeStore, ind3, ind1 );
+    //==== Edge Keys - Edge k of Tri t Is Slot 3t+k ====//
+    int num_slots = 3 * num_tris;
+    long long num_nodes = cloud.m_NumUsedPts;
+    vector< long long > key_vec( num_slots );
 
-                Tri* tri = new Tri( m_nodeStore[ind1], m_nodeStore[ind2], m_nodeStore[ind3], e0, e1, e2 );
+    #pragma omp parallel for
+    for ( int t = 0 ; t < num_tris ; t++ )
+    {
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            long long a = corner_vec[3 * t + k];
+            long long b = corner_vec[3 * t + ( k + 1 ) % 3];
+            key_vec[3 * t + k] = ( a < b ) ? a * num_nodes + b : b * num_nodes + a;
+        }
+    }
 
-                if ( !e0->SetTri( tri ) )
-                {
-                    tri->debugFlag = true;
-                    moreThanTwoTriPerEdge++;
-                }
-                if ( !e1->SetTri( tri ) )
-                {
-                    tri->debugFlag = true;
-                    moreThanTwoTriPerEdge++;
-                }
-                if ( !e2->SetTri( tri ) )
-                {
-                    tri->debugFlag = true;
-                    moreThanTwoTriPerEdge++;
-                }
-                triVec.push_back( tri );
+    //==== Split the Edge Hash Table by Key Hash So Each Bucket Counts Independently ====//
+    const int num_bucket = 256;
+    vector< int > bucket_vec( num_slots );
+    vector< int > bucket_start( num_bucket + 1, 0 );
 
-                if ( tri->debugFlag )
-                {
-                    m_BadTris.push_back( tri );
-                }
-            }
-        }
+    #pragma omp parallel for
+    for ( int e = 0 ; e < num_slots ; e++ )
+    {
+        unsigned long long h = ( unsigned long long )key_vec[e] * 11400714819323198485ULL;
+        bucket_vec[e] = ( int )( h >> 56 );
     }
 
-    //==== Find Border Edges ====//
-    int num_border_edges = 0;
-    map<int, vector<Edge*> >::const_iterator iter;
-    for ( iter = edgeMap.begin() ; iter != edgeMap.end() ; ++iter )
+    for ( int e = 0 ; e < num_slots ; e++ )
     {
-        for ( int i = 0 ; i < ( int )iter->second.size() ; i++ )
+        bucket_start[bucket_vec[e] + 1]++;
+    }
+    for ( int b = 0 ; b < num_bucket ; b++ )
+    {
+        bucket_start[b + 1] += bucket_start[b];
+    }
+
+    // Slots stay in tri order inside each bucket
+    vector< int > slot_vec( num_slots );
+    vector< int > fill_vec( bucket_start.begin(), bucket_start.end() - 1 );
+    for ( int e = 0 ; e < num_slots ; e++ )
+    {
+        slot_vec[fill_vec[bucket_vec[e]]++] = e;
+    }
+
+    //==== Count Incidences - Rank Is How Many Tris Used the Edge Before This One ====//
+    vector< int > rank_vec( num_slots, 0 );
+    vector< char > border_vec( num_slots, 0 );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int b = 0 ; b < num_bucket ; b++ )
+    {
+        unordered_map< long long, int > count_map;
+        count_map.reserve( bucket_start[b + 1] - bucket_start[b] );
+
+        for ( int j = bucket_start[b] ; j < bucket_start[b + 1] ; j++ )
         {
-            Edge* e = iter->second[i];
-            if ( !( e->t0 && e->t1 ) )
-            {
-                m_BadEdges.push_back( e );
-                e->debugFlag = true;
-                num_border_edges++;
-            }
+            int e = slot_vec[j];
+            rank_vec[e] = count_map[ key_vec[e] ]++;
+        }
 
+        for ( int j = bucket_start[b] ; j < bucket_start[b + 1] ; j++ )
+        {
+            int e = slot_vec[j];
+            border_vec[e] = ( count_map[ key_vec[e] ] == 1 );
         }
     }
 
-    //==== Clean Up ====//
-    for ( iter = edgeMap.begin() ; iter != edgeMap.end() ; ++iter )
+    //==== Border Edges and Tris on Edges With More Than Two Tris ====//
+    int num_border_edges = 0;
+    int moreThanTwoTriPerEdge = 0;
+    for ( int t = 0 ; t < num_tris ; t++ )
     {
-        for ( int i = 0 ; i < ( int )iter->second.size() ; i++ )
+        Node* n[3];
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            n[k] = m_nodeStore[node_offset + corner_vec[3 * t + k]];
+        }
+
+        bool bad_tri = false;
+        for ( int k = 0 ; k < 3 ; k++ )
         {
-            if ( ! iter->second[i]->debugFlag )
+            int e = 3 * t + k;
+            if ( border_vec[e] )
+            {
+                Edge* edge = new Edge( n[k], n[( k + 1 ) % 3] );
+                edge->debugFlag = true;
+                m_BadEdges.push_back( edge );
+                num_border_edges++;
+            }
+            if ( rank_vec[e] >= 2 )
             {
-                delete iter->second[i];
+                bad_tri = true;
+                moreThanTwoTriPerEdge++;
             }
         }
-    }
-    for ( int i = 0 ; i < ( int )triVec.size() ; i++ )
-    {
-        if ( ! triVec[i]->debugFlag )
+
+        if ( bad_tri )
         {
-            delete triVec[i];
+            Tri* tri = new Tri( n[0], n[1], n[2], NULL, NULL, NULL );
+            tri->debugFlag = true;
+            m_BadTris.push_back( tri );
         }
     }
 
@@ -2045,32 +2641,6 @@ string CfdMeshMgrSingleton::CheckWaterTight()
 
 }
 
-Edge* CfdMeshMgrSingleton::FindAddEdge( map< int, vector<Edge*> > & edgeMap, vector< Node* > & nodeVec, int ind1, int ind2 )
-{
-    Edge* e = NULL;
-    map<int, vector<Edge*> >::const_iterator iter;
-    int combind = ind1 + ind2;
-    iter = edgeMap.find( combind );
-
-    if ( iter != edgeMap.end() )    // Found Edge Vec so Check
-    {
-        vector<Edge*> eVec = edgeMap[combind];
-        for ( int i = 0 ; i < ( int )eVec.size() ; i++ )
-        {
-            if ( eVec[i]->ContainsNodes( nodeVec[ind1], nodeVec[ind2] ) )
-            {
-                return eVec[i];
-            }
-        }
-    }
-
-    //==== No Edge Found so Create
-    e = new Edge( nodeVec[ind1], nodeVec[ind2] );
-    edgeMap[combind].push_back( e );
-
-    return e;
-}
-
 int CfdMeshMgrSingleton::BuildIndMap( vector< vec3d* > & allPntVec, map< int, vector< int > >& indMap, vector< int > & pntShift )
 {
 //double max_dist = 0.0;
@@ -2434,26 +3004,47 @@ void CfdMeshMgrSingleton::InitMesh( )
 void CfdMeshMgrSingleton::TessellateChains()
 {
     //==== Tessellate Chains ====//
+    // Curve tessellation is independent per chain and runs in parallel.  ApplyTess
+    // registers new Puws with the manager, so it stays serial and in list order.
+    vector< ISegChain* > chain_vec;
+    vector< ISegChain* > wake_chain_vec;
     list< ISegChain* >::iterator c;
     for ( c = m_ISegChainList.begin() ; c != m_ISegChainList.end(); ++c )
     {
         if( ( *c )->GetWakeAttachChain() == NULL ) // Non wake-attach chains.
         {
-            ( *c )->Tessellate();
-            ( *c )->TransferTess();
-            ( *c )->ApplyTess( this );
+            chain_vec.push_back( *c );
+        }
+        else
+        {
+            wake_chain_vec.push_back( *c );
         }
     }
 
-    for ( c = m_ISegChainList.begin() ; c != m_ISegChainList.end(); ++c )
+    #pragma omp parallel for schedule( dynamic )
+    for ( int i = 0 ; i < ( int )chain_vec.size() ; i++ )
     {
-        if( ( *c )->GetWakeAttachChain() != NULL ) // Only wake-attach chains.
-        {
-            vector< double > u = ( *c )->GetWakeAttachChain()->m_ACurve.GetUTessPnts();
-            ( *c )->m_ACurve.Tesselate( u ); // Copy tessellation from matching chain.
-            ( *c )->TransferTess();
-            ( *c )->ApplyTess( this );
-        }
+        chain_vec[i]->Tessellate();
+        chain_vec[i]->TransferTess();
+    }
+
+    for ( int i = 0 ; i < ( int )chain_vec.size() ; i++ )
+    {
+        chain_vec[i]->ApplyTess( this );
+    }
+
+    // Wake-attach chains copy the tessellation of their matching chain, so they follow.
+    #pragma omp parallel for schedule( dynamic )
+    for ( int i = 0 ; i < ( int )wake_chain_vec.size() ; i++ )
+    {
+        vector< double > u = wake_chain_vec[i]->GetWakeAttachChain()->m_ACurve.GetUTessPnts();
+        wake_chain_vec[i]->m_ACurve.Tesselate( u ); // Copy tessellation from matching chain.
+        wake_chain_vec[i]->TransferTess();
+    }
+
+    for ( int i = 0 ; i < ( int )wake_chain_vec.size() ; i++ )
+    {
+        wake_chain_vec[i]->ApplyTess( this );
     }
 
 
@@ -2688,45 +3279,75 @@ void CfdMeshMgrSingleton::MergeBorderEndPoints()
 
 void CfdMeshMgrSingleton::MergeIPntGroups( list< IPntGroup* > & iPntGroupList, double tol_fract )
 {
-    //===== Merge Two Closest Groups While Under Tol ====//
-    IPntGroup* nearG1 = NULL;
-    IPntGroup* nearG2 = NULL;
-    double nearDistFract;
-    bool stopFlag = false;
-    while( !stopFlag )
+    // A merged group keeps the first point of the surviving group, so the distance between
+    // two groups never changes.  Merging every pair under tol from closest to farthest,
+    // skipping pairs where either group is already merged away, therefore gives the same
+    // result as repeatedly merging the two closest groups.  Ties go to the pair found first
+    // in list order, with the earlier group surviving, as in the exhaustive search.
+    vector< IPntGroup* > group_vec( iPntGroupList.begin(), iPntGroupList.end() );
+    int num_groups = ( int )group_vec.size();
+
+    if ( num_groups < 2 )
     {
-        stopFlag = true;
-        nearDistFract = 1.0e12;
+        return;
+    }
 
-        //==== Find Closest Two Groups ====//
-        list< IPntGroup* >::iterator g;
-        for ( g = iPntGroupList.begin() ; g != iPntGroupList.end(); ++g )
+    PntNodeCloud cloud;
+    cloud.ReserveMorePntNodes( num_groups );
+    for ( int i = 0 ; i < num_groups ; i++ )
+    {
+        cloud.AddPntNode( group_vec[i]->m_IPntVec[0]->m_Pnt );
+    }
+
+    PNTree index( 3, cloud, KDTreeSingleIndexAdaptorParams( 10 ) );
+    index.buildIndex();
+
+    //==== Find Pairs Under Tol - Tree Searches Squared Distance, Pad And Test Exactly ====//
+    vector< pair< double, pair< int, int > > > near_pair_vec;
+    double search_rad = tol_fract * tol_fract * ( 1.0 + 1.0e-6 );
+    nanoflann::SearchParams params( 32, 0, false );
+    PNTreeResults ret_matches;
+    for ( int i = 0 ; i < num_groups ; i++ )
+    {
+        ret_matches.clear();
+        index.radiusSearch( &cloud.m_PntNodes[i].m_Pnt[0], search_rad, ret_matches, params );
+
+        for ( int j = 0 ; j < ( int )ret_matches.size() ; j++ )
         {
-            list< IPntGroup* >::iterator h;
-            for ( h = iPntGroupList.begin() ; h != iPntGroupList.end(); ++h )
+            int k = ( int )ret_matches[j].first;
+            if ( k > i )
             {
-                if ( ( *g ) != ( *h ) )
+                double df = group_vec[i]->GroupDist( group_vec[k] );
+                if ( df < tol_fract )
                 {
-                    double df = ( *g )->GroupDist( ( *h ) );
-                    if ( df < nearDistFract )
-                    {
-                        nearDistFract = df;
-                        nearG1 = ( *g );
-                        nearG2 = ( *h );
-                    }
+                    near_pair_vec.push_back( make_pair( df, make_pair( i, k ) ) );
                 }
             }
         }
+    }
+
+    sort( near_pair_vec.begin(), near_pair_vec.end() );
 
-        if ( nearDistFract < tol_fract )
+    //===== Merge Closest Groups First ====//
+    vector< bool > merged_flag( num_groups, false );
+    for ( int p = 0 ; p < ( int )near_pair_vec.size() ; p++ )
+    {
+        int i = near_pair_vec[p].second.first;
+        int k = near_pair_vec[p].second.second;
+
+        if ( !merged_flag[i] && !merged_flag[k] )
         {
-            if ( nearG1 && nearG2 )
-            {
-                nearG1->AddGroup( nearG2 );
-            }
-//          delete nearG2;
-            iPntGroupList.remove( nearG2 );
-            stopFlag = false;
+            group_vec[i]->AddGroup( group_vec[k] );
+            merged_flag[k] = true;
+        }
+    }
+
+    iPntGroupList.clear();
+    for ( int i = 0 ; i < num_groups ; i++ )
+    {
+        if ( !merged_flag[i] )
+        {
+            iPntGroupList.push_back( group_vec[i] );
         }
     }
 }
@@ -2858,48 +3479,82 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
     }
     double x_dist = 1.0 + big_box.GetMax( 0 ) - big_box.GetMin( 0 );
 
-    //==== Count Number of Component Crossings for Each Component =====//
-    list< Tri* >::iterator t;
-    for ( s = 0 ; s < ( int )m_SurfVec.size() ; ++s ) // every surface
+    int num_comp_slot = m_NumComps + 6;
+    if ( GetSettingsPtr()->m_SymSplittingOnFlag )
     {
-        int tri_comp_id = m_SurfVec[s]->GetCompID();
-        list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
-        for ( t = triList.begin() ; t != triList.end(); ++t ) // every triangle
-        {
-            vector< vector< double > > t_vec_vec;
+        num_comp_slot = m_NumComps + 10;  // + 10 to handle possibility of outer domain and symmetry plane.
+    }
 
-            if ( GetSettingsPtr()->m_SymSplittingOnFlag )
-            {
-                t_vec_vec.resize( m_NumComps + 10 );  // + 10 to handle possibility of outer domain and symmetry plane.
-                ( *t )->insideSurf.resize(m_NumComps + 10);
-                ( *t )->insideCount.resize(m_NumComps + 10);
-            }
-            else
+    //==== Surfaces Rays Are Checked Against ====//
+    // Transparent, structure, and stiffener surfs are skipped, unless trimming
+    // the sym plane by the outer domain.
+    vector< bool > solid_mask( m_SurfVec.size(), false );
+    vector< bool > sym_mask( m_SurfVec.size(), false );
+    for ( s = 0 ; s < ( int )m_SurfVec.size() ; ++s )
+    {
+        int type = m_SurfVec[s]->GetSurfaceCfdType();
+        solid_mask[s] = ( type != vsp::CFD_TRANSPARENT && type != vsp::CFD_STRUCTURE && type != vsp::CFD_STIFFENER );
+        sym_mask[s] = solid_mask[s] || ( m_SurfVec[s]->GetFarFlag() && GetSettingsPtr()->m_FarCompFlag );
+    }
+
+    //==== Build Patch Tree for Each Component ====//
+    vector< SurfPatchTree > comp_tree_vec( num_comp_slot );
+    for ( s = 0 ; s < ( int )m_SurfVec.size() ; ++s )
+    {
+        int c = m_SurfVec[s]->GetCompID();
+        if ( sym_mask[s] && c >= 0 && c < num_comp_slot )
+        {
+            vector< SurfPatch* > & patch_vec = m_SurfVec[s]->GetPatchVec();
+            for ( int p = 0 ; p < ( int )patch_vec.size() ; p++ )
             {
-                t_vec_vec.resize( m_NumComps + 6 );
-                ( *t )->insideSurf.resize(m_NumComps + 6);
-                ( *t )->insideCount.resize(m_NumComps + 6);
+                comp_tree_vec[c].AddPatch( patch_vec[p], s );
             }
+        }
+    }
 
-            vec3d cp = ( *t )->ComputeCenterPnt( m_SurfVec[s] );
+    #pragma omp parallel for schedule( dynamic )
+    for ( int c = 0 ; c < num_comp_slot ; c++ )
+    {
+        comp_tree_vec[c].Build();
+    }
+
+    //==== Gather Tris of Every Surface ====//
+    vector< Tri* > all_tri_vec;
+    vector< int > all_surf_vec;
+    for ( s = 0 ; s < ( int )m_SurfVec.size() ; ++s )
+    {
+        vector< Tri* > tri_vec;
+        m_SurfVec[s]->GetMesh()->LoadTriVec( tri_vec );
+        all_tri_vec.insert( all_tri_vec.end(), tri_vec.begin(), tri_vec.end() );
+        all_surf_vec.resize( all_tri_vec.size(), s );
+    }
+    int num_tri = ( int )all_tri_vec.size();
+
+    //==== Count Number of Component Crossings for Each Tri =====//
+    #pragma omp parallel
+    {
+        vector< vector< double > > t_vec_vec( num_comp_slot );    // Per thread scratch
+
+        #pragma omp for schedule( dynamic )
+        for ( int j = 0 ; j < num_tri ; j++ )
+        {
+            Tri* t = all_tri_vec[j];
+            int ts = all_surf_vec[j];
+            int tri_comp_id = m_SurfVec[ts]->GetCompID();
+            bool sym_flag = m_SurfVec[ts]->GetSymPlaneFlag();
+
+            t->insideSurf.resize( num_comp_slot );
+            t->insideCount.resize( num_comp_slot );
+
+            vec3d cp = t->ComputeCenterPnt( m_SurfVec[ts] );
             vec3d ep = cp + vec3d( x_dist, 1.0e-4, 1.0e-4 );
 
-            for ( int i = 0 ; i < ( int )m_SurfVec.size() ; ++i )
+            for ( int c = 0 ; c < num_comp_slot ; c++ )
             {
-                int comp_id = m_SurfVec[i]->GetCompID();
-                if ( i != s && comp_id != tri_comp_id ) // Don't check self intersection.
+                t_vec_vec[c].clear();
+                if ( c != tri_comp_id ) // Don't check self intersection.
                 {
-                    if ( m_SurfVec[i]->GetSurfaceCfdType() != vsp::CFD_TRANSPARENT &&
-                         m_SurfVec[i]->GetSurfaceCfdType() != vsp::CFD_STRUCTURE &&
-                         m_SurfVec[i]->GetSurfaceCfdType() != vsp::CFD_STIFFENER ) // Don't check against transparent, structure, or stiffener surf.
-                    {
-                        m_SurfVec[i]->IntersectLineSeg( cp, ep, t_vec_vec[comp_id] );
-                    }
-                    else if ( m_SurfVec[i]->GetFarFlag() && m_SurfVec[s]->GetSymPlaneFlag() &&
-                              GetSettingsPtr()->m_FarCompFlag ) // Unless trimming sym plane by outer domain
-                    {
-                        m_SurfVec[i]->IntersectLineSeg( cp, ep, t_vec_vec[comp_id] );
-                    }
+                    comp_tree_vec[c].IntersectLineSeg( cp, ep, sym_flag ? sym_mask : solid_mask, t_vec_vec[c] );
                 }
             }
 
@@ -2909,14 +3564,14 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
             {
                 int c = m_SurfVec[i]->GetCompID();
 
-                if ( c >= 0 && c < ( *t )->insideSurf.size() )
+                if ( c >= 0 && c < t->insideSurf.size() )
                 {
-                    if ( m_SurfVec[s]->GetSymPlaneFlag() && m_SurfVec[i]->GetFarFlag() &&
+                    if ( sym_flag && m_SurfVec[i]->GetFarFlag() &&
                          GetSettingsPtr()->m_FarCompFlag )
                     {
                         if ( ( int )( t_vec_vec[c].size() + 1 ) % 2 == 1 ) // +1 Reverse action on sym plane wrt outer boundary.
                         {
-                            ( *t )->insideSurf[c] = true;
+                            t->insideSurf[c] = true;
                         }
                     }
                     else
@@ -2924,37 +3579,42 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
 
                         if ( ( int )t_vec_vec[c].size() % 2 == 1)
                         {
-                            ( *t )->insideSurf[c] = true;
+                            t->insideSurf[c] = true;
                         }
                     }
                 }
             }
         }
+    }
 
-        for ( t = triList.begin() ; t != triList.end(); ++t ) // every triangle
-        {
-            //==== Load Adjoining Tris - NOT Crossing Borders ====//
-            set< Tri* > triSet;
-            ( *t )->LoadAdjTris( 3, triSet );
+    //==== Vote With Adjoining Tris - NOT Crossing Borders ====//
+    // Adjacency within three levels is symmetric, so each tri gathers the votes
+    // of its own neighborhood and only writes its own counts.
+    #pragma omp parallel for schedule( dynamic )
+    for ( int j = 0 ; j < num_tri ; j++ )
+    {
+        Tri* t = all_tri_vec[j];
 
-            set<Tri*>::iterator st;
+        set< Tri* > triSet;
+        t->LoadAdjTris( 3, triSet );
 
-            for ( int i = 0 ; i < ( int )m_SurfVec.size() ; ++i )
+        set<Tri*>::iterator st;
+
+        for ( int i = 0 ; i < ( int )m_SurfVec.size() ; ++i )
+        {
+            int c = m_SurfVec[i]->GetCompID();
+            if ( c >= 0 && c < t->insideCount.size() )
             {
-                int c = m_SurfVec[i]->GetCompID();
-                if ( c >= 0 && c < ( *t )->insideSurf.size() )
-                {
 
-                    for ( st = triSet.begin() ; st != triSet.end() ; ++st )
+                for ( st = triSet.begin() ; st != triSet.end() ; ++st )
+                {
+                    if ( ( *st )->insideSurf[c] )
                     {
-                        if ( ( *t )->insideSurf[c] )
-                        {
-                            ( *st )->insideCount[c]++;
-                        }
-                        else
-                        {
-                            ( *st )->insideCount[c]--;
-                        }
+                        t->insideCount[c]++;
+                    }
+                    else
+                    {
+                        t->insideCount[c]--;
                     }
                 }
             }
@@ -2962,77 +3622,59 @@ void CfdMeshMgrSingleton::RemoveInteriorTris()
     }
 
     //==== Check Vote and Mark Interior Tris =====//
-    for ( s = 0 ; s < ( int )m_SurfVec.size() ; ++s )
+    #pragma omp parallel for
+    for ( int j = 0 ; j < num_tri ; j++ )
     {
-        list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
-        for ( t = triList.begin() ; t != triList.end(); ++t )
+        Tri* t = all_tri_vec[j];
+        for ( int i = 0 ; i < ( int )m_SurfVec.size() ; ++i )
         {
-            for ( int i = 0 ; i < ( int )m_SurfVec.size() ; ++i )
+            int c = m_SurfVec[i]->GetCompID();
+
+            if ( c >= 0 && c < t->insideSurf.size() )
             {
-                int aType = m_SurfVec[s]->GetSurfaceCfdType();
-                int bType = m_SurfVec[i]->GetSurfaceCfdType();
-                int c = m_SurfVec[i]->GetCompID();
 
-                if ( c >= 0 && c < ( *t )->insideSurf.size() )
+                if ( t->insideCount[c] > 0 )
                 {
-
-                    if ( ( *t )->insideCount[c] > 0 )
-                    {
-                        ( *t )->insideSurf[c] = true;
-                    }
-                    else if ( ( *t )->insideCount[c] < 0 )
-                    {
-                        ( *t )->insideSurf[c] = false;
-                    }
-                    else // Can't determine if Tri is inside or outside based on neighbor votes
-                    {
-                        printf( "IntExtCount ZERO!\n" );
-                    }
-
+                    t->insideSurf[c] = true;
+                }
+                else if ( t->insideCount[c] < 0 )
+                {
+                    t->insideSurf[c] = false;
+                }
+                else // Can't determine if Tri is inside or outside based on neighbor votes
+                {
+                    printf( "IntExtCount ZERO!\n" );
                 }
+
             }
         }
     }
 
-    for ( int a = 0 ; a < ( int )m_SurfVec.size() ; a++ )
+    for ( int j = 0 ; j < num_tri ; j++ )
     {
-        int tri_comp_id = m_SurfVec[a]->GetCompID();
-        list< Tri * > triList = m_SurfVec[a]->GetMesh()->GetTriList();
-        for ( t = triList.begin(); t != triList.end(); ++t )
-        {
-            // Determine if the triangle should be deleted
-            ( *t )->deleteFlag = SetDeleteTriFlag( m_SurfVec[a]->GetSurfaceCfdType(), m_SurfVec[a]->GetSymPlaneFlag(), ( *t )->insideSurf );
-        }
+        // Determine if the triangle should be deleted
+        Surf* surf = m_SurfVec[ all_surf_vec[j] ];
+        all_tri_vec[j]->deleteFlag = SetDeleteTriFlag( surf->GetSurfaceCfdType(), surf->GetSymPlaneFlag(), all_tri_vec[j]->insideSurf );
     }
 
     //==== Check For Half Mesh ====//
     if ( GetSettingsPtr()->m_HalfMeshFlag )
     {
-        for ( s = 0 ; s < ( int )m_SurfVec.size() ; s++ )
+        #pragma omp parallel for schedule( dynamic )
+        for ( int j = 0 ; j < num_tri ; j++ )
         {
-            if ( ! m_SurfVec[s]->GetSymPlaneFlag() )
+            Surf* surf = m_SurfVec[ all_surf_vec[j] ];
+            if ( ! surf->GetSymPlaneFlag() )
             {
-                list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
-                for ( t = triList.begin() ; t != triList.end(); ++t )
+                vec3d cp = all_tri_vec[j]->ComputeCenterPnt( surf );
+                if ( cp[1] < -1.0e-10 )
                 {
-                    vec3d cp = ( *t )->ComputeCenterPnt( m_SurfVec[s] );
-                    if ( cp[1] < -1.0e-10 )
-                    {
-                        ( *t )->deleteFlag = true;
-                    }
+                    all_tri_vec[j]->deleteFlag = true;
                 }
             }
-
-            if( !GetSettingsPtr()->m_FarMeshFlag ) // Don't keep symmetry plane.
+            else if( !GetSettingsPtr()->m_FarMeshFlag ) // Don't keep symmetry plane.
             {
-                if ( m_SurfVec[s]->GetSymPlaneFlag() )
-                {
-                    list <Tri*> triList = m_SurfVec[s]->GetMesh()->GetTriList();
-                    for ( t = triList.begin() ; t != triList.end(); ++t )
-                    {
-                        ( *t )->deleteFlag = true;
-                    }
-                }
+                all_tri_vec[j]->deleteFlag = true;
             }
         }
     }
@@ -3880,7 +4522,7 @@ void CfdMeshMgr::Draw_BBox( bbox box )
 
 void CfdMeshMgrSingleton::SubTagTris()
 {
-    SubSurfaceMgr.ClearTagMaps();
+    vector< string > comp_name_vec;
     map< string, int > tag_map;
     map< string, set<int> > geom_comp_map;
     map< int, int >  comp_num_map; // map from an unmerged component number to the surface number of geom
@@ -3936,15 +4578,21 @@ void CfdMeshMgrSingleton::SubTagTris()
                                                  + "_Wake";
             }
 
-            SubSurfaceMgr.m_CompNames.push_back(name);
+            comp_name_vec.push_back( name );
         }
 
         surf->SetBaseTag( tag_map[id] );
 
     }
 
-    SetSimpSubSurfTags( tag_number );
-    SubSurfaceMgr.BuildCompNameMap();
+    //==== Tag Maps Are Shared by Every Mesh Manager Instance ====//
+    #pragma omp critical ( SubSurfaceMgrTags )
+    {
+        SubSurfaceMgr.ClearTagMaps();
+        SubSurfaceMgr.m_CompNames = comp_name_vec;
+        SetSimpSubSurfTags( tag_number );
+        SubSurfaceMgr.BuildCompNameMap();
+    }
 }
 
 void CfdMeshMgrSingleton::SetSimpSubSurfTags( int tag_offset )
@@ -3964,6 +4612,7 @@ void CfdMeshMgrSingleton::Subtag( Surf* surf )
     vector< SimpTri >& tri_vec = surf->GetMesh()->GetSimpTriVec();
     const vector< vec2d >& pnts = surf->GetMesh()->GetSimpUWPntVec();
     vector< SimpleSubSurface > simp_s_surfs = GetSimpSubSurfs( surf->GetGeomID(), surf->GetMainSurfID() , surf->GetCompID() );
+    set< vector< int > > tag_combos;
 
     for ( int t = 0; t < (int)tri_vec.size(); t++ )
     {
@@ -3979,7 +4628,12 @@ void CfdMeshMgrSingleton::Subtag( Surf* surf )
                 tri.m_Tags.push_back( simp_s_surfs[s].m_Tag );
             }
         }
-        SubSurfaceMgr.m_TagCombos.insert( tri.m_Tags );
+        tag_combos.insert( tri.m_Tags );
+    }
+
+    #pragma omp critical ( SubSurfaceMgrTags )
+    {
+        SubSurfaceMgr.m_TagCombos.insert( tag_combos.begin(), tag_combos.end() );
     }
 }
 
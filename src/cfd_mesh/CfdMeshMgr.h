@@ -46,6 +46,7 @@
 //              Remove intierior triangles.
 //
 //      CfdMeshMgr::Remesh: Remesh (split, collapse, swap, smooth) each surface mesh triangle.
+//      CfdMeshMgr::RemeshSurf: Remesh one surface (safe to run on several surfaces at once).
 //
 
 
@@ -119,7 +120,7 @@ public:
     void CreateWakesAppendBorderCurves( vector< ICurve* > & border_curves );
     vector< Surf* > GetWakeSurfs();
     void AppendWakeSurfs( vector< Surf* > & surf_vec );
-    void StretchWakes();
+    void StretchWake( Mesh* msh );
 
     //void Draw();
     void LoadDrawObjs( vector< DrawObj* > & draw_obj_vec );
@@ -146,6 +147,7 @@ public:
         m_StartStretchX = x;
     }
     vec3d ComputeTrailEdgePnt( vec3d le_pnt );
+    void ComputeTrailEdgePnts( const vector< vec3d > & le_vec, vector< vec3d > & te_vec );
 
 protected:
 
@@ -181,6 +183,8 @@ public:
     ~CfdMeshMgrSingleton() override;
     void CleanUp() override;
 
+    size_t MemoryUsage() const override;
+
     SimpleMeshCommonSettings* GetSettingsPtr() override
     {
         return (SimpleMeshCommonSettings* ) &m_CfdSettings;
@@ -251,7 +255,10 @@ public:
                                map< int, vector< int > >& indMap );
 
     virtual string CheckWaterTight();
-    virtual Edge* FindAddEdge( map< int, vector<Edge*> > & edgeMap, vector< Node* > & nodeVec, int ind1, int ind2 );
+
+    virtual void LoadStoredMeshes();
+    virtual void LoadSurfSTLTris( int isurf, vector< vec3d > & pnt_vec );
+    virtual void WriteStoredSTL( const string &filename );
 
     virtual void BuildDomain();
     void BuildGrid() override;
@@ -259,6 +266,7 @@ public:
     enum { QUIET_OUTPUT, VOCAL_OUTPUT, };
     virtual void Remesh( int output_type );
     virtual void RemeshSingleComp( int comp_id, int output_type );
+    virtual int RemeshSurf( int isurf, bool remove_rev_tris, vector< string > & msg_vec );
 
     virtual void InitMesh();
 
@@ -320,6 +328,9 @@ protected:
     vector<Tri*> m_BadTris;
     vector< Node* > m_nodeStore;
 
+    //==== Finished Surface Meshes in Out-of-Core Mode, Indexed Like m_SurfVec ====//
+    SimpMeshStore m_SimpMeshStore;
+
 private:
     DrawObj m_MeshBadEdgeDO;
     DrawObj m_MeshBadTriDO;
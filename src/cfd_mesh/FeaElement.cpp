@@ -10,7 +10,7 @@
 
 #include "FeaElement.h"
 #include "StructureMgr.h"
-#include "FeaMeshMgr.h"
+#include "FileUtil.h"
 
 string GetFeaFormat( double input )
 {
@@ -81,63 +81,46 @@ int FeaNode::GetIndex()
     return m_Index;
 }
 
-void FeaNode::WriteNASTRAN( FILE* fp )
+//==== Small Field Format Keeping Coordinates To 8 Characters ====//
+static const char* GetGridFormat( double input )
 {
-    fprintf( fp, "GRID,%8d,        ,", m_Index );
-
-    double x = m_Pnt.x();
-    double y = m_Pnt.y();
-    double z = m_Pnt.z();
-
-    if ( fabs( x ) < 10.0 )
-    {
-        fprintf( fp, "%8.5f,", x );
-    }
-    else if ( fabs( x ) < 100.0 )
-    {
-        fprintf( fp, "%8.4f,", x );
-    }
-    else
-    {
-        fprintf( fp, "%8.3f,", x );
-    }
-
-    if ( fabs( y ) < 10.0 )
-    {
-        fprintf( fp, "%8.5f,", y );
-    }
-    else if ( fabs( y ) < 100.0 )
+    if ( fabs( input ) < 10.0 )
     {
-        fprintf( fp, "%8.4f,", y );
+        return "%8.5f";
     }
-    else
+    else if ( fabs( input ) < 100.0 )
     {
-        fprintf( fp, "%8.3f,", y );
+        return "%8.4f";
     }
+    return "%8.3f";
+}
 
-    if ( fabs( z ) < 10.0 )
-    {
-        fprintf( fp, "%8.5f\n", z );
-    }
-    else if ( fabs( z ) < 100.0 )
-    {
-        fprintf( fp, "%8.4f\n", z );
-    }
-    else
+void FeaNode::WriteNASTRAN( string & buf, bool large_field )
+{
+    if ( large_field )
     {
-        fprintf( fp, "%8.3f\n", z );
+        // GRID* with 16 character fields, Z on the continuation line
+        AppendFormat( buf, "GRID*,%16d,                ,%16.9e,%16.9e\n*,%16.9e\n", m_Index, m_Pnt.x(), m_Pnt.y(), m_Pnt.z() );
+        return;
     }
 
+    AppendFormat( buf, "GRID,%8d,        ,", m_Index );
+    AppendFormat( buf, GetGridFormat( m_Pnt.x() ), m_Pnt.x() );
+    buf += ',';
+    AppendFormat( buf, GetGridFormat( m_Pnt.y() ), m_Pnt.y() );
+    buf += ',';
+    AppendFormat( buf, GetGridFormat( m_Pnt.z() ), m_Pnt.z() );
+    buf += '\n';
 }
 
-void FeaNode::WriteCalculix( FILE* fp )
+void FeaNode::WriteCalculix( string & buf )
 {
-    fprintf( fp, "%d,%f,%f,%f\n", m_Index, m_Pnt.x(), m_Pnt.y(), m_Pnt.z() );
+    AppendFormat( buf, "%d,%f,%f,%f\n", m_Index, m_Pnt.x(), m_Pnt.y(), m_Pnt.z() );
 }
 
-void FeaNode::WriteGmsh( FILE* fp )
+void FeaNode::WriteGmsh( string & buf )
 {
-    fprintf( fp, "%d %f %f %f\n", m_Index, m_Pnt.x(), m_Pnt.y(), m_Pnt.z() );
+    AppendFormat( buf, "%d %f %f %f\n", m_Index, m_Pnt.x(), m_Pnt.y(), m_Pnt.z() );
 }
 
 //////////////////////////////////////////////////////
@@ -202,14 +185,14 @@ void FeaTri::Create( vec3d & p0, vec3d & p1, vec3d & p2, vec3d & orientation )
     m_Orientation = orientation;
 }
 
-void FeaTri::WriteCalculix( FILE* fp, int id )
+void FeaTri::WriteCalculix( string & buf, int id )
 {
-    fprintf( fp, "%d,%d,%d,%d,%d,%d,%d\n", id,
-             m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(),
-             m_Mids[0]->GetIndex(), m_Mids[1]->GetIndex(), m_Mids[2]->GetIndex() );
+    AppendFormat( buf, "%d,%d,%d,%d,%d,%d,%d\n", id,
+                  m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(),
+                  m_Mids[0]->GetIndex(), m_Mids[1]->GetIndex(), m_Mids[2]->GetIndex() );
 }
 
-void FeaTri::WriteNASTRAN( FILE* fp, int id, int property_index )
+void FeaTri::WriteNASTRAN( string & buf, int id, int property_index )
 {
     vec3d x_element = m_Corners[1]->m_Pnt - m_Corners[0]->m_Pnt;
     x_element.normalize();
@@ -219,20 +202,20 @@ void FeaTri::WriteNASTRAN( FILE* fp, int id, int property_index )
 
     string format_string = "CTRIA6,%8d,%8d,%8d,%8d,%8d,%8d,%8d,%8d,\n      ," + GetFeaFormat( theta_material ) + "\n";
 
-    fprintf( fp, format_string.c_str(), id, property_index + 1,
-             m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(),
-             m_Mids[0]->GetIndex(), m_Mids[1]->GetIndex(), m_Mids[2]->GetIndex(), theta_material );
+    AppendFormat( buf, format_string.c_str(), id, property_index + 1,
+                  m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(),
+                  m_Mids[0]->GetIndex(), m_Mids[1]->GetIndex(), m_Mids[2]->GetIndex(), theta_material );
 }
 
-void FeaTri::WriteGmsh( FILE* fp, int id, int fea_part_index )
+void FeaTri::WriteGmsh( string & buf, int id, int fea_part_index )
 {
     // 6-node second order triangle element type (9)
-    fprintf( fp, "%d 9 1 %d %d %d %d %d %d %d\n", id, fea_part_index,
-             m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(),
-             m_Mids[0]->GetIndex(),m_Mids[1]->GetIndex(), m_Mids[2]->GetIndex() );
+    AppendFormat( buf, "%d 9 1 %d %d %d %d %d %d %d\n", id, fea_part_index,
+                  m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(),
+                  m_Mids[0]->GetIndex(),m_Mids[1]->GetIndex(), m_Mids[2]->GetIndex() );
 }
 
-double FeaTri::ComputeMass( int property_index )
+double FeaTri::ComputeMass( int property_index, const vector < SimpleFeaProperty > & prop_vec, const vector < SimpleFeaMaterial > & mat_vec )
 {
     double mass = 0.0;
     if ( m_Corners.size() < 3 )
@@ -245,21 +228,17 @@ double FeaTri::ComputeMass( int property_index )
     double avg_t = 0;
     int mat_index = -1;
 
-    vector < SimpleFeaProperty > simp_prop_vec = FeaMeshMgr.GetSimplePropertyVec();
-
-    if ( property_index < simp_prop_vec.size() && property_index >= 0 && simp_prop_vec.size() > 0 )
+    if ( property_index < prop_vec.size() && property_index >= 0 && prop_vec.size() > 0 )
     {
-        avg_t = simp_prop_vec[property_index].m_Thickness;
-        mat_index = simp_prop_vec[property_index].GetSimpFeaMatIndex();
+        avg_t = prop_vec[property_index].m_Thickness;
+        mat_index = prop_vec[property_index].GetSimpFeaMatIndex();
     }
 
     double avg_d = 0;
 
-    vector < SimpleFeaMaterial > simp_mat_vec = FeaMeshMgr.GetSimpleMaterialVec();
-
-    if ( mat_index < simp_mat_vec.size() && mat_index >= 0 && simp_mat_vec.size() > 0 )
+    if ( mat_index < mat_vec.size() && mat_index >= 0 && mat_vec.size() > 0 )
     {
-        avg_d = simp_mat_vec[mat_index].m_MassDensity;
+        avg_d = mat_vec[mat_index].m_MassDensity;
     }
 
     mass = a * avg_t * avg_d;
@@ -290,28 +269,28 @@ void FeaQuad::Create( vec3d & p0, vec3d & p1, vec3d & p2, vec3d & p3 )
     m_Mids.push_back( new FeaNode( p30 ) );
 }
 
-void FeaQuad::WriteCalculix( FILE* fp, int id )
+void FeaQuad::WriteCalculix( string & buf, int id )
 {
-    fprintf( fp, "%d,%d,%d,%d,%d,%d,%d,%d,%d\n", id,
-             m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(), m_Corners[3]->GetIndex(),
-             m_Mids[0]->GetIndex(), m_Mids[1]->GetIndex(), m_Mids[2]->GetIndex(), m_Mids[3]->GetIndex() );
+    AppendFormat( buf, "%d,%d,%d,%d,%d,%d,%d,%d,%d\n", id,
+                  m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(), m_Corners[3]->GetIndex(),
+                  m_Mids[0]->GetIndex(), m_Mids[1]->GetIndex(), m_Mids[2]->GetIndex(), m_Mids[3]->GetIndex() );
 }
-void FeaQuad::WriteNASTRAN( FILE* fp, int id, int property_index )
+void FeaQuad::WriteNASTRAN( string & buf, int id, int property_index )
 {
-    fprintf( fp, "CQUAD8,%8d,%8d,%8d,%8d,%8d,%8d,%8d,%8d,+\n+,%8d,%8d\n", id, property_index + 1,
-             m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(), m_Corners[3]->GetIndex(),
-             m_Mids[0]->GetIndex(), m_Mids[1]->GetIndex(), m_Mids[2]->GetIndex(), m_Mids[3]->GetIndex() );
+    AppendFormat( buf, "CQUAD8,%8d,%8d,%8d,%8d,%8d,%8d,%8d,%8d,+\n+,%8d,%8d\n", id, property_index + 1,
+                  m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(), m_Corners[3]->GetIndex(),
+                  m_Mids[0]->GetIndex(), m_Mids[1]->GetIndex(), m_Mids[2]->GetIndex(), m_Mids[3]->GetIndex() );
 }
 
-void FeaQuad::WriteGmsh( FILE* fp, int id, int fea_part_index )
+void FeaQuad::WriteGmsh( string & buf, int id, int fea_part_index )
 {
     // 8-node second order quadrangle element type (16)
-    fprintf( fp, "%d 16 1 %d %d %d %d %d %d %d %d %d\n", id, fea_part_index,
-             m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(), m_Corners[3]->GetIndex(),
-             m_Mids[0]->GetIndex(), m_Mids[1]->GetIndex(), m_Mids[2]->GetIndex(), m_Mids[3]->GetIndex() );
+    AppendFormat( buf, "%d 16 1 %d %d %d %d %d %d %d %d %d\n", id, fea_part_index,
+                  m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex(), m_Corners[2]->GetIndex(), m_Corners[3]->GetIndex(),
+                  m_Mids[0]->GetIndex(), m_Mids[1]->GetIndex(), m_Mids[2]->GetIndex(), m_Mids[3]->GetIndex() );
 }
 
-double FeaQuad::ComputeMass( int property_index )
+double FeaQuad::ComputeMass( int property_index, const vector < SimpleFeaProperty > & prop_vec, const vector < SimpleFeaMaterial > & mat_vec )
 {
     double mass = 0.0;
     if ( m_Corners.size() < 4 )
@@ -326,21 +305,17 @@ double FeaQuad::ComputeMass( int property_index )
     double avg_t = 0;
     int mat_index = -1;
 
-    vector < SimpleFeaProperty > simp_prop_vec = FeaMeshMgr.GetSimplePropertyVec();
-
-    if ( property_index < simp_prop_vec.size() && property_index >= 0 && simp_prop_vec.size() > 0 )
+    if ( property_index < prop_vec.size() && property_index >= 0 && prop_vec.size() > 0 )
     {
-        avg_t = simp_prop_vec[property_index].m_Thickness;
-        mat_index = simp_prop_vec[property_index].GetSimpFeaMatIndex();
+        avg_t = prop_vec[property_index].m_Thickness;
+        mat_index = prop_vec[property_index].GetSimpFeaMatIndex();
     }
 
     double avg_d = 0;
 
-    vector < SimpleFeaMaterial > simp_mat_vec = FeaMeshMgr.GetSimpleMaterialVec();
-
-    if ( mat_index < simp_mat_vec.size() && mat_index >= 0 && simp_mat_vec.size() > 0 )
+    if ( mat_index < mat_vec.size() && mat_index >= 0 && mat_vec.size() > 0 )
     {
-        avg_d = simp_mat_vec[mat_index].m_MassDensity;
+        avg_d = mat_vec[mat_index].m_MassDensity;
     }
 
     mass = a * avg_t * avg_d;
@@ -366,37 +341,37 @@ void FeaBeam::Create( vec3d & p0, vec3d & p1, vec3d & norm )
     m_DispVec = norm;
 }
 
-void FeaBeam::WriteCalculix( FILE* fp, int id )
+void FeaBeam::WriteCalculix( string & buf, int id )
 {
-    fprintf( fp, "%d,%d,%d,%d\n", id,
-             m_Corners[0]->GetIndex(), m_Mids[0]->GetIndex(), m_Corners[1]->GetIndex() );
+    AppendFormat( buf, "%d,%d,%d,%d\n", id,
+                  m_Corners[0]->GetIndex(), m_Mids[0]->GetIndex(), m_Corners[1]->GetIndex() );
 
     m_ElementIndex = id; // Save element index 
 }
 
-void FeaBeam::WriteCalculixNormal( FILE* fp )
+void FeaBeam::WriteCalculixNormal( string & buf )
 {
     string format_string = "%8d,%8d," + GetFeaFormat( m_DispVec.x() ) + "," + GetFeaFormat( m_DispVec.y() ) + "," + GetFeaFormat( m_DispVec.z() ) + "\n";
-    fprintf( fp, format_string.c_str(), m_ElementIndex, m_Corners[0]->GetIndex(), m_DispVec.x(), m_DispVec.y(), m_DispVec.z() );
+    AppendFormat( buf, format_string.c_str(), m_ElementIndex, m_Corners[0]->GetIndex(), m_DispVec.x(), m_DispVec.y(), m_DispVec.z() );
 }
 
-void FeaBeam::WriteNASTRAN( FILE* fp, int id, int property_index )
+void FeaBeam::WriteNASTRAN( string & buf, int id, int property_index )
 {
     string format_string = "CBAR,%8d,%8d,%8d,%8d," + GetFeaFormat( m_DispVec.x() ) + "," +
         GetFeaFormat( m_DispVec.y() ) + "," + GetFeaFormat( m_DispVec.z() ) + "\n";
 
-    fprintf( fp, format_string.c_str(), id, property_index + 1, m_Corners[0]->GetIndex(), 
-             m_Corners[1]->GetIndex(), m_DispVec.x(), m_DispVec.y(), m_DispVec.z() );
+    AppendFormat( buf, format_string.c_str(), id, property_index + 1, m_Corners[0]->GetIndex(),
+                  m_Corners[1]->GetIndex(), m_DispVec.x(), m_DispVec.y(), m_DispVec.z() );
 }
 
-void FeaBeam::WriteGmsh( FILE* fp, int id, int fea_part_index )
+void FeaBeam::WriteGmsh( string & buf, int id, int fea_part_index )
 {
     // 2 node line line (1)
-    fprintf( fp, "%d 1 1 %d %d %d\n", id, fea_part_index,
-             m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex() );
+    AppendFormat( buf, "%d 1 1 %d %d %d\n", id, fea_part_index,
+                  m_Corners[0]->GetIndex(), m_Corners[1]->GetIndex() );
 }
 
-double FeaBeam::ComputeMass( int property_index )
+double FeaBeam::ComputeMass( int property_index, const vector < SimpleFeaProperty > & prop_vec, const vector < SimpleFeaMaterial > & mat_vec )
 {
     double mass = 0.0;
 
@@ -410,21 +385,17 @@ double FeaBeam::ComputeMass( int property_index )
     double area = 0;
     int mat_index = -1;
 
-    vector < SimpleFeaProperty > simp_prop_vec = FeaMeshMgr.GetSimplePropertyVec();
-
-    if ( property_index < simp_prop_vec.size() && property_index >= 0 && simp_prop_vec.size() > 0 )
+    if ( property_index < prop_vec.size() && property_index >= 0 && prop_vec.size() > 0 )
     {
-        area = simp_prop_vec[property_index].m_CrossSecArea;
-        mat_index = simp_prop_vec[property_index].GetSimpFeaMatIndex();
+        area = prop_vec[property_index].m_CrossSecArea;
+        mat_index = prop_vec[property_index].GetSimpFeaMatIndex();
     }
 
     double avg_d = 0;
 
-    vector < SimpleFeaMaterial > simp_mat_vec = FeaMeshMgr.GetSimpleMaterialVec();
-
-    if ( mat_index < simp_mat_vec.size() && mat_index >= 0 && simp_mat_vec.size() > 0 )
+    if ( mat_index < mat_vec.size() && mat_index >= 0 && mat_vec.size() > 0 )
     {
-        avg_d = simp_mat_vec[mat_index].m_MassDensity;
+        avg_d = mat_vec[mat_index].m_MassDensity;
     }
 
     mass = length * area * avg_d;
@@ -447,17 +418,17 @@ void FeaPointMass::Create( vec3d & p0, double mass )
     m_Mass = mass;
 }
 
-void FeaPointMass::WriteCalculix( FILE* fp, int id )
+void FeaPointMass::WriteCalculix( string & buf, int id )
 {
-    fprintf( fp, "%d,%d\n", id, m_Corners[0]->GetIndex() );
+    AppendFormat( buf, "%d,%d\n", id, m_Corners[0]->GetIndex() );
 }
 
-void FeaPointMass::WriteNASTRAN( FILE* fp, int id, int property_index )
+void FeaPointMass::WriteNASTRAN( string & buf, int id, int property_index )
 {
     // Note: property_index ignored
     string format_string = "CONM2,%8d,%8d,        ," + GetFeaFormat( m_Mass ) + "\n";
 
-    fprintf( fp, format_string.c_str(), id, m_Corners[0]->GetIndex(), m_Mass );
+    AppendFormat( buf, format_string.c_str(), id, m_Corners[0]->GetIndex(), m_Mass );
 }
 
 //////////////////////////////////////////////////////
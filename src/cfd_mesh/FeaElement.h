@@ -22,6 +22,9 @@ using namespace std;
 
 string GetFeaFormat( double input );
 
+class SimpleFeaProperty;
+class SimpleFeaMaterial;
+
 class FeaNodeTag
 {
 public:
@@ -57,9 +60,10 @@ public:
     bool HasOnlyIndex( int ind );
     vector< FeaNodeTag > m_Tags;
 
-    void WriteNASTRAN( FILE* fp );
-    void WriteCalculix( FILE* fp );
-    void WriteGmsh( FILE* fp );
+    // Node and element cards are appended to a buffer so they can be formatted in parallel
+    void WriteNASTRAN( string & buf, bool large_field = false );
+    void WriteCalculix( string & buf );
+    void WriteGmsh( string & buf );
 };
 
 class FeaElement
@@ -83,10 +87,10 @@ public:
     {
         m_FeaPartIndex = fea_part_index;
     }
-    virtual void WriteCalculix( FILE* fp, int id ) = 0;
-    virtual void WriteNASTRAN( FILE* fp, int id, int property_index ) = 0;
-    virtual void WriteGmsh( FILE* fp, int id , int fea_part_index ) = 0;
-    virtual double ComputeMass( int property_index ) = 0;
+    virtual void WriteCalculix( string & buf, int id ) = 0;
+    virtual void WriteNASTRAN( string & buf, int id, int property_index ) = 0;
+    virtual void WriteGmsh( string & buf, int id, int fea_part_index ) = 0;
+    virtual double ComputeMass( int property_index, const vector < SimpleFeaProperty > & prop_vec, const vector < SimpleFeaMaterial > & mat_vec ) = 0;
 
     virtual int GetFeaSSIndex()
     {
@@ -119,10 +123,10 @@ public:
     virtual ~FeaTri()    {};
 
     virtual void Create( vec3d & p0, vec3d & p1, vec3d & p2, vec3d & orientation );
-    virtual void WriteCalculix( FILE* fp, int id );
-    virtual void WriteNASTRAN( FILE* fp, int id, int property_index );
-    virtual void WriteGmsh( FILE* fp, int id, int fea_part_index );
-    virtual double ComputeMass( int property_index );
+    virtual void WriteCalculix( string & buf, int id );
+    virtual void WriteNASTRAN( string & buf, int id, int property_index );
+    virtual void WriteGmsh( string & buf, int id, int fea_part_index );
+    virtual double ComputeMass( int property_index, const vector < SimpleFeaProperty > & prop_vec, const vector < SimpleFeaMaterial > & mat_vec );
 
     vec3d m_Orientation;
 };
@@ -135,10 +139,10 @@ public:
     virtual ~FeaQuad()    {};
 
     virtual void Create( vec3d & p0, vec3d & p1, vec3d & p2, vec3d & p3 );
-    virtual void WriteCalculix( FILE* fp, int id );
-    virtual void WriteNASTRAN( FILE* fp, int id, int property_index );
-    virtual void WriteGmsh( FILE* fp, int id, int fea_part_index );
-    virtual double ComputeMass( int property_index );
+    virtual void WriteCalculix( string & buf, int id );
+    virtual void WriteNASTRAN( string & buf, int id, int property_index );
+    virtual void WriteGmsh( string & buf, int id, int fea_part_index );
+    virtual double ComputeMass( int property_index, const vector < SimpleFeaProperty > & prop_vec, const vector < SimpleFeaMaterial > & mat_vec );
 };
 
 //=== Beam Element ====//
@@ -149,11 +153,11 @@ public:
     virtual ~FeaBeam()    {};
 
     virtual void Create( vec3d & p0, vec3d & p1 , vec3d & norm );
-    virtual void WriteCalculix( FILE* fp, int id );
-    virtual void WriteCalculixNormal( FILE* fp );
-    virtual void WriteNASTRAN( FILE* fp, int id, int property_index );
-    virtual void WriteGmsh( FILE* fp, int id, int fea_part_index );
-    virtual double ComputeMass( int property_index );
+    virtual void WriteCalculix( string & buf, int id );
+    virtual void WriteCalculixNormal( string & buf );
+    virtual void WriteNASTRAN( string & buf, int id, int property_index );
+    virtual void WriteGmsh( string & buf, int id, int fea_part_index );
+    virtual double ComputeMass( int property_index, const vector < SimpleFeaProperty > & prop_vec, const vector < SimpleFeaMaterial > & mat_vec );
 
     vec3d m_DispVec; // Vector from end point in the displacement coordinate system at the end point
 
@@ -170,10 +174,10 @@ public:
     virtual ~FeaPointMass()    {};
 
     virtual void Create( vec3d & p0, double mass );
-    virtual void WriteCalculix( FILE* fp, int id );
-    virtual void WriteNASTRAN( FILE* fp, int id, int property_index );
-    virtual void WriteGmsh( FILE* fp, int id, int fea_part_index )    {};
-    virtual double ComputeMass( int property_index )    
+    virtual void WriteCalculix( string & buf, int id );
+    virtual void WriteNASTRAN( string & buf, int id, int property_index );
+    virtual void WriteGmsh( string & buf, int id, int fea_part_index )    {};
+    virtual double ComputeMass( int property_index, const vector < SimpleFeaProperty > & prop_vec, const vector < SimpleFeaMaterial > & mat_vec )
     {
         return m_Mass;
     };
@@ -212,7 +216,7 @@ class SimpleFeaProperty
     void WriteNASTRAN( FILE* fp, int id );
     void WriteCalculix( FILE* fp, const string &ELSET );
 
-    int GetSimpFeaMatIndex()
+    int GetSimpFeaMatIndex() const
     {
         return m_SimpleFeaMatIndex;
     }
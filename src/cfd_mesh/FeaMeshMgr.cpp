@@ -15,6 +15,133 @@
 #include "PntNodeMerge.h"
 #include "main.h"
 #include "StringUtil.h"
+#include "FileUtil.h"
+#include "StlHelper.h"
+
+//==== FeaNode Cards For A Table Of m_FeaNodeVec Indexes ====//
+class FeaNodeFormatter
+{
+public:
+    enum { NASTRAN, NASTRAN_LARGE, CALCULIX, GMSH };
+
+    FeaNodeFormatter( const vector< FeaNode* > & node_vec, const vector< int > & table, int format ) :
+        m_NodeVec( node_vec ), m_Table( table ), m_Format( format )      {}
+
+    void operator()( int i, string & buf ) const
+    {
+        FeaNode* node = m_NodeVec[ m_Table[i] ];
+
+        switch ( m_Format )
+        {
+            case NASTRAN:
+                node->WriteNASTRAN( buf );
+                break;
+
+            case NASTRAN_LARGE:
+                node->WriteNASTRAN( buf, true );
+                break;
+
+            case CALCULIX:
+                node->WriteCalculix( buf );
+                break;
+
+            case GMSH:
+                node->WriteGmsh( buf );
+                break;
+        }
+    }
+
+protected:
+    const vector< FeaNode* > & m_NodeVec;
+    const vector< int > & m_Table;
+    int m_Format;
+};
+
+//==== FeaElement Cards For A Table Of m_FeaElementVec Indexes, Numbered From first_id ====//
+class FeaElementFormatter
+{
+public:
+    enum { NASTRAN, CALCULIX, CALCULIX_NORMAL, GMSH };
+
+    // NASTRAN beams use cap_property_id, all other NASTRAN elements use property_id.
+    // GMSH elements are tagged with property_id as their physical group.
+    FeaElementFormatter( const vector< FeaElement* > & elem_vec, const vector< int > & table, int format, int first_id,
+                         int property_id = -1, int cap_property_id = -1 ) :
+        m_ElemVec( elem_vec ), m_Table( table ), m_Format( format ), m_FirstID( first_id ),
+        m_PropertyID( property_id ), m_CapPropertyID( cap_property_id )      {}
+
+    void operator()( int i, string & buf ) const
+    {
+        FeaElement* elem = m_ElemVec[ m_Table[i] ];
+        int id = m_FirstID + i;
+
+        switch ( m_Format )
+        {
+            case NASTRAN:
+                if ( elem->GetElementType() == FeaElement::FEA_BEAM )
+                {
+                    elem->WriteNASTRAN( buf, id, m_CapPropertyID );
+                }
+                else
+                {
+                    elem->WriteNASTRAN( buf, id, m_PropertyID );
+                }
+                break;
+
+            case CALCULIX:
+                elem->WriteCalculix( buf, id );
+                break;
+
+            case CALCULIX_NORMAL:
+            {
+                FeaBeam* beam = dynamic_cast<FeaBeam*>( elem );
+                assert( beam );
+                beam->WriteCalculixNormal( buf );
+                break;
+            }
+
+            case GMSH:
+                elem->WriteGmsh( buf, id, m_PropertyID );
+                break;
+        }
+    }
+
+protected:
+    const vector< FeaElement* > & m_ElemVec;
+    const vector< int > & m_Table;
+    int m_Format;
+    int m_FirstID;
+    int m_PropertyID;
+    int m_CapPropertyID;
+};
+
+//==== Elements Of A Table With A Given Type (-1 For Any), Skipping FeaSubSurface Elements If part_only ====//
+static void FilterElementTable( const vector< FeaElement* > & elem_vec, const vector< int > & table, int type, bool part_only, vector< int > & filter_table )
+{
+    filter_table.clear();
+
+    for ( size_t i = 0; i < table.size(); i++ )
+    {
+        FeaElement* elem = elem_vec[ table[i] ];
+
+        if ( ( type < 0 || elem->GetElementType() == type ) && ( !part_only || elem->GetFeaSSIndex() < 0 ) )
+        {
+            filter_table.push_back( table[i] );
+        }
+    }
+}
+
+//==== Grid IDs Of A Table Of Nodes ====//
+static void LoadGridIDs( const vector< FeaNode* > & node_vec, const vector< int > & table, vector< int > & grid_id_vec, int & max_grid_id )
+{
+    grid_id_vec.resize( table.size() );
+
+    for ( size_t i = 0; i < table.size(); i++ )
+    {
+        grid_id_vec[i] = node_vec[ table[i] ]->m_Index;
+        max_grid_id = max( max_grid_id, grid_id_vec[i] );
+    }
+}
 
 //=============================================================//
 //=============================================================//
@@ -24,6 +151,7 @@ FeaMeshMgrSingleton::FeaMeshMgrSingleton() : CfdMeshMgrSingleton()
     m_TotalMass = 0.0;
     m_FeaMeshInProgress = false;
     m_CADOnlyFlag = false;
+    m_ConcurrentFlag = false;
     m_NumFeaParts = 0;
     m_NumFeaSubSurfs = 0;
     m_FeaMeshStructIndex = -1;
@@ -32,6 +160,7 @@ FeaMeshMgrSingleton::FeaMeshMgrSingleton() : CfdMeshMgrSingleton()
     m_NumTris = 0;
     m_NumBeams = 0;
     m_MessageName = "FEAMessage";
+    m_StageResultsName = "FEA_Mesh_Timing";
 }
 
 FeaMeshMgrSingleton::~FeaMeshMgrSingleton()
@@ -59,6 +188,14 @@ void FeaMeshMgrSingleton::CleanUp()
     m_IndMap.clear();
     m_PntShift.clear();
 
+    m_PartNodeTable.clear();
+    m_SSNodeTable.clear();
+    m_IntersectNodeTable.clear();
+    m_RemainingNodeTable.clear();
+    m_UniqueNodeTable.clear();
+    m_PartElementTable.clear();
+    m_SSElementTable.clear();
+
     m_TotalMass = 0.0;
     m_NumFeaParts = 0;
     m_NumFeaSubSurfs = 0;
@@ -277,26 +414,31 @@ void FeaMeshMgrSingleton::GenerateFeaMesh()
 {
     m_FeaMeshInProgress = true;
 
+    // GenerateFeaMeshes resets the flag once for all of its managers
+    if ( !m_ConcurrentFlag )
+    {
+        SetCancelFlag( false );
+    }
+    ClearMeshStages();
+
     TransferMeshSettings();
 
-    if ( ( !GetStructSettingsPtr()->GetExportFileFlag( vsp::FEA_CALCULIX_FILE_NAME ) && !GetStructSettingsPtr()->GetExportFileFlag( vsp::FEA_GMSH_FILE_NAME ) &&
-           !GetStructSettingsPtr()->GetExportFileFlag( vsp::FEA_NASTRAN_FILE_NAME ) && !GetStructSettingsPtr()->GetExportFileFlag( vsp::FEA_MASS_FILE_NAME ) &&
-           !GetStructSettingsPtr()->GetExportFileFlag( vsp::FEA_STL_FILE_NAME ) ) )
+    if ( !HasMeshExport() )
     {
         m_CADOnlyFlag = true;
     }
 
-    addOutputText( "Load Surfaces\n" );
+    StartMeshStage( "Load Surfaces" );
     LoadSurfaces();
 
     if ( m_SurfVec.size() == 0 )
     {
         addOutputText( "No Surfaces.  Done.\n" );
-        m_FeaMeshInProgress = false;
+        EndMeshRun();
         return;
     }
 
-    if ( !m_CADOnlyFlag )
+    if ( !m_CADOnlyFlag && !m_ConcurrentFlag )
     {
         // Hide all geoms after loading surfaces and settings
         m_Vehicle->HideAll();
@@ -309,7 +451,7 @@ void FeaMeshMgrSingleton::GenerateFeaMesh()
 
     MergeCoplanarParts();
 
-    addOutputText( "Add Structure Parts\n" );
+    StartMeshStage( "Add Structure Parts" );
     AddStructureParts();
 
     IdentifyCompIDNames();
@@ -318,71 +460,283 @@ void FeaMeshMgrSingleton::GenerateFeaMesh()
 
     // TODO: Update and Build Domain for Half Mesh?
 
-    addOutputText( "Build Slice Planes\n" );
+    if ( !StartMeshStage( "Build Slice Planes" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     BuildGrid();
 
-    addOutputText( "Intersect\n" );
+    if ( !StartMeshStage( "Intersect" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     Intersect();
     addOutputText( "Finished Intersect\n" );
 
-    addOutputText( "Binary Adaptation Curve Approximation\n" );
+    if ( !StartMeshStage( "Binary Adaptation Curve Approximation" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     BinaryAdaptIntCurves();
 
     if ( m_CADOnlyFlag )
     {
         // No need to generate mesh
-        addOutputText( "Exporting Files\n" );
+        StartMeshStage( "Exporting Files" );
         ExportFeaMesh();
 
         addOutputText( "Finished\n" );
 
-        m_FeaMeshInProgress = false;
-        m_CADOnlyFlag = false;
+        EndMeshRun();
         return;
     }
 
-    addOutputText( "Build Target Map\n" );
+    if ( !StartMeshStage( "Build Target Map" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     BuildTargetMap( CfdMeshMgrSingleton::VOCAL_OUTPUT );
 
-    addOutputText( "InitMesh\n" );
+    if ( !StartMeshStage( "InitMesh" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     InitMesh();
 
     SubTagTris();
 
-    addOutputText( "Set Fixed Points\n" );
+    if ( !StartMeshStage( "Set Fixed Points" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     SetFixPointSurfaceNodes();
 
-    addOutputText( "Remesh\n" );
+    if ( !StartMeshStage( "Remesh" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     Remesh( CfdMeshMgrSingleton::VOCAL_OUTPUT );
 
-    SubSurfaceMgr.BuildSingleTagMap();
+    #pragma omp critical ( SubSurfaceMgrTags )
+    {
+        SubSurfaceMgr.BuildSingleTagMap();
+    }
 
     CheckSubSurfBorderIntersect();
 
     CheckDuplicateSSIntersects();
 
-    addOutputText( "Build Fea Mesh\n" );
+    if ( !StartMeshStage( "Build Fea Mesh" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     BuildFeaMesh();
 
-    addOutputText( "Tag Fea Nodes\n" );
+    if ( !StartMeshStage( "Tag Fea Nodes" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     TagFeaNodes();
 
     RemoveSubSurfFeaTris();
 
     RemoveSkinTris();
 
-    addOutputText( "Exporting Files\n" );
+    if ( !StartMeshStage( "Exporting Files" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     ExportFeaMesh();
 
     addOutputText( "Finished\n" );
 
+    EndMeshRun();
+}
+
+//==== Every Exit of GenerateFeaMesh, Finished or Cancelled, Ends Here ====//
+void FeaMeshMgrSingleton::EndMeshRun()
+{
+    EndMeshStage();
+
+    // Concurrent managers are published by GenerateFeaMeshes, off the worker threads
+    if ( !m_ConcurrentFlag )
+    {
+        WriteMeshStageResults();
+    }
+
     m_FeaMeshInProgress = false;
+    m_CADOnlyFlag = false;
+}
+
+//==== Number Of Nodes Of Each Element In [start, start + num) ====//
+vector< int > FeaMeshMgrSingleton::GetFeaElementNumNodes( int start, int num )
+{
+    int s = max( start, 0 );
+    int e = min( start + max( num, 0 ), ( int )m_FeaElementVec.size() );
+
+    vector< int > num_vec;
+    for ( int i = s; i < e; i++ )
+    {
+        num_vec.push_back( ( int )( m_FeaElementVec[i]->m_Corners.size() + m_FeaElementVec[i]->m_Mids.size() ) );
+    }
+    return num_vec;
+}
+
+//==== Node Numbers (As Exported) Of Each Element In [start, start + num), Packed Back To Back ====//
+vector< int > FeaMeshMgrSingleton::GetFeaElementNodeChunk( int start, int num )
+{
+    int s = max( start, 0 );
+    int e = min( start + max( num, 0 ), ( int )m_FeaElementVec.size() );
+
+    vector< int > node_vec;
+    vector< FeaNode* > elem_node_vec;
+    for ( int i = s; i < e; i++ )
+    {
+        elem_node_vec.clear();
+        m_FeaElementVec[i]->LoadNodes( elem_node_vec );
+
+        for ( int j = 0; j < (int)elem_node_vec.size(); j++ )
+        {
+            node_vec.push_back( elem_node_vec[j]->GetIndex() );
+        }
+    }
+    return node_vec;
+}
+
+//==== Node Coordinates Matching GetFeaElementNodeChunk ====//
+vector< vec3d > FeaMeshMgrSingleton::GetFeaElementPntChunk( int start, int num )
+{
+    int s = max( start, 0 );
+    int e = min( start + max( num, 0 ), ( int )m_FeaElementVec.size() );
+
+    vector< vec3d > pnt_vec;
+    vector< FeaNode* > elem_node_vec;
+    for ( int i = s; i < e; i++ )
+    {
+        elem_node_vec.clear();
+        m_FeaElementVec[i]->LoadNodes( elem_node_vec );
+
+        for ( int j = 0; j < (int)elem_node_vec.size(); j++ )
+        {
+            pnt_vec.push_back( elem_node_vec[j]->m_Pnt );
+        }
+    }
+    return pnt_vec;
+}
+
+size_t FeaMeshMgrSingleton::MemoryUsage() const
+{
+    int i;
+    size_t bytes = CfdMeshMgrSingleton::MemoryUsage();
+
+    bytes += vector_mem_bytes( m_FeaNodeVec );
+    for ( i = 0 ; i < ( int )m_FeaNodeVec.size() ; i++ )
+    {
+        bytes += sizeof( FeaNode ) + vector_mem_bytes( m_FeaNodeVec[i]->m_Tags );
+    }
+
+    bytes += vector_mem_bytes( m_FeaElementVec );
+    for ( i = 0 ; i < ( int )m_FeaElementVec.size() ; i++ )
+    {
+        // Element nodes are counted once, in m_FeaNodeVec
+        bytes += sizeof( FeaTri ) + vector_mem_bytes( m_FeaElementVec[i]->m_Corners ) + vector_mem_bytes( m_FeaElementVec[i]->m_Mids );
+    }
+
+    bytes += vector_mem_bytes( m_AllPntVec ) + vector_mem_bytes( m_PntShift );
+    bytes += vector_mem_bytes( m_PartNodeTable ) + vector_mem_bytes( m_SSNodeTable ) + vector_mem_bytes( m_IntersectNodeTable );
+    bytes += vector_mem_bytes( m_RemainingNodeTable ) + vector_mem_bytes( m_UniqueNodeTable ) + vector_mem_bytes( m_PartElementTable );
+
+    return bytes;
+}
+
+Results* FeaMeshMgrSingleton::WriteMeshStageResults()
+{
+    Results* res = SurfaceIntersectionSingleton::WriteMeshStageResults();
+    if ( res )
+    {
+        res->Add( NameValData( "Struct_Name", m_StructName ) );
+        res->Add( NameValData( "Struct_Index", m_FeaMeshStructIndex ) );
+    }
+    return res;
+}
+
+//==== Mesh Several FeaStructures at Once, Each in Its Own Manager ====//
+void FeaMeshMgrSingleton::GenerateFeaMeshes( const vector < int > & struct_index_vec )
+{
+    vector < FeaMeshMgrSingleton* > mgr_vec;
+    set < int > index_set;
+
+    for ( size_t i = 0; i < struct_index_vec.size(); i++ )
+    {
+        // A structure's suppress lists are rebuilt while it is loaded, so each is meshed only once
+        if ( StructureMgr.GetFeaStruct( struct_index_vec[i] ) && index_set.insert( struct_index_vec[i] ).second )
+        {
+            FeaMeshMgrSingleton* mgr = new FeaMeshMgrSingleton();
+            mgr->SetFeaMeshStructIndex( struct_index_vec[i] );
+            mgr->SetDeferOutputFlag( true );
+            mgr->m_ConcurrentFlag = true;
+            mgr_vec.push_back( mgr );
+        }
+    }
+
+    int nmgr = ( int )mgr_vec.size();
+
+    SetCancelFlag( false );
+
+    //==== Surfaces, Meshes and Exports Are Owned by Each Manager ====//
+    #pragma omp parallel for schedule( dynamic )
+    for ( int i = 0; i < nmgr; i++ )
+    {
+        mgr_vec[i]->GenerateFeaMesh();
+    }
+
+    bool hide_flag = false;
+
+    for ( int i = 0; i < nmgr; i++ )
+    {
+        mgr_vec[i]->FlushOutputText();
+        mgr_vec[i]->WriteMeshStageResults();
+
+        if ( mgr_vec[i]->HasMeshExport() && mgr_vec[i]->GetTotalNumSurfs() > 0 )
+        {
+            hide_flag = true;
+        }
+
+        delete mgr_vec[i];
+    }
+
+    Vehicle* veh = VehicleMgr.GetVehicle();
+
+    if ( hide_flag && veh )
+    {
+        // Same as a single GenerateFeaMesh, done once the meshes are finished
+        veh->HideAll();
+    }
+}
+
+bool FeaMeshMgrSingleton::HasMeshExport()
+{
+    return ( GetStructSettingsPtr()->GetExportFileFlag( vsp::FEA_CALCULIX_FILE_NAME ) || GetStructSettingsPtr()->GetExportFileFlag( vsp::FEA_GMSH_FILE_NAME ) ||
+             GetStructSettingsPtr()->GetExportFileFlag( vsp::FEA_NASTRAN_FILE_NAME ) || GetStructSettingsPtr()->GetExportFileFlag( vsp::FEA_MASS_FILE_NAME ) ||
+             GetStructSettingsPtr()->GetExportFileFlag( vsp::FEA_STL_FILE_NAME ) );
 }
 
 void FeaMeshMgrSingleton::ExportFeaMesh()
 {
     if ( !m_CADOnlyFlag )
     {
+        BuildExportTables();
+
         if ( GetStructSettingsPtr()->GetExportFileFlag( vsp::FEA_NASTRAN_FILE_NAME ) )
         {
             WriteNASTRAN( GetStructSettingsPtr()->GetExportFileName( vsp::FEA_NASTRAN_FILE_NAME ) );
@@ -403,11 +757,6 @@ void FeaMeshMgrSingleton::ExportFeaMesh()
             WriteGmsh();
         }
 
-        if ( GetStructSettingsPtr()->GetExportFileFlag( vsp::FEA_GMSH_FILE_NAME ) )
-        {
-            WriteGmsh();
-        }
-
         if ( GetStructSettingsPtr()->GetExportFileFlag( vsp::FEA_MASS_FILE_NAME ) )
         {
             ComputeWriteMass();
@@ -1077,7 +1426,7 @@ void FeaMeshMgrSingleton::ComputeWriteMass()
             fprintf( fp, "FeaPart_Name         Mass_Tris   Mass_Beams\n" );
         }
 
-        // Iterate over each FeaPart index and calculate mass of each FeaElement if the current indexes match
+        // Sum the mass of the elements of each FeaPart that are not on a FeaSubSurface
         for ( unsigned int i = 0; i < m_NumFeaParts; i++ )
         {
             if ( m_FeaPartTypeVec[i] != vsp::FEA_FIX_POINT )
@@ -1087,15 +1436,17 @@ void FeaMeshMgrSingleton::ComputeWriteMass()
                 int property_id = m_FeaPartPropertyIndexVec[i];
                 int cap_property_id = m_FeaPartCapPropertyIndexVec[i];
 
-                for ( int j = 0; j < m_FeaElementVec.size(); j++ )
+                for ( size_t j = 0; j < m_PartElementTable[i].size(); j++ )
                 {
-                    if ( m_FeaElementVec[j]->GetFeaPartIndex() == i && m_FeaElementVec[j]->GetFeaSSIndex() < 0 && m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_TRI_6 )
+                    FeaElement* elem = m_FeaElementVec[ m_PartElementTable[i][j] ];
+
+                    if ( elem->GetFeaSSIndex() < 0 && elem->GetElementType() == FeaElement::FEA_TRI_6 )
                     {
-                        tri_mass += m_FeaElementVec[j]->ComputeMass( property_id );
+                        tri_mass += elem->ComputeMass( property_id, m_SimplePropertyVec, m_SimpleMaterialVec );
                     }
-                    else if ( m_FeaElementVec[j]->GetFeaPartIndex() == i && m_FeaElementVec[j]->GetFeaSSIndex() < 0 && m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_BEAM )
+                    else if ( elem->GetFeaSSIndex() < 0 && elem->GetElementType() == FeaElement::FEA_BEAM )
                     {
-                        beam_mass += m_FeaElementVec[j]->ComputeMass( cap_property_id );
+                        beam_mass += elem->ComputeMass( cap_property_id, m_SimplePropertyVec, m_SimpleMaterialVec );
                     }
                 }
 
@@ -1119,17 +1470,20 @@ void FeaMeshMgrSingleton::ComputeWriteMass()
             if ( m_FixPointMassFlagMap[i][0] )
             {
                 double pnt_mass = 0;
-                string name = m_FeaPartNameVec[m_FixPntFeaPartIndexMap[i][0]];
+                int part_index = m_FixPntFeaPartIndexMap[i][0];
+                string name = m_FeaPartNameVec[part_index];
                 vec3d pnt;
 
-                for ( int j = 0; j < m_FeaElementVec.size(); j++ )
+                for ( size_t j = 0; j < m_PartElementTable[part_index].size(); j++ )
                 {
-                    if ( m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_POINT_MASS && m_FeaElementVec[j]->GetFeaPartIndex() == m_FixPntFeaPartIndexMap[i][0] && m_FeaElementVec[j]->GetFeaSSIndex() < 0 )
+                    FeaElement* elem = m_FeaElementVec[ m_PartElementTable[part_index][j] ];
+
+                    if ( elem->GetElementType() == FeaElement::FEA_POINT_MASS && elem->GetFeaSSIndex() < 0 )
                     {
-                        pnt_mass += m_FeaElementVec[j]->ComputeMass( -1 ); // property ID ignored for point masses
-                        
+                        pnt_mass += elem->ComputeMass( -1, m_SimplePropertyVec, m_SimpleMaterialVec ); // property ID ignored for point masses
+
                         vector < FeaNode* > node_vec;
-                        m_FeaElementVec[j]->LoadNodes( node_vec );
+                        elem->LoadNodes( node_vec );
 
                         if ( node_vec.size() > 0 )
                         {
@@ -1144,13 +1498,13 @@ void FeaMeshMgrSingleton::ComputeWriteMass()
             }
         }
 
-        // Iterate over each FeaSubSurface index and calculate mass of each FeaElement if the subsurface indexes match
+        // Sum the mass of the elements of each FeaSubSurface
         if ( m_NumFeaSubSurfs > 0 )
         {
             fprintf( fp, "\n" );
             fprintf( fp, "FeaSubSurf_Name      Mass_Tris   Mass_Beams\n" );
         }
-        
+
         for ( unsigned int i = 0; i < m_NumFeaSubSurfs; i++ )
         {
             double tri_mass = 0;
@@ -1158,15 +1512,17 @@ void FeaMeshMgrSingleton::ComputeWriteMass()
             int property_id = m_SimpleSubSurfaceVec[i].GetFeaPropertyIndex();
             int cap_property_id = m_SimpleSubSurfaceVec[i].GetCapFeaPropertyIndex();
 
-            for ( int j = 0; j < m_FeaElementVec.size(); j++ )
+            for ( size_t j = 0; j < m_SSElementTable[i].size(); j++ )
             {
-                if ( m_FeaElementVec[j]->GetFeaSSIndex() == i && m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_TRI_6 )
+                FeaElement* elem = m_FeaElementVec[ m_SSElementTable[i][j] ];
+
+                if ( elem->GetElementType() == FeaElement::FEA_TRI_6 )
                 {
-                    tri_mass += m_FeaElementVec[j]->ComputeMass( property_id );
+                    tri_mass += elem->ComputeMass( property_id, m_SimplePropertyVec, m_SimpleMaterialVec );
                 }
-                else if ( m_FeaElementVec[j]->GetFeaSSIndex() == i && m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_BEAM )
+                else if ( elem->GetElementType() == FeaElement::FEA_BEAM )
                 {
-                    beam_mass += m_FeaElementVec[j]->ComputeMass( cap_property_id );
+                    beam_mass += elem->ComputeMass( cap_property_id, m_SimplePropertyVec, m_SimpleMaterialVec );
                 }
             }
 
@@ -2088,42 +2444,52 @@ void FeaMeshMgrSingleton::MergeFeaPartSSEdgeOverlap()
 
 void FeaMeshMgrSingleton::RemoveSubSurfFeaTris()
 {
-    for ( unsigned int i = 0; i < m_NumFeaSubSurfs; i++ )
+    // Compact the element vector in place, keeping the order of the remaining elements
+    size_t num_keep = 0;
+
+    for ( size_t j = 0; j < m_FeaElementVec.size(); j++ )
     {
-        for ( int j = 0; j < m_FeaElementVec.size(); j++ )
+        int ss_index = m_FeaElementVec[j]->GetFeaSSIndex();
+
+        if ( ss_index >= 0 && ss_index < (int)m_NumFeaSubSurfs && m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_TRI_6 &&
+             m_SimpleSubSurfaceVec[ss_index].m_IncludedElements == vsp::FEA_BEAM )
         {
-            if ( m_FeaElementVec[j]->GetFeaSSIndex() == i && m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_TRI_6 )
-            {
-                if ( m_SimpleSubSurfaceVec[i].m_IncludedElements == vsp::FEA_BEAM )
-                {
-                    delete m_FeaElementVec[j];
-                    m_FeaElementVec.erase( m_FeaElementVec.begin() + j );
-                    j--;
-                }
-            }
+            delete m_FeaElementVec[j];
+        }
+        else
+        {
+            m_FeaElementVec[num_keep] = m_FeaElementVec[j];
+            num_keep++;
         }
     }
+
+    m_FeaElementVec.resize( num_keep );
 }
 
 void FeaMeshMgrSingleton::RemoveSkinTris()
 {
     if ( m_RemoveSkinTris )
     {
-        for ( size_t i = 0; i < m_NumFeaParts; i++ )
+        // Compact the element vector in place, keeping the order of the remaining elements
+        size_t num_keep = 0;
+
+        for ( size_t j = 0; j < m_FeaElementVec.size(); j++ )
         {
-            if ( m_FeaPartTypeVec[i] == vsp::FEA_SKIN )
+            int part_index = m_FeaElementVec[j]->GetFeaPartIndex();
+
+            if ( part_index >= 0 && part_index < (int)m_NumFeaParts && m_FeaPartTypeVec[part_index] == vsp::FEA_SKIN &&
+                 m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_TRI_6 && m_FeaElementVec[j]->GetFeaSSIndex() < 0 )
             {
-                for ( int j = 0; j < m_FeaElementVec.size(); j++ )
-                {
-                    if ( m_FeaElementVec[j]->GetFeaPartIndex() == i && m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_TRI_6 && m_FeaElementVec[j]->GetFeaSSIndex() < 0 )
-                    {
-                        delete m_FeaElementVec[j];
-                        m_FeaElementVec.erase( m_FeaElementVec.begin() + j );
-                        j--;
-                    }
-                }
+                delete m_FeaElementVec[j];
+            }
+            else
+            {
+                m_FeaElementVec[num_keep] = m_FeaElementVec[j];
+                num_keep++;
             }
         }
+
+        m_FeaElementVec.resize( num_keep );
     }
 }
 
@@ -2132,10 +2498,15 @@ void FeaMeshMgrSingleton::TagFeaNodes()
     //==== Collect All FeaNodes ====//
     m_FeaNodeVec.clear();
 
+    // The nodes of element i are m_FeaNodeVec[node_start_vec[i]] to m_FeaNodeVec[node_start_vec[i + 1] - 1]
+    vector< int > node_start_vec( m_FeaElementVec.size() + 1 );
+
     for ( int i = 0; i < (int)m_FeaElementVec.size(); i++ )
     {
+        node_start_vec[i] = (int)m_FeaNodeVec.size();
         m_FeaElementVec[i]->LoadNodes( m_FeaNodeVec );
     }
+    node_start_vec[ m_FeaElementVec.size() ] = (int)m_FeaNodeVec.size();
 
     vector< vec3d* > m_AllPntVec;
     for ( int i = 0; i < (int)m_FeaNodeVec.size(); i++ )
@@ -2149,50 +2520,62 @@ void FeaMeshMgrSingleton::TagFeaNodes()
     int numPnts = BuildIndMap( m_AllPntVec, m_IndMap, m_PntShift );
 
     //==== Assign Index Numbers to Nodes ====//
-    for ( int i = 0; i < (int)m_FeaNodeVec.size(); i++ )
+    // Each node is looked up once and the merged node index is kept for tagging below
+    int num_node = (int)m_FeaNodeVec.size();
+    vector< int > pnt_ind_vec( num_node );
+
+    #pragma omp parallel for
+    for ( int i = 0; i < num_node; i++ )
     {
         m_FeaNodeVec[i]->m_Tags.clear();
-        int ind = FindPntIndex( m_FeaNodeVec[i]->m_Pnt, m_AllPntVec, m_IndMap );
-        m_FeaNodeVec[i]->m_Index = m_PntShift[ind] + 1;
+        pnt_ind_vec[i] = FindPntIndex( m_FeaNodeVec[i]->m_Pnt, m_AllPntVec, m_IndMap );
+        m_FeaNodeVec[i]->m_Index = m_PntShift[pnt_ind_vec[i]] + 1;
     }
 
-    // Tag FeaPart Nodes with FeaPart Index
-    for ( unsigned int i = 0; i < m_NumFeaParts; i++ )
+    //==== Bucket Elements by FeaPart and FeaSubSurface ====//
+    vector< vector< int > > part_elem_vec( m_NumFeaParts );
+    vector< vector< int > > ss_elem_vec( m_NumFeaSubSurfs );
+
+    for ( int j = 0; j < (int)m_FeaElementVec.size(); j++ )
     {
-        vector< FeaNode* > temp_nVec;
+        int part_index = m_FeaElementVec[j]->GetFeaPartIndex();
+        int ss_index = m_FeaElementVec[j]->GetFeaSSIndex();
 
-        for ( int j = 0; j < m_FeaElementVec.size(); j++ )
+        if ( ss_index < 0 && part_index >= 0 && part_index < (int)m_NumFeaParts )
         {
-            if ( m_FeaElementVec[j]->GetFeaPartIndex() == i && m_FeaElementVec[j]->GetFeaSSIndex() < 0 )
-            {
-                m_FeaElementVec[j]->LoadNodes( temp_nVec );
-            }
+            part_elem_vec[part_index].push_back( j );
         }
-
-        for ( int j = 0; j < (int)temp_nVec.size(); j++ )
+        else if ( ss_index >= 0 && ss_index < (int)m_NumFeaSubSurfs && m_SimpleSubSurfaceVec[ss_index].m_IncludedElements != vsp::FEA_BEAM )
         {
-            int ind = FindPntIndex( temp_nVec[j]->m_Pnt, m_AllPntVec, m_IndMap );
-            m_FeaNodeVec[ind]->AddTag( i );
+            ss_elem_vec[ss_index].push_back( j );
         }
     }
 
-    // Tag FeaSubSurface Nodes with FeaSubSurface Index, beginning at the last FeaPart index (m_NumFeaParts)
-    for ( unsigned int i = 0; i < m_NumFeaSubSurfs; i++ )
+    // Tag FeaPart Nodes with FeaPart Index
+    for ( unsigned int i = 0; i < m_NumFeaParts; i++ )
     {
-        vector< FeaNode* > temp_nVec;
-
-        for ( int j = 0; j < m_FeaElementVec.size(); j++ )
+        for ( size_t j = 0; j < part_elem_vec[i].size(); j++ )
         {
-            if ( m_FeaElementVec[j]->GetFeaSSIndex() == i && m_FeaElementVec[j]->GetFeaSSIndex() >= 0 && m_SimpleSubSurfaceVec[i].m_IncludedElements != vsp::FEA_BEAM )
+            int e = part_elem_vec[i][j];
+
+            for ( int k = node_start_vec[e]; k < node_start_vec[e + 1]; k++ )
             {
-                m_FeaElementVec[j]->LoadNodes( temp_nVec );
+                m_FeaNodeVec[pnt_ind_vec[k]]->AddTag( i );
             }
         }
+    }
 
-        for ( int j = 0; j < (int)temp_nVec.size(); j++ )
+    // Tag FeaSubSurface Nodes with FeaSubSurface Index, beginning at the last FeaPart index (m_NumFeaParts)
+    for ( unsigned int i = 0; i < m_NumFeaSubSurfs; i++ )
+    {
+        for ( size_t j = 0; j < ss_elem_vec[i].size(); j++ )
         {
-            int ind = FindPntIndex( temp_nVec[j]->m_Pnt, m_AllPntVec, m_IndMap );
-            m_FeaNodeVec[ind]->AddTag( i + m_NumFeaParts );
+            int e = ss_elem_vec[i][j];
+
+            for ( int k = node_start_vec[e]; k < node_start_vec[e + 1]; k++ )
+            {
+                m_FeaNodeVec[pnt_ind_vec[k]]->AddTag( i + m_NumFeaParts );
+            }
         }
     }
 
@@ -2215,9 +2598,7 @@ void FeaMeshMgrSingleton::TagFeaNodes()
                         FeaPointMass* mass = new FeaPointMass;
                         mass->Create( m_FeaNodeVec[i]->m_Pnt, m_FixPointMassMap[j][k] );
                         mass->SetFeaPartIndex( m_FixPntFeaPartIndexMap[j][k] );
-
-                        int ind = FindPntIndex( m_FeaNodeVec[i]->m_Pnt, m_AllPntVec, m_IndMap );
-                        mass->m_Corners[0]->m_Index = m_PntShift[ind] + 1;
+                        mass->m_Corners[0]->m_Index = m_PntShift[pnt_ind_vec[i]] + 1;
 
                         m_FeaElementVec.push_back( mass );
                     }
@@ -2228,6 +2609,97 @@ void FeaMeshMgrSingleton::TagFeaNodes()
     }
 }
 
+void FeaMeshMgrSingleton::BuildExportTables()
+{
+    m_PartNodeTable.assign( m_NumFeaParts, vector< int >() );
+    m_SSNodeTable.assign( m_NumFeaSubSurfs, vector< int >() );
+    m_IntersectNodeTable.clear();
+    m_RemainingNodeTable.clear();
+    m_UniqueNodeTable.clear();
+
+    //==== Sort Unique Nodes by Their Tags ====//
+    for ( int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
+    {
+        if ( m_PntShift[j] >= 0 )
+        {
+            FeaNode* node = m_FeaNodeVec[j];
+
+            m_UniqueNodeTable.push_back( j );
+
+            if ( node->m_Tags.size() == 0 )
+            {
+                // A node without tags passes HasOnlyIndex for every index, so it is also written with each FeaPart and FeaSubSurface
+                for ( unsigned int i = 0; i < m_NumFeaParts; i++ )
+                {
+                    if ( m_FeaPartTypeVec[i] != vsp::FEA_FIX_POINT )
+                    {
+                        m_PartNodeTable[i].push_back( j );
+                    }
+                }
+
+                for ( unsigned int i = 0; i < m_NumFeaSubSurfs; i++ )
+                {
+                    m_SSNodeTable[i].push_back( j );
+                }
+
+                m_RemainingNodeTable.push_back( j );
+            }
+            else if ( node->m_Tags.size() == 1 )
+            {
+                int tag = node->m_Tags[0].m_FeaPartTagIndex;
+
+                if ( tag >= 0 && tag < (int)m_NumFeaParts )
+                {
+                    if ( m_FeaPartTypeVec[tag] != vsp::FEA_FIX_POINT )
+                    {
+                        m_PartNodeTable[tag].push_back( j );
+                    }
+                }
+                else if ( tag >= (int)m_NumFeaParts && tag < (int)( m_NumFeaParts + m_NumFeaSubSurfs ) )
+                {
+                    m_SSNodeTable[tag - m_NumFeaParts].push_back( j );
+                }
+            }
+            else if ( node->m_FixedPointFlag )
+            {
+                for ( size_t k = 0; k < node->m_Tags.size(); k++ )
+                {
+                    int tag = node->m_Tags[k].m_FeaPartTagIndex;
+
+                    if ( tag >= 0 && tag < (int)m_NumFeaParts && m_FeaPartTypeVec[tag] == vsp::FEA_FIX_POINT )
+                    {
+                        m_PartNodeTable[tag].push_back( j );
+                    }
+                }
+            }
+            else
+            {
+                m_IntersectNodeTable.push_back( j );
+            }
+        }
+    }
+
+    //==== Group Elements by FeaPart and FeaSubSurface ====//
+    m_PartElementTable.assign( m_NumFeaParts, vector< int >() );
+    m_SSElementTable.assign( m_NumFeaSubSurfs, vector< int >() );
+
+    for ( int j = 0; j < (int)m_FeaElementVec.size(); j++ )
+    {
+        int part_index = m_FeaElementVec[j]->GetFeaPartIndex();
+        int ss_index = m_FeaElementVec[j]->GetFeaSSIndex();
+
+        if ( part_index >= 0 && part_index < (int)m_NumFeaParts )
+        {
+            m_PartElementTable[part_index].push_back( j );
+        }
+
+        if ( ss_index >= 0 && ss_index < (int)m_NumFeaSubSurfs )
+        {
+            m_SSElementTable[ss_index].push_back( j );
+        }
+    }
+}
+
 void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
 {
     // Create temporary file to store NASTRAN bulk data. Case control information (SETs) will be 
@@ -2262,44 +2734,20 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         vector < int > grid_id_vec;
         string name;
 
-        // FeaPart Nodes
-        for ( unsigned int i = 0; i < m_NumFeaParts; i++ )
+        int node_format = FeaNodeFormatter::NASTRAN;
+        if ( GetStructSettingsPtr()->m_NASTRANLargeFieldFlag )
         {
-            grid_id_vec.clear();
+            node_format = FeaNodeFormatter::NASTRAN_LARGE;
+        }
 
+        // FeaPart Nodes, including FixedPoint Nodes
+        for ( unsigned int i = 0; i < m_NumFeaParts; i++ )
+        {
             fprintf( temp, "\n" );
             fprintf( temp, "$%s Gridpoints\n", m_FeaPartNameVec[i].c_str() );
 
-            if ( m_FeaPartTypeVec[i] != vsp::FEA_FIX_POINT )
-            {
-                for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
-                {
-                    if ( m_PntShift[j] >= 0 )
-                    {
-                        if ( m_FeaNodeVec[j]->HasOnlyIndex( i ) )
-                        {
-                            m_FeaNodeVec[j]->WriteNASTRAN( temp );
-                            grid_id_vec.push_back( m_FeaNodeVec[j]->m_Index );
-                            max_grid_id = max( max_grid_id, m_FeaNodeVec[j]->m_Index );
-                        }
-                    }
-                }
-            }
-            else if ( m_FeaPartTypeVec[i] == vsp::FEA_FIX_POINT ) // FixedPoint Nodes
-            {
-                for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
-                {
-                    if ( m_PntShift[j] >= 0 )
-                    {
-                        if ( m_FeaNodeVec[j]->m_Tags.size() > 1 && m_FeaNodeVec[j]->m_FixedPointFlag && m_FeaNodeVec[j]->HasTag( i ) )
-                        {
-                            m_FeaNodeVec[j]->WriteNASTRAN( temp );
-                            grid_id_vec.push_back( m_FeaNodeVec[j]->m_Index );
-                            max_grid_id = max( max_grid_id, m_FeaNodeVec[j]->m_Index );
-                        }
-                    }
-                }
-            }
+            WriteChunked( temp, (int)m_PartNodeTable[i].size(), FeaNodeFormatter( m_FeaNodeVec, m_PartNodeTable[i], node_format ) );
+            LoadGridIDs( m_FeaNodeVec, m_PartNodeTable[i], grid_id_vec, max_grid_id );
 
             // Write FEA part node set
             name = m_FeaPartNameVec[i] + "_Gridpoints";
@@ -2312,20 +2760,8 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
             fprintf( temp, "\n" );
             fprintf( temp, "$%s Gridpoints\n", m_SimpleSubSurfaceVec[i].GetName().c_str() );
 
-            grid_id_vec.clear();
-
-            for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
-            {
-                if ( m_PntShift[j] >= 0 )
-                {
-                    if ( m_FeaNodeVec[j]->HasOnlyIndex( i + m_NumFeaParts ) )
-                    {
-                        m_FeaNodeVec[j]->WriteNASTRAN( temp );
-                        grid_id_vec.push_back( m_FeaNodeVec[j]->m_Index );
-                        max_grid_id = max( max_grid_id, m_FeaNodeVec[j]->m_Index );
-                    }
-                }
-            }
+            WriteChunked( temp, (int)m_SSNodeTable[i].size(), FeaNodeFormatter( m_FeaNodeVec, m_SSNodeTable[i], node_format ) );
+            LoadGridIDs( m_FeaNodeVec, m_SSNodeTable[i], grid_id_vec, max_grid_id );
 
             // Write subsurface node set
             name = m_SimpleSubSurfaceVec[i].GetName() + "_Gridpoints";
@@ -2336,44 +2772,22 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         fprintf( temp, "\n" );
         fprintf( temp, "$Intersections\n" );
 
-        grid_id_vec.clear();
-
-        for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
-        {
-            if ( m_PntShift[j] >= 0 )
-            {
-                if ( m_FeaNodeVec[j]->m_Tags.size() > 1 && !m_FeaNodeVec[j]->m_FixedPointFlag )
-                {
-                    m_FeaNodeVec[j]->WriteNASTRAN( temp );
-                    grid_id_vec.push_back( m_FeaNodeVec[j]->m_Index );
-                    max_grid_id = max( max_grid_id, m_FeaNodeVec[j]->m_Index );
-                }
-            }
-        }
+        WriteChunked( temp, (int)m_IntersectNodeTable.size(), FeaNodeFormatter( m_FeaNodeVec, m_IntersectNodeTable, node_format ) );
+        LoadGridIDs( m_FeaNodeVec, m_IntersectNodeTable, grid_id_vec, max_grid_id );
 
         // Write intersection node set
         name = "Intersection_Gridpoints";
         WriteNASTRANSet( fp, nkey_fp, set_cnt, grid_id_vec, name );
 
         //==== Remaining Nodes ====//
+        // Remaining nodes are already written with each FeaPart and FeaSubSurface, so they get no set of their own
         fprintf( temp, "\n" );
         fprintf( temp, "$Remainingnodes\n" );
-        for ( int i = 0; i < (int)m_FeaNodeVec.size(); i++ )
-        {
-            grid_id_vec.clear();
 
-            if ( m_PntShift[i] >= 0 && m_FeaNodeVec[i]->m_Tags.size() == 0 )
-            {
-                m_FeaNodeVec[i]->WriteNASTRAN( temp );
-            }
-
-            // Write remaining node set
-            name = "Remaining_Gridpoints";
-            WriteNASTRANSet( fp, nkey_fp, set_cnt, grid_id_vec, name );
-        }
+        WriteChunked( temp, (int)m_RemainingNodeTable.size(), FeaNodeFormatter( m_FeaNodeVec, m_RemainingNodeTable, node_format ) );
 
         int elem_id = max_grid_id + 1; // First element ID begins after last gridpoint ID
-        vector < int > shell_elem_id_vec, beam_elem_id_vec;
+        vector < int > shell_elem_id_vec, beam_elem_id_vec, elem_table;
 
         // Write FeaParts
         for ( unsigned int i = 0; i < m_NumFeaParts; i++ )
@@ -2389,23 +2803,22 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
                 int property_id = m_FeaPartPropertyIndexVec[i];
                 int cap_property_id = m_FeaPartCapPropertyIndexVec[i];
 
-                for ( int j = 0; j < m_FeaElementVec.size(); j++ )
+                FilterElementTable( m_FeaElementVec, m_PartElementTable[i], -1, true, elem_table );
+                WriteChunked( temp, (int)elem_table.size(), FeaElementFormatter( m_FeaElementVec, elem_table, FeaElementFormatter::NASTRAN, elem_id,
+                                                                                 property_id, cap_property_id ) );
+
+                for ( size_t j = 0; j < elem_table.size(); j++ )
                 {
-                    if ( m_FeaElementVec[j]->GetFeaPartIndex() == i && m_FeaElementVec[j]->GetFeaSSIndex() < 0 )
+                    if ( m_FeaElementVec[elem_table[j]]->GetElementType() != FeaElement::FEA_BEAM )
                     {
-                        if ( m_FeaElementVec[j]->GetElementType() != FeaElement::FEA_BEAM )
-                        {
-                            m_FeaElementVec[j]->WriteNASTRAN( temp, elem_id, property_id );
-                            shell_elem_id_vec.push_back( elem_id );
-                        }
-                        else
-                        {
-                            m_FeaElementVec[j]->WriteNASTRAN( temp, elem_id, cap_property_id );
-                            beam_elem_id_vec.push_back( elem_id );
-                        }
-
-                        elem_id++;
+                        shell_elem_id_vec.push_back( elem_id );
                     }
+                    else
+                    {
+                        beam_elem_id_vec.push_back( elem_id );
+                    }
+
+                    elem_id++;
                 }
 
                 // Write shell element set
@@ -2423,23 +2836,25 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
         {
             if ( m_FixPointMassFlagMap[i][0] )
             {
+                int part_index = m_FixPntFeaPartIndexMap[i][0];
+
                 fprintf( temp, "\n" );
-                fprintf( temp, "$%s\n", m_FeaPartNameVec[m_FixPntFeaPartIndexMap[i][0]].c_str() );
+                fprintf( temp, "$%s\n", m_FeaPartNameVec[part_index].c_str() );
 
                 vector < int > mass_elem_id_vec;
 
-                for ( int j = 0; j < m_FeaElementVec.size(); j++ )
+                // Property ID ignored for Point Masses
+                FilterElementTable( m_FeaElementVec, m_PartElementTable[part_index], FeaElement::FEA_POINT_MASS, true, elem_table );
+                WriteChunked( temp, (int)elem_table.size(), FeaElementFormatter( m_FeaElementVec, elem_table, FeaElementFormatter::NASTRAN, elem_id ) );
+
+                for ( size_t j = 0; j < elem_table.size(); j++ )
                 {
-                    if ( m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_POINT_MASS && m_FeaElementVec[j]->GetFeaPartIndex() == m_FixPntFeaPartIndexMap[i][0] && m_FeaElementVec[j]->GetFeaSSIndex() < 0 )
-                    {
-                        m_FeaElementVec[j]->WriteNASTRAN( temp, elem_id, -1 ); // property ID ignored for Point Masses
-                        mass_elem_id_vec.push_back( elem_id );
-                        elem_id++;
-                    }
+                    mass_elem_id_vec.push_back( elem_id );
+                    elem_id++;
                 }
 
                 // Write mass element set
-                name = m_FeaPartNameVec[m_FixPntFeaPartIndexMap[i][0]] + "_MassElements";
+                name = m_FeaPartNameVec[part_index] + "_MassElements";
                 WriteNASTRANSet( fp, nkey_fp, set_cnt, mass_elem_id_vec, name );
             }
         }
@@ -2456,23 +2871,21 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
             shell_elem_id_vec.clear();
             beam_elem_id_vec.clear();
 
-            for ( int j = 0; j < m_FeaElementVec.size(); j++ )
+            WriteChunked( temp, (int)m_SSElementTable[i].size(), FeaElementFormatter( m_FeaElementVec, m_SSElementTable[i], FeaElementFormatter::NASTRAN, elem_id,
+                                                                                      property_id, cap_property_id ) );
+
+            for ( size_t j = 0; j < m_SSElementTable[i].size(); j++ )
             {
-                if ( m_FeaElementVec[j]->GetFeaSSIndex() == i )
+                if ( m_FeaElementVec[m_SSElementTable[i][j]]->GetElementType() != FeaElement::FEA_BEAM )
                 {
-                    if ( m_FeaElementVec[j]->GetElementType() != FeaElement::FEA_BEAM )
-                    {
-                        m_FeaElementVec[j]->WriteNASTRAN( temp, elem_id, property_id );
-                        shell_elem_id_vec.push_back( elem_id );
-                    }
-                    else
-                    {
-                        m_FeaElementVec[j]->WriteNASTRAN( temp, elem_id, cap_property_id );
-                        beam_elem_id_vec.push_back( elem_id );
-                    }
-
-                    elem_id++;
+                    shell_elem_id_vec.push_back( elem_id );
+                }
+                else
+                {
+                    beam_elem_id_vec.push_back( elem_id );
                 }
+
+                elem_id++;
             }
 
             // Write shell element set
@@ -2504,38 +2917,43 @@ void FeaMeshMgrSingleton::WriteNASTRAN( const string &filename )
 
         fprintf( temp, "\nEND DATA\n" );
 
-        // Obtain file size:
-        fseek( temp, 0, SEEK_END );
-        long lSize = ftell( temp );
+        // Copy the bulk data after the case control section, a block at a time
         rewind( temp );
 
-        // Allocate memory to contain the whole file:
-        char * buffer = (char*)malloc( sizeof( char )*lSize );
-        if ( buffer == NULL )
+        vector < char > buffer( 1 << 16 );
+        size_t num_read;
+        while ( ( num_read = fread( &buffer[0], 1, buffer.size(), temp ) ) > 0 )
         {
-            addOutputText( "WriteNASTRAN memory error\n" );
+            if ( fwrite( &buffer[0], 1, num_read, fp ) != num_read )
+            {
+                addOutputText( "WriteNASTRAN writing error\n" );
+                break;
+            }
         }
 
-        // Copy the file into the buffer:
-        size_t result = fread( buffer, 1, lSize, temp );
-        if ( result != lSize )
+        if ( ferror( temp ) )
         {
             addOutputText( "WriteNASTRAN reading error\n" );
         }
 
-        // The whole file is now loaded in the memory buffer. Write to NASTRAN file
-        fprintf( fp, "%s", buffer );
-
-        // Close open files and free memmory
+        // Close open files
         fclose( fp );
-        fclose( temp );
-        free( buffer );
 
         if ( nkey_fp )
         {
             fclose( nkey_fp );
         }
     }
+
+    if ( fp && !temp )
+    {
+        fclose( fp );
+    }
+
+    if ( temp )
+    {
+        fclose( temp );
+    }
 }
 
 void FeaMeshMgrSingleton::WriteCalculix()
@@ -2550,6 +2968,7 @@ void FeaMeshMgrSingleton::WriteCalculix()
 
         int elem_id = 0;
         char str[256];
+        vector < int > elem_table;
 
         //==== Write FeaParts ====//
         for ( unsigned int i = 0; i < m_NumFeaParts; i++ )
@@ -2559,16 +2978,7 @@ void FeaMeshMgrSingleton::WriteCalculix()
                 fprintf( fp, "**%s\n", m_FeaPartNameVec[i].c_str() );
                 fprintf( fp, "*NODE, NSET=N%s\n", m_FeaPartNameVec[i].c_str() );
 
-                for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
-                {
-                    if ( m_PntShift[j] >= 0 )
-                    {
-                        if ( m_FeaNodeVec[j]->HasOnlyIndex( i ) )
-                        {
-                            m_FeaNodeVec[j]->WriteCalculix( fp );
-                        }
-                    }
-                }
+                WriteChunked( fp, (int)m_PartNodeTable[i].size(), FeaNodeFormatter( m_FeaNodeVec, m_PartNodeTable[i], FeaNodeFormatter::CALCULIX ) );
 
                 fprintf( fp, "\n" );
 
@@ -2576,14 +2986,10 @@ void FeaMeshMgrSingleton::WriteCalculix()
                 {
                     fprintf( fp, "*ELEMENT, TYPE=S6, ELSET=E%s\n", m_FeaPartNameVec[i].c_str() );
 
-                    for ( int j = 0; j < m_FeaElementVec.size(); j++ )
-                    {
-                        if ( m_FeaElementVec[j]->GetFeaPartIndex() == i && m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_TRI_6 && m_FeaElementVec[j]->GetFeaSSIndex() < 0 )
-                        {
-                            elem_id++;
-                            m_FeaElementVec[j]->WriteCalculix( fp, elem_id );
-                        }
-                    }
+                    FilterElementTable( m_FeaElementVec, m_PartElementTable[i], FeaElement::FEA_TRI_6, true, elem_table );
+                    WriteChunked( fp, (int)elem_table.size(), FeaElementFormatter( m_FeaElementVec, elem_table, FeaElementFormatter::CALCULIX, elem_id + 1 ) );
+                    elem_id += (int)elem_table.size();
+
                     fprintf( fp, "\n" );
                 }
 
@@ -2591,28 +2997,15 @@ void FeaMeshMgrSingleton::WriteCalculix()
                 {
                     fprintf( fp, "*ELEMENT, TYPE=B32, ELSET=E%s_CAP\n", m_FeaPartNameVec[i].c_str() );
 
-                    for ( int j = 0; j < m_FeaElementVec.size(); j++ )
-                    {
-                        if ( m_FeaElementVec[j]->GetFeaPartIndex() == i && m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_BEAM && m_FeaElementVec[j]->GetFeaSSIndex() < 0 )
-                        {
-                            elem_id++;
-                            m_FeaElementVec[j]->WriteCalculix( fp, elem_id );
-                        }
-                    }
+                    FilterElementTable( m_FeaElementVec, m_PartElementTable[i], FeaElement::FEA_BEAM, true, elem_table );
+                    WriteChunked( fp, (int)elem_table.size(), FeaElementFormatter( m_FeaElementVec, elem_table, FeaElementFormatter::CALCULIX, elem_id + 1 ) );
+                    elem_id += (int)elem_table.size();
 
-                    // Write Normal Vectors
+                    // Write Normal Vectors, which refer to the element IDs just written
                     fprintf( fp, "\n" );
                     fprintf( fp, "*NORMAL\n" );
 
-                    for ( int j = 0; j < m_FeaElementVec.size(); j++ )
-                    {
-                        if ( m_FeaElementVec[j]->GetFeaPartIndex() == i && m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_BEAM && m_FeaElementVec[j]->GetFeaSSIndex() < 0 )
-                        {
-                            FeaBeam* beam = dynamic_cast<FeaBeam*>( m_FeaElementVec[j] );
-                            assert( beam );
-                            beam->WriteCalculixNormal( fp );
-                        }
-                    }
+                    WriteChunked( fp, (int)elem_table.size(), FeaElementFormatter( m_FeaElementVec, elem_table, FeaElementFormatter::CALCULIX_NORMAL, 0 ) );
 
                     fprintf( fp, "\n" );
                 }
@@ -2622,37 +3015,25 @@ void FeaMeshMgrSingleton::WriteCalculix()
         //==== Write Fixed Points ====//
         for ( size_t i = 0; i < m_NumFeaFixPoints; i++ )
         {
-            fprintf( fp, "**%s\n", m_FeaPartNameVec[m_FixPntFeaPartIndexMap[i][0]].c_str() );
-            fprintf( fp, "*NODE, NSET=N%s\n", m_FeaPartNameVec[m_FixPntFeaPartIndexMap[i][0]].c_str() );
+            int part_index = m_FixPntFeaPartIndexMap[i][0];
 
-            for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
-            {
-                if ( m_PntShift[j] >= 0 )
-                {
-                    if ( m_FeaNodeVec[j]->m_Tags.size() > 1 && m_FeaNodeVec[j]->m_FixedPointFlag && m_FeaNodeVec[j]->HasTag( m_FixPntFeaPartIndexMap[i][0] ) )
-                    {
-                        m_FeaNodeVec[j]->WriteCalculix( fp );
-                    }
-                }
-            }
+            fprintf( fp, "**%s\n", m_FeaPartNameVec[part_index].c_str() );
+            fprintf( fp, "*NODE, NSET=N%s\n", m_FeaPartNameVec[part_index].c_str() );
+
+            WriteChunked( fp, (int)m_PartNodeTable[part_index].size(), FeaNodeFormatter( m_FeaNodeVec, m_PartNodeTable[part_index], FeaNodeFormatter::CALCULIX ) );
 
             if ( m_FixPointMassFlagMap[i][0] )
             {
                 fprintf( fp, "\n" );
-                fprintf( fp, "*ELEMENT, TYPE=MASS, ELSET=E%s\n", m_FeaPartNameVec[m_FixPntFeaPartIndexMap[i][0]].c_str() );
+                fprintf( fp, "*ELEMENT, TYPE=MASS, ELSET=E%s\n", m_FeaPartNameVec[part_index].c_str() );
 
-                for ( int j = 0; j < m_FeaElementVec.size(); j++ )
-                {
-                    if ( m_FeaElementVec[j]->GetFeaPartIndex() == m_FixPntFeaPartIndexMap[i][0] && m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_POINT_MASS && m_FeaElementVec[j]->GetFeaSSIndex() < 0 )
-                    {
-                        elem_id++;
-                        m_FeaElementVec[j]->WriteCalculix( fp, elem_id );
-                    }
-                }
+                FilterElementTable( m_FeaElementVec, m_PartElementTable[part_index], FeaElement::FEA_POINT_MASS, true, elem_table );
+                WriteChunked( fp, (int)elem_table.size(), FeaElementFormatter( m_FeaElementVec, elem_table, FeaElementFormatter::CALCULIX, elem_id + 1 ) );
+                elem_id += (int)elem_table.size();
 
                 fprintf( fp, "\n" );
 
-                fprintf( fp, "*MASS, ELSET=E%s\n", m_FeaPartNameVec[m_FixPntFeaPartIndexMap[i][0]].c_str() );
+                fprintf( fp, "*MASS, ELSET=E%s\n", m_FeaPartNameVec[part_index].c_str() );
                 fprintf( fp, "%f\n", m_FixPointMassMap[i][0] );
             }
 
@@ -2665,30 +3046,17 @@ void FeaMeshMgrSingleton::WriteCalculix()
             fprintf( fp, "**%s\n", m_SimpleSubSurfaceVec[i].GetName().c_str() );
             fprintf( fp, "*NODE, NSET=N%s\n", m_SimpleSubSurfaceVec[i].GetName().c_str() );
 
-            for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
-            {
-                if ( m_PntShift[j] >= 0 )
-                {
-                    if ( m_FeaNodeVec[j]->HasOnlyIndex( i + m_NumFeaParts ) )
-                    {
-                        m_FeaNodeVec[j]->WriteCalculix( fp );
-                    }
-                }
-            }
+            WriteChunked( fp, (int)m_SSNodeTable[i].size(), FeaNodeFormatter( m_FeaNodeVec, m_SSNodeTable[i], FeaNodeFormatter::CALCULIX ) );
 
             if ( m_SimpleSubSurfaceVec[i].m_IncludedElements == vsp::FEA_SHELL || m_SimpleSubSurfaceVec[i].m_IncludedElements == vsp::FEA_SHELL_AND_BEAM )
             {
                 fprintf( fp, "\n" );
                 fprintf( fp, "*ELEMENT, TYPE=S6, ELSET=E%s\n", m_SimpleSubSurfaceVec[i].GetName().c_str() );
 
-                for ( int j = 0; j < m_FeaElementVec.size(); j++ )
-                {
-                    if ( m_FeaElementVec[j]->GetFeaSSIndex() == i && m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_TRI_6 )
-                    {
-                        elem_id++;
-                        m_FeaElementVec[j]->WriteCalculix( fp, elem_id );
-                    }
-                }
+                FilterElementTable( m_FeaElementVec, m_SSElementTable[i], FeaElement::FEA_TRI_6, false, elem_table );
+                WriteChunked( fp, (int)elem_table.size(), FeaElementFormatter( m_FeaElementVec, elem_table, FeaElementFormatter::CALCULIX, elem_id + 1 ) );
+                elem_id += (int)elem_table.size();
+
                 fprintf( fp, "\n" );
             }
 
@@ -2697,28 +3065,15 @@ void FeaMeshMgrSingleton::WriteCalculix()
                 fprintf( fp, "\n" );
                 fprintf( fp, "*ELEMENT, TYPE=B32, ELSET=E%s_CAP\n", m_SimpleSubSurfaceVec[i].GetName().c_str() );
 
-                for ( int j = 0; j < m_FeaElementVec.size(); j++ )
-                {
-                    if ( m_FeaElementVec[j]->GetFeaSSIndex() == i && m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_BEAM )
-                    {
-                        elem_id++;
-                        m_FeaElementVec[j]->WriteCalculix( fp, elem_id );
-                    }
-                }
+                FilterElementTable( m_FeaElementVec, m_SSElementTable[i], FeaElement::FEA_BEAM, false, elem_table );
+                WriteChunked( fp, (int)elem_table.size(), FeaElementFormatter( m_FeaElementVec, elem_table, FeaElementFormatter::CALCULIX, elem_id + 1 ) );
+                elem_id += (int)elem_table.size();
 
-                // Write Normal Vectors
+                // Write Normal Vectors, which refer to the element IDs just written
                 fprintf( fp, "\n" );
                 fprintf( fp, "*NORMAL\n" );
 
-                for ( int j = 0; j < m_FeaElementVec.size(); j++ )
-                {
-                    if ( m_FeaElementVec[j]->GetFeaSSIndex() == i && m_FeaElementVec[j]->GetElementType() == FeaElement::FEA_BEAM )
-                    {
-                        FeaBeam* beam = dynamic_cast<FeaBeam*>( m_FeaElementVec[j] );
-                        assert( beam );
-                        beam->WriteCalculixNormal( fp );
-                    }
-                }
+                WriteChunked( fp, (int)elem_table.size(), FeaElementFormatter( m_FeaElementVec, elem_table, FeaElementFormatter::CALCULIX_NORMAL, 0 ) );
 
                 fprintf( fp, "\n" );
             }
@@ -2728,28 +3083,15 @@ void FeaMeshMgrSingleton::WriteCalculix()
         fprintf( fp, "**Intersections\n" );
         fprintf( fp, "*NODE, NSET=Nintersections\n" );
 
-        for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
-        {
-            if ( m_PntShift[j] >= 0 )
-            {
-                if ( m_FeaNodeVec[j]->m_Tags.size() > 1 && !m_FeaNodeVec[j]->m_FixedPointFlag )
-                {
-                    m_FeaNodeVec[j]->WriteCalculix( fp );
-                }
-            }
-        }
+        WriteChunked( fp, (int)m_IntersectNodeTable.size(), FeaNodeFormatter( m_FeaNodeVec, m_IntersectNodeTable, FeaNodeFormatter::CALCULIX ) );
+
         fprintf( fp, "\n" );
 
         //==== Remaining Nodes ====//
         fprintf( fp, "**Remaining Nodes\n" );
         fprintf( fp, "*NODE, NSET=RemainingNodes\n" );
-        for ( int i = 0; i < (int)m_FeaNodeVec.size(); i++ )
-        {
-            if ( m_PntShift[i] >= 0 && m_FeaNodeVec[i]->m_Tags.size() == 0 )
-            {
-                m_FeaNodeVec[i]->WriteCalculix( fp );
-            }
-        }
+
+        WriteChunked( fp, (int)m_RemainingNodeTable.size(), FeaNodeFormatter( m_FeaNodeVec, m_RemainingNodeTable, FeaNodeFormatter::CALCULIX ) );
 
         //==== FeaProperties ====//
         for ( unsigned int i = 0; i < m_NumFeaParts; i++ )
@@ -2822,16 +3164,6 @@ void FeaMeshMgrSingleton::WriteGmsh()
         fprintf( fp, "2.2 0 %d\n", ( int )sizeof( double ) );
         fprintf( fp, "$EndMeshFormat\n" );
 
-        // Count FeaNodes
-        int node_count = 0;
-        for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
-        {
-            if ( m_PntShift[j] >= 0 )
-            {
-                node_count++;
-            }
-        }
-
         //==== Group and Name FeaParts ====//
         fprintf( fp, "$PhysicalNames\n" );
         fprintf( fp, "%u\n", m_NumFeaParts - m_NumFeaFixPoints );
@@ -2846,15 +3178,9 @@ void FeaMeshMgrSingleton::WriteGmsh()
 
         //==== Write Nodes ====//
         fprintf( fp, "$Nodes\n" );
-        fprintf( fp, "%u\n", node_count );
+        fprintf( fp, "%u\n", (unsigned int)m_UniqueNodeTable.size() );
 
-        for ( unsigned int j = 0; j < (int)m_FeaNodeVec.size(); j++ )
-        {
-            if ( m_PntShift[j] >= 0 )
-            {
-                m_FeaNodeVec[j]->WriteGmsh( fp );
-            }
-        }
+        WriteChunked( fp, (int)m_UniqueNodeTable.size(), FeaNodeFormatter( m_FeaNodeVec, m_UniqueNodeTable, FeaNodeFormatter::GMSH ) );
 
         fprintf( fp, "$EndNodes\n" );
 
@@ -2866,14 +3192,8 @@ void FeaMeshMgrSingleton::WriteGmsh()
 
         for ( unsigned int j = 0; j < m_NumFeaParts; j++ )
         {
-            for ( int i = 0; i < (int)m_FeaElementVec.size(); i++ )
-            {
-                if ( m_FeaElementVec[i]->GetFeaPartIndex() == j )
-                {
-                    m_FeaElementVec[i]->WriteGmsh( fp, ele_cnt, j + 1 );
-                    ele_cnt++;
-                }
-            }
+            WriteChunked( fp, (int)m_PartElementTable[j].size(), FeaElementFormatter( m_FeaElementVec, m_PartElementTable[j], FeaElementFormatter::GMSH, ele_cnt, j + 1 ) );
+            ele_cnt += (int)m_PartElementTable[j].size();
         }
 
         fprintf( fp, "$EndElements\n" );
@@ -3494,28 +3814,30 @@ void FeaMeshMgrSingleton::UpdateDisplaySettings()
     }
 }
 
-void FeaMeshMgrSingleton::WriteNASTRANSet( FILE* Nastran_fid, FILE* NKey_fid, int & set_num, vector < int > set_ids, const string &set_name )
+void FeaMeshMgrSingleton::WriteNASTRANSet( FILE* Nastran_fid, FILE* NKey_fid, int & set_num, const vector < int > & set_ids, const string &set_name )
 {
     if ( set_ids.size() > 0 && Nastran_fid )
     {
-        fprintf( Nastran_fid, "\nSET %d = ", set_num );
+        string buf;
+        AppendFormat( buf, "\nSET %d = ", set_num );
 
         for ( size_t i = 0; i < set_ids.size(); i++ )
         {
-            fprintf( Nastran_fid, "%d", set_ids[i] );
+            AppendFormat( buf, "%d", set_ids[i] );
 
             if ( i != set_ids.size() - 1 )
             {
-                fprintf( Nastran_fid, "," );
+                buf += ',';
 
                 if ( ( i + 1 ) % 9 == 0 ) // 9 IDs per line
                 {
-                    fprintf( Nastran_fid, "\n" );
+                    buf += '\n';
                 }
             }
         }
 
-        fprintf( Nastran_fid, "\n" );
+        buf += '\n';
+        fwrite( buf.data(), 1, buf.size(), Nastran_fid );
 
         if ( NKey_fid ) // Write to NASTRAN key file if defined
         {
@@ -3524,4 +3846,4 @@ void FeaMeshMgrSingleton::WriteNASTRANSet( FILE* Nastran_fid, FILE* NKey_fid, in
 
         set_num++; // Increment set identification number
     }
-}
\ No newline at end of file
+}
@@ -26,18 +26,22 @@ enum
 class FeaMeshMgrSingleton : public CfdMeshMgrSingleton
 {
 protected:
-    FeaMeshMgrSingleton();
     //FeaMeshMgrSingleton( FeaMeshMgrSingleton const& copy );          // Not Implemented
     //FeaMeshMgrSingleton& operator=( FeaMeshMgrSingleton const& copy ); // Not Implemented
 
 public:
 
+    // The shared instance backs the GUI and API, others may be made to mesh structures concurrently
+    FeaMeshMgrSingleton();
+
     static FeaMeshMgrSingleton& getInstance()
     {
         static FeaMeshMgrSingleton instance;
         return instance;
     }
 
+    static void GenerateFeaMeshes( const vector < int > & struct_index_vec );
+
     virtual ~FeaMeshMgrSingleton();
     virtual void CleanUp();
 
@@ -60,6 +64,8 @@ public:
     virtual void LoadSkins();
     virtual void GenerateFeaMesh();
     virtual void ExportFeaMesh();
+    Results* WriteMeshStageResults() override;
+    size_t MemoryUsage() const override;
     virtual void TransferMeshSettings();
     virtual void IdentifyCompIDNames();
     virtual void TransferFeaData();
@@ -93,6 +99,15 @@ public:
         return m_TotalMass;
     }
 
+    //==== Chunked Element Access - Elements [start, start + num), Nodes Are Corners Then Mids ====//
+    virtual int GetNumFeaElements()
+    {
+        return ( int )m_FeaElementVec.size();
+    }
+    virtual vector< int > GetFeaElementNumNodes( int start, int num );
+    virtual vector< int > GetFeaElementNodeChunk( int start, int num );
+    virtual vector< vec3d > GetFeaElementPntChunk( int start, int num );
+
     virtual void SetFeaMeshStructIndex( int index )
     {
         m_FeaMeshStructIndex = index;
@@ -156,11 +171,16 @@ public:
 protected:
 
     virtual void GetMassUnit();
+    virtual bool HasMeshExport();
 
-    virtual void WriteNASTRANSet( FILE* Nastran_fid, FILE* NKey_fid, int & set_num, vector < int > set_ids, const string &set_name );
+    void EndMeshRun() override;
+
+    virtual void BuildExportTables();
+    virtual void WriteNASTRANSet( FILE* Nastran_fid, FILE* NKey_fid, int & set_num, const vector < int > & set_ids, const string &set_name );
 
     bool m_FeaMeshInProgress;
     bool m_CADOnlyFlag; // Indicates that ne meshing should be performed, but the surfaces are still exported
+    bool m_ConcurrentFlag; // Indicates other instances are meshing at the same time, so the Vehicle is left untouched
 
     double m_TotalMass;
     string m_MassUnit;
@@ -206,6 +226,15 @@ protected:
     map< int, vector< int > > m_IndMap;
     vector< int > m_PntShift;
 
+    // Export tables of m_FeaNodeVec and m_FeaElementVec indexes, built once per export
+    vector < vector < int > > m_PartNodeTable; // Unique nodes written with each FeaPart
+    vector < vector < int > > m_SSNodeTable; // Unique nodes written with each FeaSubSurface
+    vector < int > m_IntersectNodeTable; // Unique nodes shared by more than one FeaPart or FeaSubSurface
+    vector < int > m_RemainingNodeTable; // Unique nodes without tags
+    vector < int > m_UniqueNodeTable; // All unique nodes
+    vector < vector < int > > m_PartElementTable; // Elements of each FeaPart, including those on FeaSubSurfaces
+    vector < vector < int > > m_SSElementTable; // Elements of each FeaSubSurface
+
     SimpleFeaMeshSettings m_StructSettings;
     SimpleGridDensity m_FeaGridDensity;
 
@@ -1087,15 +1087,25 @@ vector< ISegChain* > ISegChain::FindCoPlanarChains( Surf* sPtr, Surf* adjSurf, S
 {
     vector< ISegChain* > new_chains;
 
+    //==== Project All Points, A Local Solve From The Mid UW Can Miss Far Patches ====//
+    vector< vec3d > pnt_vec( m_TessVec.size() );
+    for ( int i = 0 ; i < ( int )m_TessVec.size() ; i++ )
+    {
+        pnt_vec[i] = m_TessVec[i]->m_Pnt;
+    }
+
+    vector< vec2d > guess_vec( m_TessVec.size(), vec2d( sPtr->GetSurfCore()->GetMidU(), sPtr->GetSurfCore()->GetMidW() ) );
+    vector< vec2d > uw_vec;
+    sPtr->ClosestUW( pnt_vec, guess_vec, uw_vec );
+
     vector< IPnt* > ipnt_vec;
     for ( int i = 0 ; i < ( int )m_TessVec.size() ; i++ )
     {
-        IPnt* ip = m_TessVec[i];
-        vec3d p = ip->m_Pnt;
+        vec3d p = pnt_vec[i];
 
         //==== See if Point Is On Surface ====//
         double tol = 1.0e-04;
-        vec2d uw = sPtr->ClosestUW( p, sPtr->GetSurfCore()->GetMidU(), sPtr->GetSurfCore()->GetMidW() );
+        vec2d uw = uw_vec[i];
 
         vec3d sp = sPtr->CompPnt( uw[0], uw[1] );
 
@@ -14,7 +14,7 @@
 
 #include "eli/geom/intersect/intersect_surface.hpp"
 
-void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionSingleton *MeshMgr )
+void intersect( const SurfPatch& bp1, const SurfPatch& bp2, vector< PatchIntersectSeg > & seg_vec )
 {
     int MAX_SUB = 12;
     int MIN_SUB = 3;
@@ -43,7 +43,7 @@ void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionS
     if ( ( planar1 || bp1.GetSubDepth() > MAX_SUB ) &&
          ( planar2 || bp2.GetSubDepth() > MAX_SUB ) )
     {
-        intersect_quads( bp1, bp2, MeshMgr );          // Plane - Plane Intersection
+        intersect_quads( bp1, bp2, seg_vec );          // Plane - Plane Intersection
     }
     else
     {
@@ -60,6 +60,17 @@ void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionS
 
         if ( ref1 )
         {
+            const SurfPatch* const * sub = bp1.get_cached_split();
+
+            if ( sub )
+            {
+                for ( int i = 0 ; i < 4 ; i++ )
+                {
+                    intersect( *sub[i], bp2, seg_vec );
+                }
+                return;
+            }
+
             int n = bp1.degree_u();
             int m = bp1.degree_v();
             int d = bp1.GetSubDepth() + 1;
@@ -71,13 +82,24 @@ void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionS
 
             bp1.split_patch( bps0, bps1, bps2, bps3 );      // Split Patch1 and Keep Subdividing
 
-            intersect( bps0, bp2, MeshMgr );
-            intersect( bps1, bp2, MeshMgr );
-            intersect( bps2, bp2, MeshMgr );
-            intersect( bps3, bp2, MeshMgr );
+            intersect( bps0, bp2, seg_vec );
+            intersect( bps1, bp2, seg_vec );
+            intersect( bps2, bp2, seg_vec );
+            intersect( bps3, bp2, seg_vec );
         }
         else
         {
+            const SurfPatch* const * sub = bp2.get_cached_split();
+
+            if ( sub )
+            {
+                for ( int i = 0 ; i < 4 ; i++ )
+                {
+                    intersect( bp1, *sub[i], seg_vec );
+                }
+                return;
+            }
+
             int n = bp2.degree_u();
             int m = bp2.degree_v();
             int d = bp2.GetSubDepth() + 1;
@@ -89,15 +111,15 @@ void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionS
 
             bp2.split_patch( bps0, bps1, bps2, bps3 );      // Split Patch2 and Keep Subdividing
 
-            intersect( bp1, bps0, MeshMgr );
-            intersect( bp1, bps1, MeshMgr );
-            intersect( bp1, bps2, MeshMgr );
-            intersect( bp1, bps3, MeshMgr );
+            intersect( bp1, bps0, seg_vec );
+            intersect( bp1, bps1, seg_vec );
+            intersect( bp1, bps2, seg_vec );
+            intersect( bp1, bps3, seg_vec );
         }
     }
 }
 
-void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, SurfaceIntersectionSingleton *MeshMgr )
+void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, vector< PatchIntersectSeg > & seg_vec )
 {
     int iflag;
     int coplanar;
@@ -120,28 +142,28 @@ void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, SurfaceIntersect
     iflag = tri_tri_intersect_with_isectline( a0.v, a2.v, a3.v, b0.v, b2.v, b3.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        MeshMgr->AddIntersectionSeg( pa, pb, ip0, ip1 );
+        SurfaceIntersectionSingleton::FindIntersectionSeg( pa, pb, ip0, ip1, seg_vec );
     }
 
     //==== Tri A1 and B2 ====//
     iflag = tri_tri_intersect_with_isectline( a0.v, a2.v, a3.v, b0.v, b1.v, b2.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        MeshMgr->AddIntersectionSeg( pa, pb, ip0, ip1 );
+        SurfaceIntersectionSingleton::FindIntersectionSeg( pa, pb, ip0, ip1, seg_vec );
     }
 
     //==== Tri A2 and B1 ====//
     iflag = tri_tri_intersect_with_isectline( a0.v, a1.v, a2.v, b0.v, b2.v, b3.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        MeshMgr->AddIntersectionSeg( pa, pb,  ip0, ip1 );
+        SurfaceIntersectionSingleton::FindIntersectionSeg( pa, pb, ip0, ip1, seg_vec );
     }
 
     //==== Tri A2 and B2 ====//
     iflag = tri_tri_intersect_with_isectline( a0.v, a1.v, a2.v, b0.v, b1.v, b2.v, &coplanar, ip0.v, ip1.v );
     if ( iflag && !coplanar )
     {
-        MeshMgr->AddIntersectionSeg( pa, pb, ip0, ip1 );
+        SurfaceIntersectionSingleton::FindIntersectionSeg( pa, pb, ip0, ip1, seg_vec );
     }
 }
 
@@ -28,8 +28,8 @@ class SurfaceIntersectionSingleton;
 class CfdMeshMgrSingleton;
 
 //===== Intersect Two Bezier Patches  =====//
-void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionSingleton *MeshMgr );
-void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, SurfaceIntersectionSingleton *MeshMgr );
+void intersect( const SurfPatch& bp1, const SurfPatch& bp2, vector< PatchIntersectSeg > & seg_vec );
+void intersect_quads( const SurfPatch& pa, const SurfPatch& pb, vector< PatchIntersectSeg > & seg_vec );
 void refine_intersect_pt( const vec3d& pt, const SurfPatch &pA, double uwA[2], const SurfPatch &pB, double uwB[2] );
 double refine_intersect_pt( const vec3d& pt, Surf *sA, vec2d &uwA, Surf *sB, vec2d &uwB );
 
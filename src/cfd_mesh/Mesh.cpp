@@ -13,6 +13,8 @@
 #include "triangle.h"
 #include "CfdMeshMgr.h"
 #include "Util.h"
+#include "StlHelper.h"
+#include "TMesh.h"
 
 
 bool LongEdgePairLengthCompare( const pair< Edge*, double >& a, const pair< Edge*, double >& b )
@@ -49,10 +51,12 @@ Mesh::~Mesh()
 
 void Mesh::Clear()
 {
+    DumpGarbage();
+
     list< Tri* >::iterator t;
     for ( t = triList.begin() ; t != triList.end(); ++t )
     {
-        delete ( *t );
+        m_TriPool.Free( *t );
     }
 
     triList.clear();
@@ -60,7 +64,7 @@ void Mesh::Clear()
     list< Edge* >::iterator e;
     for ( e = edgeList.begin() ; e != edgeList.end(); ++e )
     {
-        delete ( *e );
+        m_EdgePool.Free( *e );
     }
 
     edgeList.clear();
@@ -68,11 +72,16 @@ void Mesh::Clear()
     list< Node* >::iterator n;
     for ( n = nodeList.begin() ; n != nodeList.end(); ++n )
     {
-        delete ( *n );
+        m_NodePool.Free( *n );
     }
 
     nodeList.clear();
 
+    //==== Nothing Left Alive - Give the Blocks Back ====//
+    m_TriPool.Release();
+    m_EdgePool.Release();
+    m_NodePool.Release();
+
     m_NumFixPointIter = 0;
 }
 
@@ -291,6 +300,126 @@ void Mesh::CondenseSimpTris()
     }
 }
 
+bool Mesh::WriteSimpData( FILE* fp ) const
+{
+    int num_pnts = ( int )simpPntVec.size();
+    int num_uws = ( int )simpUWPntVec.size();
+    int num_tris = ( int )simpTriVec.size();
+
+    vector< double > dbuf;
+    dbuf.reserve( 3 * num_pnts + 2 * num_uws );
+    for ( int i = 0 ; i < num_pnts ; i++ )
+    {
+        dbuf.push_back( simpPntVec[i].x() );
+        dbuf.push_back( simpPntVec[i].y() );
+        dbuf.push_back( simpPntVec[i].z() );
+    }
+    for ( int i = 0 ; i < num_uws ; i++ )
+    {
+        dbuf.push_back( simpUWPntVec[i].x() );
+        dbuf.push_back( simpUWPntVec[i].y() );
+    }
+
+    // Three indices and a tag count, then the tags
+    vector< int > ibuf;
+    ibuf.reserve( 5 * num_tris );
+    for ( int t = 0 ; t < num_tris ; t++ )
+    {
+        const SimpTri & tri = simpTriVec[t];
+        ibuf.push_back( tri.ind0 );
+        ibuf.push_back( tri.ind1 );
+        ibuf.push_back( tri.ind2 );
+        ibuf.push_back( ( int )tri.m_Tags.size() );
+        ibuf.insert( ibuf.end(), tri.m_Tags.begin(), tri.m_Tags.end() );
+    }
+    int num_ints = ( int )ibuf.size();
+
+    int head[4] = { num_pnts, num_uws, num_tris, num_ints };
+    if ( fwrite( head, sizeof( int ), 4, fp ) != 4 )
+    {
+        return false;
+    }
+    if ( !dbuf.empty() && fwrite( &dbuf[0], sizeof( double ), dbuf.size(), fp ) != dbuf.size() )
+    {
+        return false;
+    }
+    if ( !ibuf.empty() && fwrite( &ibuf[0], sizeof( int ), ibuf.size(), fp ) != ibuf.size() )
+    {
+        return false;
+    }
+    return true;
+}
+
+bool Mesh::ReadSimpData( FILE* fp )
+{
+    int head[4];
+    if ( fread( head, sizeof( int ), 4, fp ) != 4 )
+    {
+        return false;
+    }
+    int num_pnts = head[0];
+    int num_uws = head[1];
+    int num_tris = head[2];
+    int num_ints = head[3];
+
+    vector< double > dbuf( 3 * num_pnts + 2 * num_uws );
+    vector< int > ibuf( num_ints );
+    if ( !dbuf.empty() && fread( &dbuf[0], sizeof( double ), dbuf.size(), fp ) != dbuf.size() )
+    {
+        return false;
+    }
+    if ( !ibuf.empty() && fread( &ibuf[0], sizeof( int ), ibuf.size(), fp ) != ibuf.size() )
+    {
+        return false;
+    }
+
+    int d = 0;
+    simpPntVec.resize( num_pnts );
+    for ( int i = 0 ; i < num_pnts ; i++, d += 3 )
+    {
+        simpPntVec[i].set_xyz( dbuf[d], dbuf[d + 1], dbuf[d + 2] );
+    }
+    simpUWPntVec.resize( num_uws );
+    for ( int i = 0 ; i < num_uws ; i++, d += 2 )
+    {
+        simpUWPntVec[i].set_xy( dbuf[d], dbuf[d + 1] );
+    }
+
+    int k = 0;
+    simpTriVec.resize( num_tris );
+    for ( int t = 0 ; t < num_tris ; t++ )
+    {
+        SimpTri & tri = simpTriVec[t];
+        tri.ind0 = ibuf[k++];
+        tri.ind1 = ibuf[k++];
+        tri.ind2 = ibuf[k++];
+        int num_tags = ibuf[k++];
+        tri.m_Tags.assign( ibuf.begin() + k, ibuf.begin() + k + num_tags );
+        k += num_tags;
+    }
+    return true;
+}
+
+void Mesh::ClearSimpData()
+{
+    // Swap with empties so the capacity is released too
+    vector< vec3d >().swap( simpPntVec );
+    vector< vec2d >().swap( simpUWPntVec );
+    vector< SimpTri >().swap( simpTriVec );
+}
+
+size_t Mesh::MemoryUsage() const
+{
+    // Each list node holds two links besides its pointer
+    size_t list_node = 3 * sizeof( void* );
+
+    size_t bytes = m_TriPool.MemoryUsage() + m_EdgePool.MemoryUsage() + m_NodePool.MemoryUsage();
+    bytes += ( triList.size() + edgeList.size() + nodeList.size() ) * list_node;
+    bytes += vector_mem_bytes( garbageTriVec ) + vector_mem_bytes( garbageEdgeVec ) + vector_mem_bytes( garbageNodeVec );
+    bytes += vector_mem_bytes( simpPntVec ) + vector_mem_bytes( simpUWPntVec ) + vector_mem_bytes( simpTriVec );
+    return bytes;
+}
+
 void Mesh::StretchSimpPnts( double start_x, double end_x, double scale, double angle )
 {
     double factor = scale - 1.0;
@@ -517,7 +646,7 @@ void Mesh::ColorTris()
 
 Node* Mesh::AddNode( vec3d p, vec2d uw_in )
 {
-    Node* nptr = new Node( p, uw_in );
+    Node* nptr = new ( m_NodePool.Alloc() ) Node( p, uw_in );
     nodeList.push_back( nptr );
     nptr->list_ptr = --nodeList.end();
     return nptr;
@@ -546,7 +675,7 @@ Node* Mesh::FindNode( const vec3d& p )
 
 Edge* Mesh::AddEdge( Node* n0, Node* n1 )
 {
-    Edge* eptr = new Edge( n0, n1 );
+    Edge* eptr = new ( m_EdgePool.Alloc() ) Edge( n0, n1 );
 
     edgeList.push_back( eptr );
     eptr->list_ptr = --edgeList.end();
@@ -572,18 +701,15 @@ void Mesh::RemoveEdge( Edge* eptr )
 
 Edge* Mesh::FindEdge( Node* n0, Node* n1 )
 {
-    list< Edge* >::iterator e;
-    for ( e = edgeList.begin() ; e != edgeList.end(); ++e )
+    //==== Only The Edges Around n0 Can Match ====//
+    for ( int i = 0 ; i < ( int )n0->edgeVec.size() ; i++ )
     {
-        if ( !( *e )->m_DeleteMeFlag )
+        Edge* e = n0->edgeVec[i];
+        if ( !e->m_DeleteMeFlag )
         {
-            if ( ( *e )->n0 == n0 && ( *e )->n1 == n1 )
-            {
-                return ( *e );
-            }
-            if ( ( *e )->n0 == n1 && ( *e )->n1 == n0 )
+            if ( ( e->n0 == n0 && e->n1 == n1 ) || ( e->n0 == n1 && e->n1 == n0 ) )
             {
-                return ( *e );
+                return e;
             }
         }
     }
@@ -592,7 +718,7 @@ Edge* Mesh::FindEdge( Node* n0, Node* n1 )
 
 Tri* Mesh::AddTri( Node* n0, Node* n1, Node* n2, Edge* e0, Edge* e1, Edge* e2 )
 {
-    Tri* tptr = new Tri( n0, n1, n2, e0, e1, e2 );
+    Tri* tptr = new ( m_TriPool.Alloc() ) Tri( n0, n1, n2, e0, e1, e2 );
     triList.push_back( tptr );
     tptr->list_ptr = --triList.end();
     return tptr;
@@ -610,21 +736,21 @@ void Mesh::DumpGarbage()
     //==== Delete Flagged Nodes =====//
     for ( int i = 0 ; i < ( int )garbageNodeVec.size() ; i++ )
     {
-        delete garbageNodeVec[i];
+        m_NodePool.Free( garbageNodeVec[i] );
     }
     garbageNodeVec.clear();
 
     //==== Delete Flagged Edges =====//
     for ( int i = 0 ; i < ( int )garbageEdgeVec.size() ; i++ )
     {
-        delete garbageEdgeVec[i];
+        m_EdgePool.Free( garbageEdgeVec[i] );
     }
     garbageEdgeVec.clear();
 
     //==== Delete Flagged Tris =====//
     for ( int i = 0 ; i < ( int )garbageTriVec.size() ; i++ )
     {
-        delete garbageTriVec[i];
+        m_TriPool.Free( garbageTriVec[i] );
     }
     garbageTriVec.clear();
 }
@@ -1264,23 +1390,120 @@ void Mesh::CollapseEdge( Edge* edge )
 
 }
 
+//==== Split Nodes Into Sets Where No Two Nodes of a Set Share an Edge ====//
+// Greedy coloring in node list order.  A node only reads its one ring when it is
+// smoothed, so all nodes of a set can move at the same time.  Node ids are set
+// to the node list index.
+void Mesh::ColorNodes( vector< vector< Node* > > & set_vec )
+{
+    set_vec.clear();
+
+    vector< Node* > node_vec( nodeList.begin(), nodeList.end() );
+    int num_node = ( int )node_vec.size();
+    for ( int i = 0 ; i < num_node ; i++ )
+    {
+        node_vec[i]->id = i;
+    }
+
+    vector< int > color_vec( num_node, -1 );
+    vector< char > used_vec;
+    for ( int i = 0 ; i < num_node ; i++ )
+    {
+        Node* n = node_vec[i];
+
+        used_vec.assign( set_vec.size() + 1, 0 );
+        for ( int j = 0 ; j < ( int )n->edgeVec.size() ; j++ )
+        {
+            Node* other = n->edgeVec[j]->OtherNode( n );
+            if ( other && other->id >= 0 && other->id < num_node && node_vec[other->id] == other &&
+                 color_vec[other->id] >= 0 )
+            {
+                used_vec[ color_vec[other->id] ] = 1;
+            }
+        }
+
+        int c = 0;
+        while ( used_vec[c] )
+        {
+            c++;
+        }
+
+        color_vec[i] = c;
+        if ( c == ( int )set_vec.size() )
+        {
+            set_vec.push_back( vector< Node* >() );
+        }
+        set_vec[c].push_back( n );
+    }
+}
+
+//==== Split Edges Into Sets Where No Two Edges of a Set Share a Node ====//
+void Mesh::ColorEdges( vector< vector< Edge* > > & set_vec )
+{
+    set_vec.clear();
+
+    // Colors already taken by the edges of each node
+    map< Node*, vector< int > > node_color_map;
+
+    list< Edge* >::iterator e;
+    vector< char > used_vec;
+    for ( e = edgeList.begin() ; e != edgeList.end(); ++e )
+    {
+        vector< int > & c0_vec = node_color_map[ ( *e )->n0 ];
+        vector< int > & c1_vec = node_color_map[ ( *e )->n1 ];
+
+        used_vec.assign( set_vec.size() + 1, 0 );
+        for ( int j = 0 ; j < ( int )c0_vec.size() ; j++ )
+        {
+            used_vec[ c0_vec[j] ] = 1;
+        }
+        for ( int j = 0 ; j < ( int )c1_vec.size() ; j++ )
+        {
+            used_vec[ c1_vec[j] ] = 1;
+        }
+
+        int c = 0;
+        while ( used_vec[c] )
+        {
+            c++;
+        }
+
+        c0_vec.push_back( c );
+        c1_vec.push_back( c );
+        if ( c == ( int )set_vec.size() )
+        {
+            set_vec.push_back( vector< Edge* >() );
+        }
+        set_vec[c].push_back( *e );
+    }
+}
+
 void Mesh::LaplacianSmooth( int num_iter )
 {
+    vector< vector< Node* > > set_vec;
+    ColorNodes( set_vec );
+
     for ( int i = 0 ; i < num_iter ; i++ )
     {
-        list< Node* >::iterator n;
-        for ( n = nodeList.begin() ; n != nodeList.end(); ++n )
+        for ( int c = 0 ; c < ( int )set_vec.size() ; c++ )
         {
-            if ( !( *n )->m_DeleteMeFlag && !( *n )->fixed )
+            vector< Node* > & node_set = set_vec[c];
+
+            #pragma omp parallel for schedule( dynamic )
+            for ( int j = 0 ; j < ( int )node_set.size() ; j++ )
             {
-                ////(*n)->LaplacianSmoothUW();
-                ////(*n)->pnt = m_Surf->CompPnt((*n)->uw.x(), (*n)->uw.y());
-                //(*n)->LaplacianSmooth();
-                //vec2d uw = m_Surf->ClosestUW( (*n)->pnt, (*n)->uw.x(), (*n)->uw.y(), 0.001, 0.001 );
-                //(*n)->pnt = m_Surf->CompPnt( uw.x(), uw.y());
-                //(*n)->uw = uw;
-//              (*n)->LaplacianSmooth( m_Surf );
-                ( *n )->AreaWeightedLaplacianSmooth( m_Surf );
+                Node* n = node_set[j];
+                if ( !n->m_DeleteMeFlag && !n->fixed )
+                {
+                    ////n->LaplacianSmoothUW();
+                    ////n->pnt = m_Surf->CompPnt(n->uw.x(), n->uw.y());
+                    //n->LaplacianSmooth();
+                    //vec2d uw = m_Surf->ClosestUW( n->pnt, n->uw.x(), n->uw.y(), 0.001, 0.001 );
+                    //n->pnt = m_Surf->CompPnt( uw.x(), uw.y());
+                    //n->uw = uw;
+//                  n->LaplacianSmooth( m_Surf );
+                    n->AreaWeightedLaplacianSmooth( m_Surf );
+                }
             }
         }
     }
@@ -1288,14 +1511,23 @@ void Mesh::LaplacianSmooth( int num_iter )
 
 void Mesh::OptSmooth( int num_iter )
 {
+    vector< vector< Node* > > set_vec;
+    ColorNodes( set_vec );
+
     for ( int i = 0 ; i < num_iter ; i++ )
     {
-        list< Node* >::iterator n;
-        for ( n = nodeList.begin() ; n != nodeList.end(); ++n )
+        for ( int c = 0 ; c < ( int )set_vec.size() ; c++ )
         {
-            if ( !( *n )->m_DeleteMeFlag && !( *n )->fixed )
+            vector< Node* > & node_set = set_vec[c];
+
+            #pragma omp parallel for schedule( dynamic )
+            for ( int j = 0 ; j < ( int )node_set.size() ; j++ )
             {
-                ( *n )->OptSmooth();
+                Node* n = node_set[j];
+                if ( !n->m_DeleteMeFlag && !n->fixed )
+                {
+                    n->OptSmooth();
+                }
             }
         }
     }
@@ -1390,18 +1622,28 @@ void Mesh::AdjustEdgeLengths()
 
     avg_length /= ( double )edgeList.size();
 
-    for ( e = edgeList.begin() ; e != edgeList.end(); ++e )
+    //==== Edges of a Set Share No Nodes and Can Be Adjusted Together ====//
+    vector< vector< Edge* > > set_vec;
+    ColorEdges( set_vec );
+
+    for ( int c = 0 ; c < ( int )set_vec.size() ; c++ )
     {
-        if ( !( *e )->n0->fixed && !( *e )->n1->fixed )
+        vector< Edge* > & edge_set = set_vec[c];
+
+        #pragma omp parallel for
+        for ( int j = 0 ; j < ( int )edge_set.size() ; j++ )
         {
-            vec3d  dir = ( *e )->n0->pnt - ( *e )->n1->pnt;
-            double len = dir.mag();
-            double scale = 1.0 + 0.25 * ( ( avg_length / len ) - 1.0 );
+            Edge* e = edge_set[j];
+            if ( !e->n0->fixed && !e->n1->fixed )
+            {
+                vec3d  dir = e->n0->pnt - e->n1->pnt;
+                double len = dir.mag();
+                double scale = 1.0 + 0.25 * ( ( avg_length / len ) - 1.0 );
 
-            ( *e )->n0->pnt = ( *e )->n1->pnt + dir * scale;
-            ( *e )->n1->pnt = ( *e )->n0->pnt - dir * scale;
+                e->n0->pnt = e->n1->pnt + dir * scale;
+                e->n1->pnt = e->n0->pnt - dir * scale;
+            }
         }
-
     }
 }
 
@@ -2134,27 +2376,20 @@ void Mesh::WriteSTL( const char* file_name )
 
 void Mesh::WriteSTL( FILE* file_id )
 {
+    vector< vec3d > pnt_vec;
+    LoadSTLTris( pnt_vec );
+    WriteSTLFacets( file_id, pnt_vec );
+}
+
+void Mesh::LoadSTLTris( vector< vec3d > & pnt_vec )
+{
+    pnt_vec.reserve( pnt_vec.size() + 3 * simpTriVec.size() );
     for ( int i = 0 ; i < ( int )simpTriVec.size() ; i++ )
     {
         SimpTri* t = &simpTriVec[i];
-
-        vec3d& p0 = simpPntVec[t->ind0];
-        vec3d& p1 = simpPntVec[t->ind1];
-        vec3d& p2 = simpPntVec[t->ind2];
-        vec3d v10 = p1 - p0;
-        vec3d v20 = p2 - p1;
-        vec3d norm = cross( v10, v20 );
-        norm.normalize();
-
-        fprintf( file_id, " facet normal  %2.10le %2.10le %2.10le\n",  norm.x(), norm.y(), norm.z() );
-        fprintf( file_id, "   outer loop\n" );
-
-        fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p0.x(), p0.y(), p0.z() );
-        fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p1.x(), p1.y(), p1.z() );
-        fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p2.x(), p2.y(), p2.z() );
-
-        fprintf( file_id, "   endloop\n" );
-        fprintf( file_id, " endfacet\n" );
+        pnt_vec.push_back( simpPntVec[t->ind0] );
+        pnt_vec.push_back( simpPntVec[t->ind1] );
+        pnt_vec.push_back( simpPntVec[t->ind2] );
     }
 }
 
@@ -2271,3 +2506,112 @@ void Mesh::Draw()
 
 
 
+
+//////////////////////////////////////////////////////////////////////
+//==== 64 Bit File Offsets, Stores Pass 2 GB on Large Meshes ====//
+static long long StoreTell( FILE* fp )
+{
+#ifdef _MSC_VER
+    return _ftelli64( fp );
+#else
+    return ( long long )ftello( fp );
+#endif
+}
+
+static bool StoreSeek( FILE* fp, long long offset, int origin )
+{
+#ifdef _MSC_VER
+    return _fseeki64( fp, offset, origin ) == 0;
+#else
+    return fseeko( fp, ( off_t )offset, origin ) == 0;
+#endif
+}
+
+SimpMeshStore::SimpMeshStore()
+{
+    m_File = NULL;
+    m_NumStored = 0;
+}
+
+SimpMeshStore::~SimpMeshStore()
+{
+    Clear();
+}
+
+void SimpMeshStore::Clear()
+{
+    // tmpfile is removed when closed
+    if ( m_File )
+    {
+        fclose( m_File );
+        m_File = NULL;
+    }
+    m_NumStored = 0;
+    m_OffsetVec.clear();
+    m_NumTriVec.clear();
+}
+
+bool SimpMeshStore::Store( int id, Mesh* mesh )
+{
+    if ( id < 0 || !mesh )
+    {
+        return false;
+    }
+
+    bool ok = false;
+
+    // One file for every surface - writes from the remesh threads take turns
+    #pragma omp critical ( SimpMeshStore )
+    {
+        if ( !m_File )
+        {
+            m_File = std::tmpfile();
+        }
+
+        if ( m_File && StoreSeek( m_File, 0, SEEK_END ) )
+        {
+            long long offset = StoreTell( m_File );
+            if ( offset >= 0 && mesh->WriteSimpData( m_File ) )
+            {
+                if ( id >= ( int )m_OffsetVec.size() )
+                {
+                    m_OffsetVec.resize( id + 1, -1 );
+                    m_NumTriVec.resize( id + 1, 0 );
+                }
+                if ( m_OffsetVec[id] < 0 )
+                {
+                    m_NumStored++;
+                }
+                m_OffsetVec[id] = offset;
+                m_NumTriVec[id] = ( int )mesh->GetSimpTriVec().size();
+                ok = true;
+            }
+        }
+    }
+
+    // Left in memory when the store can't take it
+    if ( ok )
+    {
+        mesh->ClearSimpData();
+    }
+    return ok;
+}
+
+bool SimpMeshStore::Load( int id, Mesh* mesh ) const
+{
+    if ( !IsStored( id ) || !mesh || !m_File )
+    {
+        return false;
+    }
+
+    bool ok = false;
+
+    #pragma omp critical ( SimpMeshStore )
+    {
+        if ( StoreSeek( m_File, m_OffsetVec[id], SEEK_SET ) )
+        {
+            ok = mesh->ReadSimpData( m_File );
+        }
+    }
+    return ok;
+}
@@ -26,8 +26,10 @@ class SimpleGridDensity;
 
 #include <cassert>
 
+#include <cstdio>
 #include <vector>
 #include <list>
+#include <new>
 using namespace std;
 
 extern "C"
@@ -42,6 +44,75 @@ public:
     int m_Index[2];
 };
 
+//////////////////////////////////////////////////////////////////////
+//==== Block Allocator With Free List Reuse for Mesh Nodes, Edges and Tris ====//
+template < class T >
+class MeshPool
+{
+public:
+
+    MeshPool()
+    {
+    }
+    ~MeshPool()
+    {
+        Release();
+    }
+
+    //==== Raw Storage for One T - Construct With Placement New ====//
+    void* Alloc()
+    {
+        if ( m_FreeVec.empty() )
+        {
+            char* block = new char[ BLOCK_SIZE * sizeof( T ) ];
+            m_BlockVec.push_back( block );
+
+            // Reversed so slots are handed out in address order
+            for ( int i = BLOCK_SIZE - 1 ; i >= 0 ; i-- )
+            {
+                m_FreeVec.push_back( block + i * sizeof( T ) );
+            }
+        }
+
+        void* ptr = m_FreeVec.back();
+        m_FreeVec.pop_back();
+        return ptr;
+    }
+
+    void Free( T* ptr )
+    {
+        ptr->~T();
+        m_FreeVec.push_back( ptr );
+    }
+
+    size_t MemoryUsage() const
+    {
+        return m_BlockVec.size() * BLOCK_SIZE * sizeof( T ) + m_FreeVec.capacity() * sizeof( void* );
+    }
+
+    //==== Return All Blocks - Only Once Every T Has Been Freed ====//
+    void Release()
+    {
+        for ( int i = 0 ; i < ( int )m_BlockVec.size() ; i++ )
+        {
+            delete [] m_BlockVec[i];
+        }
+        m_BlockVec.clear();
+        m_FreeVec.clear();
+    }
+
+private:
+
+    enum { BLOCK_SIZE = 1024 };
+
+    // Blocks are owned, do not copy
+    MeshPool( const MeshPool & );
+    MeshPool & operator=( const MeshPool & );
+
+    vector< char* > m_BlockVec;
+    vector< void* > m_FreeVec;
+};
+
 //////////////////////////////////////////////////////////////////////
 class Mesh
 {
@@ -57,6 +128,12 @@ public:
     void Remesh();
     void LoadSimpTris();
     void CondenseSimpTris();
+
+    //==== Simp Pnts, UWs and Tris as a Flat Binary Record ====//
+    bool WriteSimpData( FILE* fp ) const;
+    bool ReadSimpData( FILE* fp );
+    void ClearSimpData();                   // Releases the simp vectors' memory
+    size_t MemoryUsage() const;             // Approximate bytes held by the pools, lists and simp vectors
     static int CheckDupOrAdd( int ind, map< int, vector< int > > & indMap, vector< vec3d > & pntVec );
 
 
@@ -82,8 +159,11 @@ public:
 
     void SetNodeFlags();
 
+    // Smoothing moves one independent set of nodes at a time, each set in parallel
     void LaplacianSmooth( int num_iter );
     void OptSmooth( int num_iter );
+    void ColorNodes( vector< vector< Node* > > & set_vec );
+    void ColorEdges( vector< vector< Edge* > > & set_vec );
 
     bool SetFixPoint( const vec3d &fix_pnt, vec2d fix_uw );
 
@@ -117,6 +197,7 @@ public:
     void ReadSTL( const char* file_name );
     void WriteSTL( const char* file_name );
     void WriteSTL( FILE* fp );
+    void LoadSTLTris( vector< vec3d > & pnt_vec );          // Three vertices per simp tri
 
     void SetSurfPtr( Surf* sptr )
     {
@@ -144,6 +225,10 @@ public:
     {
         return triList;
     }
+    void LoadTriVec( vector< Tri* > & tri_vec ) const         // Tri pointers for indexed loops
+    {
+        tri_vec.assign( triList.begin(), triList.end() );
+    }
 
     vector < vec3d >& GetSimpPntVec()
     {
@@ -184,6 +269,10 @@ protected:
     vector< Edge* > garbageEdgeVec;
     vector< Node* > garbageNodeVec;
 
+    MeshPool< Tri > m_TriPool;
+    MeshPool< Edge > m_EdgePool;
+    MeshPool< Node > m_NodePool;
+
     int m_HighlightNodeIndex;
     int m_HighlightEdgeIndex;
 
@@ -194,5 +283,45 @@ protected:
     int m_NumFixPointIter;
 };
 
+//////////////////////////////////////////////////////////////////////
+//==== Temporary File of Finished Simp Meshes, So Their Memory Can Be Released ====//
+class SimpMeshStore
+{
+public:
+
+    SimpMeshStore();
+    ~SimpMeshStore();
+
+    void Clear();                                   // Closes and removes the file
+
+    bool Store( int id, Mesh* mesh );               // Appends the mesh's simp data, then releases it
+    bool Load( int id, Mesh* mesh ) const;          // Reads the simp data back in to the mesh
+
+    bool IsStored( int id ) const
+    {
+        return id >= 0 && id < ( int )m_OffsetVec.size() && m_OffsetVec[id] >= 0;
+    }
+    bool HasStored() const
+    {
+        return m_NumStored > 0;
+    }
+    int GetNumTris( int id ) const
+    {
+        return IsStored( id ) ? m_NumTriVec[id] : 0;
+    }
+
+protected:
+
+    FILE* m_File;
+    int m_NumStored;
+    vector< long long > m_OffsetVec;                // Record start by id, -1 when not stored
+    vector< int > m_NumTriVec;
+
+private:
+
+    SimpMeshStore( SimpMeshStore const& copy );             // Not Implemented
+    SimpMeshStore& operator=( SimpMeshStore const& copy );  // Not Implemented
+};
+
 
 #endif
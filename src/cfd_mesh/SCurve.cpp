@@ -8,6 +8,7 @@
 //////////////////////////////////////////////////////////////////////
 
 #include "SCurve.h"
+#include "StlHelper.h"
 
 SCurve::SCurve()
 {
@@ -673,6 +674,12 @@ void SCurve::Tesselate( const vector< double > & u_tess )
     }
 }
 
+size_t SCurve::MemoryUsage() const
+{
+    return vector_mem_bytes( m_UTess ) + vector_mem_bytes( m_UWTess ) + vector_mem_bytes( u_vec ) +
+           vector_mem_bytes( dist_vec ) + vector_mem_bytes( target_vec ) + vector_mem_bytes( pnt_vec );
+}
+
 void SCurve::FlipDir()
 {
     m_UWCrv.FlipCurve();
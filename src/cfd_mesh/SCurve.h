@@ -108,6 +108,8 @@ public:
 
     void FlipDir();
 
+    size_t MemoryUsage() const;     // Approximate heap bytes held by the tessellation
+
     // void Draw();
 
     vec3d CompPntUW( double u );
@@ -12,6 +12,8 @@
 
 #include "SimpleMeshSettings.h"
 
+#include <algorithm>
+
 //////////////////////////////////////////////////////
 //=========== SimpleMeshCommonSettings =============//
 //////////////////////////////////////////////////////
@@ -178,6 +180,9 @@ SimpleCfdMeshSettings::SimpleCfdMeshSettings()
     m_DrawSymmFlag = false;
     m_DrawWakeFlag = false;
     m_DrawBadFlag = false;
+
+    m_ExportBinaryFlag = false;
+    m_OutOfCoreFlag = false;
 }
 
 SimpleCfdMeshSettings::~SimpleCfdMeshSettings()
@@ -224,6 +229,9 @@ void SimpleCfdMeshSettings::CopyFrom( CfdMeshSettings* settings )
         m_ExportFileFlags[i] = settings->m_ExportFileFlags[i].Get();
     }
 
+    m_ExportBinaryFlag = settings->m_ExportBinaryFlag.Get();
+    m_OutOfCoreFlag = settings->m_OutOfCoreFlag.Get();
+
     m_XYZIntCurveFlag = settings->m_XYZIntCurveFlag.Get();
 
     m_ExportFileNames = settings->GetExportFileNames();
@@ -258,6 +266,7 @@ SimpleFeaMeshSettings::SimpleFeaMeshSettings()
     m_DrawNodesFlag = false;
     m_DrawElementOrientVecFlag = false;
     m_XYZIntCurveFlag = false;
+    m_NASTRANLargeFieldFlag = false;
 }
 
 SimpleFeaMeshSettings::~SimpleFeaMeshSettings()
@@ -280,6 +289,7 @@ void SimpleFeaMeshSettings::CopyFrom( StructSettings* settings )
     m_DrawElementOrientVecFlag = settings->m_DrawElementOrientVecFlag.Get();
 
     m_XYZIntCurveFlag = settings->m_XYZIntCurveFlag.Get();
+    m_NASTRANLargeFieldFlag = settings->m_NASTRANLargeFieldFlag.Get();
 
     m_ExportFileNames = settings->GetExportFileNames();
 
@@ -329,6 +339,7 @@ SimpleGridDensity::SimpleGridDensity()
     m_MaxGap = 1;
     m_FarMaxGap = 1;
     m_GrowRatio = 1;
+    m_SourceTreeValid = false;
 }
 
 SimpleGridDensity::~SimpleGridDensity()
@@ -348,6 +359,8 @@ void SimpleGridDensity::CopyFrom( GridDensity* gd )
     m_FarMaxGap = gd->m_FarMaxGap.Get();
     m_GrowRatio = gd->m_GrowRatio.Get();
     m_Sources = gd->GetSimpleSourceVec();
+
+    BuildSourceTree();
 }
 
 double SimpleGridDensity::GetRadFrac( bool farflag )
@@ -404,17 +417,157 @@ double SimpleGridDensity::GetTargetLen( vec3d& pos, bool farFlag, const string &
     }
     base_len = target_len;
 
-    for ( int i = 0; i < (int)m_Sources.size(); i++ )
+    if ( !m_SourceTreeValid )
     {
-        double len = m_Sources[i]->GetTargetLen( base_len, pos, geomid, surfindx, u, w );
+        for ( int i = 0; i < (int)m_Sources.size(); i++ )
+        {
+            double len = m_Sources[i]->GetTargetLen( base_len, pos, geomid, surfindx, u, w );
+            if ( len < target_len )
+            {
+                target_len = len;
+            }
+        }
+        return target_len;
+    }
+
+    for ( int i = 0; i < (int)m_UnboundedSources.size(); i++ )
+    {
+        double len = m_Sources[m_UnboundedSources[i]]->GetTargetLen( base_len, pos, geomid, surfindx, u, w );
         if ( len < target_len )
         {
             target_len = len;
         }
     }
+
+    if ( m_SourceTree.empty() )
+    {
+        return target_len;
+    }
+
+    //==== Only Visit Sources Whose Influence Box Holds The Point ====//
+    int stack[64];
+    int nstack = 0;
+    stack[nstack++] = 0;
+
+    while ( nstack > 0 )
+    {
+        const SourceTreeNode & node = m_SourceTree[stack[--nstack]];
+
+        if ( !node.m_Box.CheckPnt( pos ) )
+        {
+            continue;
+        }
+
+        if ( node.m_Child[0] >= 0 )
+        {
+            stack[nstack++] = node.m_Child[0];
+            stack[nstack++] = node.m_Child[1];
+            continue;
+        }
+
+        for ( int i = node.m_Start; i < node.m_End; i++ )
+        {
+            double len = m_Sources[m_SourceTreeIndex[i]]->GetTargetLen( base_len, pos, geomid, surfindx, u, w );
+            if ( len < target_len )
+            {
+                target_len = len;
+            }
+        }
+    }
     return target_len;
 }
 
+//==== Order Source Indices by Influence Box Center Along One Axis ====//
+struct SourceCenterCompare
+{
+    SourceCenterCompare( const vector< BndBox > & box_vec, int axis ) : m_BoxVec( box_vec ), m_Axis( axis ) {}
+
+    bool operator()( int a, int b ) const
+    {
+        return m_BoxVec[a].GetCenter()[m_Axis] < m_BoxVec[b].GetCenter()[m_Axis];
+    }
+
+    const vector< BndBox > & m_BoxVec;
+    int m_Axis;
+};
+
+void SimpleGridDensity::BuildSourceTree()
+{
+    m_SourceTree.clear();
+    m_SourceTreeIndex.clear();
+    m_UnboundedSources.clear();
+
+    vector< BndBox > box_vec( m_Sources.size() );
+
+    for ( int i = 0; i < (int)m_Sources.size(); i++ )
+    {
+        if ( m_Sources[i]->GetInfluenceBox( box_vec[i] ) )
+        {
+            m_SourceTreeIndex.push_back( i );
+        }
+        else
+        {
+            m_UnboundedSources.push_back( i );
+        }
+    }
+
+    if ( !m_SourceTreeIndex.empty() )
+    {
+        m_SourceTree.reserve( 2 * m_SourceTreeIndex.size() );
+        BuildSourceTree( box_vec, 0, m_SourceTreeIndex.size() );
+    }
+
+    m_SourceTreeValid = true;
+}
+
+//==== Split Sources at Median Center Along Longest Axis - Returns Node Index ====//
+int SimpleGridDensity::BuildSourceTree( vector< BndBox > & box_vec, int start, int end )
+{
+    const int leaf_size = 4;
+
+    int inode = m_SourceTree.size();
+    m_SourceTree.push_back( SourceTreeNode() );
+
+    BndBox box;
+    for ( int i = start; i < end; i++ )
+    {
+        box.Update( box_vec[m_SourceTreeIndex[i]] );
+    }
+
+    m_SourceTree[inode].m_Box = box;
+    m_SourceTree[inode].m_Child[0] = -1;
+    m_SourceTree[inode].m_Child[1] = -1;
+    m_SourceTree[inode].m_Start = start;
+    m_SourceTree[inode].m_End = end;
+
+    if ( end - start <= leaf_size )
+    {
+        return inode;
+    }
+
+    int axis = 0;
+    for ( int k = 1; k < 3; k++ )
+    {
+        if ( box.GetMax( k ) - box.GetMin( k ) > box.GetMax( axis ) - box.GetMin( axis ) )
+        {
+            axis = k;
+        }
+    }
+
+    // Partial sort of the index range on box center
+    int mid = ( start + end ) / 2;
+    SourceCenterCompare comp( box_vec, axis );
+    nth_element( m_SourceTreeIndex.begin() + start, m_SourceTreeIndex.begin() + mid, m_SourceTreeIndex.begin() + end, comp );
+
+    int c0 = BuildSourceTree( box_vec, start, mid );
+    int c1 = BuildSourceTree( box_vec, mid, end );
+
+    m_SourceTree[inode].m_Child[0] = c0;
+    m_SourceTree[inode].m_Child[1] = c1;
+
+    return inode;
+}
+
 void SimpleGridDensity::ScaleAllSources( double scale )
 {
     for ( int i = 0; i < (int)m_Sources.size(); i++ )
@@ -125,6 +125,8 @@ public:
     bool m_DrawBadFlag;
 
     vector < bool > m_ExportFileFlags;
+    bool m_ExportBinaryFlag;
+    bool m_OutOfCoreFlag;
 
 protected:
 
@@ -147,6 +149,7 @@ public:
     int m_NumEvenlySpacedPart;
     bool m_DrawNodesFlag;
     bool m_DrawElementOrientVecFlag;
+    bool m_NASTRANLargeFieldFlag;
 
 protected:
 
@@ -154,6 +157,15 @@ protected:
 
 };
 
+//==== Node of Bounding Box Tree Over Source Influence Regions ====//
+struct SourceTreeNode
+{
+    BndBox m_Box;
+    int m_Child[2];             // -1 for leaves
+    int m_Start;                // Range in to m_SourceTreeIndex for leaves
+    int m_End;
+};
+
 class SimpleGridDensity
 {
 public:
@@ -194,16 +206,21 @@ public:
     void ClearSources()
     {
         m_Sources.clear();    //Deleted in Geom
+        m_SourceTreeValid = false;
     }
     void AddSource( BaseSimpleSource* s )
     {
         m_Sources.push_back( s );
+        m_SourceTreeValid = false;
     }
     int  GetNumSources()
     {
         return m_Sources.size();
     }
 
+    // Call once sources are placed (after Update), GetTargetLen checks every source until then
+    void BuildSourceTree();
+
     void ScaleAllSources( double scale );
 
     void LoadDrawObjs( vector< DrawObj* > & draw_obj_vec );
@@ -222,8 +239,15 @@ public:
 
 protected:
 
+    int BuildSourceTree( vector< BndBox > & box_vec, int start, int end );
+
     vector< BaseSimpleSource* > m_Sources;
 
+    bool m_SourceTreeValid;
+    vector< SourceTreeNode > m_SourceTree;
+    vector< int > m_SourceTreeIndex;
+    vector< int > m_UnboundedSources;
+
 };
 
 class SimpleCfdGridDensity : public SimpleGridDensity
@@ -17,6 +17,8 @@
 #include "SubSurfaceMgr.h"
 #include "IntersectPatch.h"
 
+#include <queue>
+
 Surf::Surf()
 {
     m_GridDensityPtr = 0;
@@ -53,6 +55,28 @@ Surf::~Surf()
     }
 }
 
+size_t Surf::MemoryUsage() const
+{
+    int i;
+
+    // Meshing surfaces are bicubic, so sixteen control points per patch
+    int npatch = m_SurfCore.GetNumUPatches() * m_SurfCore.GetNumWPatches();
+    size_t bytes = sizeof( Surf ) + npatch * ( sizeof( surface_patch_type ) + 16 * 3 * sizeof( double ) );
+
+    bytes += vector_mem_bytes( m_PatchVec ) + m_PatchVec.size() * sizeof( SurfPatch );
+
+    bytes += vector_mem_bytes( m_SCurveVec );
+    for ( i = 0 ; i < ( int )m_SCurveVec.size() ; i++ )
+    {
+        bytes += sizeof( SCurve ) + m_SCurveVec[i]->MemoryUsage();
+    }
+
+    bytes += vector_mem_bytes( m_SrcMap ) + vector_mem_bytes( m_UScaleMap ) + vector_mem_bytes( m_WScaleMap );
+    bytes += m_Mesh.MemoryUsage();
+
+    return bytes;
+}
+
 void Surf::BuildClean()
 {
     int i;
@@ -157,8 +181,9 @@ void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
         limitFlag = true;
     }
 
-    // Loop over surface evaluating source strength and curvature
-    for( int i = 0; i < nmapu ; i++ )
+    // Loop over surface evaluating source strength and curvature, rows are independent
+    #pragma omp parallel for schedule( dynamic )
+    for( int i = 0; i < ( int )nmapu ; i++ )
     {
         double u = umin + du * ( 1.0 * i ) / ( nmapu - 1 );
         for( int j = 0; j < nmapw ; j++ )
@@ -189,6 +214,13 @@ void Surf::BuildTargetMap( vector< MapSource* > &sources, int sid )
 
             MapSource ms = MapSource( p, len, sid );
             m_SrcMap[i][j] = ms;
+        }
+    }
+
+    for( int i = 0; i < nmapu ; i++ )
+    {
+        for( int j = 0; j < nmapw ; j++ )
+        {
             sources.push_back( &( m_SrcMap[i][j] ) );
         }
     }
@@ -210,107 +242,67 @@ void Surf::SetSymPlaneFlag( bool flag )
 }
 
 
-bool indxcompare( const pair < double, pair < int, int > > &a, const pair < double, pair < int, int > > &b )
-{
-    return ( a.first < b.first );
-}
-
-void Surf::WalkMap( int istart, int jstart, int kstart )
+//==== Multi-Source Walk - Dijkstra Style Front From All Seeds at Once ====//
+// Each map point carries the seed it was limited by, so the limit is grown from that seed's
+// location and strength rather than accumulated along the walk.
+void Surf::WalkMap( const vector< pair< int, int > > & seed_vec )
 {
-    static int iadd[] = { -1, 1,  0, 0 };
-    static int jadd[] = {  0, 0, -1, 1 };
+    static const int iadd[] = { -1, 1,  0, 0 };
+    static const int jadd[] = {  0, 0, -1, 1 };
 
-    vector < pair < int, int > > v;
+    int nmapu = m_SrcMap.size();
+    int nmapw = m_SrcMap[0].size();
+    double grm1 = m_GridDensityPtr->m_GrowRatio - 1.0;
 
-    for( int i = 0; i < 4; i++ )
-    {
-        int inext = istart + iadd[i];
-        int jnext = jstart + jadd[i];
+    vector< int > origin( nmapu * nmapw, -1 );
+    vector< double > seed_str( seed_vec.size() );
 
-        if( inext < m_SrcMap.size() && inext >= 0 && jnext < m_SrcMap[0].size() && jnext >= 0 )
-        {
-            v.push_back( make_pair( inext, jnext ) );
-        }
-    }
+    priority_queue < pair < double, int >, vector < pair < double, int > >, greater < pair < double, int > > > front;
 
-    while ( !v.empty() )
+    for( int s = 0; s < ( int )seed_vec.size(); s++ )
     {
-        pair < int, int > p = v.back();
-        v.pop_back();
-        int icurrent = p.first;
-        int jcurrent = p.second;
-
-        if( m_SrcMap[ icurrent ][ jcurrent ].m_maxvisited < kstart )
-        {
-            m_SrcMap[ icurrent ][ jcurrent ].m_maxvisited = kstart;
-
-            double targetstr = m_SrcMap[istart][jstart].m_str +
-                    ( m_SrcMap[ icurrent ][ jcurrent ].m_pt - m_SrcMap[istart][jstart].m_pt ).mag() *
-                    (m_GridDensityPtr->m_GrowRatio - 1.0);
-
-            if( m_SrcMap[ icurrent ][ jcurrent ].m_str > targetstr )
-            {
-                // Mark dominated as progress is made
-                m_SrcMap[ icurrent ][ jcurrent ].m_dominated = true;
-                m_SrcMap[ icurrent ][ jcurrent ].m_str = targetstr;
-
-                for( int i = 0; i < 4; i++ )
-                {
-                    int inext = icurrent + iadd[i];
-                    int jnext = jcurrent + jadd[i];
+        int i = seed_vec[s].first;
+        int j = seed_vec[s].second;
 
-                    if( inext < m_SrcMap.size() && inext >= 0 && jnext < m_SrcMap[0].size() && jnext >= 0 )
-                    {
-                        v.push_back( make_pair( inext, jnext ) );
-                    }
-                }
-            }
-        }
+        seed_str[s] = m_SrcMap[i][j].m_str;
+        origin[ i * nmapw + j ] = s;
+        front.push( make_pair( seed_str[s], i * nmapw + j ) );
     }
-}
-
-void Surf::WalkMap( int istart, int jstart )
-{
-    static const int iadd[] = { -1, 1,  0, 0 };
-    static const int jadd[] = {  0, 0, -1, 1 };
-
-    vector < pair < int, int > > v;
 
-    for( int i = 0; i < 4; i++ )
+    while ( !front.empty() )
     {
-        int inext = istart + iadd[i];
-        int jnext = jstart + jadd[i];
+        pair < double, int > p = front.top();
+        front.pop();
+
+        int icurrent = p.second / nmapw;
+        int jcurrent = p.second % nmapw;
 
-        if( inext < m_SrcMap.size() && inext >= 0 && jnext < m_SrcMap[0].size() && jnext >= 0 )
+        // Skip stale entries, this point has been limited further since it was queued
+        if( p.first > m_SrcMap[ icurrent ][ jcurrent ].m_str )
         {
-            v.push_back( make_pair( inext, jnext ) );
+            continue;
         }
-    }
-
-    while ( !v.empty() )
-    {
-        pair < int, int > p = v.back();
-        v.pop_back();
-        int icurrent = p.first;
-        int jcurrent = p.second;
-
-        double targetstr = m_SrcMap[istart][jstart].m_str +
-                ( m_SrcMap[ icurrent ][ jcurrent ].m_pt - m_SrcMap[istart][jstart].m_pt ).mag() *
-                (m_GridDensityPtr->m_GrowRatio - 1.0);
 
+        int s = origin[ p.second ];
+        const vec3d & seed_pt = m_SrcMap[ seed_vec[s].first ][ seed_vec[s].second ].m_pt;
 
-        if( m_SrcMap[ icurrent ][ jcurrent ].m_str > targetstr )
+        for( int i = 0; i < 4; i++ )
         {
-            m_SrcMap[ icurrent ][ jcurrent ].m_str = targetstr;
+            int inext = icurrent + iadd[i];
+            int jnext = jcurrent + jadd[i];
 
-            for( int i = 0; i < 4; i++ )
+            if( inext < nmapu && inext >= 0 && jnext < nmapw && jnext >= 0 )
             {
-                int inext = icurrent + iadd[i];
-                int jnext = jcurrent + jadd[i];
+                MapSource & next = m_SrcMap[ inext ][ jnext ];
 
-                if( inext < m_SrcMap.size() && inext >= 0 && jnext < m_SrcMap[0].size() && jnext >= 0 )
+                double targetstr = seed_str[s] + ( next.m_pt - seed_pt ).mag() * grm1;
+
+                if( next.m_str > targetstr )
                 {
-                    v.push_back( make_pair( inext, jnext ) );
+                    next.m_dominated = true;
+                    next.m_str = targetstr;
+                    origin[ inext * nmapw + jnext ] = s;
+                    front.push( make_pair( targetstr, inext * nmapw + jnext ) );
                 }
             }
         }
@@ -322,43 +314,19 @@ void Surf::LimitTargetMap()
     int nmapu = m_SrcMap.size();
     int nmapw = m_SrcMap[0].size();
 
-    int nmap = nmapu * nmapw;
-
-    // Create size sortable index of array i,j coordinates
-    vector< pair < double, pair < int, int > > > index;
-    index.resize( nmap );
+    // Every map point is a seed, the front expands from the smallest first
+    vector< pair< int, int > > seed_vec;
+    seed_vec.reserve( nmapu * nmapw );
 
-    int k = 0;
     for( int i = 0; i < nmapu ; i++ )
     {
         for( int j = 0; j < nmapw ; j++ )
         {
-            pair< int, int > ij( i, j );
-            pair < double, pair < int, int > > id( m_SrcMap[i][j].m_str, ij );
-            index[k] = id;
-            k++;
-            m_SrcMap[i][j].m_maxvisited = -1;  // Reset traversal limiter.
+            seed_vec.push_back( make_pair( i, j ) );
         }
     }
 
-    // Sort index
-    std::sort( index.begin(), index.end(), indxcompare );
-
-    // Start from smallest
-    for( k = 0; k < nmap; k++ )
-    {
-        pair< int, int > ij = index[k].second;
-        int i = ij.first;
-        int j = ij.second;
-
-        MapSource src = m_SrcMap[i][j];
-
-        // Recursively limit from small to large (skip if dominated)
-        if( !src.m_dominated )
-        {
-            WalkMap( i, j, k );
-        }
-    }
+    WalkMap( seed_vec );
 }
 
 void Surf::LimitTargetMap( const MSCloud &es_cloud, MSTree &es_tree, double minmap )
@@ -373,18 +341,17 @@ void Surf::LimitTargetMap( const MSCloud &es_cloud, MSTree &es_tree, double minm
     int nmapu = m_SrcMap.size();
     int nmapw = m_SrcMap[0].size();
 
-    // Loop over surface evaluating source strength and curvature
+    vector< vector< double > > tlim( nmapu, vector< double >( nmapw ) );
+
+    // Loop over surface finding the limit from the other surfaces, the tree is only read
+    #pragma omp parallel for schedule( dynamic )
     for( int i = 0; i < nmapu ; i++ )
     {
-//      double u = ( 1.0 * i ) / ( m_NumMap - 1 );
         for( int j = 0; j < nmapw ; j++ )
         {
-//          double w = ( 1.0 * j ) / ( m_NumMap - 1 );
-
             double *query_pt = m_SrcMap[i][j].m_pt.v;
 
             double t = m_SrcMap[i][j].m_str;
-            double torig = t;
 
             double rmax = ( t - tmin ) / grm1;
             if( rmax > 0.0 )
@@ -405,14 +372,30 @@ void Surf::LimitTargetMap( const MSCloud &es_cloud, MSTree &es_tree, double minm
                     double ts = str + grm1 * r;
                     t = min( t, ts );
                 }
-                if( t < torig )
-                {
-                    m_SrcMap[i][j].m_str = t;
-                    WalkMap( i, j );
-                }
+            }
+            tlim[i][j] = t;
+        }
+    }
+
+    // Spread all of the limited points in one walk
+    vector< pair< int, int > > seed_vec;
+
+    for( int i = 0; i < nmapu ; i++ )
+    {
+        for( int j = 0; j < nmapw ; j++ )
+        {
+            if( tlim[i][j] < m_SrcMap[i][j].m_str )
+            {
+                m_SrcMap[i][j].m_str = tlim[i][j];
+                seed_vec.push_back( make_pair( i, j ) );
             }
         }
     }
+
+    if( !seed_vec.empty() )
+    {
+        WalkMap( seed_vec );
+    }
 }
 
 double Surf::InterpTargetMap( double u, double w )
@@ -484,6 +467,8 @@ void Surf::ApplyES( vec3d uw, double t )
     int iadd[] = { 0, 1, 0, 1 };
     int jadd[] = { 0, 0, 1, 1 };
 
+    vector< pair< int, int > > seed_vec;
+
     for( int i = 0; i < 4; i++ )
     {
         int itarget = ibase + iadd[i];
@@ -497,10 +482,15 @@ void Surf::ApplyES( vec3d uw, double t )
             if( m_SrcMap[ itarget ][ jtarget ].m_str > targetstr )
             {
                 m_SrcMap[ itarget ][ jtarget ].m_str = targetstr;
-                WalkMap( itarget, jtarget );
+                seed_vec.push_back( make_pair( itarget, jtarget ) );
             }
         }
     }
+
+    if( !seed_vec.empty() )
+    {
+        WalkMap( seed_vec );
+    }
 }
 
 vec2d Surf::ClosestUW( const vec3d & pnt_in, double guess_u, double guess_w ) const
@@ -517,6 +507,34 @@ vec2d Surf::ClosestUW( const vec3d & pnt_in ) const
     return vec2d( u, w );
 }
 
+vec2d Surf::ClosestUWWarmStart( const vec3d & pnt_in, double guess_u, double guess_w ) const
+{
+    double u, w;
+    m_SurfCore.FindNearestWarmStart( u, w, pnt_in, guess_u, guess_w );
+    return vec2d( u, w );
+}
+
+void Surf::ClosestUW( const vector< vec3d > & pnt_vec, const vector< vec2d > & guess_vec, vector< vec2d > & uw_vec ) const
+{
+    bool warm_flag = ( guess_vec.size() == pnt_vec.size() );
+
+    uw_vec.resize( pnt_vec.size() );
+
+    // The patch index is built with the surface, so each projection only reads shared state
+    #pragma omp parallel for schedule( dynamic, 16 )
+    for ( int i = 0 ; i < ( int )pnt_vec.size() ; i++ )
+    {
+        if ( warm_flag )
+        {
+            uw_vec[i] = ClosestUWWarmStart( pnt_vec[i], guess_vec[i][0], guess_vec[i][1] );
+        }
+        else
+        {
+            uw_vec[i] = ClosestUW( pnt_vec[i] );
+        }
+    }
+}
+
 void Surf::FindBorderCurves()
 {
     double degen_tol = 1.0e-6;
@@ -643,35 +661,56 @@ void Surf::WriteSTL( const char* filename )
 
 void Surf::Intersect( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr )
 {
-    int i;
+    if ( !IntersectCheck( surfPtr, MeshMgr ) )
+    {
+        return;
+    }
+
+    vector< PatchIntersectSeg > seg_vec;
+    IntersectPatches( surfPtr, seg_vec );
+
+    for ( int i = 0 ; i < ( int )seg_vec.size() ; i++ )
+    {
+        MeshMgr->AddIntersectionSeg( seg_vec[i] );
+    }
+}
 
+//==== Handle Shared Borders - Returns True If The Patches Still Need Intersecting ====//
+bool Surf::IntersectCheck( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr )
+{
     if ( surfPtr->GetCompID() == m_CompID )
     {
-        return;
+        return false;
     }
 
     if ( !Compare( m_BBox, surfPtr->GetBBox() ) )
     {
-        return;
+        return false;
     }
     if ( BorderCurveOnSurface( surfPtr, MeshMgr ) )
     {
-        return;
+        return false;
     }
     if ( surfPtr->BorderCurveOnSurface( this, MeshMgr ) )
     {
-        return;
+        return false;
     }
 
+    return true;
+}
+
+//==== Intersect Patches - Only Reads Surf Data So Pairs Can Run In Parallel ====//
+void Surf::IntersectPatches( Surf* surfPtr, vector< PatchIntersectSeg > & seg_vec )
+{
     vector< SurfPatch* > otherPatchVec = surfPtr->GetPatchVec();
-    for ( i = 0 ; i < ( int )m_PatchVec.size() ; i++ )
+    for ( int i = 0 ; i < ( int )m_PatchVec.size() ; i++ )
         if ( Compare( *m_PatchVec[i]->get_bbox(), surfPtr->GetBBox() ) )
         {
             for ( int j = 0 ; j < ( int )otherPatchVec.size() ; j++ )
             {
                 if ( Compare( *m_PatchVec[i]->get_bbox(), *otherPatchVec[j]->get_bbox() ) )
                 {
-                    intersect( *m_PatchVec[i], *otherPatchVec[j], MeshMgr );
+                    intersect( *m_PatchVec[i], *otherPatchVec[j], seg_vec );
                 }
             }
         }
@@ -61,8 +61,7 @@ public:
 
     double TargetLen( double u, double w, double gap, double radfrac );
     void BuildTargetMap( vector< MapSource* > &sources, int sid );
-    void WalkMap( int istart, int jstart, int kstart );
-    void WalkMap( int istart, int jstart );
+    void WalkMap( const vector< pair< int, int > > & seed_vec );
     void LimitTargetMap();
     void LimitTargetMap( const MSCloud &es_cloud, MSTree &es_tree, double minmap );
     double InterpTargetMap( double u, double w );
@@ -73,6 +72,10 @@ public:
 
     vec2d ClosestUW( const vec3d & pnt_in, double guess_u, double guess_w ) const;
     vec2d ClosestUW( const vec3d & pnt_in ) const;
+    vec2d ClosestUWWarmStart( const vec3d & pnt_in, double guess_u, double guess_w ) const;
+
+    // Global projection of every point, or warm started from guess_vec when it is not empty.
+    void ClosestUW( const vector< vec3d > & pnt_vec, const vector< vec2d > & guess_vec, vector< vec2d > & uw_vec ) const;
 
     void FindBorderCurves();
 
@@ -152,7 +155,11 @@ public:
         return &m_Mesh;
     }
 
+    size_t MemoryUsage() const;             // Approximate bytes held by the patches, curves and mesh
+
     void Intersect( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr );
+    bool IntersectCheck( Surf* surfPtr, SurfaceIntersectionSingleton *MeshMgr );
+    void IntersectPatches( Surf* surfPtr, vector< PatchIntersectSeg > & seg_vec );
     void IntersectLineSeg( vec3d & p0, vec3d & p1, vector< double > & t_vals );
     void IntersectLineSegMesh( vec3d & p0, vec3d & p1, vector< double > & t_vals );
 
@@ -9,7 +9,8 @@
 #include "eli/geom/surface/piecewise_body_of_revolution_creator.hpp"
 #include "eli/geom/surface/piecewise_capped_surface_creator.hpp"
 
-typedef piecewise_surface_type::bounding_box_type surface_bounding_box_type;
+#include <algorithm>
+#include <limits>
 
 SurfCore::SurfCore()
 {
@@ -320,6 +321,45 @@ bool SurfCore::LessThanY( double val ) const
     return true;
 }
 
+//==== Append Patch Layout and Control Points - Equal Signatures Mean Equal Surfaces ====//
+void SurfCore::AppendSignature( vector< double > & sig ) const
+{
+    piecewise_surface_type::index_type ip, jp, nupatch, nvpatch;
+    nupatch = m_Surface.number_u_patches();
+    nvpatch = m_Surface.number_v_patches();
+
+    sig.push_back( nupatch );
+    sig.push_back( nvpatch );
+    sig.push_back( m_Surface.get_u0() );
+    sig.push_back( m_Surface.get_v0() );
+    sig.push_back( m_Surface.get_umax() );
+    sig.push_back( m_Surface.get_vmax() );
+
+    for( ip = 0; ip < nupatch; ++ip )
+    {
+        for( jp = 0; jp < nvpatch; ++jp )
+        {
+            surface_patch_type::index_type icp, jcp;
+            const surface_patch_type *patch = m_Surface.get_patch( ip, jp );
+
+            sig.push_back( patch->degree_u() );
+            sig.push_back( patch->degree_v() );
+
+            for( icp = 0; icp <= patch->degree_u(); ++icp )
+            {
+                for( jcp = 0; jcp <= patch->degree_v(); ++jcp )
+                {
+                    surface_point_type cp;
+                    cp = patch->get_control_point( icp, jcp );
+                    sig.push_back( cp.x() );
+                    sig.push_back( cp.y() );
+                    sig.push_back( cp.z() );
+                }
+            }
+        }
+    }
+}
+
 bool SurfCore::PlaneAtYZero() const
 {
     double tol = 1.0e-6;
@@ -696,6 +736,8 @@ void SurfCore::MakeWakeSurf( const Bezier_curve &lecrv, double endx, double angl
     {
         m_Surface.reverse_u();
     }
+
+    BuildPatchIndex();
 }
 
 void SurfCore::MakePlaneSurf( const threed_point_type &p0, const threed_point_type &p1, const threed_point_type &p2, const threed_point_type &p3 )
@@ -710,6 +752,8 @@ void SurfCore::MakePlaneSurf( const threed_point_type &p0, const threed_point_ty
 
     m_Surface.init_uv( 1, 1 );
     m_Surface.set( patch, 0, 0 );
+
+    BuildPatchIndex();
 }
 
 void SurfCore::BuildPatches( Surf* srf ) const
@@ -820,11 +864,84 @@ double SurfCore::FindNearest( double &u, double &w, const vec3d &pt, double u0,
 
 double SurfCore::FindNearest( double &u, double &w, const vec3d &pt ) const
 {
-    double dist;
     surface_point_type p;
     pt.get_pnt( p );
 
-    dist = eli::geom::intersect::minimum_distance( u, w, m_Surface, p );
+    u = m_Surface.get_u0();
+    w = m_Surface.get_v0();
+
+    return FindNearestPatches( u, w, p, std::numeric_limits< double >::max() );
+}
+
+double SurfCore::FindNearestWarmStart( double &u, double &w, const vec3d &pt, double u0, double w0 ) const
+{
+    double dist = FindNearest( u, w, pt, u0, w0 );
+
+    surface_point_type p;
+    pt.get_pnt( p );
+
+    return FindNearestPatches( u, w, p, dist );
+}
+
+//==== Cache Patch Boxes So Global Searches Skip Rebuilding Them Per Point ====//
+void SurfCore::BuildPatchIndex()
+{
+    m_PatchBoxVec.clear();
+    m_PatchBoxVec.reserve( m_Surface.number_u_patches() * m_Surface.number_v_patches() );
+
+    for ( int ip = 0; ip < ( int )m_Surface.number_u_patches(); ip++ )
+    {
+        for ( int jp = 0; jp < ( int )m_Surface.number_v_patches(); jp++ )
+        {
+            SurfCorePatchBox pbox;
+            pbox.m_UIndex = ip;
+            pbox.m_WIndex = jp;
+
+            const surface_patch_type *epatch = m_Surface.get_patch( ip, jp, pbox.m_U0, pbox.m_DU, pbox.m_W0, pbox.m_DW );
+            epatch->get_bounding_box( pbox.m_BBox );
+
+            m_PatchBoxVec.push_back( pbox );
+        }
+    }
+}
+
+//==== Nearest Point Over Patches Ordered By Box Distance, Keeping ( u, w ) Unless Beaten ====//
+double SurfCore::FindNearestPatches( double &u, double &w, const surface_point_type &p, double dist ) const
+{
+    vector< std::pair< double, int > > bbdist;
+    bbdist.reserve( m_PatchBoxVec.size() );
+
+    for ( int i = 0 ; i < ( int )m_PatchBoxVec.size() ; i++ )
+    {
+        double d = eli::geom::intersect::minimum_distance( m_PatchBoxVec[i].m_BBox, p );
+        if ( d < dist )
+        {
+            bbdist.push_back( std::make_pair( d, i ) );
+        }
+    }
+
+    std::sort( bbdist.begin(), bbdist.end() );
+
+    for ( int i = 0 ; i < ( int )bbdist.size() ; i++ )
+    {
+        if ( bbdist[i].first >= dist )
+        {
+            break;
+        }
+
+        const SurfCorePatchBox & pbox = m_PatchBoxVec[ bbdist[i].second ];
+        const surface_patch_type *epatch = m_Surface.get_patch( pbox.m_UIndex, pbox.m_WIndex );
+
+        double uu, ww;
+        double d = eli::geom::intersect::minimum_distance( uu, ww, *epatch, p );
+
+        if ( d < dist )
+        {
+            dist = d;
+            u = pbox.m_U0 + uu * pbox.m_DU;
+            w = pbox.m_W0 + ww * pbox.m_DW;
+        }
+    }
 
     return dist;
-}
\ No newline at end of file
+}
@@ -21,6 +21,7 @@ typedef eli::geom::surface::piecewise<eli::geom::surface::bezier, double, 3> pie
 typedef piecewise_surface_type::point_type surface_point_type;
 
 typedef piecewise_surface_type::tolerance_type surface_tolerance_type;
+typedef piecewise_surface_type::bounding_box_type surface_bounding_box_type;
 
 #include <vector>
 using std::vector;
@@ -28,6 +29,18 @@ using std::vector;
 class Bezier_curve;
 class Surf;
 
+//==== Cached Bounding Box And Parameter Range Of One Bezier Patch ====//
+struct SurfCorePatchBox
+{
+    surface_bounding_box_type m_BBox;
+    int m_UIndex;
+    int m_WIndex;
+    double m_U0;
+    double m_DU;
+    double m_W0;
+    double m_DW;
+};
+
 //////////////////////////////////////////////////////////////////////
 class SurfCore
 {
@@ -93,6 +106,7 @@ public:
     void SetSurf( const piecewise_surface_type &surf )
     {
         m_Surface = surf;
+        BuildPatchIndex();
     }
 
     piecewise_surface_type * GetSurf()
@@ -105,6 +119,8 @@ public:
     bool LessThanY( double val ) const;
     bool PlaneAtYZero() const;
 
+    void AppendSignature( vector< double > & sig ) const;
+
     Bezier_curve GetBorderCurve( int iborder ) const;
     void LoadBorderCurves( vector < Bezier_curve > & borderCurves ) const;
 
@@ -121,9 +137,19 @@ public:
     double FindNearest( double &u, double &w, const vec3d &pt, double u0, double w0, double umin, double umax, double vmin, double vmax ) const;
     double FindNearest( double &u, double &w, const vec3d &pt ) const;
 
+    // Local solve from ( u0, w0 ), then only the patches whose box is nearer than that answer.
+    double FindNearestWarmStart( double &u, double &w, const vec3d &pt, double u0, double w0 ) const;
+
+    // Rebuilt whenever m_Surface changes so the searches above stay read only.
+    void BuildPatchIndex();
+
 protected:
     piecewise_surface_type m_Surface;
 
+    vector< SurfCorePatchBox > m_PatchBoxVec;
+
+    double FindNearestPatches( double &u, double &w, const surface_point_type &p, double dist ) const;
+
     bool MatchThisOrientation( const piecewise_surface_type &osurf ) const;
 
     vec3d CompTanUU( double u, double w ) const;
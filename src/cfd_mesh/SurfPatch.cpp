@@ -11,7 +11,8 @@
 #include "Surf.h"
 
 #include "eli/geom/intersect/minimum_distance_surface.hpp"
-typedef piecewise_surface_type::bounding_box_type surface_bounding_box_type;
+
+#include <algorithm>
 
 //////////////////////////////////////////////////////////////////////
 
@@ -24,6 +25,9 @@ SurfPatch::SurfPatch()
 
     m_wasplanar = false;
     m_lastreltol = 12345.678;
+
+    m_SubPatchFlag = false;
+    m_SubPatch[0] = m_SubPatch[1] = m_SubPatch[2] = m_SubPatch[3] = NULL;
 }
 
 SurfPatch::SurfPatch( int n, int m, int d ) : m_Patch( n, m )
@@ -35,10 +39,30 @@ SurfPatch::SurfPatch( int n, int m, int d ) : m_Patch( n, m )
 
     m_wasplanar = false;
     m_lastreltol = 12345.678;
+
+    m_SubPatchFlag = false;
+    m_SubPatch[0] = m_SubPatch[1] = m_SubPatch[2] = m_SubPatch[3] = NULL;
 }
 
 SurfPatch::~SurfPatch()
 {
+    for ( int i = 0 ; i < 4 ; i++ )
+    {
+        delete m_SubPatch[i];
+    }
+}
+
+void SurfPatch::reset_surf_ptr( Surf* ptr )
+{
+    m_SurfPtr = ptr;
+
+    if ( m_SubPatchFlag )
+    {
+        for ( int i = 0 ; i < 4 ; i++ )
+        {
+            m_SubPatch[i]->reset_surf_ptr( ptr );
+        }
+    }
 }
 
 //==== Compute Bounding Box ====//
@@ -103,6 +127,44 @@ void SurfPatch::split_patch( SurfPatch& bp00, SurfPatch& bp10, SurfPatch& bp01,
 
 }
 
+//===== Sub Patches Split Once And Kept - NULL Past MAX_CACHED_SUB_DEPTH =====//
+const SurfPatch* const * SurfPatch::get_cached_split() const
+{
+    if ( sub_depth >= MAX_CACHED_SUB_DEPTH )
+    {
+        return NULL;
+    }
+
+    if ( !m_SubPatchFlag )
+    {
+        // Surf pairs are intersected concurrently, so the first split of a shared patch is guarded
+        #pragma omp critical ( SurfPatchSplit )
+        {
+            if ( !m_SubPatchFlag )
+            {
+                int n = degree_u();
+                int m = degree_v();
+                int d = sub_depth + 1;
+
+                for ( int i = 0 ; i < 4 ; i++ )
+                {
+                    m_SubPatch[i] = new SurfPatch( n, m, d );
+                }
+
+                split_patch( *m_SubPatch[0], *m_SubPatch[1], *m_SubPatch[2], *m_SubPatch[3] );
+
+                // Publish the sub patches before the flag
+                #pragma omp flush
+                m_SubPatchFlag = true;
+            }
+        }
+    }
+
+    #pragma omp flush
+
+    return m_SubPatch;
+}
+
 //===== Test If Patch Is Planar (within tol)  =====//
 bool SurfPatch::test_planar( double tol ) const
 {
@@ -262,6 +324,17 @@ void SurfPatch::IntersectLineSeg( vec3d & p0, vec3d & p1, BndBox & line_box, vec
         return;
     }
 
+    const SurfPatch* const * sub = get_cached_split();
+
+    if ( sub )
+    {
+        for ( int i = 0 ; i < 4 ; i++ )
+        {
+            sub[i]->IntersectLineSeg( p0, p1, line_box, t_vals );
+        }
+        return;
+    }
+
     int n = degree_u();
     int m = degree_v();
     int d = GetSubDepth() + 1;
@@ -355,3 +428,131 @@ vector < vec3d > SurfPatch::GetPatchDrawLines() const
     return vector < vec3d > {a0, a3, a3, a2, a2, a1, a1, a0};
 }
 
+
+//////////////////////////////////////////////////////////////////////
+//==== SurfPatchTree ====//
+//////////////////////////////////////////////////////////////////////
+
+struct PatchCenterCompare
+{
+    PatchCenterCompare( int axis ) : m_Axis( axis ) {}
+
+    bool operator()( const pair< const SurfPatch*, int > & a, const pair< const SurfPatch*, int > & b ) const
+    {
+        return a.first->get_bbox()->GetCenter()[m_Axis] < b.first->get_bbox()->GetCenter()[m_Axis];
+    }
+
+    int m_Axis;
+};
+
+void SurfPatchTree::Clear()
+{
+    m_NodeVec.clear();
+    m_EntryVec.clear();
+}
+
+void SurfPatchTree::AddPatch( const SurfPatch* patch, int surf_ind )
+{
+    m_EntryVec.push_back( pair< const SurfPatch*, int >( patch, surf_ind ) );
+}
+
+void SurfPatchTree::Build()
+{
+    m_NodeVec.clear();
+
+    if ( !m_EntryVec.empty() )
+    {
+        m_NodeVec.reserve( 2 * m_EntryVec.size() );
+        Build( 0, m_EntryVec.size() );
+    }
+}
+
+//==== Split Patches at Median Center Along Longest Axis - Returns Node Index ====//
+int SurfPatchTree::Build( int start, int end )
+{
+    const int leaf_size = 4;
+
+    int inode = m_NodeVec.size();
+    m_NodeVec.push_back( PatchTreeNode() );
+
+    BndBox box;
+    for ( int i = start; i < end; i++ )
+    {
+        box.Update( *m_EntryVec[i].first->get_bbox() );
+    }
+
+    m_NodeVec[inode].m_Box = box;
+    m_NodeVec[inode].m_Child[0] = -1;
+    m_NodeVec[inode].m_Child[1] = -1;
+    m_NodeVec[inode].m_Start = start;
+    m_NodeVec[inode].m_End = end;
+
+    if ( end - start <= leaf_size )
+    {
+        return inode;
+    }
+
+    int axis = 0;
+    for ( int k = 1; k < 3; k++ )
+    {
+        if ( box.GetMax( k ) - box.GetMin( k ) > box.GetMax( axis ) - box.GetMin( axis ) )
+        {
+            axis = k;
+        }
+    }
+
+    int mid = ( start + end ) / 2;
+    nth_element( m_EntryVec.begin() + start, m_EntryVec.begin() + mid, m_EntryVec.begin() + end, PatchCenterCompare( axis ) );
+
+    int c0 = Build( start, mid );
+    int c1 = Build( mid, end );
+
+    m_NodeVec[inode].m_Child[0] = c0;
+    m_NodeVec[inode].m_Child[1] = c1;
+
+    return inode;
+}
+
+void SurfPatchTree::IntersectLineSeg( const vec3d & p0, const vec3d & p1, const vector< bool > & surf_mask, vector< double > & t_vals ) const
+{
+    if ( m_NodeVec.empty() )
+    {
+        return;
+    }
+
+    vec3d lp0 = p0;
+    vec3d lp1 = p1;
+    BndBox line_box;
+    line_box.Update( lp0 );
+    line_box.Update( lp1 );
+
+    // Median splits keep the depth near log2 of the patch count
+    int stack[64];
+    int nstack = 0;
+    stack[nstack++] = 0;
+
+    while ( nstack > 0 )
+    {
+        const PatchTreeNode & node = m_NodeVec[stack[--nstack]];
+
+        if ( !Compare( line_box, node.m_Box ) )
+        {
+            continue;
+        }
+
+        if ( node.m_Child[0] >= 0 )
+        {
+            stack[nstack++] = node.m_Child[0];
+            stack[nstack++] = node.m_Child[1];
+            continue;
+        }
+
+        for ( int i = node.m_Start; i < node.m_End; i++ )
+        {
+            if ( surf_mask[ m_EntryVec[i].second ] )
+            {
+                m_EntryVec[i].first->IntersectLineSeg( lp0, lp1, line_box, t_vals );
+            }
+        }
+    }
+}
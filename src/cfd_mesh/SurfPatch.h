@@ -42,9 +42,15 @@ typedef piecewise_surface_type::tolerance_type surface_tolerance_type;
 
 class Surf;
 class SurfPatch;
+class PatchIntersectSeg;
 class SurfaceIntersectionSingleton;
 class CfdMeshMgrSingleton;
 
+// Patches this shallow keep their four sub patches once split.  All the intersection
+// and line segment tests subdivide at least this far, so the top of the hierarchy is
+// shared by every test and mesh run instead of being split again each time.
+#define MAX_CACHED_SUB_DEPTH 3
+
 //////////////////////////////////////////////////////////////////////
 class SurfPatch
 {
@@ -58,6 +64,7 @@ public:
     {
         m_SurfPtr = ptr;
     }
+    void reset_surf_ptr( Surf* ptr );      // Also sets the cached sub patches
     Surf* get_surf_ptr() const
     {
         return m_SurfPtr;
@@ -102,6 +109,7 @@ public:
     void compute_bnd_box();
 
     void split_patch( SurfPatch& bp00, SurfPatch& bp10, SurfPatch& bp01, SurfPatch& bp11 ) const;
+    const SurfPatch* const * get_cached_split() const;
     bool test_planar( double tol ) const;
     bool test_planar_rel( double reltol ) const;
 
@@ -109,7 +117,7 @@ public:
     {
         return &bnd_box;
     }
-    friend void intersect( const SurfPatch& bp1, const SurfPatch& bp2, SurfaceIntersectionSingleton *MeshMgr );
+    friend void intersect( const SurfPatch& bp1, const SurfPatch& bp2, vector< PatchIntersectSeg > & seg_vec );
     void find_closest_uw( const vec3d& pnt_in, double uw[2] ) const;
     void find_closest_uw( const vec3d& pnt_in, const double guess_uw[2],double uw[2] ) const;
     void find_closest_uw_planar_approx( const vec3d& pnt_in, double uw[2] ) const;
@@ -135,7 +143,7 @@ public:
         return sub_depth;
     }
 
-    friend void intersect_quads( const SurfPatch&  bp1, const SurfPatch& bp2, SurfaceIntersectionSingleton *MeshMgr );
+    friend void intersect_quads( const SurfPatch&  bp1, const SurfPatch& bp2, vector< PatchIntersectSeg > & seg_vec );
 
     vector < vec3d > GetPatchDrawLines() const;
 
@@ -155,6 +163,63 @@ protected:
     mutable bool m_wasplanar;
     mutable double m_lastreltol;
 
+    mutable bool m_SubPatchFlag;
+    mutable SurfPatch* m_SubPatch[4];
+
+private:
+
+    // Not copyable - the cached sub patches are owned
+    SurfPatch( const SurfPatch & );
+    SurfPatch & operator=( const SurfPatch & );
+
+};
+
+//////////////////////////////////////////////////////////////////////
+//==== Intersection Segment Found Between Two Patches, Held Until Its IPnts Get Built ====//
+class PatchIntersectSeg
+{
+public:
+
+    Surf* m_SurfA;
+    Surf* m_SurfB;
+
+    vec2d m_UWA[2];
+    vec2d m_UWB[2];
+    vec3d m_Pnt[2];
+
+    vector < vec3d > m_PatchADrawLines;
+    vector < vec3d > m_PatchBDrawLines;
+};
+
+//////////////////////////////////////////////////////////////////////
+//==== Bounding Box Tree Over Surface Patches For Line Segment Queries ====//
+struct PatchTreeNode
+{
+    BndBox m_Box;
+    int m_Child[2];             // -1 for leaves
+    int m_Start;                // Range in to m_EntryVec for leaves
+    int m_End;
+};
+
+class SurfPatchTree
+{
+public:
+
+    void Clear();
+
+    // surf_ind is the caller's index for the patch's surface, used to mask queries
+    void AddPatch( const SurfPatch* patch, int surf_ind );
+    void Build();
+
+    // Adds crossings with patches whose surf_ind is set in surf_mask.  Safe to call concurrently.
+    void IntersectLineSeg( const vec3d & p0, const vec3d & p1, const vector< bool > & surf_mask, vector< double > & t_vals ) const;
+
+protected:
+
+    int Build( int start, int end );
+
+    vector< PatchTreeNode > m_NodeVec;
+    vector< pair< const SurfPatch*, int > > m_EntryVec;         // Patch and surf_ind
 };
 
 
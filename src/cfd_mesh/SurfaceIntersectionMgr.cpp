@@ -12,11 +12,12 @@
 #include "SubSurfaceMgr.h"
 #include "main.h"
 #include "StringUtil.h"
+#include "StlHelper.h"
+#include "ProcessUtil.h"
+#include "PerfStats.h"
 
 #include "eli/geom/intersect/intersect_surface.hpp"
 
-#include <chrono>
-
 #ifdef DEBUG_CFD_MESH
 #include <direct.h>
 #endif
@@ -40,6 +41,14 @@ SurfaceIntersectionSingleton::SurfaceIntersectionSingleton() : ParmContainer()
 
     m_MessageName = "SurfIntersectMessage";
 
+    m_DeferOutputFlag = false;
+
+    m_StageResultsName = "Surface_Intersection_Timing";
+    m_StageRunningFlag = false;
+    m_StageWallStart = 0;
+    m_StageCPUStart = 0;
+    m_StageCancelledFlag = false;
+
 #ifdef DEBUG_CFD_MESH
     m_DebugDir  = Stringc( "MeshDebug/" );
     _mkdir( m_DebugDir.get_char_star() );
@@ -52,6 +61,7 @@ SurfaceIntersectionSingleton::SurfaceIntersectionSingleton() : ParmContainer()
 SurfaceIntersectionSingleton::~SurfaceIntersectionSingleton()
 {
     CleanUp();
+    ClearPatchCache();
 
 #ifdef DEBUG_CFD_MESH
     if ( m_DebugFile )
@@ -74,10 +84,12 @@ void SurfaceIntersectionSingleton::ParmChanged( Parm* parm_ptr, int type )
 void SurfaceIntersectionSingleton::IntersectSurfaces()
 {
     m_MeshInProgress = true;
+    SetCancelFlag( false );
+    ClearMeshStages();
 
     TransferMeshSettings();
 
-    addOutputText( "Fetching Bezier Surfaces\n" );
+    StartMeshStage( "Fetching Bezier Surfaces" );
 
     vector< XferSurf > xfersurfs;
     FetchSurfs( xfersurfs );
@@ -86,7 +98,7 @@ void SurfaceIntersectionSingleton::IntersectSurfaces()
     m_Vehicle->HideAll();
 
     CleanUp();
-    addOutputText( "Loading Bezier Surfaces\n" );
+    StartMeshStage( "Loading Bezier Surfaces" );
     LoadSurfs( xfersurfs );
 
     TransferSubSurfData();
@@ -98,37 +110,183 @@ void SurfaceIntersectionSingleton::IntersectSurfaces()
     if ( m_SurfVec.size() == 0 )
     {
         addOutputText( "No Surfaces To Mesh\n" );
+        WriteMeshStageResults();
         m_MeshInProgress = false;
         return;
     }
 
-    addOutputText( "Build Grid\n" );
+    if ( !StartMeshStage( "Build Grid" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     BuildGrid();
 
-//    auto t1 = std::chrono::high_resolution_clock::now();
-
-    addOutputText( "Intersect\n" );
+    if ( !StartMeshStage( "Intersect" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     Intersect();
     addOutputText( "Finished Intersect\n" );
 
-//    auto t2 = std::chrono::high_resolution_clock::now();
-//    printf( "Intersect took %lld mus %f ms %f sec\n", std::chrono::duration_cast<std::chrono::microseconds>(t2-t1).count(), std::chrono::duration_cast<std::chrono::microseconds>(t2-t1).count()/1000.0, std::chrono::duration_cast<std::chrono::microseconds>(t2-t1).count()/1000000.0 );
-
-    addOutputText( "Binary Adaptation Curve Approximation\n" );
+    if ( !StartMeshStage( "Binary Adaptation Curve Approximation" ) )
+    {
+        EndMeshRun();
+        return;
+    }
     BinaryAdaptIntCurves();
 
-    addOutputText( "Exporting Files\n" );
+    StartMeshStage( "Exporting Files" );
     ExportFiles();
 
+    WriteMeshStageResults();
+
     addOutputText( "Done\n" );
 
     m_MeshInProgress = false;
 }
 
+//==== Cancellation ====//
+volatile bool SurfaceIntersectionSingleton::m_CancelFlag = false;
+
+void SurfaceIntersectionSingleton::SetCancelFlag( bool flag )
+{
+    m_CancelFlag = flag;
+#pragma omp flush
+}
+
+bool SurfaceIntersectionSingleton::GetCancelFlag()
+{
+#pragma omp flush
+    return m_CancelFlag;
+}
+
+//==== Stage Timing ====//
+void SurfaceIntersectionSingleton::ClearMeshStages()
+{
+    m_StageNameVec.clear();
+    m_StageWallTimeVec.clear();
+    m_StageCPUTimeVec.clear();
+    m_StagePeakMemVec.clear();
+    m_StageRunningFlag = false;
+    m_StageCancelledFlag = false;
+}
+
+bool SurfaceIntersectionSingleton::StartMeshStage( const string & name )
+{
+    EndMeshStage();
+
+    if ( GetCancelFlag() )
+    {
+        if ( !m_StageCancelledFlag )
+        {
+            addOutputText( "Meshing Cancelled\n" );
+        }
+        m_StageCancelledFlag = true;
+        return false;
+    }
+
+    addOutputText( name + "\n" );
+
+    m_StageNameVec.push_back( name );
+    m_StageRunningFlag = true;
+    m_StageWallStart = GetWallTime();
+    m_StageCPUStart = GetProcessCPUTime();
+
+    return true;
+}
+
+void SurfaceIntersectionSingleton::EndMeshStage()
+{
+    if ( !m_StageRunningFlag )
+    {
+        return;
+    }
+
+    double wall = GetWallTime() - m_StageWallStart;
+
+#ifndef VSP_NO_PERF_STATS
+    if ( PerfStatsMgr.GetEnabled() && !m_StageNameVec.empty() )
+    {
+        double end = PerfStatsMgr.Now();
+        PerfStatsMgr.AddTime( PerfStatsMgr.StoreName( m_StageResultsName + ":" + m_StageNameVec.back() ), end - wall, end );
+    }
+#endif
+
+    m_StageWallTimeVec.push_back( wall );
+    m_StageCPUTimeVec.push_back( GetProcessCPUTime() - m_StageCPUStart );
+    m_StagePeakMemVec.push_back( GetPeakMemoryMB() );
+    m_StageRunningFlag = false;
+}
+
+void SurfaceIntersectionSingleton::EndMeshRun()
+{
+    WriteMeshStageResults();
+    m_MeshInProgress = false;
+}
+
+size_t SurfaceIntersectionSingleton::MemoryUsage() const
+{
+    int i;
+    size_t bytes = vector_mem_bytes( m_SurfVec );
+    for ( i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    {
+        bytes += m_SurfVec[i]->MemoryUsage();
+    }
+
+    bytes += m_ISegChainList.size() * ( sizeof( ISegChain ) + 3 * sizeof( void* ) );
+    bytes += vector_mem_bytes( m_DelPuwVec ) + m_DelPuwVec.size() * sizeof( Puw );
+    bytes += vector_mem_bytes( m_DelIPntVec ) + m_DelIPntVec.size() * sizeof( IPnt );
+    bytes += vector_mem_bytes( m_DelIPntGroupVec ) + m_DelIPntGroupVec.size() * sizeof( IPntGroup );
+
+    bytes += vector_mem_bytes( m_IPatchADrawLines ) + vector_mem_bytes( m_IPatchBDrawLines );
+    bytes += vector_mem_bytes( m_BinAdaptCurveAVec ) + vector_mem_bytes( m_BinAdaptCurveBVec );
+    bytes += vector_mem_bytes( m_RawCurveAVec ) + vector_mem_bytes( m_RawCurveBVec );
+    bytes += vector_mem_bytes( m_IntersectCacheKey ) + vector_mem_bytes( m_IntersectCachePairVec ) + vector_mem_bytes( m_IntersectCacheSegVec );
+    bytes += m_IsectCurveDO.MemoryUsage();
+
+    return bytes;
+}
+
+Results* SurfaceIntersectionSingleton::WriteMeshStageResults()
+{
+    EndMeshStage();
+
+    Results* res = ResultsMgr.CreateResults( m_StageResultsName );
+    if ( !res )
+    {
+        return NULL;
+    }
+
+    double total_wall = 0;
+    double total_cpu = 0;
+    double peak_mem = 0;
+    for ( int i = 0 ; i < ( int )m_StageWallTimeVec.size() ; i++ )
+    {
+        total_wall += m_StageWallTimeVec[i];
+        total_cpu += m_StageCPUTimeVec[i];
+        peak_mem = max( peak_mem, m_StagePeakMemVec[i] );
+    }
+
+    res->Add( NameValData( "Stage_Name", m_StageNameVec ) );
+    res->Add( NameValData( "Stage_Wall_Time_Sec", m_StageWallTimeVec ) );
+    res->Add( NameValData( "Stage_CPU_Time_Sec", m_StageCPUTimeVec ) );
+    res->Add( NameValData( "Stage_Peak_Memory_MB", m_StagePeakMemVec ) );
+    res->Add( NameValData( "Total_Wall_Time_Sec", total_wall ) );
+    res->Add( NameValData( "Total_CPU_Time_Sec", total_cpu ) );
+    res->Add( NameValData( "Peak_Memory_MB", peak_mem ) );
+    res->Add( NameValData( "Cancelled", ( int )m_StageCancelledFlag ) );
+
+    return res;
+}
+
 void SurfaceIntersectionSingleton::CleanUp()
 {
     int i;
-    //==== Delete Old Surfs ====//
+    //==== Keep Patches for the Next Run, Then Delete Old Surfs ====//
+    StoreSurfPatches();
+
     for ( i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         delete m_SurfVec[i];
@@ -277,9 +435,12 @@ vector< SimpleSubSurface > SurfaceIntersectionSingleton::GetSimpSubSurfs( string
 
 void SurfaceIntersectionSingleton::addOutputText( const string &str, int output_type )
 {
-    if ( output_type != QUIET_OUTPUT )
+    if ( output_type != QUIET_OUTPUT && m_DeferOutputFlag )
+    {
+        m_DeferredOutputVec.push_back( str );
+    }
+    else if ( output_type != QUIET_OUTPUT )
     {
-
         MessageData data;
         data.m_String = m_MessageName;
         data.m_StringVec.push_back( str );
@@ -287,6 +448,20 @@ void SurfaceIntersectionSingleton::addOutputText( const string &str, int output_
     }
 }
 
+void SurfaceIntersectionSingleton::FlushOutputText()
+{
+    bool defer_flag = m_DeferOutputFlag;
+    m_DeferOutputFlag = false;
+
+    for ( int i = 0 ; i < ( int )m_DeferredOutputVec.size() ; i++ )
+    {
+        addOutputText( m_DeferredOutputVec[i] );
+    }
+    m_DeferredOutputVec.clear();
+
+    m_DeferOutputFlag = defer_flag;
+}
+
 void SurfaceIntersectionSingleton::FetchSurfs( vector< XferSurf > &xfersurfs )
 {
     m_Vehicle->FetchXFerSurfs( GetSettingsPtr()->m_SelectedSetIndex, xfersurfs );
@@ -323,7 +498,7 @@ void SurfaceIntersectionSingleton::LoadSurfs( vector< XferSurf > &xfersurfs, int
         surfPtr->SetCompID( cid );
         surfPtr->SetUnmergedCompID( cid );
         surfPtr->SetSurfID( start_surf_id + i );
-        surfPtr->GetSurfCore()->BuildPatches( surfPtr );
+        BuildSurfPatches( surfPtr );
         m_SurfVec.push_back( surfPtr );
     }
 
@@ -1226,10 +1401,12 @@ void SurfaceIntersectionSingleton::BuildNURBSCurvesVec()
 
 void SurfaceIntersectionSingleton::BuildCurves()
 {
-    list< ISegChain* >::iterator c;
-    for ( c = m_ISegChainList.begin() ; c != m_ISegChainList.end(); ++c )
+    vector< ISegChain* > chain_vec( m_ISegChainList.begin(), m_ISegChainList.end() );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int i = 0 ; i < ( int )chain_vec.size() ; i++ )
     {
-        ( *c )->BuildCurves();
+        chain_vec[i]->BuildCurves();
     }
 }
 
@@ -1238,12 +1415,76 @@ void SurfaceIntersectionSingleton::Intersect()
 
     if ( GetSettingsPtr()->m_IntersectSubSurfs ) BuildSubSurfIntChains();
 
-    //==== Quad Tree Intersection - Intersection Segments Get Loaded at AddIntersectionSeg ===//
-    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    //==== Broad Phase - Surface Pairs With Overlapping Bounding Boxes ====//
+    vector< pair< int, int > > pair_vec;
+    FindCandidateSurfPairs( pair_vec );
+
+    //==== Shared Border Curves Get Handled Here, In Pair Order ====//
+    vector< pair< int, int > > patch_pair_vec;
+    patch_pair_vec.reserve( pair_vec.size() );
+
+    for ( int k = 0 ; k < ( int )pair_vec.size() ; k++ )
+    {
+        if ( m_SurfVec[pair_vec[k].first]->IntersectCheck( m_SurfVec[pair_vec[k].second], this ) )
+        {
+            patch_pair_vec.push_back( pair_vec[k] );
+        }
+    }
+
+    //==== Sizing Changes Leave the Surfaces Alone - Reuse the Last Patch Intersections ====//
+    vector< double > cache_key;
+    BuildIntersectCacheKey( cache_key );
+
+    vector< vector< PatchIntersectSeg > > pair_seg_vec;
+
+    if ( cache_key == m_IntersectCacheKey && patch_pair_vec == m_IntersectCachePairVec )
+    {
+        addOutputText( "Reusing Surface Intersections\n" );
+
+        pair_seg_vec = m_IntersectCacheSegVec;
+
+        // Surfs are rebuilt every run, point the segments at the new ones
+        for ( int k = 0 ; k < ( int )pair_seg_vec.size() ; k++ )
+        {
+            for ( int s = 0 ; s < ( int )pair_seg_vec[k].size() ; s++ )
+            {
+                pair_seg_vec[k][s].m_SurfA = m_SurfVec[patch_pair_vec[k].first];
+                pair_seg_vec[k][s].m_SurfB = m_SurfVec[patch_pair_vec[k].second];
+            }
+        }
+    }
+    else
+    {
+        //==== Quad Tree Intersection - Each Pair Collects Its Own Segments ====//
+        pair_seg_vec.resize( patch_pair_vec.size() );
+
+        #pragma omp parallel for schedule( dynamic )
+        for ( int k = 0 ; k < ( int )patch_pair_vec.size() ; k++ )
+        {
+            if ( GetCancelFlag() )
+            {
+                continue;
+            }
+            m_SurfVec[patch_pair_vec[k].first]->IntersectPatches( m_SurfVec[patch_pair_vec[k].second], pair_seg_vec[k] );
+        }
+
+        // Skipped pairs leave the segments incomplete - keep the cache and stop here
+        if ( GetCancelFlag() )
+        {
+            return;
+        }
+
+        m_IntersectCacheKey = cache_key;
+        m_IntersectCachePairVec = patch_pair_vec;
+        m_IntersectCacheSegVec = pair_seg_vec;
+    }
+
+    //==== Intersection Segments Get Loaded at AddIntersectionSeg, In Pair Order ====//
+    for ( int k = 0 ; k < ( int )pair_seg_vec.size() ; k++ )
     {
-        for ( int j = i + 1; j < (int) m_SurfVec.size(); j++ )
+        for ( int s = 0 ; s < ( int )pair_seg_vec[k].size() ; s++ )
         {
-            m_SurfVec[i]->Intersect( m_SurfVec[j], this );
+            AddIntersectionSeg( pair_seg_vec[k][s] );
         }
     }
 
@@ -1270,7 +1511,179 @@ void SurfaceIntersectionSingleton::Intersect()
     BuildCurves();
 }
 
-void SurfaceIntersectionSingleton::AddIntersectionSeg( const SurfPatch& pA, const SurfPatch& pB, const vec3d & ip0, const vec3d & ip1 )
+//==== Everything the Patch Intersections Depend On ====//
+void SurfaceIntersectionSingleton::BuildIntersectCacheKey( vector< double > & key )
+{
+    key.clear();
+    key.push_back( m_SurfVec.size() );
+
+    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    {
+        Surf* surf = m_SurfVec[i];
+        key.push_back( surf->GetCompID() );
+        key.push_back( surf->GetSurfID() );
+        key.push_back( surf->GetSurfaceCfdType() );
+        key.push_back( surf->GetFlipFlag() );
+        key.push_back( surf->GetWakeFlag() );
+        key.push_back( surf->GetSymPlaneFlag() );
+        key.push_back( surf->GetFarFlag() );
+        key.push_back( surf->GetPatchVec().size() );
+
+        surf->GetSurfCore()->AppendSignature( key );
+    }
+}
+
+void SurfaceIntersectionSingleton::ClearIntersectCache()
+{
+    m_IntersectCacheKey.clear();
+    m_IntersectCachePairVec.clear();
+    m_IntersectCacheSegVec.clear();
+}
+
+//==== Take the Last Run's Patches When the Surface Is Unchanged, Otherwise Build Them ====//
+//==== Geom ID and Surf Index, or the Wake's Parent - Empty for Surfs That Are Not Cached ====//
+string SurfaceIntersectionSingleton::BuildPatchCacheKey( Surf* surf )
+{
+    if ( surf->GetWakeFlag() )
+    {
+        if ( surf->GetRefGeomID().empty() )
+        {
+            return string();
+        }
+        return "Wake:" + surf->GetRefGeomID() + ":" + std::to_string( surf->GetWakeParentSurfID() );
+    }
+
+    if ( surf->GetGeomID().empty() )
+    {
+        return string();
+    }
+    return surf->GetGeomID() + ":" + std::to_string( surf->GetMainSurfID() );
+}
+
+void SurfaceIntersectionSingleton::BuildSurfPatches( Surf* surf )
+{
+    string key = BuildPatchCacheKey( surf );
+
+    if ( key.empty() )
+    {
+        surf->GetSurfCore()->BuildPatches( surf );
+        return;
+    }
+
+    map< string, SurfPatchCacheEntry >::iterator it = m_PatchCacheMap.find( key );
+    if ( it != m_PatchCacheMap.end() )
+    {
+        vector< double > sig;
+        surf->GetSurfCore()->AppendSignature( sig );
+
+        if ( sig == it->second.m_Signature )
+        {
+            // The patches and their cached splits still point at the last run's Surf
+            for ( int i = 0 ; i < ( int )it->second.m_PatchVec.size() ; i++ )
+            {
+                it->second.m_PatchVec[i]->reset_surf_ptr( surf );
+            }
+
+            surf->SetPatchVec( it->second.m_PatchVec );
+            surf->GetBBox() = it->second.m_BBox;
+
+            m_PatchCacheMap.erase( it );
+            return;
+        }
+
+        for ( int i = 0 ; i < ( int )it->second.m_PatchVec.size() ; i++ )
+        {
+            delete it->second.m_PatchVec[i];
+        }
+        m_PatchCacheMap.erase( it );
+    }
+
+    surf->GetSurfCore()->BuildPatches( surf );
+}
+
+//==== Move the Patches of Surfs Loaded From Geoms and Their Wakes in to the Cache ====//
+void SurfaceIntersectionSingleton::StoreSurfPatches()
+{
+    // Entries the last run did not pick up are for surfaces that changed or went away
+    ClearPatchCache();
+
+    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    {
+        Surf* surf = m_SurfVec[i];
+
+        string key = BuildPatchCacheKey( surf );
+
+        if ( key.empty() )
+        {
+            continue;
+        }
+
+        if ( m_PatchCacheMap.find( key ) == m_PatchCacheMap.end() )
+        {
+            SurfPatchCacheEntry & entry = m_PatchCacheMap[key];
+            surf->GetSurfCore()->AppendSignature( entry.m_Signature );
+            entry.m_PatchVec = surf->GetPatchVec();
+            entry.m_BBox = surf->GetBBox();
+
+            // The cache owns the patches now
+            surf->SetPatchVec( vector< SurfPatch* >() );
+        }
+    }
+}
+
+void SurfaceIntersectionSingleton::ClearPatchCache()
+{
+    map< string, SurfPatchCacheEntry >::iterator it;
+    for ( it = m_PatchCacheMap.begin() ; it != m_PatchCacheMap.end() ; ++it )
+    {
+        for ( int i = 0 ; i < ( int )it->second.m_PatchVec.size() ; i++ )
+        {
+            delete it->second.m_PatchVec[i];
+        }
+    }
+    m_PatchCacheMap.clear();
+}
+
+//==== Sweep Surface Bounding Boxes in X for Pairs That May Intersect ====//
+void SurfaceIntersectionSingleton::FindCandidateSurfPairs( vector< pair< int, int > > & pair_vec )
+{
+    pair_vec.clear();
+
+    int nsurf = ( int )m_SurfVec.size();
+
+    vector< pair< double, int > > xmin_vec( nsurf );
+    for ( int i = 0 ; i < nsurf ; i++ )
+    {
+        xmin_vec[i] = make_pair( m_SurfVec[i]->GetBBox().GetMin( 0 ), i );
+    }
+    sort( xmin_vec.begin(), xmin_vec.end() );
+
+    // Same tolerance as the Compare in Surf::IntersectCheck, so no pair it would keep is missed
+    double tol = 1.0e-12;
+
+    for ( int a = 0 ; a < nsurf ; a++ )
+    {
+        int i = xmin_vec[a].second;
+        double xmax = m_SurfVec[i]->GetBBox().GetMax( 0 );
+
+        for ( int b = a + 1 ; b < nsurf && ( xmin_vec[b].first - xmax ) <= tol ; b++ )
+        {
+            int j = xmin_vec[b].second;
+
+            if ( m_SurfVec[i]->GetCompID() != m_SurfVec[j]->GetCompID() &&
+                 Compare( m_SurfVec[i]->GetBBox(), m_SurfVec[j]->GetBBox() ) )
+            {
+                pair_vec.push_back( make_pair( min( i, j ), max( i, j ) ) );
+            }
+        }
+    }
+
+    // Back in to the order of the original all pairs loop
+    sort( pair_vec.begin(), pair_vec.end() );
+}
+
+//==== Filter and Project a Patch Intersection Segment - Safe to Call From Multiple Threads ====//
+void SurfaceIntersectionSingleton::FindIntersectionSeg( const SurfPatch& pA, const SurfPatch& pB, const vec3d & ip0, const vec3d & ip1, vector< PatchIntersectSeg > & seg_vec )
 {
     double d = dist_squared( ip0, ip1 );
     if ( d < DBL_EPSILON )
@@ -1349,31 +1762,49 @@ void SurfaceIntersectionSingleton::AddIntersectionSeg( const SurfPatch& pA, cons
     vec2d proj_uwB1;
     pB.find_closest_uw( ip1, plane_uwB1.v, proj_uwB1.v );
 
-    Puw* puwA0 = new Puw( pA.get_surf_ptr(), proj_uwA0 );
+    PatchIntersectSeg seg;
+    seg.m_SurfA = pA.get_surf_ptr();
+    seg.m_SurfB = pB.get_surf_ptr();
+    seg.m_UWA[0] = proj_uwA0;
+    seg.m_UWA[1] = proj_uwA1;
+    seg.m_UWB[0] = proj_uwB0;
+    seg.m_UWB[1] = proj_uwB1;
+    seg.m_Pnt[0] = ip0;
+    seg.m_Pnt[1] = ip1;
+
+    // Identify rectangles to represent final patches
+    seg.m_PatchADrawLines = pA.GetPatchDrawLines();
+    seg.m_PatchBDrawLines = pB.GetPatchDrawLines();
+
+    seg_vec.push_back( seg );
+}
+
+void SurfaceIntersectionSingleton::AddIntersectionSeg( const PatchIntersectSeg & seg )
+{
+    Puw* puwA0 = new Puw( seg.m_SurfA, seg.m_UWA[0] );
     m_DelPuwVec.push_back( puwA0 );
 
-    Puw* puwB0 = new Puw( pB.get_surf_ptr(), proj_uwB0 );
+    Puw* puwB0 = new Puw( seg.m_SurfB, seg.m_UWB[0] );
     m_DelPuwVec.push_back( puwB0 );
 
     IPnt* ipnt0 = new IPnt( puwA0, puwB0 );
-    ipnt0->m_Pnt = ip0;
+    ipnt0->m_Pnt = seg.m_Pnt[0];
     m_DelIPntVec.push_back( ipnt0 );
 
-    Puw* puwA1 = new Puw( pA.get_surf_ptr(), proj_uwA1 );
+    Puw* puwA1 = new Puw( seg.m_SurfA, seg.m_UWA[1] );
     m_DelPuwVec.push_back( puwA1 );
 
-    Puw* puwB1 = new Puw( pB.get_surf_ptr(), proj_uwB1 );
+    Puw* puwB1 = new Puw( seg.m_SurfB, seg.m_UWB[1] );
     m_DelPuwVec.push_back( puwB1 );
 
     IPnt* ipnt1 = new IPnt( puwA1, puwB1 );
-    ipnt1->m_Pnt = ip1;
+    ipnt1->m_Pnt = seg.m_Pnt[1];
     m_DelIPntVec.push_back( ipnt1 );
 
-    // Identify rectangles to represent final patches
-    m_IPatchADrawLines.push_back( pA.GetPatchDrawLines() );
-    m_IPatchBDrawLines.push_back( pB.GetPatchDrawLines() );
+    m_IPatchADrawLines.push_back( seg.m_PatchADrawLines );
+    m_IPatchBDrawLines.push_back( seg.m_PatchBDrawLines );
 
-    new ISeg( pA.get_surf_ptr(), pB.get_surf_ptr(), ipnt0, ipnt1 );
+    new ISeg( seg.m_SurfA, seg.m_SurfB, ipnt0, ipnt1 );
 
     m_AllIPnts.push_back( ipnt0 );
     m_AllIPnts.push_back( ipnt1 );
@@ -1389,11 +1820,11 @@ void SurfaceIntersectionSingleton::AddIntersectionSeg( const SurfPatch& pA, cons
         onetime = false;
     }
 
-    double dA0 = dist( ip0, puwA0->m_Surf->CompPnt( puwA0->m_UW.x(), puwA0->m_UW.y() ) );
-    double dB0 = dist( ip0, puwB0->m_Surf->CompPnt( puwB0->m_UW.x(), puwB0->m_UW.y() ) );
+    double dA0 = dist( seg.m_Pnt[0], puwA0->m_Surf->CompPnt( puwA0->m_UW.x(), puwA0->m_UW.y() ) );
+    double dB0 = dist( seg.m_Pnt[0], puwB0->m_Surf->CompPnt( puwB0->m_UW.x(), puwB0->m_UW.y() ) );
 
-    double dA1 = dist( ip1, puwA0->m_Surf->CompPnt( puwA1->m_UW.x(), puwA1->m_UW.y() ) );
-    double dB1 = dist( ip1, puwB0->m_Surf->CompPnt( puwB1->m_UW.x(), puwB1->m_UW.y() ) );
+    double dA1 = dist( seg.m_Pnt[1], puwA0->m_Surf->CompPnt( puwA1->m_UW.x(), puwA1->m_UW.y() ) );
+    double dB1 = dist( seg.m_Pnt[1], puwB0->m_Surf->CompPnt( puwB1->m_UW.x(), puwB1->m_UW.y() ) );
 
     double total_d = dA0 + dB0 + dA1 + dB1;
 
@@ -1484,44 +1915,50 @@ void SurfaceIntersectionSingleton::BuildChains()
     // After the intersection chains are formed, refine them so that the value returned by CompPnt
     // will be the same with respect to each parent surface of the intersection point. Note, this 
     // must be done before the border curves are spit at each intersection chain end point.
-    list< ISegChain* >::iterator c;
-    for ( c = m_ISegChainList.begin(); c != m_ISegChainList.end(); ++c )
+    // Each IPnt belongs to one chain, so the chains are refined in parallel.
+    vector< ISegChain* > chain_vec( m_ISegChainList.begin(), m_ISegChainList.end() );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int c = 0 ; c < ( int )chain_vec.size() ; c++ )
     {
-        Puw* auw = ( *c )->m_ISegDeque.front()->m_IPnt[0]->GetPuw( ( *c )->m_SurfA );
-        Puw* buw = ( *c )->m_ISegDeque.front()->m_IPnt[0]->GetPuw( ( *c )->m_SurfB );
+        ISegChain* chain = chain_vec[c];
 
-        surface_point_type first_point;
-        first_point << ( *c )->m_ISegDeque.front()->m_IPnt[0]->m_Pnt.x(), ( *c )->m_ISegDeque.front()->m_IPnt[0]->m_Pnt.y(), ( *c )->m_ISegDeque.front()->m_IPnt[0]->m_Pnt.z();
+        RefineIPnt( chain->m_ISegDeque.front()->m_IPnt[0], chain->m_SurfA, chain->m_SurfB );
 
-        double uA, wA, uB, wB;
+        for ( int i = 0; i < (int)chain->m_ISegDeque.size(); i++ )
+        {
+            RefineIPnt( chain->m_ISegDeque[i]->m_IPnt[1], chain->m_SurfA, chain->m_SurfB );
+        }
+    }
+}
 
-        eli::geom::intersect::intersect( uA, wA, uB, wB, *( ( *c )->m_SurfA->GetSurfCore()->GetSurf() ),
-                                         *( ( *c )->m_SurfB->GetSurfCore()->GetSurf() ), first_point,
-                                         auw->m_UW[0], auw->m_UW[1], buw->m_UW[0], buw->m_UW[1] );
+//==== Make The Parameters Of An Intersection Point Agree On Both Surfaces ====//
+void SurfaceIntersectionSingleton::RefineIPnt( IPnt* ipnt, Surf* surfA, Surf* surfB )
+{
+    Puw* auw = ipnt->GetPuw( surfA );
+    Puw* buw = ipnt->GetPuw( surfB );
 
-        auw->m_UW[0] = uA;
-        auw->m_UW[1] = wA;
-        buw->m_UW[0] = uB;
-        buw->m_UW[1] = wB;
+    // Points such as shared border curve points already agree, skip the solve
+    const double tol = 1.0e-12;
+    if ( dist_squared( surfA->CompPnt( auw->m_UW[0], auw->m_UW[1] ),
+                       surfB->CompPnt( buw->m_UW[0], buw->m_UW[1] ) ) < tol * tol )
+    {
+        return;
+    }
 
-        for ( int i = 0; i < (int)( *c )->m_ISegDeque.size(); i++ )
-        {
-            auw = ( *c )->m_ISegDeque[i]->m_IPnt[1]->GetPuw( ( *c )->m_SurfA );
-            buw = ( *c )->m_ISegDeque[i]->m_IPnt[1]->GetPuw( ( *c )->m_SurfB );
+    surface_point_type ip;
+    ip << ipnt->m_Pnt.x(), ipnt->m_Pnt.y(), ipnt->m_Pnt.z();
 
-            surface_point_type ip;
-            ip << ( *c )->m_ISegDeque[i]->m_IPnt[1]->m_Pnt.x(), ( *c )->m_ISegDeque[i]->m_IPnt[1]->m_Pnt.y(), ( *c )->m_ISegDeque[i]->m_IPnt[1]->m_Pnt.z();
+    double uA, wA, uB, wB;
 
-            eli::geom::intersect::intersect( uA, wA, uB, wB, *( ( *c )->m_SurfA->GetSurfCore()->GetSurf() ),
-                                             *( ( *c )->m_SurfB->GetSurfCore()->GetSurf() ), ip,
-                                             auw->m_UW[0], auw->m_UW[1], buw->m_UW[0], buw->m_UW[1] );
+    eli::geom::intersect::intersect( uA, wA, uB, wB, *( surfA->GetSurfCore()->GetSurf() ),
+                                     *( surfB->GetSurfCore()->GetSurf() ), ip,
+                                     auw->m_UW[0], auw->m_UW[1], buw->m_UW[0], buw->m_UW[1] );
 
-            auw->m_UW[0] = uA;
-            auw->m_UW[1] = wA;
-            buw->m_UW[0] = uB;
-            buw->m_UW[1] = wB;
-        }
-    }
+    auw->m_UW[0] = uA;
+    auw->m_UW[1] = wA;
+    buw->m_UW[0] = uB;
+    buw->m_UW[1] = wB;
 }
 
 void SurfaceIntersectionSingleton::ExpandChain( ISegChain* chain, PNTree* PN_tree )
@@ -2478,37 +2915,38 @@ void SurfaceIntersectionSingleton::BinaryAdaptIntCurves()
     m_RawCurveBVec.clear();
     m_BorderCurveFlagVec.clear();
 
-    list<ISegChain *>::iterator c;
-    for ( c = m_ISegChainList.begin(); c != m_ISegChainList.end(); ++c )
-    {
-        m_BorderCurveFlagVec.push_back( (*c)->m_BorderFlag );
-
-        vector<vec3d> ptvec;
-        vector<vec3d> rawptvec;
-
-        Bezier_curve xyzcrvA = (*c)->m_ACurve.GetUWCrv();
-        xyzcrvA.TessAdaptXYZ( *(*c)->m_ACurve.GetSurf(), ptvec, GetSettingsPtr()->m_RelCurveTol, 16 );
-
-        m_BinAdaptCurveAVec.push_back( ptvec );
+    vector< ISegChain* > chain_vec( m_ISegChainList.begin(), m_ISegChainList.end() );
+    int nchain = ( int )chain_vec.size();
 
-        xyzcrvA.UWCurveToXYZCurve( (*c)->m_ACurve.GetSurf() );
-        xyzcrvA.GetControlPoints( rawptvec );
+    for ( int i = 0 ; i < nchain ; i++ )
+    {
+        m_BorderCurveFlagVec.push_back( chain_vec[i]->m_BorderFlag );
+    }
 
-        m_RawCurveAVec.push_back( rawptvec );
+    //==== Chains Are Independent - Each Fills Its Own Slot ====//
+    m_BinAdaptCurveAVec.resize( nchain );
+    m_BinAdaptCurveBVec.resize( nchain );
+    m_RawCurveAVec.resize( nchain );
+    m_RawCurveBVec.resize( nchain );
 
+    double tol = GetSettingsPtr()->m_RelCurveTol;
 
-        ptvec.clear();
-        rawptvec.clear();
-        Bezier_curve xyzcrvB = (*c)->m_BCurve.GetUWCrv();
-        xyzcrvB.TessAdaptXYZ( *(*c)->m_BCurve.GetSurf(), ptvec, GetSettingsPtr()->m_RelCurveTol, 16 );
+    #pragma omp parallel for schedule( dynamic )
+    for ( int i = 0 ; i < nchain ; i++ )
+    {
+        ISegChain* c = chain_vec[i];
 
-        m_BinAdaptCurveBVec.push_back( ptvec );
+        Bezier_curve xyzcrvA = c->m_ACurve.GetUWCrv();
+        xyzcrvA.TessAdaptXYZ( *c->m_ACurve.GetSurf(), m_BinAdaptCurveAVec[i], tol, 16 );
 
-        xyzcrvB.UWCurveToXYZCurve( (*c)->m_BCurve.GetSurf() );
-        xyzcrvB.GetControlPoints( rawptvec );
+        xyzcrvA.UWCurveToXYZCurve( c->m_ACurve.GetSurf() );
+        xyzcrvA.GetControlPoints( m_RawCurveAVec[i] );
 
-        m_RawCurveBVec.push_back( rawptvec );
+        Bezier_curve xyzcrvB = c->m_BCurve.GetUWCrv();
+        xyzcrvB.TessAdaptXYZ( *c->m_BCurve.GetSurf(), m_BinAdaptCurveBVec[i], tol, 16 );
 
+        xyzcrvB.UWCurveToXYZCurve( c->m_BCurve.GetSurf() );
+        xyzcrvB.GetControlPoints( m_RawCurveBVec[i] );
     }
 }
 
@@ -22,6 +22,7 @@
 //
 //  Intersect: Intersect all surfaces.  Intersect Y Slice Plane.
 //      Surf::Intersect - subdivide in to patchs, keep splitting till planer, intersect.
+//          CfdMeshMgr::FindIntersectionSeg - Project intersection segment to both surfaces.
 //          CfdMeshMgr::AddIntersectionSeg - Create intersection points and segments.
 //
 //      CfdMeshMgr::LoadBorderCurves: Tesselate border curves, build border chains.
@@ -85,6 +86,15 @@
 using namespace std;
 
 
+//==== Patch Hierarchy of One Surface, Kept Between Runs ====//
+class SurfPatchCacheEntry
+{
+public:
+    vector< double > m_Signature;         // SurfCore::AppendSignature of the surface the patches were built from
+    vector< SurfPatch* > m_PatchVec;
+    BndBox m_BBox;
+};
+
 class SurfaceIntersectionSingleton : public ParmContainer
 {
 protected:
@@ -119,6 +129,24 @@ public:
 
     void addOutputText( const string &str, int output_type = VOCAL_OUTPUT );
 
+    // Managers running off the main thread queue their messages until FlushOutputText
+    void SetDeferOutputFlag( bool flag )
+    {
+        m_DeferOutputFlag = flag;
+    }
+    void FlushOutputText();
+
+    //==== Cooperative Cancellation, Shared by Every Mesh Manager ====//
+    // Checked between stages and inside the intersection and remesh loops
+    static void SetCancelFlag( bool flag );
+    static bool GetCancelFlag();
+
+    // Publish the stage timing of the last run as a Results object named m_StageResultsName
+    virtual Results* WriteMeshStageResults();
+
+    // Approximate bytes held by the surfaces, meshes, intersection curves and caches
+    virtual size_t MemoryUsage() const;
+
 //  virtual void Draw();
 //  virtual void Draw_BBox( BndBox box );
     virtual void LoadDrawObjs( vector< DrawObj* > & draw_obj_vec );
@@ -151,12 +179,21 @@ public:
     virtual void Intersect();
 
 //  virtual void AddISeg( Surf* sA, Surf* sB, vec2d & sAuw0, vec2d & sAuw1,  vec2d & sBuw0, vec2d & sBuw1 );
-    virtual void AddIntersectionSeg( const SurfPatch& pA, const SurfPatch& pB, const vec3d & ip0, const vec3d & ip1 );
+    static void FindIntersectionSeg( const SurfPatch& pA, const SurfPatch& pB, const vec3d & ip0, const vec3d & ip1, vector< PatchIntersectSeg > & seg_vec );
+    virtual void AddIntersectionSeg( const PatchIntersectSeg & seg );
+    virtual void FindCandidateSurfPairs( vector< pair< int, int > > & pair_vec );
+    virtual void BuildIntersectCacheKey( vector< double > & key );
+    virtual void ClearIntersectCache();
+    virtual string BuildPatchCacheKey( Surf* surf );
+    virtual void BuildSurfPatches( Surf* surf );
+    virtual void StoreSurfPatches();
+    virtual void ClearPatchCache();
 //  virtual ISeg* CreateSurfaceSeg( Surf* sPtr, vec3d & p0, vec3d & p1, vec2d & uw0, vec2d & uw1 );
     virtual ISeg* CreateSurfaceSeg( Surf* surfA, vec2d & uwA0, vec2d & uwA1, Surf* surfB, vec2d & uwB0, vec2d & uwB1  );
 
     virtual void BuildChains();
     virtual void ExpandChain( ISegChain* chain, PNTree* PN_tree );
+    static void RefineIPnt( IPnt* ipnt, Surf* surfA, Surf* surfB );
 
     virtual void BuildCurves();
     virtual void IntersectSplitChains();
@@ -245,6 +282,12 @@ protected:
     // curves make up a group. 
     vector < vector < int > > GetCompIDGroupVec();
 
+    //==== Per-Stage Wall Time, CPU Time and Peak Memory ====//
+    void ClearMeshStages();
+    bool StartMeshStage( const string & name ); // Ends the running stage; false once cancelled
+    void EndMeshStage();
+    virtual void EndMeshRun();                  // Publishes the stages so far and ends the run
+
     Vehicle* m_Vehicle;
 
     bool m_MeshInProgress;
@@ -269,6 +312,14 @@ protected:
     vector < vector < vec3d > > m_IPatchADrawLines;
     vector < vector < vec3d > > m_IPatchBDrawLines;
 
+    //==== Patch Intersections From the Last Intersect, Reused While Surfaces Are Unchanged ====//
+    vector< double > m_IntersectCacheKey;
+    vector< pair< int, int > > m_IntersectCachePairVec;
+    vector< vector< PatchIntersectSeg > > m_IntersectCacheSegVec;
+
+    //==== Patch Hierarchies From the Last Run by Geom ID and Surf Index (or Wake Parent), Reused While the Surface Is Unchanged ====//
+    map< string, SurfPatchCacheEntry > m_PatchCacheMap;
+
     vector< vector< vec3d > > debugRayIsect;
 
     vector < vector < vec3d > > m_BinAdaptCurveAVec;
@@ -284,6 +335,22 @@ protected:
 
     string m_MessageName; // Either "SurfIntersectMessage", "CFDMessage", or "FEAMessage"
 
+    bool m_DeferOutputFlag;
+    vector < string > m_DeferredOutputVec;
+
+    string m_StageResultsName; // Either "Surface_Intersection_Timing", "CFD_Mesh_Timing", or "FEA_Mesh_Timing"
+
+    vector < string > m_StageNameVec;
+    vector < double > m_StageWallTimeVec;
+    vector < double > m_StageCPUTimeVec;      // Process-wide, so summed over the OpenMP threads
+    vector < double > m_StagePeakMemVec;      // Process peak in MB at the end of the stage
+    bool m_StageRunningFlag;
+    double m_StageWallStart;
+    double m_StageCPUStart;
+    bool m_StageCancelledFlag;
+
+    static volatile bool m_CancelFlag;
+
     // m_SurfVec translated to a vector of NURBS surfaces
     vector < NURBS_Surface > m_NURBSSurfVec;
 
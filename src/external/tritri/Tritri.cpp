@@ -25,6 +25,8 @@
 
 #include <math.h>
 
+#include "Tritri.h"
+
 #define FABS(x) ((double)fabs(x))        /* implement as is fastest on your machine */
 
 /* if USE_EPSILON_TEST is true then we do a check: 
@@ -719,3 +721,95 @@ int tri_tri_intersect_with_isectline(double V0[3],double V1[3],double V2[3],
   }
   return 1;
 }
+
+/* Batched rejection filter for tri_tri_intersect_with_isectline.
+ *
+ * Tests triangle (V0,V1,V2) against n triangles given in structure of arrays
+ * form, U[(k*3+a)*stride+i] holding coordinate a of vertex k of triangle i.
+ * The same two plane separation tests as the exact routine are done for all
+ * n at once in branch free loops the compiler can vectorize.  A pair is only
+ * rejected when one triangle lies strictly on one side of the other's plane
+ * by more than EPSILON plus a rounding allowance, so every rejected pair is
+ * one the exact routine also rejects.  The indices of the remaining pairs are
+ * written to survive[] in increasing order and their number returned.
+ */
+int tri_tri_reject_batch(const double V0[3],const double V1[3],const double V2[3],
+                         const double *U,int stride,int n,int survive[])
+{
+  double E1[3],E2[3],N1[3],d1;
+  double keep[TRI_TRI_BATCH];
+  const double *ux[3],*uy[3],*uz[3];
+  double scale,n1sum,tol1;
+  int i,k,num;
+
+  if(n>TRI_TRI_BATCH) n=TRI_TRI_BATCH;
+
+  for(k=0;k<3;k++)
+  {
+    ux[k]=U+(k*3+0)*stride;
+    uy[k]=U+(k*3+1)*stride;
+    uz[k]=U+(k*3+2)*stride;
+  }
+
+  /* largest coordinate magnitude bounds the rounding in the plane distances */
+  scale=0.0;
+  for(k=0;k<3;k++)
+  {
+    if(FABS(V0[k])>scale) scale=FABS(V0[k]);
+    if(FABS(V1[k])>scale) scale=FABS(V1[k]);
+    if(FABS(V2[k])>scale) scale=FABS(V2[k]);
+  }
+  for(k=0;k<3;k++)
+  {
+    for(i=0;i<n;i++)
+    {
+      double m=FABS(ux[k][i]);
+      if(FABS(uy[k][i])>m) m=FABS(uy[k][i]);
+      if(FABS(uz[k][i])>m) m=FABS(uz[k][i]);
+      if(m>scale) scale=m;
+    }
+  }
+
+  /* plane of V against every U */
+  SUB(E1,V1,V0);
+  SUB(E2,V2,V0);
+  CROSS(N1,E1,E2);
+  d1=-DOT(N1,V0);
+  n1sum=FABS(N1[0])+FABS(N1[1])+FABS(N1[2]);
+  tol1=EPSILON+1e-12*n1sum*2.0*scale;
+
+  for(i=0;i<n;i++)
+  {
+    double du0=N1[0]*ux[0][i]+N1[1]*uy[0][i]+N1[2]*uz[0][i]+d1;
+    double du1=N1[0]*ux[1][i]+N1[1]*uy[1][i]+N1[2]*uz[1][i]+d1;
+    double du2=N1[0]*ux[2][i]+N1[1]*uy[2][i]+N1[2]*uz[2][i]+d1;
+    int above=(du0>tol1)&(du1>tol1)&(du2>tol1);
+    int below=(du0<-tol1)&(du1<-tol1)&(du2<-tol1);
+    keep[i]=(double)!(above|below);
+  }
+
+  /* plane of every U against V */
+  for(i=0;i<n;i++)
+  {
+    double e1x=ux[1][i]-ux[0][i], e1y=uy[1][i]-uy[0][i], e1z=uz[1][i]-uz[0][i];
+    double e2x=ux[2][i]-ux[0][i], e2y=uy[2][i]-uy[0][i], e2z=uz[2][i]-uz[0][i];
+    double n2x=e1y*e2z-e1z*e2y;
+    double n2y=e1z*e2x-e1x*e2z;
+    double n2z=e1x*e2y-e1y*e2x;
+    double d2=-(n2x*ux[0][i]+n2y*uy[0][i]+n2z*uz[0][i]);
+    double tol2=EPSILON+1e-12*(FABS(n2x)+FABS(n2y)+FABS(n2z))*2.0*scale;
+    double dv0=n2x*V0[0]+n2y*V0[1]+n2z*V0[2]+d2;
+    double dv1=n2x*V1[0]+n2y*V1[1]+n2z*V1[2]+d2;
+    double dv2=n2x*V2[0]+n2y*V2[1]+n2z*V2[2]+d2;
+    int above=(dv0>tol2)&(dv1>tol2)&(dv2>tol2);
+    int below=(dv0<-tol2)&(dv1<-tol2)&(dv2<-tol2);
+    keep[i]=keep[i]*(double)!(above|below);
+  }
+
+  num=0;
+  for(i=0;i<n;i++)
+  {
+    if(keep[i]!=0.0) survive[num++]=i;
+  }
+  return num;
+}
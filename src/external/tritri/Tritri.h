@@ -47,6 +47,12 @@ int tri_tri_intersect_with_isectline(double V0[3],double V1[3],double V2[3],
 				     double U0[3],double U1[3],double U2[3],int *coplanar,
 				     double isectpt1[3],double isectpt2[3]);
 
+/* Triangles tested per tri_tri_reject_batch call */
+#define TRI_TRI_BATCH 8
+
+int tri_tri_reject_batch(const double V0[3],const double V1[3],const double V2[3],
+                         const double *U,int stride,int n,int survive[]);
+
 int intersect_triangle(double orig[3], double dir[3],
                    double vert0[3], double vert1[3], double vert2[3],
                    double *t, double *u, double *v);
@@ -87,6 +87,7 @@ enum CFD_CONTROL_TYPE {     CFD_MIN_EDGE_LEN,
                             CFD_WAKE_SCALE,
                             CFD_WAKE_ANGLE,
                             CFD_SRF_XYZ_FLAG,
+                            CFD_OUT_OF_CORE_FLAG,
                       };
 
 enum CFD_MESH_EXPORT_TYPE { CFD_STL_FILE_NAME,
@@ -168,6 +169,7 @@ enum COMPUTATION_FILE_TYPE  {   NO_FILE_TYPE        = 0,
                                 CFD_FACET_TYPE      = 1048576,
                                 CFD_CURV_TYPE       = 2097152,
                                 CFD_PLOT3D_TYPE     = 4194304,
+                                DEGEN_GEOM_BIN_TYPE = 8388608,
                             };
 
 enum DELIM_TYPE { DELIM_COMMA,
@@ -386,6 +388,10 @@ enum LEN_UNITS { LEN_MM,
                  LEN_UNITLESS
                };
 
+enum MASS_PROP_MODE { MASS_PROP_SLICE,      // Slice along X and sum prisms of the interior
+                      MASS_PROP_ANALYTIC    // Exact surface integrals over the trimmed meshes
+                    };
+
 enum MASS_UNIT { MASS_UNIT_G = 0,
                  MASS_UNIT_KG,
                  MASS_UNIT_TONNE,
@@ -37,9 +37,10 @@ ErrorObj::ErrorObj( const ErrorObj& from )
 //======================== Error Mgr ================================//
 //===================================================================//
 
+thread_local bool ErrorMgrSingleton::m_ErrorLastCallFlag = false;
+
 ErrorMgrSingleton::ErrorMgrSingleton()
 {
-    m_ErrorLastCallFlag = false;
     MessageBase::Register( string( "ErrorMgr" ) );
 }
 
@@ -65,6 +66,7 @@ bool ErrorMgrSingleton::GetErrorLastCallFlag()
 //==== How Many Total Errors on Stack? ====//
 int ErrorMgrSingleton::GetNumTotalErrors()
 {
+    std::lock_guard< std::mutex > lock( m_ErrorStackMutex );
     return m_ErrorStack.size();
 }
 
@@ -72,6 +74,7 @@ int ErrorMgrSingleton::GetNumTotalErrors()
 ErrorObj ErrorMgrSingleton::PopLastError()
 {
     ErrorObj ret_err;
+    std::lock_guard< std::mutex > lock( m_ErrorStackMutex );
 
     if ( m_ErrorStack.size() == 0 )         // Nothing To Undo
     {
@@ -89,6 +92,7 @@ ErrorObj ErrorMgrSingleton::PopLastError()
 ErrorObj ErrorMgrSingleton::GetLastError()
 {
     ErrorObj ret_err;
+    std::lock_guard< std::mutex > lock( m_ErrorStackMutex );
 
     if ( m_ErrorStack.size() == 0 )         // Nothing To Undo
     {
@@ -112,19 +116,25 @@ void ErrorMgrSingleton::AddError( ERROR_CODE code, const string & desc )
     }
 
     m_ErrorLastCallFlag = true;
+
+    std::lock_guard< std::mutex > lock( m_ErrorStackMutex );
     m_ErrorStack.push( ErrorObj( code, desc ) );
 }
 
 //==== Check For Error and Print to Stream if Found ====//
 bool ErrorMgrSingleton::PopErrorAndPrint( FILE* stream )
 {
-    if ( ! m_ErrorLastCallFlag || m_ErrorStack.size() == 0 )
+    ErrorObj err;
     {
-        return false;
-    }
+        std::lock_guard< std::mutex > lock( m_ErrorStackMutex );
+        if ( ! m_ErrorLastCallFlag || m_ErrorStack.size() == 0 )
+        {
+            return false;
+        }
 
-    ErrorObj err = m_ErrorStack.top();
-    m_ErrorStack.pop();
+        err = m_ErrorStack.top();
+        m_ErrorStack.pop();
+    }
 
     fprintf( stream, "Error Code: %d, Desc: %s\n", err.m_ErrorCode, err.m_ErrorString.c_str() );
     return true;
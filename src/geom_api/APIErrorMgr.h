@@ -17,6 +17,7 @@
 #include <string>
 #include <stack>
 #include <vector>
+#include <mutex>
 
 using std::string;
 using std::stack;
@@ -81,8 +82,10 @@ public:
 
 private:
 
-    bool m_ErrorLastCallFlag;
+    // API calls from scripts may run on several threads, e.g. custom Geom updates.
+    static thread_local bool m_ErrorLastCallFlag;      // Per thread, so each sees its own last call
     stack< ErrorObj > m_ErrorStack;
+    std::mutex m_ErrorStackMutex;
 
     ErrorMgrSingleton();
     ~ErrorMgrSingleton();
@@ -7,7 +7,11 @@
 
 #include "VSP_Geom_API.h"
 #include "APITestSuite.h"
+#include "ResultsMgr.h"
+#include "AdvLinkMgr.h"
 #include <float.h>
+#include <string.h>
+#include <math.h>
 
 //Default tolerance to use for tests.  Most calculations are done as doubles and choosing single precision FLT_MIN gives some allowance for precision stackup in calculations
 #define TEST_TOL FLT_MIN
@@ -183,6 +187,159 @@ void APITestSuite::CopyPasteGeometry()
 
 }
 
+//==== Test Batched Parm Set ====//
+void APITestSuite::TestParmBatch()
+{
+    printf( "APITestSuite::TestParmBatch()\n" );
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Add Pod And Wing Geoms ====//
+    string pod_id = vsp::AddGeom( "POD" );
+    string wing_id = vsp::AddGeom( "WING" );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vector< string > parm_id_vec;
+    parm_id_vec.push_back( vsp::GetParm( pod_id, "Length", "Design" ) );
+    parm_id_vec.push_back( vsp::GetParm( pod_id, "X_Rel_Location", "XForm" ) );
+    parm_id_vec.push_back( vsp::GetParm( wing_id, "TotalSpan", "WingGeom" ) );
+
+    vector< double > val_vec;
+    val_vec.push_back( 12.0 );
+    val_vec.push_back( 3.0 );
+    val_vec.push_back( 25.0 );
+
+    //==== Set All Values, Each Geom Is Updated Once ====//
+    vsp::SetParmValBatch( parm_id_vec, val_vec );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    for ( int i = 0; i < ( int )parm_id_vec.size(); i++ )
+    {
+        TEST_ASSERT_DELTA( vsp::GetParmVal( parm_id_vec[i] ), val_vec[i], TEST_TOL );
+    }
+
+    // The pod runs from its nose at X_Rel_Location to its tail one length behind.
+    double bbox_tol = 1.0e-6;
+    TEST_ASSERT_DELTA( vsp::GetGeomBBoxMax( pod_id ).x(), 15.0, bbox_tol );
+
+    //==== Explicit Batch, Update Deferred To EndParmBatch ====//
+    vsp::BeginParmBatch();
+    vsp::SetParmVal( parm_id_vec[0], 8.0 );
+    vsp::SetParmVal( parm_id_vec[1], -2.0 );
+    vsp::EndParmBatch();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    TEST_ASSERT_DELTA( vsp::GetParmVal( parm_id_vec[0] ), 8.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( parm_id_vec[1] ), -2.0, TEST_TOL );
+    TEST_ASSERT_DELTA( vsp::GetGeomBBoxMax( pod_id ).x(), 6.0, bbox_tol );
+
+    //==== Mismatched Vectors Are Rejected ====//
+    val_vec.pop_back();
+    vsp::SetParmValBatch( parm_id_vec, val_vec );
+    TEST_ASSERT( vsp::ErrorMgr.PopLastError().GetErrorCode() == vsp::VSP_INVALID_INPUT_VAL );
+    TEST_ASSERT_DELTA( vsp::GetParmVal( parm_id_vec[0] ), 8.0, TEST_TOL );
+
+    printf( "\n" );
+}
+
+
+//==== Test Native Advanced Links Against The Script Engine ====//
+void APITestSuite::TestAdvLinkNative()
+{
+    printf( "APITestSuite::TestAdvLinkNative()\n" );
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== One Input Pod, One Output Pod Per Link ====//
+    string pod_id = vsp::AddGeom( "POD" );
+    string native_pod_id = vsp::AddGeom( "POD" );
+    string script_pod_id = vsp::AddGeom( "POD" );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string len_id = vsp::GetParm( pod_id, "Length", "Design" );
+    string native_out_id = vsp::GetParm( native_pod_id, "Z_Rel_Location", "XForm" );
+    string script_out_id = vsp::GetParm( script_pod_id, "Z_Rel_Location", "XForm" );
+
+    // Int literals and a local exercise the AngelScript semantics the native path must match.
+    string code = "double t = x * 0.5;\n    y = 2.0 * t * t - sqrt( x ) / ( x + 1.0 ) + pow( x, 1.5 ) + 7 * 2;\n";
+    string script_code = "if ( x > 0.0 )\n    {\n    " + code + "    }\n";
+
+    vector< string > var_vec;
+    var_vec.push_back( "x" );
+    var_vec.push_back( "y" );
+    vector< double > init_vec( var_vec.size(), 0.0 );
+
+    AdvLinkExpr expr;
+    TEST_ASSERT( expr.Compile( code, var_vec, init_vec ) );
+    TEST_ASSERT( !expr.Compile( script_code, var_vec, init_vec ) );
+
+    //==== Same Code, Native And Script Evaluated ====//
+    AdvLink* native_link = AdvLinkMgr.AddLink( "NativeLink" );
+    AdvLinkMgr.AddInput( len_id, "x" );
+    AdvLinkMgr.AddOutput( native_out_id, "y" );
+    native_link->SetScriptCode( code );
+    TEST_ASSERT( native_link->BuildScript() );
+
+    AdvLink* script_link = AdvLinkMgr.AddLink( "ScriptLink" );
+    AdvLinkMgr.AddInput( len_id, "x" );
+    AdvLinkMgr.AddOutput( script_out_id, "y" );
+    script_link->SetScriptCode( script_code );
+    TEST_ASSERT( script_link->BuildScript() );
+
+    double len_vec[] = { 7.5, 1.25, 20.0 };
+    for ( int i = 0; i < 3; i++ )
+    {
+        double x = len_vec[i];
+        vsp::SetParmValUpdate( len_id, x );
+        TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+        double t = x * 0.5;
+        // The script engine's math functions are single precision.
+        double y = 2.0 * t * t - sqrtf( ( float )x ) / ( x + 1.0 ) + powf( ( float )x, 1.5f ) + 14.0;
+
+        TEST_ASSERT_DELTA( vsp::GetParmVal( script_out_id ), y, 1.0e-12 );
+        TEST_ASSERT_DELTA( vsp::GetParmVal( native_out_id ), vsp::GetParmVal( script_out_id ), 1.0e-12 );
+    }
+    AdvLinkMgr.DelAllLinks();
+
+    //==== Binary Ops Between Float Results And Ints Stay Float In AngelScript ====//
+    string float_code = "y = 2 * sin( x ) + sqrt( x ) * sqrt( x + 1.0 );\n";
+    string float_script_code = "if ( x > 0.0 )\n    {\n    " + float_code + "    }\n";
+
+    native_link = AdvLinkMgr.AddLink( "NativeFloatLink" );
+    AdvLinkMgr.AddInput( len_id, "x" );
+    AdvLinkMgr.AddOutput( native_out_id, "y" );
+    native_link->SetScriptCode( float_code );
+    TEST_ASSERT( native_link->BuildScript() );
+
+    script_link = AdvLinkMgr.AddLink( "ScriptFloatLink" );
+    AdvLinkMgr.AddInput( len_id, "x" );
+    AdvLinkMgr.AddOutput( script_out_id, "y" );
+    script_link->SetScriptCode( float_script_code );
+    TEST_ASSERT( script_link->BuildScript() );
+
+    for ( int i = 0; i < 3; i++ )
+    {
+        double x = len_vec[i];
+        vsp::SetParmValUpdate( len_id, x );
+        TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+        float s = 2.0f * sinf( ( float )x );
+        float p = sqrtf( ( float )x ) * sqrtf( ( float )( x + 1.0 ) );
+        double y = ( float )( s + p );
+
+        TEST_ASSERT_DELTA( vsp::GetParmVal( script_out_id ), y, 1.0e-12 );
+        TEST_ASSERT_DELTA( vsp::GetParmVal( native_out_id ), vsp::GetParmVal( script_out_id ), 1.0e-12 );
+    }
+
+    AdvLinkMgr.DelAllLinks();
+    printf( "\n" );
+}
+
 // Test of analysis manager
 void APITestSuite::CheckAnalysisMgr()
 {
@@ -272,6 +429,63 @@ void APITestSuite::TestAnalysesWithPod()
 
 }
 
+//==== Test Memoized Analysis Execution ====//
+void APITestSuite::TestAnalysisCache()
+{
+    printf( "APITestSuite::TestAnalysisCache()\n" );
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string pod_id = vsp::AddGeom( "POD" );
+    vsp::Update();
+
+    string analysis = "CompGeom";
+    vsp::SetAnalysisInputDefaults( analysis );
+    vsp::SetAnalysisCacheFlag( true );
+    TEST_ASSERT( vsp::GetAnalysisCacheFlag() );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Unchanged Vehicle And Inputs Return The Same Results ====//
+    string first_id = vsp::ExecAnalysis( analysis );
+    TEST_ASSERT( first_id.size() > 0 );
+    TEST_ASSERT( vsp::ExecAnalysis( analysis ) == first_id );
+
+    //==== Parm Edit Misses, Then Hits Again ====//
+    vsp::SetParmValUpdate( pod_id, "Length", "Design", 12.0 );
+    string parm_id = vsp::ExecAnalysis( analysis );
+    TEST_ASSERT( parm_id.size() > 0 && parm_id != first_id );
+    TEST_ASSERT( vsp::ExecAnalysis( analysis ) == parm_id );
+
+    //==== Adding And Editing A Sub-Surface Misses ====//
+    string ss_id = vsp::AddSubSurf( pod_id, vsp::SS_LINE );
+    vsp::Update();
+    string ss_add_id = vsp::ExecAnalysis( analysis );
+    TEST_ASSERT( ss_add_id.size() > 0 && ss_add_id != parm_id );
+
+    vsp::SetParmValUpdate( vsp::FindParm( ss_id, "Const_Line_Value", "SubSurface" ), 0.25 );
+    string ss_edit_id = vsp::ExecAnalysis( analysis );
+    TEST_ASSERT( ss_edit_id.size() > 0 && ss_edit_id != ss_add_id );
+    TEST_ASSERT( vsp::ExecAnalysis( analysis ) == ss_edit_id );
+
+    //==== Input Change Misses ====//
+    vsp::SetIntAnalysisInput( analysis, "HalfMeshFlag", vector< int >( 1, 1 ) );
+    string input_id = vsp::ExecAnalysis( analysis );
+    TEST_ASSERT( input_id.size() > 0 && input_id != ss_edit_id );
+
+    //==== Invalidated Or Disabled Cache Runs Again ====//
+    vsp::InvalidateAnalysisCache( analysis );
+    string invalid_id = vsp::ExecAnalysis( analysis );
+    TEST_ASSERT( invalid_id.size() > 0 && invalid_id != input_id );
+
+    vsp::SetAnalysisCacheFlag( false );
+    TEST_ASSERT( vsp::ExecAnalysis( analysis ) != invalid_id );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    printf( "\n" );
+}
+
 void APITestSuite::TestDXFExport()
 {
     printf( "APITestSuite::TestDXFExport()\n" );
@@ -477,6 +691,203 @@ void APITestSuite::TestFacetExport()
     printf( "\n" );
 }
 
+//==== Test Results ID Lookup And Per-Name Expiry ====//
+void APITestSuite::TestResultsExpiry()
+{
+    printf( "APITestSuite::TestResultsExpiry()\n" );
+    vsp::DeleteAllResults();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Every ID Finds Its Own Results ====//
+    vector< string > id_vec;
+    for ( int i = 0; i < 200; i++ )
+    {
+        id_vec.push_back( ResultsMgr.CreateResults( "Test_Index" )->GetID() );
+    }
+    TEST_ASSERT( vsp::GetNumResults( "Test_Index" ) == 200 );
+    for ( int i = 0; i < ( int )id_vec.size(); i++ )
+    {
+        TEST_ASSERT( vsp::GetResultsName( id_vec[i] ) == "Test_Index" );
+        TEST_ASSERT( vsp::FindResultsID( "Test_Index", i ) == id_vec[i] );
+    }
+
+    //==== Oldest Results Past The Limit Are Deleted ====//
+    ResultsMgr.SetMaxResultsPerName( 3 );
+    TEST_ASSERT( vsp::GetNumResults( "Test_Index" ) == 3 );
+    TEST_ASSERT( !ResultsMgr.ValidResultsID( id_vec[0] ) );
+    TEST_ASSERT( vsp::FindResultsID( "Test_Index", 0 ) == id_vec[197] );
+
+    string latest_id = ResultsMgr.CreateResults( "Test_Index" )->GetID();
+    TEST_ASSERT( vsp::GetNumResults( "Test_Index" ) == 3 );
+    TEST_ASSERT( !ResultsMgr.ValidResultsID( id_vec[197] ) );
+    TEST_ASSERT( ResultsMgr.ValidResultsID( id_vec[199] ) );
+    TEST_ASSERT( vsp::FindLatestResultsID( "Test_Index" ) == latest_id );
+
+    //==== Other Names Keep Their Own Count ====//
+    ResultsMgr.CreateResults( "Test_Other" );
+    TEST_ASSERT( vsp::GetNumResults( "Test_Other" ) == 1 );
+    TEST_ASSERT( vsp::GetNumResults( "Test_Index" ) == 3 );
+
+    ResultsMgr.SetMaxResultsPerName( 0 );
+    vsp::DeleteAllResults();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    printf( "\n" );
+}
+
+//==== Test Binary Results Export ====//
+void APITestSuite::TestResultsBinaryExport()
+{
+    printf( "APITestSuite::TestResultsBinaryExport()\n" );
+    vsp::DeleteAllResults();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== One Column Of Each Type ====//
+    vector< int > int_vec;
+    vector< double > dbl_vec;
+    vector< string > str_vec;
+    vector< vec3d > pnt_vec;
+    vector< vector< double > > mat;
+    for ( int i = 0; i < 50; i++ )
+    {
+        int_vec.push_back( i * i - 7 );
+        dbl_vec.push_back( 0.1 * i - 1.0e-3 / ( i + 1 ) );
+        str_vec.push_back( "Entry_" + std::to_string( i ) );
+        pnt_vec.push_back( vec3d( i, -2.0 * i, 0.5 * i ) );
+        mat.push_back( vector< double >( i % 4 + 1, 1.5 * i ) );
+    }
+
+    Results* res = ResultsMgr.CreateResults( "Test_Binary" );
+    res->Add( NameValData( "Ints", int_vec ) );
+    res->Add( NameValData( "Doubles", dbl_vec ) );
+    res->Add( NameValData( "Doubles", dbl_vec[3] ) );      // Second Data With The Same Name
+    res->Add( NameValData( "Strings", str_vec ) );
+    res->Add( NameValData( "Pnts", pnt_vec ) );
+    res->Add( NameValData( "Mat", mat ) );
+    string res_id = res->GetID();
+
+    string fname = "apitest_Results.vspr";
+    vsp::WriteResultsBinaryFile( res_id, fname );
+    vsp::WriteResultsBinaryFile( res_id, fname, true );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Header Once, Then One Record Per Write ====//
+    FILE* fid = fopen( fname.c_str(), "rb" );
+    TEST_ASSERT( fid != NULL );
+    if ( !fid )
+    {
+        return;
+    }
+
+    char magic[8];
+    int byte_order = 0;
+    TEST_ASSERT( fread( magic, sizeof( char ), 8, fid ) == 8 );
+    TEST_ASSERT( strncmp( magic, "VSPRSLT1", 8 ) == 0 );
+    TEST_ASSERT( fread( &byte_order, sizeof( int ), 1, fid ) == 1 );
+    TEST_ASSERT( byte_order == -123456789 );
+
+    map< string, string > id_map;
+    vector< string > read_id_vec;
+    Results* read_res = NULL;
+    while ( ( read_res = ResultsMgr.ReadBinaryResults( fid, id_map ) ) != NULL )
+    {
+        read_id_vec.push_back( read_res->GetID() );
+    }
+    fclose( fid );
+
+    TEST_ASSERT( read_id_vec.size() == 2 );
+    TEST_ASSERT( id_map[ res_id ] == read_id_vec.back() );
+
+    //==== Every Column Reads Back Unchanged ====//
+    for ( int r = 0; r < ( int )read_id_vec.size(); r++ )
+    {
+        string id = read_id_vec[r];
+        TEST_ASSERT( vsp::GetResultsName( id ) == "Test_Binary" );
+        TEST_ASSERT( vsp::GetIntResults( id, "Ints" ) == int_vec );
+        TEST_ASSERT( vsp::GetNumData( id, "Doubles" ) == 2 );
+        TEST_ASSERT( vsp::GetDoubleResults( id, "Doubles" ) == dbl_vec );
+        TEST_ASSERT( vsp::GetDoubleResults( id, "Doubles", 1 ) == vector< double >( 1, dbl_vec[3] ) );
+        TEST_ASSERT( vsp::GetStringResults( id, "Strings" ) == str_vec );
+        TEST_ASSERT( vsp::GetDoubleMatResults( id, "Mat" ) == mat );
+
+        const vector< vec3d > & read_pnt_vec = vsp::GetVec3dResults( id, "Pnts" );
+        TEST_ASSERT( read_pnt_vec.size() == pnt_vec.size() );
+        for ( int i = 0; i < ( int )read_pnt_vec.size() && i < ( int )pnt_vec.size(); i++ )
+        {
+            TEST_ASSERT( dist( read_pnt_vec[i], pnt_vec[i] ) == 0.0 );
+        }
+    }
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::DeleteAllResults();
+    printf( "\n" );
+}
+
+//==== Test Chunked Results And FEA Mesh Access ====//
+void APITestSuite::TestChunkedAccess()
+{
+    printf( "APITestSuite::TestChunkedAccess()\n" );
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    vsp::DeleteAllResults();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string pod_id = vsp::AddGeom( "POD" );
+    vsp::Update();
+
+    //==== Chunks Of Every XSec Concatenate To The Full Data ====//
+    string res_id = vsp::CreateGeomResults( pod_id, "Geom_Results" );
+    int num_xsec = vsp::GetNumData( res_id, "XSec_Pnts" );
+    TEST_ASSERT( num_xsec > 1 );
+
+    int chunk = 7;
+    for ( int ix = 0; ix < num_xsec; ix++ )
+    {
+        const vector< vec3d > & full_vec = vsp::GetVec3dResults( res_id, "XSec_Pnts", ix );
+        int len = vsp::GetResultsDataLength( res_id, "XSec_Pnts", ix );
+        TEST_ASSERT( len == ( int )full_vec.size() );
+
+        vector< vec3d > joined_vec;
+        for ( int start = 0; start < len; start += chunk )
+        {
+            vector< vec3d > chunk_vec = vsp::GetVec3dResultsChunk( res_id, "XSec_Pnts", start, chunk, ix );
+            TEST_ASSERT( ( int )chunk_vec.size() == std::min( chunk, len - start ) );
+            joined_vec.insert( joined_vec.end(), chunk_vec.begin(), chunk_vec.end() );
+        }
+
+        TEST_ASSERT( joined_vec.size() == full_vec.size() );
+        for ( int i = 0; i < ( int )joined_vec.size() && i < ( int )full_vec.size(); i++ )
+        {
+            TEST_ASSERT( dist( joined_vec[i], full_vec[i] ) == 0.0 );
+        }
+    }
+
+    //==== Chunks Past The End Are Clipped ====//
+    TEST_ASSERT( vsp::GetIntResultsChunk( res_id, "Num_XSecs", 0, 10 ) == vsp::GetIntResults( res_id, "Num_XSecs" ) );
+    TEST_ASSERT( vsp::GetIntResultsChunk( res_id, "Num_XSecs", 5, 10 ).empty() );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string mem_id = vsp::CreateMemoryUsageResults();
+    vector< string > data_names = vsp::GetAllDataNames( mem_id );
+    for ( int i = 0; i < ( int )data_names.size(); i++ )
+    {
+        int type = vsp::GetResultsType( mem_id, data_names[i] );
+        int len = vsp::GetResultsDataLength( mem_id, data_names[i] );
+        if ( type == vsp::DOUBLE_DATA )
+        {
+            TEST_ASSERT( vsp::GetDoubleResultsChunk( mem_id, data_names[i], 0, len ) == vsp::GetDoubleResults( mem_id, data_names[i] ) );
+        }
+        else if ( type == vsp::STRING_DATA )
+        {
+            TEST_ASSERT( vsp::GetStringResultsChunk( mem_id, data_names[i], 0, len ) == vsp::GetStringResults( mem_id, data_names[i] ) );
+        }
+    }
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    vsp::DeleteAllResults();
+    printf( "\n" );
+}
+
 void APITestSuite::TestSaveLoad()
 {
     printf( "APITestSuite::TestSaveLoad()\n" );
@@ -533,6 +944,116 @@ void APITestSuite::TestSaveLoad()
     printf( "\n" );
 }
 
+//==== Test Binary Snapshot Save And Load ====//
+void APITestSuite::TestBinarySaveLoad()
+{
+    printf( "APITestSuite::TestBinarySaveLoad()\n" );
+
+    // make sure setup works
+    vsp::VSPCheckSetup();
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Add Wing And Pod Geoms ====//
+    string wing_id = vsp::AddGeom( "WING" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( wing_id, "TotalSpan", "WingGeom", 30.0 ), 30.0, TEST_TOL );
+    string pod_id = vsp::AddGeom( "POD" );
+    TEST_ASSERT_DELTA( vsp::SetParmValUpdate( pod_id, "X_Rel_Location", "XForm", -9.0 ), -9.0, TEST_TOL );
+    vsp::Update();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Record Every Geom Parm Value ====//
+    vector< string > geom_vec = vsp::FindGeoms();
+    vector< string > parm_id_vec;
+    for ( int i = 0; i < ( int )geom_vec.size(); i++ )
+    {
+        vector< string > geom_parm_vec = vsp::GetGeomParmIDs( geom_vec[i] );
+        parm_id_vec.insert( parm_id_vec.end(), geom_parm_vec.begin(), geom_parm_vec.end() );
+    }
+    vector< double > val_vec( parm_id_vec.size() );
+    for ( int i = 0; i < ( int )parm_id_vec.size(); i++ )
+    {
+        val_vec[i] = vsp::GetParmVal( parm_id_vec[i] );
+    }
+
+    string fname = "apitest_BinarySaveLoad.vspb";
+    vsp::WriteVSPFile( fname );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //==== Same Model Loaded, Only The Values Are Restored ====//
+    vsp::SetParmValUpdate( wing_id, "TotalSpan", "WingGeom", 12.0 );
+    vsp::SetParmValUpdate( pod_id, "Length", "Design", 4.0 );
+    vsp::ReadVSPFile( fname );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    TEST_ASSERT( vsp::FindGeoms().size() == geom_vec.size() );
+    for ( int i = 0; i < ( int )parm_id_vec.size(); i++ )
+    {
+        TEST_ASSERT_DELTA( vsp::GetParmVal( parm_id_vec[i] ), val_vec[i], TEST_TOL );
+    }
+
+    //==== Empty Model, The Embedded Document Is Decoded ====//
+    vsp::VSPRenew();
+    vsp::ReadVSPFile( fname );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    TEST_ASSERT( vsp::FindGeoms().size() == geom_vec.size() );
+    for ( int i = 0; i < ( int )parm_id_vec.size(); i++ )
+    {
+        TEST_ASSERT( vsp::ValidParm( parm_id_vec[i] ) );
+        TEST_ASSERT_DELTA( vsp::GetParmVal( parm_id_vec[i] ), val_vec[i], TEST_TOL );
+    }
+
+    //==== Model Gained A Sub-Surface, Values Alone Cannot Restore It ====//
+    // The vehicle is cleared and the snapshot decoded, so the Sub-Surface is gone.
+    vsp::AddSubSurf( wing_id, vsp::SS_LINE );
+    vsp::SetParmValUpdate( pod_id, "Length", "Design", 4.0 );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    vsp::ReadVSPFile( fname );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    TEST_ASSERT( vsp::FindGeoms().size() == geom_vec.size() );
+    TEST_ASSERT( vsp::GetNumSubSurf( wing_id ) == 0 );
+    for ( int i = 0; i < ( int )parm_id_vec.size(); i++ )
+    {
+        TEST_ASSERT_DELTA( vsp::GetParmVal( parm_id_vec[i] ), val_vec[i], TEST_TOL );
+    }
+
+    //==== Same Geoms, But A Setting Outside Any Parm Changed ====//
+    vsp::SetGeomName( pod_id, "Renamed_Pod" );
+    vsp::ReadVSPFile( fname );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    TEST_ASSERT( vsp::FindGeoms().size() == geom_vec.size() );
+    TEST_ASSERT( vsp::GetGeomName( pod_id ) != string( "Renamed_Pod" ) );
+
+    //==== Truncated Snapshot Is Rejected Without Touching The Model ====//
+    FILE* fp = fopen( fname.c_str(), "rb" );
+    string file_str;
+    int c;
+    while ( fp && ( c = fgetc( fp ) ) != EOF )
+    {
+        file_str.push_back( ( char )c );
+    }
+    if ( fp )
+    {
+        fclose( fp );
+    }
+
+    string trunc_fname = "apitest_BinarySaveLoad_Truncated.vspb";
+    fp = fopen( trunc_fname.c_str(), "wb" );
+    if ( fp )
+    {
+        fwrite( file_str.data(), sizeof( char ), file_str.size() - 16, fp );
+        fclose( fp );
+    }
+    vsp::ReadVSPFile( trunc_fname );
+    TEST_ASSERT( vsp::ErrorMgr.PopErrorAndPrint( stdout ) );
+    TEST_ASSERT( vsp::FindGeoms().size() == geom_vec.size() );
+
+    printf( "\n" );
+}
+
 void APITestSuite::TestFEAMesh()
 {
     printf( "APITestSuite::TestFEAMesh()\n" );
@@ -656,6 +1177,39 @@ void APITestSuite::TestFEAMesh()
     printf( "\tGenerating FEA Mesh\n" );
     vsp::ComputeFeaMesh( pod_id, struct_ind, vsp::FEA_CALCULIX_FILE_NAME );
 
+    //==== Chunked Element Access Matches One Full Read ====//
+    int num_elem = vsp::GetFeaMeshNumElements();
+    TEST_ASSERT( num_elem > 0 );
+
+    vector< int > num_node_vec = vsp::GetFeaMeshElementNumNodes( 0, num_elem );
+    vector< int > node_vec = vsp::GetFeaMeshElementNodeChunk( 0, num_elem );
+    vector< vec3d > pnt_vec = vsp::GetFeaMeshElementPntChunk( 0, num_elem );
+    TEST_ASSERT( ( int )num_node_vec.size() == num_elem );
+
+    int num_node = 0;
+    for ( int i = 0; i < ( int )num_node_vec.size(); i++ )
+    {
+        num_node += num_node_vec[i];
+    }
+    TEST_ASSERT( ( int )node_vec.size() == num_node );
+    TEST_ASSERT( ( int )pnt_vec.size() == num_node );
+
+    vector< int > joined_node_vec;
+    vector< vec3d > joined_pnt_vec;
+    for ( int start = 0; start < num_elem; start += 100 )
+    {
+        vector< int > chunk_node_vec = vsp::GetFeaMeshElementNodeChunk( start, 100 );
+        vector< vec3d > chunk_pnt_vec = vsp::GetFeaMeshElementPntChunk( start, 100 );
+        joined_node_vec.insert( joined_node_vec.end(), chunk_node_vec.begin(), chunk_node_vec.end() );
+        joined_pnt_vec.insert( joined_pnt_vec.end(), chunk_pnt_vec.begin(), chunk_pnt_vec.end() );
+    }
+    TEST_ASSERT( joined_node_vec == node_vec );
+    TEST_ASSERT( joined_pnt_vec.size() == pnt_vec.size() );
+    for ( int i = 0; i < ( int )joined_pnt_vec.size() && i < ( int )pnt_vec.size(); i++ )
+    {
+        TEST_ASSERT( dist( joined_pnt_vec[i], pnt_vec[i] ) == 0.0 );
+    }
+
     // Final check for errors
     TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
     printf( "\n" );
@@ -25,16 +25,24 @@ public:
         TEST_ADD( APITestSuite::CreateGeometry )
         TEST_ADD( APITestSuite::ChangePodParams )
         TEST_ADD( APITestSuite::CopyPasteGeometry )
+        TEST_ADD( APITestSuite::TestParmBatch )
+        TEST_ADD( APITestSuite::TestAdvLinkNative )
         // Analysis
         TEST_ADD( APITestSuite::CheckAnalysisMgr )
         TEST_ADD( APITestSuite::TestAnalysesWithPod )
+        TEST_ADD( APITestSuite::TestAnalysisCache )
 
         // Export
         TEST_ADD( APITestSuite::TestDXFExport )
         TEST_ADD( APITestSuite::TestSVGExport )
         TEST_ADD( APITestSuite::TestFacetExport )
+        // Results
+        TEST_ADD( APITestSuite::TestResultsExpiry )
+        TEST_ADD( APITestSuite::TestResultsBinaryExport )
+        TEST_ADD( APITestSuite::TestChunkedAccess )
         // Save and Load
         TEST_ADD( APITestSuite::TestSaveLoad )
+        TEST_ADD( APITestSuite::TestBinarySaveLoad )
         // FEA Mesh
         TEST_ADD( APITestSuite::TestFEAMesh )
         // XSec
@@ -48,15 +56,23 @@ private:
     void CreateGeometry();
     void ChangePodParams();
     void CopyPasteGeometry();
+    void TestParmBatch();
+    void TestAdvLinkNative();
     // Analysis
     void CheckAnalysisMgr();
     void TestAnalysesWithPod();
+    void TestAnalysisCache();
     // Export
     void TestDXFExport();
     void TestSVGExport();
     void TestFacetExport();
+    // Results
+    void TestResultsExpiry();
+    void TestResultsBinaryExport();
+    void TestChunkedAccess();
     // Save and Load
     void TestSaveLoad();
+    void TestBinarySaveLoad();
     // FEA Mesh
     void TestFEAMesh();
     // XSec
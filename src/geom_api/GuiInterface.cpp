@@ -17,6 +17,8 @@
 #include "ScreenMgr.h"
 #endif
 
+#include "Vehicle.h"
+
 #include <cstddef>
 
 //==== Constructor ====//
@@ -42,6 +44,12 @@ void GuiInterface::InitGui( Vehicle* vPtr )
     }
 #endif
 
+    //==== Draw Objects Skipped While Headless Are Built As The GUI Fetches Them ====//
+    if ( vPtr )
+    {
+        vPtr->SetHeadless( false );
+    }
+
 }
 
 void GuiInterface::StartGui()
@@ -25,12 +25,16 @@
 #include "BORGeom.h"
 #include "VSPAEROMgr.h"
 #include "MeasureMgr.h"
+#include "MeshGeom.h"
 #include "SubSurfaceMgr.h"
 #include "VKTAirfoil.h"
 #include "FeaStructure.h"
 #include "StructureMgr.h"
 #include "FeaMeshMgr.h"
 #include "SurfaceIntersectionMgr.h"
+#include "PerfStats.h"
+#include "ThreadMgr.h"
+#include "ProcessUtil.h"
 
 #include "eli/mutil/quad/simpson.hpp"
 #include "Eigen/src/Core/Matrix.h"
@@ -60,6 +64,18 @@ Vehicle* GetVehicle()
     return veh;
 }
 
+//==== Lock Of The Vehicle State, NULL Without A Vehicle ====//
+// Parm values are read and set under it, so other threads see them between updates.
+static RWLock* GetStateLock()
+{
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    if ( !veh )
+    {
+        return NULL;
+    }
+    return veh->GetStateLock();
+}
+
 // Find the pointer to a XSecSurf given its id
 XSecSurf* FindXSecSurf( const string & id )
 {
@@ -164,7 +180,15 @@ void RegisterCFDMeshAnalyses()
 void ReadVSPFile( const string & file_name )
 {
     Vehicle* veh = GetVehicle();
-    int err = veh->ReadXMLFile( file_name );
+    int err;
+    if ( Vehicle::IsBinaryFileName( file_name ) )
+    {
+        err = veh->ReadBinaryFile( file_name );
+    }
+    else
+    {
+        err = veh->ReadXMLFile( file_name );
+    }
     if( err != 0 )
     {
         ErrorMgr.AddError( VSP_WRONG_FILE_TYPE, "ReadVSPFile::Error"  );
@@ -177,7 +201,16 @@ void ReadVSPFile( const string & file_name )
 void WriteVSPFile( const string & file_name, int set )
 {
     Vehicle* veh = GetVehicle();
-    if( !veh->WriteXMLFile( file_name, set ) )
+    bool ok;
+    if ( Vehicle::IsBinaryFileName( file_name ) )
+    {
+        ok = veh->WriteBinaryFile( file_name, set );
+    }
+    else
+    {
+        ok = veh->WriteXMLFile( file_name, set );
+    }
+    if( !ok )
     {
         ErrorMgr.AddError( VSP_FILE_WRITE_FAILURE, "WriteVSPFile::Failure Writing File"  );
         return;
@@ -465,6 +498,12 @@ void ComputeDegenGeom( int set, int file_export_types )
         veh->setExportDegenGeomCsvFile( true );
     }
 
+    veh->setExportDegenGeomBinFile( false );
+    if ( file_export_types & DEGEN_GEOM_BIN_TYPE )
+    {
+        veh->setExportDegenGeomBinFile( true );
+    }
+
     veh->CreateDegenGeom( set );
     veh->WriteDegenGeomFile();
     ErrorMgr.NoError();
@@ -490,6 +529,49 @@ string ComputePlaneSlice( int set, int num_slices, const vec3d & norm, bool auto
     return id;
 }
 
+//==== Compute Several Plane Slices On One Mesh =====//
+vector< string > ComputePlaneSliceBatch( int set, const vector< vec3d > & norm_vec, const vector< int > & num_vec,
+                                         bool auto_bnd, const vector< double > & start_vec, const vector< double > & end_vec )
+{
+    vector< string > res_id_vec;
+
+    if ( num_vec.size() != norm_vec.size() ||
+            ( !auto_bnd && ( start_vec.size() != norm_vec.size() || end_vec.size() != norm_vec.size() ) ) )
+    {
+        ErrorMgr.AddError( VSP_INVALID_INPUT_VAL, "ComputePlaneSliceBatch::Input Vector Sizes Do Not Match " );
+        return res_id_vec;
+    }
+
+    Update();
+    Vehicle* veh = GetVehicle();
+
+    vector< AreaSliceRequest > req_vec( norm_vec.size() );
+    for ( int i = 0 ; i < ( int )norm_vec.size() ; i++ )
+    {
+        req_vec[i].m_Axis = norm_vec[i];
+        req_vec[i].m_NumSlices = num_vec[i];
+        req_vec[i].m_AutoBounds = auto_bnd;
+        if ( !auto_bnd )
+        {
+            req_vec[i].m_Start = start_vec[i];
+            req_vec[i].m_End = end_vec[i];
+        }
+    }
+
+    string id = veh->PSliceBatchAndFlatten( set, req_vec, res_id_vec );
+
+    if ( id.compare( "NONE" ) == 0 )
+    {
+        ErrorMgr.AddError( VSP_INVALID_ID, "ComputePlaneSliceBatch::Invalid ID " );
+    }
+    else
+    {
+        ErrorMgr.NoError();
+    }
+
+    return res_id_vec;
+}
+
 //==== Set a CFD Mesh Control Val =====//
 void SetCFDMeshVal( int type, double val )
 {
@@ -545,6 +627,8 @@ void SetCFDMeshVal( int type, double val )
         GetVehicle()->GetCfdSettingsPtr()->m_WakeAngle = val;
     else if ( type == CFD_SRF_XYZ_FLAG )
         GetVehicle()->GetCfdSettingsPtr()->m_XYZIntCurveFlag = ToBool(val);
+    else if ( type == CFD_OUT_OF_CORE_FLAG )
+        GetVehicle()->GetCfdSettingsPtr()->m_OutOfCoreFlag = ToBool(val);
     else
     {
         ErrorMgr.AddError( VSP_CANT_FIND_TYPE, "SetCFDMeshVal::Can't Find Type " + to_string( ( long long )type ) );
@@ -683,6 +767,13 @@ void ComputeCFDMesh( int set, int file_export_types )
     ErrorMgr.NoError();
 }
 
+/// Ask a running CFD Mesh, FEA Mesh or surface intersection to stop at its next check
+void CancelMeshGeneration()
+{
+    SurfaceIntersectionSingleton::SetCancelFlag( true );
+    ErrorMgr.NoError();
+}
+
 /// Get/Set reference wing
 string GetVSPAERORefWingID()
 {
@@ -1088,6 +1179,33 @@ string ExecAnalysis( const string & analysis )
     return AnalysisMgr.ExecAnalysis( analysis );
 }
 
+/// Turn memoized analysis execution on or off.  When on, an analysis run with
+/// the same inputs on an unchanged vehicle returns its previous Result ID.
+void SetAnalysisCacheFlag( bool flag )
+{
+    AnalysisMgr.SetCacheFlag( flag );
+    ErrorMgr.NoError();
+}
+
+bool GetAnalysisCacheFlag()
+{
+    ErrorMgr.NoError();
+    return AnalysisMgr.GetCacheFlag();
+}
+
+/// Forget the cached results of one analysis, or of all analyses if none is named.
+void InvalidateAnalysisCache( const string & analysis )
+{
+    if ( !analysis.empty() && !AnalysisMgr.ValidAnalysisName( analysis ) )
+    {
+        ErrorMgr.AddError( VSP_INVALID_ID, "InvalidateAnalysisCache::Invalid Analysis ID " + analysis );
+        return;
+    }
+    ErrorMgr.NoError();
+
+    AnalysisMgr.InvalidateCache( analysis );
+}
+
 int GetNumAnalysisInputData( const string & analysis, const string & name )
 {
     if ( !AnalysisMgr.ValidAnalysisName( analysis ) )
@@ -1464,6 +1582,100 @@ const vector<vec3d> & GetVec3dResults( const string & id, const string & name, i
     return ResultsMgr.GetVec3dResults( id, name, index );
 }
 
+/// Return the number of entries in the data given the results id, data name and data index
+int GetResultsDataLength( const string & id, const string & name, int index )
+{
+    if ( !ResultsMgr.ValidResultsID( id ) )
+    {
+        ErrorMgr.AddError( VSP_INVALID_ID, "GetResultsDataLength::Invalid ID " + id  );
+        return 0;
+    }
+    else if ( !ResultsMgr.ValidDataNameIndex( id, name, index ) )
+    {
+        ErrorMgr.AddError( VSP_CANT_FIND_NAME, "GetResultsDataLength::Can't Find Name " + name  );
+        return 0;
+    }
+
+    ErrorMgr.NoError();
+    return ResultsMgr.GetResultsDataLength( id, name, index );
+}
+
+/// Return entries [start, start + num) of the int data given the results id, data name and data index
+vector<int> GetIntResultsChunk( const string & id, const string & name, int start, int num, int index )
+{
+    if ( !ResultsMgr.ValidResultsID( id ) )
+    {
+        ErrorMgr.AddError( VSP_INVALID_ID, "GetIntResultsChunk::Invalid ID " + id  );
+    }
+    else if ( !ResultsMgr.ValidDataNameIndex( id, name, index ) )
+    {
+        ErrorMgr.AddError( VSP_CANT_FIND_NAME, "GetIntResultsChunk::Can't Find Name " + name  );
+    }
+    else
+    {
+        ErrorMgr.NoError();
+    }
+
+    return ResultsMgr.GetIntResultsChunk( id, name, start, num, index );
+}
+
+/// Return entries [start, start + num) of the double data given the results id, data name and data index
+vector<double> GetDoubleResultsChunk( const string & id, const string & name, int start, int num, int index )
+{
+    if ( !ResultsMgr.ValidResultsID( id ) )
+    {
+        ErrorMgr.AddError( VSP_INVALID_ID, "GetDoubleResultsChunk::Invalid ID " + id  );
+    }
+    else if ( !ResultsMgr.ValidDataNameIndex( id, name, index ) )
+    {
+        ErrorMgr.AddError( VSP_CANT_FIND_NAME, "GetDoubleResultsChunk::Can't Find Name " + name  );
+    }
+    else
+    {
+        ErrorMgr.NoError();
+    }
+
+    return ResultsMgr.GetDoubleResultsChunk( id, name, start, num, index );
+}
+
+/// Return entries [start, start + num) of the string data given the results id, data name and data index
+vector<string> GetStringResultsChunk( const string & id, const string & name, int start, int num, int index )
+{
+    if ( !ResultsMgr.ValidResultsID( id ) )
+    {
+        ErrorMgr.AddError( VSP_INVALID_ID, "GetStringResultsChunk::Invalid ID " + id  );
+    }
+    else if ( !ResultsMgr.ValidDataNameIndex( id, name, index ) )
+    {
+        ErrorMgr.AddError( VSP_CANT_FIND_NAME, "GetStringResultsChunk::Can't Find Name " + name  );
+    }
+    else
+    {
+        ErrorMgr.NoError();
+    }
+
+    return ResultsMgr.GetStringResultsChunk( id, name, start, num, index );
+}
+
+/// Return entries [start, start + num) of the vec3d data given the results id, data name and data index
+vector<vec3d> GetVec3dResultsChunk( const string & id, const string & name, int start, int num, int index )
+{
+    if ( !ResultsMgr.ValidResultsID( id ) )
+    {
+        ErrorMgr.AddError( VSP_INVALID_ID, "GetVec3dResultsChunk::Invalid ID " + id  );
+    }
+    else if ( !ResultsMgr.ValidDataNameIndex( id, name, index ) )
+    {
+        ErrorMgr.AddError( VSP_CANT_FIND_NAME, "GetVec3dResultsChunk::Can't Find Name " + name  );
+    }
+    else
+    {
+        ErrorMgr.NoError();
+    }
+
+    return ResultsMgr.GetVec3dResultsChunk( id, name, start, num, index );
+}
+
 /// Create Geometry Results (Only Mesh Geom For Now) - Return Result ID
 extern string CreateGeomResults( const string & geom_id, const string & name )
 {
@@ -1528,11 +1740,245 @@ void WriteResultsCSVFile( const string & id, const string & file_name )
     ErrorMgr.NoError();
  }
 
+// Write Results To Binary File ====//
+void WriteResultsBinaryFile( const string & id, const string & file_name, bool append )
+{
+    Results* resptr = ResultsMgr.FindResultsPtr( id );
+
+    if ( !resptr )
+    {
+        ErrorMgr.AddError( VSP_INVALID_ID, "WriteResultsBinaryFile::Invalid ID " + id  );
+        return;
+    }
+    resptr->WriteBinaryFile( file_name, append );
+    ErrorMgr.NoError();
+}
+
 void PrintResults( const string &results_id )
 {
     ResultsMgr.PrintResults( results_id );
 }
 
+//===================================================================//
+//===============   Performance Statistics        ===================//
+//===================================================================//
+
+void SetPerfStatsFlag( bool flag, bool trace_flag )
+{
+    PerfStatsMgr.SetEnabled( flag );
+    PerfStatsMgr.SetTraceFlag( flag && trace_flag );
+    ErrorMgr.NoError();
+}
+
+bool GetPerfStatsFlag()
+{
+    ErrorMgr.NoError();
+    return PerfStatsMgr.GetEnabled();
+}
+
+void ResetPerfStats()
+{
+    PerfStatsMgr.Reset();
+    ErrorMgr.NoError();
+}
+
+string CreatePerfStatsResults()
+{
+    string id = ResultsMgr.CreatePerfStatsResults();
+
+    if ( id.empty() )
+    {
+        ErrorMgr.AddError( VSP_INVALID_PTR, "CreatePerfStatsResults::Failed To Create Results" );
+        return id;
+    }
+    ErrorMgr.NoError();
+    return id;
+}
+
+void WritePerfTraceFile( const string & file_name )
+{
+    if ( !PerfStatsMgr.WriteTrace( file_name ) )
+    {
+        ErrorMgr.AddError( VSP_FILE_WRITE_FAILURE, "WritePerfTraceFile::Could Not Write " + file_name );
+        return;
+    }
+    ErrorMgr.NoError();
+}
+
+//===================================================================//
+//===============       Threads                   ===================//
+//===================================================================//
+
+void SetNumThreads( int num )
+{
+    ThreadMgr.SetNumThreads( num );
+    ErrorMgr.NoError();
+}
+
+int GetNumThreads()
+{
+    ErrorMgr.NoError();
+    return ThreadMgr.GetNumThreads();
+}
+
+//===================================================================//
+//===============       Headless Mode             ===================//
+//===================================================================//
+
+void SetHeadlessMode( bool flag )
+{
+    Vehicle* veh = GetVehicle();
+    veh->SetHeadless( flag );
+    ErrorMgr.NoError();
+}
+
+bool GetHeadlessMode()
+{
+    ErrorMgr.NoError();
+    return Vehicle::IsHeadless();
+}
+
+//===================================================================//
+//===============       Deferred Geom Load        ===================//
+//===================================================================//
+
+void SetDeferGeomLoad( bool flag )
+{
+    Vehicle* veh = GetVehicle();
+    veh->SetDeferGeomLoad( flag );
+    ErrorMgr.NoError();
+}
+
+bool GetDeferGeomLoad()
+{
+    Vehicle* veh = GetVehicle();
+    ErrorMgr.NoError();
+    return veh->GetDeferGeomLoad();
+}
+
+void LoadDeferredGeoms()
+{
+    Vehicle* veh = GetVehicle();
+    veh->LoadDeferredGeoms();
+    ErrorMgr.NoError();
+}
+
+int GetNumDeferredGeoms()
+{
+    Vehicle* veh = GetVehicle();
+    ErrorMgr.NoError();
+    return veh->GetNumDeferredGeoms();
+}
+
+//===================================================================//
+//===============       Autosave                  ===================//
+//===================================================================//
+
+void SetAutoSaveInterval( double interval_sec )
+{
+    Vehicle* veh = GetVehicle();
+    veh->SetAutoSaveInterval( interval_sec );
+    ErrorMgr.NoError();
+}
+
+double GetAutoSaveInterval()
+{
+    Vehicle* veh = GetVehicle();
+    ErrorMgr.NoError();
+    return veh->GetAutoSaveInterval();
+}
+
+//===================================================================//
+//===============       Memory Accounting         ===================//
+//===================================================================//
+
+string CreateMemoryUsageResults()
+{
+    Vehicle* veh = GetVehicle();
+    if ( !veh )
+    {
+        return string();
+    }
+
+    vector< string > id_vec, name_vec;
+    vector< double > surf_vec, tess_vec, draw_vec, subsurf_vec, mesh_vec, total_vec;
+    double geom_total = 0;
+
+    vector< Geom* > geom_vec = veh->GetGeomStoreVec();
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        GeomMemUsage usage;
+        geom_vec[i]->AddMemoryUsage( usage );
+
+        id_vec.push_back( geom_vec[i]->GetID() );
+        name_vec.push_back( geom_vec[i]->GetName() );
+        surf_vec.push_back( usage.m_Surf );
+        tess_vec.push_back( usage.m_Tess );
+        draw_vec.push_back( usage.m_DrawObj );
+        subsurf_vec.push_back( usage.m_SubSurf );
+        mesh_vec.push_back( usage.m_Mesh );
+        total_vec.push_back( usage.Total() );
+        geom_total += usage.Total();
+    }
+
+    // Measured before this result is added
+    double results_bytes = ResultsMgr.MemoryUsage();
+    double isect_bytes = SurfaceIntersectionMgr.MemoryUsage();
+    double cfd_bytes = CfdMeshMgr.MemoryUsage();
+    double fea_bytes = FeaMeshMgr.MemoryUsage();
+    double undo_bytes = ParmMgr.UndoMemoryUsage();
+
+    Results* res = ResultsMgr.CreateResults( "Memory_Usage" );
+    if ( !res )
+    {
+        ErrorMgr.AddError( VSP_INVALID_PTR, "CreateMemoryUsageResults::Failed To Create Results" );
+        return string();
+    }
+
+    res->Add( NameValData( "Geom_ID", id_vec ) );
+    res->Add( NameValData( "Geom_Name", name_vec ) );
+    res->Add( NameValData( "Surf_Bytes", surf_vec ) );
+    res->Add( NameValData( "Tess_Bytes", tess_vec ) );
+    res->Add( NameValData( "DrawObj_Bytes", draw_vec ) );
+    res->Add( NameValData( "SubSurf_Bytes", subsurf_vec ) );
+    res->Add( NameValData( "Mesh_Bytes", mesh_vec ) );
+    res->Add( NameValData( "Geom_Total_Bytes", total_vec ) );
+
+    res->Add( NameValData( "Geoms_Bytes", geom_total ) );
+    res->Add( NameValData( "Results_Bytes", results_bytes ) );
+    res->Add( NameValData( "SurfIntersect_Bytes", isect_bytes ) );
+    res->Add( NameValData( "CfdMesh_Bytes", cfd_bytes ) );
+    res->Add( NameValData( "FeaMesh_Bytes", fea_bytes ) );
+    res->Add( NameValData( "Undo_Bytes", undo_bytes ) );
+    res->Add( NameValData( "Total_Bytes", geom_total + results_bytes + isect_bytes + cfd_bytes + fea_bytes + undo_bytes ) );
+    res->Add( NameValData( "Peak_Mem_MB", GetPeakMemoryMB() ) );
+
+    ErrorMgr.NoError();
+    return res->GetID();
+}
+
+void PurgeDrawObjs()
+{
+    Vehicle* veh = GetVehicle();
+    if ( !veh )
+    {
+        return;
+    }
+    veh->PurgeDrawObjs();
+    ErrorMgr.NoError();
+}
+
+void PurgeTessCache()
+{
+    Vehicle* veh = GetVehicle();
+    if ( !veh )
+    {
+        return;
+    }
+    veh->PurgeTessCache();
+    ErrorMgr.NoError();
+}
+
 //===================================================================//
 //===============        GUI Functions            ===================//
 //===================================================================//
@@ -2933,6 +3379,83 @@ void ComputeFeaMesh( const string & struct_id, int file_type )
     ErrorMgr.NoError();
 }
 
+void ComputeFeaMeshes( const vector < string > & struct_id_vec, int file_type )
+{
+    Update(); // Not sure if this is needed
+
+    vector < int > struct_index_vec;
+
+    for ( size_t i = 0; i < struct_id_vec.size(); i++ )
+    {
+        FeaStructure* feastruct = StructureMgr.GetFeaStruct( struct_id_vec[i] );
+        if ( !feastruct )
+        {
+            ErrorMgr.AddError( VSP_INVALID_PTR, "ComputeFeaMeshes::Can't Find Structure " + struct_id_vec[i] );
+            return;
+        }
+
+        feastruct->GetStructSettingsPtr()->SetAllFileExportFlags( false );
+        feastruct->GetStructSettingsPtr()->SetFileExportFlag( file_type, true );
+
+        struct_index_vec.push_back( StructureMgr.GetTotFeaStructIndex( feastruct ) );
+    }
+
+    FeaMeshMgrSingleton::GenerateFeaMeshes( struct_index_vec );
+    ErrorMgr.NoError();
+}
+
+/// Return the number of elements in the last FEA mesh built by ComputeFeaMesh
+int GetFeaMeshNumElements()
+{
+    if ( FeaMeshMgr.GetFeaMeshInProgress() )
+    {
+        ErrorMgr.AddError( VSP_INVALID_PTR, "GetFeaMeshNumElements::FEA Mesh In Progress" );
+        return 0;
+    }
+
+    ErrorMgr.NoError();
+    return FeaMeshMgr.GetNumFeaElements();
+}
+
+/// Return the number of nodes of each FEA element in [start, start + num)
+vector < int > GetFeaMeshElementNumNodes( int start, int num )
+{
+    if ( FeaMeshMgr.GetFeaMeshInProgress() )
+    {
+        ErrorMgr.AddError( VSP_INVALID_PTR, "GetFeaMeshElementNumNodes::FEA Mesh In Progress" );
+        return vector < int > ();
+    }
+
+    ErrorMgr.NoError();
+    return FeaMeshMgr.GetFeaElementNumNodes( start, num );
+}
+
+/// Return the exported node numbers of the FEA elements in [start, start + num), packed back to back
+vector < int > GetFeaMeshElementNodeChunk( int start, int num )
+{
+    if ( FeaMeshMgr.GetFeaMeshInProgress() )
+    {
+        ErrorMgr.AddError( VSP_INVALID_PTR, "GetFeaMeshElementNodeChunk::FEA Mesh In Progress" );
+        return vector < int > ();
+    }
+
+    ErrorMgr.NoError();
+    return FeaMeshMgr.GetFeaElementNodeChunk( start, num );
+}
+
+/// Return the node coordinates of the FEA elements in [start, start + num), matching GetFeaMeshElementNodeChunk
+vector < vec3d > GetFeaMeshElementPntChunk( int start, int num )
+{
+    if ( FeaMeshMgr.GetFeaMeshInProgress() )
+    {
+        ErrorMgr.AddError( VSP_INVALID_PTR, "GetFeaMeshElementPntChunk::FEA Mesh In Progress" );
+        return vector < vec3d > ();
+    }
+
+    ErrorMgr.NoError();
+    return FeaMeshMgr.GetFeaElementPntChunk( start, num );
+}
+
 void CutXSec( const string & geom_id, int index )
 {
     Vehicle* veh = GetVehicle();
@@ -5077,6 +5600,7 @@ bool ValidParm( const string & parm_id )
 /// The final value of parm is returned.
 double SetParmVal( const string & parm_id, double val )
 {
+    WriteLockGuard lock( GetStateLock() );
     Parm* p = ParmMgr.FindParm( parm_id );
     if ( !p )
     {
@@ -5091,6 +5615,7 @@ double SetParmVal( const string & parm_id, double val )
 /// The final value of parm is returned.
 double SetParmVal( const string & geom_id, const string & name, const string & group, double val )
 {
+    WriteLockGuard lock( GetStateLock() );
     string parm_id = GetParm( geom_id, name, group );
     Parm* p = ParmMgr.FindParm( parm_id );
     if ( !p )
@@ -5104,6 +5629,7 @@ double SetParmVal( const string & geom_id, const string & name, const string & g
 
 double SetParmValLimits( const string & parm_id, double val, double lower_limit, double upper_limit )
 {
+    WriteLockGuard lock( GetStateLock() );
     Parm* p = ParmMgr.FindParm( parm_id );
     if ( !p )
     {
@@ -5121,6 +5647,7 @@ double SetParmValLimits( const string & parm_id, double val, double lower_limit,
 /// The final value of parm is returned.
 double SetParmValUpdate( const string & parm_id, double val )
 {
+    WriteLockGuard lock( GetStateLock() );
     Parm* p = ParmMgr.FindParm( parm_id );
     if ( !p )
     {
@@ -5136,6 +5663,7 @@ double SetParmValUpdate( const string & parm_id, double val )
 /// The final value of parm is returned.
 double SetParmValUpdate( const string & geom_id, const string & parm_name, const string & parm_group_name, double val )
 {
+    WriteLockGuard lock( GetStateLock() );
     string parm_id = GetParm( geom_id, parm_name, parm_group_name );
     Parm* p = ParmMgr.FindParm( parm_id );
     if ( !p )
@@ -5147,9 +5675,59 @@ double SetParmValUpdate( const string & geom_id, const string & parm_name, const
     return p->SetFromDevice( val );         // Force Update
 }
 
+/// Set the values of many parms, then update each changed Geom once.
+void SetParmValBatch( const vector< string > & parm_id_vec, const vector< double > & val_vec )
+{
+    if ( parm_id_vec.size() != val_vec.size() )
+    {
+        ErrorMgr.AddError( VSP_INVALID_INPUT_VAL, "SetParmValBatch::Parm ID And Value Vectors Differ In Size" );
+        return;
+    }
+
+    Vehicle* veh = GetVehicle();
+    veh->BeginParmBatch();
+
+    bool found_all = true;
+    for ( int i = 0 ; i < ( int )parm_id_vec.size() ; i++ )
+    {
+        Parm* p = ParmMgr.FindParm( parm_id_vec[i] );
+        if ( !p )
+        {
+            ErrorMgr.AddError( VSP_CANT_FIND_PARM, "SetParmValBatch::Can't Find Parm " + parm_id_vec[i] );
+            found_all = false;
+            continue;
+        }
+        p->SetFromDevice( val_vec[i] );
+    }
+
+    veh->EndParmBatch();
+
+    if ( found_all )
+    {
+        ErrorMgr.NoError();
+    }
+}
+
+/// Defer Geom updates from parm changes until the matching EndParmBatch.
+void BeginParmBatch()
+{
+    Vehicle* veh = GetVehicle();
+    veh->BeginParmBatch();
+    ErrorMgr.NoError();
+}
+
+/// End a batch started by BeginParmBatch.  The outermost call updates each changed Geom once.
+void EndParmBatch()
+{
+    Vehicle* veh = GetVehicle();
+    veh->EndParmBatch();
+    ErrorMgr.NoError();
+}
+
 /// Get the value of parm
 double GetParmVal( const string & parm_id )
 {
+    ReadLockGuard lock( GetStateLock() );
     Parm* p = ParmMgr.FindParm( parm_id );
     if ( !p )
     {
@@ -5163,6 +5741,7 @@ double GetParmVal( const string & parm_id )
 /// Get the value of parm
 double GetParmVal( const string & geom_id, const string & name, const string & group )
 {
+    ReadLockGuard lock( GetStateLock() );
     string parm_id = GetParm( geom_id, name, group );
     Parm* p = ParmMgr.FindParm( parm_id );
     if ( !p )
@@ -5177,6 +5756,7 @@ double GetParmVal( const string & geom_id, const string & name, const string & g
 /// Get the value of parm
 int GetIntParmVal( const string & parm_id )
 {
+    ReadLockGuard lock( GetStateLock() );
     Parm* p = ParmMgr.FindParm( parm_id );
     if ( !p )
     {
@@ -5190,6 +5770,7 @@ int GetIntParmVal( const string & parm_id )
 /// Get the value of parm
 bool GetBoolParmVal( const string & parm_id )
 {
+    ReadLockGuard lock( GetStateLock() );
     Parm* p = ParmMgr.FindParm( parm_id );
     if ( !p )
     {
@@ -6381,12 +6962,7 @@ vector < vec3d > CompVecPnt01( const std::string &geom_id, const int &surf_indx,
 
             if ( surf )
             {
-                pts.resize( us.size() );
-
-                for ( int i = 0; i < us.size(); i++ )
-                {
-                    pts[i] = surf->CompPnt01( clamp( us[i], 0.0, 1.0 ), clamp( ws[i], 0.0, 1.0 ) );
-                }
+                surf->CompPnt01( us, ws, pts );
             }
             else
             {
@@ -6426,12 +7002,7 @@ vector < vec3d > CompVecNorm01( const std::string &geom_id, const int &surf_indx
 
             if ( surf )
             {
-                norms.resize( us.size() );
-
-                for ( int i = 0; i < us.size(); i++ )
-                {
-                    norms[i] = surf->CompNorm01( clamp( us[i], 0.0, 1.0 ), clamp( ws[i], 0.0, 1.0 ) );
-                }
+                surf->CompNorm01( us, ws, norms );
             }
             else
             {
@@ -6519,14 +7090,7 @@ void ProjVecPnt01(const std::string &geom_id, const int &surf_indx, const vector
 
         if ( surf )
         {
-            us.resize( pts.size() );
-            ws.resize( pts.size() );
-            ds.resize( pts.size() );
-
-            for ( int i = 0; i < pts.size(); i++ )
-            {
-                ds[i] = surf->FindNearest01( us[i], ws[i], pts[i] );
-            }
+            surf->FindNearest01( pts, us, ws, ds );
         }
         else
         {
@@ -6564,7 +7128,8 @@ void ProjVecPnt01Guess( const std::string &geom_id, const int &surf_indx, const
                 ws.resize( pts.size() );
                 ds.resize( pts.size() );
 
-                for ( int i = 0; i < pts.size(); i++ )
+                #pragma omp parallel for schedule( dynamic, 64 )
+                for ( int i = 0; i < ( int )pts.size(); i++ )
                 {
                     ds[i] = surf->FindNearest01( us[i], ws[i], pts[i], clamp( u0s[i], 0.0, 1.0 ), clamp( w0s[i], 0.0, 1.0 ) );
                 }
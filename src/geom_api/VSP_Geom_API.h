@@ -70,8 +70,11 @@ extern std::string ComputeMassProps( int set, int num_slices );
 extern std::string ComputeCompGeom( int set, bool half_mesh, int file_export_types );
 extern std::string ComputePlaneSlice( int set, int num_slices, const vec3d & norm, bool auto_bnd,
                                  double start_bnd = 0, double end_bnd = 0 );
+extern std::vector< std::string > ComputePlaneSliceBatch( int set, const std::vector< vec3d > & norm_vec, const std::vector< int > & num_vec,
+                                                          bool auto_bnd, const std::vector< double > & start_vec, const std::vector< double > & end_vec );
 extern void ComputeDegenGeom( int set, int file_export_types );
 extern void ComputeCFDMesh( int set, int file_export_types );
+extern void CancelMeshGeneration();
 extern void SetCFDMeshVal( int type, double val );
 extern void SetCFDWakeFlag( const std::string & geom_id, bool flag );
 extern void DeleteAllCFDSources();
@@ -90,6 +93,10 @@ extern std::vector<std::string> ListAnalysis();
 extern std::vector<std::string> GetAnalysisInputNames( const std::string & analysis );
 extern std::string ExecAnalysis( const std::string & analysis );
 
+extern void SetAnalysisCacheFlag( bool flag );
+extern bool GetAnalysisCacheFlag();
+extern void InvalidateAnalysisCache( const std::string & analysis = std::string() );
+
 extern int GetNumAnalysisInputData( const std::string & analysis, const std::string & name );
 extern int GetAnalysisInputType( const std::string & analysis, const std::string & name );
 extern const std::vector< int > & GetIntAnalysisInput( const std::string & analysis, const std::string & name, int index = 0 );
@@ -119,12 +126,48 @@ extern const std::vector< double > & GetDoubleResults( const std::string & id, c
 extern const std::vector< std::vector< double > > & GetDoubleMatResults( const std::string & id, const std:: string & name, int index = 0 );
 extern const std::vector<std::string> & GetStringResults( const std::string & id, const std::string & name, int index = 0 );
 extern const std::vector< vec3d > & GetVec3dResults( const std::string & id, const std::string & name, int index = 0 );
+extern int GetResultsDataLength( const std::string & id, const std::string & name, int index = 0 );
+extern std::vector< int > GetIntResultsChunk( const std::string & id, const std::string & name, int start, int num, int index = 0 );
+extern std::vector< double > GetDoubleResultsChunk( const std::string & id, const std::string & name, int start, int num, int index = 0 );
+extern std::vector<std::string> GetStringResultsChunk( const std::string & id, const std::string & name, int start, int num, int index = 0 );
+extern std::vector< vec3d > GetVec3dResultsChunk( const std::string & id, const std::string & name, int start, int num, int index = 0 );
 extern std::string CreateGeomResults( const std::string & geom_id, const std::string & name );
 extern void DeleteAllResults();
 extern void DeleteResult( const std::string & id );
 extern void WriteResultsCSVFile( const std::string & id, const std::string & file_name );
+extern void WriteResultsBinaryFile( const std::string & id, const std::string & file_name, bool append = false );
 extern void PrintResults( const std::string &results_id );
 
+//======================== Performance Statistics ================================//
+extern void SetPerfStatsFlag( bool flag, bool trace_flag = false );
+extern bool GetPerfStatsFlag();
+extern void ResetPerfStats();
+extern std::string CreatePerfStatsResults();
+extern void WritePerfTraceFile( const std::string & file_name );
+
+//======================== Threads ================================//
+extern void SetNumThreads( int num );
+extern int GetNumThreads();
+
+//======================== Headless Mode ================================//
+extern void SetHeadlessMode( bool flag );
+extern bool GetHeadlessMode();
+
+//======================== Deferred Geom Load ================================//
+extern void SetDeferGeomLoad( bool flag );
+extern bool GetDeferGeomLoad();
+extern void LoadDeferredGeoms();
+extern int GetNumDeferredGeoms();
+
+//======================== Autosave ================================//
+extern void SetAutoSaveInterval( double interval_sec );
+extern double GetAutoSaveInterval();
+
+//======================== Memory Accounting ================================//
+extern std::string CreateMemoryUsageResults();
+extern void PurgeDrawObjs();
+extern void PurgeTessCache();
+
 //======================== GUI Functions ================================//
 extern void StartGui( );
 extern void ScreenGrab( const string & fname, int w, int h, bool transparentBG );
@@ -198,6 +241,11 @@ extern void SetFeaMeshVal( const std::string & geom_id, int fea_struct_ind, int
 extern void SetFeaMeshFileName( const std::string & geom_id, int fea_struct_ind, int file_type, const string & file_name );
 extern void ComputeFeaMesh( const std::string & geom_id, int fea_struct_ind, int file_type );
 extern void ComputeFeaMesh( const std::string & struct_id, int file_type );
+extern void ComputeFeaMeshes( const std::vector< std::string > & struct_id_vec, int file_type );
+extern int GetFeaMeshNumElements();
+extern std::vector< int > GetFeaMeshElementNumNodes( int start, int num );
+extern std::vector< int > GetFeaMeshElementNodeChunk( int start, int num );
+extern std::vector< vec3d > GetFeaMeshElementPntChunk( int start, int num );
 
 extern void CutXSec( const std::string & geom_id, int index );
 extern void CopyXSec( const std::string & geom_id, int index );
@@ -299,6 +347,9 @@ extern double SetParmVal( const std::string & geom_id, const std::string & name,
 extern double SetParmValLimits( const std::string & parm_id, double val, double lower_limit, double upper_limit );
 extern double SetParmValUpdate( const std::string & parm_id, double val );
 extern double SetParmValUpdate( const std::string & geom_id, const std::string & parm_name, const std::string & parm_group_name, double val );
+extern void SetParmValBatch( const std::vector< std::string > & parm_id_vec, const std::vector< double > & val_vec );
+extern void BeginParmBatch();
+extern void EndParmBatch();
 extern double GetParmVal( const std::string & parm_id );
 extern double GetParmVal( const std::string & geom_id, const std::string & name, const std::string & group );
 extern int GetIntParmVal( const std::string & parm_id );
@@ -12,6 +12,10 @@
 #include "Vehicle.h"
 #include "VSP_Geom_API.h"
 #include "ScriptMgr.h"
+#include "LinkMgr.h"
+
+#include <math.h>
+#include <stdlib.h>
 
 
 //===== Encode Variable Def =====//
@@ -41,10 +45,623 @@ xmlNodePtr VarDef::DecodeXml( xmlNodePtr & var_node )
 //=====================================================================================//
 //=====================================================================================//
 
+//==== Math Functions Shared With The Script Engine (scriptmath Add-On) ====//
+struct AdvLinkFunc1
+{
+    const char* m_Name;
+    double ( *m_Func )( double );
+};
+
+struct AdvLinkFunc2
+{
+    const char* m_Name;
+    double ( *m_Func )( double, double );
+};
+
+//==== scriptmath Registers The Float Versions, So Arguments And Results Round Through Float ====//
+template < float ( *F )( float ) >
+static double AdvLinkFloatFunc1( double x )
+{
+    return F( ( float )x );
+}
+
+template < float ( *F )( float, float ) >
+static double AdvLinkFloatFunc2( double x, double y )
+{
+    return F( ( float )x, ( float )y );
+}
+
+static const AdvLinkFunc1 s_AdvLinkFunc1Table[] =
+{
+    { "cos", AdvLinkFloatFunc1< cosf > }, { "sin", AdvLinkFloatFunc1< sinf > }, { "tan", AdvLinkFloatFunc1< tanf > },
+    { "acos", AdvLinkFloatFunc1< acosf > }, { "asin", AdvLinkFloatFunc1< asinf > }, { "atan", AdvLinkFloatFunc1< atanf > },
+    { "cosh", AdvLinkFloatFunc1< coshf > }, { "sinh", AdvLinkFloatFunc1< sinhf > }, { "tanh", AdvLinkFloatFunc1< tanhf > },
+    { "log", AdvLinkFloatFunc1< logf > }, { "log10", AdvLinkFloatFunc1< log10f > }, { "sqrt", AdvLinkFloatFunc1< sqrtf > },
+    { "ceil", AdvLinkFloatFunc1< ceilf > }, { "abs", AdvLinkFloatFunc1< fabsf > }, { "floor", AdvLinkFloatFunc1< floorf > },
+};
+
+static const AdvLinkFunc2 s_AdvLinkFunc2Table[] =
+{
+    { "atan2", AdvLinkFloatFunc2< atan2f > }, { "pow", AdvLinkFloatFunc2< powf > },
+};
+
+//==== Constructor ====//
+AdvLinkExpr::AdvLinkExpr()
+{
+    Clear();
+}
+
+void AdvLinkExpr::Clear()
+{
+    m_Valid = false;
+    m_NumGlobalVars = 0;
+    m_VarNameVec.clear();
+    m_VarValVec.clear();
+    m_NodeVec.clear();
+    m_StmtVec.clear();
+    m_TokenVec.clear();
+    m_CurrToken = 0;
+}
+
+//==== Compile Link Code, Anything But Plain Assignments Of Arithmetic Is Left To The Script ====//
+bool AdvLinkExpr::Compile( const string & code, const vector< string > & global_vars, const vector< double > & init_vals )
+{
+    Clear();
+
+    m_VarNameVec = global_vars;
+    m_VarValVec = init_vals;
+    m_VarValVec.resize( m_VarNameVec.size(), 0.0 );
+    m_NumGlobalVars = ( int )m_VarNameVec.size();
+
+    if ( !Tokenize( code ) )
+    {
+        Clear();
+        return false;
+    }
+
+    while ( m_TokenVec[m_CurrToken].m_Type != ExprToken::END )
+    {
+        if ( !ParseStmt() )
+        {
+            Clear();
+            return false;
+        }
+    }
+
+    m_TokenVec.clear();
+    m_Valid = true;
+    return true;
+}
+
+//==== Split Code Into Tokens ====//
+bool AdvLinkExpr::Tokenize( const string & code )
+{
+    int n = ( int )code.size();
+    int i = 0;
+    while ( i < n )
+    {
+        char c = code[i];
+        char next = ( i + 1 < n ) ? code[i + 1] : '\0';
+
+        if ( isspace( ( unsigned char )c ) )
+        {
+            i++;
+        }
+        else if ( c == '/' && next == '/' )
+        {
+            while ( i < n && code[i] != '\n' )
+            {
+                i++;
+            }
+        }
+        else if ( c == '/' && next == '*' )
+        {
+            size_t e = code.find( "*/", i + 2 );
+            if ( e == string::npos )
+            {
+                return false;
+            }
+            i = ( int )e + 2;
+        }
+        else if ( isdigit( ( unsigned char )c ) || ( c == '.' && isdigit( ( unsigned char )next ) ) )
+        {
+            ExprToken tok;
+            tok.m_Type = ExprToken::NUMBER;
+            tok.m_IntFlag = true;
+            int start = i;
+            while ( i < n && isdigit( ( unsigned char )code[i] ) )
+            {
+                i++;
+            }
+            if ( i < n && code[i] == '.' )
+            {
+                tok.m_IntFlag = false;
+                i++;
+                while ( i < n && isdigit( ( unsigned char )code[i] ) )
+                {
+                    i++;
+                }
+            }
+            if ( i < n && ( code[i] == 'e' || code[i] == 'E' ) )
+            {
+                tok.m_IntFlag = false;
+                i++;
+                if ( i < n && ( code[i] == '+' || code[i] == '-' ) )
+                {
+                    i++;
+                }
+                if ( i >= n || !isdigit( ( unsigned char )code[i] ) )
+                {
+                    return false;
+                }
+                while ( i < n && isdigit( ( unsigned char )code[i] ) )
+                {
+                    i++;
+                }
+            }
+
+            //==== Suffixes And Hex Literals Change Type In AngelScript ====//
+            if ( i < n && ( isalnum( ( unsigned char )code[i] ) || code[i] == '_' || code[i] == '.' ) )
+            {
+                return false;
+            }
+            tok.m_Str = code.substr( start, i - start );
+            tok.m_Val = atof( tok.m_Str.c_str() );
+            m_TokenVec.push_back( tok );
+        }
+        else if ( isalpha( ( unsigned char )c ) || c == '_' )
+        {
+            ExprToken tok;
+            tok.m_Type = ExprToken::IDENT;
+            tok.m_Val = 0.0;
+            tok.m_IntFlag = false;
+            int start = i;
+            while ( i < n && ( isalnum( ( unsigned char )code[i] ) || code[i] == '_' ) )
+            {
+                i++;
+            }
+            tok.m_Str = code.substr( start, i - start );
+            m_TokenVec.push_back( tok );
+        }
+        else
+        {
+            ExprToken tok;
+            tok.m_Type = ExprToken::SYMBOL;
+            tok.m_Val = 0.0;
+            tok.m_IntFlag = false;
+
+            if ( string( "+-*/(),;=" ).find( c ) == string::npos )
+            {
+                return false;
+            }
+
+            //==== Reject **, ==, ++ and -- Rather Than Guess Their Meaning ====//
+            if ( next == c && c != '(' && c != ')' )
+            {
+                return false;
+            }
+
+            if ( next == '=' && string( "+-*/" ).find( c ) != string::npos )
+            {
+                tok.m_Str = code.substr( i, 2 );
+                i += 2;
+            }
+            else
+            {
+                tok.m_Str = string( 1, c );
+                i++;
+            }
+            m_TokenVec.push_back( tok );
+        }
+    }
+
+    ExprToken end_tok;
+    end_tok.m_Type = ExprToken::END;
+    end_tok.m_Val = 0.0;
+    end_tok.m_IntFlag = false;
+    m_TokenVec.push_back( end_tok );
+    m_CurrToken = 0;
+    return true;
+}
+
+bool AdvLinkExpr::Accept( const string & sym )
+{
+    const ExprToken & tok = m_TokenVec[m_CurrToken];
+    if ( tok.m_Type == ExprToken::SYMBOL && tok.m_Str == sym )
+    {
+        m_CurrToken++;
+        return true;
+    }
+    return false;
+}
+
+int AdvLinkExpr::FindVar( const string & name )
+{
+    for ( int i = 0 ; i < ( int )m_VarNameVec.size() ; i++ )
+    {
+        if ( m_VarNameVec[i] == name )
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+//==== Statement: [double] var ( = | += | -= | *= | /= ) expr ; ====//
+bool AdvLinkExpr::ParseStmt()
+{
+    if ( Accept( ";" ) )
+    {
+        return true;
+    }
+
+    if ( m_TokenVec[m_CurrToken].m_Type != ExprToken::IDENT )
+    {
+        return false;
+    }
+
+    ExprStmt stmt;
+    stmt.m_Root = -1;
+    stmt.m_Op = NUM;
+
+    if ( m_TokenVec[m_CurrToken].m_Str == "double" )
+    {
+        m_CurrToken++;
+        const ExprToken & name_tok = m_TokenVec[m_CurrToken];
+        if ( name_tok.m_Type != ExprToken::IDENT || FindVar( name_tok.m_Str ) >= 0 )
+        {
+            return false;
+        }
+        m_CurrToken++;
+
+        //==== Locals Are Reset Each Time The Statement Runs ====//
+        m_VarNameVec.push_back( name_tok.m_Str );
+        m_VarValVec.push_back( 0.0 );
+        stmt.m_Var = ( int )m_VarNameVec.size() - 1;
+
+        if ( Accept( "=" ) )
+        {
+            stmt.m_Root = ParseExpr();
+            if ( stmt.m_Root < 0 )
+            {
+                return false;
+            }
+        }
+    }
+    else
+    {
+        stmt.m_Var = FindVar( m_TokenVec[m_CurrToken].m_Str );
+        if ( stmt.m_Var < 0 )
+        {
+            return false;
+        }
+        m_CurrToken++;
+
+        if ( Accept( "+=" ) )
+        {
+            stmt.m_Op = ADD;
+        }
+        else if ( Accept( "-=" ) )
+        {
+            stmt.m_Op = SUB;
+        }
+        else if ( Accept( "*=" ) )
+        {
+            stmt.m_Op = MUL;
+        }
+        else if ( Accept( "/=" ) )
+        {
+            stmt.m_Op = DIV;
+        }
+        else if ( !Accept( "=" ) )
+        {
+            return false;
+        }
+
+        stmt.m_Root = ParseExpr();
+        if ( stmt.m_Root < 0 )
+        {
+            return false;
+        }
+    }
+
+    if ( !Accept( ";" ) )
+    {
+        return false;
+    }
+
+    m_StmtVec.push_back( stmt );
+    return true;
+}
+
+int AdvLinkExpr::AddNode( int op, int left, int right )
+{
+    ExprNode node;
+    node.m_Op = op;
+    node.m_Val = 0.0;
+    node.m_Var = -1;
+    node.m_Left = left;
+    node.m_Right = right;
+    node.m_Func1 = NULL;
+    node.m_Func2 = NULL;
+    node.m_IntFlag = false;
+    node.m_FloatFlag = false;
+
+    if ( op == NEG )
+    {
+        node.m_IntFlag = m_NodeVec[left].m_IntFlag;
+        node.m_FloatFlag = m_NodeVec[left].m_FloatFlag;
+    }
+    else if ( op == ADD || op == SUB || op == MUL || op == DIV )
+    {
+        //==== AngelScript Only Widens To Double When One Side Is Double ====//
+        const ExprNode & lnode = m_NodeVec[left];
+        const ExprNode & rnode = m_NodeVec[right];
+        node.m_IntFlag = lnode.m_IntFlag && rnode.m_IntFlag;
+        node.m_FloatFlag = !node.m_IntFlag && ( lnode.m_IntFlag || lnode.m_FloatFlag ) && ( rnode.m_IntFlag || rnode.m_FloatFlag );
+    }
+    else if ( op == FUNC1 || op == FUNC2 )
+    {
+        node.m_FloatFlag = true;
+    }
+
+    m_NodeVec.push_back( node );
+    return ( int )m_NodeVec.size() - 1;
+}
+
+int AdvLinkExpr::ParseExpr()
+{
+    int left = ParseTerm();
+    while ( left >= 0 )
+    {
+        int op;
+        if ( Accept( "+" ) )
+        {
+            op = ADD;
+        }
+        else if ( Accept( "-" ) )
+        {
+            op = SUB;
+        }
+        else
+        {
+            break;
+        }
+
+        int right = ParseTerm();
+        if ( right < 0 )
+        {
+            return -1;
+        }
+        left = AddNode( op, left, right );
+    }
+    return left;
+}
+
+int AdvLinkExpr::ParseTerm()
+{
+    int left = ParseUnary();
+    while ( left >= 0 )
+    {
+        int op;
+        if ( Accept( "*" ) )
+        {
+            op = MUL;
+        }
+        else if ( Accept( "/" ) )
+        {
+            op = DIV;
+        }
+        else
+        {
+            break;
+        }
+
+        int right = ParseUnary();
+        if ( right < 0 )
+        {
+            return -1;
+        }
+
+        //==== Integer Division Truncates In AngelScript ====//
+        if ( op == DIV && m_NodeVec[left].m_IntFlag && m_NodeVec[right].m_IntFlag )
+        {
+            return -1;
+        }
+        left = AddNode( op, left, right );
+    }
+    return left;
+}
+
+int AdvLinkExpr::ParseUnary()
+{
+    if ( Accept( "-" ) )
+    {
+        int n = ParseUnary();
+        if ( n < 0 )
+        {
+            return -1;
+        }
+        return AddNode( NEG, n, -1 );
+    }
+    if ( Accept( "+" ) )
+    {
+        return ParseUnary();
+    }
+    return ParsePrimary();
+}
+
+int AdvLinkExpr::ParsePrimary()
+{
+    const ExprToken tok = m_TokenVec[m_CurrToken];
+
+    if ( tok.m_Type == ExprToken::NUMBER )
+    {
+        m_CurrToken++;
+        int n = AddNode( NUM, -1, -1 );
+        m_NodeVec[n].m_Val = tok.m_Val;
+        m_NodeVec[n].m_IntFlag = tok.m_IntFlag;
+        return n;
+    }
+
+    if ( tok.m_Type == ExprToken::IDENT )
+    {
+        m_CurrToken++;
+
+        if ( !Accept( "(" ) )
+        {
+            int v = FindVar( tok.m_Str );
+            if ( v < 0 )
+            {
+                return -1;
+            }
+            int n = AddNode( VAR, -1, -1 );
+            m_NodeVec[n].m_Var = v;
+            return n;
+        }
+
+        int left = ParseExpr();
+        if ( left < 0 )
+        {
+            return -1;
+        }
+
+        if ( Accept( ")" ) )
+        {
+            for ( int i = 0 ; i < ( int )( sizeof( s_AdvLinkFunc1Table ) / sizeof( AdvLinkFunc1 ) ) ; i++ )
+            {
+                if ( tok.m_Str == s_AdvLinkFunc1Table[i].m_Name )
+                {
+                    int n = AddNode( FUNC1, left, -1 );
+                    m_NodeVec[n].m_Func1 = s_AdvLinkFunc1Table[i].m_Func;
+                    return n;
+                }
+            }
+            return -1;
+        }
+
+        if ( !Accept( "," ) )
+        {
+            return -1;
+        }
+
+        int right = ParseExpr();
+        if ( right < 0 || !Accept( ")" ) )
+        {
+            return -1;
+        }
+
+        for ( int i = 0 ; i < ( int )( sizeof( s_AdvLinkFunc2Table ) / sizeof( AdvLinkFunc2 ) ) ; i++ )
+        {
+            if ( tok.m_Str == s_AdvLinkFunc2Table[i].m_Name )
+            {
+                int n = AddNode( FUNC2, left, right );
+                m_NodeVec[n].m_Func2 = s_AdvLinkFunc2Table[i].m_Func;
+                return n;
+            }
+        }
+        return -1;
+    }
+
+    if ( Accept( "(" ) )
+    {
+        int n = ParseExpr();
+        if ( n < 0 || !Accept( ")" ) )
+        {
+            return -1;
+        }
+        return n;
+    }
+
+    return -1;
+}
+
+double AdvLinkExpr::EvalNode( int n )
+{
+    const ExprNode & node = m_NodeVec[n];
+
+    //==== Float Typed Arithmetic Rounds Both Operands And The Result To Float ====//
+    if ( node.m_FloatFlag && node.m_Op >= ADD && node.m_Op <= DIV )
+    {
+        float l = ( float )EvalNode( node.m_Left );
+        float r = ( float )EvalNode( node.m_Right );
+        switch ( node.m_Op )
+        {
+        case ADD:
+            return ( float )( l + r );
+        case SUB:
+            return ( float )( l - r );
+        case MUL:
+            return ( float )( l * r );
+        case DIV:
+            return ( float )( l / r );
+        default:
+            break;
+        }
+    }
+
+    switch ( node.m_Op )
+    {
+    case NUM:
+        return node.m_Val;
+    case VAR:
+        return m_VarValVec[node.m_Var];
+    case NEG:
+        return -EvalNode( node.m_Left );
+    case ADD:
+        return EvalNode( node.m_Left ) + EvalNode( node.m_Right );
+    case SUB:
+        return EvalNode( node.m_Left ) - EvalNode( node.m_Right );
+    case MUL:
+        return EvalNode( node.m_Left ) * EvalNode( node.m_Right );
+    case DIV:
+        return EvalNode( node.m_Left ) / EvalNode( node.m_Right );
+    case FUNC1:
+        return node.m_Func1( EvalNode( node.m_Left ) );
+    case FUNC2:
+        return node.m_Func2( EvalNode( node.m_Left ), EvalNode( node.m_Right ) );
+    }
+    return 0.0;
+}
+
+//==== Run Statements In Order, Global Vars Keep Their Values Between Calls Like Script Globals ====//
+void AdvLinkExpr::Eval()
+{
+    for ( int i = 0 ; i < ( int )m_StmtVec.size() ; i++ )
+    {
+        const ExprStmt & stmt = m_StmtVec[i];
+        double val = ( stmt.m_Root >= 0 ) ? EvalNode( stmt.m_Root ) : 0.0;
+        double & var = m_VarValVec[stmt.m_Var];
+
+        switch ( stmt.m_Op )
+        {
+        case ADD:
+            var += val;
+            break;
+        case SUB:
+            var -= val;
+            break;
+        case MUL:
+            var *= val;
+            break;
+        case DIV:
+            var /= val;
+            break;
+        default:
+            var = val;
+        }
+    }
+}
+
+//=====================================================================================//
+//=====================================================================================//
+//=====================================================================================//
+
 //==== Constructor ====//
 AdvLink::AdvLink()
 {
     m_ValidScript = false;
+    m_NativeBindCnt = -1;
 }
 
 //==== Destructor ====//
@@ -90,6 +707,7 @@ void AdvLink::AddVar( const VarDef & pd, bool input_flag )
     else
         m_OutputVars.push_back( pd );
 
+    LinkMgr.SetLinkGraphDirty();
 }
 
 void AdvLink::DeleteVar( int index, bool input_flag )
@@ -102,6 +720,7 @@ void AdvLink::DeleteVar( int index, bool input_flag )
     {
         m_OutputVars.erase( m_OutputVars.begin() + index );
     }
+    LinkMgr.SetLinkGraphDirty();
 }
 
 void AdvLink::DeleteAllVars( bool input_flag )
@@ -114,6 +733,7 @@ void AdvLink::DeleteAllVars( bool input_flag )
     {
         m_OutputVars.clear();
     }
+    LinkMgr.SetLinkGraphDirty();
 }
 
 void AdvLink::SetVar( const string & var_name, double val )
@@ -205,8 +825,7 @@ bool AdvLink::BuildScript()
     script.append( "void UpdateLink()\n{\n" );
     script.append( "    LoadInput();\n\n" );
     script.append( m_ScriptCode );
-    script.append( "\n    LoadOutput();\n" );
-    script.append( "\n    Update();\n}\n" );
+    script.append( "\n    LoadOutput();\n}\n" );
 
     m_CompleteScript = script;
 
@@ -215,7 +834,10 @@ bool AdvLink::BuildScript()
     ScriptMgr.RemoveScript( module_name );
 
     ScriptMgr.ClearMessages();
-    m_ScriptModule = ScriptMgr.ReadScriptFromMemory( module_name, m_CompleteScript );
+    m_ScriptModule = ScriptMgr.ReadScriptFromMemory( module_name, m_CompleteScript, true );
+
+    m_NativeExpr.Clear();
+    m_NativeBindCnt = -1;
 
     if ( m_ScriptModule.size() == 0 )
     {
@@ -223,10 +845,67 @@ bool AdvLink::BuildScript()
         return false;
     }
 
+    //==== Purely Arithmetic Code Also Gets A Native Version ====//
+    vector< double > init_vals( m_InputVars.size(), 0.0 );
+    init_vals.resize( var_vec.size(), -1.0e15 );
+    m_NativeExpr.Compile( m_ScriptCode, var_vec, init_vals );
+
     m_ValidScript = true;
     return true;
 }
 
+//==== Look Up Parm Pointers Again Only When Parms Have Been Added Or Removed ====//
+bool AdvLink::BindNativeParms()
+{
+    int cnt = ParmMgr.GetNumParmChanges();
+    if ( cnt == m_NativeBindCnt )
+    {
+        return false;
+    }
+
+    m_NativeInputParms.resize( m_InputVars.size() );
+    for ( int i = 0 ; i < ( int )m_InputVars.size() ; i++ )
+    {
+        m_NativeInputParms[i] = ParmMgr.FindParm( m_InputVars[i].m_ParmID );
+    }
+    m_NativeOutputParms.resize( m_OutputVars.size() );
+    for ( int i = 0 ; i < ( int )m_OutputVars.size() ; i++ )
+    {
+        m_NativeOutputParms[i] = ParmMgr.FindParm( m_OutputVars[i].m_ParmID );
+    }
+
+    m_NativeBindCnt = cnt;
+    return true;
+}
+
+//==== Same Steps As The Generated UpdateLink() Script Function ====//
+void AdvLink::RunNative()
+{
+    BindNativeParms();
+
+    int num_in = ( int )m_InputVars.size();
+    for ( int i = 0 ; i < num_in ; i++ )
+    {
+        Parm* parm_ptr = m_NativeInputParms[i];
+        m_NativeExpr.SetVarVal( i, parm_ptr ? parm_ptr->Get() : 0.0 );
+    }
+
+    m_NativeExpr.Eval();
+
+    for ( int i = 0 ; i < ( int )m_OutputVars.size() ; i++ )
+    {
+        //==== Setting An Output Can Rebuild Geometry And Its Parms ====//
+        BindNativeParms();
+
+        Parm* parm_ptr = m_NativeOutputParms[i];
+        double val = m_NativeExpr.GetVarVal( num_in + i );
+        if ( parm_ptr && val > -1.0e15 && !parm_ptr->GetLinkUpdateFlag() )
+        {
+            parm_ptr->SetFromLink( val );
+        }
+    }
+}
+
 bool AdvLink::UpdateLink( const string & pid )
 {
     //==== Check Parm  ====//
@@ -245,10 +924,7 @@ bool AdvLink::UpdateLink( const string & pid )
     if ( !run_link )
         return false;
 
-    AdvLinkMgr.SetActiveLink( this );
-
-    //==== Call Script ====//
-    ScriptMgr.ExecuteScript( m_ScriptModule.c_str(), "void UpdateLink()" );
+    ForceUpdate();
 
     return true;
 }
@@ -257,8 +933,22 @@ void AdvLink::ForceUpdate()
 {
     AdvLinkMgr.SetActiveLink( this );
 
-    //==== Call Script ====//
-    ScriptMgr.ExecuteScript( m_ScriptModule.c_str(), "void UpdateLink()" );
+    if ( m_NativeExpr.IsValid() )
+    {
+        RunNative();
+    }
+    else
+    {
+        //==== Call Script ====//
+        ScriptMgr.ExecuteScript( m_ScriptModule.c_str(), "void UpdateLink()" );
+    }
+
+    //==== Inside A Parm Batch The Update Waits For The Batch To End ====//
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    if ( !veh || !veh->InParmBatch() )
+    {
+        vsp::Update();
+    }
 }
 
 //==== Encode Contents of Adv Link Into XML Tree ====//
@@ -311,6 +1001,8 @@ xmlNodePtr AdvLink::DecodeXml( xmlNodePtr & adv_link_node )
             xmlNodePtr var_def_node = XmlUtil::GetNode( output_node, "VarDef", i );
             m_OutputVars[i].DecodeXml( var_def_node );
         }
+
+        LinkMgr.SetLinkGraphDirty();
     }
 
     return adv_link_node;
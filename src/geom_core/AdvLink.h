@@ -37,6 +37,86 @@ public:
 //=====================================================================================//
 //=====================================================================================//
 
+//==== Native Expression For Purely Arithmetic Link Code ====//
+class AdvLinkExpr
+{
+public:
+    AdvLinkExpr();
+
+    //==== Compile Code Into Expression Trees, False If Code Needs The Script Engine ====//
+    bool Compile( const string & code, const vector< string > & global_vars, const vector< double > & init_vals );
+    void Clear();
+    bool IsValid()                                                  { return m_Valid; }
+
+    void Eval();
+
+    //==== Global Vars Are First In Var Vec, In The Order Passed To Compile ====//
+    void SetVarVal( int i, double val )                             { m_VarValVec[i] = val; }
+    double GetVarVal( int i )                                       { return m_VarValVec[i]; }
+
+protected:
+
+    enum { NUM, VAR, NEG, ADD, SUB, MUL, DIV, FUNC1, FUNC2 };
+
+    class ExprNode
+    {
+    public:
+        int m_Op;
+        double m_Val;
+        int m_Var;
+        int m_Left;
+        int m_Right;
+        double ( *m_Func1 )( double );
+        double ( *m_Func2 )( double, double );
+        bool m_IntFlag;                             // Integer Typed In AngelScript
+        bool m_FloatFlag;                           // Float Typed In AngelScript
+    };
+
+    class ExprStmt
+    {
+    public:
+        int m_Var;
+        int m_Root;                                 // -1 For Declaration Without Initializer
+        int m_Op;                                   // NUM For Plain Assignment, Else Compound Op
+    };
+
+    class ExprToken
+    {
+    public:
+        enum { NUMBER, IDENT, SYMBOL, END };
+        int m_Type;
+        string m_Str;
+        double m_Val;
+        bool m_IntFlag;
+    };
+
+    bool Tokenize( const string & code );
+    bool ParseStmt();
+    int ParseExpr();
+    int ParseTerm();
+    int ParseUnary();
+    int ParsePrimary();
+    int AddNode( int op, int left, int right );
+    int FindVar( const string & name );
+    bool Accept( const string & sym );
+
+    double EvalNode( int n );
+
+    bool m_Valid;
+    int m_NumGlobalVars;
+    vector< string > m_VarNameVec;
+    vector< double > m_VarValVec;
+    vector< ExprNode > m_NodeVec;
+    vector< ExprStmt > m_StmtVec;
+
+    vector< ExprToken > m_TokenVec;
+    int m_CurrToken;
+};
+
+//=====================================================================================//
+//=====================================================================================//
+//=====================================================================================//
+
 //==== Advanced Link ====//
 class AdvLink
 {
@@ -91,6 +171,15 @@ protected:
 
     bool m_ValidScript;
     string m_ScriptErrors;
+
+    //==== Native Fast Path, Parm Pointers Rebound When ParmMgr Registration Changes ====//
+    bool BindNativeParms();
+    void RunNative();
+
+    AdvLinkExpr m_NativeExpr;
+    vector< Parm* > m_NativeInputParms;
+    vector< Parm* > m_NativeOutputParms;
+    int m_NativeBindCnt;
      
 private:
 
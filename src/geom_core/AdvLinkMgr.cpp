@@ -15,6 +15,7 @@
 #include "VSP_Geom_API.h"
 #include "StringUtil.h"
 #include "StlHelper.h"
+#include "LinkMgr.h"
 
 
 //==== Constructor ====//
@@ -40,6 +41,7 @@ void AdvLinkMgrSingleton::Wype()
     m_LinkVec.clear();
     m_ActiveLink = NULL;
     m_EditLinkIndex = 0;
+    LinkMgr.SetLinkGraphDirty();
 }
 
 void AdvLinkMgrSingleton::Renew()
@@ -81,6 +83,7 @@ AdvLink* AdvLinkMgrSingleton::AddLink( const string & name )
     alink->SetName( link_name );
     m_LinkVec.push_back( alink );
     m_EditLinkIndex = (int)m_LinkVec.size() - 1;
+    LinkMgr.SetLinkGraphDirty();
 
     return alink;
 }
@@ -100,6 +103,7 @@ void AdvLinkMgrSingleton::DelLink( AdvLink* link_ptr )
 
     vector_remove_val( m_LinkVec, link_ptr );
     delete link_ptr;
+    LinkMgr.SetLinkGraphDirty();
 }
 
 void AdvLinkMgrSingleton::DelAllLinks( )
@@ -112,6 +116,7 @@ void AdvLinkMgrSingleton::DelAllLinks( )
         delete m_LinkVec[i];
     }
     m_LinkVec.clear();
+    LinkMgr.SetLinkGraphDirty();
 }
 
 void AdvLinkMgrSingleton::CheckLinks()
@@ -67,6 +67,23 @@ double CalcFourDigitCamber( double CLi, double p )
     return CLi / CLi1;
 }
 
+//==== Exact Match Of Two Point Lists ====//
+static bool SamePnts( const vector< vec3d > & a, const vector< vec3d > & b )
+{
+    if ( a.size() != b.size() )
+    {
+        return false;
+    }
+    for ( int i = 0 ; i < ( int )a.size() ; i++ )
+    {
+        if ( a[i].x() != b[i].x() || a[i].y() != b[i].y() || a[i].z() != b[i].z() )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 //==== Default Constructor ====//
 Airfoil::Airfoil( ) : XSecCurve( )
 {
@@ -649,6 +666,12 @@ SixSeries::SixSeries( ) : Airfoil( )
     m_IdealCl.Init( "IdealCl", m_GroupName, this, 0.0, 0.0, 1.0 );
     m_A.Init( "A", m_GroupName, this, 1.0, 0.0, 1.0 );
     m_ThickChord.SetUpperLimit( 0.5 );
+
+    m_CacheValid = false;
+    m_CacheSer = 0;
+    m_CacheToc = 0.0f;
+    m_CacheCli = 0.0f;
+    m_CacheA = 0.0f;
 }
 
 //==== Update ====//
@@ -668,33 +691,47 @@ void SixSeries::Update()
         sixser = -( m_Series() + 58 );
     }
 
-    //==== Generate Airfoil ====//
-    sixseries_( &sixser, &toc, &cli, &ta );
+    //==== Planform Edits Leave The Shape Alone ====//
+    if ( m_CacheValid && sixser == m_CacheSer && toc == m_CacheToc && cli == m_CacheCli && ta == m_CacheA )
+    {
+        m_Curve = m_CacheCurve;
+        Airfoil::Update();
+        return;
+    }
 
-    unsigned int num_pnts_upper = sixpnts_.nmu;
-    unsigned int num_pnts_lower = sixpnts_.nml;
+    vector< vec3d > pnts;
+    unsigned int num_pnts_lower = 0;
 
-    // Force trailing edge point closed and x = 1.0.
-    double yte = ( sixpnts_.yyl[ num_pnts_lower - 1 ] + sixpnts_.yyu[ num_pnts_upper - 1 ] ) * 0.5;
-    sixpnts_.yyl[ num_pnts_lower - 1 ] = yte;
-    sixpnts_.yyu[ num_pnts_upper - 1 ] = yte;
+    // The generator works in a Fortran common block, so wings updating in parallel take turns.
+    #pragma omp critical( six_series )
+    {
+        //==== Generate Airfoil ====//
+        sixseries_( &sixser, &toc, &cli, &ta );
 
-    sixpnts_.xxl[ num_pnts_lower - 1 ] = 1.0;
-    sixpnts_.xxu[ num_pnts_upper - 1 ] = 1.0;
+        unsigned int num_pnts_upper = sixpnts_.nmu;
+        num_pnts_lower = sixpnts_.nml;
 
-    //==== Load Points ====//
-    vector< vec3d > pnts;
-    pnts.resize( num_pnts_lower + num_pnts_upper - 1 );
-    int k = 0;
-    for ( int i = num_pnts_lower - 1 ; i >= 0 ; i-- )
-    {
-        pnts[k] = vec3d( sixpnts_.xxl[i], sixpnts_.yyl[i], 0.0 );
-        k++;
-    }
-    for ( int i = 1 ; i < num_pnts_upper; i++ )
-    {
-        pnts[k] = vec3d( sixpnts_.xxu[i], sixpnts_.yyu[i], 0.0 );
-        k++;
+        // Force trailing edge point closed and x = 1.0.
+        double yte = ( sixpnts_.yyl[ num_pnts_lower - 1 ] + sixpnts_.yyu[ num_pnts_upper - 1 ] ) * 0.5;
+        sixpnts_.yyl[ num_pnts_lower - 1 ] = yte;
+        sixpnts_.yyu[ num_pnts_upper - 1 ] = yte;
+
+        sixpnts_.xxl[ num_pnts_lower - 1 ] = 1.0;
+        sixpnts_.xxu[ num_pnts_upper - 1 ] = 1.0;
+
+        //==== Load Points ====//
+        pnts.resize( num_pnts_lower + num_pnts_upper - 1 );
+        int k = 0;
+        for ( int i = num_pnts_lower - 1 ; i >= 0 ; i-- )
+        {
+            pnts[k] = vec3d( sixpnts_.xxl[i], sixpnts_.yyl[i], 0.0 );
+            k++;
+        }
+        for ( int i = 1 ; i < num_pnts_upper; i++ )
+        {
+            pnts[k] = vec3d( sixpnts_.xxu[i], sixpnts_.yyu[i], 0.0 );
+            k++;
+        }
     }
 
     vector< double > arclen;
@@ -731,6 +768,13 @@ void SixSeries::Update()
 
     m_Curve.InterpolatePCHIP( pnts, arclen, false );
 
+    m_CacheCurve = m_Curve;
+    m_CacheSer = sixser;
+    m_CacheToc = toc;
+    m_CacheCli = cli;
+    m_CacheA = ta;
+    m_CacheValid = true;
+
     Airfoil::Update();
 }
 
@@ -959,6 +1003,13 @@ FileAirfoil::FileAirfoil( ) : Airfoil( )
 
 void FileAirfoil::MakeCurve()
 {
+    //==== Refit Only When The Points Change ====//
+    if ( !m_CacheUpperPnts.empty() && SamePnts( m_CacheUpperPnts, m_UpperPnts ) && SamePnts( m_CacheLowerPnts, m_LowerPnts ) )
+    {
+        m_Curve = m_CacheCurve;
+        return;
+    }
+
     //==== Load Points ====//
     vector< vec3d > pnts;
 
@@ -1006,6 +1057,10 @@ void FileAirfoil::MakeCurve()
     }
 
     m_Curve.InterpolatePCHIP( pnts, arclen, false );
+
+    m_CacheCurve = m_Curve;
+    m_CacheUpperPnts = m_UpperPnts;
+    m_CacheLowerPnts = m_LowerPnts;
 }
 
 //==== Update ====//
@@ -280,6 +280,14 @@ public:
 
 protected:
 
+    //==== Unit Chord Curve From The Last Generation, Reused While Shape Parms Are Unchanged ====//
+    VspCurve m_CacheCurve;
+    bool m_CacheValid;
+    int m_CacheSer;
+    float m_CacheToc;
+    float m_CacheCli;
+    float m_CacheA;
+
 };
 
 //==========================================================================//
@@ -373,6 +381,11 @@ protected:
 
     virtual void MakeCurve();
 
+    //==== Points The Cached Curve Was Fit To ====//
+    VspCurve m_CacheCurve;
+    vector< vec3d > m_CacheUpperPnts;
+    vector< vec3d > m_CacheLowerPnts;
+
     string m_AirfoilName;
     vector< vec3d > m_UpperPnts;
     vector< vec3d > m_LowerPnts;
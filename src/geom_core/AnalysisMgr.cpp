@@ -14,6 +14,7 @@
 #include "PropGeom.h"
 #include "VSPAEROMgr.h"
 #include "ParasiteDragMgr.h"
+#include "DesignVarMgr.h"
 
 #include <ctime>
 
@@ -22,6 +23,67 @@ void RWCollection::Clear()
     m_DataMap.clear();
 }
 
+//==== Key Holding Every Input Value, Equal Keys Mean Equal Inputs ====//
+string RWCollection::BuildKey()
+{
+    string key;
+    char str[256];
+
+    map< string, vector< NameValData > >::iterator iter;
+
+    for ( iter = m_DataMap.begin() ; iter != m_DataMap.end() ; ++iter )
+    {
+        for ( int i = 0 ; i < ( int )iter->second.size() ; i++ )
+        {
+            const NameValData & nvd = iter->second[i];
+
+            sprintf( str, "|%d:", nvd.GetType() );
+            key += iter->first + str;
+
+            const vector< int > & ivec = nvd.GetIntData();
+            for ( int j = 0 ; j < ( int )ivec.size() ; j++ )
+            {
+                sprintf( str, "%d,", ivec[j] );
+                key += str;
+            }
+
+            const vector< double > & dvec = nvd.GetDoubleData();
+            for ( int j = 0 ; j < ( int )dvec.size() ; j++ )
+            {
+                sprintf( str, "%.17g,", dvec[j] );
+                key += str;
+            }
+
+            const vector< string > & svec = nvd.GetStringData();
+            for ( int j = 0 ; j < ( int )svec.size() ; j++ )
+            {
+                sprintf( str, "%d:", ( int )svec[j].size() );
+                key += str + svec[j];
+            }
+
+            const vector< vec3d > & vvec = nvd.GetVec3dData();
+            for ( int j = 0 ; j < ( int )vvec.size() ; j++ )
+            {
+                sprintf( str, "%.17g,%.17g,%.17g,", vvec[j].x(), vvec[j].y(), vvec[j].z() );
+                key += str;
+            }
+
+            const vector< vector< double > > & dmat = nvd.GetDoubleMatData();
+            for ( int j = 0 ; j < ( int )dmat.size() ; j++ )
+            {
+                key += ";";
+                for ( int k = 0 ; k < ( int )dmat[j].size() ; k++ )
+                {
+                    sprintf( str, "%.17g,", dmat[j][k] );
+                    key += str;
+                }
+            }
+        }
+    }
+
+    return key;
+}
+
 //======================================================================================//
 //======================================================================================//
 //======================================================================================//
@@ -29,6 +91,7 @@ void RWCollection::Clear()
 //==== Constructor ====//
 AnalysisMgrSingleton::AnalysisMgrSingleton()
 {
+    m_CacheFlag = false;
 }
 //==== Destructor ====//
 AnalysisMgrSingleton::~AnalysisMgrSingleton()
@@ -126,6 +189,22 @@ string AnalysisMgrSingleton::ExecAnalysis( const string & analysis )
         return ret;
     }
 
+    //==== Unchanged Vehicle And Inputs Since The Last Run, Return Its Results ====//
+    string input_key;
+    if ( m_CacheFlag )
+    {
+        input_key = analysis_ptr->m_Inputs.BuildKey();
+
+        if ( !analysis_ptr->m_CacheResultID.empty() &&
+             ResultsMgr.ValidResultsID( analysis_ptr->m_CacheResultID ) &&
+             analysis_ptr->m_CacheInputKey == input_key &&
+             analysis_ptr->m_CacheStateKey == BuildStateKey() )
+        {
+            m_AnalysisExecutionDuration = 0;
+            return analysis_ptr->m_CacheResultID;
+        }
+    }
+
     std::clock_t start = std::clock();
 
     string res = analysis_ptr->Execute();
@@ -138,9 +217,68 @@ string AnalysisMgrSingleton::ExecAnalysis( const string & analysis )
         res_ptr->Add( NameValData( "Analysis_Duration_Sec", m_AnalysisExecutionDuration ) );
     }
 
+    // State taken after the run, as analyses may add or change Geoms themselves
+    if ( m_CacheFlag && res_ptr )
+    {
+        analysis_ptr->m_CacheInputKey = input_key;
+        analysis_ptr->m_CacheStateKey = BuildStateKey();
+        analysis_ptr->m_CacheResultID = res;
+    }
+    else
+    {
+        analysis_ptr->m_CacheResultID.clear();
+    }
+
     return res;
 }
 
+//==== Forget Cached Results Of One Or All Analyses ====//
+void AnalysisMgrSingleton::InvalidateCache( const string & analysis )
+{
+    map < string, Analysis* >::const_iterator it;
+
+    for ( it = m_AnalysisMap.begin(); it != m_AnalysisMap.end(); ++it )
+    {
+        if ( analysis.empty() || it->first == analysis )
+        {
+            it->second->m_CacheStateKey.clear();
+            it->second->m_CacheInputKey.clear();
+            it->second->m_CacheResultID.clear();
+        }
+    }
+}
+
+//==== Key Of The Vehicle State Seen By An Analysis ====//
+// Every Parm change takes a new change count.  Geoms added, removed or moved
+// between sets change without one, so their IDs and set flags are included.
+string AnalysisMgrSingleton::BuildStateKey()
+{
+    string key;
+    char str[256];
+
+    sprintf( str, "%d", ParmMgr.GetLastChangeCnt() );
+    key = str;
+
+    Vehicle *veh = VehicleMgr.GetVehicle();
+    if ( veh )
+    {
+        vector< Geom* > geom_vec = veh->FindGeomVec( veh->GetGeomVec() );
+
+        for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+        {
+            key += "|" + geom_vec[i]->GetID() + ":";
+
+            vector< bool > set_flags = geom_vec[i]->GetSetFlags();
+            for ( int j = 0 ; j < ( int )set_flags.size() ; j++ )
+            {
+                key += set_flags[j] ? "1" : "0";
+            }
+        }
+    }
+
+    return key;
+}
+
 bool AnalysisMgrSingleton::ValidAnalysisName( const string & analysis )
 {
     Analysis* analysis_ptr = FindAnalysis( analysis );
@@ -443,11 +581,21 @@ void AnalysisMgrSingleton::RegisterBuiltins()
     RegisterAnalysis( "DegenGeom", dga );
 
 
+    DesignOfExperimentsAnalysis *doe = new DesignOfExperimentsAnalysis();
+
+    RegisterAnalysis( "DesignOfExperiments", doe );
+
+
     EmintonLordAnalysis *ema = new EmintonLordAnalysis();
 
     RegisterAnalysis( "EmintonLord", ema );
 
 
+    InterferenceAnalysis *ifa = new InterferenceAnalysis();
+
+    RegisterAnalysis( "Interference", ifa );
+
+
     MassPropAnalysis *mpa = new MassPropAnalysis();
 
     RegisterAnalysis( "MassProp", mpa );
@@ -567,6 +715,8 @@ void CompGeomAnalysis::SetDefaults()
     {
         m_Inputs.Add( NameValData( "WriteCSVFlag", veh->getExportCompGeomCsvFile() ) );
         m_Inputs.Add( NameValData( "WriteDragTSVFlag", veh->getExportDragBuildTsvFile() ) );
+        m_Inputs.Add( NameValData( "TessStride", veh->m_CompGeomTessStride() ) );
+        m_Inputs.Add( NameValData( "ErrorEstFlag", ( int )veh->m_CompGeomErrorEst() ) );
     }
 }
 
@@ -608,6 +758,18 @@ string CompGeomAnalysis::Execute()
         nvd = m_Inputs.FindPtr( "WriteDragTSVFlag", 0 );
         veh->setExportDragBuildTsvFile( !!nvd->GetInt( 0 ) );
 
+        nvd = m_Inputs.FindPtr( "TessStride", 0 );
+        if ( nvd )
+        {
+            veh->m_CompGeomTessStride.Set( nvd->GetInt( 0 ) );
+        }
+
+        nvd = m_Inputs.FindPtr( "ErrorEstFlag", 0 );
+        if ( nvd )
+        {
+            veh->m_CompGeomErrorEst.Set( !!nvd->GetInt( 0 ) );
+        }
+
         string geom = veh->CompGeomAndFlatten( geomSet, halfMeshFlag, subSurfFlag );
 
         res = ResultsMgr.FindLatestResultsID( "Comp_Geom" );
@@ -630,6 +792,7 @@ void DegenGeomAnalysis::SetDefaults()
     {
         m_Inputs.Add( NameValData( "WriteCSVFlag", veh->getExportDegenGeomCsvFile() ) );
         m_Inputs.Add( NameValData( "WriteMFileFlag", veh->getExportDegenGeomMFile() ) );
+        m_Inputs.Add( NameValData( "WriteBinFileFlag", veh->getExportDegenGeomBinFile() ) );
     }
 }
 
@@ -643,8 +806,10 @@ string DegenGeomAnalysis::Execute()
         int set_num = vsp::SET_ALL;
         bool write_csv_orig = veh->getExportDegenGeomCsvFile();
         bool write_mfile_orig = veh->getExportDegenGeomMFile();
+        bool write_bin_orig = veh->getExportDegenGeomBinFile();
         bool write_csv = write_csv_orig;
         bool write_mfile = write_mfile_orig;
+        bool write_bin = write_bin_orig;
 
         NameValData *nvd;
         nvd = m_Inputs.FindPtr( "Set", 0 );
@@ -662,9 +827,15 @@ string DegenGeomAnalysis::Execute()
         {
             write_mfile = ( bool )nvd->GetInt( 0 );
         }
+        nvd = m_Inputs.FindPtr( "WriteBinFileFlag", 0 );
+        if ( nvd )
+        {
+            write_bin = ( bool )nvd->GetInt( 0 );
+        }
 
         veh->setExportDegenGeomCsvFile( write_csv );
         veh->setExportDegenGeomMFile( write_mfile );
+        veh->setExportDegenGeomBinFile( write_bin );
 
         veh->CreateDegenGeom( set_num );
         veh->WriteDegenGeomFile();
@@ -672,6 +843,7 @@ string DegenGeomAnalysis::Execute()
 
         veh->setExportDegenGeomCsvFile( write_csv_orig );
         veh->setExportDegenGeomMFile( write_mfile_orig );
+        veh->setExportDegenGeomBinFile( write_bin_orig );
 
         res = ResultsMgr.FindLatestResultsID( "DegenGeom" );
 
@@ -680,6 +852,63 @@ string DegenGeomAnalysis::Execute()
     return res;
 }
 
+//======================================================================================//
+//=============================== Design Of Experiments ================================//
+//======================================================================================//
+
+void DesignOfExperimentsAnalysis::SetDefaults()
+{
+    m_Inputs.Clear();
+
+    // One row of values per design, in DesignVarMgr variable order.
+    m_Inputs.Add( NameValData( "DesignPoints", vector < double > () ) );
+
+    vector < string > analysis_vec;
+    analysis_vec.push_back( "CompGeom" );
+    m_Inputs.Add( NameValData( "Analyses", analysis_vec ) );
+
+    m_Inputs.Add( NameValData( "RestoreFlag", 1 ) );
+
+    // Forked worker processes sharing the loaded vehicle, POSIX only.
+    m_Inputs.Add( NameValData( "NumWorkers", 1 ) );
+}
+
+string DesignOfExperimentsAnalysis::Execute()
+{
+    vector < double > design_points;
+    vector < string > analysis_vec;
+    bool restore_flag = true;
+
+    NameValData *nvd = NULL;
+
+    nvd = m_Inputs.FindPtr( "DesignPoints", 0 );
+    if ( nvd )
+    {
+        design_points = nvd->GetDoubleData();
+    }
+
+    nvd = m_Inputs.FindPtr( "Analyses", 0 );
+    if ( nvd )
+    {
+        analysis_vec = nvd->GetStringData();
+    }
+
+    nvd = m_Inputs.FindPtr( "RestoreFlag", 0 );
+    if ( nvd )
+    {
+        restore_flag = ( bool )nvd->GetInt( 0 );
+    }
+
+    int nworker = 1;
+    nvd = m_Inputs.FindPtr( "NumWorkers", 0 );
+    if ( nvd )
+    {
+        nworker = nvd->GetInt( 0 );
+    }
+
+    return DesignVarMgr.EvaluateDOE( design_points, analysis_vec, restore_flag, nworker );
+}
+
 //======================================================================================//
 //=============================== Emington Lord Analysis ===============================//
 //======================================================================================//
@@ -733,6 +962,48 @@ string EmintonLordAnalysis::Execute()
     return string();
 }
 
+//======================================================================================//
+//================================= Interference =======================================//
+//======================================================================================//
+
+void InterferenceAnalysis::SetDefaults()
+{
+    m_Inputs.Clear();
+    m_Inputs.Add( NameValData( "Set", 0 ) );
+    m_Inputs.Add( NameValData( "MaxClearance", -1.0 ) );
+}
+
+string InterferenceAnalysis::Execute()
+{
+    string res;
+
+    Vehicle *veh = VehicleMgr.GetVehicle();
+
+    if ( veh )
+    {
+        int geomSet = 0;
+        double maxClearance = -1.0;
+
+        NameValData *nvd = NULL;
+
+        nvd = m_Inputs.FindPtr( "Set", 0 );
+        if ( nvd )
+        {
+            geomSet = nvd->GetInt( 0 );
+        }
+
+        nvd = m_Inputs.FindPtr( "MaxClearance", 0 );
+        if ( nvd )
+        {
+            maxClearance = nvd->GetDouble( 0 );
+        }
+
+        res = veh->Interference( geomSet, maxClearance );
+    }
+
+    return res;
+}
+
 //======================================================================================//
 //================================= Mass Properties ====================================//
 //======================================================================================//
@@ -746,11 +1017,16 @@ void MassPropAnalysis::SetDefaults()
     if ( veh )
     {
         m_Inputs.Add( NameValData( "NumMassSlices", veh->m_NumMassSlices ) );
+        m_Inputs.Add( NameValData( "TessStride", veh->m_CompGeomTessStride() ) );
+        m_Inputs.Add( NameValData( "ErrorEstFlag", ( int )veh->m_CompGeomErrorEst() ) );
     }
     else
     {
         m_Inputs.Add( NameValData( "NumMassSlices", 20 ) );
+        m_Inputs.Add( NameValData( "TessStride", 1 ) );
+        m_Inputs.Add( NameValData( "ErrorEstFlag", 0 ) );
     }
+    m_Inputs.Add( NameValData( "MassPropMode", vsp::MASS_PROP_SLICE ) );
 }
 
 string MassPropAnalysis::Execute()
@@ -763,6 +1039,7 @@ string MassPropAnalysis::Execute()
     {
         int geomSet = 0;
         int numMassSlice = 20;
+        int mode = vsp::MASS_PROP_SLICE;
 
         NameValData *nvd = NULL;
 
@@ -778,7 +1055,25 @@ string MassPropAnalysis::Execute()
             numMassSlice = nvd->GetInt( 0 );
         }
 
-        string geom = veh->MassPropsAndFlatten( geomSet, numMassSlice );
+        nvd = m_Inputs.FindPtr( "MassPropMode", 0 );
+        if ( nvd )
+        {
+            mode = nvd->GetInt( 0 );
+        }
+
+        nvd = m_Inputs.FindPtr( "TessStride", 0 );
+        if ( nvd )
+        {
+            veh->m_CompGeomTessStride.Set( nvd->GetInt( 0 ) );
+        }
+
+        nvd = m_Inputs.FindPtr( "ErrorEstFlag", 0 );
+        if ( nvd )
+        {
+            veh->m_CompGeomErrorEst.Set( !!nvd->GetInt( 0 ) );
+        }
+
+        string geom = veh->MassPropsAndFlatten( geomSet, numMassSlice, true, true, mode );
 
         res = ResultsMgr.FindLatestResultsID( "Mass_Properties" );
     }
@@ -889,6 +1184,8 @@ void ProjectionAnalysis::SetDefaults()
     m_Inputs.Add( NameValData( "DirectionGeomID", "" ) );
 
     m_Inputs.Add( NameValData( "Direction", vec3d( 1.0, 0.0, 0.0 ) ) );
+
+    m_Inputs.Add( NameValData( "TessFactor", 1.0 ) );
 }
 
 
@@ -964,6 +1261,16 @@ string ProjectionAnalysis::Execute()
         dir = ProjectionMgr.GetDirection( directionType, directionGeomID );
     }
 
+    double tessFactor = 1.0;
+    nvd = m_Inputs.FindPtr( "TessFactor", 0 );
+    if ( nvd )
+    {
+        tessFactor = nvd->GetDouble( 0 );
+    }
+
+    double orig_tess_factor = ProjectionMgr.m_TessFactor();
+    ProjectionMgr.m_TessFactor.Set( tessFactor );
+
     Results* res = NULL;
 
     switch ( boundaryType )
@@ -1000,6 +1307,8 @@ string ProjectionAnalysis::Execute()
             break;
     }
 
+    ProjectionMgr.m_TessFactor.Set( orig_tess_factor );
+
     if ( !res )
     {
         return string();
@@ -1236,6 +1545,7 @@ void VSPAEROSinglePointAnalysis::SetDefaults()
         m_Inputs.Add( NameValData( "NCPU",               VSPAEROMgr.m_NCPU.Get()               ) );
         m_Inputs.Add( NameValData( "FixedWakeFlag",      VSPAEROMgr.m_FixedWakeFlag.Get()      ) );
         m_Inputs.Add( NameValData( "WakeNumIter",        VSPAEROMgr.m_WakeNumIter.Get()        ) );
+        m_Inputs.Add( NameValData( "AdaptiveWakeFlag",   VSPAEROMgr.m_AdaptiveWakeFlag.Get()   ) );
         m_Inputs.Add( NameValData( "NumWakeNodes",       VSPAEROMgr.m_NumWakeNodes.Get()       ) );
         m_Inputs.Add( NameValData( "UnsteadyType",       VSPAEROMgr.m_StabilityType.Get()      ) );
         m_Inputs.Add( NameValData( "Precondition",       VSPAEROMgr.m_Precondition.Get()       ) );
@@ -1441,6 +1751,7 @@ string VSPAEROSinglePointAnalysis::Execute()
         int ncpuOrig                 = VSPAEROMgr.m_NCPU.Get();
         bool fixedWakeFlagOrig       = VSPAEROMgr.m_FixedWakeFlag.Get();
         int wakeNumIterOrig          = VSPAEROMgr.m_WakeNumIter.Get();
+        bool adaptiveWakeFlagOrig    = VSPAEROMgr.m_AdaptiveWakeFlag.Get();
         int numWakeNodesOrig         = VSPAEROMgr.m_NumWakeNodes.Get();
         int stabilityTypeOrig        = VSPAEROMgr.m_StabilityType.Get();
         int preconditionOrig         = VSPAEROMgr.m_Precondition.Get();
@@ -1470,6 +1781,11 @@ string VSPAEROSinglePointAnalysis::Execute()
         {
             VSPAEROMgr.m_WakeNumIter.Set( nvd->GetInt(0) );
         }
+        nvd = m_Inputs.FindPtr( "AdaptiveWakeFlag" );
+        if ( nvd )
+        {
+            VSPAEROMgr.m_AdaptiveWakeFlag.Set( nvd->GetInt( 0 ) );
+        }
         nvd = m_Inputs.FindPtr( "NumWakeNodes" );
         if ( nvd )
         {
@@ -1658,6 +1974,7 @@ string VSPAEROSinglePointAnalysis::Execute()
         VSPAEROMgr.m_NCPU.Set( ncpuOrig );
         VSPAEROMgr.m_FixedWakeFlag.Set( fixedWakeFlagOrig );
         VSPAEROMgr.m_WakeNumIter.Set( wakeNumIterOrig );
+        VSPAEROMgr.m_AdaptiveWakeFlag.Set( adaptiveWakeFlagOrig );
         VSPAEROMgr.m_NumWakeNodes.Set( numWakeNodesOrig );
         VSPAEROMgr.m_StabilityType.Set( stabilityTypeOrig );
         VSPAEROMgr.m_Precondition.Set( preconditionOrig );
@@ -1706,6 +2023,7 @@ void VSPAEROSweepAnalysis::SetDefaults()
         m_Inputs.Add( NameValData( "NCPU",               VSPAEROMgr.m_NCPU.Get()               ) );
         m_Inputs.Add( NameValData( "FixedWakeFlag",      VSPAEROMgr.m_FixedWakeFlag.Get()      ) );
         m_Inputs.Add( NameValData( "WakeNumIter",        VSPAEROMgr.m_WakeNumIter.Get()        ) );
+        m_Inputs.Add( NameValData( "AdaptiveWakeFlag",   VSPAEROMgr.m_AdaptiveWakeFlag.Get()   ) );
         m_Inputs.Add( NameValData( "NumWakeNodes",       VSPAEROMgr.m_NumWakeNodes.Get()       ) );
         m_Inputs.Add( NameValData( "UnsteadyType",       VSPAEROMgr.m_StabilityType.Get()      ) );
         m_Inputs.Add( NameValData( "Precondition",       VSPAEROMgr.m_Precondition.Get()       ) );
@@ -1947,6 +2265,7 @@ string VSPAEROSweepAnalysis::Execute()
         int ncpuOrig                 = VSPAEROMgr.m_NCPU.Get();
         bool fixedWakeFlagOrig       = VSPAEROMgr.m_FixedWakeFlag.Get();
         int wakeNumIterOrig          = VSPAEROMgr.m_WakeNumIter.Get();
+        bool adaptiveWakeFlagOrig    = VSPAEROMgr.m_AdaptiveWakeFlag.Get();
         int numWakeNodesOrig         = VSPAEROMgr.m_NumWakeNodes.Get();
         int stabilityTypeOrig        = VSPAEROMgr.m_StabilityType.Get();
         int preconditionOrig         = VSPAEROMgr.m_Precondition.Get();
@@ -1976,6 +2295,11 @@ string VSPAEROSweepAnalysis::Execute()
         {
             VSPAEROMgr.m_WakeNumIter.Set( nvd->GetInt(0) );
         }
+        nvd = m_Inputs.FindPtr( "AdaptiveWakeFlag" );
+        if ( nvd )
+        {
+            VSPAEROMgr.m_AdaptiveWakeFlag.Set( nvd->GetInt( 0 ) );
+        }
         nvd = m_Inputs.FindPtr( "NumWakeNodes" );
         if ( nvd )
         {
@@ -2167,6 +2491,7 @@ string VSPAEROSweepAnalysis::Execute()
         VSPAEROMgr.m_NCPU.Set( ncpuOrig );
         VSPAEROMgr.m_FixedWakeFlag.Set( fixedWakeFlagOrig );
         VSPAEROMgr.m_WakeNumIter.Set( wakeNumIterOrig );
+        VSPAEROMgr.m_AdaptiveWakeFlag.Set( adaptiveWakeFlagOrig );
         VSPAEROMgr.m_StabilityType.Set( stabilityTypeOrig );
         VSPAEROMgr.m_Precondition.Set( preconditionOrig );
         VSPAEROMgr.m_BatchModeFlag.Set( BatchModeFlagOrig );
@@ -2423,8 +2748,41 @@ string ParasiteDragFullAnalysis::Execute()
         nvd = m_Inputs.FindPtr( "RecomputeGeom", 0);
         ParasiteDragMgr.SetRecomputeGeomFlag( (bool)(nvd->GetInt(0)) );
 
+        // Flight condition sweep when Vinf, Altitude or the temperature input hold several values
+        vector < double > vinfVec, altVec, tempVec;
+        nvd = m_Inputs.FindPtr( "Vinf", 0 );
+        if ( nvd )
+        {
+            vinfVec = nvd->GetDoubleData();
+        }
+        nvd = m_Inputs.FindPtr( "Altitude", 0 );
+        if ( nvd )
+        {
+            altVec = nvd->GetDoubleData();
+        }
+        if ( ParasiteDragMgr.m_FreestreamType() == vsp::ATMOS_TYPE_US_STANDARD_1976 ||
+             ParasiteDragMgr.m_FreestreamType() == vsp::ATMOS_TYPE_HERRINGTON_1966 )
+        {
+            nvd = m_Inputs.FindPtr( "DeltaTemp", 0 );
+        }
+        else
+        {
+            nvd = m_Inputs.FindPtr( "Temperature", 0 );
+        }
+        if ( nvd )
+        {
+            tempVec = nvd->GetDoubleData();
+        }
+
         // Execute analysis
-        res_id = ParasiteDragMgr.ComputeBuildUp();
+        if ( vinfVec.size() > 1 || altVec.size() > 1 || tempVec.size() > 1 )
+        {
+            res_id = ParasiteDragMgr.ComputeBuildUpSweep( vinfVec, altVec, tempVec );
+        }
+        else
+        {
+            res_id = ParasiteDragMgr.ComputeBuildUp();
+        }
 
         // ==== Restore original values that were overwritten by analysis inputs ==== //
         // Geometry Set
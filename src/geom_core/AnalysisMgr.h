@@ -30,6 +30,8 @@ public:
 
     void Clear();
 
+    string BuildKey();
+
 };
 
 //=== Analysis ===//
@@ -44,6 +46,11 @@ public:
 
     RWCollection m_Inputs;
 
+    //==== Memoized Execution, See AnalysisMgrSingleton::SetCacheFlag ====//
+    string m_CacheStateKey;
+    string m_CacheInputKey;
+    string m_CacheResultID;
+
 };
 
 
@@ -69,6 +76,16 @@ public:
 
     string ExecAnalysis( const string & analysis );
 
+    void SetCacheFlag( bool flag )
+    {
+        m_CacheFlag = flag;
+    }
+    bool GetCacheFlag()
+    {
+        return m_CacheFlag;
+    }
+    void InvalidateCache( const string & analysis = string() );
+
     bool ValidAnalysisName( const string & analysis );
     bool ValidAnalysisInputDataIndex( const string & analysis, const string & name, int index = 0 );
 
@@ -107,6 +124,9 @@ private:
 
     double m_AnalysisExecutionDuration; // Time to execute most recent analysis
 
+    string BuildStateKey();
+    bool m_CacheFlag;                   // Return the previous results of unchanged calls
+
     //==== Default Return Vectors ====//
     vector< int > m_DefaultIntVec;
     vector< double > m_DefaultDoubleVec;
@@ -143,6 +163,14 @@ public:
     virtual string Execute();
 };
 
+class DesignOfExperimentsAnalysis : public Analysis
+{
+public:
+
+    virtual void SetDefaults();
+    virtual string Execute();
+};
+
 class EmintonLordAnalysis : public Analysis
 {
 public:
@@ -152,6 +180,15 @@ public:
 
 };
 
+class InterferenceAnalysis : public Analysis
+{
+public:
+
+    virtual void SetDefaults();
+    virtual string Execute();
+
+};
+
 class MassPropAnalysis : public Analysis
 {
 public:
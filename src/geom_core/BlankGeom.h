@@ -18,11 +18,19 @@ public:
     BlankGeom( Vehicle* vehicle_ptr );
     virtual ~BlankGeom();
 
+    //==== Origin And Axis Are Built In The Model Frame ====//
+    virtual bool SurfDependsOnPlacement()           { return true; }
+
     virtual int GetNumMainSurfs()
     {
         return 0;
     };
 
+    virtual bool CanDeferLoad()
+    {
+        return false;
+    }
+
     virtual void UpdateSurf();
     virtual void UpdateDrawObj();
     virtual void LoadDrawObjs(vector< DrawObj* > & draw_obj_vec);
@@ -61,6 +61,7 @@ ConformalGeom::ConformalGeom( Vehicle* vehicle_ptr ) : Geom( vehicle_ptr )
     m_ChordTrimMax.SetDescript( "Max Chord Trim Value" );
 
     m_WingParentFlag = false;
+    m_SampleParentRevision = -1;
     m_TessU = 41;
     m_TessW = 41;
 
@@ -100,9 +101,19 @@ void ConformalGeom::UpdateSurf()
     //==== Copy XForm/Tess Data From Parent ====//
     CopyDataFrom( parent_geom );
 
+    //==== Parent Surface And Parms Unchanged - Reuse The Last Offset Surfaces ====//
+    vector< double > key;
+    BuildConformalKey( parent_geom, key );
+    if ( !m_ConformalSurfVec.empty() && m_ConformalParentID == parent_geom->GetID() && key == m_ConformalKey )
+    {
+        m_MainSurfVec = m_ConformalSurfVec;
+        return;
+    }
+    m_ConformalSurfVec.clear();
+
     //==== Parent Reference Surfaces  ====//
-    vector< VspSurf > parent_surf_vec;
-    parent_geom->GetMainSurfVec( parent_surf_vec );
+    UpdateParentSamples( parent_geom );
+    vector< VspSurf > & parent_surf_vec = m_ParentSurfVec;
 
     //===== Copy Parent ====//
     vector< string > parent_id_vec;
@@ -155,7 +166,7 @@ void ConformalGeom::UpdateSurf()
                 }
 
                 //==== Make Sure Ribs Are Centered ====//
-                CenterRibCurves(m_MainSurfVec[i], parent_surf_vec[i], offset);
+                CenterRibCurves(m_MainSurfVec[i], m_ParentRibCenterVec[i]);
 
                 //==== Offset Ribs ====//
                 OffsetEndRibs(m_MainSurfVec[i], offset);
@@ -186,6 +197,62 @@ void ConformalGeom::UpdateSurf()
     //==== Delete Geom Copy ====//
     m_Vehicle->DeleteGeom( copy_geom->GetID() );
 
+    //==== Keyed After The Update, SetWingTrimParms May Have Changed Trim Parms ====//
+    m_ConformalParentID = parent_geom->GetID();
+    BuildConformalKey( parent_geom, m_ConformalKey );
+    m_ConformalSurfVec = m_MainSurfVec;
+}
+
+//==== Parent Surface Revision And Every Parm The Offset Surfaces Depend On ====//
+void ConformalGeom::BuildConformalKey( Geom* parent_geom, vector< double > & key )
+{
+    key.clear();
+    key.push_back( parent_geom->GetSurfRevision() );
+
+    Parm* parm_vec[] = { &m_Offset, &m_UTrimFlag, &m_UTrimMin, &m_UTrimMax,
+                         &m_V1TrimFlag, &m_V1TrimBegin, &m_V1TrimEnd,
+                         &m_V2TrimFlag, &m_V2TrimBegin, &m_V2TrimEnd,
+                         &m_ChordTrimFlag, &m_ChordTrimMin, &m_ChordTrimMax,
+                         &m_CapUMinOption, &m_CapUMaxOption, &m_CapWMinOption, &m_CapWMaxOption };
+
+    for ( int i = 0 ; i < ( int )( sizeof( parm_vec ) / sizeof( Parm* ) ) ; i++ )
+    {
+        key.push_back( parm_vec[i]->Get() );
+    }
+}
+
+//==== Sample Parent Reference Surfaces Once Per Parent Surface Revision ====//
+void ConformalGeom::UpdateParentSamples( Geom* parent_geom )
+{
+    if ( m_SampleParentID == parent_geom->GetID() && m_SampleParentRevision == parent_geom->GetSurfRevision() )
+    {
+        return;
+    }
+
+    m_SampleParentID = parent_geom->GetID();
+    m_SampleParentRevision = parent_geom->GetSurfRevision();
+
+    parent_geom->GetMainSurfVec( m_ParentSurfVec );
+
+    m_ParentRibCenterVec.clear();
+    m_ParentRibCenterVec.resize( m_ParentSurfVec.size() );
+
+    for ( int i = 0 ; i < ( int )m_ParentSurfVec.size() ; i++ )
+    {
+        if ( m_ParentSurfVec[i].GetSkinType() != VspSurf::SKIN_RIBS )
+        {
+            continue;
+        }
+
+        vector< rib_data_type > ref_rib_vec;
+        m_ParentSurfVec[i].GetSkinRibVec( ref_rib_vec );
+
+        for ( int j = 0 ; j < ( int )ref_rib_vec.size() ; j++ )
+        {
+            piecewise_curve_type ref_crv = ref_rib_vec[j].get_f();
+            m_ParentRibCenterVec[i].push_back( ComputeCenter( ref_crv ) );
+        }
+    }
 }
 
 
@@ -343,23 +410,17 @@ bool ConformalGeom::CheckIfRibIsPoint( rib_data_type & rib )
 }
 
 //==== Move Rib To Center s ====//
-void ConformalGeom::CenterRibCurves( VspSurf & surf, VspSurf &  ref_surf, double offset )
+void ConformalGeom::CenterRibCurves( VspSurf & surf, const vector< vec3d > & ref_center_vec )
 {
     vector< rib_data_type > rib_vec;
     surf.GetSkinRibVec( rib_vec );
 
-    vector< rib_data_type > ref_rib_vec;
-    ref_surf.GetSkinRibVec( ref_rib_vec );
-
-    for ( int i = 0 ; i < rib_vec.size() ; i++ )
+    for ( int i = 0 ; i < rib_vec.size() && i < ( int )ref_center_vec.size() ; i++ )
     {
-        piecewise_curve_type ref_crv = ref_rib_vec[i].get_f();
-        vec3d ref_center = ComputeCenter( ref_crv );
-
         piecewise_curve_type crv = rib_vec[i].get_f();
         vec3d center = ComputeCenter( crv);
 
-        vec3d del_center = ref_center - center;
+        vec3d del_center = ref_center_vec[i] - center;
         TranslateCurve( crv, del_center );
 
         rib_vec[i].set_f( crv );
@@ -30,6 +30,10 @@ public:
     ConformalGeom( Vehicle* vehicle_ptr );
     virtual ~ConformalGeom();
 
+    //==== Update Copies And Deletes Geoms In The Vehicle ====//
+    virtual bool IsParallelUpdateSafe()             { return false; }
+    virtual bool SurfDependsOnPlacement()           { return true; }
+
     virtual void Scale();
 
     Parm m_Offset;                  // Offset to Conformal Surface
@@ -69,7 +73,7 @@ protected:
 
     virtual bool CheckIfRibIsPoint( rib_data_type & rib );
 
-    virtual void CenterRibCurves( VspSurf & surf, VspSurf &  ref_surf, double offset );
+    virtual void CenterRibCurves( VspSurf & surf, const vector< vec3d > & ref_center_vec );
     virtual void OffsetEndRibs( VspSurf & surf, double offset );
     virtual void AdjustShape( VspSurf & surf, VspSurf &  ref_surf, double offset );
 
@@ -88,9 +92,23 @@ protected:
 
     virtual double ComputeMaxOffsetError( VspSurf & surf, VspSurf &  ref_surf, double offset, int num_u, int num_w );
 
+    virtual void BuildConformalKey( Geom* parent_geom, vector< double > & key );
+    virtual void UpdateParentSamples( Geom* parent_geom );
+
 
     bool m_WingParentFlag;
 
+    //==== Result Of The Last Offset, Reused While Parent And Parms Are Unchanged ====//
+    string m_ConformalParentID;
+    vector< double > m_ConformalKey;
+    vector< VspSurf > m_ConformalSurfVec;
+
+    //==== Parent Data Sampled At One Parent Surface Revision, Reused By Offset Edits ====//
+    string m_SampleParentID;
+    int m_SampleParentRevision;
+    vector< VspSurf > m_ParentSurfVec;
+    vector< vector< vec3d > > m_ParentRibCenterVec;
+
 };
 
 
@@ -16,6 +16,8 @@
 
 using namespace vsp;
 
+thread_local string CustomGeomMgrSingleton::m_CurrGeom;
+
 //==== Constructor ====//
 CustomGeomMgrSingleton::CustomGeomMgrSingleton()
 {
@@ -44,7 +46,7 @@ void CustomGeomMgrSingleton::ReadCustomScripts( Vehicle* veh )
         // content returns a repeated module name.  Repeated file names with different content
         // are made unique and returned.  This filters duplicate module names to prevent displaying
         // duplicates.
-        vector< string > mod_vec = ScriptMgr.ReadScriptsFromDir( scriptDirs[k], ".vsppart" );
+        vector< string > mod_vec = ScriptMgr.ReadScriptsFromDir( scriptDirs[k], ".vsppart", true );
 
         for ( int i = 0 ; i < (int)mod_vec.size() ; i++ )
         {
@@ -297,6 +299,32 @@ void CustomGeomMgrSingleton::SetVspSurfCfdType( int type, int surf_id )
     }
 }
 
+//==== Enable Surface Cache For Current Custom Geom =====//
+void CustomGeomMgrSingleton::SetCustomSurfCache( bool flag )
+{
+    Geom* gptr = VehicleMgr.GetVehicle()->FindGeom( m_CurrGeom );
+
+    //==== Check If Geom is Valid and Correct Type ====//
+    if ( gptr && gptr->GetType().m_Type == CUSTOM_GEOM_TYPE )
+    {
+        CustomGeom* custom_geom = dynamic_cast<CustomGeom*>( gptr );
+        custom_geom->SetSurfCacheFlag( flag );
+    }
+}
+
+//==== Allow Parallel Update Of Current Custom Geom =====//
+void CustomGeomMgrSingleton::SetCustomParallelUpdate( bool flag )
+{
+    Geom* gptr = VehicleMgr.GetVehicle()->FindGeom( m_CurrGeom );
+
+    //==== Check If Geom is Valid and Correct Type ====//
+    if ( gptr && gptr->GetType().m_Type == CUSTOM_GEOM_TYPE )
+    {
+        CustomGeom* custom_geom = dynamic_cast<CustomGeom*>( gptr );
+        custom_geom->SetParallelUpdateFlag( flag );
+    }
+}
+
 void CustomGeomMgrSingleton::SetupCustomDefaultSource(  int type, int surf_index,
                                                         double l1, double r1, double u1, double w1,
                                                         double l2, double r2, double u2, double w2 )
@@ -640,6 +668,9 @@ CustomGeom::CustomGeom( Vehicle* vehicle_ptr ) : Geom( vehicle_ptr )
     m_VspSurfType = vsp::NORMAL_SURF;
     m_VspSurfCfdType = vsp::CFD_NORMAL;
     m_ConformalFlag = false;
+    m_ParallelUpdateFlag = false;
+    m_SurfCacheFlag = false;
+    m_SurfCacheValid = false;
 }
 
 //==== Destructor ====//
@@ -659,6 +690,13 @@ void CustomGeom::Clear()
 
     //==== Clear XSec Surfs====//
     ClearXSecSurfs();
+
+    //==== Init Script Decides Again ====//
+    m_ParallelUpdateFlag = false;
+    m_SurfCacheFlag = false;
+    m_SurfCacheValid = false;
+    m_SurfCacheKey.clear();
+    m_SurfCacheVec.clear();
 }
 
 //==== Init Geometry ====//
@@ -735,6 +773,7 @@ bool CustomGeom::CheckClearTriggerEvent( int index )
         {
             trigger = true;
             m_TriggerVec[index] = 0;
+            m_SurfCacheValid = false;       // Script reacts to the event in UpdateSurf
             ForceUpdate();
         }
     }
@@ -750,10 +789,76 @@ void CustomGeom::UpdateSurf()
         return;
     }
 
+    //==== Script Parms Unchanged - Reuse Its Surfaces ====//
+    vector< double > key;
+    if ( m_SurfCacheFlag && !m_ConformalFlag )
+    {
+        BuildSurfCacheKey( key );
+
+        if ( m_SurfCacheValid && key == m_SurfCacheKey )
+        {
+            m_MainSurfVec = m_SurfCacheVec;
+            return;
+        }
+    }
+
     CustomGeomMgr.SetCurrCustomGeom( GetID() );
 
     //==== Call Script ====//
     ScriptMgr.ExecuteScript( GetScriptModuleName().c_str(), "void UpdateSurf()" );
+
+    if ( m_SurfCacheFlag )
+    {
+        // Keyed on the values the script left, so an unchanged next update matches
+        BuildSurfCacheKey( m_SurfCacheKey );
+        m_SurfCacheVec = m_MainSurfVec;
+        m_SurfCacheValid = true;
+    }
+}
+
+//==== Each Run Takes Its Own Script Context, Only Script Globals Would Be Shared ====//
+bool CustomGeom::IsParallelUpdateSafe()
+{
+    if ( !Geom::IsParallelUpdateSafe() )
+    {
+        return false;
+    }
+    return m_ParallelUpdateFlag || ScriptMgr.IsModuleStateless( m_ScriptModuleName );
+}
+
+//==== Enable Or Drop The Surface Cache ====//
+void CustomGeom::SetSurfCacheFlag( bool flag )
+{
+    m_SurfCacheFlag = flag;
+    m_SurfCacheValid = false;
+    m_SurfCacheVec.clear();
+}
+
+//==== Values Of The Script Parms And Of The XSecs It Builds ====//
+void CustomGeom::BuildSurfCacheKey( vector< double > & key )
+{
+    key.clear();
+
+    for ( int i = 0 ; i < ( int )m_ParmVec.size() ; i++ )
+    {
+        key.push_back( m_ParmVec[i]->Get() );
+    }
+
+    for ( int i = 0 ; i < ( int )m_XSecSurfVec.size() ; i++ )
+    {
+        vector< string > parm_vec;
+        m_XSecSurfVec[i]->AddLinkableParms( parm_vec );
+
+        key.push_back( m_XSecSurfVec[i]->NumXSec() );
+        for ( int j = 0 ; j < ( int )parm_vec.size() ; j++ )
+        {
+            Parm* p = ParmMgr.FindParm( parm_vec[j] );
+            if ( p )
+            {
+                key.push_back( p->Get() );
+            }
+        }
+    }
 }
 
 void CustomGeom::UpdateFlags()
@@ -1027,7 +1132,7 @@ xmlNodePtr CustomGeom::DecodeXml( xmlNodePtr & node )
         string safe_file_contents = XmlUtil::FindString( custom_node, "ScriptFileContents", string() );
         string file_contents = XmlUtil::ConvertFromXMLSafeChars( safe_file_contents );
 
-        string new_module_name = ScriptMgr.ReadScriptFromMemory( module_name, file_contents );
+        string new_module_name = ScriptMgr.ReadScriptFromMemory( module_name, file_contents, true );
         CustomGeomMgr.InitGeom( GetID(), new_module_name, module_name );
 
         for ( int i = 0 ; i < (int)m_ParmVec.size() ; i++ )
@@ -90,6 +90,12 @@ public:
     //==== Surface Cfd type (NORM, NEGATIVE, TRANSPARENT) ====//
     void SetVspSurfCfdType ( int type, int surf_id = -1);
 
+    //==== Reuse The Surfaces While The Script Parms Are Unchanged ====//
+    void SetCustomSurfCache( bool flag );
+
+    //==== Let The Current Geom Update Concurrently With Other Geoms ====//
+    void SetCustomParallelUpdate( bool flag );
+
     //==== Set Up Default Sources =====//
     void SetupCustomDefaultSource( int type, int surf_index, double l1, double r1, double u1, double w1,
                                    double l2 = 0, double r2 = 0, double u2 = 0, double w2 = 0 );
@@ -123,7 +129,7 @@ private:
     CustomGeomMgrSingleton( CustomGeomMgrSingleton const& copy );          // Not Implemented
     CustomGeomMgrSingleton& operator=( CustomGeomMgrSingleton const& copy ); // Not Implemented
 
-    string m_CurrGeom;
+    static thread_local string m_CurrGeom;     // Per thread, scripts for different Geoms may run at once
     vector< GeomType > m_CustomTypeVec;
     map< string, string > m_ModuleGeomIDMap;
 
@@ -173,6 +179,11 @@ public:
     CustomGeom( Vehicle* vehicle_ptr );
     virtual ~CustomGeom();
 
+    //==== Scripts Without Mutable Globals, Or That Declare Themselves Safe, May Run Concurrently ====//
+    virtual bool IsParallelUpdateSafe();
+    virtual void SetParallelUpdateFlag( bool flag )     { m_ParallelUpdateFlag = flag; }
+    virtual bool SurfDependsOnPlacement()               { return true; }
+
     void Clear();
     void InitGeom( );
     void SetScriptModuleName( const string& name )      { m_ScriptModuleName = name; }
@@ -214,6 +225,10 @@ public:
     virtual void SetVspSurfType( int type, int surf_id = -1 );
     virtual void SetVspSurfCfdType( int type, int surf_id = -1);
 
+    //==== Surface Cache - Only For Scripts Whose UpdateSurf Depends On Nothing But Its Parms ====//
+    virtual void SetSurfCacheFlag( bool flag );
+    virtual bool GetSurfCacheFlag()                         { return m_SurfCacheFlag; }
+
     //==== CFD Sources =====//
     virtual void AddDefaultSources( double base_len = 1.0);
     virtual void SetUpDefaultSource( SourceData & sd )      { m_DefaultSourceVec.push_back( sd ); }
@@ -252,6 +267,15 @@ protected:
     bool m_ConformalFlag;
     double m_ConformalOffset;
     virtual void ApplyConformalOffset( double off );
+
+    virtual void BuildSurfCacheKey( vector< double > & key );
+
+    bool m_ParallelUpdateFlag;              // Set by the script, its globals are safe to share
+
+    bool m_SurfCacheFlag;
+    bool m_SurfCacheValid;
+    vector< double > m_SurfCacheKey;        // Script and XSec parm values after the last UpdateSurf script run
+    vector< VspSurf > m_SurfCacheVec;       // m_MainSurfVec as the script left it, before end caps
 };
 
 
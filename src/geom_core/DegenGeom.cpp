@@ -100,10 +100,7 @@ void DegenGeom::transform_section( const int &startPnt, vector < vec3d > &sect,
 
     build_trans_mat( chordVec, up, areaNormal, p, trans, invtrans );
 
-    for( int i = 0; i < num_pnts; i++ )
-    {
-        sect[i] = trans.xform( sect[i] );
-    }
+    trans.xformvec( &sect[0], num_pnts );
 }
 
 void DegenGeom::calculate_section_prop( const vector < vec3d > &sect, double &len, double &area, vec3d &xcgshell, vec3d &xcgsolid, vector < double > &Ishell, vector < double > &Isolid )
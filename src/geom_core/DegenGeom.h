@@ -169,7 +169,7 @@ public:
     {
         return degenDisk;
     }
-    vector <DegenStick> getDegenSticks()
+    const vector <DegenStick> & getDegenSticks() const
     {
         return degenSticks;
     }
@@ -11,6 +11,16 @@
 #include "ParmMgr.h"
 #include "Vehicle.h"
 #include "StlHelper.h"
+#include "AnalysisMgr.h"
+#include "ProcessUtil.h"
+#include "MessageMgr.h"
+#include "ThreadMgr.h"
+
+#ifndef WIN32
+#include <sys/wait.h>
+#include <poll.h>
+#include <errno.h>
+#endif
 
 //==== Constructor ====//
 DesignVar:: DesignVar()
@@ -415,3 +425,435 @@ void DesignVarMgrSingleton::ReadDesVarsXDDM( const string &newfile )
 
 //  return 1;
 }
+
+//==== Evaluate A Design Of Experiments ====//
+// design_points holds one row per design, with one value for each design
+// variable in m_VarVec order.  Each design is set, the vehicle updated, and
+// each analysis in analysis_vec executed.  The result IDs, status and timing
+// of every design are gathered into one DesignOfExperiments result.
+//
+// With nworker > 1 on POSIX systems the designs are split among worker
+// processes forked from the updated vehicle, which share its memory
+// copy-on-write.  Each worker runs its parallel loops serially, sends its
+// results back through a pipe and the vehicle of this process is left untouched.  Analyses that write fixed
+// file names (VSPAERO, meshing) would collide between workers.
+string DesignVarMgrSingleton::EvaluateDOE( const vector < double > & design_points, const vector < string > & analysis_vec, bool restore_flag, int nworker )
+{
+    Vehicle* veh = VehicleMgr.GetVehicle();
+
+    int nvar = m_VarVec.size();
+
+    if ( !veh || nvar == 0 || design_points.size() % nvar != 0 )
+    {
+        fprintf( stderr, "ERROR: DOE design points must have one value for each of the %d design variables\n", nvar );
+        return string();
+    }
+
+    for ( int j = 0 ; j < ( int )analysis_vec.size() ; j++ )
+    {
+        if ( !AnalysisMgr.ValidAnalysisName( analysis_vec[j] ) )
+        {
+            fprintf( stderr, "ERROR: DOE analysis %s not found\n", analysis_vec[j].c_str() );
+            return string();
+        }
+    }
+
+    int ndes = design_points.size() / nvar;
+
+    vector < Parm* > parm_vec( nvar );
+    vector < string > id_vec( nvar );
+    vector < double > orig_vec( nvar );
+
+    for ( int i = 0 ; i < nvar ; i++ )
+    {
+        parm_vec[i] = ParmMgr.FindParm( m_VarVec[i]->m_ParmID );
+        id_vec[i] = m_VarVec[i]->m_ParmID;
+        orig_vec[i] = parm_vec[i] ? parm_vec[i]->Get() : 0.0;
+    }
+
+    vector < vector < double > > point_mat( ndes );
+    vector < vector < string > > res_id_mat( analysis_vec.size(), vector < string > ( ndes ) );
+    vector < int > status_vec( ndes, 1 );
+    vector < double > duration_vec( ndes, 0.0 );
+    vector < string > message_vec( ndes );
+
+    for ( int d = 0 ; d < ndes ; d++ )
+    {
+        point_mat[d].assign( design_points.begin() + d * nvar, design_points.begin() + ( d + 1 ) * nvar );
+    }
+
+    nworker = min( nworker, ndes );
+
+    bool forked = false;
+#ifndef WIN32
+    if ( nworker > 1 )
+    {
+        forked = EvaluateDOEForked( nworker, point_mat, parm_vec, id_vec, analysis_vec, res_id_mat, status_vec, duration_vec, message_vec );
+    }
+#endif
+
+    for ( int d = 0 ; d < ndes && !forked ; d++ )
+    {
+        double start = GetWallTime();
+
+        vector < string > rid_vec( analysis_vec.size() );
+        EvaluateDesign( point_mat[d], parm_vec, id_vec, analysis_vec, rid_vec, status_vec[d], message_vec[d] );
+
+        for ( int j = 0 ; j < ( int )analysis_vec.size() ; j++ )
+        {
+            res_id_mat[j][d] = rid_vec[j];
+        }
+
+        duration_vec[d] = GetWallTime() - start;
+
+        printf( "DOE design %d of %d: %s (%.2f sec)\n", d + 1, ndes,
+                status_vec[d] ? "done" : message_vec[d].c_str(), duration_vec[d] );
+        fflush( stdout );
+    }
+
+    if ( restore_flag && !forked )
+    {
+        for ( int i = 0 ; i < nvar ; i++ )
+        {
+            if ( parm_vec[i] )
+            {
+                parm_vec[i]->Set( orig_vec[i] );
+            }
+        }
+        veh->Update();
+    }
+
+    Results* res = ResultsMgr.CreateResults( "DesignOfExperiments" );
+
+    if ( !res )
+    {
+        return string();
+    }
+
+    res->Add( NameValData( "Num_Designs", ndes ) );
+    res->Add( NameValData( "Var_ID", id_vec ) );
+    res->Add( NameValData( "Design_Points", point_mat ) );
+    res->Add( NameValData( "Analysis", analysis_vec ) );
+
+    for ( int j = 0 ; j < ( int )analysis_vec.size() ; j++ )
+    {
+        res->Add( NameValData( analysis_vec[j] + "_Result_ID", res_id_mat[j] ) );
+    }
+
+    res->Add( NameValData( "Status", status_vec ) );
+    res->Add( NameValData( "Message", message_vec ) );
+    res->Add( NameValData( "Duration_Sec", duration_vec ) );
+
+    return res->GetID();
+}
+
+//==== Set One Design, Update And Run Each Analysis ====//
+void DesignVarMgrSingleton::EvaluateDesign( const vector < double > & point, const vector < Parm* > & parm_vec, const vector < string > & id_vec,
+                                            const vector < string > & analysis_vec, vector < string > & res_id_vec, int & status, string & message )
+{
+    Vehicle* veh = VehicleMgr.GetVehicle();
+
+    for ( int i = 0 ; i < ( int )parm_vec.size() ; i++ )
+    {
+        if ( parm_vec[i] )
+        {
+            // Set with delayed updates.
+            parm_vec[i]->Set( point[i] );
+        }
+        else
+        {
+            status = 0;
+            message = "Missing design variable " + id_vec[i];
+        }
+    }
+
+    veh->Update();
+
+    for ( int j = 0 ; j < ( int )analysis_vec.size() && status ; j++ )
+    {
+        string rid = AnalysisMgr.ExecAnalysis( analysis_vec[j] );
+
+        if ( !ResultsMgr.ValidResultsID( rid ) )
+        {
+            status = 0;
+            message = "Analysis " + analysis_vec[j] + " failed";
+        }
+        else
+        {
+            res_id_vec[j] = rid;
+        }
+    }
+}
+
+#ifndef WIN32
+//==== Pipe Record Helpers ====//
+static void WritePipeInt( FILE* fid, int val )
+{
+    fwrite( &val, sizeof( int ), 1, fid );
+}
+
+static void WritePipeString( FILE* fid, const string & str )
+{
+    WritePipeInt( fid, ( int )str.size() );
+    fwrite( str.c_str(), sizeof( char ), str.size(), fid );
+}
+
+static bool ReadPipeInt( FILE* fid, int & val )
+{
+    return fread( &val, sizeof( int ), 1, fid ) == 1;
+}
+
+static bool ReadPipeString( FILE* fid, string & str )
+{
+    int len = 0;
+    if ( !ReadPipeInt( fid, len ) || len < 0 )
+    {
+        return false;
+    }
+    str.resize( len );
+    return len == 0 || fread( &str[0], sizeof( char ), len, fid ) == ( size_t )len;
+}
+
+//==== Evaluate Designs In Forked Worker Processes ====//
+// Worker w evaluates designs w, w + nworker, ...  For each design it writes
+//   int design, int status, double duration, string message,
+//   int number of Results, each Results (children first, see ResultsMgr::ReadBinaryResults),
+//   then one string result ID per analysis.
+// Returns false if no worker could be started.
+bool DesignVarMgrSingleton::EvaluateDOEForked( int nworker, const vector < vector < double > > & point_mat, const vector < Parm* > & parm_vec,
+                                               const vector < string > & id_vec, const vector < string > & analysis_vec,
+                                               vector < vector < string > > & res_id_mat, vector < int > & status_vec,
+                                               vector < double > & duration_vec, vector < string > & message_vec )
+{
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    int ndes = point_mat.size();
+    int nana = analysis_vec.size();
+
+    // Workers start from a fully updated vehicle and an empty stdout buffer.
+    veh->Update();
+    fflush( stdout );
+    fflush( stderr );
+
+    vector < pid_t > pid_vec;
+    vector < int > read_vec;
+
+    for ( int w = 0 ; w < nworker ; w++ )
+    {
+        int fd[2];
+        if ( pipe( fd ) < 0 )
+        {
+            break;
+        }
+
+        pid_t pid = fork();
+        if ( pid == 0 )
+        {
+            close( fd[PIPE_READ] );
+            for ( int i = 0 ; i < ( int )read_vec.size() ; i++ )
+            {
+                close( read_vec[i] );
+            }
+
+            // No listener in this process may touch the parent's GUI.
+            MessageMgr::getInstance().UnRegisterAll();
+
+            // The OpenMP pool the parent already started does not survive fork, so a
+            // parallel region here could hang.  Workers run every loop serially.
+            ThreadMgr.SetNumThreads( 1 );
+
+            FILE* out = fdopen( fd[PIPE_WRITE], "wb" );
+
+            for ( int d = w ; d < ndes && out ; d += nworker )
+            {
+                double start = GetWallTime();
+
+                vector < string > rid_vec( nana );
+                int status = 1;
+                string message;
+                EvaluateDesign( point_mat[d], parm_vec, id_vec, analysis_vec, rid_vec, status, message );
+
+                double duration = GetWallTime() - start;
+
+                vector < string > tree_vec;
+                for ( int j = 0 ; j < nana ; j++ )
+                {
+                    ResultsMgr.GetResultsTree( rid_vec[j], tree_vec );
+                }
+
+                WritePipeInt( out, d );
+                WritePipeInt( out, status );
+                fwrite( &duration, sizeof( double ), 1, out );
+                WritePipeString( out, message );
+                WritePipeInt( out, ( int )tree_vec.size() );
+                for ( int i = 0 ; i < ( int )tree_vec.size() ; i++ )
+                {
+                    ResultsMgr.FindResultsPtr( tree_vec[i] )->WriteBinaryFile( out, false );
+                }
+                for ( int j = 0 ; j < nana ; j++ )
+                {
+                    WritePipeString( out, rid_vec[j] );
+                }
+                fflush( out );
+
+                printf( "DOE design %d of %d: %s (%.2f sec, worker %d)\n", d + 1, ndes,
+                        status ? "done" : message.c_str(), duration, w );
+                fflush( stdout );
+            }
+
+            if ( out )
+            {
+                fclose( out );
+            }
+
+            // Skip static destructors and atexit handlers, which belong to the parent.
+            _exit( 0 );
+        }
+
+        close( fd[PIPE_WRITE] );
+
+        if ( pid < 0 )
+        {
+            close( fd[PIPE_READ] );
+            break;
+        }
+
+        pid_vec.push_back( pid );
+        read_vec.push_back( fd[PIPE_READ] );
+    }
+
+    if ( pid_vec.empty() )
+    {
+        return false;
+    }
+
+    //==== Drain Every Pipe Together, A Worker Blocks Once Its Pipe Is Full ====//
+    // Records are spooled to a temporary file per worker and parsed once all have finished.
+    vector < FILE* > spool_vec( pid_vec.size() );
+    vector < pollfd > poll_vec( pid_vec.size() );
+    for ( int w = 0 ; w < ( int )pid_vec.size() ; w++ )
+    {
+        spool_vec[w] = tmpfile();
+        poll_vec[w].fd = read_vec[w];
+        poll_vec[w].events = POLLIN;
+        poll_vec[w].revents = 0;
+    }
+
+    int nopen = poll_vec.size();
+    vector < char > buf( 65536 );
+    while ( nopen > 0 )
+    {
+        if ( poll( &poll_vec[0], poll_vec.size(), -1 ) < 0 )
+        {
+            if ( errno == EINTR )
+            {
+                continue;
+            }
+            break;
+        }
+
+        for ( int w = 0 ; w < ( int )poll_vec.size() ; w++ )
+        {
+            if ( poll_vec[w].fd < 0 || !( poll_vec[w].revents & ( POLLIN | POLLHUP | POLLERR ) ) )
+            {
+                continue;
+            }
+
+            ssize_t n = read( poll_vec[w].fd, &buf[0], buf.size() );
+            if ( n > 0 )
+            {
+                if ( spool_vec[w] )
+                {
+                    fwrite( &buf[0], sizeof( char ), n, spool_vec[w] );
+                }
+            }
+            else if ( n == 0 || errno != EINTR )
+            {
+                close( poll_vec[w].fd );
+                poll_vec[w].fd = -1;      // Ignored by poll from now on
+                nopen--;
+            }
+        }
+    }
+
+    for ( int w = 0 ; w < ( int )poll_vec.size() ; w++ )
+    {
+        if ( poll_vec[w].fd >= 0 )
+        {
+            close( poll_vec[w].fd );
+        }
+
+        int wstatus = 0;
+        waitpid( pid_vec[w], &wstatus, 0 );
+    }
+
+    // Designs of workers that failed to start or died are reported as failed.
+    vector < bool > done_vec( ndes, false );
+
+    for ( int w = 0 ; w < ( int )pid_vec.size() ; w++ )
+    {
+        FILE* in = spool_vec[w];
+        if ( in )
+        {
+            rewind( in );
+        }
+
+        int d = 0;
+        while ( in && ReadPipeInt( in, d ) && d >= 0 && d < ndes )
+        {
+            int status = 0;
+            int ntree = 0;
+            double duration = 0.0;
+            string message;
+            if ( !ReadPipeInt( in, status ) || fread( &duration, sizeof( double ), 1, in ) != 1 ||
+                 !ReadPipeString( in, message ) || !ReadPipeInt( in, ntree ) )
+            {
+                break;
+            }
+
+            map < string, string > id_map;
+            int nread = 0;
+            while ( nread < ntree && ResultsMgr.ReadBinaryResults( in, id_map ) )
+            {
+                nread++;
+            }
+
+            vector < string > rid_vec( nana );
+            bool ok = ( nread == ntree );
+            for ( int j = 0 ; j < nana && ok ; j++ )
+            {
+                ok = ReadPipeString( in, rid_vec[j] );
+            }
+            if ( !ok )
+            {
+                break;
+            }
+
+            for ( int j = 0 ; j < nana ; j++ )
+            {
+                map < string, string >::const_iterator it = id_map.find( rid_vec[j] );
+                res_id_mat[j][d] = ( it != id_map.end() ) ? it->second : string();
+            }
+            status_vec[d] = status;
+            duration_vec[d] = duration;
+            message_vec[d] = message;
+            done_vec[d] = true;
+        }
+
+        if ( in )
+        {
+            fclose( in );
+        }
+    }
+
+    for ( int d = 0 ; d < ndes ; d++ )
+    {
+        if ( !done_vec[d] )
+        {
+            status_vec[d] = 0;
+            message_vec[d] = "Worker process failed";
+        }
+    }
+
+    return true;
+}
+#endif
@@ -77,6 +77,8 @@ public:
 
     virtual void ResetWorkingVar();
 
+    virtual string EvaluateDOE( const vector < double > & design_points, const vector < string > & analysis_vec, bool restore_flag = true, int nworker = 1 );
+
     IntParm m_WorkingXDDMType;
 
 private:
@@ -88,6 +90,15 @@ private:
     void Init();
     void Wype();
 
+    void EvaluateDesign( const vector < double > & point, const vector < Parm* > & parm_vec, const vector < string > & id_vec,
+                         const vector < string > & analysis_vec, vector < string > & res_id_vec, int & status, string & message );
+#ifndef WIN32
+    bool EvaluateDOEForked( int nworker, const vector < vector < double > > & point_mat, const vector < Parm* > & parm_vec,
+                            const vector < string > & id_vec, const vector < string > & analysis_vec,
+                            vector < vector < string > > & res_id_mat, vector < int > & status_vec,
+                            vector < double > & duration_vec, vector < string > & message_vec );
+#endif
+
     int m_CurrVarIndex;
 
     string m_WorkingParmID;
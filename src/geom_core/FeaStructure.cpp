@@ -470,8 +470,39 @@ bool FeaStructure::ValidFeaPartInd( int ind )
 
 void FeaStructure::UpdateFeaParts()
 {
+    //==== Parms Of Parts Built Independently Are Updated First, Serially ====//
+    vector < FeaPart* > parallel_vec;
     for ( unsigned int i = 0; i < m_FeaPartVec.size(); i++ )
     {
+        if ( m_FeaPartVec[i]->IsParallelUpdateSafe() && m_FeaPartVec[i]->NeedsUpdate() )
+        {
+            m_FeaPartVec[i]->UpdateSymmIndex();
+            m_FeaPartVec[i]->UpdateParms();
+            parallel_vec.push_back( m_FeaPartVec[i] );
+        }
+    }
+
+    //==== Their Surface Cuts And Projections Run Concurrently ====//
+    #pragma omp parallel for schedule( dynamic )
+    for ( int i = 0; i < ( int )parallel_vec.size(); i++ )
+    {
+        parallel_vec[i]->UpdateSurfs();
+        parallel_vec[i]->UpdateSymmParts();
+    }
+
+    for ( int i = 0; i < ( int )parallel_vec.size(); i++ )
+    {
+        parallel_vec[i]->MarkUpdated();
+    }
+
+    //==== Parts That Read Other Parts Or Create Parms Follow In Order ====//
+    for ( unsigned int i = 0; i < m_FeaPartVec.size(); i++ )
+    {
+        if ( m_FeaPartVec[i]->IsParallelUpdateSafe() )
+        {
+            continue;
+        }
+
         m_FeaPartVec[i]->UpdateSymmIndex();
         m_FeaPartVec[i]->Update();
 
@@ -854,6 +885,8 @@ FeaPart::FeaPart( const string& geomID, int type )
 {
     m_FeaPartType = type;
     m_ParentGeomID = geomID;
+    m_UpdateSurfRevision = -1;
+    m_UpdateChangeCnt = -1;
 
     m_MainSurfIndx.Init( "MainSurfIndx", "FeaPart", this, -1, -1, 1e12 );
     m_MainSurfIndx.SetDescript( "Surface Index for FeaPart" );
@@ -917,9 +950,33 @@ xmlNodePtr FeaPart::EncodeXml( xmlNodePtr & node )
 
 xmlNodePtr FeaPart::DecodeXml( xmlNodePtr & node )
 {
+    m_UpdateSurfRevision = -1;
     return ParmContainer::DecodeXml( node );
 }
 
+//==== Own Parms Or Parent Surface Changed Since MarkUpdated ====//
+bool FeaPart::NeedsUpdate()
+{
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    Geom* currgeom = veh ? veh->FindGeom( m_ParentGeomID ) : NULL;
+
+    if ( !currgeom || m_UpdateSurfRevision < 0 )
+    {
+        return true;
+    }
+
+    return currgeom->GetSurfRevision() != m_UpdateSurfRevision || GetLatestChangeCnt() != m_UpdateChangeCnt;
+}
+
+void FeaPart::MarkUpdated()
+{
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    Geom* currgeom = veh ? veh->FindGeom( m_ParentGeomID ) : NULL;
+
+    m_UpdateSurfRevision = currgeom ? currgeom->GetSurfRevision() : -1;
+    m_UpdateChangeCnt = GetLatestChangeCnt();
+}
+
 void FeaPart::SetDisplaySuffix( int num )
 {
     for ( int i = 0; i < (int)m_ParmVec.size(); i++ )
@@ -1053,6 +1110,7 @@ void FeaPart::DeleteFeaPartSurf( int ind )
     if ( m_FeaPartSurfVec.size() > 0 && ind < m_FeaPartSurfVec.size() && ind >= 0 )
     {
         m_FeaPartSurfVec.erase( m_FeaPartSurfVec.begin() + ind );
+        m_UpdateSurfRevision = -1;
     }
 }
 
@@ -1238,9 +1296,18 @@ FeaSlice::FeaSlice( const string& geomID, int type ) : FeaPart( geomID, type )
 }
 
 void FeaSlice::Update()
+{
+    UpdateParms();
+    UpdateSurfs();
+}
+
+void FeaSlice::UpdateParms()
 {
     UpdateParmLimits();
+}
 
+void FeaSlice::UpdateSurfs()
+{
     // Must call UpdateSymmIndex before
     if ( m_FeaPartSurfVec.size() > 0 )
     {
@@ -1864,6 +1931,11 @@ FeaSpar::FeaSpar( const string& geomID, int type ) : FeaSlice( geomID, type )
 void FeaSpar::Update()
 {
     UpdateParms();
+    UpdateSurfs();
+}
+
+void FeaSpar::UpdateSurfs()
+{
     ComputePlanarSurf();
 }
 
@@ -2309,8 +2381,17 @@ FeaRib::FeaRib( const string& geomID, int type ) : FeaSlice( geomID, type )
 
 void FeaRib::Update()
 {
-    UpdateParmLimits();
+    UpdateParms();
+    UpdateSurfs();
+}
 
+bool FeaRib::IsParallelUpdateSafe()
+{
+    return !m_BndBoxTrimFlag() && m_PerpendicularEdgeType() != vsp::SPAR_NORMAL;
+}
+
+void FeaRib::UpdateSurfs()
+{
     // Must call UpdateSymmIndex before
     if ( m_FeaPartSurfVec.size() > 0 )
     {
@@ -3295,7 +3376,7 @@ FeaSkin::FeaSkin( const string& geomID, int type ) : FeaPart( geomID, type )
 
 void FeaSkin::Update()
 {
-    BuildSkinSurf();
+    UpdateSurfs();
 }
 
 void FeaSkin::BuildSkinSurf()
@@ -3374,7 +3455,7 @@ FeaDome::FeaDome( const string& geomID, int type ) : FeaPart( geomID, type )
 
 void FeaDome::Update()
 {
-    BuildDomeSurf();
+    UpdateSurfs();
 }
 
 typedef eli::geom::curve::piecewise_ellipse_creator<double, 3, curve_tolerance_type> piecewise_dome_creator;
@@ -175,6 +175,15 @@ public:
     virtual void UpdateSymmParts();
     virtual void UpdateSymmIndex();
 
+    //==== Update Scheduling For FeaStructure::UpdateFeaParts ====//
+    // Parts that read nothing but their parent Geom split Update into UpdateParms, which may
+    // Set parms and runs serially, and UpdateSurfs, which runs concurrently with other parts.
+    virtual bool IsParallelUpdateSafe()                     { return false; }
+    virtual void UpdateParms()                              {}
+    virtual void UpdateSurfs()                              {}
+    virtual bool NeedsUpdate();
+    virtual void MarkUpdated();
+
     static string GetTypeName( int type );
 
     virtual bool RefFrameIsBody( int orientation_plane );
@@ -201,6 +210,7 @@ public:
     virtual void AddFeaPartSurf( VspSurf fea_surf )
     {
         m_FeaPartSurfVec.push_back( fea_surf );
+        m_UpdateSurfRevision = -1;
     }
     virtual void DeleteFeaPartSurf( int ind );
 
@@ -231,6 +241,9 @@ protected:
     vector < VspSurf > m_FeaPartSurfVec; 
 
     vector < DrawObj > m_FeaPartDO;
+
+    int m_UpdateSurfRevision;           // Parent Geom surface revision at the last MarkUpdated, -1 forces an update
+    int m_UpdateChangeCnt;              // Latest parm change count at the last MarkUpdated
 };
 
 class FeaSlice : public FeaPart
@@ -243,6 +256,10 @@ public:
     virtual void Update();
     virtual void UpdateParmLimits();
 
+    virtual bool IsParallelUpdateSafe()                     { return true; }
+    virtual void UpdateParms();
+    virtual void UpdateSurfs();
+
     virtual VspSurf ComputeSliceSurf();
 
     virtual void UpdateDrawObjs( int id, bool highlight );
@@ -280,6 +297,10 @@ public:
     virtual void Update();
     virtual void UpdateParms();
 
+    // Bounding box trimming builds a temporary FeaSlice, which registers parms
+    virtual bool IsParallelUpdateSafe()                     { return !m_BndBoxTrimFlag(); }
+    virtual void UpdateSurfs();
+
     virtual void ComputePlanarSurf();
     virtual void UpdateDrawObjs( int id, bool highlight );
 
@@ -306,6 +327,10 @@ public:
 
     virtual void UpdateParmLimits();
 
+    // Spar normal ribs read the spar surface and trimmed ribs build a temporary FeaSlice
+    virtual bool IsParallelUpdateSafe();
+    virtual void UpdateSurfs();
+
     virtual xmlNodePtr EncodeXml( xmlNodePtr & node );
     virtual xmlNodePtr DecodeXml( xmlNodePtr & node );
 
@@ -384,6 +409,9 @@ public:
 
     virtual void Update();
 
+    virtual bool IsParallelUpdateSafe()                     { return true; }
+    virtual void UpdateSurfs()                              { BuildSkinSurf(); }
+
     void BuildSkinSurf();
 
     virtual void UpdateDrawObjs( int id, bool highlight )    {}; // Do nothing for skins
@@ -406,6 +434,9 @@ public:
 
     virtual void Update();
 
+    virtual bool IsParallelUpdateSafe()                     { return true; }
+    virtual void UpdateSurfs()                              { BuildDomeSurf(); }
+
     void BuildDomeSurf();
 
     virtual void UpdateDrawObjs( int id, bool highlight );
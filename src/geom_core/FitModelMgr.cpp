@@ -678,6 +678,8 @@ void FitModelMgrSingleton::RefineTargetUW()
 
     int npt = m_TargetPts.size();
 
+    // Each point projects onto its own Geom's surface independently.
+    #pragma omp parallel for schedule( dynamic )
     for ( int i = 0 ; i < npt; i++ )
     {
         TargetPt* tpt = m_TargetPts[i];
@@ -693,6 +695,8 @@ void FitModelMgrSingleton::SearchTargetUW()
 
     int npt = m_TargetPts.size();
 
+    // Each point projects onto its own Geom's surface independently.
+    #pragma omp parallel for schedule( dynamic )
     for ( int i = 0 ; i < npt; i++ )
     {
         TargetPt* tpt = m_TargetPts[i];
@@ -828,6 +832,7 @@ void FitModelMgrSingleton::CalcMetrics( const double *x, double *y )
 
     int npt = m_TargetPts.size();
     // Calculate target point distances
+    #pragma omp parallel for
     for ( int i = 0 ; i < npt; i++ )
     {
         TargetPt* tpt = m_TargetPts[i];
@@ -851,8 +856,6 @@ void FitModelMgrSingleton::CalcMetricDeriv( const double *x, double *y, double *
     int i, j, xindx;
     double x0, dx;
 
-    double *fprm;
-    fprm = new double[m];
     double *xp;
     xp = new double[n];
 
@@ -863,6 +866,25 @@ void FitModelMgrSingleton::CalcMetricDeriv( const double *x, double *y, double *
 
     double eps = sqrt( dpmpar( 1.0 ) ); // sqrt of machine precision
 
+    // Start from the geometry at x, which may have moved to a rejected trial
+    // point since y was computed.
+    XtoParm( x );
+    VehicleMgr.GetVehicle()->Update( false );
+
+    // A perturbation only rebuilds the Geoms that depend on that variable, and
+    // the previous variable's Geoms rebuild as it is restored.  Points on Geoms
+    // whose surface revision did not change are at y, so their derivative is
+    // zero and the surface is not evaluated.
+    vector < int > rev_vec( npt, -1 );
+    for ( i = 0 ; i < npt; i++ )
+    {
+        Geom* g = m_TargetGeomPtrVec[i];
+        if ( g )
+        {
+            rev_vec[i] = g->GetSurfRevision();
+        }
+    }
+
     xindx = 0;
     for (j = 0; j < nvar; ++j)
     {
@@ -874,12 +896,34 @@ void FitModelMgrSingleton::CalcMetricDeriv( const double *x, double *y, double *
         }
 
         xp[xindx] = x0 + dx;
-        FitModelMgr.CalcMetrics( xp, fprm );
+        XtoParm( xp );
+        VehicleMgr.GetVehicle()->Update( false );
         xp[xindx] = x0;
 
-        for (i = 0; i < m; ++i)
+        #pragma omp parallel for
+        for ( i = 0 ; i < npt; i++ )
         {
-            yprm[i + xindx * m] = (fprm[i] - y[i]) / dx;
+            TargetPt* tpt = m_TargetPts[i];
+            Geom* g = m_TargetGeomPtrVec[i];
+
+            int rev = g ? g->GetSurfRevision() : -1;
+
+            if ( rev != rev_vec[i] )
+            {
+                rev_vec[i] = rev;
+
+                vec3d delta = tpt->CalcDelta( g );
+
+                yprm[3 * i + xindx * m] = ( delta.x() - y[3 * i] ) / dx;
+                yprm[3 * i + 1 + xindx * m] = ( delta.y() - y[3 * i + 1] ) / dx;
+                yprm[3 * i + 2 + xindx * m] = ( delta.z() - y[3 * i + 2] ) / dx;
+            }
+            else
+            {
+                yprm[3 * i + xindx * m] = 0.0;
+                yprm[3 * i + 1 + xindx * m] = 0.0;
+                yprm[3 * i + 2 + xindx * m] = 0.0;
+            }
         }
         xindx++;
     }
@@ -924,7 +968,6 @@ void FitModelMgrSingleton::CalcMetricDeriv( const double *x, double *y, double *
         }
     }
 
-    delete [] fprm;
     delete [] xp;
 }
 
@@ -14,6 +14,8 @@
 #include "ParmMgr.h"
 #include "SubSurfaceMgr.h"
 #include "HingeGeom.h"
+#include "ProcessUtil.h"
+#include "PerfStats.h"
 using namespace vsp;
 
 #include <float.h>
@@ -104,6 +106,10 @@ GeomBase::GeomBase( Vehicle* vehicle_ptr )
     m_Type.m_Type = BASE_GEOM_TYPE;
     m_Type.m_Name = m_Name;
     m_ParentID = string( "NONE" );
+
+    m_StagedUpdateFlag = false;
+    m_SurfDirtyFlag = true;
+    m_SurfRevision = 0;
 }
 
 //==== Destructor ====//
@@ -115,9 +121,23 @@ GeomBase::~GeomBase()
 //==== Parm Changed ====//
 void GeomBase::ParmChanged( Parm* parm_ptr, int type )
 {
+    m_SurfRevision++;
+
     if ( parm_ptr )
     {
-        m_UpdatedParmVec.push_back( parm_ptr->GetID() );
+        m_UpdatedParmVec.push_back( parm_ptr->GetHandle() );
+    }
+    else
+    {
+        m_SurfDirtyFlag = true;
+    }
+
+    //==== Defer Update Until The Batch Ends ====//
+    if ( m_Vehicle->InParmBatch() )
+    {
+        m_LateUpdateFlag = true;
+        m_Vehicle->AddParmBatchGeom( GetID() );
+        return;
     }
 
     if ( type == Parm::SET )
@@ -135,26 +155,83 @@ void GeomBase::ParmChanged( Parm* parm_ptr, int type )
         }
     }
 
+    //==== Slider Drags Rebuild Once Per GUI Tick, With The Latest Values ====//
+    if ( m_Vehicle->GetDeferDeviceUpdates() )
+    {
+        m_LateUpdateFlag = true;
+        m_Vehicle->AddParmBatchGeom( GetID() );
+        m_Vehicle->UpdateGui( GetID() );
+        return;
+    }
+
+    double start_time = GetWallTime();
+    m_StagedUpdateFlag = true;
     Update();
+    m_StagedUpdateFlag = false;
+    m_Vehicle->AddUpdateTime( GetWallTime() - start_time );
+
     m_Vehicle->ParmChanged( parm_ptr, type );
     m_UpdatedParmVec.clear();
 }
 
+//==== Any Parm May Have Changed, So The Whole Surface Is Rebuilt ====//
+void GeomBase::BulkParmChanged( Parm* last_parm )
+{
+    ParmChanged( NULL, Parm::SET );
+}
+
 void GeomBase::ForceUpdate()
 {
     m_LateUpdateFlag = true;
+    SetSurfDirtyFlag( true );
     m_Vehicle->Update();
     m_Vehicle->UpdateGui();
 
     m_UpdatedParmVec.clear();
 }
 
+//==== A Forced Late Update Rebuilds Everything ====//
+void GeomBase::SetLateUpdateFlag( bool flag )
+{
+    m_LateUpdateFlag = flag;
+    if ( flag )
+    {
+        SetSurfDirtyFlag( true );
+    }
+}
+
+void GeomBase::SetSurfDirtyFlag( bool flag )
+{
+    m_SurfDirtyFlag = flag;
+    if ( flag )
+    {
+        m_SurfRevision++;
+    }
+}
+
 //==== Check If Parm Is In Updated ParmVec ====//
 bool GeomBase::UpdatedParm( const string & id )
 {
+    Parm* parm_ptr = ParmMgr.FindParm( id );
+    if ( !parm_ptr )
+    {
+        return false;
+    }
+
+    return UpdatedParm( *parm_ptr );
+}
+
+bool GeomBase::UpdatedParm( const Parm & parm )
+{
+    int handle = parm.GetHandle();
+    if ( handle < 0 )
+    {
+        return false;
+    }
+
     for ( int i = 0 ; i < (int)m_UpdatedParmVec.size() ; i++ )
     {
-        if ( m_UpdatedParmVec[i] == id )
+        if ( m_UpdatedParmVec[i] == handle )
             return true;
     }
 
@@ -748,6 +825,10 @@ void GeomXForm::AcceptScale()
 Geom::Geom( Vehicle* vehicle_ptr ) : GeomXForm( vehicle_ptr )
 {
     m_UpdateBlock = false;
+    m_CopyEncodeFlag = false;
+    m_DeferredFlag = false;
+    m_UpdateStage = SURF_UPDATE_STAGE;
+    m_ParentUpdateStage = -1;
 
     m_Name = "Geom";
     m_Type.m_Type = GEOM_GEOM_TYPE;
@@ -758,6 +839,10 @@ Geom::Geom( Vehicle* vehicle_ptr ) : GeomXForm( vehicle_ptr )
     m_TessW.Init( "Tess_W", "Shape", this, 9, 2,  1001 );
     m_TessW.SetDescript( "Number of tessellated curves in the W direction" );
     m_TessW.SetMultShift( 4, 1 );
+    m_AdaptTessFlag.Init( "AdaptTessFlag", "Shape", this, false, 0, 1 );
+    m_AdaptTessFlag.SetDescript( "Flag to add tessellation where the surface curves, keeping Tess_U and Tess_W as the coarsest spacing" );
+    m_AdaptTessTol.Init( "AdaptTessTol", "Shape", this, 0.01, 1e-4, 0.1 );
+    m_AdaptTessTol.SetDescript( "Allowed deviation of an adaptive tessellation edge from the surface, as a fraction of the edge length" );
 
     m_WakeActiveFlag.Init( "Wake", "Shape", this, false, 0, 1 );
 
@@ -872,6 +957,9 @@ Geom::Geom( Vehicle* vehicle_ptr ) : GeomXForm( vehicle_ptr )
     m_ExpandedListFlag.SetDescript("Flag to determine whether or not this geom has a collapsed list in parasite drag");
 
     m_FeaStructCount = 0;
+    m_SubSurfStaleFlag = false;
+    m_FeaStructStaleFlag = false;
+    m_DrawObjStaleFlag = false;
 }
 //==== Destructor ====//
 Geom::~Geom()
@@ -960,75 +1048,218 @@ void Geom::CopyFrom( Geom* geom )
 {
     xmlNodePtr root = xmlNewNode( NULL, ( const xmlChar * )"Vsp_Geometry" );
 
+    geom->m_CopyEncodeFlag = true;
     geom->EncodeGeom( root );
+    geom->m_CopyEncodeFlag = false;
+
+    //==== Indexed Lookups And One Change Notification For The Whole Decode ====//
+    XmlUtil::BeginNodeIndex();
+    ParmMgr.BeginBulkDecode();
+
     DecodeGeom( root );
 
+    ParmMgr.EndBulkDecode();
+    XmlUtil::EndNodeIndex();
+
     xmlFreeNode( root );
+
+    CopyPayloadFrom( geom );
 }
 
 //==== Update ====//
 void Geom::Update( bool fullupdate )
 {
-    if ( m_UpdateBlock )
+    if ( m_UpdateBlock || m_DeferredFlag )
         return;
 
     m_UpdateBlock = true;
 
     m_LateUpdateFlag = false;
 
-    m_CappingDone = false;
+    //==== Only Rerun The Stages Invalidated Since The Last Update ====//
+    m_UpdateStage = GetUpdateStage();
+
+    bool surf_flag = ( m_UpdateStage == SURF_UPDATE_STAGE );
+    bool placement_flag = ( m_UpdateStage <= PLACEMENT_UPDATE_STAGE );
 
     Scale();
 
     UpdateSets();
 
-    UpdateSurf();       // Must be implemented by subclass.
+    if ( surf_flag )
+    {
+        PERF_SCOPE( "Geom::UpdateSurf" );
 
-    GeomXForm::Update();
+        m_CappingDone = false;
 
-    UpdateEndCaps();
+        UpdateSurf();       // Must be implemented by subclass.
 
-    if ( fullupdate )
-    {
-        UpdateFeatureLines();
+        for ( int i = 0 ; i < ( int )m_MainSurfVec.size() ; i++ )
+        {
+            m_MainSurfVec[i].SetAdaptTess( m_AdaptTessFlag(), m_AdaptTessTol() );
+        }
     }
 
-    UpdateFlags();
+    if ( placement_flag )
+    {
+        PERF_SCOPE( "Geom::UpdateXForm" );
 
-    UpdateSymmAttach();
+        m_SurfRevision++;
 
-    if ( fullupdate )
+        GeomXForm::Update();
+    }
+
+    if ( surf_flag )
     {
-        for ( int i = 0 ; i < ( int )m_SubSurfVec.size() ; i++ )
         {
-            m_SubSurfVec[i]->Update();
+            PERF_SCOPE( "Geom::UpdateEndCaps" );
+            UpdateEndCaps();
         }
 
-        for ( int i = 0; i < (int)m_FeaStructVec.size(); i++ )
+        if ( fullupdate )
         {
-            m_FeaStructVec[i]->Update();
+            PERF_SCOPE( "Geom::UpdateFeatureLines" );
+            UpdateFeatureLines();
         }
+
+        UpdateFlags();
+
+        // Feature lines are only built by a full update.
+        m_SurfDirtyFlag = !fullupdate;
+    }
+
+    if ( placement_flag )
+    {
+        UpdateSymmAttach();
+
+        // Rebuilt by UpdateSubSurfs and UpdateFeaStructs when next needed.
+        m_SubSurfStaleFlag = true;
+        m_FeaStructStaleFlag = true;
     }
 
     UpdateChildren( fullupdate );
-    UpdateBBox();
 
-    if ( fullupdate )
+    if ( placement_flag )
     {
-        UpdateDrawObj();
+        UpdateBBox();
+        m_Vehicle->GeomBBoxChanged( GetID() );
+
+        if ( fullupdate )
+        {
+            if ( Vehicle::IsHeadless() )
+            {
+                m_DrawObjStaleFlag = true;
+            }
+            else
+            {
+                PERF_SCOPE( "Geom::UpdateDrawObj" );
+                UpdateDrawObj();
+                m_DrawObjStaleFlag = false;
+            }
+        }
     }
 
     m_UpdatedParmVec.clear();
+    m_StagedUpdateFlag = false;
+    m_ParentUpdateStage = -1;
     m_UpdateBlock = false;
 }
 
-void Geom::GetUWTess01( int indx, vector < double > &u, vector < double > &w )
+//==== Build The Surfaces Of A Deferred Geom ====//
+// Ancestors are realized first, as placement builds on the parent transform.  Their
+// updates skip this Geom, which rebuilds completely once the flag is cleared.
+void Geom::RealizeDeferred()
 {
-    vector< vector< vec3d > > pnts;
-    vector< vector< vec3d > > norms;
-    vector< vector< vec3d > > uw_pnts;
+    PERF_SCOPE( "Geom::RealizeDeferred" );
+
+    Geom* parent_geom = m_Vehicle->FindGeom( GetParentID() );
+    if ( parent_geom )
+    {
+        parent_geom->LoadDeferred();
+    }
+
+    m_DeferredFlag = false;
+    m_SurfDirtyFlag = true;
+    Update();
+}
+
+//==== Find The First Update Stage Invalidated By Pending Changes ====//
+// m_MainSurfVec is built in the component frame, so it is reused when only placement
+// changed.  Changes not recorded in m_UpdatedParmVec force a full rebuild, as does a
+// direct call to Update (m_StagedUpdateFlag is only set by callers that record changes).
+int Geom::GetUpdateStage()
+{
+    if ( !m_StagedUpdateFlag || m_SurfDirtyFlag || SurfDependsOnPlacement() )
+    {
+        return SURF_UPDATE_STAGE;
+    }
+
+    int stage = ANALYSIS_UPDATE_STAGE;
+
+    if ( m_ParentUpdateStage >= 0 )
+    {
+        // A parent that moved or changed shape moves its children.
+        if ( m_ParentUpdateStage < ANALYSIS_UPDATE_STAGE )
+        {
+            stage = PLACEMENT_UPDATE_STAGE;
+        }
+    }
+    else if ( m_UpdatedParmVec.empty() )
+    {
+        return SURF_UPDATE_STAGE;
+    }
+
+    for ( int i = 0 ; i < ( int )m_UpdatedParmVec.size() && stage > SURF_UPDATE_STAGE ; i++ )
+    {
+        stage = min( stage, GetParmUpdateStage( m_UpdatedParmVec[i] ) );
+    }
+
+    return stage;
+}
+
+//==== Find The Update Stage A Changed Parm Invalidates ====//
+int Geom::GetParmUpdateStage( int parm_handle )
+{
+    Parm* placement_parms[] = { &m_XLoc, &m_YLoc, &m_ZLoc, &m_XRelLoc, &m_YRelLoc, &m_ZRelLoc,
+                                &m_XRot, &m_YRot, &m_ZRot, &m_XRelRot, &m_YRelRot, &m_ZRelRot,
+                                &m_Origin, &m_AbsRelFlag, &m_TransAttachFlag, &m_RotAttachFlag,
+                                &m_ULoc, &m_WLoc, &m_SymAncestor, &m_SymAncestOriginFlag,
+                                &m_SymPlanFlag, &m_SymAxFlag, &m_SymRotN };
+
+    Parm* analysis_parms[] = { &m_MassPrior, &m_Density, &m_MassArea, &m_ShellFlag,
+                               &m_FFBodyEqnType, &m_FFWingEqnType, &m_PercLam, &m_FFUser, &m_Q,
+                               &m_Roughness, &m_TeTwRatio, &m_TawTwRatio, &m_GroupedAncestorGen,
+                               &m_ExpandedListFlag };
+
+    for ( int i = 0 ; i < ( int )( sizeof( placement_parms ) / sizeof( Parm* ) ) ; i++ )
+    {
+        if ( placement_parms[i]->GetHandle() == parm_handle )
+        {
+            return PLACEMENT_UPDATE_STAGE;
+        }
+    }
 
-    UpdateTesselate( indx, pnts, norms, uw_pnts, false );
+    for ( int i = 0 ; i < ( int )( sizeof( analysis_parms ) / sizeof( Parm* ) ) ; i++ )
+    {
+        if ( analysis_parms[i]->GetHandle() == parm_handle )
+        {
+            return ANALYSIS_UPDATE_STAGE;
+        }
+    }
+
+    return SURF_UPDATE_STAGE;
+}
+
+//==== Geoms That Touch Shared State During Update Must Be Updated Serially ====//
+bool Geom::IsParallelUpdateSafe()
+{
+    // FEA part arrays create and delete parts (and their parms) as they update.
+    return m_FeaStructVec.empty();
+}
+
+void Geom::GetUWTess01( int indx, vector < double > &u, vector < double > &w )
+{
+    const vector< vector< vec3d > > & uw_pnts = GetTessGrid( indx, false ).m_UWPnts;
 
     double umx = GetSurfPtr( indx )->GetUMax();
     double wmx = GetSurfPtr( indx )->GetWMax();
@@ -1058,6 +1289,193 @@ void Geom::UpdateTesselate( int indx, vector< vector< vec3d > > &pnts, vector< v
     UpdateTesselate( indx, pnts, norms, uw_pnts, degen );
 }
 
+//==== Tessellate A Surface Once Per Surface Revision And Setting ====//
+// The returned grids are shared by every caller and stay valid until the next call
+// for this surface, so callers must copy anything they want to keep.
+const TessGrid & Geom::GetTessGrid( int indx, bool degen )
+{
+    LoadDeferred();
+
+    vector< TessCacheEntry > & cache_vec = m_TessCacheVec[ degen ? 1 : 0 ];
+    if ( cache_vec.size() != m_SurfVec.size() )
+    {
+        cache_vec.clear();
+        cache_vec.resize( m_SurfVec.size() );
+    }
+
+    TessCacheEntry & entry = cache_vec[indx];
+    const VspSurf & surf = m_SurfVec[indx];
+
+    if ( entry.m_SurfRevision != m_SurfRevision || entry.m_TessU != m_TessU() || entry.m_TessW != m_TessW() ||
+         entry.m_CapTess != m_CapUMinTess() || entry.m_USkip != surf.GetUSkip() || entry.m_WSkip != surf.GetWSkip() )
+    {
+        int base_indx = GetSurfInstanceBase( indx );
+        if ( base_indx != indx )
+        {
+            // Symmetric copies transform the tessellation of the surface they were copied from.
+            entry.m_Grid = GetTessGrid( base_indx, degen );
+            XFormSurfInstance( indx, base_indx, entry.m_Grid.m_Pnts, entry.m_Grid.m_Norms );
+        }
+        else
+        {
+            entry.m_Grid = TessGrid();
+            UpdateTesselate( indx, entry.m_Grid.m_Pnts, entry.m_Grid.m_Norms, entry.m_Grid.m_UWPnts, degen );
+        }
+
+        entry.m_SurfRevision = m_SurfRevision;
+        entry.m_TessU = m_TessU();
+        entry.m_TessW = m_TessW();
+        entry.m_CapTess = m_CapUMinTess();
+        entry.m_USkip = surf.GetUSkip();
+        entry.m_WSkip = surf.GetWSkip();
+    }
+
+    return entry.m_Grid;
+}
+
+//==== Determinant Of The Rotation Part, Negative For Mirroring Transformations ====//
+static double XFormDeterminant( Matrix4d & xform )
+{
+    const double * m = xform.data();
+    return m[0] * ( m[5] * m[10] - m[9] * m[6] ) -
+           m[4] * ( m[1] * m[10] - m[9] * m[2] ) +
+           m[8] * ( m[1] * m[6] - m[5] * m[2] );
+}
+
+//==== Find The Surface Whose Tessellation A Symmetric Copy Can Transform ====//
+// Returns indx itself when the surface must be tessellated on its own.
+int Geom::GetSurfInstanceBase( int indx )
+{
+    if ( m_SurfInstanceBaseVec.size() != m_SurfVec.size() || m_SurfInstanceMatVec.size() != m_SurfVec.size() )
+    {
+        return indx;
+    }
+
+    int base_indx = m_SurfInstanceBaseVec[indx];
+    if ( base_indx < 0 || base_indx >= indx )
+    {
+        return indx;
+    }
+
+    // Duplicate flags set per copy change the tessellation.
+    if ( m_SurfVec[indx].GetUSkip() != m_SurfVec[base_indx].GetUSkip() ||
+         m_SurfVec[indx].GetWSkip() != m_SurfVec[base_indx].GetWSkip() )
+    {
+        return indx;
+    }
+
+    // Normals are carried by the transformation alone, so a mirroring one must come with a flipped normal flag.
+    if ( ( XFormDeterminant( m_SurfInstanceMatVec[indx] ) < 0.0 ) !=
+         ( m_SurfVec[indx].GetFlipNormal() != m_SurfVec[base_indx].GetFlipNormal() ) )
+    {
+        return indx;
+    }
+
+    return base_indx;
+}
+
+//==== Find Transformations That Draw Every Surface As A Copy Of A Base Surface ====//
+// Succeeds when every base surface has the same number of copies, related to it by the
+// same transformations, so each draw buffer can hold the base surfaces alone.
+// xform_vec starts with the identity for the base surfaces themselves.
+bool Geom::GetDrawInstanceXForms( vector< Matrix4d > &xform_vec )
+{
+    xform_vec.clear();
+
+    int num_surf = m_SurfVec.size();
+    if ( num_surf == 0 || m_SurfInstanceBaseVec.size() != num_surf || m_SurfInstanceMatVec.size() != num_surf )
+    {
+        return false;
+    }
+
+    const double tol = 1e-10;
+
+    //==== Group Surfaces By Base, In Surface Order ====//
+    vector< vector< int > > group_vec( num_surf );
+    for ( int i = 0 ; i < num_surf ; i++ )
+    {
+        int base_indx = m_SurfInstanceBaseVec[i];
+        if ( base_indx < 0 || base_indx > i || m_SurfInstanceBaseVec[ base_indx ] != base_indx )
+        {
+            return false;
+        }
+        group_vec[ base_indx ].push_back( i );
+    }
+
+    int num_copy = -1;
+    for ( int i = 0 ; i < num_surf ; i++ )
+    {
+        const vector< int > & copy_vec = group_vec[i];
+        if ( copy_vec.empty() )
+        {
+            continue;
+        }
+
+        if ( num_copy < 0 )
+        {
+            num_copy = copy_vec.size();
+        }
+        if ( copy_vec.size() != num_copy )
+        {
+            return false;
+        }
+
+        for ( int c = 0 ; c < num_copy ; c++ )
+        {
+            int indx = copy_vec[c];
+            if ( c > 0 && GetSurfInstanceBase( indx ) != i )
+            {
+                return false;
+            }
+
+            // A mirroring copy lands in the flipped draw buffer, which GetSurfInstanceBase checks.
+            if ( m_SurfVec[ indx ].GetSurfCfdType() != m_SurfVec[i].GetSurfCfdType() )
+            {
+                return false;
+            }
+
+            const Matrix4d & xform = m_SurfInstanceMatVec[ indx ];
+            if ( ( int )xform_vec.size() <= c )
+            {
+                xform_vec.push_back( xform );
+            }
+            else
+            {
+                Matrix4d cur = xform;
+                const double * m = cur.data();
+                const double * mref = xform_vec[c].data();
+                for ( int k = 0 ; k < 16 ; k++ )
+                {
+                    if ( std::abs( m[k] - mref[k] ) > tol * ( 1.0 + std::abs( mref[k] ) ) )
+                    {
+                        xform_vec.clear();
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+
+    if ( num_copy < 2 )
+    {
+        xform_vec.clear();
+        return false;
+    }
+
+    return true;
+}
+
+//==== Move A Tessellation Of The Base Surface Onto A Rigid Copy ====//
+// Each copy's flipped normal flag matches the handedness of its transformation, so
+// normals are carried by the rotation alone.
+void Geom::XFormSurfInstance( int indx, int base_indx, vector< vector< vec3d > > &pnts, vector< vector< vec3d > > &norms )
+{
+    const Matrix4d & xform = m_SurfInstanceMatVec[ indx ];
+
+    xform.xformmat( pnts );
+    xform.xformnormmat( norms );
+}
+
 void Geom::UpdateSplitTesselate( int indx, vector< vector< vector< vec3d > > > &pnts, vector< vector< vector< vec3d > > > &norms )
 {
     m_SurfVec[indx].SplitTesselate( m_TessU(), m_TessW(), pnts, norms, m_CapUMinTess() );
@@ -1401,6 +1819,33 @@ void Geom::UpdateSymmAttach()
         m_FeaTransMatVec[i] = m_TransMatVec[i];
         m_FeaTransMatVec[i].matMult( retrun_relTrans.data() ); // m_FeaTransMatVec does not inclde the relTrans matrix
     }
+
+    //==== Copies Of One Main Surface Differ Only By Their Transformation ====//
+    // Main surfaces that are themselves rigid copies (propeller blades) share the
+    // first copy of the main surface they came from.
+    m_SurfInstanceBaseVec.resize( num_surf );
+    m_SurfInstanceMatVec.resize( num_surf );
+    for ( int i = 0 ; i < num_surf ; i++ )
+    {
+        int imain = m_SurfIndxVec[i];
+        Matrix4d main_mat;
+
+        if ( m_MainSurfInstanceVec.size() == num_main && m_MainSurfInstanceMatVec.size() == num_main &&
+             m_MainSurfInstanceVec[ imain ] >= 0 && m_MainSurfInstanceVec[ imain ] < imain )
+        {
+            main_mat = m_MainSurfInstanceMatVec[ imain ];
+            imain = m_MainSurfInstanceVec[ imain ];
+        }
+
+        int base_indx = m_SurfSymmMap[ imain ][0];
+        m_SurfInstanceBaseVec[i] = base_indx;
+
+        Matrix4d xform = m_TransMatVec[ base_indx ];
+        xform.affineInverse();
+        xform.postMult( main_mat.data() );
+        xform.postMult( m_TransMatVec[i].data() );
+        m_SurfInstanceMatVec[i] = xform;
+    }
 }
 
 //==== Check If Children Exist and Update ====//
@@ -1415,6 +1860,11 @@ void Geom::UpdateChildren( bool fullupdate )
             // Ignore the abs location values and only use rel values for children so a child
             // with abs button selected stays attached to parent if the parent moves
             child->m_ignoreAbsFlag = true;
+            if ( m_StagedUpdateFlag )
+            {
+                child->m_StagedUpdateFlag = true;
+                child->m_ParentUpdateStage = m_UpdateStage;
+            }
             child->Update( fullupdate );
             child->m_ignoreAbsFlag = false;
 
@@ -1995,18 +2445,70 @@ void Geom::UpdateDrawObj()
     m_WireShadeDrawObj_vec[2].m_GeomChanged = true;
     m_WireShadeDrawObj_vec[3].m_GeomChanged = true;
 
+    //==== Keep Tessellations That Symmetric Copies Transform ====//
+    vector< vector< vector < vector < vec3d > > > > base_pnts_vec( m_SurfVec.size() );
+    vector< vector< vector < vector < vec3d > > > > base_norms_vec( m_SurfVec.size() );
+
+    //==== Draw Symmetric Copies As Instances Of The Base Surfaces ====//
+    vector< Matrix4d > instance_xforms;
+    bool instanced = GetDrawInstanceXForms( instance_xforms );
+    if ( instanced )
+    {
+        for ( int i = 0 ; i < ( int )m_WireShadeDrawObj_vec.size() ; i++ )
+        {
+            m_WireShadeDrawObj_vec[i].m_InstanceXFormVec = instance_xforms;
+        }
+    }
+
+    // Only kept for surfaces that another surface is a copy of.
+    vector< bool > has_copy_vec( m_SurfVec.size(), false );
+    for ( int i = 0 ; i < ( int )m_SurfInstanceBaseVec.size() && i < ( int )m_SurfVec.size() ; i++ )
+    {
+        int base_indx = m_SurfInstanceBaseVec[i];
+        if ( base_indx != i && base_indx >= 0 && base_indx < ( int )m_SurfVec.size() )
+        {
+            has_copy_vec[ base_indx ] = true;
+        }
+    }
+
     //==== Tesselate Surface ====//
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         vector< vector < vector < vec3d > > > pnts;
         vector< vector < vector < vec3d > > > norms;
 
-        UpdateSplitTesselate( i, pnts, norms );
+        int base_indx = GetSurfInstanceBase( i );
+        if ( instanced && base_indx != i )
+        {
+            // Drawn by the base surface's instances.
+        }
+        else if ( base_indx != i && !base_pnts_vec[ base_indx ].empty() )
+        {
+            pnts = base_pnts_vec[ base_indx ];
+            norms = base_norms_vec[ base_indx ];
+            for ( int k = 0 ; k < ( int )pnts.size() ; k++ )
+            {
+                XFormSurfInstance( i, base_indx, pnts[k], norms[k] );
+            }
+        }
+        else
+        {
+            UpdateSplitTesselate( i, pnts, norms );
+
+            if ( has_copy_vec[i] )
+            {
+                base_pnts_vec[i] = pnts;
+                base_norms_vec[i] = norms;
+            }
+        }
 
         vector< vector < vector < double > > > utex;
         vector< vector < vector < double > > > vtex;
 
-        CalcTexCoords( i, utex, vtex, pnts );
+        if ( !pnts.empty() )
+        {
+            CalcTexCoords( i, utex, vtex, pnts );
+        }
 
         int iflip = 0;
         if ( m_SurfVec[i].GetFlipNormal() )
@@ -2019,15 +2521,11 @@ void Geom::UpdateDrawObj()
             iflip += 2;
         }
 
-        m_WireShadeDrawObj_vec[iflip].m_PntMesh.insert( m_WireShadeDrawObj_vec[iflip].m_PntMesh.end(),
-                pnts.begin(), pnts.end() );
-        m_WireShadeDrawObj_vec[iflip].m_NormMesh.insert( m_WireShadeDrawObj_vec[iflip].m_NormMesh.end(),
-                norms.begin(), norms.end() );
-
-        m_WireShadeDrawObj_vec[iflip].m_uTexMesh.insert( m_WireShadeDrawObj_vec[iflip].m_uTexMesh.end(),
-                utex.begin(), utex.end() );
-        m_WireShadeDrawObj_vec[iflip].m_vTexMesh.insert( m_WireShadeDrawObj_vec[iflip].m_vTexMesh.end(),
-                vtex.begin(), vtex.end() );
+        //==== Pack Straight Into Float Draw Buffers ====//
+        for ( int k = 0 ; k < ( int )pnts.size() ; k++ )
+        {
+            m_WireShadeDrawObj_vec[iflip].AppendPackedMesh( pnts[k], norms[k], utex[k], vtex[k] );
+        }
 
         if( m_GuiDraw.GetDispFeatureFlag() )
         {
@@ -2458,6 +2956,8 @@ xmlNodePtr Geom::DecodeXml( xmlNodePtr & node )
 {
     GeomXForm::DecodeXml( node );
 
+    m_SurfDirtyFlag = true;
+
     // Decode Material Info.
     m_GuiDraw.getMaterial()->DecodeNameXml( node );
 
@@ -3002,6 +3502,7 @@ void Geom::LoadDrawObjs( vector< DrawObj* > & draw_obj_vec )
         RecolorSubSurfs( SubSurfaceMgr.GetCurrSurfInd() );
         if ( m_GuiDraw.GetDispSubSurfFlag() && !m_GuiDraw.GetNoShowFlag() )
         {
+            UpdateSubSurfs();
             for ( int i = 0; i < (int)m_SubSurfVec.size(); i++ )
             {
                 m_SubSurfVec[i]->LoadDrawObjs( draw_obj_vec );
@@ -3249,49 +3750,83 @@ Material * Geom::GetMaterial()
 // required degen plate,surface, and subsurface for updating the preview DrawObj vectors
 void Geom::CreateDegenGeom( vector<DegenGeom> &dgs, bool preview )
 {
-    vector< vector< vec3d > > pnts;
-    vector< vector< vec3d > > nrms;
-    vector< vector< vec3d > > uwpnts;
+    UpdateSubSurfs();
 
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
-        bool urootcap = false;
+        CreateDegenSurf( i, dgs, preview );
+    }
+}
 
-        m_SurfVec[i].ResetUWSkip();
-        if ( m_CapUMinSuccess[ m_SurfIndxVec[i] ] )
-        {
-            m_SurfVec[i].SetUSkipFirst( true );
-            urootcap = true;
-        }
-        if ( m_CapUMaxSuccess[ m_SurfIndxVec[i] ] )
-        {
-            m_SurfVec[i].SetUSkipLast( true );
-        }
-        if ( m_CapWMinSuccess[ m_SurfIndxVec[i] ] )
-        {
-            m_SurfVec[i].SetWSkipFirst( true );
-        }
-        if ( m_CapWMaxSuccess[ m_SurfIndxVec[i] ] )
-        {
-            m_SurfVec[i].SetWSkipLast( true );
-        }
+//==== Fill The Degen Tessellation Cache And Sub-Surface Polygons ====//
+// Afterwards CreateDegenSurf only reads state shared between surfaces.
+int Geom::PrepareDegenSurfs()
+{
+    LoadDeferred();
 
-        //==== Tesselate Surface ====//
-        UpdateTesselate( i, pnts, nrms, uwpnts, true );
+    for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    {
+        SetDegenSkipFlags( i );
+        GetTessGrid( i, true );
         m_SurfVec[i].ResetUWSkip();
+    }
 
-        int surftype = DegenGeom::BODY_TYPE;
-        if( m_SurfVec[i].GetSurfType() == vsp::WING_SURF || m_SurfVec[i].GetSurfType() == vsp::PROP_SURF )
-        {
-            surftype = DegenGeom::SURFACE_TYPE;
-        }
-        else if( m_SurfVec[i].GetSurfType() == vsp::DISK_SURF )
-        {
-            surftype = DegenGeom::DISK_TYPE;
-        }
+    UpdateSubSurfs();
+    for ( int j = 0; j < ( int )m_SubSurfVec.size(); j++ )
+    {
+        m_SubSurfVec[j]->UpdatePolygonPnts();
+    }
+    return ( int )m_SurfVec.size();
+}
+
+//==== Skip Capped Edges, Returns True If The U Root Is Capped ====//
+bool Geom::SetDegenSkipFlags( int indx )
+{
+    bool urootcap = false;
 
-        CreateDegenGeom( dgs, pnts, nrms, uwpnts, urootcap, i, preview, m_SurfVec[i].GetFlipNormal(), surftype, m_SurfVec[i].GetFoilSurf() );
+    m_SurfVec[indx].ResetUWSkip();
+    if ( m_CapUMinSuccess[ m_SurfIndxVec[indx] ] )
+    {
+        m_SurfVec[indx].SetUSkipFirst( true );
+        urootcap = true;
+    }
+    if ( m_CapUMaxSuccess[ m_SurfIndxVec[indx] ] )
+    {
+        m_SurfVec[indx].SetUSkipLast( true );
     }
+    if ( m_CapWMinSuccess[ m_SurfIndxVec[indx] ] )
+    {
+        m_SurfVec[indx].SetWSkipFirst( true );
+    }
+    if ( m_CapWMaxSuccess[ m_SurfIndxVec[indx] ] )
+    {
+        m_SurfVec[indx].SetWSkipLast( true );
+    }
+    return urootcap;
+}
+
+void Geom::CreateDegenSurf( int indx, vector<DegenGeom> &dgs, bool preview )
+{
+    bool urootcap = SetDegenSkipFlags( indx );
+
+    //==== Tesselate Surface ====//
+    const TessGrid & tess = GetTessGrid( indx, true );
+    const vector< vector< vec3d > > & pnts = tess.m_Pnts;
+    const vector< vector< vec3d > > & nrms = tess.m_Norms;
+    const vector< vector< vec3d > > & uwpnts = tess.m_UWPnts;
+    m_SurfVec[indx].ResetUWSkip();
+
+    int surftype = DegenGeom::BODY_TYPE;
+    if( m_SurfVec[indx].GetSurfType() == vsp::WING_SURF || m_SurfVec[indx].GetSurfType() == vsp::PROP_SURF )
+    {
+        surftype = DegenGeom::SURFACE_TYPE;
+    }
+    else if( m_SurfVec[indx].GetSurfType() == vsp::DISK_SURF )
+    {
+        surftype = DegenGeom::DISK_TYPE;
+    }
+
+    CreateDegenGeom( dgs, pnts, nrms, uwpnts, urootcap, indx, preview, m_SurfVec[indx].GetFlipNormal(), surftype, m_SurfVec[indx].GetFoilSurf() );
 }
 
 
@@ -3379,6 +3914,7 @@ int Geom::GetSymFlag()
 //==== Return Pointer to First Surface ====//
 VspSurf* Geom::GetSurfPtr()
 {
+    LoadDeferred();
     if ( m_SurfVec.size() )
     {
         return &m_SurfVec[0];
@@ -3389,6 +3925,7 @@ VspSurf* Geom::GetSurfPtr()
 //==== Return Pointer to Surface indx ====//
 VspSurf* Geom::GetSurfPtr( int indx )
 {
+    LoadDeferred();
     if ( indx >= 0 && indx < m_SurfVec.size() )
     {
         return &m_SurfVec[ indx ];
@@ -3788,10 +4325,9 @@ void Geom::WriteXSecFile( int geom_no, FILE* dump_file )
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         //==== Tessellate Surface ====//
-        vector< vector< vec3d > > pnts;
-        vector< vector< vec3d > > norms;
-
-        UpdateTesselate( i, pnts, norms, false );
+        const TessGrid & tess = GetTessGrid( i, false );
+        const vector< vector< vec3d > > & pnts = tess.m_Pnts;
+        const vector< vector< vec3d > > & norms = tess.m_Norms;
 
         //==== Write XSec Header ====//
         fprintf( dump_file, "\n" );
@@ -3826,10 +4362,9 @@ void Geom::WritePLOT3DFileExtents( FILE* dump_file )
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         //==== Tessellate Surface ====//
-        vector< vector< vec3d > > pnts;
-        vector< vector< vec3d > > norms;
-
-        UpdateTesselate( i, pnts, norms, false );
+        const TessGrid & tess = GetTessGrid( i, false );
+        const vector< vector< vec3d > > & pnts = tess.m_Pnts;
+        const vector< vector< vec3d > > & norms = tess.m_Norms;
         //==== Write surface boundary extents ====//
         fprintf( dump_file, " %d %d %d\n", static_cast<int>( pnts[0].size() ), static_cast<int>( pnts.size() ), 1 );
     }
@@ -3840,10 +4375,9 @@ void Geom::WritePLOT3DFileXYZ( FILE* dump_file )
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         //==== Tessellate Surface ====//
-        vector< vector< vec3d > > pnts;
-        vector< vector< vec3d > > norms;
-
-        UpdateTesselate( i, pnts, norms, false );
+        const TessGrid & tess = GetTessGrid( i, false );
+        const vector< vector< vec3d > > & pnts = tess.m_Pnts;
+        const vector< vector< vec3d > > & norms = tess.m_Norms;
 
         //==== Write XSec Data ====//
         for ( int j = 0 ; j < ( int )pnts.size() ; j++ )
@@ -3913,10 +4447,9 @@ void Geom::WritePMARCGeomFile(FILE *fp, int &ipatch, vector<int> &idpat)
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         //==== Tessellate Surface ====//
-        vector< vector< vec3d > > pnts;
-        vector< vector< vec3d > > norms;
-
-        UpdateTesselate( i, pnts, norms, false );
+        const TessGrid & tess = GetTessGrid( i, false );
+        const vector< vector< vec3d > > & pnts = tess.m_Pnts;
+        const vector< vector< vec3d > > & norms = tess.m_Norms;
 
         int irev = 0;
         if ( !m_SurfVec[i].GetFlipNormal() )
@@ -4030,9 +4563,9 @@ void Geom::CreateGeomResults( Results* res )
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
         //==== Tessellate Surface ====//
-        vector< vector< vec3d > > pnts;
-        vector< vector< vec3d > > norms;
-        UpdateTesselate( i, pnts, norms, false );
+        const TessGrid & tess = GetTessGrid( i, false );
+        const vector< vector< vec3d > > & pnts = tess.m_Pnts;
+        const vector< vector< vec3d > > & norms = tess.m_Norms;
 
         res->Add( NameValData( "Num_XSecs", static_cast<int>( pnts.size() ) ) );
 
@@ -4067,9 +4600,9 @@ void Geom::WriteX3D( xmlNodePtr node )
 
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
-        vector< vector< vec3d > > pnts;
-        vector< vector< vec3d > > norms;
-        UpdateTesselate( i, pnts, norms, false );
+        const TessGrid & tess = GetTessGrid( i, false );
+        const vector< vector< vec3d > > & pnts = tess.m_Pnts;
+        const vector< vector< vec3d > > & norms = tess.m_Norms;
         unsigned int num_xsecs = pnts.size();
         unsigned int num_pnts = pnts[0].size();
         bool f_norm = m_SurfVec[i].GetFlipNormal();
@@ -4134,12 +4667,11 @@ void Geom::WritePovRay( FILE* fid, int comp_num )
     fprintf( fid, "#declare %s = mesh { \n", name.c_str() );
     for ( int i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
     {
-        vector< vector< vec3d > > pnts;
-        vector< vector< vec3d > > norms;
+        const TessGrid & tess = GetTessGrid( i, false );
+        const vector< vector< vec3d > > & pnts = tess.m_Pnts;
+        const vector< vector< vec3d > > & norms = tess.m_Norms;
         vec3d n0, n1, n2, n3, v0, v1, v2, v3;
 
-        UpdateTesselate( i, pnts, norms, false );
-
         for ( int xs = 0 ; xs < ( int )pnts.size() - 1 ; xs++ )
         {
             for ( int p = 0 ; p < ( int )pnts[xs].size() - 1 ; p++ )
@@ -4183,12 +4715,58 @@ void Geom::WritePovRayTri( FILE* fid, const vec3d& v, const vec3d& n, bool comma
     }
 }
 //==== Create TMesh Vector ====//
+//==== Keep Every Stride'th Grid Line, Plus Ends, Section Boundaries And W Quadrants ====//
+// The same lines are kept along any edge shared with an end cap or symmetric copy,
+// so the decimated meshes stay closed.
+static void DecimateTessGrid( const vector< vector< vec3d > > &pnts, const vector< vector< vec3d > > &uw_pnts, double wmax, int stride,
+                              vector< vector< vec3d > > &dec_pnts, vector< vector< vec3d > > &dec_uw_pnts )
+{
+    const double tol = 1e-8;
+
+    int nu = pnts.size();
+    int nw = nu > 0 ? pnts[0].size() : 0;
+
+    vector< int > jvec;
+    for ( int j = 0 ; j < nu ; j++ )
+    {
+        double u = uw_pnts[j][0].x();
+        if ( j % stride == 0 || j == nu - 1 || std::abs( u - floor( u + 0.5 ) ) < tol )
+        {
+            jvec.push_back( j );
+        }
+    }
+
+    vector< int > kvec;
+    double wquad = wmax / 4.0;
+    for ( int k = 0 ; k < nw ; k++ )
+    {
+        double w = uw_pnts[0][k].y();
+        double wq = wquad > 0 ? w / wquad : 0;
+        if ( k % stride == 0 || k == nw - 1 || std::abs( w - floor( w + 0.5 ) ) < tol || std::abs( wq - floor( wq + 0.5 ) ) < tol )
+        {
+            kvec.push_back( k );
+        }
+    }
+
+    dec_pnts.resize( jvec.size() );
+    dec_uw_pnts.resize( jvec.size() );
+    for ( int jj = 0 ; jj < ( int )jvec.size() ; jj++ )
+    {
+        dec_pnts[jj].resize( kvec.size() );
+        dec_uw_pnts[jj].resize( kvec.size() );
+        for ( int kk = 0 ; kk < ( int )kvec.size() ; kk++ )
+        {
+            dec_pnts[jj][kk] = pnts[ jvec[jj] ][ kvec[kk] ];
+            dec_uw_pnts[jj][kk] = uw_pnts[ jvec[jj] ][ kvec[kk] ];
+        }
+    }
+}
+
 vector< TMesh* > Geom::CreateTMeshVec()
 {
+    LoadDeferred();
+
     vector< TMesh* > TMeshVec;
-    vector< vector<vec3d> > pnts;
-    vector< vector<vec3d> > norms;
-    vector< vector<vec3d> > uw_pnts;
     double tol=1.0e-12;
 
     for ( int i = 0 ; i < ( int )m_SurfVec.size(); i++ )
@@ -4211,7 +4789,17 @@ vector< TMesh* > Geom::CreateTMeshVec()
     {
         if ( m_SurfVec[i].GetNumSectU() != 0 && m_SurfVec[i].GetNumSectW() != 0 )
         {
-            UpdateTesselate( i, pnts, norms, uw_pnts, false );
+            const TessGrid & tess = GetTessGrid( i, false );
+
+            //==== Quick-Look Analyses Mesh A Decimated Grid ====//
+            int stride = m_Vehicle->GetTMeshTessStride();
+            vector< vector< vec3d > > dec_pnts, dec_uw_pnts;
+            if ( stride > 1 )
+            {
+                DecimateTessGrid( tess.m_Pnts, tess.m_UWPnts, m_SurfVec[i].GetWMax(), stride, dec_pnts, dec_uw_pnts );
+            }
+            const vector< vector< vec3d > > & pnts = ( stride > 1 ) ? dec_pnts : tess.m_Pnts;
+            const vector< vector< vec3d > > & uw_pnts = ( stride > 1 ) ? dec_uw_pnts : tess.m_UWPnts;
             m_SurfVec[i].ResetUWSkip(); // Done with skip flags.
 
             TMeshVec.push_back( new TMesh() );
@@ -4329,8 +4917,15 @@ void Geom::AddLinkableParms( vector< string > & linkable_parm_vec, const string
 
 void Geom::ChangeID( string id )
 {
+    string old_id = m_ID;
+
     ParmContainer::ChangeID( id );
 
+    if ( m_Vehicle )
+    {
+        m_Vehicle->GeomIDChanged( old_id, this );
+    }
+
     for ( int i = 0 ; i < ( int )m_SubSurfVec.size() ; i ++ )
     {
         m_SubSurfVec[i]->SetParentContainer( GetID() );
@@ -4406,6 +5001,7 @@ SubSurface* Geom::AddSubSurf( int type, int surfindex )
 
 SubSurface* Geom::GetSubSurf( int ind )
 {
+    UpdateSubSurfs();
     if ( ValidSubSurfInd( ind ) )
     {
         return m_SubSurfVec[ind];
@@ -4415,6 +5011,7 @@ SubSurface* Geom::GetSubSurf( int ind )
 
 SubSurface* Geom::GetSubSurf( const string & id )
 {
+    UpdateSubSurfs();
     for ( int i = 0 ; i < (int)m_SubSurfVec.size() ; i++ )
     {
         if ( m_SubSurfVec[i]->GetID() == id )
@@ -4439,6 +5036,43 @@ int Geom::GetSubSurfIndex( const string & id )
     return -1;
 }
 
+//==== Update Sub-Surfaces If The Surfaces Changed Since The Last Update ====//
+void Geom::UpdateSubSurfs()
+{
+    LoadDeferred();
+
+    if ( !m_SubSurfStaleFlag )
+    {
+        return;
+    }
+    // Cleared first so sub-surfaces that call back into GetSubSurf do not recurse.
+    m_SubSurfStaleFlag = false;
+
+    PERF_SCOPE( "Geom::UpdateSubSurfs" );
+    for ( int i = 0 ; i < ( int )m_SubSurfVec.size() ; i++ )
+    {
+        m_SubSurfVec[i]->Update();
+    }
+}
+
+//==== Update Structures If The Surfaces Changed Since The Last Update ====//
+void Geom::UpdateFeaStructs()
+{
+    LoadDeferred();
+
+    if ( !m_FeaStructStaleFlag )
+    {
+        return;
+    }
+    m_FeaStructStaleFlag = false;
+
+    PERF_SCOPE( "Geom::UpdateFeaStructs" );
+    for ( int i = 0; i < (int)m_FeaStructVec.size(); i++ )
+    {
+        m_FeaStructVec[i]->Update();
+    }
+}
+
 //==== Highlight Active Subsurface ====//
 void Geom::RecolorSubSurfs( int active_ind )
 {
@@ -4505,6 +5139,7 @@ FeaStructure* Geom::AddFeaStruct( bool initskin, int surf_index )
 
 FeaStructure* Geom::GetFeaStruct( int fea_struct_ind )
 {
+    UpdateFeaStructs();
     if ( ValidGeomFeaStructInd( fea_struct_ind ) )
     {
         return m_FeaStructVec[fea_struct_ind];
@@ -4721,6 +5356,107 @@ void Geom::ExportSurfacePatches( vector<string> &surf_res_ids )
     }
 }
 
+//==== Approximate Bytes Held, By Category ====//
+void Geom::AddMemoryUsage( GeomMemUsage & usage )
+{
+    int i, j;
+
+    for ( i = 0 ; i < ( int )m_MainSurfVec.size() ; i++ )
+    {
+        usage.m_Surf += m_MainSurfVec[i].MemoryUsage();
+    }
+    for ( i = 0 ; i < ( int )m_SurfVec.size() ; i++ )
+    {
+        usage.m_Surf += m_SurfVec[i].MemoryUsage();
+    }
+
+    for ( i = 0 ; i < 2 ; i++ )
+    {
+        for ( j = 0 ; j < ( int )m_TessCacheVec[i].size() ; j++ )
+        {
+            const TessGrid & grid = m_TessCacheVec[i][j].m_Grid;
+            usage.m_Tess += sizeof( TessCacheEntry ) + vector_mem_bytes( grid.m_Pnts ) +
+                            vector_mem_bytes( grid.m_Norms ) + vector_mem_bytes( grid.m_UWPnts );
+        }
+    }
+    usage.m_Tess += vector_mem_bytes( m_GeomProjectVec3d );
+
+    vector< DrawObj* > draw_obj_vec;
+    CollectDrawObjs( draw_obj_vec );
+    for ( i = 0 ; i < ( int )draw_obj_vec.size() ; i++ )
+    {
+        usage.m_DrawObj += draw_obj_vec[i]->MemoryUsage();
+    }
+
+    for ( i = 0 ; i < ( int )m_SubSurfVec.size() ; i++ )
+    {
+        usage.m_SubSurf += m_SubSurfVec[i]->MemoryUsage();
+    }
+}
+
+void Geom::PurgeDrawObjs()
+{
+    vector< DrawObj* > draw_obj_vec;
+    CollectDrawObjs( draw_obj_vec );
+    for ( int i = 0 ; i < ( int )draw_obj_vec.size() ; i++ )
+    {
+        draw_obj_vec[i]->ClearGeomData();
+    }
+}
+
+//==== Build Draw Objects Skipped By Headless Updates ====//
+void Geom::UpdateStaleDrawObj()
+{
+    if ( m_DrawObjStaleFlag )
+    {
+        m_DrawObjStaleFlag = false;
+        UpdateDrawObj();
+    }
+}
+
+void Geom::PurgeTessCache()
+{
+    // GetTessGrid rebuilds entries on demand
+    for ( int i = 0 ; i < 2 ; i++ )
+    {
+        vector< TessCacheEntry >().swap( m_TessCacheVec[i] );
+    }
+}
+
+void Geom::CollectDrawObjs( vector< DrawObj* > & draw_obj_vec )
+{
+    int i;
+    for ( i = 0 ; i < ( int )m_WireShadeDrawObj_vec.size() ; i++ )
+    {
+        draw_obj_vec.push_back( &m_WireShadeDrawObj_vec[i] );
+    }
+    for ( i = 0 ; i < ( int )m_FeatureDrawObj_vec.size() ; i++ )
+    {
+        draw_obj_vec.push_back( &m_FeatureDrawObj_vec[i] );
+    }
+    for ( i = 0 ; i < ( int )m_AxisDrawObj_vec.size() ; i++ )
+    {
+        draw_obj_vec.push_back( &m_AxisDrawObj_vec[i] );
+    }
+    for ( i = 0 ; i < ( int )m_DegenPlateDrawObj_vec.size() ; i++ )
+    {
+        draw_obj_vec.push_back( &m_DegenPlateDrawObj_vec[i] );
+    }
+    for ( i = 0 ; i < ( int )m_DegenSurfDrawObj_vec.size() ; i++ )
+    {
+        draw_obj_vec.push_back( &m_DegenSurfDrawObj_vec[i] );
+    }
+    for ( i = 0 ; i < ( int )m_DegenCamberPlateDrawObj_vec.size() ; i++ )
+    {
+        draw_obj_vec.push_back( &m_DegenCamberPlateDrawObj_vec[i] );
+    }
+    for ( i = 0 ; i < ( int )m_DegenSubSurfDrawObj_vec.size() ; i++ )
+    {
+        draw_obj_vec.push_back( &m_DegenSubSurfDrawObj_vec[i] );
+    }
+    draw_obj_vec.push_back( &m_HighlightDrawObj );
+}
+
 //===============================================================================//
 //===============================================================================//
 //===============================================================================//
@@ -4816,6 +5552,18 @@ void GeomXSec::UpdateDrawObj()
     m_CurrentXSecDrawObj.m_GeomChanged = true;
 }
 
+void GeomXSec::CollectDrawObjs( vector< DrawObj* > & draw_obj_vec )
+{
+    Geom::CollectDrawObjs( draw_obj_vec );
+
+    for ( int i = 0 ; i < ( int )m_XSecDrawObj_vec.size() ; i++ )
+    {
+        draw_obj_vec.push_back( &m_XSecDrawObj_vec[i] );
+    }
+    draw_obj_vec.push_back( &m_HighlightXSecDrawObj );
+    draw_obj_vec.push_back( &m_CurrentXSecDrawObj );
+}
+
 void GeomXSec::LoadDrawObjs( vector< DrawObj* > & draw_obj_vec )
 {
     Geom::LoadDrawObjs( draw_obj_vec );
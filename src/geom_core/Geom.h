@@ -180,6 +180,62 @@ protected:
     Material m_Material;
 };
 
+//==== Tessellation Of One Surface ====//
+class TessGrid
+{
+public:
+    vector< vector< vec3d > > m_Pnts;
+    vector< vector< vec3d > > m_Norms;
+    vector< vector< vec3d > > m_UWPnts;
+};
+
+//==== Cached Tessellation And The Settings It Was Built With ====//
+class TessCacheEntry
+{
+public:
+    TessCacheEntry()
+    {
+        m_SurfRevision = -1;
+        m_TessU = -1;
+        m_TessW = -1;
+        m_CapTess = -1;
+    }
+
+    int m_SurfRevision;
+    int m_TessU;
+    int m_TessW;
+    int m_CapTess;
+    vector< bool > m_USkip;
+    vector< bool > m_WSkip;
+
+    TessGrid m_Grid;
+};
+
+//==== Approximate Bytes Held By A Geom, By Category ====//
+class GeomMemUsage
+{
+public:
+    GeomMemUsage()
+    {
+        m_Surf = 0;
+        m_Tess = 0;
+        m_DrawObj = 0;
+        m_SubSurf = 0;
+        m_Mesh = 0;
+    }
+
+    size_t Total() const
+    {
+        return m_Surf + m_Tess + m_DrawObj + m_SubSurf + m_Mesh;
+    }
+
+    size_t m_Surf;          // Main and symmetric copy surfaces
+    size_t m_Tess;          // Cached tessellations and projection lines
+    size_t m_DrawObj;       // Display buffers
+    size_t m_SubSurf;       // Sub-surface outlines and their display buffers
+    size_t m_Mesh;          // Triangle meshes and point data of mesh type Geoms
+};
+
 //==== Geom Base ====//
 class GeomBase : public ParmContainer
 {
@@ -199,8 +255,14 @@ public:
     virtual void Update( bool fullupdate = true )           {}
 
     virtual void ParmChanged( Parm* parm_ptr, int type );
+    virtual void BulkParmChanged( Parm* last_parm );
     virtual void ForceUpdate();
 
+    virtual void SetLateUpdateFlag( bool flag );
+    virtual void SetStagedUpdateFlag( bool flag )           { m_StagedUpdateFlag = flag; }
+    virtual void SetSurfDirtyFlag( bool flag );
+    virtual int GetSurfRevision()                           { return m_SurfRevision; }
+
     virtual int CountParents( int count );
     virtual bool IsParentJoint();
 
@@ -229,6 +291,7 @@ public:
     }
 
     virtual bool UpdatedParm( const string & id );
+    virtual bool UpdatedParm( const Parm & parm );
 
     virtual void LoadIDAndChildren( vector< string > & id_vec, bool check_display_flag = false );
 
@@ -248,7 +311,11 @@ protected:
     string m_ParentID;                                  // ID of Parent (NONE == No Parent)
     vector< string > m_ChildIDVec;                      // Children ID
 
-    vector< string > m_UpdatedParmVec;
+    vector< int > m_UpdatedParmVec;                     // Parm Handles
+
+    bool m_StagedUpdateFlag;                            // Every pending change is recorded in m_UpdatedParmVec
+    bool m_SurfDirtyFlag;                               // Surfaces changed by something other than a Parm
+    int m_SurfRevision;                                 // Bumped whenever the surfaces may have changed
 };
 
 //==== Geom XForm ====//
@@ -341,6 +408,27 @@ public:
     virtual ~Geom();
 
     virtual void Update( bool fullupdate = true );
+    virtual bool IsParallelUpdateSafe();     // May Update Concurrently With Unrelated Geoms
+
+    //==== Deferred Load, Surfaces Skipped By Update Are Built On First Use ====//
+    // Geoms with no main surfaces built from Parms ( GetNumMainSurfs() == 0 ) have
+    // nothing worth deferring and override CanDeferLoad to return false.
+    virtual bool CanDeferLoad()                             { return true; }
+    void SetDeferredFlag( bool f )                          { m_DeferredFlag = f; }
+    bool IsDeferred()                                       { return m_DeferredFlag; }
+    void LoadDeferred()
+    {
+        if ( m_DeferredFlag )
+        {
+            RealizeDeferred();
+        }
+    }
+
+    //==== Update Stages, Each Also Invalidates Those After It ====//
+    enum { SURF_UPDATE_STAGE, PLACEMENT_UPDATE_STAGE, ANALYSIS_UPDATE_STAGE };
+
+    virtual int GetParmUpdateStage( int parm_handle );
+    virtual bool SurfDependsOnPlacement()                   { return false; }
     virtual void LoadMainDrawObjs( vector< DrawObj* > & draw_obj_vec );
     virtual void LoadDrawObjs( vector< DrawObj* > & draw_obj_vec );
 
@@ -363,13 +451,19 @@ public:
     virtual VspSurf* GetSurfPtr( int indx );
     virtual void GetSurfVec( vector<VspSurf> &surf_vec )
     {
+        LoadDeferred();
         surf_vec = m_SurfVec;
     }
     virtual int GetNumMainSurfs()
     {
+        LoadDeferred();
         return m_MainSurfVec.size();
     }
-    virtual void GetMainSurfVec( vector<VspSurf> &surf_vec )    { surf_vec = m_MainSurfVec; }
+    virtual void GetMainSurfVec( vector<VspSurf> &surf_vec )
+    {
+        LoadDeferred();
+        surf_vec = m_MainSurfVec;
+    }
     virtual int GetNumSymFlags();
     virtual int GetNumTotalSurfs();
     virtual int GetNumTotalHrmSurfs();
@@ -426,6 +520,14 @@ public:
 
     virtual void CopyFrom( Geom* geom );
 
+    // True while this geom is being encoded as the source of a CopyFrom.
+    // Subclasses with large non-parm payloads may skip them in EncodeXml
+    // and copy them directly in CopyPayloadFrom instead.
+    bool IsCopyEncoding()
+    {
+        return m_CopyEncodeFlag;
+    }
+
     virtual xmlNodePtr EncodeXml( xmlNodePtr & node );
     virtual xmlNodePtr DecodeXml( xmlNodePtr & node );
 
@@ -468,6 +570,7 @@ public:
     virtual void AddSubSurf( SubSurface* sub_surf )
     {
         m_SubSurfVec.push_back( sub_surf );
+        m_SubSurfStaleFlag = true;
     }
     virtual SubSurface* AddSubSurf( int type, int surfindex );
     virtual bool ValidSubSurfInd( int ind );
@@ -477,6 +580,7 @@ public:
     virtual int GetSubSurfIndex( const string & id );
     virtual vector< SubSurface* > GetSubSurfVec()
     {
+        UpdateSubSurfs();
         return m_SubSurfVec;
     }
 
@@ -486,9 +590,14 @@ public:
     }
     virtual void RecolorSubSurfs( int active_ind );
 
+    // Sub-surfaces and structures are rebuilt on first access after the surfaces change.
+    virtual void UpdateSubSurfs();
+    virtual void UpdateFeaStructs();
+
     //==== FeaStructure Data =====//
     vector < FeaStructure* > GetFeaStructVec()
     {
+        UpdateFeaStructs();
         return m_FeaStructVec;
     }
     virtual FeaStructure* AddFeaStruct( bool initskin, int surf_index );
@@ -506,11 +615,15 @@ public:
 
     //===== Degenerate Geometry =====//
     virtual void CreateDegenGeom( vector<DegenGeom> &dgs, bool preview = false );
+    virtual int PrepareDegenSurfs();    // Tessellate ahead, returns number of surfaces CreateDegenSurf may then build concurrently, -1 if none
+    virtual void CreateDegenSurf( int indx, vector<DegenGeom> &dgs, bool preview = false );
     virtual void CreateDegenGeom( vector<DegenGeom> &dgs, const vector< vector< vec3d > > &pnts, const vector< vector< vec3d > > &nrms, const vector< vector< vec3d > > &uwpnts,
                                   bool urootcap, int isurf, bool preview, bool flipnormal, int surftype, VspSurf *fs );
 
     IntParm m_TessU;
     LimIntParm m_TessW;
+    BoolParm m_AdaptTessFlag;
+    Parm m_AdaptTessTol;
 
     IntParm m_SymAncestor;
     BoolParm m_SymAncestOriginFlag;
@@ -558,6 +671,7 @@ public:
     virtual void SetForceXSecFlag( bool flag )
     {
         m_ForceXSecFlag = flag;
+        m_SurfDirtyFlag = true;
     }
     virtual bool GetForceXSecFlag( )
     {
@@ -659,10 +773,37 @@ public:
 
     virtual void ExportSurfacePatches( vector< string > &surf_res_ids );
 
+    //==== Memory Accounting ====//
+    virtual void AddMemoryUsage( GeomMemUsage & usage );
+
+    //==== Release Rebuildable Caches, Both Are Rebuilt By The Next Full Update ====//
+    virtual void PurgeDrawObjs();
+    virtual void PurgeTessCache();
+
+    //==== Draw Objects Skipped While Headless Are Rebuilt When Next Fetched ====//
+    void MarkDrawObjStale()                             { m_DrawObjStaleFlag = true; }
+    void UpdateStaleDrawObj();
+
 protected:
 
+    //==== Every DrawObj Holding Display Buffers ====//
+    virtual void CollectDrawObjs( vector< DrawObj* > & draw_obj_vec );
+
+    //==== Copy Payload Skipped By EncodeXml During CopyFrom ====//
+    virtual void CopyPayloadFrom( Geom* geom )          {}
+
     bool m_UpdateBlock;
 
+    bool m_CopyEncodeFlag;
+
+    bool m_DeferredFlag;                // Updates skipped until the surfaces are first needed
+    void RealizeDeferred();
+
+    int m_UpdateStage;                  // Stage the current Update starts from
+    int m_ParentUpdateStage;            // Stage of the parent Update that triggered this one, or -1
+
+    virtual int GetUpdateStage();
+
     virtual void UpdateSurf() = 0;
     void UpdateEndCaps();
     virtual void UpdateFeatureLines();
@@ -675,6 +816,12 @@ protected:
     virtual void UpdateTesselate( int indx, vector< vector< vec3d > > &pnts, vector< vector< vec3d > > &norms, bool degen );
     virtual void UpdateTesselate( int indx, vector< vector< vec3d > > &pnts, vector< vector< vec3d > > &norms, vector< vector< vec3d > > &uw_pnts, bool degen );
 
+    virtual const TessGrid & GetTessGrid( int indx, bool degen );
+    virtual bool SetDegenSkipFlags( int indx );
+    virtual int GetSurfInstanceBase( int indx );
+    virtual void XFormSurfInstance( int indx, int base_indx, vector< vector< vec3d > > &pnts, vector< vector< vec3d > > &norms );
+    virtual bool GetDrawInstanceXForms( vector< Matrix4d > &xform_vec );
+
     virtual void UpdateSplitTesselate( int indx, vector< vector< vector< vec3d > > > &pnts, vector< vector< vector< vec3d > > > &norms );
 
     virtual void CalcTexCoords( int indx, vector< vector< vector< double > > > &utex, vector< vector< vector< double > > > &vtex, const vector< vector< vector< vec3d > > > & pnts );
@@ -685,6 +832,10 @@ protected:
     vector< vector< int > > m_SurfSymmMap;
     vector<int> m_SurfCopyIndx;
     vector< Matrix4d > m_TransMatVec; // Vector of transformation matrixes
+    vector<int> m_SurfInstanceBaseVec; // Surface whose tessellation this one is a rigid copy of
+    vector< Matrix4d > m_SurfInstanceMatVec; // Takes the base surface onto this one
+    vector<int> m_MainSurfInstanceVec; // Earlier main surface this one is a rigid copy of, or -1
+    vector< Matrix4d > m_MainSurfInstanceMatVec; // Takes that main surface onto this one
     vector< Matrix4d > m_FeaTransMatVec; // Vector of transformation matrixes
     vector<DrawObj> m_WireShadeDrawObj_vec;
     vector<DrawObj> m_FeatureDrawObj_vec;
@@ -701,6 +852,7 @@ protected:
 
     vector<SubSurface*> m_SubSurfVec;
 
+    vector< TessCacheEntry > m_TessCacheVec[2];     // Indexed by degen flag, then surface
     vector < vector < vector < vec3d > > > m_GeomProjectVec3d; // Vector of projection lines for each view direction (x, y, or z)
     bool m_ForceXSecFlag; // Flag to force feature lines at xsecs
 
@@ -709,6 +861,10 @@ protected:
     vector< FeaStructure* > m_FeaStructVec;     // Vector of FeaStructures for this Geom
     int m_FeaStructCount; // Counter used for creating unique name for structures
 
+    bool m_SubSurfStaleFlag;                    // Surfaces changed since the sub-surfaces were updated
+    bool m_FeaStructStaleFlag;                  // Surfaces changed since the structures were updated
+    bool m_DrawObjStaleFlag;                    // Draw objects skipped by a headless update
+
     //==== CFD Mesh Sources ====//
     int currSourceID;
     vector< BaseSource* > m_MainSourceVec;
@@ -759,6 +915,7 @@ public:
 
 protected:
     virtual void UpdateDrawObj();
+    virtual void CollectDrawObjs( vector< DrawObj* > & draw_obj_vec );
 
     XSecSurf m_XSecSurf;
     vector<DrawObj> m_XSecDrawObj_vec;
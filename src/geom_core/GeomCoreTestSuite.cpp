@@ -7,7 +7,9 @@
 
 #include "GeomCoreTestSuite.h"
 #include "MeshGeom.h"
+#include "EllipsoidGeom.h"
 #include "StlHelper.h"
+#include <algorithm>
 
 
 //==== Test GeomXForm ====//
@@ -241,6 +243,296 @@ void GeomCoreTestSuite::MeshIOTest()
     veh.CutActiveGeomVec();
 }
 
+//==== Test TMesh Intersection And Inside Checks On Three Overlapping Spheres ====//
+void GeomCoreTestSuite::TMeshIntersectTest()
+{
+    Vehicle veh;
+
+    vector< TMesh* > tmesh_vec;
+    tmesh_vec.push_back( MakeSphereTMesh( veh, vec3d( 0.0, 0.0, 0.0 ) ) );
+    tmesh_vec.push_back( MakeSphereTMesh( veh, vec3d( 1.2, 0.0, 0.0 ) ) );
+    tmesh_vec.push_back( MakeSphereTMesh( veh, vec3d( 0.6, 0.9, 0.3 ) ) );
+    TMesh* far_tmesh = MakeSphereTMesh( veh, vec3d( 10.0, 0.0, 0.0 ) );
+
+    for ( int i = 0 ; i < ( int )tmesh_vec.size() ; i++ )
+    {
+        TEST_ASSERT( tmesh_vec[i]->m_TVec.size() == 1776 );
+        tmesh_vec[i]->LoadBndBox();
+    }
+    far_tmesh->LoadBndBox();
+
+    TEST_ASSERT( tmesh_vec[0]->CheckIntersect( tmesh_vec[1] ) );
+    TEST_ASSERT( !tmesh_vec[0]->CheckIntersect( far_tmesh ) );
+    TEST_ASSERT_DELTA( tmesh_vec[0]->MinDistance( far_tmesh, 1.0e12 ), 8.0, 1.0e-12 );
+
+    for ( int i = 0 ; i < ( int )tmesh_vec.size() ; i++ )
+    {
+        for ( int j = i + 1 ; j < ( int )tmesh_vec.size() ; j++ )
+        {
+            tmesh_vec[i]->Intersect( tmesh_vec[j] );
+        }
+    }
+
+    //==== Expected Values From The Octree Traversal (VSP_TMESH_OCTREE) ====//
+    int isect_tris[] = { 151, 163, 216 };
+    int isect_segs[] = { 298, 298, 452 };
+    double isect_len[] = { 10.1867977772834, 10.1867977772834, 10.3603344584558 };
+    int split_tris[] = { 747, 759, 1116 };
+    int interior_tris[] = { 1100, 1089, 1269 };
+
+    for ( int i = 0 ; i < ( int )tmesh_vec.size() ; i++ )
+    {
+        int num_tris = 0;
+        int num_segs = 0;
+        double len = 0.0;
+        for ( int t = 0 ; t < ( int )tmesh_vec[i]->m_TVec.size() ; t++ )
+        {
+            TTri* tri = tmesh_vec[i]->m_TVec[t];
+            if ( tri->m_ISectEdgeVec.size() )
+            {
+                num_tris++;
+            }
+            num_segs += ( int )tri->m_ISectEdgeVec.size();
+            for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
+            {
+                len += dist( tri->m_ISectEdgeVec[e]->m_N0->m_Pnt, tri->m_ISectEdgeVec[e]->m_N1->m_Pnt );
+            }
+        }
+        TEST_ASSERT( num_tris == isect_tris[i] );
+        TEST_ASSERT( num_segs == isect_segs[i] );
+        TEST_ASSERT_DELTA( len, isect_len[i], 1.0e-9 );
+    }
+
+    for ( int i = 0 ; i < ( int )tmesh_vec.size() ; i++ )
+    {
+        tmesh_vec[i]->Split();
+    }
+    for ( int i = 0 ; i < ( int )tmesh_vec.size() ; i++ )
+    {
+        tmesh_vec[i]->DeterIntExt( tmesh_vec );
+    }
+
+    for ( int i = 0 ; i < ( int )tmesh_vec.size() ; i++ )
+    {
+        int num_split = 0;
+        int num_interior = 0;
+        for ( int t = 0 ; t < ( int )tmesh_vec[i]->m_TVec.size() ; t++ )
+        {
+            TTri* tri = tmesh_vec[i]->m_TVec[t];
+            num_split += ( int )tri->m_SplitVec.size();
+            if ( tri->m_SplitVec.size() )
+            {
+                for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
+                {
+                    num_interior += tri->m_SplitVec[s]->m_InteriorFlag;
+                }
+            }
+            else
+            {
+                num_interior += tri->m_InteriorFlag;
+            }
+        }
+        TEST_ASSERT( num_split == split_tris[i] );
+        TEST_ASSERT( num_interior == interior_tris[i] );
+    }
+
+    for ( int i = 0 ; i < ( int )tmesh_vec.size() ; i++ )
+    {
+        delete tmesh_vec[i];
+    }
+    delete far_tmesh;
+}
+
+//==== Test Split Tris Of Three Overlapping Spheres Match The triangle() Output ====//
+void GeomCoreTestSuite::TMeshSplitTest()
+{
+    Vehicle veh;
+
+    vector< TMesh* > tmesh_vec;
+    tmesh_vec.push_back( MakeSphereTMesh( veh, vec3d( 0.0, 0.0, 0.0 ) ) );
+    tmesh_vec.push_back( MakeSphereTMesh( veh, vec3d( 1.2, 0.0, 0.0 ) ) );
+    tmesh_vec.push_back( MakeSphereTMesh( veh, vec3d( 0.6, 0.9, 0.3 ) ) );
+
+    for ( int i = 0 ; i < ( int )tmesh_vec.size() ; i++ )
+    {
+        tmesh_vec[i]->LoadBndBox();
+    }
+    for ( int i = 0 ; i < ( int )tmesh_vec.size() ; i++ )
+    {
+        for ( int j = i + 1 ; j < ( int )tmesh_vec.size() ; j++ )
+        {
+            tmesh_vec[i]->Intersect( tmesh_vec[j] );
+        }
+    }
+    for ( int i = 0 ; i < ( int )tmesh_vec.size() ; i++ )
+    {
+        tmesh_vec[i]->Split();
+    }
+
+    //==== Expected Values With Every Tri Split By triangle() ====//
+    // The summed edge length changes if a quad takes the other diagonal.
+    int split_parents[] = { 151, 163, 216 };
+    int split_tris[] = { 747, 759, 1116 };
+    double split_area[] = { 1.14835155115957, 1.29037177368902, 1.57541769299554 };
+    double split_edge_len[] = { 178.682768469871, 187.813474796816, 257.531646811829 };
+
+    for ( int i = 0 ; i < ( int )tmesh_vec.size() ; i++ )
+    {
+        int num_parents = 0;
+        int num_split = 0;
+        int num_flipped = 0;
+        double area = 0.0;
+        double edge_len = 0.0;
+        for ( int t = 0 ; t < ( int )tmesh_vec[i]->m_TVec.size() ; t++ )
+        {
+            TTri* tri = tmesh_vec[i]->m_TVec[t];
+            if ( !tri->m_SplitVec.size() )
+            {
+                continue;
+            }
+
+            num_parents++;
+            double parent_area = 0.0;
+            for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
+            {
+                TTri* stri = tri->m_SplitVec[s];
+                vec3d p0 = stri->m_N0->m_Pnt;
+                vec3d p1 = stri->m_N1->m_Pnt;
+                vec3d p2 = stri->m_N2->m_Pnt;
+
+                num_split++;
+                parent_area += stri->ComputeArea();
+                edge_len += dist( p0, p1 ) + dist( p1, p2 ) + dist( p2, p0 );
+                if ( dot( cross( p1 - p0, p2 - p0 ), tri->m_Norm ) <= 0.0 )
+                {
+                    num_flipped++;
+                }
+            }
+            TEST_ASSERT_DELTA( parent_area, tri->ComputeArea(), 1.0e-12 );
+            area += parent_area;
+        }
+
+        TEST_ASSERT( num_parents == split_parents[i] );
+        TEST_ASSERT( num_split == split_tris[i] );
+        TEST_ASSERT( num_flipped == 0 );
+        TEST_ASSERT_DELTA( area, split_area[i], 1.0e-9 );
+        TEST_ASSERT_DELTA( edge_len, split_edge_len[i], 1.0e-9 );
+    }
+
+    for ( int i = 0 ; i < ( int )tmesh_vec.size() ; i++ )
+    {
+        delete tmesh_vec[i];
+    }
+}
+
+//==== Test Node Welding And Tri Edges Against The Previous Implementation ====//
+void GeomCoreTestSuite::TMeshWeldTest()
+{
+    Vehicle veh;
+
+    //==== Every Tri Has Its Own Corners, Some Moved Just Inside Or Outside The Weld Tolerance ====//
+    TMesh* tmesh = MakeSphereTMesh( veh, vec3d( 0.0, 0.0, 0.0 ) );
+    int num_nodes = ( int )tmesh->m_NVec.size();
+    TEST_ASSERT( num_nodes == 3 * 1776 );
+    for ( int n = 0 ; n < num_nodes ; n += 7 )
+    {
+        tmesh->m_NVec[n]->m_Pnt = tmesh->m_NVec[n]->m_Pnt + vec3d( 0.9e-6, 0.0, 0.0 );
+    }
+    for ( int n = 3 ; n < num_nodes ; n += 11 )
+    {
+        tmesh->m_NVec[n]->m_Pnt = tmesh->m_NVec[n]->m_Pnt + vec3d( 0.0, 1.1e-6, 0.0 );
+    }
+    vector< TNode* > orig_node_vec = tmesh->m_NVec;
+
+    //==== Counts From The Previous Node And Edge Alias Maps ====//
+    tmesh->MatchNodes();
+    TEST_ASSERT( tmesh->m_NVec.size() == 1291 );
+    TEST_ASSERT( tmesh->m_TVec.size() == 1776 );
+
+    //==== Surviving Nodes Keep Their Order ====//
+    int orig_ind = 0;
+    for ( int n = 0 ; n < ( int )tmesh->m_NVec.size() ; n++ )
+    {
+        while ( orig_ind < num_nodes && orig_node_vec[orig_ind] != tmesh->m_NVec[n] )
+        {
+            orig_ind++;
+        }
+        TEST_ASSERT( orig_ind < num_nodes );
+    }
+    delete tmesh;
+
+    //==== Sphere With A Hole, In Both Node Orders ====//
+    for ( int reverse_flag = 0 ; reverse_flag < 2 ; reverse_flag++ )
+    {
+        tmesh = MakeSphereTMesh( veh, vec3d( 0.0, 0.0, 0.0 ) );
+        num_nodes = ( int )tmesh->m_NVec.size();
+        for ( int n = 0 ; n < num_nodes ; n += 7 )
+        {
+            tmesh->m_NVec[n]->m_Pnt = tmesh->m_NVec[n]->m_Pnt + vec3d( 0.9e-6, 0.0, 0.0 );
+        }
+
+        vector< TTri* > keep_vec;
+        for ( int t = 0 ; t < ( int )tmesh->m_TVec.size() ; t++ )
+        {
+            if ( tmesh->m_TVec[t]->ComputeCenter().z() < 0.8 )
+            {
+                keep_vec.push_back( tmesh->m_TVec[t] );
+            }
+            else
+            {
+                FreeTObj( tmesh->m_TVec[t] );
+            }
+        }
+        tmesh->m_TVec = keep_vec;
+
+        if ( reverse_flag )
+        {
+            std::reverse( tmesh->m_NVec.begin(), tmesh->m_NVec.end() );
+        }
+
+        tmesh->CheckIfClosed();
+        TEST_ASSERT( tmesh->m_NVec.size() == 890 );
+        TEST_ASSERT( tmesh->m_TVec.size() == 1662 );
+        TEST_ASSERT( tmesh->m_EVec.size() == 2471 );
+        TEST_ASSERT( tmesh->m_NonClosedTriVec.size() == 36 );
+
+        vector< int > edge_rec_vec;
+        RecordTriEdges( tmesh, edge_rec_vec );
+
+        //==== Previous Edge Loop Over Every Pair Of Tris At Each Node ====//
+        tmesh->m_EVec.clear();
+        for ( int n = 0 ; n < ( int )tmesh->m_NVec.size() ; n++ )
+        {
+            tmesh->m_NVec[n]->m_TriVec.clear();
+        }
+        for ( int t = 0 ; t < ( int )tmesh->m_TVec.size() ; t++ )
+        {
+            TTri* tri = tmesh->m_TVec[t];
+            tri->m_N0->m_TriVec.push_back( tri );
+            tri->m_N1->m_TriVec.push_back( tri );
+            tri->m_N2->m_TriVec.push_back( tri );
+            tri->m_E0 = tri->m_E1 = tri->m_E2 = NULL;
+        }
+        for ( int n = 0 ; n < ( int )tmesh->m_NVec.size() ; n++ )
+        {
+            TNode* node = tmesh->m_NVec[n];
+            for ( int t = 0 ; t < ( int )node->m_TriVec.size() ; t++ )
+            {
+                for ( int s = t + 1 ; s < ( int )node->m_TriVec.size() ; s++ )
+                {
+                    tmesh->FindEdge( node, node->m_TriVec[t], node->m_TriVec[s] );
+                }
+            }
+        }
+
+        vector< int > loop_rec_vec;
+        RecordTriEdges( tmesh, loop_rec_vec );
+        TEST_ASSERT( edge_rec_vec == loop_rec_vec );
+
+        delete tmesh;
+    }
+}
+
 void GeomCoreTestSuite::CompareMeshes( Vehicle & veh, string mesh_a, string mesh_b )
 {
     MeshGeom* mesh_1 = ( MeshGeom* )veh.FindGeom( mesh_a );
@@ -280,3 +572,57 @@ void GeomCoreTestSuite::CompareVec3ds( const vec3d & v1, const vec3d & v2, const
     sprintf( str, "v1[2]: %10.16g v%10.16g %s", v1[2], v2[2], msg );
     TEST_ASSERT_MSG( std::abs( v1[2] - v2[2] ) < 1e-5, str );
 }
+
+//==== Unit Sphere Mesh Fine Enough To Give The Bounding Volume Tree Several Levels ====//
+TMesh* GeomCoreTestSuite::MakeSphereTMesh( Vehicle & veh, const vec3d & loc )
+{
+    GeomType type;
+    type.m_Type = ELLIPSOID_GEOM_TYPE;
+    type.m_Name = "ELLIPSOID";
+
+    Geom* geom = veh.FindGeom( veh.AddGeom( type ) );
+    geom->m_XRelLoc = loc.x();
+    geom->m_YRelLoc = loc.y();
+    geom->m_ZRelLoc = loc.z();
+    geom->m_TessU = 20;
+    geom->m_TessW = 25;
+    geom->Update();
+
+    vector< TMesh* > tmesh_vec = geom->CreateTMeshVec();
+    return tmesh_vec[0];
+}
+
+//==== Edge Order, Direction, Tris And The Edge Slots Of Each Tri As Indices ====//
+void GeomCoreTestSuite::RecordTriEdges( TMesh* tmesh, vector< int > & rec_vec )
+{
+    map< TNode*, int > node_map;
+    map< TTri*, int > tri_map;
+    map< TEdge*, int > edge_map;
+    for ( int n = 0 ; n < ( int )tmesh->m_NVec.size() ; n++ )
+    {
+        node_map[ tmesh->m_NVec[n] ] = n;
+    }
+    for ( int t = 0 ; t < ( int )tmesh->m_TVec.size() ; t++ )
+    {
+        tri_map[ tmesh->m_TVec[t] ] = t;
+    }
+    edge_map[ NULL ] = -1;
+
+    rec_vec.clear();
+    for ( int e = 0 ; e < ( int )tmesh->m_EVec.size() ; e++ )
+    {
+        TEdge* edge = tmesh->m_EVec[e];
+        edge_map[ edge ] = e;
+        rec_vec.push_back( node_map[ edge->m_N0 ] );
+        rec_vec.push_back( node_map[ edge->m_N1 ] );
+        rec_vec.push_back( tri_map[ edge->m_Tri0 ] );
+        rec_vec.push_back( tri_map[ edge->m_Tri1 ] );
+    }
+    for ( int t = 0 ; t < ( int )tmesh->m_TVec.size() ; t++ )
+    {
+        TTri* tri = tmesh->m_TVec[t];
+        rec_vec.push_back( edge_map[ tri->m_E0 ] );
+        rec_vec.push_back( edge_map[ tri->m_E1 ] );
+        rec_vec.push_back( edge_map[ tri->m_E2 ] );
+    }
+}
@@ -27,6 +27,9 @@ public:
         TEST_ADD( GeomCoreTestSuite::PodTest )
         TEST_ADD( GeomCoreTestSuite::XmlTest )
         TEST_ADD( GeomCoreTestSuite::MeshIOTest )
+        TEST_ADD( GeomCoreTestSuite::TMeshIntersectTest )
+        TEST_ADD( GeomCoreTestSuite::TMeshSplitTest )
+        TEST_ADD( GeomCoreTestSuite::TMeshWeldTest )
     }
 
 private:
@@ -36,8 +39,13 @@ private:
     void PodTest();
     void XmlTest();
     void MeshIOTest();
+    void TMeshIntersectTest();
+    void TMeshSplitTest();
+    void TMeshWeldTest();
     void CompareMeshes( Vehicle & veh, string mesh_a, string mesh_b );
     void CompareVec3ds( const vec3d & v1, const vec3d & v2, const char * msg = NULL );
+    TMesh* MakeSphereTMesh( Vehicle & veh, const vec3d & loc );
+    static void RecordTriEdges( TMesh* tmesh, vector< int > & rec_vec );
 
     static void WritePnts( std::vector< vec3d > & pnt_vec, std::string file_name );
 
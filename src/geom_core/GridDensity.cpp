@@ -400,6 +400,14 @@ double PointSimpleSource::GetTargetLen( double base_len, vec3d &  pos, const str
     return ( m_Len + fract * ( base_len - m_Len  ) );
 }
 
+bool PointSimpleSource::GetInfluenceBox( BndBox & box )
+{
+    box.Reset();
+    box.Update( m_Loc + vec3d( m_Rad, m_Rad, m_Rad ) );
+    box.Update( m_Loc - vec3d( m_Rad, m_Rad, m_Rad ) );
+    return true;
+}
+
 void PointSimpleSource::Update( Geom* geomPtr )
 {
     m_Loc = geomPtr->CompPnt01(m_SurfIndx, m_ULoc, m_WLoc);
@@ -186,6 +186,9 @@ public:
 
     virtual double GetTargetLen( double base_len, vec3d &  pos, const string & geomid, const int & surfindx, const double & u, const double &w ) = 0;
 
+    // Box outside of which GetTargetLen always returns base_len.  False if no such box is known.
+    virtual bool GetInfluenceBox( BndBox & box )                    { return false; }
+
     virtual void Draw()                                             {}
 
     virtual void Update( Geom* geomPtr )                            {}
@@ -219,6 +222,7 @@ public:
     virtual ~PointSimpleSource()      {}
 
     virtual double GetTargetLen( double base_len, vec3d &  pos, const string & geomid, const int & surfindx, const double & u, const double &w );
+    virtual bool GetInfluenceBox( BndBox & box );
 
     virtual void Update( Geom* geomPtr );
 
@@ -251,6 +255,7 @@ public:
     virtual void AdjustLen( double val );
 
     virtual double GetTargetLen( double base_len, vec3d &  pos, const string & geomid, const int & surfindx, const double & u, const double &w );
+    virtual bool GetInfluenceBox( BndBox & box )                    { box = m_Box; return true; }
 
     virtual void Update( Geom* geomPtr );
 
@@ -297,6 +302,7 @@ public:
     void ComputeCullPnts();
 
     virtual double GetTargetLen( double base_len, vec3d &  pos, const string & geomid, const int & surfindx, const double & u, const double &w );
+    virtual bool GetInfluenceBox( BndBox & box )                    { box = m_Box; return true; }
 
     void Update( Geom* geomPtr );
 
@@ -18,11 +18,19 @@ public:
     HingeGeom( Vehicle* vehicle_ptr );
     virtual ~HingeGeom();
 
+    //==== Surface Is Built From The Attached Parent Frame ====//
+    virtual bool SurfDependsOnPlacement()           { return true; }
+
     virtual int GetNumMainSurfs()
     {
         return 0;
     };
 
+    virtual bool CanDeferLoad()
+    {
+        return false;
+    }
+
     virtual void UpdateSurf();
 
     virtual void UpdateMotionFlagsLimits();
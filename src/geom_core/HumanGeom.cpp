@@ -28,12 +28,25 @@
 #include "utils.h"
 #include "debugging.h"
 #include "pinocchioApi.h"
+#include "quatinterface.h"
 
 #include "HumanGeomData.h"
 
 unordered_set < int > HumanGeom::m_VertCopySet;
 Pinocchio::Mesh HumanGeom::m_MasterMesh;
 Pinocchio::Attachment *HumanGeom::m_MasterAttach = NULL;
+
+vector < int > HumanGeom::m_SkinSrcVec;
+vector < double > HumanGeom::m_SkinRefyVec;
+vector < int > HumanGeom::m_SkinDestVec;
+vector < int > HumanGeom::m_SkinCopyVec;
+vector < int > HumanGeom::m_SkinStartVec;
+vector < int > HumanGeom::m_SkinBoneVec;
+vector < double > HumanGeom::m_SkinWeightVec;
+
+map < vector < double >, vector < vec3d > > HumanGeom::m_PoseCache;
+
+#define MAX_POSE_CACHE 32
 Vsp1DCurve HumanGeom::m_MaleStatureECDF;
 Vsp1DCurve HumanGeom::m_FemaleStatureECDF;
 Vsp1DCurve HumanGeom::m_MaleBMIECDF;
@@ -163,6 +176,8 @@ HumanGeom::HumanGeom( Vehicle* vehicle_ptr ) : Geom( vehicle_ptr )
 
         m_MasterAttach = SetupAttach( m_MasterMesh, skeleton );
 
+        SetupSkinTable();
+
         // 20 & over.  From NHANES
         vector < double > cprob = {.05, .10, .15, .25, .50, .75, .85, .90, .95};
         vector < double > msta = {1634, 1662, 1680, 1706, 1756, 1808, 1837, 1854, 1881};
@@ -346,7 +361,7 @@ void HumanGeom::ValidateParms( )
         m_AnkleLt = m_AnkleRt();
     }
 
-    if ( UpdatedParm( m_LenUnit.GetID() ) )
+    if ( UpdatedParm( m_LenUnit ) )
     {
         m_Stature.SetLowerLimit( 0.0 );
         m_Stature.SetUpperLimit( 1e5 );
@@ -369,7 +384,7 @@ void HumanGeom::ValidateParms( )
         }
     }
 
-    if( UpdatedParm( m_Stature.GetID() ) )
+    if( UpdatedParm( m_Stature ) )
     {
         double p;
         if ( m_GenderFlag() == vsp::MALE )
@@ -394,7 +409,7 @@ void HumanGeom::ValidateParms( )
         }
     }
 
-    if( UpdatedParm( m_Mass.GetID() ) )
+    if( UpdatedParm( m_Mass ) )
     {
         double sta_m = 0.001 * m_Stature() / Get_mm2UX();
         m_BMI = ConvertMass( m_Mass(), m_MassUnit(), vsp::MASS_UNIT_KG ) / ( sta_m * sta_m );
@@ -410,7 +425,7 @@ void HumanGeom::ValidateParms( )
         }
         m_BMI_pct = p;
     }
-    else if( UpdatedParm( m_BMI.GetID() ) )
+    else if( UpdatedParm( m_BMI ) )
     {
         double sta_m = 0.001 * m_Stature() / Get_mm2UX();
         m_Mass = ConvertMass( m_BMI() * sta_m * sta_m, vsp::MASS_UNIT_KG, m_MassUnit() );
@@ -610,28 +625,81 @@ void HumanGeom::UpdateSurf()
 
 
 
-    // Process main geometry
-    m_MainVerts.clear();
-    m_MainVerts.resize( NUM_MESH_VERT * 2 );
-
-    // Anthropometric calculation of base mesh
-    if ( m_GenderFlag() == vsp::MALE )
+    // Humans with the same body and pose share one posed base mesh.
+    vector < double > pose_key;
+    pose_key.reserve( 5 + 8 * nbones );
+    pose_key.push_back( m_GenderFlag() );
+    for ( int i = 0; i < 4; i++ )
     {
-        ComputeResultsMesh( m_male_half_pcs, score, m_male_half_verts, m_MainVerts );
+        pose_key.push_back( vars[i] );
     }
-    else
+    for ( int i = 0; i < nbones; i++ )
     {
-        ComputeResultsMesh( m_female_half_pcs, score, m_female_half_verts, m_MainVerts );
+        Pinocchio::Quaternion<> q = trs[i].getRot();
+        Vector3 t = trs[i].getTrans();
+        for ( int j = 0; j < 4; j++ )
+        {
+            pose_key.push_back( q[j] );
+        }
+        for ( int j = 0; j < 3; j++ )
+        {
+            pose_key.push_back( t[j] );
+        }
+        pose_key.push_back( trs[i].getScale() );
     }
 
-    Pinocchio::Mesh m_LocalMesh = m_MasterMesh;
+    bool cache_hit = false;
+    #pragma omp critical( human_pose_cache )
+    {
+        map < vector < double >, vector < vec3d > >::const_iterator it = m_PoseCache.find( pose_key );
+        if ( it != m_PoseCache.end() )
+        {
+            m_MainVerts = it->second;
+            cache_hit = true;
+        }
+    }
 
-    CopyVertsToMesh( m_MainVerts, m_LocalMesh );
+    if ( !cache_hit )
+    {
+        // Process main geometry
+        m_MainVerts.clear();
+        m_MainVerts.resize( NUM_MESH_VERT * 2 );
 
-    // Deform for pose
-    Pinocchio::Mesh newmesh = m_MasterAttach->deform( m_LocalMesh, trs );
+        // Anthropometric calculation of base mesh
+        if ( m_GenderFlag() == vsp::MALE )
+        {
+            ComputeResultsMesh( m_male_half_pcs, score, m_male_half_verts, m_MainVerts );
+        }
+        else
+        {
+            ComputeResultsMesh( m_female_half_pcs, score, m_female_half_verts, m_MainVerts );
+        }
 
-    CopyMeshToVerts( newmesh, m_MainVerts );
+        // Deform for pose
+        if ( m_MasterMesh.algo == Pinocchio::Mesh::MIX )
+        {
+            Pinocchio::Mesh m_LocalMesh = m_MasterMesh;
+
+            CopyVertsToMesh( m_MainVerts, m_LocalMesh );
+
+            Pinocchio::Mesh newmesh = m_MasterAttach->deform( m_LocalMesh, trs );
+
+            CopyMeshToVerts( newmesh, m_MainVerts );
+        }
+        else
+        {
+            DeformVerts( trs, m_MainVerts );
+        }
+
+        #pragma omp critical( human_pose_cache )
+        {
+            if ( m_PoseCache.size() >= MAX_POSE_CACHE )
+            {
+                m_PoseCache.clear();
+            }
+            m_PoseCache[ pose_key ] = m_MainVerts;
+        }
+    }
 
     // Get scale for units.
     double sf = Get_mm2UX();
@@ -1431,6 +1499,140 @@ Pinocchio::Attachment* HumanGeom::SetupAttach( const Pinocchio::Mesh &m, const P
     return a;
 }
 
+//==== Flatten Vertex Mapping And Nonzero Bone Weights Of The Master Mesh ====//
+void HumanGeom::SetupSkinTable()
+{
+    int nvert = m_MasterMesh.vertices.size();
+
+    m_SkinSrcVec.resize( nvert );
+    m_SkinRefyVec.resize( nvert );
+    m_SkinDestVec.resize( nvert );
+    m_SkinCopyVec.resize( nvert );
+    m_SkinStartVec.resize( nvert + 1 );
+    m_SkinBoneVec.clear();
+    m_SkinWeightVec.clear();
+
+    for ( int i = 0; i < nvert; i++ )
+    {
+        int oVID = m_MasterMesh.vertices[i].origVertID;
+
+        // Source, as in CopyVertsToMesh
+        int isrc = oVID;
+        double refy = 1.0;
+        if ( isrc >= NUM_MESH_VERT )
+        {
+            isrc = isrc - NUM_MESH_VERT;
+
+            if ( m_VertCopySet.count( isrc ) == 0 ) // Vert is a mirror.
+            {
+                refy = -1.0;
+            }
+        }
+        m_SkinSrcVec[i] = isrc;
+        m_SkinRefyVec[i] = refy;
+
+        // Destination, as in CopyMeshToVerts
+        m_SkinDestVec[i] = oVID;
+        m_SkinCopyVec[i] = -1;
+        if ( oVID < NUM_MESH_VERT && m_VertCopySet.count( oVID ) )
+        {
+            m_SkinCopyVec[i] = oVID + NUM_MESH_VERT;
+        }
+
+        // Same bones in the same order as Pinocchio's nonzero weight lists.
+        m_SkinStartVec[i] = m_SkinBoneVec.size();
+        Vector<double, -1> w = m_MasterAttach->getWeights( i );
+        for ( int j = 0; j < w.size(); j++ )
+        {
+            if ( w[j] != 0.0 )
+            {
+                m_SkinBoneVec.push_back( j );
+                m_SkinWeightVec.push_back( w[j] );
+            }
+        }
+    }
+    m_SkinStartVec[nvert] = m_SkinBoneVec.size();
+}
+
+//==== Pose Vertices With The Master Attachment, Matching Attachment::deform ====//
+// Works on the flat table so neither the mesh copies nor the vertex normals of deform are needed, and converts
+// each bone transform to a dual quaternion once instead of once per weighted vertex.
+void HumanGeom::DeformVerts( const std::vector< Pinocchio::Transform<> > &trs, vector < vec3d > &verts )
+{
+    int nbones = trs.size();
+    int nvert = m_SkinSrcVec.size();
+    bool dqs = ( m_MasterMesh.algo == Pinocchio::Mesh::DQS );
+
+    vector < Tbx::Dual_quat_cu > dquat_vec;
+    vector < Tbx::Quat_cu > rot_vec;
+    if ( dqs )
+    {
+        dquat_vec.resize( nbones );
+        rot_vec.resize( nbones );
+        for ( int b = 0; b < nbones; b++ )
+        {
+            dquat_vec[b] = Pinocchio::getQuatFromMat( trs[b] );
+            rot_vec[b] = dquat_vec[b].rotation();
+        }
+    }
+
+    vector < vec3d > out = verts;
+
+    for ( int i = 0; i < nvert; i++ )
+    {
+        const vec3d & src = verts[ m_SkinSrcVec[i] ];
+        Vector3 pos( src[0], m_SkinRefyVec[i] * src[1], src[2] );
+
+        int kstart = m_SkinStartVec[i];
+        int kend = m_SkinStartVec[i + 1];
+
+        Vector3 newpos;
+        if ( dqs )
+        {
+            Tbx::Dual_quat_cu dquat_blend = Tbx::Dual_quat_cu::identity();
+            Tbx::Quat_cu q0 = dquat_blend.rotation();
+
+            if ( kend > kstart )
+            {
+                int b = m_SkinBoneVec[kstart];
+                dquat_blend = dquat_vec[b] * ( float ) m_SkinWeightVec[kstart];
+                q0 = rot_vec[b];
+            }
+
+            for ( int k = kstart + 1; k < kend; k++ )
+            {
+                int b = m_SkinBoneVec[k];
+                float w = m_SkinWeightVec[k];
+
+                // find shortest rotation
+                if ( rot_vec[b].dot( q0 ) < 0.f )
+                {
+                    w *= -1.f;
+                }
+
+                dquat_blend = dquat_blend + dquat_vec[b] * w;
+            }
+
+            newpos = Pinocchio::transformPoint( pos, dquat_blend );
+        }
+        else
+        {
+            for ( int k = kstart; k < kend; k++ )
+            {
+                newpos += ( trs[ m_SkinBoneVec[k] ] * pos ) * m_SkinWeightVec[k];
+            }
+        }
+
+        out[ m_SkinDestVec[i] ].set_xyz( newpos[0], newpos[1], newpos[2] );
+        if ( m_SkinCopyVec[i] >= 0 )
+        {
+            out[ m_SkinCopyVec[i] ].set_xyz( newpos[0], newpos[1], newpos[2] );
+        }
+    }
+
+    verts.swap( out );
+}
+
 template < typename vertmat >
 void HumanGeom::CopyVertsToMesh( const vertmat & vm, Pinocchio::Mesh &m  )
 {
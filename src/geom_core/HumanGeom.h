@@ -120,13 +120,21 @@ public:
         return 0;
     }
 
+    virtual bool CanDeferLoad()
+    {
+        return false;
+    }
+
     virtual void CreateDegenGeom( vector<DegenGeom> &dgs, bool preview = false );
+    virtual int PrepareDegenSurfs()                     { return -1; }
 
     virtual vector< TMesh* > CreateTMeshVec();
 
     virtual void SetupMesh( Pinocchio::Mesh &m );
     template < typename vertmat > void SetupSkel( const vertmat & vm, Pinocchio::DataSkeleton &skeleton );
     static Pinocchio::Attachment * SetupAttach( const Pinocchio::Mesh &m, const Pinocchio::Skeleton &skeleton );
+    static void SetupSkinTable();
+    static void DeformVerts( const std::vector< Pinocchio::Transform<> > &trs, vector < vec3d > &verts );
 
     template < typename vertmat > void CopyVertsToMesh( const vertmat & vm, Pinocchio::Mesh &m );
     template < typename vertmat > void CopyMeshToVerts( const Pinocchio::Mesh &m, vertmat & vm );
@@ -231,6 +239,20 @@ private:
     // are either in this set (referenced to lower half indices k-NUM_MESH_VERT) or are reflections of the lower half
     // point.  Test with: m_VertCopySet.count( klower );
 
+    // Flat skinning table built once from m_MasterAttach.  Mesh vertex i reads m_SkinSrcVec[i] (reflected by
+    // m_SkinRefyVec[i]), writes m_SkinDestVec[i] and also m_SkinCopyVec[i] when that is not -1.  Its bone weights
+    // are m_SkinWeightVec[k] for bones m_SkinBoneVec[k], k in [m_SkinStartVec[i]:m_SkinStartVec[i+1]-1].
+    static vector < int > m_SkinSrcVec;
+    static vector < double > m_SkinRefyVec;
+    static vector < int > m_SkinDestVec;
+    static vector < int > m_SkinCopyVec;
+    static vector < int > m_SkinStartVec;
+    static vector < int > m_SkinBoneVec;
+    static vector < double > m_SkinWeightVec;
+
+    // Posed base mesh keyed by gender, anthropometric inputs and bone transforms.
+    static map < vector < double >, vector < vec3d > > m_PoseCache;
+
 
     vector < vec3d > m_MainVerts;
 
@@ -38,11 +38,13 @@ Link::~Link()
 void Link::SetParmA( const string &id  )
 {
     m_ParmA = id;
+    LinkMgr.SetLinkGraphDirty();
 }
 
 void Link::SetParmB( const string &id )
 {
     m_ParmB = id;
+    LinkMgr.SetLinkGraphDirty();
 }
 
 void Link::InitOffsetScale()
@@ -114,6 +116,8 @@ xmlNodePtr Link::DecodeXml( xmlNodePtr & link_node )
         m_ScaleFlag = !!XmlUtil::FindInt( link_node, "ScaleFlag", m_ScaleFlag );
         m_LowerLimitFlag = !!XmlUtil::FindInt( link_node, "LowerLimitFlag", m_LowerLimitFlag );
         m_UpperLimitFlag = !!XmlUtil::FindInt( link_node, "UpperLimitFlag", m_UpperLimitFlag );
+
+        LinkMgr.SetLinkGraphDirty();
     }
     return link_node;
 }
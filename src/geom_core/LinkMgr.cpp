@@ -13,6 +13,12 @@
 #include "Vehicle.h"
 #include "StlHelper.h"
 
+#include <cassert>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 bool LinkMgrSingleton::m_firsttime = true;
 
 //==== Constructor ====//
@@ -24,6 +30,8 @@ LinkMgrSingleton::LinkMgrSingleton()
     m_UserParms.SetNumPredefined( m_NumPredefinedUserParms );
     m_UserParms.Renew(m_NumPredefinedUserParms);
 
+    m_LinkGraphDirty = true;
+    m_OrderedFlag = false;
 }
 
 void LinkMgrSingleton::Init()
@@ -51,7 +59,12 @@ void LinkMgrSingleton::Wype()
     DelAllLinks();
     m_LinkVec = deque< Link* >();
 
-    m_UpdatedParmVec = vector< string >();
+    m_UpdatedParmVec = vector< int >();
+    m_PendingParmVec = vector< string >();
+    m_LinkGraph = vector< LinkGraphNode >();
+    m_LinkGraphParmMap.clear();
+    m_LinkGraphDirty = true;
+    m_OrderedFlag = false;
 
     m_BaseLinkableContainers = vector< string >();
     m_LinkableContainers = vector< string >();
@@ -145,6 +158,7 @@ void LinkMgrSingleton::CheckLinks()
     for ( int i = 0 ; i < ( int )del_indices.size() ; i++ )
     {
         m_LinkVec.erase( m_LinkVec.begin() + del_indices[i] );
+        m_LinkGraphDirty = true;
     }
 
 }
@@ -249,6 +263,7 @@ bool LinkMgrSingleton::AddLink( const string& pidA, const string& pidB, bool ini
 
     m_LinkVec.push_back( pl );
     m_CurrLinkIndex = ( int )m_LinkVec.size() - 1;
+    m_LinkGraphDirty = true;
 
     return true;
 }
@@ -268,6 +283,7 @@ void LinkMgrSingleton::DelCurrLink()
     delete pl;
 
     m_CurrLinkIndex = -1;
+    m_LinkGraphDirty = true;
 }
 
 //==== Delete All Links ====//
@@ -280,6 +296,7 @@ void LinkMgrSingleton::DelAllLinks()
 
     m_LinkVec.clear();
     m_CurrLinkIndex = -1;
+    m_LinkGraphDirty = true;
 }
 //==== Link All Parms In A Group ====//
 bool LinkMgrSingleton::LinkAllGroup()
@@ -384,99 +401,378 @@ void LinkMgrSingleton::ResetWorkingLink()
 //==== Parm Changed ====//
 void LinkMgrSingleton::ParmChanged( const string& pid, bool start_flag  )
 {
+    //==== Ordered Propagation Sets Downstream Parms Itself ====//
+    if ( m_OrderedFlag )
+    {
+        if ( start_flag && !vector_contains_val( m_PendingParmVec, pid ) )
+        {
+            m_PendingParmVec.push_back( pid );
+        }
+        return;
+    }
+
     //==== Find Parm Ptr ===//
     Parm* parm_ptr = ParmMgr.FindParm( pid );
     if ( !parm_ptr )
         return;
 
-    //==== Check For Advanced Links ====//
-    bool adv_link_flag = AdvLinkMgr.IsInputParm( pid );
+    //==== Graph Is Shared By The Threads Of A Parallel Update, Which Rebuilds It Beforehand ====//
+#ifdef _OPENMP
+    if ( omp_in_parallel() )
+    {
+        assert( !m_LinkGraphDirty );
+    }
+    else
+#endif
+    {
+        UpdateLinkGraph();
+    }
 
-    //==== Look for Reg Links  ====//
-    vector < Link* > parm_link_vec;
-    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    //==== Abort if No Links ====//
+    int node = FindLinkGraphNode( pid );
+    if ( node < 0 || m_LinkGraph[node].m_OutVec.empty() )
+        return;
+
+    if ( !start_flag )
     {
-        if ( m_LinkVec[i]->GetParmA() == pid )
+        PropagateRecursive( parm_ptr );
+        return;
+    }
+
+    //==== Defer Geom Updates So Each Changed Geom Updates Once ====//
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    if ( veh )
+    {
+        veh->BeginParmBatch();
+    }
+
+    if ( !PropagateOrdered( pid ) )
+    {
+        PropagateRecursive( parm_ptr );
+    }
+
+    //==== Changes Started By Advanced Link Code While Propagating ====//
+    while ( !m_PendingParmVec.empty() )
+    {
+        string next_id = m_PendingParmVec.front();
+        m_PendingParmVec.erase( m_PendingParmVec.begin() );
+
+        Parm* next_ptr = ParmMgr.FindParm( next_id );
+        int next_node = FindLinkGraphNode( next_id );
+        if ( !next_ptr || next_ptr->GetLinkUpdateFlag() || next_node < 0 || m_LinkGraph[next_node].m_OutVec.empty() )
         {
-            parm_link_vec.push_back( m_LinkVec[i] );
+            continue;
+        }
+
+        if ( !PropagateOrdered( next_id ) )
+        {
+            PropagateRecursive( next_ptr );
         }
     }
 
-    //==== Check Links ====//
-    bool reg_link_flag = false;
-    if ( parm_link_vec.size() )
+    //==== Clean Up ====/
+    for ( int i = 0 ; i < ( int )m_UpdatedParmVec.size() ; i++ )
     {
-        reg_link_flag = true;
+        Parm* p = ParmMgr.FindParm( m_UpdatedParmVec[i] );
+        if ( p )
+        {
+            p->SetLinkUpdateFlag( false );
+        }
     }
+    m_UpdatedParmVec.clear();
 
-    //==== Abort if No Links ====//
-    if ( !adv_link_flag && !reg_link_flag )
-        return;
-
-    //==== Set Link Update Flag ====//
-    parm_ptr->SetLinkUpdateFlag( true );
-    m_UpdatedParmVec.push_back( parm_ptr->GetID() );
+    if ( veh )
+    {
+        veh->EndParmBatch();
+        veh->ParmChanged( parm_ptr, Parm::SET );
+    }
+}
 
-    //==== Update Linked Parms ====//
-    for ( int i = 0 ; i < ( int )parm_link_vec.size() ; i++ )
+//==== Set Each Parm Downstream Of A Change Once, In Dependency Order ====//
+// Returns false without changing anything if the change reaches a link cycle.
+bool LinkMgrSingleton::PropagateOrdered( const string & pid )
+{
+    int src = FindLinkGraphNode( pid );
+    if ( src < 0 )
     {
-        Link* pl = parm_link_vec[i];
-        Parm* pB = ParmMgr.FindParm( pl->GetParmB() );
+        return true;
+    }
 
-        if ( pB && ! pB->GetLinkUpdateFlag() )       // Prevent Circular
+    //==== Collect Nodes Downstream Of The Changed Parm ====//
+    int num_nodes = ( int )m_LinkGraph.size();
+    vector< bool > reached( num_nodes, false );
+    vector< int > reach_vec;
+    reached[src] = true;
+    reach_vec.push_back( src );
+    for ( int i = 0 ; i < ( int )reach_vec.size() ; i++ )
+    {
+        const LinkGraphNode & gn = m_LinkGraph[ reach_vec[i] ];
+        if ( gn.m_CycleFlag )
         {
-            double offset = 0.0;
-            if ( pl->GetOffsetFlag() )
-            {
-                offset = pl->m_Offset();
-            }
-            double scale = 1.0;
-            if ( pl->GetScaleFlag() )
+            return false;
+        }
+        for ( int j = 0 ; j < ( int )gn.m_OutVec.size() ; j++ )
+        {
+            if ( !reached[ gn.m_OutVec[j] ] )
             {
-                scale = pl->m_Scale();
+                reached[ gn.m_OutVec[j] ] = true;
+                reach_vec.push_back( gn.m_OutVec[j] );
             }
+        }
+    }
 
-            double val = parm_ptr->Get() * scale + offset;
+    //==== Topological Order Of The Downstream Nodes ====//
+    vector< int > in_cnt( num_nodes, 0 );
+    for ( int i = 0 ; i < ( int )reach_vec.size() ; i++ )
+    {
+        const LinkGraphNode & gn = m_LinkGraph[ reach_vec[i] ];
+        for ( int j = 0 ; j < ( int )gn.m_OutVec.size() ; j++ )
+        {
+            in_cnt[ gn.m_OutVec[j] ]++;
+        }
+    }
 
-            if ( pl->GetLowerLimitFlag() && val < pl->m_LowerLimit() )      // Constraints
+    vector< int > order_vec;
+    order_vec.push_back( src );
+    for ( int i = 0 ; i < ( int )order_vec.size() ; i++ )
+    {
+        const LinkGraphNode & gn = m_LinkGraph[ order_vec[i] ];
+        for ( int j = 0 ; j < ( int )gn.m_OutVec.size() ; j++ )
+        {
+            if ( --in_cnt[ gn.m_OutVec[j] ] == 0 )
             {
-                val = pl->m_LowerLimit();
+                order_vec.push_back( gn.m_OutVec[j] );
             }
+        }
+    }
+
+    //==== Apply Links Node By Node ====//
+    m_OrderedFlag = true;
+    for ( int i = 0 ; i < ( int )order_vec.size() ; i++ )
+    {
+        int n = order_vec[i];
+
+        if ( m_LinkGraph[n].m_AdvLink )
+        {
+            m_LinkGraph[n].m_AdvLink->ForceUpdate();
+            continue;
+        }
+
+        Parm* p = FindLinkGraphParm( n );
+        if ( !p )
+        {
+            continue;
+        }
+
+        p->SetLinkUpdateFlag( true );
+        m_UpdatedParmVec.push_back( p->GetHandle() );
 
-            if ( pl->GetUpperLimitFlag() && val > pl->m_UpperLimit() )      // Constraints
+        for ( int j = 0 ; j < ( int )m_LinkGraph[n].m_OutLinkVec.size() ; j++ )
+        {
+            if ( m_LinkGraph[n].m_OutLinkVec[j] )
             {
-                val = pl->m_UpperLimit();
+                ApplyLink( m_LinkGraph[n].m_OutLinkVec[j], p, FindLinkGraphParm( m_LinkGraph[n].m_OutVec[j] ) );
             }
+        }
+    }
+    m_OrderedFlag = false;
+
+    return true;
+}
+
+//==== Follow Links Depth First, Parms Already Set Are Skipped So Cycles End ====//
+void LinkMgrSingleton::PropagateRecursive( Parm* parm_ptr )
+{
+    string pid = parm_ptr->GetID();
+
+    //==== Check For Advanced Links ====//
+    bool adv_link_flag = AdvLinkMgr.IsInputParm( pid );
 
-            pB->SetFromLink( val );
+    //==== Look for Reg Links  ====//
+    vector < Link* > parm_link_vec;
+    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    {
+        if ( m_LinkVec[i]->GetParmA() == pid )
+        {
+            parm_link_vec.push_back( m_LinkVec[i] );
         }
     }
 
+    //==== Set Link Update Flag ====//
+    parm_ptr->SetLinkUpdateFlag( true );
+    m_UpdatedParmVec.push_back( parm_ptr->GetHandle() );
+
+    //==== Update Linked Parms ====//
+    for ( int i = 0 ; i < ( int )parm_link_vec.size() ; i++ )
+    {
+        ApplyLink( parm_link_vec[i], parm_ptr );
+    }
+
     //==== Update Adv Link ===//
     if ( adv_link_flag )
     {
         AdvLinkMgr.UpdateLinks( pid );
     }
+}
 
-    //==== Clean Up ====/
-    if ( start_flag )      
+//==== Set Parm B Of A Link From Parm A ====//
+void LinkMgrSingleton::ApplyLink( Link* pl, Parm* pA )
+{
+    ApplyLink( pl, pA, ParmMgr.FindParm( pl->GetParmB() ) );
+}
+
+void LinkMgrSingleton::ApplyLink( Link* pl, Parm* pA, Parm* pB )
+{
+    if ( pB && ! pB->GetLinkUpdateFlag() )       // Prevent Circular
     {
-        for ( int i = 0 ; i < ( int )m_UpdatedParmVec.size() ; i++ )
+        double offset = 0.0;
+        if ( pl->GetOffsetFlag() )
         {
-            Parm* p = ParmMgr.FindParm( m_UpdatedParmVec[i] );
-            if ( p )
-            {
-                p->SetLinkUpdateFlag( false );
-            }
+            offset = pl->m_Offset();
+        }
+        double scale = 1.0;
+        if ( pl->GetScaleFlag() )
+        {
+            scale = pl->m_Scale();
         }
-        m_UpdatedParmVec.clear();
 
-        Vehicle* veh = VehicleMgr.GetVehicle();
-        if ( veh )
+        double val = pA->Get() * scale + offset;
+
+        if ( pl->GetLowerLimitFlag() && val < pl->m_LowerLimit() )      // Constraints
         {
-            veh->ParmChanged( parm_ptr, Parm::SET );
+            val = pl->m_LowerLimit();
         }
+
+        if ( pl->GetUpperLimitFlag() && val > pl->m_UpperLimit() )      // Constraints
+        {
+            val = pl->m_UpperLimit();
+        }
+
+        pB->SetFromLink( val );
+    }
+}
+
+//==== Rebuild The Link Graph If Links Changed Since It Was Built ====//
+void LinkMgrSingleton::UpdateLinkGraph()
+{
+    if ( m_LinkGraphDirty )
+    {
+        BuildLinkGraph();
+    }
+}
+
+//==== Build Dependency Graph Of Parm And Advanced Links ====//
+void LinkMgrSingleton::BuildLinkGraph()
+{
+    m_LinkGraph.clear();
+    m_LinkGraphParmMap.clear();
+
+    for ( int i = 0 ; i < ( int )m_LinkVec.size() ; i++ )
+    {
+        int a = AddLinkGraphNode( m_LinkVec[i]->GetParmA() );
+        int b = AddLinkGraphNode( m_LinkVec[i]->GetParmB() );
+        m_LinkGraph[a].m_OutVec.push_back( b );
+        m_LinkGraph[a].m_OutLinkVec.push_back( m_LinkVec[i] );
+    }
+
+    vector< AdvLink* > adv_link_vec = AdvLinkMgr.GetLinks();
+    for ( int i = 0 ; i < ( int )adv_link_vec.size() ; i++ )
+    {
+        m_LinkGraph.push_back( LinkGraphNode() );
+        int k = ( int )m_LinkGraph.size() - 1;
+        m_LinkGraph[k].m_AdvLink = adv_link_vec[i];
+
+        vector< VarDef > in_vec = adv_link_vec[i]->GetInputVars();
+        for ( int j = 0 ; j < ( int )in_vec.size() ; j++ )
+        {
+            int n = AddLinkGraphNode( in_vec[j].m_ParmID );
+            m_LinkGraph[n].m_OutVec.push_back( k );
+            m_LinkGraph[n].m_OutLinkVec.push_back( NULL );
+        }
+
+        vector< VarDef > out_vec = adv_link_vec[i]->GetOutputVars();
+        for ( int j = 0 ; j < ( int )out_vec.size() ; j++ )
+        {
+            int n = AddLinkGraphNode( out_vec[j].m_ParmID );
+            m_LinkGraph[k].m_OutVec.push_back( n );
+            m_LinkGraph[k].m_OutLinkVec.push_back( NULL );
+        }
+    }
+
+    //==== Nodes Left Over By A Full Topological Sort Are In Or Fed By Cycles ====//
+    int num_nodes = ( int )m_LinkGraph.size();
+    vector< int > in_cnt( num_nodes, 0 );
+    for ( int i = 0 ; i < num_nodes ; i++ )
+    {
+        for ( int j = 0 ; j < ( int )m_LinkGraph[i].m_OutVec.size() ; j++ )
+        {
+            in_cnt[ m_LinkGraph[i].m_OutVec[j] ]++;
+        }
+    }
+
+    vector< int > order_vec;
+    for ( int i = 0 ; i < num_nodes ; i++ )
+    {
+        if ( in_cnt[i] == 0 )
+        {
+            order_vec.push_back( i );
+        }
+    }
+    for ( int i = 0 ; i < ( int )order_vec.size() ; i++ )
+    {
+        const LinkGraphNode & gn = m_LinkGraph[ order_vec[i] ];
+        for ( int j = 0 ; j < ( int )gn.m_OutVec.size() ; j++ )
+        {
+            if ( --in_cnt[ gn.m_OutVec[j] ] == 0 )
+            {
+                order_vec.push_back( gn.m_OutVec[j] );
+            }
+        }
+    }
+    for ( int i = 0 ; i < num_nodes ; i++ )
+    {
+        m_LinkGraph[i].m_CycleFlag = ( in_cnt[i] > 0 );
+    }
+
+    m_LinkGraphDirty = false;
+}
+
+int LinkMgrSingleton::FindLinkGraphNode( const string & pid )
+{
+    unordered_map< string, int >::iterator iter = m_LinkGraphParmMap.find( pid );
+    if ( iter != m_LinkGraphParmMap.end() )
+    {
+        return iter->second;
+    }
+    return -1;
+}
+
+//==== Parm Of A Graph Node, Found Through Its Handle ====//
+Parm* LinkMgrSingleton::FindLinkGraphParm( int node )
+{
+    LinkGraphNode & gn = m_LinkGraph[node];
+
+    Parm* p = ParmMgr.FindParm( gn.m_ParmHandle );
+    if ( !p && !gn.m_ParmID.empty() )
+    {
+        // First use, or the parm was re-created or given a new ID since
+        p = ParmMgr.FindParm( gn.m_ParmID );
+        gn.m_ParmHandle = p ? p->GetHandle() : -1;
+    }
+    return p;
+}
+
+int LinkMgrSingleton::AddLinkGraphNode( const string & pid )
+{
+    int n = FindLinkGraphNode( pid );
+    if ( n < 0 )
+    {
+        m_LinkGraph.push_back( LinkGraphNode() );
+        n = ( int )m_LinkGraph.size() - 1;
+        m_LinkGraph[n].m_ParmID = pid;
+        m_LinkGraphParmMap[pid] = n;
     }
+    return n;
 }
 
 
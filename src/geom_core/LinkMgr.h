@@ -11,11 +11,30 @@
 #if !defined(LINKMGR__INCLUDED_)
 #define LINKMGR__INCLUDED_
 
+#include "UsingCpp11.h"
 #include "Link.h"
 #include <deque>
+#include <unordered_map>
 using std::string;
 using std::vector;
 using std::deque;
+using std::unordered_map;
+
+class AdvLink;
+
+//==== Node In The Link Dependency Graph: A Parm Or An Advanced Link ====//
+class LinkGraphNode
+{
+public:
+    LinkGraphNode()                                         { m_ParmHandle = -1; m_AdvLink = NULL; m_CycleFlag = false; }
+
+    string m_ParmID;                    // Empty For Advanced Link Nodes
+    int m_ParmHandle;                   // Resolved From m_ParmID On First Use
+    AdvLink* m_AdvLink;
+    vector< int > m_OutVec;             // Downstream Nodes
+    vector< Link* > m_OutLinkVec;       // Link Driving Each Downstream Parm, NULL For Advanced Link Edges
+    bool m_CycleFlag;                   // Node Is In Or Fed By A Link Cycle
+};
 
 
 //==== Parm Link Manager ====//
@@ -44,8 +63,10 @@ public:
     virtual bool UsedInLink( const string & pid );
 
     virtual bool AddLink( const string& pA, const string& pB, bool init_link_parms = true );         // Link Two Parms
-    virtual void AddLink( Link* link )                      {  m_LinkVec.push_back( link ); }
+    virtual void AddLink( Link* link )                      {  m_LinkVec.push_back( link ); m_LinkGraphDirty = true; }
     virtual void ParmChanged( const string& pid, bool start_flag );     // A Parm Has Changed Check Links
+    void SetLinkGraphDirty()                                { m_LinkGraphDirty = true; }
+    void UpdateLinkGraph();                                 // Rebuild If Dirty, Only Outside Parallel Regions
 
     virtual void SetCurrLinkIndex( int i )                  { m_CurrLinkIndex = i; }
     virtual int  GetCurrLinkIndex()                         { return m_CurrLinkIndex; }
@@ -108,7 +129,24 @@ private:
 
     deque< Link* > m_LinkVec;
 
-    vector< string > m_UpdatedParmVec;      // Keep Track Of Linked Parm To Prevent Circular Links
+    vector< int > m_UpdatedParmVec;         // Handles Of Linked Parms, To Prevent Circular Links
+
+    //==== Link Dependency Graph, Rebuilt When Links Are Added, Removed Or Edited ====//
+    virtual void BuildLinkGraph();
+    int FindLinkGraphNode( const string & pid );
+    int AddLinkGraphNode( const string & pid );
+    Parm* FindLinkGraphParm( int node );
+    virtual bool PropagateOrdered( const string & pid );
+    virtual void PropagateRecursive( Parm* parm_ptr );
+    void ApplyLink( Link* pl, Parm* pA );
+    void ApplyLink( Link* pl, Parm* pA, Parm* pB );
+
+    bool m_LinkGraphDirty;
+    vector< LinkGraphNode > m_LinkGraph;
+    unordered_map< string, int > m_LinkGraphParmMap;    // Parm ID->Node Index
+
+    bool m_OrderedFlag;                     // Ordered Propagation Drives Every Set Itself
+    vector< string > m_PendingParmVec;      // Changes Started During Ordered Propagation
 
     vector< string > m_BaseLinkableContainers;              // Base Registered Parm Containers
     vector< string > m_LinkableContainers;                  // All valid Linkable Container
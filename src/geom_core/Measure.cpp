@@ -5,6 +5,13 @@
 #include "VSP_Geom_API.h"
 #include "UnitConversion.h"
 
+//==== Surface Revision Of A Measured Geom, -1 If It Does Not Exist ====//
+static int GeomSurfRevision( Vehicle* veh, const string & geom_id )
+{
+    Geom* geom = veh->FindGeom( geom_id );
+    return geom ? geom->GetSurfRevision() : -1;
+}
+
 Probe::Probe() : ParmContainer()
 {
     m_Stage = STAGE_ZERO;
@@ -33,6 +40,11 @@ Probe::Probe() : ParmContainer()
 
     m_Len.Init( "Len", "Measure", this, 1.0, 0.0, 1.0e12 );
 
+    m_DirtyFlag = true;
+    m_LastStage = -1;
+    m_LastOriginRevision = -1;
+    m_LastTextSize = -1.0;
+
     m_LabelDO.m_GeomID = ParmMgr.GenerateID( 4 ) + "_Probe";
     m_LabelDO.m_Type = DrawObj::VSP_PROBE;
     m_LabelDO.m_Screen = DrawObj::VSP_MAIN_SCREEN;
@@ -51,6 +63,7 @@ Probe::~Probe()
 
 void Probe::ParmChanged( Parm* parm_ptr, int type )
 {
+    m_DirtyFlag = true;
     VehicleMgr.GetVehicle()->ParmChanged( parm_ptr, type );
 }
 
@@ -129,9 +142,29 @@ void Probe::Update()
         m_LabelDO.m_Visible = m_Visible();
 
         m_LabelDO.m_TextSize = veh->m_TextSize();
+
+        // Setting the outputs above marked the probe dirty
+        m_DirtyFlag = false;
+        m_LastStage = m_Stage;
+        m_LastOriginGeomID = m_OriginGeomID;
+        m_LastOriginRevision = GeomSurfRevision( veh, m_OriginGeomID );
+        m_LastTextSize = veh->m_TextSize();
     }
 }
 
+bool Probe::NeedsUpdate()
+{
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    if ( !veh )
+    {
+        return false;
+    }
+
+    return m_DirtyFlag || m_Stage != m_LastStage || m_OriginGeomID != m_LastOriginGeomID ||
+           GeomSurfRevision( veh, m_OriginGeomID ) != m_LastOriginRevision ||
+           veh->m_TextSize() != m_LastTextSize;
+}
+
 bool Probe::Valid()
 {
     if ( m_Stage == STAGE_ZERO )
@@ -194,6 +227,13 @@ Ruler::Ruler() : ParmContainer()
 
     m_Distance.Init( "Distance", "Measure", this, 0.0, -1.0e12, 1.0e12 );
 
+    m_DirtyFlag = true;
+    m_LastStage = -1;
+    m_LastOriginRevision = -1;
+    m_LastEndRevision = -1;
+    m_LastTextSize = -1.0;
+    m_LastLenUnit = -1;
+
     m_LabelDO.m_GeomID = ParmMgr.GenerateID( 4 ) + "_Ruler";
     m_LabelDO.m_Type = DrawObj::VSP_RULER;
     m_LabelDO.m_Screen = DrawObj::VSP_MAIN_SCREEN;
@@ -214,6 +254,7 @@ Ruler::~Ruler()
 
 void Ruler::ParmChanged( Parm* parm_ptr, int type )
 {
+    m_DirtyFlag = true;
     VehicleMgr.GetVehicle()->ParmChanged( parm_ptr, type );
 }
 
@@ -265,7 +306,32 @@ void Ruler::Update()
         m_LabelDO.m_Visible = m_Visible();
 
         m_LabelDO.m_TextSize = veh->m_TextSize();
+
+        // Setting the outputs above marked the ruler dirty
+        m_DirtyFlag = false;
+        m_LastStage = m_Stage;
+        m_LastOriginGeomID = m_OriginGeomID;
+        m_LastEndGeomID = m_EndGeomID;
+        m_LastOriginRevision = GeomSurfRevision( veh, m_OriginGeomID );
+        m_LastEndRevision = GeomSurfRevision( veh, m_EndGeomID );
+        m_LastTextSize = veh->m_TextSize();
+        m_LastLenUnit = veh->m_MeasureLenUnit();
+    }
+}
+
+bool Ruler::NeedsUpdate()
+{
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    if ( !veh )
+    {
+        return false;
     }
+
+    return m_DirtyFlag || m_Stage != m_LastStage ||
+           m_OriginGeomID != m_LastOriginGeomID || m_EndGeomID != m_LastEndGeomID ||
+           GeomSurfRevision( veh, m_OriginGeomID ) != m_LastOriginRevision ||
+           GeomSurfRevision( veh, m_EndGeomID ) != m_LastEndRevision ||
+           veh->m_TextSize() != m_LastTextSize || veh->m_MeasureLenUnit() != m_LastLenUnit;
 }
 
 bool Ruler::Valid()
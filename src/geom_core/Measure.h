@@ -33,6 +33,9 @@ public:
     virtual void Update();
     bool Valid();
 
+    // True when a parm, the attached Geom's surface or the display settings changed since Update
+    bool NeedsUpdate();
+
     virtual void SetLenFromPlacement( const vec3d &placement );
 
     int m_Stage;
@@ -66,6 +69,13 @@ public:
 protected:
 
     DrawObj m_LabelDO;
+
+    //==== State Seen By The Last Update ====//
+    bool m_DirtyFlag;
+    int m_LastStage;
+    std::string m_LastOriginGeomID;
+    int m_LastOriginRevision;
+    double m_LastTextSize;
 };
 
 class Ruler : public ParmContainer
@@ -86,6 +96,9 @@ public:
     virtual void Update();
     bool Valid();
 
+    // True when a parm, either attached Geom's surface or the display settings changed since Update
+    bool NeedsUpdate();
+
     std::string m_EndGeomID;
 
     IntParm m_EndIndx;
@@ -120,5 +133,15 @@ protected:
 
     DrawObj m_LabelDO;
 
+    //==== State Seen By The Last Update ====//
+    bool m_DirtyFlag;
+    int m_LastStage;
+    std::string m_LastOriginGeomID;
+    std::string m_LastEndGeomID;
+    int m_LastOriginRevision;
+    int m_LastEndRevision;
+    double m_LastTextSize;
+    int m_LastLenUnit;
+
 };
 #endif
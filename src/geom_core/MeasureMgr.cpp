@@ -221,14 +221,21 @@ void MeasureMgrSingleton::Update()
 {
     DeleteInvalid();
 
+    // Only measures whose parms or attached Geoms changed are evaluated again
     for( int i = 0; i < ( int )m_Rulers.size(); i++ )
     {
-        m_Rulers[i]->Update();
+        if ( m_Rulers[i]->NeedsUpdate() )
+        {
+            m_Rulers[i]->Update();
+        }
     }
 
     for( int i = 0; i < ( int )m_Probes.size(); i++ )
     {
-        m_Probes[i]->Update();
+        if ( m_Probes[i]->NeedsUpdate() )
+        {
+            m_Probes[i]->Update();
+        }
     }
 }
 
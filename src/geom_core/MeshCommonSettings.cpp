@@ -282,6 +282,12 @@ CfdMeshSettings::CfdMeshSettings() : MeshCommonSettings()
 
     m_ExportRawFlag.Init( "ExportRawFlag", "ExportCFD", this, false, 0, 1 );
 
+    m_ExportBinaryFlag.Init( "ExportBinaryFlag", "ExportCFD", this, false, 0, 1 );
+    m_ExportBinaryFlag.SetDescript( "Flag to write binary rather than ASCII .tri and .msh files" );
+
+    m_OutOfCoreFlag.Init( "OutOfCoreFlag", "Global", this, false, 0, 1 );
+    m_OutOfCoreFlag.SetDescript( "Flag to keep finished surface meshes in a temporary file rather than in memory" );
+
     InitCommonParms();
     m_DrawBorderFlag = false;
     m_DrawIsectFlag = false;
@@ -449,6 +455,9 @@ StructSettings::StructSettings() : MeshCommonSettings()
 
     m_XYZIntCurveFlag.Init( "SRF_XYZIntCurve", "ExportFEA", this, false, 0, 1 );
 
+    m_NASTRANLargeFieldFlag.Init( "NASTRAN_LargeField", "ExportFEA", this, false, 0, 1 );
+    m_NASTRANLargeFieldFlag.SetDescript( "Flag to Write NASTRAN GRID Cards in Large Field Format" );
+
     m_ExportRawFlag.Init( "ExportRawFlag", "ExportFEA", this, false, 0, 1 );
 
     m_CADLenUnit.Init( "CADLenUnit", "ExportFEA", this, vsp::LEN_FT, vsp::LEN_MM, vsp::LEN_YD );
@@ -228,6 +228,8 @@ public:
 
     BoolParm m_ExportFileFlags[vsp::CFD_NUM_FILE_NAMES];
     BoolParm m_XYZIntCurveFlag;
+    BoolParm m_ExportBinaryFlag;            // Binary .tri and .msh files
+    BoolParm m_OutOfCoreFlag;               // Finished surface meshes wait in a temp file
 
 protected:
 
@@ -266,6 +268,7 @@ public:
     BoolParm m_DrawNodesFlag;
     BoolParm m_DrawElementOrientVecFlag;
     BoolParm m_XYZIntCurveFlag;
+    BoolParm m_NASTRANLargeFieldFlag;
 
 protected:
 
@@ -18,12 +18,14 @@
 #include "ParmMgr.h"
 #include "LinkMgr.h"
 #include "Vehicle.h"
+#include "FileUtil.h"
 #include "PntNodeMerge.h"
 
 #include "StringUtil.h"
 #include "StlHelper.h"
 
 #include "SubSurfaceMgr.h"
+#include "PerfStats.h"
 
 //==== Constructor =====//
 MeshGeom::MeshGeom( Vehicle* vehicle_ptr ) : Geom( vehicle_ptr )
@@ -104,6 +106,14 @@ xmlNodePtr MeshGeom::EncodeXml( xmlNodePtr & node )
 {
     Geom::EncodeXml( node );
     xmlNodePtr mesh_node = xmlNewChild( node, NULL, BAD_CAST "MeshGeom", NULL );
+
+    // Tri lists are copied directly by CopyPayloadFrom
+    if ( IsCopyEncoding() )
+    {
+        XmlUtil::AddIntNode( mesh_node, "Num_Meshes", 0 );
+        return mesh_node;
+    }
+
     XmlUtil::AddIntNode( mesh_node, "Num_Meshes", ( int )m_TMeshVec.size() );
     for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
@@ -159,6 +169,31 @@ xmlNodePtr MeshGeom::DecodeXml( xmlNodePtr & node )
     return mesh_node;
 }
 
+//==== Copy TMeshes Without Going Through Text ====//
+void MeshGeom::CopyPayloadFrom( Geom* geom )
+{
+    MeshGeom* mesh_geom = dynamic_cast< MeshGeom* >( geom );
+    if ( !mesh_geom )
+    {
+        return;
+    }
+
+    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        delete m_TMeshVec[i];
+    }
+    m_TMeshVec.resize( mesh_geom->m_TMeshVec.size() );
+
+    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        m_TMeshVec[i] = new TMesh();
+        m_TMeshVec[i]->CopyTriList( mesh_geom->m_TMeshVec[i] );
+
+        // Load this geom properties into each TMesh
+        m_TMeshVec[i]->LoadGeomAttributes( this );
+    }
+}
+
 int MeshGeom::ReadXSec( const char* file_name )
 {
     FILE *fp;
@@ -232,170 +267,209 @@ int MeshGeom::ReadXSec( const char* file_name )
     return 1;
 }
 
-int MeshGeom::ReadSTL( const char* file_name )
+//==== Move Split Forward To Next Line Starting With A Facet ====//
+static const char* NextSTLFacet( const char* p, const char* end )
 {
-    FILE* file_id = fopen( file_name, "r" );
+    while ( p < end )
+    {
+        const char* tok = SkipSpace( p, end );
+        if ( TokenEquals( tok, end, "facet" ) )
+        {
+            return tok;
+        }
+        p = SkipLine( tok, end );
+    }
+    return end;
+}
 
-    char str[256];
-    float nx, ny, nz;
-    float v0[3];
-    float v1[3];
-    float v2[3];
-    TTri*  tPtr;
-    TMesh*  tMesh = new TMesh();
+//==== Parse ASCII STL Facets - 12 Floats Per Facet ( Normal, V0, V1, V2 ) ====//
+static void ParseSTLFacets( const char* p, const char* end, vector< float > & facet_vec )
+{
+    float f[12];
+    int nvert = -1;                 // Vertices read for current facet, -1 when outside a facet
 
-    if ( file_id )
+    p = SkipSpace( p, end );
+    while ( p < end )
     {
-        //==== Cheesy ASCII/Binary Test ====//
-        int binaryFlag = 0;
-        while ( fgets( str, 255, file_id ) )
+        const char* tok_end = SkipToken( p, end );
+
+        if ( TokenEquals( p, end, "facet" ) )
         {
-            for ( int i = 0 ; i < ( int )strlen( str ) ; i++ )
+            //==== facet normal nx ny nz ====//
+            p = SkipToken( SkipSpace( tok_end, end ), end );
+            nvert = 0;
+            if ( !( ParseFloat( p, end, f[0] ) && ParseFloat( p, end, f[1] ) && ParseFloat( p, end, f[2] ) ) )
             {
-                if ( ( unsigned char )str[i] > 127 )
-                {
-                    binaryFlag = 1;
-                    break;
-                }
+                nvert = -1;
             }
         }
+        else if ( nvert >= 0 && nvert < 3 && TokenEquals( p, end, "vertex" ) )
+        {
+            p = tok_end;
+            float* v = f + 3 * ( nvert + 1 );
+            if ( ParseFloat( p, end, v[0] ) && ParseFloat( p, end, v[1] ) && ParseFloat( p, end, v[2] ) )
+            {
+                nvert++;
+            }
+            else
+            {
+                nvert = -1;
+            }
+        }
+        else
+        {
+            if ( nvert == 3 && TokenEquals( p, end, "endfacet" ) )
+            {
+                facet_vec.insert( facet_vec.end(), f, f + 12 );
+                nvert = -1;
+            }
+            p = tok_end;
+        }
 
-        rewind( file_id );
+        p = SkipSpace( p, end );
+    }
+}
 
-        if ( !binaryFlag )
-        {
-            fgets( str, 255, file_id );
+static inline float SwapFloat( float fval )
+{
+    unsigned char* cptr = ( unsigned char* )&fval;
+    std::swap( cptr[0], cptr[3] );
+    std::swap( cptr[1], cptr[2] );
+    return fval;
+}
 
-            int stopFlag = 0;
+int MeshGeom::ReadSTL( const char* file_name )
+{
+    MappedFile file;
+    if ( !file.Open( file_name ) )
+    {
+        return 0;
+    }
+
+    const char* data = file.Begin();
+    size_t size = file.Size();
+
+    //==== ASCII/Binary Test - Binary Size Matches Facet Count Or File Has Non ASCII Bytes ====//
+    bool binaryFlag = false;
+    unsigned int numFacet = 0;
+    if ( size >= 84 )
+    {
+        memcpy( &numFacet, data + 80, 4 );
+        if ( m_BigEndianFlag )
+        {
+            unsigned char* cptr = ( unsigned char* )&numFacet;
+            std::swap( cptr[0], cptr[3] );
+            std::swap( cptr[1], cptr[2] );
+        }
+        binaryFlag = ( 84 + 50 * ( unsigned long long )numFacet == size );
+    }
 
-            while ( !stopFlag )
+    if ( !binaryFlag )
+    {
+        long long num = ( long long )size;
+        int highFlag = 0;
+        #pragma omp parallel for reduction( | : highFlag )
+        for ( long long i = 0 ; i < num ; i++ )
+        {
+            if ( ( unsigned char )data[i] > 127 )
             {
-                if ( EOF == fscanf( file_id, "%*s %*s %f %f %f\n", &nx, &ny, &nz ) )
-                {
-                    break;
-                }
+                highFlag = 1;
+            }
+        }
+        binaryFlag = ( highFlag != 0 );
+    }
 
-                if ( EOF == fscanf( file_id, "%*s %*s" ) )
-                {
-                    break;
-                }
+    vector< float > facet_vec;
 
-                if ( EOF == fscanf( file_id, "%*s %f %f %f\n", &v0[0], &v0[1], &v0[2] ) )
-                {
-                    break;
-                }
-                if ( EOF == fscanf( file_id, "%*s %f %f %f\n", &v1[0], &v1[1], &v1[2] ) )
-                {
-                    break;
-                }
-                if ( EOF == fscanf( file_id, "%*s %f %f %f\n", &v2[0], &v2[1], &v2[2] ) )
-                {
-                    break;
-                }
-                if ( EOF == fscanf( file_id, "%*s" ) )
-                {
-                    break;
-                }
-                if ( EOF == fscanf( file_id, "%*s" ) )
-                {
-                    break;
-                }
+    if ( !binaryFlag )
+    {
+        //==== Split On Facet Boundaries And Parse Blocks In Parallel ====//
+        const char* begin = SkipLine( data, file.End() );      // Skip solid line
+        vector< const char* > split_vec;
+        SplitTextBlocks( begin, file.End(), NumTextBlocks( begin, file.End() ), split_vec );
+        for ( int b = 1 ; b < ( int )split_vec.size() - 1 ; b++ )
+        {
+            split_vec[b] = NextSTLFacet( std::max( split_vec[b], split_vec[b - 1] ), file.End() );
+        }
 
-                //==== Add Valid Facet ====//
-                tPtr = new TTri();
-                tPtr->m_InteriorFlag = 0;
-                tPtr->m_Norm = vec3d( nx, ny, nz );
-                tMesh->m_TVec.push_back( tPtr );
-
-                //==== Put Nodes Into Tri ====//
-                tPtr->m_N0 = new TNode();
-                tPtr->m_N1 = new TNode();
-                tPtr->m_N2 = new TNode();
-                tPtr->m_N0->m_Pnt = vec3d( v0[0], v0[1], v0[2] );
-                tPtr->m_N1->m_Pnt = vec3d( v1[0], v1[1], v1[2] );
-                tPtr->m_N2->m_Pnt = vec3d( v2[0], v2[1], v2[2] );
-                tMesh->m_NVec.push_back( tPtr->m_N0 );
-                tMesh->m_NVec.push_back( tPtr->m_N1 );
-                tMesh->m_NVec.push_back( tPtr->m_N2 );
-
-                fpos_t pos;
-                fgetpos( file_id, &pos );
-
-                if ( EOF == fscanf( file_id, "%s %*s\n", str ) )
-                {
-                    break;
-                }
+        int num_block = ( int )split_vec.size() - 1;
+        vector< vector< float > > block_facet_vec( num_block );
 
-                if ( strcmp( str, "endsolid" ) == 0 )
-                {
-                    fgets( str, 255, file_id );
-                    if ( feof( file_id ) )
-                    {
-                        break;
-                    }
-                }
-                else
-                {
-                    fsetpos( file_id, &pos );
-                }
-            }
+        #pragma omp parallel for schedule( dynamic )
+        for ( int b = 0 ; b < num_block ; b++ )
+        {
+            ParseSTLFacets( split_vec[b], split_vec[b + 1], block_facet_vec[b] );
         }
-        else
+
+        size_t num = 0;
+        for ( int b = 0 ; b < num_block ; b++ )
         {
-            fclose( file_id );
-            file_id = fopen( file_name, "rb" );         // Reopen as Binary
+            num += block_facet_vec[b].size();
+        }
 
-            //==== Header ====//
-            fread( str, sizeof( char ), 80, file_id );
+        facet_vec.reserve( num );
+        for ( int b = 0 ; b < num_block ; b++ )
+        {
+            facet_vec.insert( facet_vec.end(), block_facet_vec[b].begin(), block_facet_vec[b].end() );
+            vector< float >().swap( block_facet_vec[b] );
+        }
+    }
+    else if ( size >= 84 )
+    {
+        //==== Read Facet Records Straight From The File ====//
+        long long num = std::min( ( unsigned long long )numFacet, ( unsigned long long )( size - 84 ) / 50 );
+        facet_vec.resize( 12 * num );
 
-            int numFacet = ReadBinInt( file_id );
+        #pragma omp parallel for
+        for ( long long i = 0 ; i < num ; i++ )
+        {
+            float* f = &facet_vec[12 * i];
+            memcpy( f, data + 84 + 50 * i, 12 * sizeof( float ) );
 
-            for ( int i = 0 ; i < numFacet ; i++ )
+            if ( m_BigEndianFlag )
             {
-                nx = ReadBinFloat( file_id );
-                ny = ReadBinFloat( file_id );
-                nz = ReadBinFloat( file_id );
-
-                v0[0] = ReadBinFloat( file_id );
-                v0[1] = ReadBinFloat( file_id );
-                v0[2] = ReadBinFloat( file_id );
-                v1[0] = ReadBinFloat( file_id );
-                v1[1] = ReadBinFloat( file_id );
-                v1[2] = ReadBinFloat( file_id );
-                v2[0] = ReadBinFloat( file_id );
-                v2[1] = ReadBinFloat( file_id );
-                v2[2] = ReadBinFloat( file_id );
-
-                //==== Padding ====//
-                fgetc( file_id );
-                fgetc( file_id );
-
-                //==== Add Valid Facet ====//
-                tPtr = new TTri();
-                tPtr->m_InteriorFlag = 0;
-                tPtr->m_Norm = vec3d( nx, ny, nz );
-                tMesh->m_TVec.push_back( tPtr );
-
-                //==== Put Nodes Into Tri ====//
-                tPtr->m_N0 = new TNode();
-                tPtr->m_N1 = new TNode();
-                tPtr->m_N2 = new TNode();
-                tPtr->m_N0->m_Pnt = vec3d( v0[0], v0[1], v0[2] );
-                tPtr->m_N1->m_Pnt = vec3d( v1[0], v1[1], v1[2] );
-                tPtr->m_N2->m_Pnt = vec3d( v2[0], v2[1], v2[2] );
-
+                for ( int k = 0 ; k < 12 ; k++ )
+                {
+                    f[k] = SwapFloat( f[k] );
+                }
             }
         }
-        fclose( file_id );
     }
 
+    file.Close();
 
-    if ( tMesh->m_TVec.size() == 0 )
+    int numTri = ( int )( facet_vec.size() / 12 );
+    if ( numTri == 0 )
     {
-        delete tMesh;
         return 0;
     }
 
+    //==== Add Facets ====//
+    TMesh*  tMesh = new TMesh();
+    tMesh->m_TVec.reserve( numTri );
+    tMesh->m_NVec.reserve( 3 * numTri );
+
+    for ( int i = 0 ; i < numTri ; i++ )
+    {
+        const float* f = &facet_vec[12 * i];
+
+        TTri* tPtr = tMesh->NewTri();
+        tPtr->m_InteriorFlag = 0;
+        tPtr->m_Norm = vec3d( f[0], f[1], f[2] );
+        tMesh->m_TVec.push_back( tPtr );
+
+        //==== Put Nodes Into Tri ====//
+        tPtr->m_N0 = tMesh->NewNode();
+        tPtr->m_N1 = tMesh->NewNode();
+        tPtr->m_N2 = tMesh->NewNode();
+        tPtr->m_N0->m_Pnt = vec3d( f[3], f[4], f[5] );
+        tPtr->m_N1->m_Pnt = vec3d( f[6], f[7], f[8] );
+        tPtr->m_N2->m_Pnt = vec3d( f[9], f[10], f[11] );
+        tMesh->m_NVec.push_back( tPtr->m_N0 );
+        tMesh->m_NVec.push_back( tPtr->m_N1 );
+        tMesh->m_NVec.push_back( tPtr->m_N2 );
+    }
+
     m_TMeshVec.push_back( tMesh );
     UpdateBBox();
 
@@ -446,6 +520,82 @@ int MeshGeom::ReadBinInt( FILE* fptr )
     return ival;
 }
 
+//==== Indexed Mesh Output Formatted In Parallel By WriteChunked ====//
+class IndexedPntFormatter
+{
+public:
+    enum { CART3D, OBJ, NASCART };
+
+    IndexedPntFormatter( const vector< TNode* > & node_vec, const Matrix4d & mat, int type ) :
+        m_NodeVec( node_vec ), m_Mat( mat ), m_Type( type )     {}
+
+    void operator()( int i, string & buf ) const
+    {
+        TNode* tnode = m_NodeVec[i];
+        // Apply Transformations
+        if( tnode )
+        {
+            vec3d v = m_Mat.xform( tnode->m_Pnt );
+            if ( m_Type == NASCART )
+            {
+                AppendFormat( buf, "%16.10g %16.10g %16.10g\n", v.x(), v.z(), -v.y() );
+            }
+            else if ( m_Type == OBJ )
+            {
+                AppendFormat( buf, "v %16.10g %16.10g %16.10g\n", v.x(), v.y(),  v.z() );
+            }
+            else
+            {
+                AppendFormat( buf, "%16.10g %16.10g %16.10g\n", v.x(), v.y(),  v.z() );
+            }
+        }
+    }
+
+protected:
+    const vector< TNode* > & m_NodeVec;
+    const Matrix4d & m_Mat;
+    int m_Type;
+};
+
+class IndexedTriFormatter
+{
+public:
+    enum { CART3D, OBJ, NASCART, CART3D_PART };
+
+    IndexedTriFormatter( const vector< TTri* > & tri_vec, int off, int type ) :
+        m_TriVec( tri_vec ), m_Off( off ), m_Type( type )       {}
+
+    void operator()( int t, string & buf ) const
+    {
+        TTri* ttri = m_TriVec[t];
+        if( ttri )
+        {
+            if ( m_Type == NASCART )
+            {
+                AppendFormat( buf, "%d %d %d %d.0\n", ttri->m_N0->m_ID + 1 + m_Off,  ttri->m_N2->m_ID + 1 + m_Off,
+                              ttri->m_N1->m_ID + 1 + m_Off, SubSurfaceMgr.GetTag( ttri->m_Tags ) );
+            }
+            else if ( m_Type == OBJ )
+            {
+                AppendFormat( buf, "f %d %d %d\n", ttri->m_N0->m_ID + 1 + m_Off,  ttri->m_N1->m_ID + 1 + m_Off, ttri->m_N2->m_ID + 1 + m_Off );
+            }
+            else if ( m_Type == CART3D_PART )
+            {
+                AppendFormat( buf, "%d \n",  SubSurfaceMgr.GetTag( ttri->m_Tags ) );
+            }
+            else
+            {
+                AppendFormat( buf, "%d %d %d\n", ttri->m_N0->m_ID + 1 + m_Off,  ttri->m_N1->m_ID + 1 + m_Off, ttri->m_N2->m_ID + 1 + m_Off );
+            }
+        }
+    }
+
+protected:
+    const vector< TTri* > & m_TriVec;
+    int m_Off;
+    int m_Type;
+};
+
 //==== Write STL File ====//
 void MeshGeom::WriteStl( FILE* file_id )
 {
@@ -468,9 +618,32 @@ void MeshGeom::WriteStl( FILE* file_id )
     }
 }
 
+//==== Load Facets Written By WriteStl For Binary Output ====//
+void MeshGeom::LoadStlTris( vector< vec3d > & pnt_vec )
+{
+    int m;
+
+    if ( m_ViewMeshFlag() )
+    {
+        for ( m = 0; m < ( int ) m_TMeshVec.size(); m++ )
+        {
+            m_TMeshVec[m]->LoadSTLTris( pnt_vec, GetTotalTransMat() );
+        }
+    }
+
+    if ( m_ViewSliceFlag() )
+    {
+        for ( m = 0; m < ( int ) m_SliceVec.size(); m++ )
+        {
+            m_SliceVec[m]->LoadSTLTris( pnt_vec, GetTotalTransMat() );
+        }
+    }
+}
+
 void MeshGeom::WriteStl( FILE* file_id, int tag )
 {
     //==== Write Out Tris ====//
+    vector< vec3d > pnt_vec;
     for ( int i = 0 ; i < ( int )m_IndexedTriVec.size() ; i++ )
     {
         TTri* ttri = m_IndexedTriVec[i];
@@ -479,60 +652,104 @@ void MeshGeom::WriteStl( FILE* file_id, int tag )
 
         if ( t == tag )
         {
-            vec3d p0 = ttri->m_N0->m_Pnt;
-            vec3d p1 = ttri->m_N1->m_Pnt;
-            vec3d p2 = ttri->m_N2->m_Pnt;
-            vec3d v10 = p1 - p0;
-            vec3d v20 = p2 - p1;
-            vec3d norm = cross( v10, v20 );
-            norm.normalize();
+            pnt_vec.push_back( ttri->m_N0->m_Pnt );
+            pnt_vec.push_back( ttri->m_N1->m_Pnt );
+            pnt_vec.push_back( ttri->m_N2->m_Pnt );
+        }
+    }
+    WriteSTLFacets( file_id, pnt_vec );
+}
 
-            fprintf( file_id, " facet normal  %2.10le %2.10le %2.10le\n",  norm.x(), norm.y(), norm.z() );
-            fprintf( file_id, "   outer loop\n" );
+//==== Store Node Coordinates And Tri Indices Of Nascart/Tri Files By Token Index ====//
+class IndexedMeshTokenParser
+{
+public:
+    IndexedMeshTokenParser( int num_nodes, int num_tris, int tri_stride, vector< float > & coord_vec, vector< int > & ind_vec ) :
+        m_NumCoord( 3 * num_nodes ), m_NumInd( tri_stride * num_tris ), m_TriStride( tri_stride ),
+        m_CoordVec( coord_vec ), m_IndVec( ind_vec )      {}
 
-            fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p0.x(), p0.y(), p0.z() );
-            fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p1.x(), p1.y(), p1.z() );
-            fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", p2.x(), p2.y(), p2.z() );
+    void operator()( int index, const char* tok, const char* tok_end ) const
+    {
+        if ( index < m_NumCoord )
+        {
+            ParseFloat( tok, tok_end, m_CoordVec[index] );
+            return;
+        }
 
-            fprintf( file_id, "   endloop\n" );
-            fprintf( file_id, " endfacet\n" );
+        index -= m_NumCoord;
+        if ( index < m_NumInd && index % m_TriStride < 3 )
+        {
+            ParseInt( tok, tok_end, m_IndVec[3 * ( index / m_TriStride ) + index % m_TriStride] );
         }
     }
-}
 
-int MeshGeom::ReadNascart( const char* file_name )
+protected:
+    int m_NumCoord;
+    int m_NumInd;
+    int m_TriStride;
+    vector< float > & m_CoordVec;
+    vector< int > & m_IndVec;
+};
+
+//==== Read Node Count, Tri Count, Nodes And Tri Indices ====//
+static bool ReadIndexedMesh( const char* file_name, int tri_stride, vector< float > & coord_vec, vector< int > & ind_vec )
 {
-    int i;
-    FILE* file_id = fopen( file_name, "r" );
+    MappedFile file;
+    if ( !file.Open( file_name ) )
+    {
+        return false;
+    }
 
-    if ( !file_id )
+    const char* p = file.Begin();
+    int num_nodes, num_tris;
+
+    if ( !ParseInt( p, file.End(), num_nodes ) || !ParseInt( p, file.End(), num_tris ) || num_nodes < 0 || num_tris < 0 )
     {
-        return 0;
+        return false;
     }
 
-    TMesh*  tMesh = new TMesh();
+    coord_vec.assign( 3 * num_nodes, 0.0f );
+    ind_vec.assign( 3 * num_tris, 0 );
 
-    //==== Read Number Tris and Nodes ====//
-    float x, y, z;
-    int n0, n1, n2;
-    float col;
-    int num_tris, num_nodes;
+    ParseTokensParallel( p, file.End(), IndexedMeshTokenParser( num_nodes, num_tris, tri_stride, coord_vec, ind_vec ) );
 
-    fscanf( file_id, "%d", &num_nodes );
-    fscanf( file_id, "%d", &num_tris  );
+    return true;
+}
 
-    vec3d p;
-    vector< vec3d > pVec;
-    for ( i = 0 ; i < num_nodes ; i++ )
+int MeshGeom::ReadNascart( const char* file_name )
+{
+    //==== Nodes, Then Tris As n0 n2 n1 Color ====//
+    vector< float > coord_vec;
+    vector< int > ind_vec;
+    if ( !ReadIndexedMesh( file_name, 4, coord_vec, ind_vec ) )
     {
-        fscanf( file_id, "%f %f %f", &x, &y, &z );
-        p.set_xyz( x, -z, y );
-        pVec.push_back( p );
+        return 0;
     }
 
-    for ( i = 0 ; i < num_tris ; i++ )
+    int num_nodes = ( int )coord_vec.size() / 3;
+    int num_tris = ( int )ind_vec.size() / 3;
+
+    vector< vec3d > pVec( num_nodes );
+    for ( int i = 0 ; i < num_nodes ; i++ )
     {
-        fscanf( file_id, "%d %d %d %f", &n0, &n2, &n1, &col );
+        pVec[i].set_xyz( coord_vec[3 * i], -coord_vec[3 * i + 2], coord_vec[3 * i + 1] );
+    }
+    vector< float >().swap( coord_vec );
+
+    TMesh*  tMesh = new TMesh();
+    tMesh->m_TVec.reserve( num_tris );
+    tMesh->m_NVec.reserve( 3 * num_tris );
+
+    for ( int i = 0 ; i < num_tris ; i++ )
+    {
+        int n0 = ind_vec[3 * i];
+        int n2 = ind_vec[3 * i + 1];
+        int n1 = ind_vec[3 * i + 2];
+
+        if ( n0 < 1 || n1 < 1 || n2 < 1 || n0 > num_nodes || n1 > num_nodes || n2 > num_nodes )
+        {
+            continue;
+        }
 
         //==== Compute Normal ====//
         vec3d p10 = pVec[n1 - 1] - pVec[n0 - 1];
@@ -544,8 +761,6 @@ int MeshGeom::ReadNascart( const char* file_name )
         tMesh->AddTri( pVec[n0 - 1], pVec[n1 - 1], pVec[n2 - 1], norm );
     }
 
-    fclose( file_id );
-
     if ( tMesh->m_TVec.size() == 0 )
     {
         delete tMesh;
@@ -564,37 +779,37 @@ int MeshGeom::ReadNascart( const char* file_name )
 //==== Read Tri File ====//
 int MeshGeom::ReadTriFile( const char * file_name )
 {
-    int i;
-    FILE* file_id = fopen( file_name, "r" );
-
-    if ( !file_id )
+    vector< float > coord_vec;
+    vector< int > ind_vec;
+    if ( !ReadIndexedMesh( file_name, 3, coord_vec, ind_vec ) )
     {
         return 0;
     }
 
-    TMesh*  tMesh = new TMesh();
-
-    //==== Read Number Tris and Nodes ====//
-    float x, y, z;
-    int n0, n1, n2;
-    unsigned int num_tris, num_nodes;
-
-    fscanf( file_id, "%u", &num_nodes );
-    fscanf( file_id, "%u", &num_tris  );
+    int num_nodes = ( int )coord_vec.size() / 3;
+    int num_tris = ( int )ind_vec.size() / 3;
 
-    vec3d p;
-    vector< vec3d > pVec;
-    pVec.resize( num_nodes );
-    for ( i = 0 ; i < num_nodes ; i++ )
+    vector< vec3d > pVec( num_nodes );
+    for ( int i = 0 ; i < num_nodes ; i++ )
     {
-        fscanf( file_id, "%f %f %f", &x, &y, &z );
-        p.set_xyz( x, y, z );
-        pVec[i] = p;
+        pVec[i].set_xyz( coord_vec[3 * i], coord_vec[3 * i + 1], coord_vec[3 * i + 2] );
     }
+    vector< float >().swap( coord_vec );
 
-    for ( i = 0 ; i < num_tris ; i++ )
+    TMesh*  tMesh = new TMesh();
+    tMesh->m_TVec.reserve( num_tris );
+    tMesh->m_NVec.reserve( 3 * num_tris );
+
+    for ( int i = 0 ; i < num_tris ; i++ )
     {
-        fscanf( file_id, "%d %d %d", &n0, &n1, &n2 );
+        int n0 = ind_vec[3 * i];
+        int n1 = ind_vec[3 * i + 1];
+        int n2 = ind_vec[3 * i + 2];
+
+        if ( n0 < 1 || n1 < 1 || n2 < 1 || n0 > num_nodes || n1 > num_nodes || n2 > num_nodes )
+        {
+            continue;
+        }
 
         //==== Compute Normal ====//
         vec3d p10 = pVec[n1 - 1] - pVec[n0 - 1];
@@ -606,8 +821,6 @@ int MeshGeom::ReadTriFile( const char * file_name )
         tMesh->AddTri( pVec[n0 - 1], pVec[n1 - 1], pVec[n2 - 1], norm );
     }
 
-    fclose( file_id );
-
     if ( tMesh->m_TVec.size() == 0 )
     {
         delete tMesh;
@@ -720,8 +933,8 @@ void MeshGeom::BuildIndexedMesh( int partOffset )
     BndBox bb = m_Vehicle->GetBndBox();
     double tol = bb.GetLargestDist() * 1.0e-10;
 
-    //==== Use NanoFlann to Find Close Points and Group ====//
-    IndexPntNodes( pnCloud, tol );
+    //==== Group Close Points On A Voxel Grid ====//
+    HashPntNodes( pnCloud, tol );
 
     //==== Load Used Nodes ====//
     m_IndexedNodeVec.reserve( pnCloud.m_NumUsedPts );
@@ -765,53 +978,23 @@ void MeshGeom::BuildIndexedMesh( int partOffset )
 
 void MeshGeom::WriteNascartPnts( FILE* fp )
 {
-    vec3d v;
     Matrix4d XFormMat = GetTotalTransMat();
     //==== Write Out Nodes ====//
-    for ( int i = 0 ; i < ( int )m_IndexedNodeVec.size() ; i++ )
-    {
-        TNode* tnode = m_IndexedNodeVec[i];
-        // Apply Transformations
-        if( tnode )
-        {
-            v = XFormMat.xform( tnode->m_Pnt );
-            fprintf( fp, "%16.10g %16.10g %16.10g\n", v.x(), v.z(), -v.y() );
-        }
-    }
+    WriteChunked( fp, ( int )m_IndexedNodeVec.size(), IndexedPntFormatter( m_IndexedNodeVec, XFormMat, IndexedPntFormatter::NASCART ) );
 }
 
 void MeshGeom::WriteCart3DPnts( FILE* fp )
 {
     //==== Write Out Nodes ====//
-    vec3d v;
     Matrix4d XFormMat = GetTotalTransMat();
-    for ( int i = 0 ; i < ( int )m_IndexedNodeVec.size() ; i++ )
-    {
-        TNode* tnode = m_IndexedNodeVec[i];
-        // Apply Transformations
-        if( tnode )
-        {
-            v = XFormMat.xform( tnode->m_Pnt );
-            fprintf( fp, "%16.10g %16.10g %16.10g\n", v.x(), v.y(),  v.z() );
-        }
-    }
+    WriteChunked( fp, ( int )m_IndexedNodeVec.size(), IndexedPntFormatter( m_IndexedNodeVec, XFormMat, IndexedPntFormatter::CART3D ) );
 }
 
 void MeshGeom::WriteOBJPnts( FILE* fp )
 {
     //==== Write Out Nodes ====//
-    vec3d v;
     Matrix4d XFormMat = GetTotalTransMat();
-    for ( int i = 0 ; i < ( int )m_IndexedNodeVec.size() ; i++ )
-    {
-        TNode* tnode = m_IndexedNodeVec[i];
-        // Apply Transformations
-        if( tnode )
-        {
-            v = XFormMat.xform( tnode->m_Pnt );
-            fprintf( fp, "v %16.10g %16.10g %16.10g\n", v.x(), v.y(),  v.z() );
-        }
-    }
+    WriteChunked( fp, ( int )m_IndexedNodeVec.size(), IndexedPntFormatter( m_IndexedNodeVec, XFormMat, IndexedPntFormatter::OBJ ) );
 }
 
 int MeshGeom::WriteGMshNodes( FILE* fp, int node_offset )
@@ -849,15 +1032,7 @@ void MeshGeom::WriteFacetNodes( FILE* fp )
 int MeshGeom::WriteNascartTris( FILE* fp, int off )
 {
     //==== Write Out Tris ====//
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
-    {
-        TTri* ttri = m_IndexedTriVec[t];
-        if( ttri )
-        {
-            fprintf( fp, "%d %d %d %d.0\n", ttri->m_N0->m_ID + 1 + off,  ttri->m_N2->m_ID + 1 + off,
-                     ttri->m_N1->m_ID + 1 + off, SubSurfaceMgr.GetTag( ttri->m_Tags ) );
-        }
-    }
+    WriteChunked( fp, ( int )m_IndexedTriVec.size(), IndexedTriFormatter( m_IndexedTriVec, off, IndexedTriFormatter::NASCART ) );
 
     return ( off + m_IndexedNodeVec.size() );
 }
@@ -865,14 +1040,7 @@ int MeshGeom::WriteNascartTris( FILE* fp, int off )
 int MeshGeom::WriteCart3DTris( FILE* fp, int off )
 {
     //==== Write Out Tris ====//
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
-    {
-        TTri* ttri = m_IndexedTriVec[t];
-        if( ttri )
-        {
-            fprintf( fp, "%d %d %d\n", ttri->m_N0->m_ID + 1 + off,  ttri->m_N1->m_ID + 1 + off, ttri->m_N2->m_ID + 1 + off );
-        }
-    }
+    WriteChunked( fp, ( int )m_IndexedTriVec.size(), IndexedTriFormatter( m_IndexedTriVec, off, IndexedTriFormatter::CART3D ) );
 
     return ( off + m_IndexedNodeVec.size() );
 }
@@ -880,14 +1048,7 @@ int MeshGeom::WriteCart3DTris( FILE* fp, int off )
 int MeshGeom::WriteOBJTris( FILE* fp, int off )
 {
     //==== Write Out Tris ====//
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
-    {
-        TTri* ttri = m_IndexedTriVec[t];
-        if( ttri )
-        {
-            fprintf( fp, "f %d %d %d\n", ttri->m_N0->m_ID + 1 + off,  ttri->m_N1->m_ID + 1 + off, ttri->m_N2->m_ID + 1 + off );
-        }
-    }
+    WriteChunked( fp, ( int )m_IndexedTriVec.size(), IndexedTriFormatter( m_IndexedTriVec, off, IndexedTriFormatter::OBJ ) );
 
     return ( off + m_IndexedNodeVec.size() );
 }
@@ -999,13 +1160,7 @@ int MeshGeom::WriteNascartParts( FILE* fp, int off )
 int MeshGeom::WriteCart3DParts( FILE* fp  )
 {
     //==== Write Component IDs for each Tri =====//
-    int tag;
-    for ( int t = 0 ; t < ( int )m_IndexedTriVec.size() ; t++ )
-    {
-        tag = SubSurfaceMgr.GetTag( m_IndexedTriVec[t]->m_Tags );
-
-        fprintf( fp, "%d \n",  tag );
-    }
+    WriteChunked( fp, ( int )m_IndexedTriVec.size(), IndexedTriFormatter( m_IndexedTriVec, 0, IndexedTriFormatter::CART3D_PART ) );
     return 0;
 }
 
@@ -1162,7 +1317,6 @@ void MeshGeom::UpdateDrawObj()
 
 
     Matrix4d trans = GetTotalTransMat();
-    vec3d zeroV = m_ModelMatrix.xform( vec3d( 0.0, 0.0, 0.0 ) );
 
     if ( m_ViewMeshFlag.Get() )
     {
@@ -1180,7 +1334,7 @@ void MeshGeom::UpdateDrawObj()
                     m_WireShadeDrawObj_vec[m].m_PntVec[pi] = trans.xform( tris[t]->m_N0->m_Pnt );
                     m_WireShadeDrawObj_vec[m].m_PntVec[pi + 1] = trans.xform( tris[t]->m_N1->m_Pnt );
                     m_WireShadeDrawObj_vec[m].m_PntVec[pi + 2] = trans.xform( tris[t]->m_N2->m_Pnt );
-                    vec3d norm =  m_ModelMatrix.xform( tris[t]->m_Norm ) - zeroV;
+                    vec3d norm =  m_ModelMatrix.xformnorm( tris[t]->m_Norm );
                     m_WireShadeDrawObj_vec[m].m_NormVec[pi] = norm;
                     m_WireShadeDrawObj_vec[m].m_NormVec[pi + 1] = norm;
                     m_WireShadeDrawObj_vec[m].m_NormVec[pi + 2] = norm;
@@ -1204,7 +1358,7 @@ void MeshGeom::UpdateDrawObj()
                     m_WireShadeDrawObj_vec[m + add_ind].m_PntVec[pi] = trans.xform( tris[t]->m_N0->m_Pnt );
                     m_WireShadeDrawObj_vec[m + add_ind].m_PntVec[pi + 1] = trans.xform( tris[t]->m_N1->m_Pnt );
                     m_WireShadeDrawObj_vec[m + add_ind].m_PntVec[pi + 2] = trans.xform( tris[t]->m_N2->m_Pnt );
-                    vec3d norm =  m_ModelMatrix.xform( tris[t]->m_Norm ) - zeroV;
+                    vec3d norm =  m_ModelMatrix.xformnorm( tris[t]->m_Norm );
                     m_WireShadeDrawObj_vec[m + add_ind].m_NormVec[pi] = norm;
                     m_WireShadeDrawObj_vec[m + add_ind].m_NormVec[pi + 1] = norm;
                     m_WireShadeDrawObj_vec[m + add_ind].m_NormVec[pi + 2] = norm;
@@ -1218,30 +1372,74 @@ void MeshGeom::UpdateDrawObj()
         {
             // make map from tag to wire draw obj
 
-            map<int, DrawObj*> tag_dobj_map;
+            map< int, int > tag_slot_map;
             map< std::vector<int>, int >::const_iterator mit;
             map< std::vector<int>, int > tagMap = SubSurfaceMgr.GetSingleTagMap();
             int cnt = 0;
-            for ( mit = tagMap.begin(); mit != tagMap.end() ; ++mit )
+            for ( mit = tagMap.begin(); mit != tagMap.end() && cnt < ( int )m_WireShadeDrawObj_vec.size() ; ++mit )
             {
-                tag_dobj_map[ mit->second ] = &m_WireShadeDrawObj_vec[cnt];
+                tag_slot_map[ mit->second ] = cnt;
                 cnt++;
             }
 
+            //==== Sort Tris Into Tag Slots, Then Fill Each DrawObj In One Pass ====//
+            // Tris come in runs with the same tags, so the tag lookup is only
+            // repeated when the tags change.
+            vector< int > slot_count( m_WireShadeDrawObj_vec.size(), 0 );
+            vector< vector< int > > tri_slot_vec( m_TMeshVec.size() );
+            for ( int m = 0 ; m < ( int )m_TMeshVec.size() ; m++ )
+            {
+                vector<TTri*>& tris = m_TMeshVec[m]->m_TVec;
+                tri_slot_vec[m].resize( tris.size(), -1 );
+
+                const vector< int > * last_tags = NULL;
+                int last_slot = -1;
+                for ( int t = 0 ; t < ( int ) tris.size() ; t++ )
+                {
+                    if ( !last_tags || *last_tags != tris[t]->m_Tags )
+                    {
+                        map< int, int >::const_iterator sit = tag_slot_map.find( SubSurfaceMgr.GetTag( tris[t]->m_Tags ) );
+                        last_slot = ( sit != tag_slot_map.end() ) ? sit->second : -1;
+                        last_tags = &tris[t]->m_Tags;
+                    }
+
+                    tri_slot_vec[m][t] = last_slot;
+                    if ( last_slot >= 0 )
+                    {
+                        slot_count[ last_slot ]++;
+                    }
+                }
+            }
+
+            for ( int i = 0 ; i < ( int )m_WireShadeDrawObj_vec.size() ; i++ )
+            {
+                m_WireShadeDrawObj_vec[i].m_PntVec.resize( slot_count[i] * 3 );
+                m_WireShadeDrawObj_vec[i].m_NormVec.resize( slot_count[i] * 3 );
+            }
+
+            vector< int > slot_pi( m_WireShadeDrawObj_vec.size(), 0 );
             for ( int m = 0 ; m < ( int )m_TMeshVec.size() ; m++ )
             {
                 int num_tris = m_TMeshVec[m]->m_TVec.size();
                 vector<TTri*>& tris = m_TMeshVec[m]->m_TVec;
                 for ( int t = 0 ; t < ( int ) num_tris ; t++ )
                 {
-                    DrawObj* d_obj = tag_dobj_map[ SubSurfaceMgr.GetTag( tris[t]->m_Tags ) ];
-                    d_obj->m_PntVec.push_back( trans.xform( tris[t]->m_N0->m_Pnt ) );
-                    d_obj->m_PntVec.push_back( trans.xform( tris[t]->m_N1->m_Pnt ) );
-                    d_obj->m_PntVec.push_back( trans.xform( tris[t]->m_N2->m_Pnt ) );
-                    vec3d norm =  m_ModelMatrix.xform( tris[t]->m_Norm ) - zeroV;
-                    d_obj->m_NormVec.push_back( norm );
-                    d_obj->m_NormVec.push_back( norm );
-                    d_obj->m_NormVec.push_back( norm );
+                    int slot = tri_slot_vec[m][t];
+                    if ( slot < 0 )
+                    {
+                        continue;
+                    }
+
+                    DrawObj* d_obj = &m_WireShadeDrawObj_vec[ slot ];
+                    int pi = slot_pi[ slot ];
+                    d_obj->m_PntVec[pi] = trans.xform( tris[t]->m_N0->m_Pnt );
+                    d_obj->m_PntVec[pi + 1] = trans.xform( tris[t]->m_N1->m_Pnt );
+                    d_obj->m_PntVec[pi + 2] = trans.xform( tris[t]->m_N2->m_Pnt );
+                    vec3d norm =  m_ModelMatrix.xformnorm( tris[t]->m_Norm );
+                    d_obj->m_NormVec[pi] = norm;
+                    d_obj->m_NormVec[pi + 1] = norm;
+                    d_obj->m_NormVec[pi + 2] = norm;
+                    slot_pi[ slot ] = pi + 3;
                 }
             }
         }
@@ -1273,7 +1471,7 @@ void MeshGeom::UpdateDrawObj()
                 m_WireShadeDrawObj_vec[draw_ind].m_PntVec[pi] = trans.xform( tris[t]->m_N0->m_Pnt );
                 m_WireShadeDrawObj_vec[draw_ind].m_PntVec[pi + 1] = trans.xform( tris[t]->m_N1->m_Pnt );
                 m_WireShadeDrawObj_vec[draw_ind].m_PntVec[pi + 2] = trans.xform( tris[t]->m_N2->m_Pnt );
-                vec3d norm =  m_ModelMatrix.xform( tris[t]->m_Norm ) - zeroV;
+                vec3d norm =  m_ModelMatrix.xformnorm( tris[t]->m_Norm );
                 m_WireShadeDrawObj_vec[draw_ind].m_NormVec[pi] = norm;
                 m_WireShadeDrawObj_vec[draw_ind].m_NormVec[pi + 1] = norm;
                 m_WireShadeDrawObj_vec[draw_ind].m_NormVec[pi + 2] = norm;
@@ -1299,6 +1497,28 @@ void MeshGeom::UpdateDrawObj()
     }
 }
 
+void MeshGeom::AddMemoryUsage( GeomMemUsage & usage )
+{
+    Geom::AddMemoryUsage( usage );
+
+    int i;
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        usage.m_Mesh += m_TMeshVec[i]->MemoryUsage();
+    }
+    for ( i = 0 ; i < ( int )m_SliceVec.size() ; i++ )
+    {
+        usage.m_Mesh += m_SliceVec[i]->MemoryUsage();
+    }
+    for ( i = 0 ; i < ( int )m_SubSurfVec.size() ; i++ )
+    {
+        usage.m_SubSurf += m_SubSurfVec[i]->MemoryUsage();
+    }
+
+    usage.m_Mesh += vector_mem_bytes( m_IndexedTriVec ) + vector_mem_bytes( m_IndexedNodeVec );
+    usage.m_Mesh += vector_mem_bytes( m_PolyVec ) + m_PointMassVec.size() * sizeof( TetraMassProp );
+}
+
 void MeshGeom::LoadDrawObjs( vector< DrawObj* > & draw_obj_vec )
 {
     int num_uniq_tags = SubSurfaceMgr.GetNumTags();
@@ -1564,38 +1784,28 @@ void MeshGeom::ApplyScale()
 
 void MeshGeom::TransformMeshVec( vector<TMesh*> & meshVec, Matrix4d & TransMat )
 {
-    // Build Map of nodes
-    map< TNode*, int > nodeMap;
+    // Gather each node once, sorted so duplicates are adjacent
+    vector< TNode* > node_vec;
     for ( int i = 0 ; i < ( int )meshVec.size() ; i++ )
     {
-        for ( int j = 0 ; j < ( int )meshVec[i]->m_NVec.size() ; j++ )
-        {
-            TNode* n = meshVec[i]->m_NVec[j];
-            nodeMap[n] = 1;
-        }
+        node_vec.insert( node_vec.end(), meshVec[i]->m_NVec.begin(), meshVec[i]->m_NVec.end() );
+
         //==== Split Tris ====//
         for ( int j = 0 ; j < ( int )meshVec[i]->m_TVec.size() ; j++ )
         {
             TTri* t = meshVec[i]->m_TVec[j];
-            for ( int k = 0 ; k < ( int )t->m_NVec.size() ; k++ )
-            {
-                TNode* n = t->m_NVec[k];
-                nodeMap[n] = 1;
-            }
+            node_vec.insert( node_vec.end(), t->m_NVec.begin(), t->m_NVec.end() );
         }
     }
+    sort( node_vec.begin(), node_vec.end() );
+    node_vec.erase( unique( node_vec.begin(), node_vec.end() ), node_vec.end() );
 
     // Apply Transformation to Nodes
-    map<TNode*, int >::const_iterator iter;
-    for ( iter = nodeMap.begin() ; iter != nodeMap.end() ; ++iter )
+    for ( int i = 0 ; i < ( int )node_vec.size() ; i++ )
     {
-        TNode* n = iter->first;
-        n->m_Pnt = TransMat.xform( n->m_Pnt );
+        node_vec[i]->m_Pnt = TransMat.xform( node_vec[i]->m_Pnt );
     }
 
-    vec3d zeroV = vec3d( 0.0, 0.0, 0.0 );
-    zeroV = TransMat.xform( zeroV );
-
     // Apply Transformation to each triangle's normal vector
     for ( int i = 0 ; i < ( int )meshVec.size() ; i ++ )
     {
@@ -1606,13 +1816,13 @@ void MeshGeom::TransformMeshVec( vector<TMesh*> & meshVec, Matrix4d & TransMat )
                 for ( int t = 0 ; t < ( int ) meshVec[i]->m_TVec[j]->m_SplitVec.size() ; t++ )
                 {
                     TTri* tri = meshVec[i]->m_TVec[j]->m_SplitVec[t];
-                    tri->m_Norm = TransMat.xform( tri->m_Norm ) - zeroV;
+                    tri->m_Norm = TransMat.xformnorm( tri->m_Norm );
                 }
             }
             else
             {
                 TTri* tri = meshVec[i]->m_TVec[j];
-                tri->m_Norm = TransMat.xform( tri->m_Norm ) - zeroV;
+                tri->m_Norm = TransMat.xformnorm( tri->m_Norm );
             }
         }
 
@@ -1621,8 +1831,10 @@ void MeshGeom::TransformMeshVec( vector<TMesh*> & meshVec, Matrix4d & TransMat )
     }
 }
 
-void MeshGeom::IntersectTrim( int halfFlag, int intSubsFlag )
+void MeshGeom::IntersectTrim( int halfFlag, int intSubsFlag, bool symmFlag )
 {
+    PERF_SCOPE( "MeshGeom::IntersectTrim" );
+
     int i, j;
 
     //FILE* fid = fopen(txtfn.c_str(), "w");
@@ -1640,6 +1852,7 @@ void MeshGeom::IntersectTrim( int halfFlag, int intSubsFlag )
             numTris += m_TMeshVec[i]->m_TVec.size();
         }
     }
+    PERF_COUNT( "MeshGeom::IntersectTrim_InputTris", numTris );
 
     //==== Count Components ====//
     vector< string > compIdVec;
@@ -1681,6 +1894,8 @@ void MeshGeom::IntersectTrim( int halfFlag, int intSubsFlag )
     //==== Intersect Subsurfaces to make clean lines ====//
     if ( intSubsFlag )
     {
+        PERF_SCOPE( "MeshGeom::IntersectSubSurfs" );
+
         for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
         {
             vector< TMesh* > sub_surf_meshes;
@@ -1734,6 +1949,23 @@ void MeshGeom::IntersectTrim( int halfFlag, int intSubsFlag )
 
     MergeRemoveOpenMeshes( &info );
 
+    //==== Models Symmetric About Y=0 Are Trimmed On The +Y Half And Mirrored ====//
+    vector< int > partnerVec;
+    bool symm = false;
+    if ( !halfFlag && symmFlag && FindXZMirrorPartners( partnerVec ) )
+    {
+        symm = true;
+        AddHalfBox();
+    }
+    res->Add( NameValData( "XZ_Symmetry_Used", ( int )symm ) );
+
+    vector< TMesh* > fullMeshVec = m_TMeshVec;
+    vector< bool > asideVec( m_TMeshVec.size(), false );
+    if ( halfFlag || symm )
+    {
+        SetAsideNegYMeshes( asideVec, !symm );
+    }
+
 
     //==== Create Bnd Box for  Mesh Geoms ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
@@ -1751,35 +1983,52 @@ void MeshGeom::IntersectTrim( int halfFlag, int intSubsFlag )
     //update_xformed_bbox();            // Load Xform BBox
 
     //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
+        PERF_SCOPE( "MeshGeom::IntersectTMeshPairs" );
+
+        if ( m_Vehicle && m_Vehicle->m_CompGeomIncremental() )
         {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
+            IntersectTMeshPairs( &m_Vehicle->m_CompGeomCache );
+        }
+        else
+        {
+            IntersectTMeshPairs();
         }
     }
 
     //==== Split Intersected Tri in Mesh ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
-        m_TMeshVec[i]->Split();
+        PERF_SCOPE( "MeshGeom::SplitTris" );
+
+        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+        {
+            m_TMeshVec[i]->Split();
+        }
+    }
+
+    //==== Determine Which Triangle Are Interior/Exterior ====//
+    {
+        PERF_SCOPE( "MeshGeom::DeterIntExt" );
+
+        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+        {
+            m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
+        }
     }
 
-    //==== Determine Which Triangle Are Interior/Exterior ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
-    }
+    m_TMeshVec = fullMeshVec;
 
-    if ( halfFlag )
+    if ( halfFlag || symm )
     {
         //==== Remove Half Mesh Box ===//
         vector< TMesh* > tempVec;
+        vector< bool > tempAsideVec;
         for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
         {
             if ( !m_TMeshVec[i]->m_HalfBoxFlag )
             {
                 tempVec.push_back( m_TMeshVec[i] );
+                tempAsideVec.push_back( asideVec[i] );
             }
             else
             {
@@ -1787,6 +2036,7 @@ void MeshGeom::IntersectTrim( int halfFlag, int intSubsFlag )
             }
         }
         m_TMeshVec = tempVec;
+        asideVec = tempAsideVec;
     }
 
 
@@ -1795,13 +2045,25 @@ void MeshGeom::IntersectTrim( int halfFlag, int intSubsFlag )
     ApplyScale();
     UpdateBBox();
 
+    if ( symm )
+    {
+        PERF_SCOPE( "MeshGeom::MirrorXZHalf" );
+        MirrorXZHalf( partnerVec, asideVec );
+    }
+
     //==== Compute Areas ====//
+    PERF_SCOPE( "MeshGeom::AreasVolumes" );
+
     m_TotalTheoArea = m_TotalWetArea = 0.0;
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
         if ( !m_TMeshVec[i]->m_HalfBoxFlag )
         {
-            m_TotalTheoArea += m_TMeshVec[i]->ComputeTheoArea();
+            if ( !symm )    // Mirrored meshes no longer hold their untrimmed tris
+            {
+                m_TMeshVec[i]->ComputeTheoArea();
+            }
+            m_TotalTheoArea += m_TMeshVec[i]->m_TheoArea;
             m_TotalWetArea  += m_TMeshVec[i]->ComputeWetArea();
         }
     }
@@ -1812,7 +2074,11 @@ void MeshGeom::IntersectTrim( int halfFlag, int intSubsFlag )
     {
         if ( !m_TMeshVec[i]->m_HalfBoxFlag )
         {
-            m_TotalTheoVol += m_TMeshVec[i]->ComputeTheoVol();
+            if ( !symm )
+            {
+                m_TMeshVec[i]->ComputeTheoVol();
+            }
+            m_TotalTheoVol += m_TMeshVec[i]->m_TheoVol;
         }
     }
 
@@ -2042,13 +2308,7 @@ void MeshGeom::degenGeomIntersectTrim( vector< DegenGeom > &degenGeom )
     //update_xformed_bbox();          // Load Xform BBox
 
     //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
+    IntersectTMeshPairs();
 
     //==== Split Intersected Tri in Mesh ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
@@ -2182,20 +2442,38 @@ void MeshGeom::degenGeomIntersectTrim( vector< DegenGeom > &degenGeom )
 void MeshGeom::AreaSlice( int numSlices , vec3d norm_axis,
                           bool autoBounds, double start, double end )
 {
-    int tesselate = 0; // WARNING: Always false
-    int i, j, s;
+    AreaSliceRequest req;
+    req.m_NumSlices = numSlices;
+    req.m_Axis = norm_axis;
+    req.m_AutoBounds = autoBounds;
+    req.m_Start = start;
+    req.m_End = end;
+
+    vector< string > res_id_vec = AreaSliceBatch( vector< AreaSliceRequest >( 1, req ) );
+    if ( res_id_vec.size() )
+    {
+        Results* res = ResultsMgr.FindResultsPtr( res_id_vec[0] );
+        if ( res )
+        {
+            string filename = m_Vehicle->getExportFileName( vsp::SLICE_TXT_TYPE );
+            res->WriteSliceFile( filename );
+        }
+    }
+}
 
-    //==== Transform mesh geoms to align with cutting plane normal vector ====//
+//==== Find Orthonormal Slice Frame With norm_axis As The First Axis ====//
+static bool AreaSliceFrame( vec3d & norm_axis, vec3d & pnt, vec3d & tvec )
+{
     // Make sure the norm is not (0,0,0)
     if ( norm_axis.mag() == 0 )
     {
-        return;
+        return false;
     }
     // Make sure norm is normalized
     norm_axis.normalize();
 
     // Find a point on the plane containing (0,0,0) with the norm normal vector
-    vec3d pnt;
+    pnt = vec3d();
     if ( norm_axis.x() != 0 )
     {
         pnt[1] = 1;
@@ -2216,48 +2494,61 @@ void MeshGeom::AreaSlice( int numSlices , vec3d norm_axis,
     }
     else
     {
-        return;
+        return false;
     }
 
     pnt.normalize();
-    vec3d tvec = cross( norm_axis, pnt );
+    tvec = cross( norm_axis, pnt );
     tvec.normalize();
-    Matrix4d transMat;
-    double tempMat[16];
-    tempMat[0] = norm_axis.x();
-    tempMat[4] = norm_axis.y();
-    tempMat[8] = norm_axis.z();
-    tempMat[12] = 0;
-    tempMat[1] = pnt.x();
-    tempMat[5] = pnt.y();
-    tempMat[9] = pnt.z();
-    tempMat[13] = 0;
-    tempMat[2] = tvec.x();
-    tempMat[6] = tvec.y();
-    tempMat[10] = tvec.z();
-    tempMat[14] = 0;
-    tempMat[3] = 0;
-    tempMat[7] = 0;
-    tempMat[11] = 0;
-    tempMat[15] = 1;
-
-    Matrix4d TransMat;
-    TransMat.initMat( tempMat );
-
-    TransformMeshVec( m_TMeshVec, TransMat );
+    return true;
+}
+
+//==== Bounding Box Of Mesh Nodes In Slice Frame Coordinates ====//
+static BndBox AreaSliceFrameBox( vector< TMesh* > & tmesh_vec, const vec3d & e0, const vec3d & e1, const vec3d & e2 )
+{
+    BndBox box;
+    for ( int m = 0 ; m < ( int )tmesh_vec.size() ; m++ )
+    {
+        vector< TTri* > & tri_vec = tmesh_vec[m]->m_TVec;
+        int num_tris = ( int )tri_vec.size();
+
+        #pragma omp parallel
+        {
+            BndBox local_box;
+
+            #pragma omp for nowait
+            for ( int t = 0 ; t < num_tris ; t++ )
+            {
+                for ( int k = 0 ; k < 3 ; k++ )
+                {
+                    const vec3d & p = tri_vec[t]->GetTriNode( k )->m_Pnt;
+                    local_box.Update( vec3d( dot( e0, p ), dot( e1, p ), dot( e2, p ) ) );
+                }
+            }
+
+            #pragma omp critical
+            {
+                box.Update( local_box );
+            }
+        }
+    }
+    return box;
+}
+
+//==== Slice The Mesh With Several Sets Of Planes At Once ====//
+// The open mesh merge and the mesh bounding boxes are set up once for the whole batch and the
+// meshes are left in place - each slice plane is built along its own axis in the mesh frame.
+// All slice planes of all requests are then intersected and classified in parallel.  One
+// "Slice" result is created per valid request and the result IDs are returned in request order.
+vector< string > MeshGeom::AreaSliceBatch( const vector< AreaSliceRequest > & req_vec )
+{
+    int i, s, r;
+    vector< string > res_id_vec;
 
     //==== Check For Open Meshes and Merge or Delete Them ====//
     MeshInfo info;
     MergeRemoveOpenMeshes( &info );
 
-    //==== Create Results ====//
-    Results* res = ResultsMgr.CreateResults( "Slice" );
-    res->Add( NameValData( "Num_Degen_Triangles_Removed", info.m_NumDegenerateTriDeleted ) );
-    res->Add( NameValData( "Num_Open_Meshes_Removed", info.m_NumOpenMeshedDeleted ) );
-    res->Add( NameValData( "Num_Open_Meshes_Merged", info.m_NumOpenMeshesMerged ) );
-    res->Add( NameValData( "Mesh_GeomID", this->GetID() ) );
-
-
     //==== Count Tris ====//
     int numTris = 0;
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
@@ -2280,12 +2571,7 @@ void MeshGeom::AreaSlice( int numSlices , vec3d norm_axis,
         }
     }
 
-    res->Add( NameValData( "Num_Comps", ( int )compIdVec.size() ) );
-    res->Add( NameValData( "Num_Meshes", ( int )m_TMeshVec.size() ) );
-    res->Add( NameValData( "Num_Tris", numTris ) );
-    res->Add( NameValData( "Axis_Vector", norm_axis ) );
-
-    //==== Create Bnd Box for  Mesh Geoms ====//
+    //==== Create Bnd Box for  Mesh Geoms - Shared By Every Slice ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
         m_TMeshVec[i]->LoadBndBox();
@@ -2298,89 +2584,84 @@ void MeshGeom::AreaSlice( int numSlices , vec3d norm_axis,
         b.Update( m_TMeshVec[i]->m_TBox.m_Box );
     }
     m_BBox = b;
-    //update_xformed_bbox();            // Load Xform BBox
 
-    double xMin;
-    double xMax;
-    if ( autoBounds )
-    {
-        xMin = m_BBox.GetMin( 0 ) - 0.0001;
-        xMax = m_BBox.GetMax( 0 ) + 0.0001;
-    }
-    else
+    //==== Build Slice Mesh Objects For Each Request =====//
+    vector< int > req_ind_vec;          // Valid requests
+    vector< vec3d > axis_vec;
+    vector< int > first_slice_vec;
+    vector< vector< double > > loc_vec_vec;
+
+    for ( r = 0 ; r < ( int )req_vec.size() ; r++ )
     {
-        xMin = start - 0.0001;
-        xMax = end + 0.0001;
-    }
+        const AreaSliceRequest & req = req_vec[r];
 
-    //==== Build Slice Mesh Object =====//
-    // MJW: Mandating 3 slices is a preference. 2 is just fine, and sometimes necessary.
-    //if ( numSlices < 3 )
-    //{
-        //numSlices = 3;
-    //}
+        vec3d norm_axis = req.m_Axis;
+        vec3d pnt, tvec;
+        if ( !AreaSliceFrame( norm_axis, pnt, tvec ) || req.m_NumSlices < 1 )
+        {
+            continue;
+        }
 
-    vec3d norm( 1, 0, 0 );
+        BndBox fbox = AreaSliceFrameBox( m_TMeshVec, norm_axis, pnt, tvec );
 
-    for ( s = 0 ; s < numSlices ; s++ )
-    {
-        TMesh* tm = new TMesh();
-        m_SliceVec.push_back( tm );
+        double xMin;
+        double xMax;
+        if ( req.m_AutoBounds )
+        {
+            xMin = fbox.GetMin( 0 ) - 0.0001;
+            xMax = fbox.GetMax( 0 ) + 0.0001;
+        }
+        else
+        {
+            xMin = req.m_Start - 0.0001;
+            xMax = req.m_End + 0.0001;
+        }
 
-        double x = xMin + ( ( double )s / ( double )( numSlices - 1 ) ) * ( xMax - xMin );
+        double ydel = 1.02 * ( fbox.GetMax( 1 ) - fbox.GetMin( 1 ) );
+        double ys   = fbox.GetMin( 1 ) - 0.01 * ydel;
+        double zdel = 1.02 * ( fbox.GetMax( 2 ) - fbox.GetMin( 2 ) );
+        double zs   = fbox.GetMin( 2 ) - 0.01 * zdel;
 
-        double ydel = 1.02 * ( m_BBox.GetMax( 1 ) - m_BBox.GetMin( 1 ) );
-        double ys   = m_BBox.GetMin( 1 ) - 0.01 * ydel;
-        double zdel = 1.02 * ( m_BBox.GetMax( 2 ) - m_BBox.GetMin( 2 ) );
-        double zs   = m_BBox.GetMin( 2 ) - 0.01 * zdel;
+        req_ind_vec.push_back( r );
+        axis_vec.push_back( norm_axis );
+        first_slice_vec.push_back( ( int )m_SliceVec.size() );
+        loc_vec_vec.push_back( vector< double >() );
 
-        if ( tesselate )
+        for ( s = 0 ; s < req.m_NumSlices ; s++ )
         {
-            for ( i = 0 ; i < 10 ; i++ )
+            double x = xMin;
+            if ( req.m_NumSlices > 1 )
             {
-                double y0 = ys + ydel * 0.1 * ( double )i;
-                double y1 = ys + ydel * 0.1 * ( double )( i + 1 );
+                x = xMin + ( ( double )s / ( double )( req.m_NumSlices - 1 ) ) * ( xMax - xMin );
+            }
+            loc_vec_vec.back().push_back( x );
 
-                for ( j = 0 ; j < 10 ; j++ )
-                {
-                    double z0 = zs + zdel * 0.1 * ( double )j;
-                    double z1 = zs + zdel * 0.1 * ( double )( j + 1 );
+            //==== Plane Corners In Mesh Coordinates ====//
+            vec3d c0 = norm_axis * x + pnt * ys + tvec * zs;
+            vec3d c1 = norm_axis * x + pnt * ( ys + ydel ) + tvec * zs;
+            vec3d c2 = norm_axis * x + pnt * ( ys + ydel ) + tvec * ( zs + zdel );
+            vec3d c3 = norm_axis * x + pnt * ys + tvec * ( zs + zdel );
 
-                    tm->AddTri( vec3d( x, y0, z0 ), vec3d( x, y1, z0 ), vec3d( x, y1, z1 ), norm );
-                    tm->AddTri( vec3d( x, y0, z0 ), vec3d( x, y1, z1 ), vec3d( x, y0, z1 ), norm );
-                }
-            }
-        }
-        else
-        {
-            tm->AddTri( vec3d( x, ys, zs ), vec3d( x, ys + ydel, zs ), vec3d( x, ys + ydel, zs + zdel ), norm );
-            tm->AddTri( vec3d( x, ys, zs ), vec3d( x, ys + ydel, zs + zdel ), vec3d( x, ys, zs + zdel ), norm );
+            TMesh* tm = new TMesh();
+            m_SliceVec.push_back( tm );
+            tm->AddTri( c0, c1, c2, norm_axis );
+            tm->AddTri( c0, c2, c3, norm_axis );
         }
     }
+    first_slice_vec.push_back( ( int )m_SliceVec.size() );
 
-    //==== Load Bnding Box ====//
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
+    //==== Slice Planes Are Independent - Process Them In Parallel ====//
+    int first_slice = first_slice_vec.size() ? first_slice_vec[0] : ( int )m_SliceVec.size();
+    int num_slice_mesh = ( int )m_SliceVec.size();
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( s = first_slice ; s < num_slice_mesh ; s++ )
     {
         TMesh* tm = m_SliceVec[s];
         tm->LoadBndBox();
 
         //==== Intersect All Mesh Geoms ====//
-        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-        {
-            tm->Intersect( m_TMeshVec[i] );
-
-            for ( j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
-            {
-                TTri* tri = m_TMeshVec[i]->m_TVec[j];
-                for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
-                {
-                    delete tri->m_ISectEdgeVec[e]->m_N0;
-                    delete tri->m_ISectEdgeVec[e]->m_N1;
-                    delete tri->m_ISectEdgeVec[e];
-                }
-                tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
-            }
-        }
+        IntersectSliceTMesh( tm );
 
         //==== Split Intersected Tri in Mesh ====//
         tm->Split();
@@ -2389,14 +2670,14 @@ void MeshGeom::AreaSlice( int numSlices , vec3d norm_axis,
         tm->DeterIntExt( m_TMeshVec );
 
         //==== Flip Int/Ext Flags ====//
-        for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
+        for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
         {
-            TTri* tri = tm->m_TVec[i];
+            TTri* tri = tm->m_TVec[t];
             if ( tri->m_SplitVec.size() )
             {
-                for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
+                for ( int k = 0 ; k < ( int )tri->m_SplitVec.size() ; k++ )
                 {
-                    tri->m_SplitVec[j]->m_InteriorFlag = !( tri->m_SplitVec[j]->m_InteriorFlag );
+                    tri->m_SplitVec[k]->m_InteriorFlag = !( tri->m_SplitVec[k]->m_InteriorFlag );
                 }
             }
             else
@@ -2404,32 +2685,40 @@ void MeshGeom::AreaSlice( int numSlices , vec3d norm_axis,
                 tri->m_InteriorFlag = !( tri->m_InteriorFlag );
             }
         }
-    }
 
-    TransMat.affineInverse();
+        tm->ComputeWetArea();
+    }
 
-    vector< double > loc_vec;
-    vector< double > area_vec;
-    vector < vec3d > AreaCenter;
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
+    //==== Create Results ====//
+    for ( r = 0 ; r < ( int )req_ind_vec.size() ; r++ )
     {
-        double x = xMin + ( ( double )s / ( double )( numSlices - 1 ) ) * ( xMax - xMin );
-        m_SliceVec[s]->ComputeWetArea();
-        loc_vec.push_back( x );
-        area_vec.push_back( m_SliceVec[s]->m_WetArea );
-        AreaCenter.push_back( TransMat.xform( m_SliceVec[s]->m_AreaCenter ) );
-    }
-    res->Add( NameValData( "Slice_Area_Center", AreaCenter ) );
-    res->Add( NameValData( "Num_Slices", ( int )m_SliceVec.size() ) );
-    res->Add( NameValData( "Slice_Loc", loc_vec ) );
-    res->Add( NameValData( "Slice_Area", area_vec ) );
+        Results* res = ResultsMgr.CreateResults( "Slice" );
+        res->Add( NameValData( "Num_Degen_Triangles_Removed", info.m_NumDegenerateTriDeleted ) );
+        res->Add( NameValData( "Num_Open_Meshes_Removed", info.m_NumOpenMeshedDeleted ) );
+        res->Add( NameValData( "Num_Open_Meshes_Merged", info.m_NumOpenMeshesMerged ) );
+        res->Add( NameValData( "Mesh_GeomID", this->GetID() ) );
+
+        res->Add( NameValData( "Num_Comps", ( int )compIdVec.size() ) );
+        res->Add( NameValData( "Num_Meshes", ( int )m_TMeshVec.size() ) );
+        res->Add( NameValData( "Num_Tris", numTris ) );
+        res->Add( NameValData( "Axis_Vector", axis_vec[r] ) );
 
-    string filename = m_Vehicle->getExportFileName( vsp::SLICE_TXT_TYPE );
-    res->WriteSliceFile( filename );
+        vector< double > area_vec;
+        vector < vec3d > AreaCenter;
+        for ( s = first_slice_vec[r] ; s < first_slice_vec[r + 1] ; s++ )
+        {
+            area_vec.push_back( m_SliceVec[s]->m_WetArea );
+            AreaCenter.push_back( m_SliceVec[s]->m_AreaCenter );
+        }
+        res->Add( NameValData( "Slice_Area_Center", AreaCenter ) );
+        res->Add( NameValData( "Num_Slices", ( int )area_vec.size() ) );
+        res->Add( NameValData( "Slice_Loc", loc_vec_vec[r] ) );
+        res->Add( NameValData( "Slice_Area", area_vec ) );
+
+        res_id_vec.push_back( res->GetID() );
+    }
 
-    //==== TransForm Slices and Mesh to Match Orignal Coord Sys ====//
-    TransformMeshVec( m_SliceVec, TransMat );
-    TransformMeshVec( m_TMeshVec, TransMat );
+    return res_id_vec;
 }
 
 void MeshGeom::WaveStartEnd( const double &sliceAngle, const vec3d &center )
@@ -2439,6 +2728,8 @@ void MeshGeom::WaveStartEnd( const double &sliceAngle, const vec3d &center )
     double Mach = 1/sin( sliceAngle );
     double beta = sqrt( Mach*Mach - 1.0 );
 
+    //==== Theta Angles Are Independent ====//
+    #pragma omp parallel for
     for ( int itheta = 0; itheta < ntheta; itheta++ )
     {
         WaveDragMgr.m_StartX[itheta] = DBL_MAX;
@@ -2757,13 +3048,7 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
     }
 
     //==== Intersect All Mesh Geoms (before slicing) ====//
-    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( int j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
+    IntersectTMeshPairs();
 
     //==== Split Intersected Tri in Mesh ====//
     for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
@@ -2872,29 +3157,19 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
         tm->AddTri( gp[2], gp[0], gp[1], gpnorm );
     }
 
-    //==== Load Bnding Box ====//
-    for ( int islice = 0 ; islice < ( int )m_SliceVec.size() ; islice++ )
+    //==== Cone Slices For All Theta Are Independent - Process Them In Parallel ====//
+    // Every slice plane shares the m_TMeshVec bounding boxes built above, only its own two
+    // tri box is built per plane.
+    int numSliceMesh = ( int )m_SliceVec.size();
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int islice = 0 ; islice < numSliceMesh ; islice++ )
     {
         TMesh* tm = m_SliceVec[islice];
         tm->LoadBndBox();
 
         //==== Intersect All Mesh Geoms ====//
-        for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-        {
-            tm->Intersect( m_TMeshVec[i] );
-
-            for ( int j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
-            {
-                TTri* tri = m_TMeshVec[i]->m_TVec[j];
-                for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
-                {
-                    delete tri->m_ISectEdgeVec[e]->m_N0;
-                    delete tri->m_ISectEdgeVec[e]->m_N1;
-                    delete tri->m_ISectEdgeVec[e];
-                }
-                tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
-            }
-        }
+        IntersectSliceTMesh( tm );
 
         //==== Split Intersected Tri in Mesh ====//
         tm->Split();
@@ -2937,6 +3212,7 @@ void MeshGeom::WaveDragSlice( int numSlices, double sliceAngle, int coneSections
     WaveDragMgr.m_ExitArea = exA;
 
 
+    #pragma omp parallel for schedule( dynamic )
     for ( int islice = 0 ; islice < numSlices ; islice++ )
     {
         for ( int itheta = 0; itheta < coneSections; itheta++ )
@@ -3043,10 +3319,10 @@ vec3d MeshGeom::GetVertex3d( int surf, double x, double p, int r )
 //  buildVertexVec(&sliceVec, 1, vertVec);
 //}
 
-//==== Call After BndBoxes Have Been Create But Before Intersect ====//
-void MeshGeom::MassSliceX( int numSlices, bool writefile )
+//==== Merge Or Remove Open Meshes, Tag Components And Bound The Meshes For Mass Properties ====//
+Results* MeshGeom::InitMassProps()
 {
-    int i, j, s;
+    int i;
 
     //==== Check For Open Meshes and Merge or Delete Them ====//
     MeshInfo info;
@@ -3088,7 +3364,72 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
         b.Update( m_TMeshVec[i]->m_TBox.m_Box );
     }
     m_BBox = b;
-    //update_xformed_bbox();            // Load Xform BBox
+
+    return res;
+}
+
+//==== Shell Mass Of Exterior Tris Of Shell Meshes, Call After DeterIntExt ====//
+void MeshGeom::CreateShellMassProps( vector< TriShellMassProp* > & triShellVec )
+{
+    int i, j, s;
+
+    for ( s = 0 ; s < ( int )m_TMeshVec.size() ; s++ )
+    {
+        TMesh* tm = m_TMeshVec[s];
+        if ( tm->m_ShellFlag )
+        {
+            for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
+            {
+                TTri* tri = tm->m_TVec[i];
+                if ( tri->m_SplitVec.size() )
+                {
+                    for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
+                    {
+                        if ( tri->m_SplitVec[j]->m_InteriorFlag == 0 )
+                        {
+                            TriShellMassProp* tsmp = new TriShellMassProp( tm->m_PtrID, tm->m_ShellMassArea,
+                                    tri->m_SplitVec[j]->m_N0->m_Pnt,
+                                    tri->m_SplitVec[j]->m_N1->m_Pnt,
+                                    tri->m_SplitVec[j]->m_N2->m_Pnt );
+                            triShellVec.push_back( tsmp );
+                        }
+                    }
+                }
+                else if ( tri->m_InteriorFlag == 0 )
+                {
+                    TriShellMassProp* tsmp = new TriShellMassProp( tm->m_PtrID, tm->m_ShellMassArea,
+                            tri->m_N0->m_Pnt, tri->m_N1->m_Pnt, tri->m_N2->m_Pnt );
+                    triShellVec.push_back( tsmp );
+                }
+            }
+        }
+    }
+}
+
+//==== Call After BndBoxes Have Been Create But Before Intersect ====//
+void MeshGeom::MassSliceX( int numSlices, bool writefile, bool symmFlag )
+{
+    int i, j, s;
+
+    Results* res = InitMassProps();
+
+    //==== Models Symmetric About Y=0 Are Sliced On The +Y Half And Mirrored ====//
+    // Shell mass needs the trimmed surface of both halves, so shells use the full model.
+    vector< int > partnerVec;
+    bool symm = symmFlag;
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() && symm ; i++ )
+    {
+        symm = !m_TMeshVec[i]->m_ShellFlag;
+    }
+    symm = symm && FindXZMirrorPartners( partnerVec );
+    res->Add( NameValData( "XZ_Symmetry_Used", ( int )symm ) );
+
+    vector< TMesh* > fullMeshVec = m_TMeshVec;
+    vector< bool > asideVec;
+    if ( symm )
+    {
+        SetAsideNegYMeshes( asideVec, false );
+    }
 
     double xMin = m_BBox.GetMin( 0 );
     double xMax = m_BBox.GetMax( 0 );
@@ -3113,6 +3454,12 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
         double zdel = 1.02 * ( m_BBox.GetMax( 2 ) - m_BBox.GetMin( 2 ) );
         double zs   = m_BBox.GetMin( 2 ) - 0.01 * zdel;
 
+        if ( symm )
+        {
+            ydel = 1.01 * m_BBox.GetMax( 1 );
+            ys = 0.0;
+        }
+
         for ( i = 0 ; i < 10 ; i++ )
         {
             double y0 = ys + ydel * 0.1 * ( double )i;
@@ -3129,36 +3476,77 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
         }
     }
 
-    //==== Load Bnding Box ====//
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
+    //==== Slices Are Independent - Process Them In Parallel Against The Shared Mesh Bnd Boxes ====//
+    int numSliceMesh = ( int )m_SliceVec.size();
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( s = 0 ; s < numSliceMesh ; s++ )
     {
         TMesh* tm = m_SliceVec[s];
         tm->LoadBndBox();
 
         //==== Intersect All Mesh Geoms ====//
-        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-        {
-            tm->Intersect( m_TMeshVec[i] );
+        IntersectSliceTMesh( tm );
 
-            for ( j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
+        //==== Split Intersected Tri in Mesh ====//
+        tm->Split();
+
+        //==== Determine Which Triangle Are Interior/Exterior ====//
+        tm->MassDeterIntExt( m_TMeshVec );
+
+    }
+
+    //==== Meshes Are Only Trimmed For Shell Mass, Which Symmetric Mode Excludes ====//
+    if ( symm )
+    {
+        m_TMeshVec = fullMeshVec;
+
+        vector< TriShellMassProp* > triShellVec;
+        vector< TetraMassProp* > tetraVec;
+        for ( s = 0 ; s < numSliceMesh ; s++ )
+        {
+            TMesh* tm = m_SliceVec[s];
+            for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
             {
-                TTri* tri = m_TMeshVec[i]->m_TVec[j];
-                for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
+                TTri* tri = tm->m_TVec[t];
+
+                if ( tri->m_SplitVec.size() )
+                {
+                    for ( int k = 0 ; k < ( int )tri->m_SplitVec.size() ; k++ )
+                    {
+                        if ( tri->m_SplitVec[k]->m_InteriorFlag == 0 )
+                        {
+                            CreatePrism( tetraVec, tri->m_SplitVec[k], sliceW );
+                        }
+                    }
+                }
+                else if ( tri->m_InteriorFlag == 0 )
                 {
-                    delete tri->m_ISectEdgeVec[e]->m_N0;
-                    delete tri->m_ISectEdgeVec[e]->m_N1;
-                    delete tri->m_ISectEdgeVec[e];
+                    CreatePrism( tetraVec, tri, sliceW );
                 }
-                tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
             }
         }
 
-        //==== Split Intersected Tri in Mesh ====//
-        tm->Split();
+        //==== Mirror Each Element Into The Partner Of The Component That Owns It ====//
+        map< string, string > partner_id_map;
+        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+        {
+            partner_id_map[ m_TMeshVec[i]->m_PtrID ] = m_TMeshVec[ partnerVec[i] ]->m_PtrID;
+        }
 
-        //==== Determine Which Triangle Are Interior/Exterior ====//
-        tm->MassDeterIntExt( m_TMeshVec );
+        int num_tet = ( int )tetraVec.size();
+        for ( i = 0 ; i < num_tet ; i++ )
+        {
+            TetraMassProp* tet = new TetraMassProp( *tetraVec[i] );
+            tet->m_CompId = partner_id_map[ tet->m_CompId ];
+            tet->m_CG.scale_y( -1.0 );
+            tet->m_Ixy = -tet->m_Ixy;
+            tet->m_Iyz = -tet->m_Iyz;
+            tetraVec.push_back( tet );
+        }
 
+        FinishMassProps( res, tetraVec, triShellVec, writefile );
+        return;
     }
     /**********
         //==== Delete Mesh Geometry ====//
@@ -3169,88 +3557,198 @@ void MeshGeom::MassSliceX( int numSlices, bool writefile )
         tMeshVec.erase( tMeshVec.begin(), tMeshVec.end() );
     *********/
     //==== Intersect All Mesh Geoms ====//
+    IntersectTMeshPairs();
+
+    //==== Split Intersected Tri in Mesh ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
+        m_TMeshVec[i]->Split();
+    }
+
+    //==== Determine Which Triangle Are Interior/Exterior ====//
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
+    }
+
+    //==== Do Shell Calcs ====//
+    vector< TriShellMassProp* > triShellVec;
+    CreateShellMassProps( triShellVec );
+
+    //==== Build Tetrahedrons - Per Slice, Then Gathered In Slice Order ====//
+    double prismLength = sliceW;
+    vector< TetraMassProp* > tetraVec;
+    vector< vector< TetraMassProp* > > sliceTetraVec( numSliceMesh );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( s = 0 ; s < numSliceMesh ; s++ )
+    {
+        TMesh* tm = m_SliceVec[s];
+        for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
         {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
+            TTri* tri = tm->m_TVec[t];
+
+            if ( tri->m_SplitVec.size() )
+            {
+                for ( int k = 0 ; k < ( int )tri->m_SplitVec.size() ; k++ )
+                {
+                    if ( tri->m_SplitVec[k]->m_InteriorFlag == 0 )
+                    {
+                        CreatePrism( sliceTetraVec[s], tri->m_SplitVec[k], prismLength );
+                    }
+                }
+            }
+            else if ( tri->m_InteriorFlag == 0 )
+            {
+                CreatePrism( sliceTetraVec[s], tri, prismLength );
+            }
         }
     }
 
-    //==== Split Intersected Tri in Mesh ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    for ( s = 0 ; s < numSliceMesh ; s++ )
     {
-        m_TMeshVec[i]->Split();
+        tetraVec.insert( tetraVec.end(), sliceTetraVec[s].begin(), sliceTetraVec[s].end() );
     }
 
-    //==== Determine Which Triangle Are Interior/Exterior ====//
+    FinishMassProps( res, tetraVec, triShellVec, writefile );
+}
+
+//==== Exact Volume Mass Properties From Surface Integrals Over The Trimmed Meshes ====//
+// Each region of space belongs to the highest mass priority mesh enclosing it, as in
+// MassSliceX.  A surface tri bounds its own mesh's region when no enclosing mesh outranks
+// it, and is then also an inner boundary of the region of the mesh it sits inside.  The
+// divergence theorem turns volume, first and second moments of each region into sums of
+// signed tetrahedra from a reference point to those tris.
+void MeshGeom::MassPropsAnalytic( bool writefile )
+{
+    int i, s;
+
+    Results* res = InitMassProps();
+
+    //==== Intersect All Mesh Geoms ====//
+    IntersectTMeshPairs();
+
+    //==== Split Intersected Tri in Mesh ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
     {
-        m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
+        m_TMeshVec[i]->Split();
     }
 
-    //==== Do Shell Calcs ====//
-    vector< TriShellMassProp* > triShellVec;
-    for ( s = 0 ; s < ( int )m_TMeshVec.size() ; s++ )
+    int nmesh = ( int )m_TMeshVec.size();
+    vec3d ref = m_BBox.GetCenter();
+
+    // Volume, first moments and second moments ( xx, yy, zz, xy, xz, yz ) about ref per mesh.
+    const int nmom = 10;
+    vector< double > momVec( nmesh * nmom, 0.0 );
+
+    vector< TTri* > triVec;
+    vector< int > ownerVec;
+    for ( s = 0 ; s < nmesh ; s++ )
     {
         TMesh* tm = m_TMeshVec[s];
-        if ( tm->m_ShellFlag )
+        tm->MassOwners( m_TMeshVec, triVec, ownerVec );
+
+        for ( i = 0 ; i < ( int )triVec.size() ; i++ )
         {
-            for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
+            int w = ownerVec[i];
+            bool outranks = ( w < 0 || tm->m_MassPrior > m_TMeshVec[w]->m_MassPrior ||
+                              ( tm->m_MassPrior == m_TMeshVec[w]->m_MassPrior && s < w ) );
+            if ( !outranks )
             {
-                TTri* tri = tm->m_TVec[i];
-                if ( tri->m_SplitVec.size() )
-                {
-                    for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
-                    {
-                        if ( tri->m_SplitVec[j]->m_InteriorFlag == 0 )
-                        {
-                            TriShellMassProp* tsmp = new TriShellMassProp( tm->m_PtrID, tm->m_ShellMassArea,
-                                    tri->m_SplitVec[j]->m_N0->m_Pnt,
-                                    tri->m_SplitVec[j]->m_N1->m_Pnt,
-                                    tri->m_SplitVec[j]->m_N2->m_Pnt );
-                            triShellVec.push_back( tsmp );
-                        }
-                    }
-                }
-                else if ( tri->m_InteriorFlag == 0 )
+                continue;
+            }
+
+            vec3d a = triVec[i]->m_N0->m_Pnt - ref;
+            vec3d b = triVec[i]->m_N1->m_Pnt - ref;
+            vec3d c = triVec[i]->m_N2->m_Pnt - ref;
+
+            double vol = tetra_volume( a, b, c );
+            double mom[nmom];
+            mom[0] = vol;
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                mom[1 + k] = vol * 0.25 * ( a[k] + b[k] + c[k] );
+                mom[4 + k] = vol * 0.1 * ( a[k] * a[k] + b[k] * b[k] + c[k] * c[k] +
+                                           a[k] * b[k] + a[k] * c[k] + b[k] * c[k] );
+            }
+            const int pk[3][2] = { { 0, 1 }, { 0, 2 }, { 1, 2 } };
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                int p = pk[k][0];
+                int q = pk[k][1];
+                mom[7 + k] = vol * 0.05 * ( 2.0 * ( a[p] * a[q] + b[p] * b[q] + c[p] * c[q] ) +
+                                            a[p] * b[q] + b[p] * a[q] + a[p] * c[q] + c[p] * a[q] + b[p] * c[q] + c[p] * b[q] );
+            }
+
+            for ( int k = 0 ; k < nmom ; k++ )
+            {
+                momVec[ s * nmom + k ] += mom[k];
+                if ( w >= 0 )
                 {
-                    TriShellMassProp* tsmp = new TriShellMassProp( tm->m_PtrID, tm->m_ShellMassArea,
-                            tri->m_N0->m_Pnt, tri->m_N1->m_Pnt, tri->m_N2->m_Pnt );
-                    triShellVec.push_back( tsmp );
+                    momVec[ w * nmom + k ] -= mom[k];
                 }
             }
         }
     }
 
-    //==== Build Tetrahedrons ====//
-    double prismLength = sliceW;
+    //==== One Volume Element Per Component, Inertia About Its CG ====//
     vector< TetraMassProp* > tetraVec;
-
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
+    for ( s = 0 ; s < nmesh ; s++ )
     {
-        TMesh* tm = m_SliceVec[s];
-        for ( i = 0 ; i < ( int )tm->m_TVec.size() ; i++ )
+        double* mom = &momVec[ s * nmom ];
+        if ( mom[0] == 0.0 )
         {
-            TTri* tri = tm->m_TVec[i];
-
-            if ( tri->m_SplitVec.size() )
-            {
-                for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
-                {
-                    if ( tri->m_SplitVec[j]->m_InteriorFlag == 0 )
-                    {
-                        CreatePrism( tetraVec, tri->m_SplitVec[j], prismLength );
-                    }
-                }
-            }
-            else if ( tri->m_InteriorFlag == 0 )
+            continue;
+        }
+        if ( mom[0] < 0.0 )
+        {
+            for ( int k = 0 ; k < nmom ; k++ )
             {
-                CreatePrism( tetraVec, tri, prismLength );
+                mom[k] = -mom[k];
             }
         }
+
+        TMesh* tm = m_TMeshVec[s];
+        double vol = mom[0];
+        vec3d d( mom[1] / vol, mom[2] / vol, mom[3] / vol );
+
+        TetraMassProp* tet = new TetraMassProp();
+        tet->m_CompId = tm->m_PtrID;
+        tet->m_Density = tm->m_Density;
+        tet->m_Vol = vol;
+        tet->m_Mass = tm->m_Density * vol;
+        tet->m_CG = ref + d;
+
+        double sxx = mom[4] - vol * d.x() * d.x();
+        double syy = mom[5] - vol * d.y() * d.y();
+        double szz = mom[6] - vol * d.z() * d.z();
+        tet->m_Ixx = tm->m_Density * ( syy + szz );
+        tet->m_Iyy = tm->m_Density * ( sxx + szz );
+        tet->m_Izz = tm->m_Density * ( sxx + syy );
+        tet->m_Ixy = tm->m_Density * ( mom[7] - vol * d.x() * d.y() );
+        tet->m_Ixz = tm->m_Density * ( mom[8] - vol * d.x() * d.z() );
+        tet->m_Iyz = tm->m_Density * ( mom[9] - vol * d.y() * d.z() );
+        tetraVec.push_back( tet );
+    }
+
+    //==== Determine Which Triangle Are Interior/Exterior ====//
+    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        m_TMeshVec[i]->DeterIntExt( m_TMeshVec );
     }
 
+    //==== Do Shell Calcs ====//
+    vector< TriShellMassProp* > triShellVec;
+    CreateShellMassProps( triShellVec );
+
+    FinishMassProps( res, tetraVec, triShellVec, writefile );
+}
+
+//==== Combine Volume, Point And Shell Mass Into Component And Total Results ====//
+void MeshGeom::FinishMassProps( Results* res, vector< TetraMassProp* > & tetraVec, vector< TriShellMassProp* > & triShellVec, bool writefile )
+{
+    int i, s;
+
     //==== Add in Point Masses ====//
     for ( i = 0 ; i < ( int )m_PointMassVec.size() ; i++ )
     {
@@ -3554,29 +4052,17 @@ void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
         }
     }
 
-    //==== Load Bounding Box ====//
-    for ( s = 0 ; s < ( int )m_SliceVec.size() ; s++ )
+    //==== Slices Are Independent - Process Them In Parallel Against The Shared Mesh Bnd Boxes ====//
+    int numSliceMesh = ( int )m_SliceVec.size();
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( s = 0 ; s < numSliceMesh ; s++ )
     {
         TMesh* tm = m_SliceVec[s];
         tm->LoadBndBox();
 
         //==== Intersect All Mesh Geoms ====//
-        for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-        {
-            tm->Intersect( m_TMeshVec[i] );
-
-            for ( j = 0 ; j < ( int )m_TMeshVec[i]->m_TVec.size() ; j++ )
-            {
-                TTri* tri = m_TMeshVec[i]->m_TVec[j];
-                for ( int e = 0 ; e < ( int )tri->m_ISectEdgeVec.size() ; e++ )
-                {
-                    delete tri->m_ISectEdgeVec[e]->m_N0;
-                    delete tri->m_ISectEdgeVec[e]->m_N1;
-                    delete tri->m_ISectEdgeVec[e];
-                }
-                tri->m_ISectEdgeVec.erase( tri->m_ISectEdgeVec.begin(), tri->m_ISectEdgeVec.end() );
-            }
-        }
+        IntersectSliceTMesh( tm );
 
         //==== Split Intersected Tri in Mesh ====//
         tm->Split();
@@ -3587,13 +4073,7 @@ void MeshGeom::degenGeomMassSliceX( vector< DegenGeom > &degenGeom )
 
 
     //==== Intersect All Mesh Geoms ====//
-    for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
-    {
-        for ( j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
-        {
-            m_TMeshVec[i]->Intersect( m_TMeshVec[j] );
-        }
-    }
+    IntersectTMeshPairs();
 
     //==== Split Intersected Tri in Mesh ====//
     for ( i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
@@ -3965,6 +4445,100 @@ void MeshGeom::WaterTightCheck( FILE* fid )
     m_TMeshVec.push_back( oneMesh );
 }
 
+//==== Intersect Every Pair of TMeshes ====//
+// Pairs with overlapping bounding boxes are intersected in parallel.  Each pair records its
+// edges instead of adding them to the tris, then the edges are attached in the same pair order
+// as a serial i < j loop so the result is identical to intersecting the pairs one at a time.
+void MeshGeom::IntersectTMeshPairs( TMeshPairCache* cache )
+{
+    vector< pair< int, int > > pair_vec;
+    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        for ( int j = i + 1 ; j < ( int )m_TMeshVec.size() ; j++ )
+        {
+            if ( Compare( m_TMeshVec[i]->m_TBox.m_Box, m_TMeshVec[j]->m_TBox.m_Box ) )
+            {
+                pair_vec.push_back( make_pair( i, j ) );
+            }
+        }
+    }
+
+    int num_pairs = ( int )pair_vec.size();
+    vector< vector< TISectSeg > > isect_vec_vec( num_pairs );
+
+    //==== Reuse Pairs Whose Meshes Are Unchanged Since The Last Run ====//
+    vector< unsigned long long > hash_vec;
+    vector< char > found_vec( num_pairs, 0 );
+    if ( cache )
+    {
+        hash_vec.resize( m_TMeshVec.size() );
+        for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+        {
+            hash_vec[i] = m_TMeshVec[i]->ComputeGeomHash( m_Scale() );
+        }
+
+        for ( int p = 0 ; p < num_pairs ; p++ )
+        {
+            int i = pair_vec[p].first;
+            int j = pair_vec[p].second;
+            found_vec[p] = cache->Find( hash_vec[i], hash_vec[j], m_TMeshVec[i], m_TMeshVec[j], m_Scale(), isect_vec_vec[p] );
+        }
+    }
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int p = 0 ; p < num_pairs ; p++ )
+    {
+        if ( !found_vec[p] )
+        {
+            m_TMeshVec[ pair_vec[p].first ]->Intersect( m_TMeshVec[ pair_vec[p].second ], isect_vec_vec[p] );
+        }
+    }
+
+    if ( cache )
+    {
+        for ( int p = 0 ; p < num_pairs ; p++ )
+        {
+            int i = pair_vec[p].first;
+            int j = pair_vec[p].second;
+            if ( !found_vec[p] )
+            {
+                cache->Store( hash_vec[i], hash_vec[j], m_TMeshVec[i], m_TMeshVec[j], m_Scale(), isect_vec_vec[p] );
+            }
+        }
+        cache->EndRun();
+    }
+
+    for ( int p = 0 ; p < num_pairs ; p++ )
+    {
+        for ( int e = 0 ; e < ( int )isect_vec_vec[p].size() ; e++ )
+        {
+            TISectSeg & seg = isect_vec_vec[p][e];
+            seg.m_Tri0->AddISectEdge( seg.m_Pnt0, seg.m_Pnt1 );
+            seg.m_Tri1->AddISectEdge( seg.m_Pnt0, seg.m_Pnt1 );
+        }
+    }
+}
+
+//==== Intersect A Slice TMesh With All Mesh Geoms ====//
+// Only the slice tris receive intersection edges and m_TMeshVec is only read, so once the
+// m_TMeshVec bounding boxes are loaded several slices may be intersected concurrently.
+void MeshGeom::IntersectSliceTMesh( TMesh* tm )
+{
+    vector< TISectSeg > isect_vec;
+    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        isect_vec.clear();
+        tm->Intersect( m_TMeshVec[i], isect_vec );
+
+        for ( int e = 0 ; e < ( int )isect_vec.size() ; e++ )
+        {
+            TISectSeg & seg = isect_vec[e];
+            TTri* tri = ( seg.m_Tri0->GetTMeshPtr() == tm ) ? seg.m_Tri0 : seg.m_Tri1;
+            tri->AddISectEdge( seg.m_Pnt0, seg.m_Pnt1 );
+        }
+    }
+}
+
 void MeshGeom::MergeRemoveOpenMeshes( MeshInfo* info )
 {
     int i, j;
@@ -4131,6 +4705,251 @@ void MeshGeom::AddHalfBox()
 
 }
 
+//==== Bounds, Area And Area Moments Of A Mesh - Equal Up To Y Sign For Mirror Images ====//
+struct XZMirrorSig
+{
+    int m_NumTris;
+    BndBox m_Box;
+    double m_Area;
+    vec3d m_Cen;
+    double m_XY;
+    double m_YZ;
+};
+
+static XZMirrorSig ComputeXZMirrorSig( TMesh* tm )
+{
+    XZMirrorSig sig;
+    sig.m_NumTris = ( int )tm->m_TVec.size();
+    sig.m_Area = 0.0;
+    sig.m_XY = sig.m_YZ = 0.0;
+
+    for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
+    {
+        TTri* tri = tm->m_TVec[t];
+        sig.m_Box.Update( tri->m_N0->m_Pnt );
+        sig.m_Box.Update( tri->m_N1->m_Pnt );
+        sig.m_Box.Update( tri->m_N2->m_Pnt );
+
+        double area = tri->ComputeArea();
+        vec3d cen = tri->ComputeCenter();
+        sig.m_Area += area;
+        sig.m_Cen = sig.m_Cen + cen * area;
+        sig.m_XY += cen.x() * cen.y() * area;
+        sig.m_YZ += cen.y() * cen.z() * area;
+    }
+
+    if ( sig.m_Area > 0.0 )
+    {
+        sig.m_Cen = sig.m_Cen * ( 1.0 / sig.m_Area );
+        sig.m_XY /= sig.m_Area;
+        sig.m_YZ /= sig.m_Area;
+    }
+    return sig;
+}
+
+static bool IsXZMirror( const XZMirrorSig & a, const XZMirrorSig & b, double tol )
+{
+    if ( a.m_NumTris != b.m_NumTris )
+    {
+        return false;
+    }
+
+    double ltol = tol * std::max( a.m_Box.GetLargestDist(), 1.0e-12 );
+    double tol_arr[] = { a.m_Box.GetMin( 0 ) - b.m_Box.GetMin( 0 ), a.m_Box.GetMax( 0 ) - b.m_Box.GetMax( 0 ),
+                         a.m_Box.GetMin( 1 ) + b.m_Box.GetMax( 1 ), a.m_Box.GetMax( 1 ) + b.m_Box.GetMin( 1 ),
+                         a.m_Box.GetMin( 2 ) - b.m_Box.GetMin( 2 ), a.m_Box.GetMax( 2 ) - b.m_Box.GetMax( 2 ),
+                         a.m_Cen.x() - b.m_Cen.x(), a.m_Cen.y() + b.m_Cen.y(), a.m_Cen.z() - b.m_Cen.z()
+                       };
+    for ( int i = 0 ; i < 9 ; i++ )
+    {
+        if ( std::abs( tol_arr[i] ) > ltol )
+        {
+            return false;
+        }
+    }
+
+    double len = a.m_Box.GetLargestDist();
+    if ( std::abs( a.m_Area - b.m_Area ) > tol * a.m_Area ||
+         std::abs( a.m_XY + b.m_XY ) > ltol * len ||
+         std::abs( a.m_YZ + b.m_YZ ) > ltol * len )
+    {
+        return false;
+    }
+    return true;
+}
+
+//==== Pair Each Mesh With Its Mirror Image About Y=0, Itself If Symmetric ====//
+// Returns false if any mesh has no mirror image, i.e. the model is not symmetric.
+bool MeshGeom::FindXZMirrorPartners( vector< int > & partnerVec )
+{
+    int n = ( int )m_TMeshVec.size();
+    partnerVec.assign( n, -1 );
+
+    vector< XZMirrorSig > sig_vec( n );
+
+    #pragma omp parallel for
+    for ( int i = 0 ; i < n ; i++ )
+    {
+        sig_vec[i] = ComputeXZMirrorSig( m_TMeshVec[i] );
+    }
+
+    const double tol = 1.0e-5;
+    for ( int i = 0 ; i < n ; i++ )
+    {
+        if ( m_TMeshVec[i]->m_HalfBoxFlag )
+        {
+            return false;
+        }
+        if ( partnerVec[i] >= 0 )
+        {
+            continue;
+        }
+
+        if ( IsXZMirror( sig_vec[i], sig_vec[i], tol ) )
+        {
+            partnerVec[i] = i;
+            continue;
+        }
+        for ( int j = i + 1 ; j < n ; j++ )
+        {
+            if ( partnerVec[j] < 0 && IsXZMirror( sig_vec[i], sig_vec[j], tol ) )
+            {
+                partnerVec[i] = j;
+                partnerVec[j] = i;
+                break;
+            }
+        }
+        if ( partnerVec[i] < 0 )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//==== Remove Meshes Entirely Below Y=0 From m_TMeshVec ====//
+// They neither reach nor enclose any point of the +Y half, so the half can be intersected
+// and classified without them.  With markInterior their tris are flagged as trimmed away.
+void MeshGeom::SetAsideNegYMeshes( vector< bool > & asideVec, bool markInterior )
+{
+    vector< TMesh* > keepVec;
+    asideVec.assign( m_TMeshVec.size(), false );
+
+    for ( int i = 0 ; i < ( int )m_TMeshVec.size() ; i++ )
+    {
+        TMesh* tm = m_TMeshVec[i];
+
+        bool below = !tm->m_HalfBoxFlag && !tm->m_TVec.empty();
+        for ( int t = 0 ; t < ( int )tm->m_TVec.size() && below ; t++ )
+        {
+            TTri* tri = tm->m_TVec[t];
+            below = tri->m_N0->m_Pnt.y() < 0.0 && tri->m_N1->m_Pnt.y() < 0.0 && tri->m_N2->m_Pnt.y() < 0.0;
+        }
+
+        if ( !below )
+        {
+            keepVec.push_back( tm );
+            continue;
+        }
+
+        asideVec[i] = true;
+        if ( markInterior )
+        {
+            for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
+            {
+                tm->m_TVec[t]->m_InteriorFlag = 1;
+            }
+        }
+    }
+    PERF_COUNT( "MeshGeom::SetAsideNegYMeshes", ( double )( m_TMeshVec.size() - keepVec.size() ) );
+
+    m_TMeshVec = keepVec;
+}
+
+//==== Complete A Model Trimmed On The +Y Half By Mirroring Each Mesh Into Its Partner ====//
+// Theoretical values come from each mesh's own untrimmed tris and are computed here.
+// Afterwards every mesh holds only its exterior tris.
+void MeshGeom::MirrorXZHalf( const vector< int > & partnerVec, const vector< bool > & asideVec )
+{
+    int n = ( int )m_TMeshVec.size();
+
+    //==== Exterior Tris Of The +Y Half ====//
+    vector< vector< TTri* > > ext_vec( n );
+    for ( int i = 0 ; i < n ; i++ )
+    {
+        TMesh* tm = m_TMeshVec[i];
+        tm->ComputeTheoArea();
+        tm->ComputeTheoVol();
+
+        if ( asideVec[i] )
+        {
+            //==== Flattened Away, Replaced By The Mirror Of Its Partner ====//
+            for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
+            {
+                tm->m_TVec[t]->m_InteriorFlag = 1;
+            }
+            continue;
+        }
+
+        for ( int t = 0 ; t < ( int )tm->m_TVec.size() ; t++ )
+        {
+            TTri* tri = tm->m_TVec[t];
+            if ( tri->m_SplitVec.size() )
+            {
+                for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
+                {
+                    if ( !tri->m_SplitVec[s]->m_InteriorFlag )
+                    {
+                        ext_vec[i].push_back( tri->m_SplitVec[s] );
+                    }
+                }
+            }
+            else if ( !tri->m_InteriorFlag )
+            {
+                ext_vec[i].push_back( tri );
+            }
+        }
+    }
+
+    vector< TMesh* > new_vec( n );
+    for ( int i = 0 ; i < n ; i++ )
+    {
+        TMesh* tm = m_TMeshVec[i];
+        TMesh* f_tmesh = new TMesh();
+
+        f_tmesh->CopyFlatten( tm );
+        f_tmesh->m_TagTheoAreaVec = tm->m_TagTheoAreaVec;
+
+        //==== The -Y Side Is The Mirror Of The Partner's +Y Side ====//
+        int p = partnerVec[i];
+        if ( !asideVec[p] )
+        {
+            for ( int t = 0 ; t < ( int )ext_vec[p].size() ; t++ )
+            {
+                TTri* tri = ext_vec[p][t];
+                vec3d p0 = tri->m_N0->m_Pnt;
+                vec3d p1 = tri->m_N1->m_Pnt;
+                vec3d p2 = tri->m_N2->m_Pnt;
+                vec3d norm = tri->m_Norm;
+                p0.scale_y( -1.0 );
+                p1.scale_y( -1.0 );
+                p2.scale_y( -1.0 );
+                norm.scale_y( -1.0 );
+
+                f_tmesh->AddTri( p0, p2, p1, norm );
+                f_tmesh->m_TVec.back()->m_Tags = tri->m_Tags;
+            }
+        }
+        new_vec[i] = f_tmesh;
+    }
+
+    for ( int i = 0 ; i < n ; i++ )
+    {
+        delete m_TMeshVec[i];
+    }
+    m_TMeshVec = new_vec;
+}
+
 void MeshGeom::CreateDegenGeom( vector<DegenGeom> &dgs, bool preview )
 {
     unsigned int num_meshes = m_TMeshVec.size();
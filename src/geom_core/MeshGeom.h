@@ -39,6 +39,25 @@ public:
     int m_NumDegenerateTriDeleted;
 };
 
+//==== One Set Of Planar Slices For MeshGeom::AreaSliceBatch ====//
+class AreaSliceRequest
+{
+public:
+    AreaSliceRequest()
+    {
+        m_NumSlices = 0;
+        m_Axis = vec3d( 1, 0, 0 );
+        m_AutoBounds = true;
+        m_Start = m_End = 0;
+    }
+
+    int m_NumSlices;
+    vec3d m_Axis;
+    bool m_AutoBounds;
+    double m_Start;
+    double m_End;
+};
+
 
 class MeshGeom : public Geom
 {
@@ -94,6 +113,8 @@ public:
 
     virtual void LoadDrawObjs( vector< DrawObj* > & draw_obj_vec );
 
+    virtual void AddMemoryUsage( GeomMemUsage & usage );
+
     virtual int  GetNumXSecSurfs()
     {
         return 0;
@@ -106,6 +127,7 @@ public:
     virtual int   ReadBinInt  ( FILE* fptr );
     virtual void WriteStl( FILE* pov_file );
     virtual void WriteStl( FILE* stl_file, int tag );
+    virtual void LoadStlTris( vector< vec3d > & pnt_vec );
 
     virtual void BuildIndexedMesh( int partOffset );
     virtual int  GetNumIndexedPnts()
@@ -142,11 +164,13 @@ public:
     virtual void Scale();
 
     //==== Intersection, Splitting and Trimming ====//
-    virtual void IntersectTrim( int halfFlag = 0, int intSubsFlag = 1 );
+    virtual void IntersectTrim( int halfFlag = 0, int intSubsFlag = 1, bool symmFlag = false );
     virtual void degenGeomIntersectTrim( vector< DegenGeom > &degenGeom );
-    virtual void MassSliceX( int numSlice, bool writefile = true );
+    virtual void MassSliceX( int numSlice, bool writefile = true, bool symmFlag = false );
+    virtual void MassPropsAnalytic( bool writefile = true );
     virtual void degenGeomMassSliceX( vector< DegenGeom > &degenGeom );
     virtual void AreaSlice( int numSlices, vec3d norm, bool autoBounds, double start = 0, double end = 0 );
+    virtual vector< string > AreaSliceBatch( const vector< AreaSliceRequest > & req_vec );
 
     virtual void WaveStartEnd( const double &sliceAngle, const vec3d &center );
     virtual void WaveDragSlice( int numSlices, double sliceAngle, int coneSections,
@@ -155,10 +179,15 @@ public:
     virtual vector<vec3d> TessTri( vec3d t1, vec3d t2, vec3d t3, int iterations );
 
     virtual void MergeRemoveOpenMeshes( MeshInfo* info );
+    virtual void IntersectTMeshPairs( TMeshPairCache* cache = NULL );
+    virtual void IntersectSliceTMesh( TMesh* tm );
 
     virtual vec3d GetVertex3d( int surf, double x, double p, int r );
     //virtual void  getVertexVec(vector< VertexID > *vertVec);
 
+    virtual Results* InitMassProps();
+    virtual void CreateShellMassProps( vector< TriShellMassProp* > & triShellVec );
+    virtual void FinishMassProps( Results* res, vector< TetraMassProp* > & tetraVec, vector< TriShellMassProp* > & triShellVec, bool writefile );
     virtual void CreatePrism( vector< TetraMassProp* >& tetraVec, TTri* tri, double len );
     virtual void createDegenGeomPrism( vector< DegenGeomTetraMassProp* >& tetraVec, TTri* tri, double len );
 
@@ -170,6 +199,9 @@ public:
 
     virtual void WaterTightCheck( FILE* fid );
     virtual void AddHalfBox();
+    virtual bool FindXZMirrorPartners( vector< int > & partnerVec );
+    virtual void SetAsideNegYMeshes( vector< bool > & asideVec, bool markInterior );
+    virtual void MirrorXZHalf( const vector< int > & partnerVec, const vector< bool > & asideVec );
 
     virtual void UpdateSurf() {}
     virtual int GetNumMainSurfs()
@@ -177,7 +209,13 @@ public:
         return 0;
     }
 
+    virtual bool CanDeferLoad()
+    {
+        return false;
+    }
+
     virtual void CreateDegenGeom( vector<DegenGeom> &dgs, bool preview = false );
+    virtual int PrepareDegenSurfs()                     { return -1; }
 
     virtual vector< TMesh* > CreateTMeshVec();
     virtual void FlattenTMeshVec();
@@ -205,6 +243,7 @@ public:
 
 protected:
     virtual void ApplyScale(); // this is for intersectTrim
+    virtual void CopyPayloadFrom( Geom* geom );
     vector<TMesh*> m_SubSurfVec;
 
 };
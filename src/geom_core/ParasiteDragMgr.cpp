@@ -148,6 +148,8 @@ void ParasiteDragMgrSingleton::Renew()
 
     m_DegenGeomVec.clear();
     m_CompGeomResults = NULL;
+    m_CompGeomResultsID.clear();
+    m_GeomCacheKey.clear();
 
     SetDefaultStruct();
 
@@ -425,6 +427,15 @@ void ParasiteDragMgrSingleton::LoadMainTableUserInputs()
 void ParasiteDragMgrSingleton::SetupFullCalculation()
 {
     Vehicle* veh = VehicleMgr.GetVehicle();
+
+    //==== Nothing Geometric Changed Since The Last Setup, Reuse It ====//
+    if ( veh && m_RecomputeGeom && GeomCacheValid( veh->GetGeomSet( m_SetChoice() ) ) )
+    {
+        ClearInputVectors();
+        ClearOutputVectors();
+        return;
+    }
+
     if ( veh && (m_RecomputeGeom || (m_DegenGeomVec.size() == 0 && !m_CompGeomResults)))
     {
         veh->ClearDegenGeom();
@@ -469,7 +480,56 @@ void ParasiteDragMgrSingleton::SetupFullCalculation()
 
         // First Assignment of CompGeon, Will Carry Through to Rest of Calculate_X
         m_CompGeomResults = ResultsMgr.FindResults( "Comp_Geom" );
+
+        // Key taken after the runs, as they may themselves update the Geoms
+        m_CompGeomResultsID = m_CompGeomResults ? m_CompGeomResults->GetID() : string();
+        m_GeomCacheKey = BuildGeomCacheKey( geomIDVec );
+    }
+}
+
+//==== Key Of The Geometry The DegenGeom And CompGeom Were Built From ====//
+// Every Parm change or update that may move a surface bumps its Geom's surface
+// revision.  Freestream and form factor inputs belong to this manager and leave
+// the key alone.  The Geom names are included as they label the CompGeom tags.
+string ParasiteDragMgrSingleton::BuildGeomCacheKey( const vector < string > & geom_id_vec )
+{
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    if ( !veh )
+    {
+        return string();
+    }
+
+    char str[256];
+    sprintf( str, "%d", m_SetChoice() );
+    string key = str;
+
+    for ( size_t i = 0; i < geom_id_vec.size(); i++ )
+    {
+        Geom* geom = veh->FindGeom( geom_id_vec[i] );
+        if ( geom )
+        {
+            sprintf( str, ":%d:", geom->GetSurfRevision() );
+            key += "|" + geom->GetID() + str + geom->GetName();
+        }
+    }
+
+    return key;
+}
+
+bool ParasiteDragMgrSingleton::GeomCacheValid( const vector < string > & geom_id_vec )
+{
+    if ( m_GeomCacheKey.empty() || m_DegenGeomVec.empty() || !m_CompGeomResults )
+    {
+        return false;
     }
+
+    // The CompGeom results may have been deleted from the ResultsMgr.
+    if ( ResultsMgr.FindResultsPtr( m_CompGeomResultsID ) != m_CompGeomResults )
+    {
+        return false;
+    }
+
+    return m_GeomCacheKey == BuildGeomCacheKey( geom_id_vec );
 }
 
 int ParasiteDragMgrSingleton::CalcRowSize()
@@ -671,7 +731,7 @@ double ParasiteDragMgrSingleton::CalcReferenceBodyLength( int index )
 {
     // TODO: Improve Reference Length Calculations
     double delta_x, delta_y, delta_z, lref;
-    vector <DegenStick> m_DegenStick = m_DegenGeomVec[index].getDegenSticks();
+    const vector <DegenStick> & m_DegenStick = m_DegenGeomVec[index].getDegenSticks();
     delta_x = abs( m_DegenStick[0].xle.front().x() - m_DegenStick[0].xle.back().x() );
     delta_y = abs( m_DegenStick[0].xle.front().y() - m_DegenStick[0].xle.back().y() );
     delta_z = abs( m_DegenStick[0].xle.front().z() - m_DegenStick[0].xle.back().z() );
@@ -684,7 +744,7 @@ double ParasiteDragMgrSingleton::CalcReferenceBodyLength( int index )
 double ParasiteDragMgrSingleton::CalcReferenceChord( int index )
 {
     // TODO: Improve Reference Length Calculations
-    vector <DegenStick> m_DegenStick = m_DegenGeomVec[index].getDegenSticks();
+    const vector <DegenStick> & m_DegenStick = m_DegenGeomVec[index].getDegenSticks();
     double secArea, totalArea = 0, weightedChordSum = 0;
     double delta_x, delta_y, delta_z, section_span;
     for ( size_t j = 0; j <= m_DegenStick[0].areaTop.size() - 1; ++j )
@@ -894,7 +954,7 @@ double ParasiteDragMgrSingleton::CalculateFinessRatioAndTOC( int isurf, int irow
     double finerat = 1.0;
 
     // Grab Degen Sticks for Appropriate Geom
-    vector <DegenStick> degenSticks = m_DegenGeomVec[isurf].getDegenSticks();
+    const vector <DegenStick> & degenSticks = m_DegenGeomVec[isurf].getDegenSticks();
 
     if ( m_DegenGeomVec[isurf].getType() == DegenGeom::SURFACE_TYPE )
     {
@@ -990,7 +1050,7 @@ double ParasiteDragMgrSingleton::CalculateFormFactor( int isurf, int irow )
     double formfactor = 1.0;
 
     // Grab Degen Sticks for Appropriate Geom
-    vector <DegenStick> degenSticks = m_DegenGeomVec[isurf].getDegenSticks();
+    const vector <DegenStick> & degenSticks = m_DegenGeomVec[isurf].getDegenSticks();
 
     if ( m_DegenGeomVec[isurf].getType() == DegenGeom::SURFACE_TYPE )
     {
@@ -1014,7 +1074,7 @@ double ParasiteDragMgrSingleton::CalculateFormFactor( int isurf, int irow )
     return formfactor;
 }
 
-void ParasiteDragMgrSingleton::Calculate_AvgSweep( vector<DegenStick> degenSticks )
+void ParasiteDragMgrSingleton::Calculate_AvgSweep( const vector<DegenStick> & degenSticks )
 {
     // Find Quarter Chord Using Derived Eqn from Geometry
     double width, secSweep25, secSweep50, secArea, weighted25Sum = 0, weighted50Sum = 0, totalArea = 0;
@@ -1150,16 +1210,8 @@ void ParasiteDragMgrSingleton::Calculate_ALL()
     // Calculate All Necessary Values
     Calculate_Swet();
     Calculate_Lref();
-    Calculate_Re();
-    Calculate_Cf();
     Calculate_fineRat_and_toc();
-    Calculate_FF();
-    OverwritePropertiesFromAncestorGeom();
-    Calculate_f();
-    Calculate_CD();
-
-    UpdateExcres();
-    UpdatePercentageCD();
+    Calculate_Condition();
 
     InitTableVec(); // Initialize Map Size
 
@@ -1202,6 +1254,31 @@ void ParasiteDragMgrSingleton::Calculate_ALL()
     }
 }
 
+//==== Everything That Depends On The Freestream, On Top Of The Geometry Columns ====//
+// Swet, Lref and fineness ratio must already be filled.  Lref and fineness are
+// overwritten from grouped ancestors here, which leaves them unchanged when run
+// again for another condition.
+void ParasiteDragMgrSingleton::Calculate_Condition()
+{
+    m_geo_Re.clear();
+    m_geo_cf.clear();
+    m_geo_ffName.clear();
+    m_geo_ffOut.clear();
+    m_geo_f.clear();
+    m_geo_CD.clear();
+    m_geo_percTotalCD.clear();
+
+    Calculate_Re();
+    Calculate_Cf();
+    Calculate_FF();
+    OverwritePropertiesFromAncestorGeom();
+    Calculate_f();
+    Calculate_CD();
+
+    UpdateExcres();
+    UpdatePercentageCD();
+}
+
 void ParasiteDragMgrSingleton::CorrectTurbEquation()
 {
     if ( IsTurbBlacklisted( m_TurbCfEqnType() ) )
@@ -1247,6 +1324,154 @@ string ParasiteDragMgrSingleton::ComputeBuildUp()
     return "";
 }
 
+//==== Component Build Up Over Many Flight Conditions ====//
+// The geometry columns are computed once, then only the freestream dependent
+// stages are run for each condition.  Each vector holds one value per
+// condition, a single value used for all of them, or is empty to keep the
+// current value.  temp_vec is the temperature offset for the standard
+// atmospheres and the temperature for the manual types that take one.
+string ParasiteDragMgrSingleton::ComputeBuildUpSweep( const vector < double > & vinf_vec, const vector < double > & alt_vec,
+                                                      const vector < double > & temp_vec )
+{
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    if ( !veh )
+    {
+        return string();
+    }
+
+    int ncond = max( 1, ( int ) max( vinf_vec.size(), max( alt_vec.size(), temp_vec.size() ) ) );
+
+    CorrectTurbEquation();
+
+    SetupFullCalculation();
+    SetActiveGeomVec();
+    CalcRowSize();
+
+    Update();
+
+    Calculate_ALL();
+
+    double vinfOrig = m_Vinf();
+    double altOrig = m_Hinf();
+    double deltaTempOrig = m_DeltaT();
+    double tempOrig = m_Temp();
+
+    bool std_atmos = m_FreestreamType() == vsp::ATMOS_TYPE_US_STANDARD_1976 ||
+                     m_FreestreamType() == vsp::ATMOS_TYPE_HERRINGTON_1966;
+    bool manual_temp = m_FreestreamType() == vsp::ATMOS_TYPE_MANUAL_P_T ||
+                       m_FreestreamType() == vsp::ATMOS_TYPE_MANUAL_R_T;
+
+    vector < double > fc_vinf( ncond ), fc_alt( ncond ), fc_dtemp( ncond ), fc_temp( ncond );
+    vector < double > fc_mach( ncond ), fc_reql( ncond ), fc_rho( ncond );
+    vector < double > geom_cd( ncond ), excres_cd( ncond ), total_cd( ncond );
+    vector < vector < double > > comp_re( ncond ), comp_cf( ncond ), comp_ff( ncond ), comp_cd( ncond );
+
+    for ( int c = 0; c < ncond; c++ )
+    {
+        if ( !vinf_vec.empty() )
+        {
+            m_Vinf.Set( vinf_vec[ min( c, ( int )vinf_vec.size() - 1 ) ] );
+        }
+        if ( !alt_vec.empty() )
+        {
+            m_Hinf.Set( alt_vec[ min( c, ( int )alt_vec.size() - 1 ) ] );
+        }
+        if ( !temp_vec.empty() )
+        {
+            double t = temp_vec[ min( c, ( int )temp_vec.size() - 1 ) ];
+            if ( std_atmos )
+            {
+                m_DeltaT.Set( t );
+            }
+            else if ( manual_temp )
+            {
+                m_Temp.Set( t );
+            }
+        }
+
+        UpdateAtmos();
+
+        Calculate_Condition();
+
+        fc_vinf[c] = m_Vinf();
+        fc_alt[c] = m_Hinf();
+        fc_dtemp[c] = m_DeltaT();
+        fc_temp[c] = m_Temp();
+        fc_mach[c] = m_Mach();
+        fc_reql[c] = m_ReqL();
+        fc_rho[c] = m_Rho();
+
+        geom_cd[c] = GetGeometryCD();
+        excres_cd[c] = GetTotalExcresCD();
+        total_cd[c] = GetTotalCD();
+
+        comp_re[c] = m_geo_Re;
+        comp_cf[c] = m_geo_cf;
+        comp_cd[c] = m_geo_CD;
+        comp_ff[c].resize( m_RowSize );
+        for ( int i = 0; i < m_RowSize; i++ )
+        {
+            if ( m_geo_ffType[i] == vsp::FF_B_MANUAL || m_geo_ffType[i] == vsp::FF_W_MANUAL )
+            {
+                comp_ff[c][i] = m_geo_ffIn[i];
+            }
+            else
+            {
+                comp_ff[c][i] = m_geo_ffOut[i];
+            }
+        }
+    }
+
+    //==== Leave The Table At The Current Condition ====//
+    m_Vinf.Set( vinfOrig );
+    m_Hinf.Set( altOrig );
+    m_DeltaT.Set( deltaTempOrig );
+    m_Temp.Set( tempOrig );
+    UpdateAtmos();
+    Calculate_ALL();
+
+    Results* res = ResultsMgr.CreateResults( "Parasite_Drag_Sweep" );
+    if ( !res )
+    {
+        return string();
+    }
+
+    vector < int > master_row( m_RowSize );
+    for ( int i = 0; i < m_RowSize; i++ )
+    {
+        master_row[i] = m_geo_masterRow[i] ? 1 : 0;
+    }
+
+    res->Add( NameValData( "Num_Conditions", ncond ) );
+    res->Add( NameValData( "FC_Vinf", fc_vinf ) );
+    res->Add( NameValData( "FC_Alt", fc_alt ) );
+    res->Add( NameValData( "FC_dTemp", fc_dtemp ) );
+    res->Add( NameValData( "FC_Temp", fc_temp ) );
+    res->Add( NameValData( "FC_Mach", fc_mach ) );
+    res->Add( NameValData( "FC_Re_L", fc_reql ) );
+    res->Add( NameValData( "FC_Rho", fc_rho ) );
+    res->Add( NameValData( "FC_Sref", m_Sref.Get() ) );
+
+    res->Add( NameValData( "Comp_ID", m_geo_geomID ) );
+    res->Add( NameValData( "Comp_SubSurf_ID", m_geo_subsurfID ) );
+    res->Add( NameValData( "Comp_Label", m_geo_label ) );
+    res->Add( NameValData( "Comp_Master_Row", master_row ) );
+    res->Add( NameValData( "Comp_Swet", m_geo_swet ) );
+    res->Add( NameValData( "Comp_Lref", m_geo_lref ) );
+
+    // One row per condition, one column per table row
+    res->Add( NameValData( "Comp_Re", comp_re ) );
+    res->Add( NameValData( "Comp_Cf", comp_cf ) );
+    res->Add( NameValData( "Comp_FF", comp_ff ) );
+    res->Add( NameValData( "Comp_CD", comp_cd ) );
+
+    res->Add( NameValData( "Geom_CD", geom_cd ) );
+    res->Add( NameValData( "Excres_CD", excres_cd ) );
+    res->Add( NameValData( "Total_CD", total_cd ) );
+
+    return res->GetID();
+}
+
 void ParasiteDragMgrSingleton::OverwritePropertiesFromAncestorGeom()
 {
     Vehicle* veh = VehicleMgr.GetVehicle();
@@ -102,11 +102,14 @@ public:
     double CalculateFinessRatioAndTOC( int isurf, int irow );
     void Calculate_FF();
     double CalculateFormFactor( int isurf, int irow );
-    void Calculate_AvgSweep( vector <DegenStick> degenSticks );
+    void Calculate_AvgSweep( const vector <DegenStick> & degenSticks );
     void Calculate_f();
     void Calculate_CD();
     void Calculate_ALL();
     string ComputeBuildUp(); // Used only through API
+    string ComputeBuildUpSweep( const vector < double > & vinf_vec, const vector < double > & alt_vec,
+                                const vector < double > & temp_vec ); // Used only through API
+    void Calculate_Condition();
 
     // Grouped Geom Overwrite methods
     void OverwritePropertiesFromAncestorGeom();
@@ -382,6 +385,12 @@ private:
     // Execution Control
     bool m_RecomputeGeom;
 
+    // Geometry Cache, DegenGeom and CompGeom rerun only when the key changes
+    string BuildGeomCacheKey( const vector < string > & geom_id_vec );
+    bool GeomCacheValid( const vector < string > & geom_id_vec );
+    string m_GeomCacheKey;
+    string m_CompGeomResultsID;
+
     vector<int> m_TurbBlackList;
     vector<int> m_TurbAlternateList;
 
@@ -20,11 +20,14 @@ using std::string;
 //==== Constructor ====//
 Parm::Parm()
 {
+    static const string* default_descript = ParmMgr.InternDescript( string( "Default Description" ) );
+
+    m_Handle = -1;
     m_Container = NULL;
     m_Name = string( "Default_Name" );
     m_GroupName = string( "Default_Group_Name" );
     m_GroupDisplaySuffix = -1;
-    m_Descript = string( "Default Description" );
+    m_Descript = default_descript;
     m_Type = vsp::PARM_DOUBLE_TYPE;
     m_Val = 0.0;
     m_LastVal = 0.0;
@@ -70,12 +73,60 @@ void Parm::Init( const string& name, const string& group_name, ParmContainer* co
     }
 }
 
+void Parm::SetDescript( const string& d )
+{
+    if ( d != *m_Descript )
+    {
+        m_Descript = ParmMgr.InternDescript( d );
+    }
+}
+
 void Parm::ReSetLinkContainerID()
 {
     if ( m_Container )
     {
         m_LinkContainerID = m_Container->GetID();
     }
+
+    // Also reached when the container changes ID.
+    ParmMgr.ReIndexParmName( this );
+}
+
+void Parm::SetLinkContainerID( const string & id )
+{
+    if ( id != m_LinkContainerID )
+    {
+        m_LinkContainerID = id;
+        ParmMgr.ReIndexParmName( this );
+    }
+}
+
+//==== Names Are Indexed By ParmMgr ====//
+void Parm::SetName( const string & name )
+{
+    if ( name != m_Name )
+    {
+        m_Name = name;
+        ParmMgr.ReIndexParmName( this );
+    }
+}
+
+void Parm::SetGroupName( const string & name )
+{
+    if ( name != m_GroupName )
+    {
+        m_GroupName = name;
+        ParmMgr.ReIndexParmName( this );
+    }
+}
+
+void Parm::SetGroupDisplaySuffix( int num )
+{
+    if ( num != m_GroupDisplaySuffix )
+    {
+        m_GroupDisplaySuffix = num;
+        ParmMgr.ReIndexParmName( this );
+    }
 }
 
 //==== ChangeID ===//
@@ -145,6 +196,11 @@ bool Parm::SetValCheckLimits( double val )
 
     m_ChangeCnt = ParmMgr.GetChangeCnt();
 
+    if ( m_Container )
+    {
+        m_Container->ParmChangeCntBumped( m_ChangeCnt );
+    }
+
     return true;
 }
 
@@ -158,7 +214,14 @@ double Parm::Set( double val )
 
     if ( m_Container )
     {
-        m_Container->ParmChanged( this, SET );
+        if ( ParmMgr.InBulkDecode() )
+        {
+            ParmMgr.BulkParmChanged( this );
+        }
+        else
+        {
+            m_Container->ParmChanged( this, SET );
+        }
     }
 
     LinkMgr.ParmChanged( m_ID, true );
@@ -270,7 +333,8 @@ void Parm::EncodeXml( xmlNodePtr & node, bool detailed )
         XmlUtil::SetStringProp( dnode, "Name", m_Name );
         XmlUtil::SetStringProp( dnode, "GroupName", m_GroupName );
         XmlUtil::SetIntProp( dnode, "GroupDisplaySuffix", m_GroupDisplaySuffix );
-        XmlUtil::SetStringProp( dnode, "Descript", m_Descript );
+        string descript = *m_Descript;
+        XmlUtil::SetStringProp( dnode, "Descript", descript );
         XmlUtil::SetIntProp( dnode, "Type", m_Type );
         XmlUtil::SetDoubleProp( dnode, "UpperLimit", m_UpperLimit );
         XmlUtil::SetDoubleProp( dnode, "LowerLimit", m_LowerLimit );
@@ -310,10 +374,12 @@ void Parm::DecodeXml( xmlNodePtr & node, bool detailed )
             m_Name = XmlUtil::FindStringProp( n, "Name", m_Name );
             m_GroupName = XmlUtil::FindStringProp( n, "GroupName", m_GroupName );
             m_GroupDisplaySuffix = XmlUtil::FindIntProp( n, "GroupDisplaySuffix", m_GroupDisplaySuffix );
-            m_Descript = XmlUtil::FindStringProp( n, "Descript", m_Descript );
+            SetDescript( XmlUtil::FindStringProp( n, "Descript", *m_Descript ) );
             m_Type = XmlUtil::FindIntProp( n, "Type", m_Type );
             m_UpperLimit = XmlUtil::FindDoubleProp( n, "UpperLimit", m_UpperLimit );
             m_LowerLimit = XmlUtil::FindDoubleProp( n, "LowerLimit", m_LowerLimit );
+
+            ParmMgr.ReIndexParmName( this );
         }
     }
 
@@ -589,7 +655,14 @@ double FractionParm::Set( double val )
 
     if ( m_Container )
     {
-        m_Container->ParmChanged( this, SET );
+        if ( ParmMgr.InBulkDecode() )
+        {
+            ParmMgr.BulkParmChanged( this );
+        }
+        else
+        {
+            m_Container->ParmChanged( this, SET );
+        }
     }
 
     LinkMgr.ParmChanged( m_ID, true );
@@ -37,21 +37,18 @@ public:
                        double val, double lower, double upper );
 
     virtual string GetName() const                       { return m_Name; }
-    virtual void SetName( const string & name )          { m_Name = name; }
+    virtual void SetName( const string & name );
 
     virtual string GetGroupName() const                  { return m_GroupName; }
-    virtual void SetGroupName( const string & name )     { m_GroupName = name; }
-    virtual void SetGroupDisplaySuffix( int num )        { m_GroupDisplaySuffix = num; }
+    virtual void SetGroupName( const string & name );
+    virtual void SetGroupDisplaySuffix( int num );
 
     virtual string GetDisplayGroupName();
 
-    virtual void SetDescript( const string& d )
-    {
-        m_Descript = d;
-    }
+    virtual void SetDescript( const string& d );
     virtual string GetDescript() const
     {
-        return m_Descript;
+        return *m_Descript;
     }
 
     virtual ParmContainer* GetContainer() const          { return m_Container; }
@@ -63,6 +60,10 @@ public:
     }
     virtual void ChangeID( const string& newID );
 
+    //==== Dense Index Into ParmMgr, -1 If Not Registered ====//
+    int GetHandle() const                       { return m_Handle; }
+    void SetHandle( int handle )                { m_Handle = handle; }      // Assigned by ParmMgr
+
     virtual int  GetType() const
     {
         return m_Type;
@@ -142,10 +143,7 @@ public:
         return m_LinkUpdateFlag;
     }
 
-    virtual void SetLinkContainerID( const string & id )
-    {
-        m_LinkContainerID = id;
-    }
+    virtual void SetLinkContainerID( const string & id );
     virtual void ReSetLinkContainerID();
     virtual string GetLinkContainerID() const
     {
@@ -159,6 +157,7 @@ public:
 protected:
 
     string m_ID;
+    int m_Handle;
 
     string m_Name;
     string m_GroupName;
@@ -166,7 +165,7 @@ protected:
     ParmContainer* m_Container;
     int m_ChangeCnt;
 
-    std::string m_Descript;
+    const std::string* m_Descript;              // Shared, see ParmMgr::InternDescript
 
     int m_Type;
 
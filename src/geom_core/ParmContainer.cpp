@@ -69,6 +69,7 @@ ParmContainer::ParmContainer()
     m_ID = GenerateID();
     m_Name = string( "Default" );
     m_LateUpdateFlag = true; // Force update first time through.
+    m_LatestChangeCnt = 0;
     ParmMgr.AddParmContainer( this );
 }
 
@@ -127,20 +128,13 @@ void ParmContainer::ChangeID( string id )
     ParmMgr.AddParmContainer( this );
 }
 
-//==== Get Latest Change Cnt ====//
-int ParmContainer::GetLatestChangeCnt()
+//==== Track Latest Change Cnt As Parms Change ====//
+void ParmContainer::ParmChangeCntBumped( int cnt )
 {
-    int cnt = 0;
-    for ( int i = 0 ; i < ( int )m_ParmVec.size() ; i++ )
+    if ( cnt > m_LatestChangeCnt )
     {
-        string pid = m_ParmVec[i];
-        Parm* p = ParmMgr.FindParm( pid );
-        if ( p && p->GetChangeCnt() > cnt )
-        {
-            cnt = p->GetChangeCnt();
-        }
+        m_LatestChangeCnt = cnt;
     }
-    return cnt;
 }
 
 void ParmContainer::SetName( const string& name )
@@ -235,6 +229,12 @@ xmlNodePtr ParmContainer::DecodeXml( xmlNodePtr & node )
 
 }
 
+//==== One Notification For All Parms Set During A Bulk Decode ====//
+void ParmContainer::BulkParmChanged( Parm* last_parm )
+{
+    ParmChanged( last_parm, Parm::SET );
+}
+
 //==== Name Compare ====//
 bool ParmNameCompare( const string& a, const string& b )
 {
@@ -334,6 +334,13 @@ string ParmContainer::FindParm( int group_ind, int parm_ind  )
 //==== Find Parm ID Given GroupName and Parm Name ====//
 string ParmContainer::FindParm( const string& parm_name, const string& group_name  )
 {
+    //==== Indexed Lookup By Display Group (Linkable Parms) Or Own Group ====//
+    Parm* parm_ptr = ParmMgr.FindParm( m_ID, group_name, parm_name );
+    if ( parm_ptr )
+    {
+        return parm_ptr->GetID();
+    }
+
     string id;
     map< string, vector< string > >::iterator iter;
     iter = m_GroupParmMap.find( group_name );
@@ -37,6 +37,7 @@ public:
     virtual ~ParmContainer();
 
     virtual void ParmChanged( Parm* parm_ptr, int type ) = 0;
+    virtual void BulkParmChanged( Parm* last_parm );           // Parms Set During A Bulk Decode
 
     virtual void AddParm( const string & id );
     virtual void RemoveParm( const string & id );
@@ -45,7 +46,8 @@ public:
     virtual ParmContainer* GetParentContainerPtr();
 
     virtual void SetLateUpdateFlag( bool flag )     { m_LateUpdateFlag = flag; }
-    virtual int GetLatestChangeCnt();
+    virtual int GetLatestChangeCnt()                { return m_LatestChangeCnt; }
+    virtual void ParmChangeCntBumped( int cnt );
 
     virtual string GetID()                          { return m_ID; }
 
@@ -77,6 +79,8 @@ protected:
 
     bool m_LateUpdateFlag;
 
+    int m_LatestChangeCnt;                              // Largest change count of any parm ever held
+
     vector< string > m_ParmVec;                         // Parms in container
 
     string m_ParentContainer;
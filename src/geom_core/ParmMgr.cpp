@@ -8,6 +8,7 @@
 //////////////////////////////////////////////////////////////////////
 
 #include "ParmMgr.h"
+#include "Util.h"
 
 using std::map;
 using std::string;
@@ -20,6 +21,13 @@ ParmMgrSingleton::ParmMgrSingleton()
     m_NumParmChanges = 0;
     m_ChangeCnt = 0;
     m_LastUndoFlag = false;
+    m_DragUndoFlag = false;
+    m_UndoActiveFlag = false;
+    m_UndoGroupDepth = 0;
+    m_UndoGroupID = 0;
+    m_NextUndoGroupID = 1;
+    m_MaxUndoSize = 100000;
+    m_BulkDecodeDepth = 0;
     m_LastReset = "";
 }
 
@@ -38,21 +46,30 @@ bool ParmMgrSingleton::AddParm( Parm* p  )
         return false;
     }
 
-    //==== Check If Already Added ====//
-    if ( m_ParmMap.find( p->GetID() ) != m_ParmMap.end() )
+    bool added = false;
+
+    // Geoms may be updated concurrently (see Vehicle::Update) and other threads may look
+    // parms up meanwhile, so the maps are guarded by a reader-writer lock.
     {
-        return false;
+        WriteLockGuard lock( &m_MapLock );
+        //==== Check If Already Added ====//
+        if ( m_ParmMap.find( id ) == m_ParmMap.end() )
+        {
+            m_NumParmChanges++;
+            m_ParmMap[id] = p;
+            InsertParmName( p );
+            AssignHandle( p );
+            added = true;
+        }
     }
 
-    m_NumParmChanges++;
-    m_ParmMap[id] = p;
-
-    return true;
+    return added;
 }
 
 //==== Remove Parm From Map ====//
 void ParmMgrSingleton::RemoveParm( Parm* p  )
 {
+    WriteLockGuard lock( &m_MapLock );
     unordered_map< string, Parm* >::iterator iter;
     iter = m_ParmMap.find( p->GetID() );
 
@@ -61,6 +78,89 @@ void ParmMgrSingleton::RemoveParm( Parm* p  )
         m_NumParmChanges++;
         m_ParmMap.erase( iter );
     }
+    EraseParmName( p );
+    ReleaseHandle( p );
+}
+
+//==== Handle Slots ====//
+static const int HANDLE_SLOT_BITS = 24;
+static const int HANDLE_SLOT_MASK = ( 1 << HANDLE_SLOT_BITS ) - 1;
+
+// Callers hold m_MapLock for writing.  A parm added again keeps the handle it has.
+void ParmMgrSingleton::AssignHandle( Parm* parm_ptr )
+{
+    int handle = parm_ptr->GetHandle();
+    int slot = handle & HANDLE_SLOT_MASK;
+    if ( handle >= 0 && slot < ( int )m_HandleVec.size() && m_HandleVec[slot] == handle && m_HandleParmVec[slot] == parm_ptr )
+    {
+        return;
+    }
+
+    if ( !m_FreeHandleSlotVec.empty() )
+    {
+        slot = m_FreeHandleSlotVec.back();
+        m_FreeHandleSlotVec.pop_back();
+    }
+    else
+    {
+        slot = ( int )m_HandleVec.size();
+        m_HandleVec.push_back( slot );
+        m_HandleParmVec.push_back( NULL );
+    }
+
+    m_HandleParmVec[slot] = parm_ptr;
+    parm_ptr->SetHandle( m_HandleVec[slot] );
+}
+
+// Callers hold m_MapLock for writing.
+void ParmMgrSingleton::ReleaseHandle( Parm* parm_ptr )
+{
+    int handle = parm_ptr->GetHandle();
+    int slot = handle & HANDLE_SLOT_MASK;
+    if ( handle < 0 || slot >= ( int )m_HandleVec.size() || m_HandleVec[slot] != handle || m_HandleParmVec[slot] != parm_ptr )
+    {
+        return;
+    }
+
+    // Bump the reuse count, wrapping before the sign bit
+    int reuse = ( ( handle >> HANDLE_SLOT_BITS ) + 1 ) & 0x7F;
+    m_HandleVec[slot] = ( reuse << HANDLE_SLOT_BITS ) | slot;
+    m_HandleParmVec[slot] = NULL;
+    m_FreeHandleSlotVec.push_back( slot );
+    parm_ptr->SetHandle( -1 );
+}
+
+//==== Find Parm Given Handle ====//
+Parm* ParmMgrSingleton::FindParm( int handle )
+{
+    Parm* parm_ptr = NULL;
+
+    if ( handle >= 0 )
+    {
+        int slot = handle & HANDLE_SLOT_MASK;
+
+        ReadLockGuard lock( &m_MapLock );
+        if ( slot < ( int )m_HandleVec.size() && m_HandleVec[slot] == handle )
+        {
+            parm_ptr = m_HandleParmVec[slot];
+        }
+    }
+    return parm_ptr;
+}
+
+//==== Size Of The Handle Table, Live And Free Slots ====//
+int ParmMgrSingleton::GetNumHandleSlots()
+{
+    ReadLockGuard lock( &m_MapLock );
+    return ( int )m_HandleVec.size();
+}
+
+//==== Shared Copy Of A Description ====//
+// Entries are never erased, so the returned pointer stays valid.
+const string* ParmMgrSingleton::InternDescript( const string & descript )
+{
+    WriteLockGuard lock( &m_MapLock );
+    return &( *m_DescriptSet.insert( descript ).first );
 }
 
 //==== Add Parm Container To Map ====//
@@ -68,14 +168,18 @@ void ParmMgrSingleton::AddParmContainer( ParmContainer* pc  )
 {
     if ( pc )
     {
-        m_NumParmChanges++;
-        m_ParmContainerMap[pc->GetID()] = pc;
+        {
+            WriteLockGuard lock( &m_MapLock );
+            m_NumParmChanges++;
+            m_ParmContainerMap[pc->GetID()] = pc;
+        }
     }
 }
 
 //==== Remove Parm Container From Map ====//
 void ParmMgrSingleton::RemoveParmContainer( ParmContainer* pc  )
 {
+    WriteLockGuard lock( &m_MapLock );
     unordered_map< string, ParmContainer* >::iterator iter;
     iter = m_ParmContainerMap.find( pc->GetID() );
 
@@ -86,112 +190,377 @@ void ParmMgrSingleton::RemoveParmContainer( ParmContainer* pc  )
     }
 }
 
+//==== Next Value Of Global Change Counter ====//
+int ParmMgrSingleton::GetChangeCnt()
+{
+    int cnt;
+
+    #pragma omp critical ( ParmMgrChangeCnt )
+    {
+        m_ChangeCnt++;
+        cnt = m_ChangeCnt;
+    }
+    return cnt;
+}
+
+void ParmMgrSingleton::BeginBulkDecode()
+{
+    m_BulkDecodeDepth++;
+}
+
+void ParmMgrSingleton::EndBulkDecode()
+{
+    if ( m_BulkDecodeDepth <= 0 )
+    {
+        return;
+    }
+
+    m_BulkDecodeDepth--;
+    if ( m_BulkDecodeDepth > 0 )
+    {
+        return;
+    }
+
+    vector< pair< string, string > > change_vec;
+    change_vec.swap( m_BulkChangeVec );
+    m_BulkChangeIndexMap.clear();
+
+    for ( int i = 0 ; i < ( int )change_vec.size() ; i++ )
+    {
+        ParmContainer* pc = FindParmContainer( change_vec[i].first );
+        Parm* p = FindParm( change_vec[i].second );
+        if ( pc && p )
+        {
+            pc->BulkParmChanged( p );
+        }
+    }
+}
+
+//==== Record Container Of A Parm Set During A Bulk Decode ====//
+void ParmMgrSingleton::BulkParmChanged( Parm* parm_ptr )
+{
+    ParmContainer* pc = parm_ptr->GetContainer();
+    if ( !pc )
+    {
+        return;
+    }
+
+    #pragma omp critical ( ParmMgrBulk )
+    {
+        unordered_map< string, int >::iterator iter = m_BulkChangeIndexMap.find( pc->GetID() );
+        if ( iter == m_BulkChangeIndexMap.end() )
+        {
+            m_BulkChangeIndexMap[ pc->GetID() ] = ( int )m_BulkChangeVec.size();
+            m_BulkChangeVec.push_back( make_pair( pc->GetID(), parm_ptr->GetID() ) );
+        }
+        else
+        {
+            m_BulkChangeVec[ iter->second ].second = parm_ptr->GetID();
+        }
+    }
+}
+
 //==== Find Parm GivenID ====//
 Parm* ParmMgrSingleton::FindParm( const string & id )
 {
-    unordered_map< string, Parm* >::iterator iter;
+    Parm* parm_ptr = NULL;
 
-    iter = m_ParmMap.find( id );
-    if ( iter != m_ParmMap.end() )
     {
-        return iter->second;
+        ReadLockGuard lock( &m_MapLock );
+        unordered_map< string, Parm* >::iterator iter;
+
+        iter = m_ParmMap.find( id );
+        if ( iter != m_ParmMap.end() )
+        {
+            parm_ptr = iter->second;
+        }
     }
-    return NULL;
+    return parm_ptr;
+}
+
+//==== Find Parm Given Container ID, Group And Name ====//
+// Group is the parm's own group name with its own container, or (as the API and GUI
+// search) its display group name with its link container.
+Parm* ParmMgrSingleton::FindParm( const string & container_id, const string & group, const string & name )
+{
+    Parm* parm_ptr = NULL;
+    string key = ParmNameKey( container_id, group, name );
+
+    {
+        ReadLockGuard lock( &m_MapLock );
+        unordered_map< string, Parm* >::iterator iter = m_ParmDisplayNameMap.find( key );
+        if ( iter != m_ParmDisplayNameMap.end() )
+        {
+            parm_ptr = iter->second;
+        }
+        else
+        {
+            iter = m_ParmNameMap.find( key );
+            if ( iter != m_ParmNameMap.end() )
+            {
+                parm_ptr = iter->second;
+            }
+        }
+    }
+    return parm_ptr;
 }
 
 //==== Find Parm Name Group Container ====//
 string ParmMgrSingleton::FindParmID( const string & name, const string & group, const string & container )
 {
-    unordered_map< string, Parm* >::iterator iter;
+    string id;
 
-    for ( iter = m_ParmMap.begin() ; iter != m_ParmMap.end() ; ++iter )
+    //==== Containers Are Far Fewer Than Parms - Match Their Names Then Use Index ====//
     {
-        Parm* parm_ptr = iter->second;
-        if ( parm_ptr )
+        ReadLockGuard lock( &m_MapLock );
+        unordered_map< string, ParmContainer* >::iterator iter;
+        for ( iter = m_ParmContainerMap.begin() ; iter != m_ParmContainerMap.end() && id.empty() ; ++iter )
         {
-            if ( name == parm_ptr->GetName() && 
-                 group == parm_ptr->GetGroupName() &&
-                 container == parm_ptr->GetContainer()->GetName() )
+            if ( iter->second && iter->second->GetName() == container )
             {
-                return parm_ptr->GetID();
+                unordered_map< string, Parm* >::iterator piter = m_ParmNameMap.find( ParmNameKey( iter->first, group, name ) );
+                if ( piter != m_ParmNameMap.end() )
+                {
+                    id = piter->second->GetID();
+                }
             }
         }
     }
 
-    return string();
+    return id;
+}
+
+//==== Name Index Maintenance ====//
+string ParmMgrSingleton::ParmNameKey( const string & container_id, const string & group, const string & name )
+{
+    string key = container_id;
+    key.push_back( '\0' );
+    key.append( group );
+    key.push_back( '\0' );
+    key.append( name );
+    return key;
+}
+
+// Callers hold m_MapLock for writing.  The first parm indexed under a key keeps it.
+void ParmMgrSingleton::InsertParmName( Parm* parm_ptr )
+{
+    pair< string, string > keys;
+    keys.first = ParmNameKey( parm_ptr->GetContainerID(), parm_ptr->GetGroupName(), parm_ptr->GetName() );
+    keys.second = ParmNameKey( parm_ptr->GetLinkContainerID(), parm_ptr->GetDisplayGroupName(), parm_ptr->GetName() );
+
+    m_ParmNameKeyMap[ parm_ptr ] = keys;
+    m_ParmNameMap.insert( make_pair( keys.first, parm_ptr ) );
+    m_ParmDisplayNameMap.insert( make_pair( keys.second, parm_ptr ) );
+}
+
+void ParmMgrSingleton::EraseParmName( Parm* parm_ptr )
+{
+    unordered_map< Parm*, pair< string, string > >::iterator kiter = m_ParmNameKeyMap.find( parm_ptr );
+    if ( kiter == m_ParmNameKeyMap.end() )
+    {
+        return;
+    }
+
+    unordered_map< string, Parm* >::iterator iter = m_ParmNameMap.find( kiter->second.first );
+    if ( iter != m_ParmNameMap.end() && iter->second == parm_ptr )
+    {
+        m_ParmNameMap.erase( iter );
+    }
+
+    iter = m_ParmDisplayNameMap.find( kiter->second.second );
+    if ( iter != m_ParmDisplayNameMap.end() && iter->second == parm_ptr )
+    {
+        m_ParmDisplayNameMap.erase( iter );
+    }
+
+    m_ParmNameKeyMap.erase( kiter );
+}
+
+//==== Called When A Parm's Name, Group Or Container Changes ====//
+void ParmMgrSingleton::ReIndexParmName( Parm* parm_ptr )
+{
+    WriteLockGuard lock( &m_MapLock );
+    unordered_map< string, Parm* >::iterator iter = m_ParmMap.find( parm_ptr->GetID() );
+    if ( iter != m_ParmMap.end() && iter->second == parm_ptr )
+    {
+        EraseParmName( parm_ptr );
+        InsertParmName( parm_ptr );
+    }
 }
 
 
 //==== Find Parm Container GivenID ====//
 ParmContainer* ParmMgrSingleton::FindParmContainer( const string & id )
 {
-    unordered_map< string, ParmContainer* >::iterator iter;
+    ParmContainer* pc = NULL;
 
-    iter = m_ParmContainerMap.find( id );
-    if ( iter != m_ParmContainerMap.end() )
     {
-        return iter->second;
+        ReadLockGuard lock( &m_MapLock );
+        unordered_map< string, ParmContainer* >::iterator iter;
+
+        iter = m_ParmContainerMap.find( id );
+        if ( iter != m_ParmContainerMap.end() )
+        {
+            pc = iter->second;
+        }
     }
-    return NULL;
+    return pc;
 }
 
 
 //==== Add Parm To Undo Stack ====//
+// A drag records one entry holding the value from before the drag began, closed by
+// the final non-drag set of the same parm.  Inside an undo group only the first
+// change of each parm is kept.
 void ParmMgrSingleton::AddToUndoStack( Parm* parm_ptr, bool drag_flag )
 {
-    ParmUndo undo( parm_ptr );
+    if ( m_UndoActiveFlag || m_MaxUndoSize <= 0 )
+    {
+        return;
+    }
 
-    if ( !drag_flag )
+    bool same_parm = m_LastUndoFlag && m_LastUndo.GetID() == parm_ptr->GetID();
+
+    if ( m_DragUndoFlag && same_parm )
+    {
+        // Continuing or ending the drag already recorded.
+        m_DragUndoFlag = drag_flag;
+        return;
+    }
+
+    if ( m_UndoGroupID != 0 && InUndoGroup( parm_ptr->GetID() ) )
+    {
+        m_DragUndoFlag = false;
+        return;
+    }
+
+    if ( m_LastUndoFlag )
     {
-        if ( m_LastUndoFlag )
-            m_ParmUndoStack.push( m_LastUndo );
-        m_LastUndo = undo;
-        m_LastUndoFlag = true;
+        PushUndo( m_LastUndo );
     }
+    m_LastUndo = ParmUndo( parm_ptr, m_UndoGroupID );
+    m_LastUndoFlag = true;
+    m_DragUndoFlag = drag_flag;
 }
 
-//==== Add Parm To Undo Stack ====//
+//==== Undo Last Change Or Group Of Changes ====//
 void ParmMgrSingleton::UnDo()
 {
     if ( m_LastUndoFlag )
     {
-        m_ParmUndoStack.push( m_LastUndo );
+        PushUndo( m_LastUndo );
         m_LastUndoFlag = false;
     }
+    m_DragUndoFlag = false;
 
     if ( m_ParmUndoStack.size() == 0 )          // Nothing To Undo
     {
         return;
     }
 
-    ParmUndo top = m_ParmUndoStack.top();       // Top Undo
-    m_ParmUndoStack.pop();                      // Remove It
+    int group_id = m_ParmUndoStack.back().GetGroupID();
 
-    Parm* parm_ptr = FindParm( top.GetID() );
-    if ( parm_ptr )
+    m_UndoActiveFlag = true;
+    do
     {
-        parm_ptr->SetFromDevice( top.GetLastVal(), true );    // Set Last Val - Don't Add To Stack
+        ParmUndo top = m_ParmUndoStack.back();      // Top Undo
+        m_ParmUndoStack.pop_back();                 // Remove It
+
+        Parm* parm_ptr = FindParm( top.GetID() );
+        if ( parm_ptr )
+        {
+            parm_ptr->SetFromDevice( top.GetLastVal(), true );    // Set Last Val - Don't Add To Stack
+        }
     }
+    while ( group_id != 0 && m_ParmUndoStack.size() && m_ParmUndoStack.back().GetGroupID() == group_id );
+    m_UndoActiveFlag = false;
 }
 
-//==== Create A Unique ID  =====//
-string ParmMgrSingleton::GenerateID( int length )
+//==== Undo Groups Nest - Changes Until The Outermost End Are Undone Together ====//
+void ParmMgrSingleton::BeginUndoGroup()
 {
-    static bool seed = false;
-    if ( !seed )
+    if ( m_UndoGroupDepth == 0 )
     {
-        seed = true;
-        srand( ( unsigned int )time( NULL ) );
+        m_UndoGroupID = m_NextUndoGroupID++;
     }
+    m_UndoGroupDepth++;
+}
 
-    static char str[256];
-    for ( int i = 0 ; i < length ; i++ )
+void ParmMgrSingleton::EndUndoGroup()
+{
+    if ( m_UndoGroupDepth <= 0 )
     {
-        str[i] = ( char )( ( rand() % 26 ) + 65 );
+        return;
     }
-    string id( str, length );
 
-    return id;
+    m_UndoGroupDepth--;
+    if ( m_UndoGroupDepth == 0 )
+    {
+        m_UndoGroupID = 0;
+    }
+}
+
+void ParmMgrSingleton::ClearUndoStack()
+{
+    m_ParmUndoStack.clear();
+    m_LastUndoFlag = false;
+    m_DragUndoFlag = false;
+}
+
+size_t ParmMgrSingleton::UndoMemoryUsage() const
+{
+    // Parm IDs are short enough that most fit in the string object itself
+    return ( m_ParmUndoStack.size() + 1 ) * sizeof( ParmUndo );
+}
+
+//==== Limit Undo Entries - Oldest Are Evicted ====//
+void ParmMgrSingleton::SetMaxUndoSize( int n )
+{
+    m_MaxUndoSize = max( n, 0 );
+
+    while ( ( int )m_ParmUndoStack.size() > m_MaxUndoSize )
+    {
+        m_ParmUndoStack.pop_front();
+    }
+}
+
+void ParmMgrSingleton::PushUndo( const ParmUndo & undo )
+{
+    m_ParmUndoStack.push_back( undo );
+
+    while ( ( int )m_ParmUndoStack.size() > m_MaxUndoSize )
+    {
+        m_ParmUndoStack.pop_front();
+    }
+}
+
+//==== Check If Parm Already Has An Entry In The Current Group ====//
+// Group entries are contiguous at the top of the stack.
+bool ParmMgrSingleton::InUndoGroup( const string & parm_id )
+{
+    if ( m_LastUndoFlag && m_LastUndo.GetGroupID() == m_UndoGroupID && m_LastUndo.GetID() == parm_id )
+    {
+        return true;
+    }
+
+    for ( int i = ( int )m_ParmUndoStack.size() - 1 ; i >= 0 ; i-- )
+    {
+        if ( m_ParmUndoStack[i].GetGroupID() != m_UndoGroupID )
+        {
+            break;
+        }
+        if ( m_ParmUndoStack[i].GetID() == parm_id )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//==== Create A Unique ID  =====//
+string ParmMgrSingleton::GenerateID( int length )
+{
+    return GenerateRandomID( length );
 }
 
 
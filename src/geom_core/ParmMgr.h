@@ -16,10 +16,12 @@
 #include "Parm.h"
 #include "ParmUndo.h"
 #include "MessageMgr.h"
+#include "RWLock.h"
 
 #include <map>
 #include <unordered_map>
-#include <stack>
+#include <unordered_set>
+#include <deque>
 
 using std::string;
 using std::unordered_map;
@@ -35,19 +37,57 @@ private:
 
     bool m_LastUndoFlag;
     ParmUndo m_LastUndo;
-    std::stack< ParmUndo > m_ParmUndoStack;
+    std::deque< ParmUndo > m_ParmUndoStack;         // Oldest Entries At Front Are Evicted First
+
+    bool m_DragUndoFlag;                            // m_LastUndo Started A Drag Still In Progress
+    bool m_UndoActiveFlag;                          // Changes Made By UnDo Are Not Recorded
+    int m_UndoGroupDepth;
+    int m_UndoGroupID;                              // Group Of Entries Being Recorded, 0 If None
+    int m_NextUndoGroupID;
+    int m_MaxUndoSize;
+
+    void PushUndo( const ParmUndo & undo );
+    bool InUndoGroup( const string & parm_id );
 
     string m_ActiveParmID;
 
     unordered_map< string, Parm* > m_ParmMap;                       // ID->Parm Map
     unordered_map< string, ParmContainer* > m_ParmContainerMap;     // ID->Parm Container Map
 
+    //==== Name Indices: ( Container ID, Group, Name )->Parm ====//
+    unordered_map< string, Parm* > m_ParmNameMap;                   // Own container and group name
+    unordered_map< string, Parm* > m_ParmDisplayNameMap;            // Link container and display group name
+    unordered_map< Parm*, pair< string, string > > m_ParmNameKeyMap;    // Parm->Its Key In Each
+
+    //==== Dense Handle Table: Handle->Parm ====//
+    // A handle is a slot index in the low bits and the slot's reuse count in the high bits,
+    // so a handle kept after its parm was deleted finds nothing.
+    vector< Parm* > m_HandleParmVec;
+    vector< int > m_HandleVec;                                      // Current Handle Of Each Slot
+    vector< int > m_FreeHandleSlotVec;
+
+    void AssignHandle( Parm* parm_ptr );
+    void ReleaseHandle( Parm* parm_ptr );
+
+    //==== Descriptions Are Shared By Every Parm With The Same Text ====//
+    std::unordered_set< string > m_DescriptSet;
+
+    RWLock m_MapLock;                                               // Guards The Maps Above
+
+    static string ParmNameKey( const string & container_id, const string & group, const string & name );
+    void InsertParmName( Parm* parm_ptr );
+    void EraseParmName( Parm* parm_ptr );
+
     unordered_map< string, string > m_IDRemap;                      // oldID->newID Map
     string m_LastReset;
 
     int m_NumParmChanges;
     int m_ChangeCnt;
 
+    int m_BulkDecodeDepth;
+    vector< pair< string, string > > m_BulkChangeVec;               // ( Container ID, Last Parm ID )
+    unordered_map< string, int > m_BulkChangeIndexMap;              // Container ID->Index In m_BulkChangeVec
+
     string RemapID( const string & oldID, const string & suggestID, int size );
 
 public:
@@ -63,11 +103,23 @@ public:
     void RemoveParmContainer( ParmContainer* parm_container_ptr );
 
     Parm* FindParm( const string & id );
+    Parm* FindParm( int handle );
+    int GetNumHandleSlots();
+    const string* InternDescript( const string & descript );
+    Parm* FindParm( const string & container_id, const string & group, const string & name );
     string FindParmID( const string & name, const string & group, const string & container );
+    void ReIndexParmName( Parm* parm_ptr );
     ParmContainer* FindParmContainer( const string & id );
 
     void AddToUndoStack( Parm* parm_ptr, bool drag_flag );
     void UnDo();
+    void BeginUndoGroup();
+    void EndUndoGroup();
+    void ClearUndoStack();
+    void SetMaxUndoSize( int n );
+    int GetMaxUndoSize()                    { return m_MaxUndoSize; }
+    int GetUndoSize()                       { return ( int )m_ParmUndoStack.size() + ( m_LastUndoFlag ? 1 : 0 ); }
+    size_t UndoMemoryUsage() const;         // Approximate bytes held by the undo stack
 
     static string GenerateID( int length );
 
@@ -79,7 +131,14 @@ public:
     Parm* GetActiveParm()                   { return FindParm( m_ActiveParmID ); }
     int GetNumParmChanges()                 { return m_NumParmChanges; }
     void IncNumParmChanges()                { m_NumParmChanges++; }
-    int GetChangeCnt()                      { m_ChangeCnt++; return m_ChangeCnt; }
+    int GetChangeCnt();
+    int GetLastChangeCnt()                  { return m_ChangeCnt; }
+
+    //==== Parms Set While Decoding Notify Their Container Once When Decoding Ends ====//
+    void BeginBulkDecode();
+    void EndBulkDecode();
+    bool InBulkDecode()                     { return m_BulkDecodeDepth > 0; }
+    void BulkParmChanged( Parm* parm_ptr );
 
     static Parm* CreateParm( int type );
 
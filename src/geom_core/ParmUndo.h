@@ -22,17 +22,19 @@ class ParmUndo
 public:
 
     ParmUndo();
-    ParmUndo( Parm* parm_ptr );
+    ParmUndo( Parm* parm_ptr, int group_id = 0 );
 
     string GetID()              { return m_ParmID; }
     double GetLastVal()         { return m_LastVal; }
     void SetLastVal( double v ) { m_LastVal = v; }
+    int GetGroupID()            { return m_GroupID; }
 
 protected:
 
     string m_ParmID;
     double m_Val;
     double m_LastVal;
+    int m_GroupID;              // Entries Sharing A Non-Zero Group Are Undone Together
 
 };
 
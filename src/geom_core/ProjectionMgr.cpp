@@ -15,6 +15,11 @@
 
 #include "triangle.h"
 
+#include <algorithm>
+
+// Triangles unioned together in one Clipper pass before chunks are merged.
+#define UNION_CHUNK_SIZE 2048
+
 //==== Constructor ====//
 ProjectionMgrSingleton::ProjectionMgrSingleton()
 {
@@ -29,6 +34,9 @@ ProjectionMgrSingleton::ProjectionMgrSingleton()
     m_YComp.Init( "YComp", "Projection", VehicleMgr.GetVehicle(), 0.0, -1.0, 1.0 );
     m_ZComp.Init( "ZComp", "Projection", VehicleMgr.GetVehicle(), 0.0, -1.0, 1.0 );
 
+    m_TessFactor.Init( "TessFactor", "Projection", VehicleMgr.GetVehicle(), 1.0, 0.05, 1.0 );
+    m_TessFactor.SetDescript( "Projection Tessellation Multiplier, Less Than One Is Coarser And Faster" );
+
     m_TargetSetIndex = DEFAULT_SET;
     m_BoundarySetIndex = DEFAULT_SET;
 
@@ -518,7 +526,9 @@ void ProjectionMgrSingleton::ExportProjectLines( vector < TMesh* > targetTMeshVe
         proj_dir_vec[vsp::Y_DIR] = vec2d( 0, 2 );
         proj_dir_vec[vsp::Z_DIR] = vec2d( 0, 1 );
 
-        for ( int k = 0; k < proj_dir_vec.size(); k++ )
+        // Each direction only fills its own slot of the projection vectors.
+        #pragma omp parallel for schedule( dynamic, 1 )
+        for ( int k = 0; k < ( int )proj_dir_vec.size(); k++ )
         {
             vector < ClipperLib::Paths > targetvec;
             vector < string > targetids;
@@ -584,7 +594,7 @@ void ProjectionMgrSingleton::GetMesh( int set, vector < TMesh* > & tmv )
         {
             if ( geom_ptr->GetSetFlag( set ) )
             {
-                vector< TMesh* > tMeshVec = geom_ptr->CreateTMeshVec();
+                vector< TMesh* > tMeshVec = CreateTMeshVec( geom_ptr );
                 for ( int j = 0 ; j < ( int )tMeshVec.size() ; j++ )
                 {
                     tmv.push_back( tMeshVec[j] );
@@ -601,7 +611,7 @@ void ProjectionMgrSingleton::GetMesh( string geom, vector < TMesh* > & tmv )
     Geom* geom_ptr = veh->FindGeom( geom );
     if ( geom_ptr )
     {
-        vector< TMesh* > tMeshVec = geom_ptr->CreateTMeshVec();
+        vector< TMesh* > tMeshVec = CreateTMeshVec( geom_ptr );
         for ( int j = 0 ; j < ( int )tMeshVec.size() ; j++ )
         {
             tmv.push_back( tMeshVec[j] );
@@ -609,10 +619,104 @@ void ProjectionMgrSingleton::GetMesh( string geom, vector < TMesh* > & tmv )
     }
 }
 
-void ProjectionMgrSingleton::TransformMesh( vector < TMesh* > & tmv, const Matrix4d & mat )
+//==== Mesh A Geom At The Projection Tessellation ====//
+// A coarser tessellation is only applied while the mesh is built, then the Geom
+// is restored.
+vector < TMesh* > ProjectionMgrSingleton::CreateTMeshVec( Geom* geom_ptr )
+{
+    double factor = m_TessFactor();
+
+    if ( factor == 1.0 )
+    {
+        return geom_ptr->CreateTMeshVec();
+    }
+
+    vector < int > tess_vec;
+    ScaleTess( geom_ptr, factor, tess_vec );
+    geom_ptr->Update( true );
+
+    vector < TMesh* > tmv = geom_ptr->CreateTMeshVec();
+
+    RestoreTess( geom_ptr, tess_vec );
+    geom_ptr->Update( true );
+
+    return tmv;
+}
+
+//==== Scale W And Per Section U Tessellation, Keeping The Original Values ====//
+void ProjectionMgrSingleton::ScaleTess( Geom* geom_ptr, double factor, vector < int > & tess_vec )
+{
+    tess_vec.clear();
+
+    tess_vec.push_back( geom_ptr->m_TessW() );
+    geom_ptr->m_TessW.Set( ( int )( geom_ptr->m_TessW() * factor ) );
+
+    int num_xsec_surf = geom_ptr->GetNumXSecSurfs();
+
+    if ( num_xsec_surf > 0 ) // Segmented geoms are tessellated by section
+    {
+        for ( int j = 0; j < num_xsec_surf; j++ )
+        {
+            XSecSurf* xsecsurf = geom_ptr->GetXSecSurf( j );
+
+            if ( xsecsurf )
+            {
+                for ( int k = 0; k < xsecsurf->NumXSec(); k++ )
+                {
+                    XSec* curr_xsec = xsecsurf->FindXSec( k );
+
+                    if ( curr_xsec )
+                    {
+                        tess_vec.push_back( curr_xsec->m_SectTessU() );
+                        curr_xsec->m_SectTessU.Set( ( int )( curr_xsec->m_SectTessU() * factor ) );
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        tess_vec.push_back( geom_ptr->m_TessU() );
+        geom_ptr->m_TessU.Set( ( int )( geom_ptr->m_TessU() * factor ) );
+    }
+}
+
+void ProjectionMgrSingleton::RestoreTess( Geom* geom_ptr, const vector < int > & tess_vec )
 {
-    vec3d zeroV = mat.xform( vec3d( 0.0, 0.0, 0.0 ) );
+    int itess = 0;
+
+    geom_ptr->m_TessW.Set( tess_vec[ itess++ ] );
+
+    int num_xsec_surf = geom_ptr->GetNumXSecSurfs();
+
+    if ( num_xsec_surf > 0 )
+    {
+        for ( int j = 0; j < num_xsec_surf; j++ )
+        {
+            XSecSurf* xsecsurf = geom_ptr->GetXSecSurf( j );
+
+            if ( xsecsurf )
+            {
+                for ( int k = 0; k < xsecsurf->NumXSec(); k++ )
+                {
+                    XSec* curr_xsec = xsecsurf->FindXSec( k );
+
+                    if ( curr_xsec )
+                    {
+                        curr_xsec->m_SectTessU.Set( tess_vec[ itess++ ] );
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        geom_ptr->m_TessU.Set( tess_vec[ itess++ ] );
+    }
+}
 
+void ProjectionMgrSingleton::TransformMesh( vector < TMesh* > & tmv, const Matrix4d & mat )
+{
     for ( int i = 0 ; i < ( int )tmv.size() ; i++ )
     {
         for ( int j = 0 ; j < ( int )tmv[i]->m_TVec.size() ; j++ )
@@ -621,20 +725,14 @@ void ProjectionMgrSingleton::TransformMesh( vector < TMesh* > & tmv, const Matri
             {
                tmv[i]->m_TVec[j]->GetTriNode( k )->m_Pnt = mat.xform( tmv[i]->m_TVec[j]->GetTriNode( k )->m_Pnt );
             }
-            tmv[i]->m_TVec[j]->m_Norm = mat.xform( tmv[i]->m_TVec[j]->m_Norm ) - zeroV;
+            tmv[i]->m_TVec[j]->m_Norm = mat.xformnorm( tmv[i]->m_TVec[j]->m_Norm );
         }
     }
 }
 
 void ProjectionMgrSingleton::TransformPolyVec( vector < vector < vec3d > > & polyvec, const Matrix4d & mat )
 {
-    for ( int i = 0 ; i < ( int )polyvec.size() ; i++ )
-    {
-        for ( int j = 0 ; j < ( int )polyvec[i].size() ; j++ )
-        {
-            polyvec[i][j] = mat.xform( polyvec[i][j] );
-        }
-    }
+    mat.xformmat( polyvec );
 }
 
 void ProjectionMgrSingleton::CleanMesh( vector < TMesh* > & tmv )
@@ -810,18 +908,52 @@ void ProjectionMgrSingleton::Union( ClipperLib::Paths & pths, ClipperLib::Paths
     SimplifyPolygons( sol );
 }
 
+//==== Union Of Many Path Sets As A Tree Of Pairwise Unions ====//
+// Neighboring sets are merged in parallel, halving the count each round, so no
+// single Clipper call has to sweep every path at once.
 void ProjectionMgrSingleton::Union( vector < ClipperLib::Paths > & pthsvec,  ClipperLib::Paths & sol )
 {
-    // Append all paths into one path.
-    ClipperLib::Paths pth;
+    if ( pthsvec.size() <= 2 )
+    {
+        // Append all paths into one path.
+        ClipperLib::Paths pth;
+
+        for ( int j = 0; j < pthsvec.size(); j++ )
+        {
+            pth.insert( pth.end(), pthsvec[j].begin(), pthsvec[j].end() );
+        }
+
+        // Then union into solution.
+        Union( pth, sol );
+        return;
+    }
+
+    vector < ClipperLib::Paths > level = pthsvec;
 
-    for ( int j = 0; j < pthsvec.size(); j++ )
+    while ( level.size() > 2 )
     {
-        pth.insert( pth.end(), pthsvec[j].begin(), pthsvec[j].end() );
+        int npair = ( int )level.size() / 2;
+        vector < ClipperLib::Paths > next( ( level.size() + 1 ) / 2 );
+
+        #pragma omp parallel for schedule( dynamic, 1 )
+        for ( int i = 0; i < npair; i++ )
+        {
+            ClipperLib::Paths pth = level[ 2 * i ];
+            pth.insert( pth.end(), level[ 2 * i + 1 ].begin(), level[ 2 * i + 1 ].end() );
+
+            Union( pth, next[i] );
+        }
+
+        // Odd set out moves up a level unchanged.
+        if ( level.size() % 2 )
+        {
+            next.back().swap( level.back() );
+        }
+
+        level.swap( next );
     }
 
-    // Then union into solution.
-    Union( pth, sol );
+    Union( level, sol );
 }
 
 void ProjectionMgrSingleton::Union( vector < ClipperLib::Paths > & pthsvec, vector < ClipperLib::Paths > & solvec, vector < string > & ids )
@@ -835,21 +967,52 @@ void ProjectionMgrSingleton::Union( vector < ClipperLib::Paths > & pthsvec, vect
 
     solvec.resize( uids.size() );
 
+    // Split each component's triangles into chunks, so large components are
+    // spread over threads and no single Clipper pass sweeps every triangle.
+    vector < ClipperLib::Paths > chunkvec;
+    vector < int > chunkcomp;
+
     for ( int i = 0; i < uids.size(); i++ )
     {
-        // Append all matching paths into one path.
-        ClipperLib::Paths pth;
-
         for ( int j = 0; j < ids.size(); j++ )
         {
             if ( uids[i] == ids[j] ) // Match, append.
             {
-                pth.insert( pth.end(), pthsvec[j].begin(), pthsvec[j].end() );
+                for ( int k = 0; k < ( int )pthsvec[j].size(); k += UNION_CHUNK_SIZE )
+                {
+                    int kend = std::min( k + UNION_CHUNK_SIZE, ( int )pthsvec[j].size() );
+
+                    chunkvec.push_back( ClipperLib::Paths( pthsvec[j].begin() + k, pthsvec[j].begin() + kend ) );
+                    chunkcomp.push_back( i );
+                }
+            }
+        }
+    }
+
+    vector < ClipperLib::Paths > chunksolvec( chunkvec.size() );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int c = 0; c < ( int )chunkvec.size(); c++ )
+    {
+        Union( chunkvec[c], chunksolvec[c] );
+        ClipperLib::Paths().swap( chunkvec[c] );
+    }
+
+    // Then merge each component's simplified chunks into its own set.
+    for ( int i = 0; i < uids.size(); i++ )
+    {
+        vector < ClipperLib::Paths > compvec;
+
+        for ( int c = 0; c < ( int )chunksolvec.size(); c++ )
+        {
+            if ( chunkcomp[c] == i )
+            {
+                compvec.push_back( ClipperLib::Paths() );
+                compvec.back().swap( chunksolvec[c] );
             }
         }
 
-        // Then union into its own set.
-        Union( pth, solvec[i] );
+        Union( compvec, solvec[i] );
     }
 
     // Copy unique ids over passed in id vector.
@@ -980,12 +1143,12 @@ void ProjectionMgrSingleton::Triangulate()
     ptcnt = 0;
     for ( int i = 0 ; i < out.numberoftriangles ; i++ )
     {
-        TTri* tPtr = new TTri();
+        TTri* tPtr = tMesh->NewTri();
 
         //==== Put Nodes Into Tri ====//
-        tPtr->m_N0 = new TNode();
-        tPtr->m_N1 = new TNode();
-        tPtr->m_N2 = new TNode();
+        tPtr->m_N0 = tMesh->NewNode();
+        tPtr->m_N1 = tMesh->NewNode();
+        tPtr->m_N2 = tMesh->NewNode();
 
         tPtr->m_N0->m_Pnt = outpts[ out.trianglelist[ptcnt] ];
         tPtr->m_N1->m_Pnt = outpts[ out.trianglelist[ptcnt + 1] ];
@@ -1003,7 +1166,7 @@ void ProjectionMgrSingleton::Triangulate()
 
         if ( PtInHole( c2d ) )
         {
-            delete tPtr;
+            FreeTObj( tPtr );
         }
         else
         {
@@ -23,6 +23,8 @@
 #include <vector>
 #include <string>
 
+class Geom;
+
 using std::string;
 using std::vector;
 
@@ -81,6 +83,8 @@ public:
     Parm m_YComp;
     Parm m_ZComp;
 
+    Parm m_TessFactor;
+
     string m_TargetGeomID;
     string m_BoundaryGeomID;
     string m_DirectionGeomID;
@@ -97,6 +101,10 @@ protected:
 
     virtual void CleanMesh( vector < TMesh* > & tmv );
 
+    virtual void ScaleTess( Geom* geom_ptr, double factor, vector < int > & tess_vec );
+    virtual void RestoreTess( Geom* geom_ptr, const vector < int > & tess_vec );
+    virtual vector < TMesh* > CreateTMeshVec( Geom* geom_ptr );
+
     virtual void TransformMesh( vector < TMesh* > & tmv, const Matrix4d & mat );
     virtual void TransformPolyVec( vector < vector < vec3d > > & polyvec, const Matrix4d & mat );
 
@@ -921,6 +921,8 @@ void PropGeom::UpdateSurf()
     }
 
     m_MainSurfVec.clear();
+    m_MainSurfInstanceVec.clear();
+    m_MainSurfInstanceMatVec.clear();
 
     if ( m_PropMode() <= PROP_MODE::PROP_BOTH )
     {
@@ -1167,6 +1169,11 @@ void PropGeom::UpdateSurf()
         m_CapWMinSuccess.resize( m_Nblade(), m_CapWMinSuccess[0] );
         m_CapWMaxSuccess.resize( m_Nblade(), m_CapWMaxSuccess[0] );
 
+        // Blades are rotated copies of the first, so only it gets tessellated.
+        m_MainSurfInstanceVec.assign( m_Nblade(), 0 );
+        m_MainSurfInstanceVec[0] = -1;
+        m_MainSurfInstanceMatVec.assign( m_Nblade(), Matrix4d() );
+
         Matrix4d rot;
         for ( int i = 1; i < m_Nblade(); i++ )
         {
@@ -1175,6 +1182,7 @@ void PropGeom::UpdateSurf()
             rot.rotateX( theta );
 
             m_MainSurfVec[i].Transform( rot );
+            m_MainSurfInstanceMatVec[i] = rot;
         }
 
         CalculateMeshMetrics( u_pseudo );
@@ -1187,6 +1195,8 @@ void PropGeom::UpdateSurf()
         unsigned int idisk = nsurf - 1;
 
         m_MainSurfVec.resize( nsurf );
+        m_MainSurfInstanceVec.resize( nsurf, -1 );
+        m_MainSurfInstanceMatVec.resize( nsurf );
         m_CapUMinSuccess.resize( nsurf );
         m_CapUMaxSuccess.resize( nsurf );
         m_CapWMinSuccess.resize( nsurf );
@@ -2150,11 +2160,17 @@ void PropGeom::WriteAirfoilFiles( FILE* meta_fid )
 
 vector< TMesh* > PropGeom::CreateTMeshVec()
 {
+    LoadDeferred();
+
     vector< TMesh* > TMeshVec;
 
+    // Main surfaces are untransformed, so none of them is tessellated as a copy.
+    vector< int > base_vec;
     if ( m_ExportMainSurf )
     {
         m_MainSurfVec.swap( m_SurfVec );
+        m_SurfInstanceBaseVec.swap( base_vec );
+        m_SurfRevision++;
     }
 
     TMeshVec = Geom::CreateTMeshVec();
@@ -2162,6 +2178,8 @@ vector< TMesh* > PropGeom::CreateTMeshVec()
     if ( m_ExportMainSurf )
     {
         m_MainSurfVec.swap( m_SurfVec );
+        m_SurfInstanceBaseVec.swap( base_vec );
+        m_SurfRevision++;
     }
 
     return TMeshVec;
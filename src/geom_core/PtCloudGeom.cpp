@@ -9,6 +9,26 @@
 #include "PntNodeMerge.h"
 #include "Vehicle.h"
 #include "FitModelMgr.h"
+#include "FileUtil.h"
+#include "StlHelper.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+//==== Partition Points Below A Splitting Plane ====//
+class PtCloudBelow
+{
+public:
+    PtCloudBelow( int dir, double val ) : m_Dir( dir ), m_Val( val ) {}
+    bool operator()( const vec3d & p ) const
+    {
+        return p[ m_Dir ] < m_Val;
+    }
+
+    int m_Dir;
+    double m_Val;
+};
 
 //==== Constructor ====//
 PtCloudGeom::PtCloudGeom( Vehicle* vehicle_ptr ) : Geom( vehicle_ptr )
@@ -26,6 +46,8 @@ PtCloudGeom::PtCloudGeom( Vehicle* vehicle_ptr ) : Geom( vehicle_ptr )
     m_MassArea.Deactivate();
     m_MassPrior.Deactivate();
 
+    m_NumLevels = 0;
+
     m_ScaleMatrix.loadIdentity();
     m_ScaleFromOrig.Init( "Scale_From_Original", "XForm", this, 1, 1.0e-5, 1.0e12 );
 
@@ -51,12 +73,8 @@ void PtCloudGeom::UpdateDrawObj()
 
     m_HighlightDrawObj.m_PntVec = m_BBox.GetBBoxDrawLines();
 
-    Matrix4d transMat = GetTotalTransMat();
-    m_XformPts.resize( m_Pts.size() );
-    for ( int i = 0 ; i < ( int )m_Pts.size() ; i++ )
-    {
-        m_XformPts[i] = transMat.xform( m_Pts[i] );
-    }
+    // Points are transformed as they are loaded, so only drawn points are touched.
+    m_DrawMat = GetTotalTransMat();
 }
 
 void PtCloudGeom::LoadDrawObjs(vector< DrawObj* > & draw_obj_vec)
@@ -80,19 +98,56 @@ void PtCloudGeom::LoadDrawObjs(vector< DrawObj* > & draw_obj_vec)
     m_PtsDrawObj.m_PntVec.clear();
     m_SelDrawObj.m_PntVec.clear();
 
-    if ( FitModelMgr.IsGUIShown() )
+    bool edit_flag = FitModelMgr.IsGUIShown();
+    int lod = FindLodLevel();
+
+    if ( lod >= m_NumLevels )
+    {
+        for ( int j = 0; j < ( int ) m_Pts.size(); j++ )
+        {
+            if ( IsPtShown( j, edit_flag ) )
+            {
+                LoadShownPt( j );
+            }
+        }
+    }
+    else
     {
-        for ( int j = 0; j < ( int ) m_XformPts.size(); j++ )
+        //==== One Point Per Node At The LOD Level, Plus Shallower Leaves In Full ====//
+        for ( int i = 0; i < ( int ) m_NodeVec.size(); i++ )
         {
-            if ( !m_Hidden[j] && !m_Selected[j] )
+            const PtCloudNode & node = m_NodeVec[i];
+            if ( node.m_Level > lod )
+            {
+                break;
+            }
+
+            if ( node.m_Level < lod && !node.m_Leaf )
+            {
+                continue;
+            }
+
+            for ( int j = node.m_Start; j < node.m_Start + node.m_Count; j++ )
             {
-                m_PtsDrawObj.m_PntVec.push_back( m_XformPts[j] );
-                m_ShownIndx.push_back( j );
+                if ( IsPtShown( j, edit_flag ) )
+                {
+                    LoadShownPt( j );
+                    if ( node.m_Level == lod )
+                    {
+                        break;
+                    }
+                }
             }
+        }
+    }
 
+    if ( edit_flag )
+    {
+        for ( int j = 0; j < ( int ) m_Pts.size(); j++ )
+        {
             if ( m_Selected[j] )
             {
-                m_SelDrawObj.m_PntVec.push_back( m_XformPts[j] );
+                m_SelDrawObj.m_PntVec.push_back( m_DrawMat.xform( m_Pts[j] ) );
             }
         }
         m_SelDrawObj.m_Visible = !m_GuiDraw.GetNoShowFlag();
@@ -100,11 +155,6 @@ void PtCloudGeom::LoadDrawObjs(vector< DrawObj* > & draw_obj_vec)
     }
     else
     {
-        for ( int j = 0; j < ( int ) m_XformPts.size(); j++ )
-        {
-            m_PtsDrawObj.m_PntVec.push_back( m_XformPts[j] );
-            m_ShownIndx.push_back( j );
-        }
         m_SelDrawObj.m_Visible = false;
         m_PickDrawObj.m_Visible = false;
     }
@@ -125,6 +175,56 @@ void PtCloudGeom::LoadDrawObjs(vector< DrawObj* > & draw_obj_vec)
     }
 }
 
+//==== Deepest Octree Level Whose Cut Fits The Display Budget ====//
+// Returns m_NumLevels when every point can be drawn.
+int PtCloudGeom::FindLodLevel()
+{
+    if ( ( int ) m_Pts.size() <= PTCLOUD_MAX_DRAW_PTS || m_NumLevels == 0 )
+    {
+        return m_NumLevels;
+    }
+
+    vector < int > num_node( m_NumLevels, 0 );
+    vector < int > num_leaf_pts( m_NumLevels, 0 );
+    for ( int i = 0; i < ( int ) m_NodeVec.size(); i++ )
+    {
+        num_node[ m_NodeVec[i].m_Level ]++;
+        if ( m_NodeVec[i].m_Leaf )
+        {
+            num_leaf_pts[ m_NodeVec[i].m_Level ] += m_NodeVec[i].m_Count;
+        }
+    }
+
+    // Cut cost grows with depth, so stop at the first level over budget.
+    int lod = 0;
+    int shallow_pts = 0;
+    for ( int lev = 0; lev < m_NumLevels; lev++ )
+    {
+        if ( num_node[ lev ] + shallow_pts > PTCLOUD_MAX_DRAW_PTS )
+        {
+            break;
+        }
+        lod = lev;
+        shallow_pts += num_leaf_pts[ lev ];
+    }
+    return lod;
+}
+
+bool PtCloudGeom::IsPtShown( int indx, bool edit_flag )
+{
+    if ( !edit_flag )
+    {
+        return true;
+    }
+    return !m_Hidden[ indx ] && !m_Selected[ indx ];
+}
+
+void PtCloudGeom::LoadShownPt( int indx )
+{
+    m_PtsDrawObj.m_PntVec.push_back( m_DrawMat.xform( m_Pts[ indx ] ) );
+    m_ShownIndx.push_back( indx );
+}
+
 string PtCloudGeom::getFeedbackGroupName()
 {
     return string("FitModelGUIGroup");
@@ -168,35 +268,353 @@ void PtCloudGeom::UpdateBBox()
     }
 }
 
-int PtCloudGeom::ReadPTS( const char* file_name )
+//==== Binary Value Types Of PLY And LAS Files ====//
+enum { PT_INT8, PT_UINT8, PT_INT16, PT_UINT16, PT_INT32, PT_UINT32, PT_FLOAT32, PT_FLOAT64, PT_NUM_TYPES };
+
+static const int PtTypeSize[PT_NUM_TYPES] = { 1, 1, 2, 2, 4, 4, 4, 8 };
+
+static bool HostBigEndian()
 {
-    FILE* file_id = fopen( file_name, "r" );
+    unsigned int one = 1;
+    return *( unsigned char* )&one == 0;
+}
+
+//==== Read One Binary Value As A Double, Reversing Bytes When Swap Is Set ====//
+static double ReadBinaryValue( const char* p, int type, bool swap )
+{
+    unsigned char buf[8];
+    int n = PtTypeSize[type];
 
-    if ( !file_id )
+    for ( int i = 0 ; i < n ; i++ )
     {
-        return 0;
+        buf[i] = ( unsigned char )p[ swap ? n - 1 - i : i ];
     }
-    else
+
+    switch ( type )
     {
-        m_Pts.clear();
-        int stopFlag = 0;
-        while ( !stopFlag )
+        case PT_INT8:    { signed char v;        memcpy( &v, buf, 1 ); return v; }
+        case PT_UINT8:   { unsigned char v;      memcpy( &v, buf, 1 ); return v; }
+        case PT_INT16:   { short v;              memcpy( &v, buf, 2 ); return v; }
+        case PT_UINT16:  { unsigned short v;     memcpy( &v, buf, 2 ); return v; }
+        case PT_INT32:   { int v;                memcpy( &v, buf, 4 ); return v; }
+        case PT_UINT32:  { unsigned int v;       memcpy( &v, buf, 4 ); return v; }
+        case PT_FLOAT32: { float v;              memcpy( &v, buf, 4 ); return v; }
+        default:         { double v;             memcpy( &v, buf, 8 ); return v; }
+    }
+}
+
+//==== PLY Property Type Names ====//
+static int PLYType( const char* p, const char* end )
+{
+    const char* names[PT_NUM_TYPES][2] = { { "char", "int8" }, { "uchar", "uint8" }, { "short", "int16" }, { "ushort", "uint16" },
+                                          { "int", "int32" }, { "uint", "uint32" }, { "float", "float32" }, { "double", "float64" } };
+
+    for ( int t = 0 ; t < PT_NUM_TYPES ; t++ )
+    {
+        if ( TokenEquals( p, end, names[t][0] ) || TokenEquals( p, end, names[t][1] ) )
+        {
+            return t;
+        }
+    }
+    return -1;
+}
+
+//==== Parse Lines In [begin, end), Taking x y z From The Given Columns ====//
+// Lines without enough numbers are skipped.
+static void ParsePtsBlock( const char* begin, const char* end, const int col[3], vector < vec3d > & pts )
+{
+    int num_col = std::max( col[0], std::max( col[1], col[2] ) ) + 1;
+
+    const char* p = begin;
+    while ( p < end )
+    {
+        const char* line_end = SkipLine( p, end );
+
+        double xyz[3];
+        const char* q = p;
+        int c;
+        for ( c = 0 ; c < num_col ; c++ )
         {
-            double x, y, z;
-            if ( EOF == fscanf( file_id, "%lf %lf %lf\n", &x, &y, &z ) )
+            double val;
+            if ( !ParseDouble( q, line_end, val ) )
             {
                 break;
             }
-            m_Pts.push_back( vec3d( x, y, z ) );
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                if ( col[k] == c )
+                {
+                    xyz[k] = val;
+                }
+            }
+        }
+
+        if ( c == num_col )
+        {
+            pts.push_back( vec3d( xyz[0], xyz[1], xyz[2] ) );
+        }
+        p = line_end;
+    }
+}
+
+//==== Parse Text Point Lines In Parallel Line Aligned Blocks ====//
+static void ReadAsciiPts( const char* begin, const char* end, const int col[3], vector < vec3d > & pts )
+{
+    vector< const char* > split_vec;
+    SplitTextBlocks( begin, end, NumTextBlocks( begin, end ), split_vec );
+
+    int num_block = ( int )split_vec.size() - 1;
+    vector< vector< vec3d > > block_pts_vec( num_block );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int b = 0 ; b < num_block ; b++ )
+    {
+        ParsePtsBlock( split_vec[b], split_vec[b + 1], col, block_pts_vec[b] );
+    }
+
+    size_t num = 0;
+    for ( int b = 0 ; b < num_block ; b++ )
+    {
+        num += block_pts_vec[b].size();
+    }
+
+    pts.reserve( num );
+    for ( int b = 0 ; b < num_block ; b++ )
+    {
+        pts.insert( pts.end(), block_pts_vec[b].begin(), block_pts_vec[b].end() );
+        vector< vec3d >().swap( block_pts_vec[b] );
+    }
+}
+
+//==== Read The Vertex Element Of A PLY File ====//
+// Supports ascii and binary files where vertex is the first element and has
+// no list properties, which covers point cloud exports.
+static bool ReadPLYPts( const char* begin, const char* end, vector < vec3d > & pts )
+{
+    const char* p = SkipSpace( begin, end );
+    if ( !TokenEquals( p, end, "ply" ) )
+    {
+        return false;
+    }
+    p = SkipLine( p, end );
+
+    int format = -1;                   // 0 ascii, 1 little endian, 2 big endian
+    int num_vert = -1;
+    bool vert_elem = false;
+    bool header_done = false;
+    int num_prop = 0;
+    int stride = 0;
+    int col[3] = { -1, -1, -1 };
+    int off[3] = { 0, 0, 0 };
+    int type[3] = { 0, 0, 0 };
+
+    while ( p < end && !header_done )
+    {
+        const char* line_end = SkipLine( p, end );
+        const char* tok = SkipSpace( p, line_end );
+        const char* tok_end = SkipToken( tok, line_end );
+        const char* arg = SkipSpace( tok_end, line_end );
+        const char* arg_end = SkipToken( arg, line_end );
+
+        if ( TokenEquals( tok, tok_end, "end_header" ) )
+        {
+            header_done = true;
+        }
+        else if ( TokenEquals( tok, tok_end, "format" ) )
+        {
+            if ( TokenEquals( arg, arg_end, "ascii" ) )
+            {
+                format = 0;
+            }
+            else if ( TokenEquals( arg, arg_end, "binary_little_endian" ) )
+            {
+                format = 1;
+            }
+            else if ( TokenEquals( arg, arg_end, "binary_big_endian" ) )
+            {
+                format = 2;
+            }
+        }
+        else if ( TokenEquals( tok, tok_end, "element" ) )
+        {
+            if ( num_vert >= 0 )
+            {
+                vert_elem = false;                                 // Elements after vertex are not read
+            }
+            else if ( TokenEquals( arg, arg_end, "vertex" ) )
+            {
+                const char* q = arg_end;
+                if ( !ParseInt( q, line_end, num_vert ) || num_vert < 0 )
+                {
+                    return false;
+                }
+                vert_elem = true;
+            }
+            else
+            {
+                return false;                                      // Vertex must come first
+            }
+        }
+        else if ( TokenEquals( tok, tok_end, "property" ) && vert_elem )
+        {
+            int t = PLYType( arg, arg_end );
+            if ( t < 0 )
+            {
+                return false;                                      // List or unknown type
+            }
+
+            const char* name = SkipSpace( arg_end, line_end );
+            const char* name_end = SkipToken( name, line_end );
+            const char* xyz_names[3] = { "x", "y", "z" };
+
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                if ( TokenEquals( name, name_end, xyz_names[k] ) )
+                {
+                    col[k] = num_prop;
+                    off[k] = stride;
+                    type[k] = t;
+                }
+            }
+            num_prop++;
+            stride += PtTypeSize[t];
+        }
+        p = line_end;
+    }
+
+    if ( !header_done || format < 0 || num_vert < 0 || col[0] < 0 || col[1] < 0 || col[2] < 0 )
+    {
+        return false;
+    }
+
+    if ( format == 0 )
+    {
+        //==== Vertex Lines End After num_vert Lines ====//
+        const char* vert_end = p;
+        for ( int i = 0 ; i < num_vert && vert_end < end ; i++ )
+        {
+            vert_end = SkipLine( vert_end, end );
+        }
+        ReadAsciiPts( p, vert_end, col, pts );
+    }
+    else
+    {
+        bool swap = ( format == 2 ) != HostBigEndian();
+        int num = ( int )std::min( ( long long )num_vert, ( long long )( end - p ) / stride );
+
+        pts.resize( num );
+
+        #pragma omp parallel for
+        for ( int i = 0 ; i < num ; i++ )
+        {
+            const char* rec = p + ( long long )i * stride;
+            pts[i].set_xyz( ReadBinaryValue( rec + off[0], type[0], swap ),
+                            ReadBinaryValue( rec + off[1], type[1], swap ),
+                            ReadBinaryValue( rec + off[2], type[2], swap ) );
         }
-        fclose( file_id );
     }
 
-    if ( m_Pts.size() == 0 )
+    return true;
+}
+
+//==== Read The Point Records Of An Uncompressed LAS File ====//
+static bool ReadLASPts( const char* begin, const char* end, vector < vec3d > & pts )
+{
+    long long size = end - begin;
+    if ( size < 227 || strncmp( begin, "LASF", 4 ) != 0 )
+    {
+        return false;
+    }
+
+    if ( ( unsigned char )begin[104] & 0x80 )
+    {
+        return false;                                              // LAZ compressed
+    }
+
+    bool swap = HostBigEndian();                                   // LAS is always little endian
+
+    unsigned char minor = ( unsigned char )begin[25];
+    long long data_offset = ( long long )ReadBinaryValue( begin + 96, PT_UINT32, swap );
+    int rec_len = ( int )ReadBinaryValue( begin + 105, PT_UINT16, swap );
+    long long num_rec = ( long long )ReadBinaryValue( begin + 107, PT_UINT32, swap );
+
+    if ( num_rec == 0 && minor >= 4 && size >= 255 )
+    {
+        //==== LAS 1.4 64 Bit Count ====//
+        unsigned long long lo = ( unsigned long long )ReadBinaryValue( begin + 247, PT_UINT32, swap );
+        unsigned long long hi = ( unsigned long long )ReadBinaryValue( begin + 251, PT_UINT32, swap );
+        num_rec = ( long long )( lo + ( hi << 32 ) );
+    }
+
+    if ( rec_len < 12 || data_offset >= size )
+    {
+        return false;
+    }
+
+    double scale[3], offset[3];
+    for ( int k = 0 ; k < 3 ; k++ )
+    {
+        scale[k] = ReadBinaryValue( begin + 131 + 8 * k, PT_FLOAT64, swap );
+        offset[k] = ReadBinaryValue( begin + 155 + 8 * k, PT_FLOAT64, swap );
+    }
+
+    int num = ( int )std::min( num_rec, ( size - data_offset ) / rec_len );
+    const char* data = begin + data_offset;
+
+    pts.resize( num );
+
+    #pragma omp parallel for
+    for ( int i = 0 ; i < num ; i++ )
+    {
+        const char* rec = data + ( long long )i * rec_len;
+        pts[i].set_xyz( ReadBinaryValue( rec, PT_INT32, swap ) * scale[0] + offset[0],
+                        ReadBinaryValue( rec + 4, PT_INT32, swap ) * scale[1] + offset[1],
+                        ReadBinaryValue( rec + 8, PT_INT32, swap ) * scale[2] + offset[2] );
+    }
+
+    return true;
+}
+
+//==== Read x y z Points - PLY And LAS Files Are Recognized By Extension ====//
+int PtCloudGeom::ReadPTS( const char* file_name )
+{
+    MappedFile file;
+    if ( !file.Open( file_name ) )
     {
         return 0;
     }
 
+    string ext = file_name;
+    size_t dot = ext.find_last_of( '.' );
+    ext = ( dot == string::npos ) ? string() : ext.substr( dot + 1 );
+    for ( size_t i = 0 ; i < ext.size() ; i++ )
+    {
+        ext[i] = ( char )tolower( ext[i] );
+    }
+
+    m_Pts.clear();
+
+    bool validFlag = true;
+    if ( ext == "ply" )
+    {
+        validFlag = ReadPLYPts( file.Begin(), file.End(), m_Pts );
+    }
+    else if ( ext == "las" )
+    {
+        validFlag = ReadLASPts( file.Begin(), file.End(), m_Pts );
+    }
+    else
+    {
+        int col[3] = { 0, 1, 2 };
+        ReadAsciiPts( file.Begin(), file.End(), col, m_Pts );
+    }
+
+    if ( !validFlag || m_Pts.size() == 0 )
+    {
+        m_Pts.clear();
+        return 0;
+    }
+
     InitPts();
 
     return 1;
@@ -216,8 +634,8 @@ void PtCloudGeom::UniquePts()
         tol = 1.0e-10;
     }
 
-    //==== Use NanoFlann to Find Close Points and Group ====//
-    IndexPntNodes( pnCloud, tol );
+    //==== Group Close Points On A Voxel Grid ====//
+    HashPntNodes( pnCloud, tol );
 
     vector < vec3d > newpts;
     //==== Load Used Nodes ====//
@@ -231,10 +649,101 @@ void PtCloudGeom::UniquePts()
     m_Pts = newpts;
 }
 
+//==== Sort Points Into An Octree ====//
+// Each node's points are contiguous in m_Pts, so a node is just a range.
+void PtCloudGeom::BuildOctree()
+{
+    m_NodeVec.clear();
+    m_NumLevels = 0;
+
+    if ( m_Pts.empty() )
+    {
+        return;
+    }
+
+    BndBox root_box;
+    for ( int i = 0 ; i < ( int )m_Pts.size() ; i++ )
+    {
+        root_box.Update( m_Pts[i] );
+    }
+
+    vector < BndBox > box_vec;
+
+    PtCloudNode root;
+    root.m_Start = 0;
+    root.m_Count = ( int )m_Pts.size();
+    root.m_Level = 0;
+    root.m_Leaf = true;
+    m_NodeVec.push_back( root );
+    box_vec.push_back( root_box );
+
+    // The node vector doubles as the breadth first work queue.
+    for ( int n = 0 ; n < ( int )m_NodeVec.size() ; n++ )
+    {
+        PtCloudNode node = m_NodeVec[n];
+        m_NumLevels = max( m_NumLevels, node.m_Level + 1 );
+
+        if ( node.m_Count <= PTCLOUD_LEAF_SIZE || node.m_Level >= PTCLOUD_MAX_LEVEL )
+        {
+            continue;
+        }
+        m_NodeVec[n].m_Leaf = false;
+
+        BndBox box = box_vec[n];
+        vec3d cen = box.GetCenter();
+
+        //==== Split The Range In X, Then Y, Then Z ====//
+        vector < int > start_vec( 1, node.m_Start );
+        vector < int > end_vec( 1, node.m_Start + node.m_Count );
+        vector < BndBox > sub_box_vec( 1, box );
+        for ( int dir = 0 ; dir < 3 ; dir++ )
+        {
+            vector < int > new_start_vec, new_end_vec;
+            vector < BndBox > new_box_vec;
+            for ( int k = 0 ; k < ( int )start_vec.size() ; k++ )
+            {
+                int mid = std::partition( m_Pts.begin() + start_vec[k], m_Pts.begin() + end_vec[k],
+                                          PtCloudBelow( dir, cen[dir] ) ) - m_Pts.begin();
+
+                vec3d lo_max = sub_box_vec[k].GetMax();
+                vec3d hi_min = sub_box_vec[k].GetMin();
+                lo_max[dir] = cen[dir];
+                hi_min[dir] = cen[dir];
+
+                new_start_vec.push_back( start_vec[k] );
+                new_end_vec.push_back( mid );
+                new_box_vec.push_back( BndBox( sub_box_vec[k].GetMin(), lo_max ) );
+
+                new_start_vec.push_back( mid );
+                new_end_vec.push_back( end_vec[k] );
+                new_box_vec.push_back( BndBox( hi_min, sub_box_vec[k].GetMax() ) );
+            }
+            start_vec = new_start_vec;
+            end_vec = new_end_vec;
+            sub_box_vec = new_box_vec;
+        }
+
+        for ( int k = 0 ; k < ( int )start_vec.size() ; k++ )
+        {
+            if ( end_vec[k] > start_vec[k] )
+            {
+                PtCloudNode child;
+                child.m_Start = start_vec[k];
+                child.m_Count = end_vec[k] - start_vec[k];
+                child.m_Level = node.m_Level + 1;
+                child.m_Leaf = true;
+                m_NodeVec.push_back( child );
+                box_vec.push_back( sub_box_vec[k] );
+            }
+        }
+    }
+}
+
 void PtCloudGeom::InitPts()
 {
     UpdateBBox();
     UniquePts();
+    BuildOctree();
 
     unsigned int n = m_Pts.size();
     m_Selected.assign( n, false );
@@ -251,6 +760,12 @@ xmlNodePtr PtCloudGeom::EncodeXml( xmlNodePtr & node )
     // required too much memory to read in.
     // XmlUtil::AddVectorVec3dNode( ptcloud_node, "Points" , m_Pts );
 
+    // Points are copied directly by CopyPayloadFrom
+    if ( IsCopyEncoding() )
+    {
+        return ptcloud_node;
+    }
+
     xmlNodePtr pt_list_node = xmlNewChild( ptcloud_node, NULL, BAD_CAST "Pt_List", NULL );
     for ( int i = 0 ; i < ( int ) m_Pts.size() ; i++ )
     {
@@ -296,6 +811,36 @@ xmlNodePtr PtCloudGeom::DecodeXml( xmlNodePtr & node )
     return ptcloud_node;
 }
 
+//==== Copy Points Without Going Through Text ====//
+void PtCloudGeom::CopyPayloadFrom( Geom* geom )
+{
+    PtCloudGeom* pt_geom = dynamic_cast< PtCloudGeom* >( geom );
+    if ( !pt_geom )
+    {
+        return;
+    }
+
+    m_Pts = pt_geom->m_Pts;
+    InitPts();
+}
+
+void PtCloudGeom::AddMemoryUsage( GeomMemUsage & usage )
+{
+    Geom::AddMemoryUsage( usage );
+
+    usage.m_Mesh += vector_mem_bytes( m_Pts ) + vector_mem_bytes( m_ShownIndx ) + vector_mem_bytes( m_NodeVec );
+    usage.m_Mesh += vector_mem_bytes( m_Selected ) + vector_mem_bytes( m_Hidden );
+}
+
+//==== Both Point Buffers Are Refilled Each Time They Are Loaded ====//
+void PtCloudGeom::CollectDrawObjs( vector< DrawObj* > & draw_obj_vec )
+{
+    Geom::CollectDrawObjs( draw_obj_vec );
+
+    draw_obj_vec.push_back( &m_PtsDrawObj );
+    draw_obj_vec.push_back( &m_SelDrawObj );
+}
+
 void PtCloudGeom::SelectPoint( int index )
 {
     m_Selected[ m_ShownIndx[ index ] ] = true;
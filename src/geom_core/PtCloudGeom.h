@@ -10,6 +10,19 @@
 
 #include "Geom.h"
 
+// Display budget; larger clouds are drawn one point per octree node.
+#define PTCLOUD_MAX_DRAW_PTS 500000
+#define PTCLOUD_LEAF_SIZE 64
+#define PTCLOUD_MAX_LEVEL 20
+
+//==== Octree Node Over A Contiguous Range Of m_Pts ====//
+struct PtCloudNode
+{
+    int m_Start;
+    int m_Count;
+    int m_Level;
+    bool m_Leaf;
+};
 
 //==== Point Cloud Geom ====//
 class PtCloudGeom : public Geom
@@ -23,9 +36,15 @@ public:
         return 0;
     };
 
+    virtual bool CanDeferLoad()
+    {
+        return false;
+    }
+
     virtual void UpdateSurf();
     virtual void UpdateDrawObj();
     virtual void LoadDrawObjs(vector< DrawObj* > & draw_obj_vec);
+    virtual void AddMemoryUsage( GeomMemUsage & usage );
     virtual string getFeedbackGroupName();
 
     virtual void Scale();
@@ -36,6 +55,7 @@ public:
 
     virtual void UniquePts();
     virtual void InitPts();
+    virtual void BuildOctree();
 
     virtual xmlNodePtr EncodeXml( xmlNodePtr & node );
     virtual xmlNodePtr DecodeXml( xmlNodePtr & node );
@@ -74,7 +94,19 @@ public:
 
 protected:
 
-    vector < vec3d > m_XformPts;
+    virtual void CollectDrawObjs( vector< DrawObj* > & draw_obj_vec );
+
+    virtual void CopyPayloadFrom( Geom* geom );
+
+    virtual int FindLodLevel();
+    virtual bool IsPtShown( int indx, bool edit_flag );
+    virtual void LoadShownPt( int indx );
+
+    // Breadth first, so each level's nodes are contiguous and cover their points in order.
+    vector < PtCloudNode > m_NodeVec;
+    int m_NumLevels;
+
+    Matrix4d m_DrawMat;
 
     DrawObj m_PtsDrawObj;
     DrawObj m_SelDrawObj;
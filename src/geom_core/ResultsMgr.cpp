@@ -10,6 +10,7 @@
 #include "Vehicle.h"
 #include "Util.h"
 #include "StlHelper.h"
+#include "PerfStats.h"
 
 #ifdef WIN32
 #include <windows.h>
@@ -32,47 +33,72 @@ NameValData::NameValData( const string & name )
 NameValData::NameValData( const string & name, const int & i_data )
 {
     Init( name, vsp::INT_DATA );
-    m_IntData.push_back( i_data );
+    m_IntData = shared_ptr< const vector< int > >( new vector< int >( 1, i_data ) );
 }
 NameValData::NameValData( const string & name, const double & d_data )
 {
     Init( name, vsp::DOUBLE_DATA );
-    m_DoubleData.push_back( d_data );
+    m_DoubleData = shared_ptr< const vector< double > >( new vector< double >( 1, d_data ) );
 }
 NameValData::NameValData( const string & name, const string & s_data )
 {
     Init( name, vsp::STRING_DATA );
-    m_StringData.push_back( s_data );
+    m_StringData = shared_ptr< const vector< string > >( new vector< string >( 1, s_data ) );
 }
 NameValData::NameValData( const string & name, const vec3d & v_data )
 {
     Init( name, vsp::VEC3D_DATA );
-    m_Vec3dData.push_back( v_data );
+    m_Vec3dData = shared_ptr< const vector< vec3d > >( new vector< vec3d >( 1, v_data ) );
 }
 NameValData::NameValData( const string & name, const vector< int > & i_data )
 {
     Init( name, vsp::INT_DATA );
-    m_IntData = i_data;
+    SetIntData( i_data );
 }
 NameValData::NameValData( const string & name, const vector< double > & d_data )
 {
     Init( name, vsp::DOUBLE_DATA );
-    m_DoubleData = d_data;
+    SetDoubleData( d_data );
 }
 NameValData::NameValData( const string & name, const vector< string > & s_data )
 {
     Init( name, vsp::STRING_DATA );
-    m_StringData = s_data;
+    SetStringData( s_data );
 }
 NameValData::NameValData( const string & name, const vector< vec3d > & v_data )
 {
     Init( name, vsp::VEC3D_DATA );
-    m_Vec3dData = v_data;
+    SetVec3dData( v_data );
 }
 NameValData::NameValData( const string &name, const vector< vector< double > > &dmat_data )
 {
     Init( name, vsp::DOUBLE_MATRIX_DATA );
-    m_DoubleMatData = dmat_data;
+    SetDoubleMatData( dmat_data );
+}
+NameValData::NameValData( const string & name, vector< int > && i_data )
+{
+    Init( name, vsp::INT_DATA );
+    SetIntData( std::move( i_data ) );
+}
+NameValData::NameValData( const string & name, vector< double > && d_data )
+{
+    Init( name, vsp::DOUBLE_DATA );
+    SetDoubleData( std::move( d_data ) );
+}
+NameValData::NameValData( const string & name, vector< string > && s_data )
+{
+    Init( name, vsp::STRING_DATA );
+    SetStringData( std::move( s_data ) );
+}
+NameValData::NameValData( const string & name, vector< vec3d > && v_data )
+{
+    Init( name, vsp::VEC3D_DATA );
+    SetVec3dData( std::move( v_data ) );
+}
+NameValData::NameValData( const string &name, vector< vector< double > > && dmat_data )
+{
+    Init( name, vsp::DOUBLE_MATRIX_DATA );
+    SetDoubleMatData( std::move( dmat_data ) );
 }
 void NameValData::Init( const string & name, int type, int index )
 {
@@ -80,51 +106,208 @@ void NameValData::Init( const string & name, int type, int index )
     m_Type = type;
 }
 
+//==== Empty Columns Returned For Unset Data ====//
+static const vector< int > s_EmptyIntVec;
+static const vector< double > s_EmptyDoubleVec;
+static const vector< string > s_EmptyStringVec;
+static const vector< vec3d > s_EmptyVec3dVec;
+static const vector< vector< double > > s_EmptyDoubleMat;
+
+const vector<int> & NameValData::GetIntData() const
+{
+    return m_IntData ? *m_IntData : s_EmptyIntVec;
+}
+const vector<double> & NameValData::GetDoubleData() const
+{
+    return m_DoubleData ? *m_DoubleData : s_EmptyDoubleVec;
+}
+const vector<string> & NameValData::GetStringData() const
+{
+    return m_StringData ? *m_StringData : s_EmptyStringVec;
+}
+const vector<vec3d> & NameValData::GetVec3dData() const
+{
+    return m_Vec3dData ? *m_Vec3dData : s_EmptyVec3dVec;
+}
+const vector< vector< double > > & NameValData::GetDoubleMatData() const
+{
+    return m_DoubleMatData ? *m_DoubleMatData : s_EmptyDoubleMat;
+}
+
+size_t NameValData::MemoryUsage() const
+{
+    size_t bytes = sizeof( NameValData ) + m_Name.capacity();
+    if ( m_IntData )
+    {
+        bytes += vector_mem_bytes( *m_IntData );
+    }
+    if ( m_DoubleData )
+    {
+        bytes += vector_mem_bytes( *m_DoubleData );
+    }
+    if ( m_StringData )
+    {
+        bytes += vector_mem_bytes( *m_StringData );
+        for ( int i = 0 ; i < ( int )m_StringData->size() ; i++ )
+        {
+            bytes += ( *m_StringData )[i].capacity();
+        }
+    }
+    if ( m_Vec3dData )
+    {
+        bytes += vector_mem_bytes( *m_Vec3dData );
+    }
+    if ( m_DoubleMatData )
+    {
+        bytes += vector_mem_bytes( *m_DoubleMatData );
+    }
+    return bytes;
+}
+
+int NameValData::GetLength() const
+{
+    switch ( m_Type )
+    {
+    case vsp::INT_DATA:
+        return ( int )GetIntData().size();
+    case vsp::DOUBLE_DATA:
+        return ( int )GetDoubleData().size();
+    case vsp::STRING_DATA:
+        return ( int )GetStringData().size();
+    case vsp::VEC3D_DATA:
+        return ( int )GetVec3dData().size();
+    case vsp::DOUBLE_MATRIX_DATA:
+        return ( int )GetDoubleMatData().size();
+    }
+    return 0;
+}
+
+//==== Copy Of [start, start + num) Clipped To The Vector ====//
+template < class T >
+static vector< T > CopyChunk( const vector< T > & d, int start, int num )
+{
+    int len = ( int )d.size();
+    int s = max( start, 0 );
+    int e = min( start + max( num, 0 ), len );
+
+    if ( s >= e )
+    {
+        return vector< T >();
+    }
+    return vector< T >( d.begin() + s, d.begin() + e );
+}
+
+vector< int > NameValData::GetIntChunk( int start, int num ) const
+{
+    return CopyChunk( GetIntData(), start, num );
+}
+vector< double > NameValData::GetDoubleChunk( int start, int num ) const
+{
+    return CopyChunk( GetDoubleData(), start, num );
+}
+vector< string > NameValData::GetStringChunk( int start, int num ) const
+{
+    return CopyChunk( GetStringData(), start, num );
+}
+vector< vec3d > NameValData::GetVec3dChunk( int start, int num ) const
+{
+    return CopyChunk( GetVec3dData(), start, num );
+}
+
 int NameValData::GetInt( int i ) const
 {
-    if ( i >= 0 && i < ( int )m_IntData.size() )
+    const vector< int > & d = GetIntData();
+    if ( i >= 0 && i < ( int )d.size() )
     {
-        return m_IntData[i];
+        return d[i];
     }
     return 0;
 }
 double NameValData::GetDouble( int i ) const
 {
-    if ( i >= 0 && i < ( int )m_DoubleData.size() )
+    const vector< double > & d = GetDoubleData();
+    if ( i >= 0 && i < ( int )d.size() )
     {
-        return m_DoubleData[i];
+        return d[i];
     }
     return 0;
 }
 double NameValData::GetDouble( int row, int col ) const
 {
-    if ( row >= 0 && row < ( int )m_DoubleMatData.size() )
+    const vector< vector< double > > & d = GetDoubleMatData();
+    if ( row >= 0 && row < ( int )d.size() )
     {
-        if ( col >= 0 && col < ( int )m_DoubleMatData[row].size() )
+        if ( col >= 0 && col < ( int )d[row].size() )
         {
-            return m_DoubleMatData[row][col];
+            return d[row][col];
         }
     }
     return 0;
 }
 string NameValData::GetString( int i ) const
 {
-    if ( i >= 0 && i < ( int )m_StringData.size() )
+    const vector< string > & d = GetStringData();
+    if ( i >= 0 && i < ( int )d.size() )
     {
-        return m_StringData[i];
+        return d[i];
     }
     return string();
 }
 
 vec3d NameValData::GetVec3d( int i ) const
 {
-    if ( i >= 0 && i < ( int )m_Vec3dData.size() )
+    const vector< vec3d > & d = GetVec3dData();
+    if ( i >= 0 && i < ( int )d.size() )
     {
-        return m_Vec3dData[i];
+        return d[i];
     }
     return vec3d();
 }
 
+//==== Set Data - Other Copies Keep Pointing At The Old Column ====//
+void NameValData::SetIntData( const vector< int > & d )
+{
+    m_IntData = shared_ptr< const vector< int > >( new vector< int >( d ) );
+}
+void NameValData::SetDoubleData( const vector< double > & d )
+{
+    m_DoubleData = shared_ptr< const vector< double > >( new vector< double >( d ) );
+}
+void NameValData::SetStringData( const vector< string > & d )
+{
+    m_StringData = shared_ptr< const vector< string > >( new vector< string >( d ) );
+}
+void NameValData::SetVec3dData( const vector< vec3d > & d )
+{
+    m_Vec3dData = shared_ptr< const vector< vec3d > >( new vector< vec3d >( d ) );
+}
+void NameValData::SetDoubleMatData( const vector< vector< double > > & d )
+{
+    m_DoubleMatData = shared_ptr< const vector< vector< double > > >( new vector< vector< double > >( d ) );
+}
+
+//==== Move Data - Take Ownership Of The Caller's Storage ====//
+void NameValData::SetIntData( vector< int > && d )
+{
+    m_IntData = shared_ptr< const vector< int > >( new vector< int >( std::move( d ) ) );
+}
+void NameValData::SetDoubleData( vector< double > && d )
+{
+    m_DoubleData = shared_ptr< const vector< double > >( new vector< double >( std::move( d ) ) );
+}
+void NameValData::SetStringData( vector< string > && d )
+{
+    m_StringData = shared_ptr< const vector< string > >( new vector< string >( std::move( d ) ) );
+}
+void NameValData::SetVec3dData( vector< vec3d > && d )
+{
+    m_Vec3dData = shared_ptr< const vector< vec3d > >( new vector< vec3d >( std::move( d ) ) );
+}
+void NameValData::SetDoubleMatData( vector< vector< double > > && d )
+{
+    m_DoubleMatData = shared_ptr< const vector< vector< double > > >( new vector< vector< double > >( std::move( d ) ) );
+}
+
 
 //======================================================================================//
 //======================================================================================//
@@ -140,18 +323,8 @@ NameValCollection::NameValCollection( const string & name, const string & id )
 //==== Add Data To Results - Can Have Data With The Same Name =====//
 void NameValCollection::Add( const NameValData & d )
 {
-    //==== Find Name ====//
-    string name = d.GetName();
-
-    map< string, vector< NameValData > >::iterator iter = m_DataMap.find( name );
-    if ( iter !=  m_DataMap.end() )     // Check For Duplicates
-    {
-        iter->second.push_back( d );
-    }
-    else
-    {
-        m_DataMap[name].push_back( d );
-    }
+    //==== Duplicates Are Appended To The Same Name ====//
+    m_DataMap[ d.GetName() ].push_back( d );
 }
 
 void NameValCollection::Add(const vector<vector<vec3d> > & d, string prefix)
@@ -169,11 +342,27 @@ void NameValCollection::Add(const vector<vector<vec3d> > & d, string prefix)
             {
                 row.push_back( d[i][j].v[dim] );
             }
-            arr.push_back( row );
+            arr.push_back( std::move( row ) );
         }
 
-        Add( NameValData( names[dim], arr ) );
+        Add( NameValData( names[dim], std::move( arr ) ) );
+    }
+}
+
+size_t NameValCollection::MemoryUsage() const
+{
+    size_t bytes = m_Name.capacity() + m_ID.capacity();
+
+    map< string, vector< NameValData > >::const_iterator iter;
+    for ( iter = m_DataMap.begin() ; iter != m_DataMap.end() ; ++iter )
+    {
+        bytes += iter->first.capacity() + vector_mem_bytes( iter->second );
+        for ( int i = 0 ; i < ( int )iter->second.size() ; i++ )
+        {
+            bytes += iter->second[i].MemoryUsage() - sizeof( NameValData );
+        }
     }
+    return bytes;
 }
 
 //==== Get Number of Data Entries For This Name ====//
@@ -303,7 +492,11 @@ void Results::WriteCSVFile( FILE* fid )
                     {
                         for ( int d = 0; d < (int)iter->second[i].GetStringData().size(); d++ )
                         {
-                            fprintf( fid, ",%s", ResultsMgr.FindResultsPtr(iter->second[i].GetStringData()[d])->GetName().c_str() );
+                            Results * res = ResultsMgr.FindResultsPtr( iter->second[i].GetStringData()[d] );
+                            if ( res )
+                            {
+                                fprintf( fid, ",%s", res->GetName().c_str() );
+                            }
                         }
                     }
                     else
@@ -348,6 +541,172 @@ void Results::WriteCSVFile( FILE* fid )
     }
 }
 
+//===== Write Binary Helpers =====//
+static void WriteBinaryInt( FILE* fid, int val )
+{
+    fwrite( &val, sizeof( int ), 1, fid );
+}
+
+static void WriteBinaryString( FILE* fid, const string & str )
+{
+    WriteBinaryInt( fid, ( int )str.size() );
+    fwrite( str.c_str(), sizeof( char ), str.size(), fid );
+}
+
+//===== Read Binary Helpers, False On A Short Read =====//
+static bool ReadBinaryInt( FILE* fid, int & val )
+{
+    return fread( &val, sizeof( int ), 1, fid ) == 1;
+}
+
+static bool ReadBinaryString( FILE* fid, string & str )
+{
+    int len = 0;
+    if ( !ReadBinaryInt( fid, len ) || len < 0 )
+    {
+        return false;
+    }
+    str.resize( len );
+    return len == 0 || fread( &str[0], sizeof( char ), len, fid ) == ( size_t )len;
+}
+
+template < class T >
+static bool ReadBinaryVec( FILE* fid, vector< T > & vec )
+{
+    int len = 0;
+    if ( !ReadBinaryInt( fid, len ) || len < 0 )
+    {
+        return false;
+    }
+    vec.resize( len );
+    return len == 0 || fread( &vec[0], sizeof( T ), len, fid ) == ( size_t )len;
+}
+
+//===== Write A Binary File With Everything =====//
+void Results::WriteBinaryFile( const string & file_name, bool append )
+{
+    FILE* fid = ResultsMgrSingleton::OpenBinaryFile( file_name, append );
+    if ( fid )
+    {
+        WriteBinaryFile( fid );
+        fclose( fid );          // Close File
+    }
+}
+
+void Results::WriteBinaryFile( FILE* fid, bool follow_children )
+{
+    if ( !fid )
+    {
+        return;
+    }
+
+    int num_col = 0;
+    map< string, vector< NameValData > >::iterator iter;
+    for ( iter = m_DataMap.begin() ; iter != m_DataMap.end() ; ++iter )
+    {
+        num_col += ( int )iter->second.size();
+    }
+
+    WriteBinaryString( fid, m_Name );
+    WriteBinaryString( fid, m_ID );
+    long long stamp = ( long long )m_Timestamp;
+    fwrite( &stamp, sizeof( long long ), 1, fid );
+    WriteBinaryInt( fid, num_col );
+
+    vector< string > child_ids;
+
+    for ( iter = m_DataMap.begin() ; iter != m_DataMap.end() ; ++iter )
+    {
+        for ( int i = 0 ; i < ( int )iter->second.size() ; i++ )
+        {
+            const NameValData & nvd = iter->second[i];
+            int type = nvd.GetType();
+
+            WriteBinaryString( fid, nvd.GetName() );
+            WriteBinaryInt( fid, type );
+
+            if ( type == vsp::INT_DATA )
+            {
+                const vector< int > & d = nvd.GetIntData();
+                WriteBinaryInt( fid, ( int )d.size() );
+                if ( !d.empty() )
+                {
+                    fwrite( &d[0], sizeof( int ), d.size(), fid );
+                }
+            }
+            else if ( type == vsp::DOUBLE_DATA )
+            {
+                const vector< double > & d = nvd.GetDoubleData();
+                WriteBinaryInt( fid, ( int )d.size() );
+                if ( !d.empty() )
+                {
+                    fwrite( &d[0], sizeof( double ), d.size(), fid );
+                }
+            }
+            else if ( type == vsp::VEC3D_DATA )
+            {
+                const vector< vec3d > & d = nvd.GetVec3dData();
+                WriteBinaryInt( fid, ( int )d.size() );
+
+                //==== One Column Per Coordinate ====//
+                vector< double > coord( d.size() );
+                for ( int k = 0 ; k < 3 ; k++ )
+                {
+                    for ( int j = 0 ; j < ( int )d.size() ; j++ )
+                    {
+                        coord[j] = d[j].v[k];
+                    }
+                    if ( !coord.empty() )
+                    {
+                        fwrite( &coord[0], sizeof( double ), coord.size(), fid );
+                    }
+                }
+            }
+            else if ( type == vsp::STRING_DATA )
+            {
+                const vector< string > & d = nvd.GetStringData();
+                WriteBinaryInt( fid, ( int )d.size() );
+                for ( int j = 0 ; j < ( int )d.size() ; j++ )
+                {
+                    WriteBinaryString( fid, d[j] );
+                }
+
+                if ( nvd.GetName() == "ResultsVec" )
+                {
+                    child_ids.insert( child_ids.end(), d.begin(), d.end() );
+                }
+            }
+            else if ( type == vsp::DOUBLE_MATRIX_DATA )
+            {
+                const vector< vector< double > > & d = nvd.GetDoubleMatData();
+                WriteBinaryInt( fid, ( int )d.size() );
+                for ( int j = 0 ; j < ( int )d.size() ; j++ )
+                {
+                    WriteBinaryInt( fid, ( int )d[j].size() );
+                    if ( !d[j].empty() )
+                    {
+                        fwrite( &d[j][0], sizeof( double ), d[j].size(), fid );
+                    }
+                }
+            }
+            else
+            {
+                WriteBinaryInt( fid, 0 );
+            }
+        }
+    }
+
+    //==== Follow ResultsVec Wrappers As WriteCSVFile Does ====//
+    for ( int i = 0 ; i < ( int )child_ids.size() && follow_children ; i++ )
+    {
+        Results * res = ResultsMgr.FindResultsPtr( child_ids[i] );
+        if ( res )
+        {
+            res->WriteBinaryFile( fid );
+        }
+    }
+}
+
 //==== Write The Mass Prop Results ====//
 void Results::WriteMassProp( const string & file_name )
 {
@@ -802,7 +1161,7 @@ void Results::WriteBEMFile( const string & file_name )
 //==== Constructor ====//
 ResultsMgrSingleton::ResultsMgrSingleton()
 {
-
+    m_MaxResultsPerName = 0;
 }
 //==== Destructor ====//
 ResultsMgrSingleton::~ResultsMgrSingleton()
@@ -819,10 +1178,141 @@ Results* ResultsMgrSingleton::CreateResults( const string & name )
 
     m_ResultsMap[id] = res_ptr;                     // Map ID to Ptr
     m_NameIDMap[name].push_back( id );              // Map Name to Vector of IDs
+
+    ExpireResults( name );
     return res_ptr;
 }
 
 
+//==== Read One Results Record From A Binary Stream ====//
+Results* ResultsMgrSingleton::ReadBinaryResults( FILE* fid, map< string, string > & id_map )
+{
+    string name, old_id;
+    long long stamp = 0;
+    int num_col = 0;
+
+    if ( !ReadBinaryString( fid, name ) || !ReadBinaryString( fid, old_id ) ||
+         fread( &stamp, sizeof( long long ), 1, fid ) != 1 || !ReadBinaryInt( fid, num_col ) )
+    {
+        return NULL;
+    }
+
+    Results* res = CreateResults( name );
+
+    for ( int c = 0 ; c < num_col ; c++ )
+    {
+        string col_name;
+        int type = 0;
+        if ( !ReadBinaryString( fid, col_name ) || !ReadBinaryInt( fid, type ) )
+        {
+            DeleteResult( res->GetID() );
+            return NULL;
+        }
+
+        bool ok = true;
+        if ( type == vsp::INT_DATA )
+        {
+            vector< int > d;
+            ok = ReadBinaryVec( fid, d );
+            res->Add( NameValData( col_name, std::move( d ) ) );
+        }
+        else if ( type == vsp::DOUBLE_DATA )
+        {
+            vector< double > d;
+            ok = ReadBinaryVec( fid, d );
+            res->Add( NameValData( col_name, std::move( d ) ) );
+        }
+        else if ( type == vsp::VEC3D_DATA )
+        {
+            int len = 0;
+            ok = ReadBinaryInt( fid, len ) && len >= 0;
+
+            vector< vec3d > d( ok ? len : 0 );
+            vector< double > coord( d.size() );
+            for ( int k = 0 ; k < 3 && ok && len > 0 ; k++ )
+            {
+                ok = fread( &coord[0], sizeof( double ), len, fid ) == ( size_t )len;
+                for ( int j = 0 ; j < len && ok ; j++ )
+                {
+                    d[j].v[k] = coord[j];
+                }
+            }
+            res->Add( NameValData( col_name, std::move( d ) ) );
+        }
+        else if ( type == vsp::STRING_DATA )
+        {
+            int len = 0;
+            ok = ReadBinaryInt( fid, len ) && len >= 0;
+
+            vector< string > d( ok ? len : 0 );
+            for ( int j = 0 ; j < len && ok ; j++ )
+            {
+                ok = ReadBinaryString( fid, d[j] );
+            }
+
+            if ( col_name == "ResultsVec" )
+            {
+                for ( int j = 0 ; j < ( int )d.size() ; j++ )
+                {
+                    map< string, string >::const_iterator it = id_map.find( d[j] );
+                    if ( it != id_map.end() )
+                    {
+                        d[j] = it->second;
+                    }
+                }
+            }
+            res->Add( NameValData( col_name, std::move( d ) ) );
+        }
+        else if ( type == vsp::DOUBLE_MATRIX_DATA )
+        {
+            int nrow = 0;
+            ok = ReadBinaryInt( fid, nrow ) && nrow >= 0;
+
+            vector< vector< double > > d( ok ? nrow : 0 );
+            for ( int j = 0 ; j < nrow && ok ; j++ )
+            {
+                ok = ReadBinaryVec( fid, d[j] );
+            }
+            res->Add( NameValData( col_name, std::move( d ) ) );
+        }
+        else
+        {
+            int len = 0;
+            ok = ReadBinaryInt( fid, len );
+        }
+
+        if ( !ok )
+        {
+            DeleteResult( res->GetID() );
+            return NULL;
+        }
+    }
+
+    id_map[ old_id ] = res->GetID();
+    return res;
+}
+
+//==== IDs Of A Results And Its ResultsVec Children, Children First ====//
+void ResultsMgrSingleton::GetResultsTree( const string & id, vector < string > & id_vec )
+{
+    Results* res = FindResultsPtr( id );
+    if ( !res || std::find( id_vec.begin(), id_vec.end(), id ) != id_vec.end() )
+    {
+        return;
+    }
+
+    for ( int i = 0 ; i < res->GetNumData( "ResultsVec" ) ; i++ )
+    {
+        const vector< string > & child_vec = res->FindPtr( "ResultsVec", i )->GetStringData();
+        for ( int j = 0 ; j < ( int )child_vec.size() ; j++ )
+        {
+            GetResultsTree( child_vec[j], id_vec );
+        }
+    }
+
+    id_vec.push_back( id );
+}
+
 //==== Create Results And Load With Geometry Data ====//
 string ResultsMgrSingleton::CreateGeomResults( const string & geom_id, const string & name )
 {
@@ -846,11 +1336,69 @@ string ResultsMgrSingleton::CreateGeomResults( const string & geom_id, const str
 }
 
 
+//==== Perf_Stats Results - One Row Per Timed Scope, Then Counters ====//
+string ResultsMgrSingleton::CreatePerfStatsResults()
+{
+    vector< string > name_vec;
+    vector< PerfStat > stat_vec;
+    PerfStatsMgr.GetStats( name_vec, stat_vec );
+
+    int num = ( int )stat_vec.size();
+    vector< int > count_vec( num );
+    vector< double > total_vec( num ), mean_vec( num ), min_vec( num ), max_vec( num ), mem_vec( num );
+
+    for ( int i = 0 ; i < num ; i++ )
+    {
+        count_vec[i] = stat_vec[i].m_Count;
+        total_vec[i] = stat_vec[i].m_Total;
+        mean_vec[i] = stat_vec[i].m_Count > 0 ? stat_vec[i].m_Total / stat_vec[i].m_Count : 0.0;
+        min_vec[i] = stat_vec[i].m_Min;
+        max_vec[i] = stat_vec[i].m_Max;
+        mem_vec[i] = stat_vec[i].m_PeakMem;
+    }
+
+    vector< string > counter_name_vec;
+    vector< double > counter_vec;
+    PerfStatsMgr.GetCounts( counter_name_vec, counter_vec );
+
+    Results* res = CreateResults( "Perf_Stats" );
+
+    if ( !res )
+    {
+        return string();
+    }
+
+    res->Add( NameValData( "Scope", name_vec ) );
+    res->Add( NameValData( "Count", count_vec ) );
+    res->Add( NameValData( "Total_Sec", total_vec ) );
+    res->Add( NameValData( "Mean_Sec", mean_vec ) );
+    res->Add( NameValData( "Min_Sec", min_vec ) );
+    res->Add( NameValData( "Max_Sec", max_vec ) );
+    res->Add( NameValData( "Peak_Mem_MB", mem_vec ) );
+    res->Add( NameValData( "Counter", counter_name_vec ) );
+    res->Add( NameValData( "Counter_Value", counter_vec ) );
+    res->Add( NameValData( "Elapsed_Sec", PerfStatsMgr.Now() ) );
+
+    return res->GetID();
+}
+
+//==== Approximate Bytes Held By All Results ====//
+size_t ResultsMgrSingleton::MemoryUsage() const
+{
+    size_t bytes = 0;
+    unordered_map< string, Results* >::const_iterator iter;
+    for ( iter = m_ResultsMap.begin() ; iter != m_ResultsMap.end() ; ++iter )
+    {
+        bytes += sizeof( Results ) + iter->second->MemoryUsage();
+    }
+    return bytes;
+}
+
 //==== Delete All Results ====//
 void ResultsMgrSingleton::DeleteAllResults()
 {
     //==== Delete All Created Results =====//
-    map< string, Results* >::iterator iter;
+    unordered_map< string, Results* >::iterator iter;
     for ( iter = m_ResultsMap.begin() ; iter != m_ResultsMap.end() ; ++iter )
     {
         delete iter->second;
@@ -859,45 +1407,104 @@ void ResultsMgrSingleton::DeleteAllResults()
     m_NameIDMap.clear();
 }
 
-//==== Delete All Results ====//
+//==== Delete Result Given ID ====//
 void ResultsMgrSingleton:: DeleteResult( const string & id )
 {
-    //==== Find Name Given ID ====//
-    map< string, vector< string > >::iterator iter;
+    unordered_map< string, Results* >::iterator res_iter = m_ResultsMap.find( id );
 
-    //==== Find Name To Match ID And Remove====//
-    for ( iter = m_NameIDMap.begin() ; iter != m_NameIDMap.end() ; ++iter )
+    if ( res_iter == m_ResultsMap.end() )
     {
-        bool found = false;
-        for ( int i = 0 ; i < ( int )iter->second.size() ; i++ )
+        return;
+    }
+
+    //==== Remove ID From The List For Its Name ====//
+    map< string, vector< string > >::iterator iter = m_NameIDMap.find( res_iter->second->GetName() );
+
+    if ( iter != m_NameIDMap.end() )
+    {
+        vector_remove_val( iter->second, id );
+        if ( iter->second.size() == 0 )
         {
-            if ( iter->second[i] == id )
-            {
-                found = true;
-            }
+            m_NameIDMap.erase( iter );
         }
-        if ( found )
-        {
-            vector_remove_val( iter->second, id );
-            if ( iter->second.size() == 0 )
-            {
-                m_NameIDMap.erase( iter );
-            }
+    }
 
-            break;
+    delete res_iter->second;
+    m_ResultsMap.erase( res_iter );
+}
+
+//==== Delete All Results With The Given Name ====//
+void ResultsMgrSingleton::DeleteNamedResults( const string & name )
+{
+    map< string, vector< string > >::iterator iter = m_NameIDMap.find( name );
+
+    if ( iter == m_NameIDMap.end() )
+    {
+        return;
+    }
+
+    for ( int i = 0 ; i < ( int )iter->second.size() ; i++ )
+    {
+        unordered_map< string, Results* >::iterator res_iter = m_ResultsMap.find( iter->second[i] );
+
+        if ( res_iter != m_ResultsMap.end() )
+        {
+            delete res_iter->second;
+            m_ResultsMap.erase( res_iter );
         }
     }
 
-    //==== Delete All Created Results =====//
-    map< string, Results* >::iterator res_iter;
+    m_NameIDMap.erase( iter );
+}
+
+//==== Set Max Results Kept For Each Name And Expire Any Extras ====//
+void ResultsMgrSingleton::SetMaxResultsPerName( int max_num )
+{
+    m_MaxResultsPerName = max_num;
+
+    vector< string > name_vec = GetAllResultsNames();
+    for ( int i = 0 ; i < ( int )name_vec.size() ; i++ )
+    {
+        ExpireResults( name_vec[i] );
+    }
+}
+
+//==== Delete The Oldest Results For Name Over The Limit ====//
+void ResultsMgrSingleton::ExpireResults( const string & name )
+{
+    if ( m_MaxResultsPerName < 1 )
+    {
+        return;
+    }
+
+    map< string, vector< string > >::iterator iter = m_NameIDMap.find( name );
 
-    res_iter = m_ResultsMap.find( id );
+    if ( iter == m_NameIDMap.end() )
+    {
+        return;
+    }
+
+    vector< string > & id_vec = iter->second;
+    int num_expire = ( int )id_vec.size() - m_MaxResultsPerName;
+
+    if ( num_expire <= 0 )
+    {
+        return;
+    }
 
-    if ( res_iter != m_ResultsMap.end() )
+    //==== IDs Are In Creation Order - Oldest First ====//
+    for ( int i = 0 ; i < num_expire ; i++ )
     {
-        delete res_iter->second;
-        m_ResultsMap.erase( res_iter );
+        unordered_map< string, Results* >::iterator res_iter = m_ResultsMap.find( id_vec[i] );
+
+        if ( res_iter != m_ResultsMap.end() )
+        {
+            delete res_iter->second;
+            m_ResultsMap.erase( res_iter );
+        }
     }
+
+    id_vec.erase( id_vec.begin(), id_vec.begin() + num_expire );
 }
 
 
@@ -935,32 +1542,20 @@ string ResultsMgrSingleton::FindResultsID( const string & name, int index )
 string ResultsMgrSingleton::FindLatestResultsID( const string & name )
 {
     map< string, vector< string > >::iterator iter = m_NameIDMap.find( name );
-    if ( iter == m_NameIDMap.end() )
+    if ( iter == m_NameIDMap.end() || iter->second.empty() )
     {
         return string();
     }
 
-    string latest_id;
-    time_t latest_stamp = 0;
-    for ( int i = 0 ; i < ( int )( iter->second.size() ) ; i++ )
-    {
-        string id = iter->second[i];
-        Results* res_ptr = FindResultsPtr( id );
-
-        if ( res_ptr && res_ptr->GetTimestamp() >= latest_stamp )
-        {
-            latest_stamp = res_ptr->GetTimestamp();
-            latest_id = id;
-        }
-    }
-    return latest_id;
+    // Time stamps are only set on creation, so the last ID is the latest
+    return iter->second.back();
 }
 
 
 //==== Find Results Ptr Given ID =====//
 Results* ResultsMgrSingleton::FindResultsPtr( const string & id )
 {
-    map< string, Results* >::iterator id_iter = m_ResultsMap.find( id );
+    unordered_map< string, Results* >::iterator id_iter = m_ResultsMap.find( id );
 
     if ( id_iter ==  m_ResultsMap.end() )
     {
@@ -981,7 +1576,7 @@ Results* ResultsMgrSingleton::FindResults( const string & name, int index )
 //==== Get Results TimeStamp Given ID ====//
 time_t ResultsMgrSingleton::GetResultsTimestamp( const string & results_id )
 {
-    map< string, Results* >::iterator iter = m_ResultsMap.find( results_id );
+    unordered_map< string, Results* >::iterator iter = m_ResultsMap.find( results_id );
 
     if ( iter ==  m_ResultsMap.end() )
     {
@@ -1240,6 +1835,96 @@ const vector<vec3d> & ResultsMgrSingleton::GetVec3dResults( const string & resul
     return rd_ptr->GetVec3dData();
 }
 
+//==== Get Number Of Entries In A Results Column ====//
+int ResultsMgrSingleton::GetResultsDataLength( const string & results_id, const string & name, int index )
+{
+    Results* results_ptr = FindResultsPtr( results_id );
+    if ( !results_ptr )
+    {
+        return 0;
+    }
+
+    NameValData* rd_ptr = results_ptr->FindPtr( name, index );
+    if ( !rd_ptr )
+    {
+        return 0;
+    }
+
+    return rd_ptr->GetLength();
+}
+
+//==== Get A Chunk Of Int Results - Only The Chunk Is Copied ====//
+vector<int> ResultsMgrSingleton::GetIntResultsChunk( const string & results_id, const string & name, int start, int num, int index )
+{
+    Results* results_ptr = FindResultsPtr( results_id );
+    if ( !results_ptr )
+    {
+        return vector<int>();
+    }
+
+    NameValData* rd_ptr = results_ptr->FindPtr( name, index );
+    if ( !rd_ptr )
+    {
+        return vector<int>();
+    }
+
+    return rd_ptr->GetIntChunk( start, num );
+}
+
+//==== Get A Chunk Of Double Results - Only The Chunk Is Copied ====//
+vector<double> ResultsMgrSingleton::GetDoubleResultsChunk( const string & results_id, const string & name, int start, int num, int index )
+{
+    Results* results_ptr = FindResultsPtr( results_id );
+    if ( !results_ptr )
+    {
+        return vector<double>();
+    }
+
+    NameValData* rd_ptr = results_ptr->FindPtr( name, index );
+    if ( !rd_ptr )
+    {
+        return vector<double>();
+    }
+
+    return rd_ptr->GetDoubleChunk( start, num );
+}
+
+//==== Get A Chunk Of String Results - Only The Chunk Is Copied ====//
+vector<string> ResultsMgrSingleton::GetStringResultsChunk( const string & results_id, const string & name, int start, int num, int index )
+{
+    Results* results_ptr = FindResultsPtr( results_id );
+    if ( !results_ptr )
+    {
+        return vector<string>();
+    }
+
+    NameValData* rd_ptr = results_ptr->FindPtr( name, index );
+    if ( !rd_ptr )
+    {
+        return vector<string>();
+    }
+
+    return rd_ptr->GetStringChunk( start, num );
+}
+
+//==== Get A Chunk Of Vec3d Results - Only The Chunk Is Copied ====//
+vector<vec3d> ResultsMgrSingleton::GetVec3dResultsChunk( const string & results_id, const string & name, int start, int num, int index )
+{
+    Results* results_ptr = FindResultsPtr( results_id );
+    if ( !results_ptr )
+    {
+        return vector<vec3d>();
+    }
+
+    NameValData* rd_ptr = results_ptr->FindPtr( name, index );
+    if ( !rd_ptr )
+    {
+        return vector<vec3d>();
+    }
+
+    return rd_ptr->GetVec3dChunk( start, num );
+}
+
 //==== Check If Results ID is Valid ====//
 bool ResultsMgrSingleton::ValidResultsID( const string & results_id )
 {
@@ -1362,3 +2047,43 @@ int ResultsMgrSingleton::WriteCSVFile( const string & file_name, const vector <
         return vsp::VSP_FILE_WRITE_FAILURE;
     }
 }
+
+//==== Open Binary Results File, Writing The Header If It Is New Or Empty ====//
+FILE* ResultsMgrSingleton::OpenBinaryFile( const string & file_name, bool append )
+{
+    FILE* fid = fopen( file_name.c_str(), append ? "ab" : "wb" );
+    if ( !fid )
+    {
+        return NULL;
+    }
+
+    fseek( fid, 0, SEEK_END );
+    if ( ftell( fid ) == 0 )
+    {
+        fwrite( "VSPRSLT1", sizeof( char ), 8, fid );
+        WriteBinaryInt( fid, -123456789 );
+    }
+    return fid;
+}
+
+int ResultsMgrSingleton::WriteBinaryFile( const string & file_name, const vector < string > &resids, bool append )
+{
+    FILE* fid = OpenBinaryFile( file_name, append );
+    if( fid )
+    {
+        for( unsigned int iRes=0; iRes<resids.size(); iRes++ )
+        {
+            Results* resptr = ResultsMgr.FindResultsPtr( resids[iRes] );
+            if( resptr )
+            {
+                resptr->WriteBinaryFile( fid );    //append this result to the binary file
+            }
+        }
+        fclose( fid );          // Close File
+        return vsp::VSP_OK;
+    }
+    else
+    {
+        return vsp::VSP_FILE_WRITE_FAILURE;
+    }
+}
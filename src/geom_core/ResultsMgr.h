@@ -12,6 +12,7 @@
 #define RESULTSMGR__INCLUDED_
 
 #include "Vec3d.h"
+#include "UsingCpp11.h"
 
 #include <map>
 #include <list>
@@ -21,6 +22,8 @@
 using std::map;
 using std::vector;
 using std::string;
+using std::shared_ptr;
+using std::unordered_map;
 
 //==== Results Data - Named Vectors Of Ints/Double/Strings or Vec3d ====//
 class NameValData
@@ -38,6 +41,13 @@ public:
     NameValData( const string & name, const vector< vec3d > & v_data );
     NameValData( const string & name, const vector< vector< double > > &dmat_data );
 
+    //==== Move Construtors Take The Caller's Storage Without Copying ====//
+    NameValData( const string & name, vector< int > && i_data );
+    NameValData( const string & name, vector< double > && d_data );
+    NameValData( const string & name, vector< string > && s_data );
+    NameValData( const string & name, vector< vec3d > && v_data );
+    NameValData( const string & name, vector< vector< double > > && dmat_data );
+
     void Init( const string & name, int type = 0, int index = 0 );
 
     string GetName() const
@@ -49,26 +59,22 @@ public:
         return m_Type;
     }
 
-    const vector<int> & GetIntData() const
-    {
-        return m_IntData;
-    }
-    const vector<double> & GetDoubleData() const
-    {
-        return m_DoubleData;
-    }
-    const vector<string> & GetStringData() const
-    {
-        return m_StringData;
-    }
-    const vector<vec3d> & GetVec3dData() const
-    {
-        return m_Vec3dData;
-    }
-    const vector< vector< double > > & GetDoubleMatData() const
-    {
-        return m_DoubleMatData;
-    }
+    //==== Read-Only Views Of The Shared Columns ====//
+    const vector<int> & GetIntData() const;
+    const vector<double> & GetDoubleData() const;
+    const vector<string> & GetStringData() const;
+    const vector<vec3d> & GetVec3dData() const;
+    const vector< vector< double > > & GetDoubleMatData() const;
+
+    size_t MemoryUsage() const;         // Approximate, shared columns are counted by each holder
+
+    int GetLength() const;              // Entries In The Column Of This Data's Type
+
+    //==== Copy Entries [start, start + num) - Clipped To The Column ====//
+    vector<int> GetIntChunk( int start, int num ) const;
+    vector<double> GetDoubleChunk( int start, int num ) const;
+    vector<string> GetStringChunk( int start, int num ) const;
+    vector<vec3d> GetVec3dChunk( int start, int num ) const;
 
     int GetInt( int index ) const;
     double GetDouble( int index ) const;
@@ -76,36 +82,31 @@ public:
     string GetString( int index ) const;
     vec3d GetVec3d( int index ) const;
 
-    void SetIntData( const vector< int > & d )
-    {
-        m_IntData = d;
-    }
-    void SetDoubleData( const vector< double > & d )
-    {
-        m_DoubleData = d;
-    }
-    void SetStringData( const vector< string > & d )
-    {
-        m_StringData = d;
-    }
-    void SetVec3dData( const vector< vec3d > & d )
-    {
-        m_Vec3dData = d;
-    }
-    void SetDoubleMatData( const vector< vector< double > > & d )
-    {
-        m_DoubleMatData = d;
-    }
+    //==== Set Copies The Data Into A New Column ====//
+    void SetIntData( const vector< int > & d );
+    void SetDoubleData( const vector< double > & d );
+    void SetStringData( const vector< string > & d );
+    void SetVec3dData( const vector< vec3d > & d );
+    void SetDoubleMatData( const vector< vector< double > > & d );
+
+    //==== Move Takes The Data Without Copying ====//
+    void SetIntData( vector< int > && d );
+    void SetDoubleData( vector< double > && d );
+    void SetStringData( vector< string > && d );
+    void SetVec3dData( vector< vec3d > && d );
+    void SetDoubleMatData( vector< vector< double > > && d );
 
 protected:
 
     string m_Name;
     int m_Type;
-    vector< int > m_IntData;
-    vector< double > m_DoubleData;
-    vector< string > m_StringData;
-    vector< vec3d > m_Vec3dData;
-    vector< vector< double > >  m_DoubleMatData;
+
+    //==== Columns Are Shared Between Copies And Never Modified In Place ====//
+    shared_ptr< const vector< int > > m_IntData;
+    shared_ptr< const vector< double > > m_DoubleData;
+    shared_ptr< const vector< string > > m_StringData;
+    shared_ptr< const vector< vec3d > > m_Vec3dData;
+    shared_ptr< const vector< vector< double > > > m_DoubleMatData;
 
 };
 
@@ -139,6 +140,8 @@ public:
     NameValData Find( const string & name, int index = 0 );
     NameValData* FindPtr( const string & name, int index = 0 );
 
+    size_t MemoryUsage() const;
+
 protected:
 
     string m_Name;
@@ -160,6 +163,8 @@ public:
 
     void WriteCSVFile( const string & file_name );
     void WriteCSVFile( FILE* fid );
+    void WriteBinaryFile( const string & file_name, bool append = false );
+    void WriteBinaryFile( FILE* fid, bool follow_children = true );
     void WriteMassProp( const string & file_name );
     void WriteCompGeomTxtFile( const string & file_name );
     void WriteCompGeomCsvFile( const string & file_name );
@@ -203,9 +208,20 @@ public:
     Results* CreateResults( const string & name );                      // Return Results Ptr
 
     string CreateGeomResults( const string & geom_id, const string & name );
+    string CreatePerfStatsResults();                                    // Snapshot Of PerfStatsMgr
+
+    size_t MemoryUsage() const;                                         // Approximate Bytes Held By All Results
 
     void DeleteAllResults();
     void DeleteResult( const string & id );
+    void DeleteNamedResults( const string & name );                   // Delete All Results With Name
+
+    //==== Cap The Results Kept Per Name - Oldest Are Deleted First (< 1 No Limit) ====//
+    void SetMaxResultsPerName( int max_num );
+    int GetMaxResultsPerName()
+    {
+        return m_MaxResultsPerName;
+    }
 
     int GetNumResults( const string & name );
     Results* FindResults( const string & name, int index = 0 );
@@ -228,6 +244,13 @@ public:
     const vector<vector<double>> & GetDoubleMatResults( const string & id, const string & name, int index = 0 );
     const vector<string> & GetStringResults( const string & id, const string & name, int index = 0 );
     const vector<vec3d> & GetVec3dResults( const string & id, const string & name, int index = 0 );
+
+    //==== Chunked Access Copies Only [start, start + num) Of A Column ====//
+    int GetResultsDataLength( const string & id, const string & name, int index = 0 );
+    vector<int> GetIntResultsChunk( const string & id, const string & name, int start, int num, int index = 0 );
+    vector<double> GetDoubleResultsChunk( const string & id, const string & name, int start, int num, int index = 0 );
+    vector<string> GetStringResultsChunk( const string & id, const string & name, int start, int num, int index = 0 );
+    vector<vec3d> GetVec3dResultsChunk( const string & id, const string & name, int start, int num, int index = 0 );
     time_t GetResultsTimestamp( const string & results_id );
 
     bool ValidResultsID( const string & results_id );
@@ -238,14 +261,35 @@ public:
 
     static int WriteCSVFile( const string & file_name, const vector < string > &resids );
 
+    //==== Binary Results File ====//
+    // Header (once per file): "VSPRSLT1", int32 -123456789 (endian check)
+    // Each Results: name, id, int64 timestamp, int32 number of columns
+    // Each column: name, int32 type, int32 length, then the data
+    //   INT_DATA int32[], DOUBLE_DATA double[], VEC3D_DATA 3 x double[],
+    //   STRING_DATA strings, DOUBLE_MATRIX_DATA int32 row length + double[] per row
+    // Strings are int32 length followed by the characters
+    static FILE* OpenBinaryFile( const string & file_name, bool append );
+    static int WriteBinaryFile( const string & file_name, const vector < string > &resids, bool append = false );
+
+    // Reads one Results written without its children, under a new ID.  ResultsVec entries
+    // are mapped through id_map, so children must be read first.  NULL at end of stream.
+    Results* ReadBinaryResults( FILE* fid, map< string, string > & id_map );
+
+    // Appends the IDs of a Results and its ResultsVec children, children first.
+    void GetResultsTree( const string & id, vector < string > & id_vec );
+
 private:
     ResultsMgrSingleton();
     ~ResultsMgrSingleton();
     ResultsMgrSingleton( ResultsMgrSingleton const& copy );          // Not Implemented
     ResultsMgrSingleton& operator=( ResultsMgrSingleton const& copy ); // Not Implemented
 
-    map< string, Results* > m_ResultsMap;                   // Map ID to Results
-    map< string, vector< string > > m_NameIDMap;            // Map Name to ID
+    void ExpireResults( const string & name );
+
+    unordered_map< string, Results* > m_ResultsMap;         // Map ID to Results
+    map< string, vector< string > > m_NameIDMap;            // Map Name to IDs In Creation Order
+
+    int m_MaxResultsPerName;
 
     //==== Default Return Vectors ====//
     vector< int > m_DefaultIntVec;
@@ -23,9 +23,57 @@
 #include "Vehicle.h"
 #include "StringUtil.h"
 #include "FileUtil.h"
+#include "Util.h"
+
+#include <cstring>
+#include <cstdlib>
 
 using namespace vsp;
 
+static unsigned long long HashString( unsigned long long h, const string & str )
+{
+    return HashBytes( h, str.c_str(), str.size() + 1 );
+}
+
+static const char s_ByteCodeMagic[8] = { 'V', 'S', 'P', 'S', 'B', 'C', '1', '\n' };
+
+//==== In Memory Stream For Saving And Loading Bytecode ====//
+class ScriptByteCodeStream : public asIBinaryStream
+{
+public:
+    ScriptByteCodeStream()
+    {
+        m_ReadPos = 0;
+        m_ReadFail = false;
+    }
+
+    virtual void Write( const void *ptr, asUINT size )
+    {
+        const char* c = ( const char* )ptr;
+        m_Buffer.insert( m_Buffer.end(), c, c + size );
+    }
+
+    virtual void Read( void *ptr, asUINT size )
+    {
+        if ( m_ReadPos + size > m_Buffer.size() )
+        {
+            memset( ptr, 0, size );
+            m_ReadPos = m_Buffer.size();
+            m_ReadFail = true;
+            return;
+        }
+        if ( size > 0 )
+        {
+            memcpy( ptr, &m_Buffer[ m_ReadPos ], size );
+            m_ReadPos += size;
+        }
+    }
+
+    vector< char > m_Buffer;
+    size_t m_ReadPos;
+    bool m_ReadFail;
+};
+
 //==== Implement a simple message callback function ====//
 void MessageCallback( const asSMessageInfo *msg, void *param )
 {
@@ -49,13 +97,81 @@ void MessageCallback( const asSMessageInfo *msg, void *param )
 //==================================================================================================//
 
 
+//==== JIT Compiler Gate ====//
+ScriptJITFilter::ScriptJITFilter()
+{
+    m_Backend = NULL;
+    m_NumCompiled = 0;
+    m_NumFallback = 0;
+}
+
+void ScriptJITFilter::SetModuleFlag( const string & module_name, bool flag )
+{
+    if ( flag )
+    {
+        m_ModuleSet.insert( module_name );
+    }
+    else
+    {
+        m_ModuleSet.erase( module_name );
+    }
+}
+
+bool ScriptJITFilter::GetModuleFlag( const string & module_name ) const
+{
+    return m_ModuleSet.find( module_name ) != m_ModuleSet.end();
+}
+
+int ScriptJITFilter::CompileFunction( asIScriptFunction* function, asJITFunction* output )
+{
+    const char* module_name = function->GetModuleName();
+    if ( !m_Backend || !module_name || !GetModuleFlag( string( module_name ) ) )
+    {
+        return asNOT_SUPPORTED;
+    }
+
+    asJITFunction jit_func = NULL;
+    int r = m_Backend->CompileFunction( function, &jit_func );
+    if ( r < 0 || !jit_func )
+    {
+        m_NumFallback++;
+        return asERROR;
+    }
+
+    m_NumCompiled++;
+    *output = jit_func;
+    return asSUCCESS;
+}
+
+void ScriptJITFilter::ReleaseJITFunction( asJITFunction func )
+{
+    if ( m_Backend )
+    {
+        m_Backend->ReleaseJITFunction( func );
+    }
+}
+
 //==== Constructor ====//
 ScriptMgrSingleton::ScriptMgrSingleton()
 {
     m_SaveInt = 0;
     m_ScriptEngine = NULL;
     m_ScriptMessages = "";
+    m_APIKey = 0;
+
+}
+
+//==== Destructor ====//
+ScriptMgrSingleton::~ScriptMgrSingleton()
+{
+    // Pooled contexts each hold a reference to the engine
+    ReleasePooledContexts();
 
+    if ( m_ScriptEngine )
+    {
+        m_ScriptEngine->ShutDownAndRelease();
+        m_ScriptEngine = NULL;
+    }
 }
 
 //==== Set Up Script Engine, Script Error Callbacks ====//
@@ -68,6 +184,8 @@ void ScriptMgrSingleton::Init( )
     init_flag = true;
 
     //==== Create the Script Engine ====//
+    // Scripts may run on several threads, e.g. custom Geoms during a parallel update.
+    asPrepareMultithread();
     m_ScriptEngine = asCreateScriptEngine( ANGELSCRIPT_VERSION );
     asIScriptEngine* se = m_ScriptEngine;
 
@@ -75,6 +193,9 @@ void ScriptMgrSingleton::Init( )
     int r = se->SetMessageCallback( asFUNCTION( MessageCallback ), 0, asCALL_CDECL );
     assert( r >= 0 );
 
+    r = se->SetContextCallbacks( RequestPooledContext, ReturnPooledContext, this );
+    assert( r >= 0 );
+
     //==== Register Addons ====//
     RegisterStdString( m_ScriptEngine );
 
@@ -159,6 +280,38 @@ void ScriptMgrSingleton::Init( )
     // cfd_mesh directly. Calling the API function here allows support for cfd_mesh
     // analysis from the GUI, script, and python interfaces. 
     vsp::RegisterCFDMeshAnalyses();
+
+    //==== JIT Compiler Installed Before Init ====//
+    if ( m_JITFilter.GetBackend() )
+    {
+        se->SetEngineProperty( asEP_INCLUDE_JIT_INSTRUCTIONS, true );
+        se->SetJITCompiler( &m_JITFilter );
+    }
+
+    //==== Bytecode Cache ====//
+    m_APIKey = ComputeAPIKey();
+
+    const char* cache_dir = getenv( "VSP_SCRIPT_CACHE_DIR" );
+    if ( cache_dir )
+    {
+        m_ByteCodeCacheDir = string( cache_dir );
+    }
+}
+
+//==== Install JIT Backend ====//
+// Modules compiled before this call keep their interpreted bytecode.
+void ScriptMgrSingleton::SetJITCompiler( asIJITCompiler* backend )
+{
+    m_JITFilter.SetBackend( backend );
+
+    if ( m_ScriptEngine )
+    {
+        m_ScriptEngine->SetEngineProperty( asEP_INCLUDE_JIT_INSTRUCTIONS, backend != NULL );
+        m_ScriptEngine->SetJITCompiler( backend ? &m_JITFilter : NULL );
+
+        // Bytecode with and without JIT entry points can't be shared.
+        m_APIKey = ComputeAPIKey();
+    }
 }
 
 void ScriptMgrSingleton::RunTestScripts()
@@ -178,7 +331,7 @@ void ScriptMgrSingleton::ReadExecuteScriptFile( const string &  file_name, const
     ExecuteScript( module_name.c_str(), function_name.c_str() );
 }
 
-vector< string > ScriptMgrSingleton::ReadScriptsFromDir( const string & dir_name, const string & suffix )
+vector< string > ScriptMgrSingleton::ReadScriptsFromDir( const string & dir_name, const string & suffix, bool jit_flag )
 {
     vector< string > mod_name_vec;
 
@@ -194,7 +347,7 @@ vector< string > ScriptMgrSingleton::ReadScriptsFromDir( const string & dir_name
                 string sub = file_vec[i].substr( 0, file_vec[i].size() - s_num );
                 string file_name = dir_name;
                 file_name.append( file_vec[i] );
-                string module_name = ScriptMgr.ReadScriptFromFile( sub, file_name );
+                string module_name = ScriptMgr.ReadScriptFromFile( sub, file_name, jit_flag );
 
                 if ( module_name.size() )
                     mod_name_vec.push_back( module_name );
@@ -206,7 +359,7 @@ vector< string > ScriptMgrSingleton::ReadScriptsFromDir( const string & dir_name
 }
 
 //==== Start A New Module And Read Script ====//
-string ScriptMgrSingleton::ReadScriptFromFile( const string & module_name, const string &  file_name )
+string ScriptMgrSingleton::ReadScriptFromFile( const string & module_name, const string &  file_name, bool jit_flag )
 {
     string content = ExtractContent( file_name );
 
@@ -215,11 +368,11 @@ string ScriptMgrSingleton::ReadScriptFromFile( const string & module_name, const
         return string();
     }
 
-    return ReadScriptFromMemory( module_name, content );
+    return ReadScriptFromMemory( module_name, content, jit_flag );
 }
 
 //==== Start A New Module And Read Script ====//
-string ScriptMgrSingleton::ReadScriptFromMemory( const string &  module_name, const string & script_content )
+string ScriptMgrSingleton::ReadScriptFromMemory( const string &  module_name, const string & script_content, bool jit_flag )
 {
     int r;
     string updated_module_name = module_name;
@@ -246,6 +399,20 @@ string ScriptMgrSingleton::ReadScriptFromMemory( const string &  module_name, co
             return iter->first;
     }
 
+    //==== Functions Are Handed To The JIT As The Module Is Built Or Loaded ====//
+    m_JITFilter.SetModuleFlag( updated_module_name, jit_flag );
+    {
+        std::lock_guard< std::mutex > lock( m_FunctionCacheMutex );
+        m_FunctionCache.clear();
+    }
+
+    //==== Skip Compiling If This Script Was Compiled Before ====//
+    if ( LoadCachedByteCode( updated_module_name, script_content ) )
+    {
+        m_ModuleContentMap[ updated_module_name ] = script_content;
+        return updated_module_name;
+    }
+
     //==== Start A New Module ====//
     r = m_ScriptBuilder.StartNewModule( m_ScriptEngine, updated_module_name.c_str() );
     if( r < 0 )        return string();
@@ -256,12 +423,200 @@ string ScriptMgrSingleton::ReadScriptFromMemory( const string &  module_name, co
     r = m_ScriptBuilder.BuildModule();
     if ( r < 0 )    return string();
 
+    SaveCachedByteCode( updated_module_name, script_content );
+
     //==== Add To Map ====//
     m_ModuleContentMap[ updated_module_name ] = script_content;
 
     return updated_module_name;
 }
 
+//==== Hash Everything Registered With The Engine ====//
+// Cached bytecode refers to registered functions, types and properties, so it is
+// only reused when the engine and API it was compiled against are unchanged.
+unsigned long long ScriptMgrSingleton::ComputeAPIKey()
+{
+    asIScriptEngine* se = m_ScriptEngine;
+
+    unsigned long long h = HASH_SEED;
+    h = HashString( h, string( ANGELSCRIPT_VERSION_STRING ) );
+    h = HashString( h, string( VSPVERSION4 ) );
+    h = HashString( h, StringUtil::int_to_string( ( int )sizeof( void* ), "%d" ) );
+    h = HashString( h, string( m_JITFilter.GetBackend() ? "jit" : "nojit" ) );
+
+    for ( asUINT i = 0 ; i < se->GetGlobalFunctionCount() ; i++ )
+    {
+        asIScriptFunction* func = se->GetGlobalFunctionByIndex( i );
+        h = HashString( h, string( func->GetDeclaration( true, true, false ) ) );
+    }
+
+    for ( asUINT i = 0 ; i < se->GetObjectTypeCount() ; i++ )
+    {
+        asITypeInfo* type = se->GetObjectTypeByIndex( i );
+        h = HashString( h, string( type->GetName() ) );
+        asUINT size = type->GetSize();
+        h = HashBytes( h, &size, sizeof( size ) );
+        for ( asUINT m = 0 ; m < type->GetMethodCount() ; m++ )
+        {
+            h = HashString( h, string( type->GetMethodByIndex( m )->GetDeclaration( true, true, false ) ) );
+        }
+        for ( asUINT p = 0 ; p < type->GetPropertyCount() ; p++ )
+        {
+            h = HashString( h, string( type->GetPropertyDeclaration( p, true ) ) );
+        }
+    }
+
+    for ( asUINT i = 0 ; i < se->GetEnumCount() ; i++ )
+    {
+        asITypeInfo* type = se->GetEnumByIndex( i );
+        h = HashString( h, string( type->GetName() ) );
+        for ( asUINT v = 0 ; v < type->GetEnumValueCount() ; v++ )
+        {
+            int val = 0;
+            const char* name = type->GetEnumValueByIndex( v, &val );
+            h = HashString( h, string( name ) );
+            h = HashBytes( h, &val, sizeof( val ) );
+        }
+    }
+
+    for ( asUINT i = 0 ; i < se->GetGlobalPropertyCount() ; i++ )
+    {
+        const char* name = NULL;
+        int type_id = 0;
+        se->GetGlobalPropertyByIndex( i, &name, NULL, &type_id );
+        h = HashString( h, string( name ) );
+        h = HashString( h, string( se->GetTypeDeclaration( type_id, true ) ) );
+    }
+
+    return h;
+}
+
+//==== Cache File For Script Content Hash ====//
+string ScriptMgrSingleton::ByteCodeCacheFileName( unsigned long long content_hash )
+{
+    char str[64];
+    sprintf( str, "%016llx%016llx.vspsbc", m_APIKey, content_hash );
+
+    string file_name = m_ByteCodeCacheDir;
+    if ( file_name.size() && file_name[ file_name.size() - 1 ] != '/' && file_name[ file_name.size() - 1 ] != '\\' )
+    {
+        file_name.append( "/" );
+    }
+    file_name.append( str );
+    return file_name;
+}
+
+//==== Load Module From Cached Bytecode ====//
+// File layout: magic, api key, content hash, content size, bytecode size, bytecode hash, bytecode.
+// Anything that does not match exactly is ignored and the script is compiled instead.
+bool ScriptMgrSingleton::LoadCachedByteCode( const string & module_name, const string & script_content )
+{
+    // Included files are not part of the content hash
+    if ( m_ByteCodeCacheDir.empty() || script_content.find( "#include" ) != string::npos )
+    {
+        return false;
+    }
+
+    unsigned long long content_hash = HashString( HASH_SEED, script_content );
+    string file_name = ByteCodeCacheFileName( content_hash );
+
+    FILE* fp = fopen( file_name.c_str(), "rb" );
+    if ( !fp )
+    {
+        return false;
+    }
+
+    char magic[8];
+    unsigned long long header[5];
+    ScriptByteCodeStream stream;
+
+    bool valid = ( fread( magic, 1, 8, fp ) == 8 && memcmp( magic, s_ByteCodeMagic, 8 ) == 0 );
+    valid = valid && ( fread( header, sizeof( unsigned long long ), 5, fp ) == 5 );
+    valid = valid && header[0] == m_APIKey && header[1] == content_hash && header[2] == ( unsigned long long )script_content.size();
+
+    if ( valid )
+    {
+        stream.m_Buffer.resize( ( size_t )header[3] );
+        valid = ( stream.m_Buffer.empty() || fread( &stream.m_Buffer[0], 1, stream.m_Buffer.size(), fp ) == stream.m_Buffer.size() );
+        valid = valid && stream.m_Buffer.size() && HashBytes( HASH_SEED, &stream.m_Buffer[0], stream.m_Buffer.size() ) == header[4];
+    }
+    fclose( fp );
+
+    if ( !valid )
+    {
+        return false;
+    }
+
+    asIScriptModule* mod = m_ScriptEngine->GetModule( module_name.c_str(), asGM_ALWAYS_CREATE );
+    if ( !mod )
+    {
+        return false;
+    }
+
+    int r = mod->LoadByteCode( &stream );
+    if ( r < 0 || stream.m_ReadFail )
+    {
+        m_ScriptEngine->DiscardModule( module_name.c_str() );
+        return false;
+    }
+
+    return true;
+}
+
+//==== Save Compiled Module To The Cache ====//
+void ScriptMgrSingleton::SaveCachedByteCode( const string & module_name, const string & script_content )
+{
+    if ( m_ByteCodeCacheDir.empty() || script_content.find( "#include" ) != string::npos )
+    {
+        return;
+    }
+
+    asIScriptModule* mod = m_ScriptEngine->GetModule( module_name.c_str(), asGM_ONLY_IF_EXISTS );
+    if ( !mod )
+    {
+        return;
+    }
+
+    ScriptByteCodeStream stream;
+    if ( mod->SaveByteCode( &stream ) < 0 || stream.m_Buffer.empty() )
+    {
+        return;
+    }
+
+    unsigned long long header[5];
+    header[0] = m_APIKey;
+    header[1] = HashString( HASH_SEED, script_content );
+    header[2] = ( unsigned long long )script_content.size();
+    header[3] = ( unsigned long long )stream.m_Buffer.size();
+    header[4] = HashBytes( HASH_SEED, &stream.m_Buffer[0], stream.m_Buffer.size() );
+
+    //==== Write To A Temporary File And Rename So Readers Never See A Partial File ====//
+    string file_name = ByteCodeCacheFileName( header[1] );
+    string tmp_name = file_name + ".tmp";
+
+    FILE* fp = fopen( tmp_name.c_str(), "wb" );
+    if ( !fp )
+    {
+        return;
+    }
+
+    bool valid = ( fwrite( s_ByteCodeMagic, 1, 8, fp ) == 8 );
+    valid = valid && ( fwrite( header, sizeof( unsigned long long ), 5, fp ) == 5 );
+    valid = valid && ( fwrite( &stream.m_Buffer[0], 1, stream.m_Buffer.size(), fp ) == stream.m_Buffer.size() );
+    valid = ( fclose( fp ) == 0 ) && valid;
+
+    if ( valid )
+    {
+        remove( file_name.c_str() );
+        valid = ( rename( tmp_name.c_str(), file_name.c_str() ) == 0 );
+    }
+
+    if ( !valid )
+    {
+        remove( tmp_name.c_str() );
+    }
+}
+
 //==== Extract Content From File Into String ====//
 string ScriptMgrSingleton::ExtractContent( const string & file_name )
 {
@@ -292,6 +647,11 @@ bool ScriptMgrSingleton::RemoveScript( const string &  module_name )
     }
 
     m_ModuleContentMap.erase( iter );
+    m_JITFilter.SetModuleFlag( module_name, false );
+    {
+        std::lock_guard< std::mutex > lock( m_FunctionCacheMutex );
+        m_FunctionCache.clear();
+    }
 
     int ret = m_ScriptEngine->DiscardModule( module_name.c_str() );
 
@@ -315,15 +675,42 @@ bool ScriptMgrSingleton::ExecuteScript(  const char* module_name,  const char* f
         return false;
     }
 
-    asIScriptFunction *func = mod->GetFunctionByDecl( function_name );
+    //==== Cache Lookups, Scripts Like UpdateSurf Run On Every Update ====//
+    string key = string( module_name ) + "|" + function_name;
+    asIScriptFunction *func = NULL;
+    {
+        std::lock_guard< std::mutex > lock( m_FunctionCacheMutex );
+        map< string, asIScriptFunction* >::iterator fiter = m_FunctionCache.find( key );
+        if ( fiter != m_FunctionCache.end() )
+        {
+            func = fiter->second;
+        }
+        else
+        {
+            func = mod->GetFunctionByDecl( function_name );
+            m_FunctionCache[ key ] = func;
+        }
+    }
+
     if( func == 0 )
     {
         return false;
     }
 
-    // Create our context, prepare it, and then execute
-    asIScriptContext *ctx = m_ScriptEngine->CreateContext();
-    ctx->Prepare( func );
+    // Take a context from the pool, prepare it, and then execute
+    asIScriptContext *ctx = m_ScriptEngine->RequestContext();
+    if ( !ctx )
+    {
+        return false;
+    }
+
+    r = ctx->Prepare( func );
+    if ( r < 0 )
+    {
+        m_ScriptEngine->ReturnContext( ctx );
+        return false;
+    }
+
     if ( arg_flag )
     {
         ctx->SetArgDouble( 0, arg );
@@ -337,8 +724,71 @@ bool ScriptMgrSingleton::ExecuteScript(  const char* module_name,  const char* f
             // An exception occurred, let the script writer know what happened so it can be corrected.
             printf( "An exception '%s' occurred \n", ctx->GetExceptionString() );
         }
+        m_ScriptEngine->ReturnContext( ctx );
+        return false;
+    }
+    m_ScriptEngine->ReturnContext( ctx );
+    return true;
+}
+
+//==== Hand Out An Idle Context, Or Create One When Every Context Is Busy ====//
+asIScriptContext* ScriptMgrSingleton::RequestPooledContext( asIScriptEngine* engine, void* param )
+{
+    ScriptMgrSingleton* mgr = ( ScriptMgrSingleton* )param;
+    {
+        std::lock_guard< std::mutex > lock( mgr->m_ContextPoolMutex );
+        if ( !mgr->m_ContextPool.empty() )
+        {
+            asIScriptContext* ctx = mgr->m_ContextPool.back();
+            mgr->m_ContextPool.pop_back();
+            return ctx;
+        }
+    }
+    return engine->CreateContext();
+}
+
+void ScriptMgrSingleton::ReturnPooledContext( asIScriptEngine* engine, asIScriptContext* ctx, void* param )
+{
+    ScriptMgrSingleton* mgr = ( ScriptMgrSingleton* )param;
+
+    // Release references held by the finished call before another thread reuses it
+    ctx->Unprepare();
+
+    std::lock_guard< std::mutex > lock( mgr->m_ContextPoolMutex );
+    mgr->m_ContextPool.push_back( ctx );
+}
+
+//==== Release The Idle Contexts, Contexts In Use Are Released When Returned ====//
+void ScriptMgrSingleton::ReleasePooledContexts()
+{
+    std::lock_guard< std::mutex > lock( m_ContextPoolMutex );
+    for ( int i = 0 ; i < ( int )m_ContextPool.size() ; i++ )
+    {
+        m_ContextPool[i]->Release();
+    }
+    m_ContextPool.clear();
+}
+
+//==== Module Has No Mutable Globals ====//
+// Functions of such a module only share state through the VSP API, so their runs for
+// different Geoms may overlap.
+bool ScriptMgrSingleton::IsModuleStateless( const string & module_name )
+{
+    asIScriptModule* mod = m_ScriptEngine ? m_ScriptEngine->GetModule( module_name.c_str(), asGM_ONLY_IF_EXISTS ) : NULL;
+    if ( !mod )
+    {
         return false;
     }
+
+    for ( asUINT i = 0 ; i < mod->GetGlobalVarCount() ; i++ )
+    {
+        bool const_flag = false;
+        mod->GetGlobalVar( i, NULL, NULL, NULL, &const_flag );
+        if ( !const_flag )
+        {
+            return false;
+        }
+    }
     return true;
 }
 
@@ -641,6 +1091,8 @@ void ScriptMgrSingleton::RegisterEnums( asIScriptEngine* se )
     assert( r >= 0 );
     r = se->RegisterEnumValue( "CFD_CONTROL_TYPE", "CFD_SRF_XYZ_FLAG", CFD_SRF_XYZ_FLAG, "/*!< Flag to include X,Y,Z intersection curves in export files */" );
     assert( r >= 0 );
+    r = se->RegisterEnumValue( "CFD_CONTROL_TYPE", "CFD_OUT_OF_CORE_FLAG", CFD_OUT_OF_CORE_FLAG, "/*!< Flag to keep finished surface meshes in a temporary file, for meshes too large for memory */" );
+    assert( r >= 0 );
 
     doc_struct.comment = "/*! Enum used to describe various CFD Mesh export file options. \\sa SetComputationFileName(), ComputeCFDMesh() */";
 
@@ -777,6 +1229,8 @@ void ScriptMgrSingleton::RegisterEnums( asIScriptEngine* se )
     assert( r >= 0 );
     r = se->RegisterEnumValue( "COMPUTATION_FILE_TYPE", "DEGEN_GEOM_M_TYPE", DEGEN_GEOM_M_TYPE, "/*!< Degen Geom M file type */" );
     assert( r >= 0 );
+    r = se->RegisterEnumValue( "COMPUTATION_FILE_TYPE", "DEGEN_GEOM_BIN_TYPE", DEGEN_GEOM_BIN_TYPE, "/*!< Degen Geom binary file type */" );
+    assert( r >= 0 );
     r = se->RegisterEnumValue( "COMPUTATION_FILE_TYPE", "CFD_STL_TYPE", CFD_STL_TYPE, "/*!< CFD Mesh STL file type */" );
     assert( r >= 0 );
     r = se->RegisterEnumValue( "COMPUTATION_FILE_TYPE", "CFD_POLY_TYPE", CFD_POLY_TYPE, "/*!<CFD Mesh POLY file type */" );
@@ -1279,7 +1733,7 @@ void ScriptMgrSingleton::RegisterEnums( asIScriptEngine* se )
     assert( r >= 0 );
     r = se->RegisterEnumValue( "IMPORT_TYPE", "IMPORT_XSEC_MESH", IMPORT_XSEC_MESH, "/*!< XSec as Tri Mesh (*.hrm) import */" );
     assert( r >= 0 );
-    r = se->RegisterEnumValue( "IMPORT_TYPE", "IMPORT_PTS", IMPORT_PTS, "/*!< Point Cloud (*.pts) import */" );
+    r = se->RegisterEnumValue( "IMPORT_TYPE", "IMPORT_PTS", IMPORT_PTS, "/*!< Point Cloud (*.pts, *.ply, *.las) import */" );
     assert( r >= 0 );
     r = se->RegisterEnumValue( "IMPORT_TYPE", "IMPORT_V2", IMPORT_V2, "/*!< OpenVSP v2 (*.vsp) import */" );
     assert( r >= 0 );
@@ -1326,6 +1780,15 @@ void ScriptMgrSingleton::RegisterEnums( asIScriptEngine* se )
     r = se->RegisterEnumValue( "LEN_UNITS", "LEN_UNITLESS", LEN_UNITLESS, "/*!< Unitless */" );
     assert( r >= 0 );
 
+    doc_struct.comment = "/*! Enum for the method used to compute mass properties. */";
+
+    r = se->RegisterEnum( "MASS_PROP_MODE", doc_struct );
+    assert( r >= 0 );
+    r = se->RegisterEnumValue( "MASS_PROP_MODE", "MASS_PROP_SLICE", MASS_PROP_SLICE, "/*!< Slice along X and sum prisms of the interior */" );
+    assert( r >= 0 );
+    r = se->RegisterEnumValue( "MASS_PROP_MODE", "MASS_PROP_ANALYTIC", MASS_PROP_ANALYTIC, "/*!< Exact surface integrals over the trimmed meshes, slice count is ignored */" );
+    assert( r >= 0 );
+
     doc_struct.comment = "/*! Enum that describes units for mass. */";
 
     r = se->RegisterEnum( "MASS_UNIT", doc_struct );
@@ -3298,6 +3761,42 @@ void ScriptMgrSingleton::RegisterCustomGeomMgr( asIScriptEngine* se )
                                     asMETHOD( CustomGeomMgrSingleton, SetVspSurfCfdType ), asCALL_THISCALL_ASGLOBAL, &CustomGeomMgr, doc_struct );
     assert( r );
 
+    doc_struct.comment = R"(
+/*!
+    Let the current custom Geom reuse its surfaces while its parms and the parms of its XSecs are unchanged, skipping UpdateSurf. Only enable this for scripts whose UpdateSurf depends on nothing else, such as the placement of the Geom or other Geoms.
+    \code{.cpp}
+    void Init()
+    {
+        string length = AddParm( PARM_DOUBLE_TYPE, "Length", "Design" );
+
+        SetCustomSurfCache( true );
+    }
+    \endcode
+    \param [in] flag Flag to cache the surfaces
+*/)";
+    r = se->RegisterGlobalFunction( "void SetCustomSurfCache( bool flag )",
+                                    asMETHOD( CustomGeomMgrSingleton, SetCustomSurfCache ), asCALL_THISCALL_ASGLOBAL, &CustomGeomMgr, doc_struct );
+    assert( r );
+
+    doc_struct.comment = R"(
+/*!
+    Let the current custom Geom update at the same time as other Geoms during a parallel update. Scripts without global variables, or with only const globals, already do. Only enable this when UpdateSurf, ComputeCenter and Scale leave any non-const globals untouched, since every Geom of the script type shares them.
+    \code{.cpp}
+    int NUM_XSECS = 11; // Only read, never assigned
+
+    void Init()
+    {
+        string length = AddParm( PARM_DOUBLE_TYPE, "Length", "Design" );
+
+        SetCustomParallelUpdate( true );
+    }
+    \endcode
+    \param [in] flag Flag to allow parallel update
+*/)";
+    r = se->RegisterGlobalFunction( "void SetCustomParallelUpdate( bool flag )",
+                                    asMETHOD( CustomGeomMgrSingleton, SetCustomParallelUpdate ), asCALL_THISCALL_ASGLOBAL, &CustomGeomMgr, doc_struct );
+    assert( r );
+
     doc_struct.comment = R"(
 /*!
     Set the location of an XSec for the current custom Geom
@@ -3976,7 +4475,8 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
 
     doc_struct.comment = R"(
 /*!
-    Load an OpenVSP project from a VSP3 file
+    Load an OpenVSP project from a VSP3 file, or from a binary snapshot if the name ends in .vspb.
+    A snapshot of the model already loaded only restores its Parm values.
     \code{.cpp}
     string fid = AddGeom( "FUSELAGE", "" );             // Add Fuselage
 
@@ -4007,7 +4507,7 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
 
     doc_struct.comment = R"(
 /*!
-    Save the current OpenVSP project to a VSP3 file
+    Save the current OpenVSP project to a VSP3 file, or to a binary snapshot if the name ends in .vspb
     \code{.cpp}
     string fid = AddGeom( "FUSELAGE", "" );             // Add Fuselage
 
@@ -4277,15 +4777,46 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
 
     doc_struct.comment = R"(
 /*!
-    Compute the degenerate geometry representation for the components in the set. Alternatively can be run through the Analysis Manager with 'DegenGeom' or 'VSPAERODegenGeom'.
+    Slice and mesh the components in the set with several sets of planes. The mesh is built once and every set
+    of slices is computed from it. One 'Slice' results entry is created for each set of planes.
     \code{.cpp}
-    //==== Set File Name ====//
-    SetComputationFileName( DEGEN_GEOM_CSV_TYPE, "TestDegenScript.csv" );
+    //==== Add Pod Geom ====//
+    pid = AddGeom( "POD", "" );
 
-    //==== Run Degen Geom ====//
-    ComputeDegenGeom( SET_ALL, DEGEN_GEOM_CSV_TYPE );
+    //==== Test Plane Slice Batch ====//
+    array< vec3d > norm_arr = { vec3d( 1.0, 0.0, 0.0 ), vec3d( 0.0, 0.0, 1.0 ) };
+    array< int > num_arr = { 10, 6 };
+    array< double > bnd_arr;
+
+    array< string > @res_arr = ComputePlaneSliceBatch( 0, norm_arr, num_arr, true, bnd_arr, bnd_arr );
+
+    double_arr = GetDoubleResults( res_arr[1], "Slice_Area" );
+
+    if ( double_arr.size() != 6 )                                    { Print( "---> Error: API ComputePlaneSliceBatch" ); }
     \endcode
-    \sa SetAnalysisInputDefaults, PrintAnalysisInputs, ExecAnalysis, COMPUTATION_FILE_TYPE
+    \sa ComputePlaneSlice
+    \param [in] set Set index (i.e. SET_ALL)
+    \param [in] norm_arr Normal axis for each set of slices
+    \param [in] num_arr Number of slices in each set
+    \param [in] auto_bnd Flag to automatically set the start and end bound locations
+    \param [in] start_arr Location of the first slice along each normal axis (ignored if auto_bnd)
+    \param [in] end_arr Location of the last slice along each normal axis (ignored if auto_bnd)
+    \return Array of Slice results IDs
+*/)";
+    r = se->RegisterGlobalFunction( "array<string>@ ComputePlaneSliceBatch( int set, array<vec3d>@ norm_arr, array<int>@ num_arr, bool auto_bnd, array<double>@ start_arr, array<double>@ end_arr )", asMETHOD( ScriptMgrSingleton, ComputePlaneSliceBatch ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Compute the degenerate geometry representation for the components in the set. Alternatively can be run through the Analysis Manager with 'DegenGeom' or 'VSPAERODegenGeom'.
+    \code{.cpp}
+    //==== Set File Name ====//
+    SetComputationFileName( DEGEN_GEOM_CSV_TYPE, "TestDegenScript.csv" );
+
+    //==== Run Degen Geom ====//
+    ComputeDegenGeom( SET_ALL, DEGEN_GEOM_CSV_TYPE );
+    \endcode
+    \sa SetAnalysisInputDefaults, PrintAnalysisInputs, ExecAnalysis, COMPUTATION_FILE_TYPE
     \param [in] set Set index (i.e. SET_ALL)
     \param [in] file_type DegenGeom file type to export (supports XOR i.e DEGEN_GEOM_M_TYPE & DEGEN_GEOM_CSV_TYPE)
 */)";
@@ -4336,6 +4867,19 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     r = se->RegisterGlobalFunction( "void ComputeCFDMesh( int set, int file_type )", asFUNCTION( vsp::ComputeCFDMesh ), asCALL_CDECL, doc_struct );
     assert( r >= 0 );
 
+    doc_struct.comment = R"(
+/*!
+    Ask a CFD Mesh, FEA Mesh or surface intersection running on another thread to stop. The flag is checked between
+    meshing stages and inside the intersection and remesh loops. Stage timing up to the cancel is still written to the
+    "CFD_Mesh_Timing", "FEA_Mesh_Timing" or "Surface_Intersection_Timing" Results.
+    \code{.cpp}
+    CancelMeshGeneration();
+    \endcode
+    \sa ComputeCFDMesh, ComputeFeaMesh
+*/)";
+    r = se->RegisterGlobalFunction( "void CancelMeshGeneration()", asFUNCTION( vsp::CancelMeshGeneration ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
     doc_struct.comment = R"(
 /*!
     Set the value of a specific CFD Mesh option
@@ -4499,6 +5043,47 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     r = se->RegisterGlobalFunction( "string ExecAnalysis( const string & in analysis )", asFUNCTION( vsp::ExecAnalysis ), asCALL_CDECL, doc_struct );
     assert( r >= 0 );
 
+    doc_struct.comment = R"(
+/*!
+    Turn memoized analysis execution on or off. When on, executing an analysis with the same inputs on an
+    unchanged vehicle returns the previous Result ID without running it again. The vehicle is unchanged when
+    no Parm has changed and no Geom has been added, removed, or moved between sets. Other state, such as
+    external files, is not tracked; use InvalidateAnalysisCache when it changes.
+    \code{.cpp}
+    SetAnalysisCacheFlag( true );
+
+    string rid_a = ExecAnalysis( "MassProp" );
+    string rid_b = ExecAnalysis( "MassProp" ); // Returns rid_a
+    \endcode
+    \sa GetAnalysisCacheFlag, InvalidateAnalysisCache
+    \param [in] flag True to enable the analysis cache
+*/)";
+    r = se->RegisterGlobalFunction( "void SetAnalysisCacheFlag( bool flag )", asFUNCTION( vsp::SetAnalysisCacheFlag ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Get the memoized analysis execution flag
+    \sa SetAnalysisCacheFlag, InvalidateAnalysisCache
+    \return True if the analysis cache is enabled
+*/)";
+    r = se->RegisterGlobalFunction( "bool GetAnalysisCacheFlag()", asFUNCTION( vsp::GetAnalysisCacheFlag ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Forget the cached results of an analysis, so its next execution runs it again
+    \code{.cpp}
+    InvalidateAnalysisCache( "CompGeom" ); // One analysis
+
+    InvalidateAnalysisCache(); // All analyses
+    \endcode
+    \sa SetAnalysisCacheFlag, GetAnalysisCacheFlag
+    \param [in] analysis Analysis name, or empty for all analyses
+*/)";
+    r = se->RegisterGlobalFunction( "void InvalidateAnalysisCache( const string & in analysis = \"\" )", asFUNCTION( vsp::InvalidateAnalysisCache ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
     doc_struct.comment = R"(
 /*!
     Get the number of input data for the particular analysis type and input
@@ -4981,143 +5566,460 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     \param [in] index Data index
     \return Array of data values
 */)";
-    r = se->RegisterGlobalFunction( "array<string>@ GetStringResults( const string & in id, const string & in name, int index = 0 )", asMETHOD( ScriptMgrSingleton, GetStringResults ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr, doc_struct );
+    r = se->RegisterGlobalFunction( "array<string>@ GetStringResults( const string & in id, const string & in name, int index = 0 )", asMETHOD( ScriptMgrSingleton, GetStringResults ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Get all vec3d values for a particular result, name, and index
+    \code{.cpp}
+    //==== Write Some Fake Test Results =====//
+    WriteTestResults();
+
+    res_id = FindLatestResultsID( "Test_Results" );
+
+    array<vec3d> @vec3d_vec = GetVec3dResults( res_id, "Test_Vec3d" );
+
+    if ( !CloseVec3d( vec3d_vec[0], vec3d( 1.0, 2.0, 4.0 ), tol ) )        { Print( "---> Error: API GetVec3dResults" ); }
+    \endcode
+    \param [in] id Result ID
+    \param [in] name Data name
+    \param [in] index Data index
+    \return Array of data values
+*/)";
+    r = se->RegisterGlobalFunction( "array<vec3d>@ GetVec3dResults( const string & in id, const string & in name, int index = 0 )", asMETHOD( ScriptMgrSingleton, GetVec3dResults ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Get the number of entries in the data for a particular result, name, and index. Use with the chunked
+    results functions to walk large results without copying them all at once.
+    \code{.cpp}
+    string mesh_id = ComputeCompGeom( SET_ALL, false, 0 );
+
+    string mesh_res_id = CreateGeomResults( mesh_id, "Comp_Mesh" );
+
+    int num_pnt = GetResultsDataLength( mesh_res_id, "Tri_Pnts" );
+
+    for ( int start = 0; start < num_pnt; start += 10000 )
+    {
+        array<vec3d> @pnt_arr = GetVec3dResultsChunk( mesh_res_id, "Tri_Pnts", start, 10000 );
+    }
+    \endcode
+    \sa GetIntResultsChunk, GetDoubleResultsChunk, GetStringResultsChunk, GetVec3dResultsChunk
+    \param [in] id Result ID
+    \param [in] name Data name
+    \param [in] index Data index
+    \return Number of data entries
+*/)";
+    r = se->RegisterGlobalFunction( "int GetResultsDataLength( const string & in id, const string & in name, int index = 0 )", asFUNCTION( vsp::GetResultsDataLength ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Get the int values [start, start + num) for a particular result, name, and index. Only the chunk is copied,
+    and it is clipped to the end of the data.
+    \sa GetResultsDataLength
+    \param [in] id Result ID
+    \param [in] name Data name
+    \param [in] start Index of the first entry
+    \param [in] num Maximum number of entries
+    \param [in] index Data index
+    \return Array of data values
+*/)";
+    r = se->RegisterGlobalFunction( "array<int>@ GetIntResultsChunk( const string & in id, const string & in name, int start, int num, int index = 0 )", asMETHOD( ScriptMgrSingleton, GetIntResultsChunk ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Get the double values [start, start + num) for a particular result, name, and index. Only the chunk is copied,
+    and it is clipped to the end of the data.
+    \sa GetResultsDataLength
+    \param [in] id Result ID
+    \param [in] name Data name
+    \param [in] start Index of the first entry
+    \param [in] num Maximum number of entries
+    \param [in] index Data index
+    \return Array of data values
+*/)";
+    r = se->RegisterGlobalFunction( "array<double>@ GetDoubleResultsChunk( const string & in id, const string & in name, int start, int num, int index = 0 )", asMETHOD( ScriptMgrSingleton, GetDoubleResultsChunk ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Get the string values [start, start + num) for a particular result, name, and index. Only the chunk is copied,
+    and it is clipped to the end of the data.
+    \sa GetResultsDataLength
+    \param [in] id Result ID
+    \param [in] name Data name
+    \param [in] start Index of the first entry
+    \param [in] num Maximum number of entries
+    \param [in] index Data index
+    \return Array of data values
+*/)";
+    r = se->RegisterGlobalFunction( "array<string>@ GetStringResultsChunk( const string & in id, const string & in name, int start, int num, int index = 0 )", asMETHOD( ScriptMgrSingleton, GetStringResultsChunk ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Get the vec3d values [start, start + num) for a particular result, name, and index. Only the chunk is copied,
+    and it is clipped to the end of the data.
+    \sa GetResultsDataLength
+    \param [in] id Result ID
+    \param [in] name Data name
+    \param [in] start Index of the first entry
+    \param [in] num Maximum number of entries
+    \param [in] index Data index
+    \return Array of data values
+*/)";
+    r = se->RegisterGlobalFunction( "array<vec3d>@ GetVec3dResultsChunk( const string & in id, const string & in name, int start, int num, int index = 0 )", asMETHOD( ScriptMgrSingleton, GetVec3dResultsChunk ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr, doc_struct );
+    assert( r >= 0 );
+    
+    doc_struct.comment = R"(
+/*!
+    Create a new result for a Geom
+    \code{.cpp}
+    //==== Test Comp Geom ====//
+    gid1 = AddGeom( "POD", "" );
+
+    string mesh_id = ComputeCompGeom( 0, false, 0 );
+
+    //==== Test Comp Geom Mesh Results ====//
+    string mesh_geom_res_id = CreateGeomResults( mesh_id, "Comp_Mesh" );
+
+    int_arr = GetIntResults( mesh_geom_res_id, "Num_Tris" );
+
+    if ( int_arr[0] < 4 )                                            { Print( "---> Error: API CreateGeomResults" ); }
+    \endcode
+    \param [in] geom_id Geom ID
+    \param [in] name Result name
+    \return Result ID
+*/)";
+    r = se->RegisterGlobalFunction( "string CreateGeomResults( const string & in geom_id, const string & in name )", asFUNCTION( vsp::CreateGeomResults ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Delete all results
+    \code{.cpp}
+    //==== Test Comp Geom ====//
+    gid1 = AddGeom( "POD", "" );
+
+    string mesh_id = ComputeCompGeom( 0, false, 0 );
+
+    //==== Test Comp Geom Mesh Results ====//
+    string mesh_geom_res_id = CreateGeomResults( mesh_id, "Comp_Mesh" );
+
+    DeleteAllResults();
+
+    if ( GetNumResults( "Comp_Mesh" ) != 0 )                { Print( "---> Error: API DeleteAllResults" ); }
+    \endcode
+*/)";
+    r = se->RegisterGlobalFunction( "void DeleteAllResults()", asFUNCTION( vsp::DeleteAllResults ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Delete a particular result
+    \code{.cpp}
+    //==== Test Comp Geom ====//
+    gid1 = AddGeom( "POD", "" );
+
+    string mesh_id = ComputeCompGeom( 0, false, 0 );
+
+    //==== Test Comp Geom Mesh Results ====//
+    string mesh_geom_res_id = CreateGeomResults( mesh_id, "Comp_Mesh" );
+
+    DeleteResult( mesh_geom_res_id );
+
+    if ( GetNumResults( "Comp_Mesh" ) != 0 )                { Print( "---> Error: API DeleteResult" ); }
+    \endcode
+    \param [in] id Result ID
+*/)";
+    r = se->RegisterGlobalFunction( "void DeleteResult( const string & in id )", asFUNCTION( vsp::DeleteResult ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Export a result to CSV
+    \code{.cpp}
+    // Add Pod Geom
+    string pid = AddGeom( "POD" );
+
+    string analysis_name = "VSPAEROComputeGeometry";
+
+    string rid = ExecAnalysis( analysis_name );
+
+    WriteResultsCSVFile( rid, "CompGeomRes.csv" );
+    \endcode
+    \param [in] id Rsult ID
+    \param [in] file_name CSV output file name
+*/)";
+    r = se->RegisterGlobalFunction( "void WriteResultsCSVFile( const string & in id, const string & in file_name )", asFUNCTION( vsp::WriteResultsCSVFile ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Export a result to a binary file with typed columns. The file layout is described in ResultsMgr.h.
+    \code{.cpp}
+    // Add Pod Geom
+    string pid = AddGeom( "POD" );
+
+    string analysis_name = "VSPAEROComputeGeometry";
+
+    string rid = ExecAnalysis( analysis_name );
+
+    WriteResultsBinaryFile( rid, "CompGeomRes.vspres", true );
+    \endcode
+    \param [in] id Result ID
+    \param [in] file_name Binary output file name
+    \param [in] append Flag to append to an existing file instead of overwriting it
+*/)";
+    r = se->RegisterGlobalFunction( "void WriteResultsBinaryFile( const string & in id, const string & in file_name, bool append = false )", asFUNCTION( vsp::WriteResultsBinaryFile ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Print a result's name value pairs to stdout
+    \code{.cpp}
+    // Add Pod Geom
+    string pid = AddGeom( "POD" );
+
+    string analysis_name = "VSPAEROComputeGeometry";
+
+    string rid = ExecAnalysis( analysis_name );
+
+    // Get & Display Results
+    PrintResults( rid );
+    \endcode
+    \param [in] id Result ID
+*/)";
+    r = se->RegisterGlobalFunction( "void PrintResults( const string & in id )", asFUNCTION( vsp::PrintResults ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Create two sets of test results, each conatining int, string, vec3d, double, and vector< double > data types. 
+    \code{.cpp}
+    //==== Write Some Fake Test Results =====//
+    WriteTestResults();
+
+    if ( GetNumResults( "Test_Results" ) != 2 )                { Print( "---> Error: API GetNumResults" ); }
+    \endcode
+*/)";
+    r = se->RegisterGlobalFunction( "void WriteTestResults()", asMETHOD( ResultsMgrSingleton, WriteTestResults ), asCALL_THISCALL_ASGLOBAL, &ResultsMgr, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Turn collection of stage timings, counters and peak memory on or off. Setting the VSP_PERF_TRACE environment variable to a file name turns collection and tracing on at startup and writes a Chrome trace to that file at exit.
+    \code{.cpp}
+    SetPerfStatsFlag( true );
+
+    string pid = AddGeom( "POD" );
+
+    Update();
+
+    string rid = CreatePerfStatsResults();
+
+    WriteResultsCSVFile( rid, "PerfStats.csv" );
+    \endcode
+    \sa CreatePerfStatsResults, WritePerfTraceFile
+    \param [in] flag Flag to collect statistics
+    \param [in] trace_flag Flag to also keep every timed scope for WritePerfTraceFile
+*/)";
+    r = se->RegisterGlobalFunction( "void SetPerfStatsFlag( bool flag, bool trace_flag = false )", asFUNCTION( vsp::SetPerfStatsFlag ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Get the flag set by SetPerfStatsFlag
+    \return Flag to collect statistics
+*/)";
+    r = se->RegisterGlobalFunction( "bool GetPerfStatsFlag()", asFUNCTION( vsp::GetPerfStatsFlag ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Clear all collected timings, counters and trace events and restart the elapsed time
+*/)";
+    r = se->RegisterGlobalFunction( "void ResetPerfStats()", asFUNCTION( vsp::ResetPerfStats ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Create a "Perf_Stats" result from the statistics collected so far. Scopes are merged over threads and listed by name with Count, Total_Sec, Mean_Sec, Min_Sec, Max_Sec and Peak_Mem_MB. Counters are listed in Counter and Counter_Value.
+    \code{.cpp}
+    string rid = CreatePerfStatsResults();
+
+    PrintResults( rid );
+    \endcode
+    \sa SetPerfStatsFlag
+    \return Result ID
+*/)";
+    r = se->RegisterGlobalFunction( "string CreatePerfStatsResults()", asFUNCTION( vsp::CreatePerfStatsResults ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Write the timed scopes kept since tracing was turned on as a Chrome trace (chrome://tracing) JSON file
+    \sa SetPerfStatsFlag
+    \param [in] file_name Output file name
+*/)";
+    r = se->RegisterGlobalFunction( "void WritePerfTraceFile( const string & in file_name )", asFUNCTION( vsp::WritePerfTraceFile ), asCALL_CDECL, doc_struct );
     assert( r >= 0 );
 
     doc_struct.comment = R"(
 /*!
-    Get all vec3d values for a particular result, name, and index
+    Set the number of threads shared by every parallel stage of OpenVSP (tessellation, CFD and FEA meshing, CompGeom, exporters) and the most given to a local VSPAERO solve. The VSP_NUM_THREADS environment variable sets the starting value.
     \code{.cpp}
-    //==== Write Some Fake Test Results =====//
-    WriteTestResults();
-
-    res_id = FindLatestResultsID( "Test_Results" );
+    SetNumThreads( 4 );
 
-    array<vec3d> @vec3d_vec = GetVec3dResults( res_id, "Test_Vec3d" );
+    Print( "Threads: " + GetNumThreads() );
 
-    if ( !CloseVec3d( vec3d_vec[0], vec3d( 1.0, 2.0, 4.0 ), tol ) )        { Print( "---> Error: API GetVec3dResults" ); }
+    SetNumThreads( 0 ); // Restore the default
     \endcode
-    \param [in] id Result ID
-    \param [in] name Data name
-    \param [in] index Data index
-    \return Array of data values
+    \sa GetNumThreads
+    \param [in] num Number of threads, less than one restores the default
 */)";
-    r = se->RegisterGlobalFunction( "array<vec3d>@ GetVec3dResults( const string & in id, const string & in name, int index = 0 )", asMETHOD( ScriptMgrSingleton, GetVec3dResults ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr, doc_struct );
+    r = se->RegisterGlobalFunction( "void SetNumThreads( int num )", asFUNCTION( vsp::SetNumThreads ), asCALL_CDECL, doc_struct );
     assert( r >= 0 );
-    
+
     doc_struct.comment = R"(
 /*!
-    Create a new result for a Geom
+    Get the number of threads set by SetNumThreads
+    \sa SetNumThreads
+    \return Number of threads
+*/)";
+    r = se->RegisterGlobalFunction( "int GetNumThreads()", asFUNCTION( vsp::GetNumThreads ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Turn headless mode on or off. While headless, Geom updates skip building draw objects and no GUI update notifications are sent. Draw objects are rebuilt when a GUI attaches or headless mode is turned off.
     \code{.cpp}
-    //==== Test Comp Geom ====//
-    gid1 = AddGeom( "POD", "" );
+    SetHeadlessMode( true );
 
-    string mesh_id = ComputeCompGeom( 0, false, 0 );
+    string pid = AddGeom( "POD" );
 
-    //==== Test Comp Geom Mesh Results ====//
-    string mesh_geom_res_id = CreateGeomResults( mesh_id, "Comp_Mesh" );
+    SetParmVal( pid, "X_Rel_Location", "XForm", 5.0 );
 
-    int_arr = GetIntResults( mesh_geom_res_id, "Num_Tris" );
+    Update();
 
-    if ( int_arr[0] < 4 )                                            { Print( "---> Error: API CreateGeomResults" ); }
+    SetHeadlessMode( false );
     \endcode
-    \param [in] geom_id Geom ID
-    \param [in] name Result name
-    \return Result ID
+    \sa GetHeadlessMode
+    \param [in] flag True to skip display work
 */)";
-    r = se->RegisterGlobalFunction( "string CreateGeomResults( const string & in geom_id, const string & in name )", asFUNCTION( vsp::CreateGeomResults ), asCALL_CDECL, doc_struct );
+    r = se->RegisterGlobalFunction( "void SetHeadlessMode( bool flag )", asFUNCTION( vsp::SetHeadlessMode ), asCALL_CDECL, doc_struct );
     assert( r >= 0 );
 
     doc_struct.comment = R"(
 /*!
-    Delete all results
-    \code{.cpp}
-    //==== Test Comp Geom ====//
-    gid1 = AddGeom( "POD", "" );
-
-    string mesh_id = ComputeCompGeom( 0, false, 0 );
+    Get whether headless mode is on
+    \sa SetHeadlessMode
+    \return True if display work is skipped
+*/)";
+    r = se->RegisterGlobalFunction( "bool GetHeadlessMode()", asFUNCTION( vsp::GetHeadlessMode ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
 
-    //==== Test Comp Geom Mesh Results ====//
-    string mesh_geom_res_id = CreateGeomResults( mesh_id, "Comp_Mesh" );
+    doc_struct.comment = R"(
+/*!
+    Turn deferred Geom loading on or off. When on, files read afterward fully decode every Geom, but Geoms that are hidden along with all of their children skip their surface builds. Each is built when it is shown or its surfaces are first needed by an export or analysis.
+    \code{.cpp}
+    SetDeferGeomLoad( true );
 
-    DeleteAllResults();
+    ReadVSPFile( "assembly.vsp3" );
 
-    if ( GetNumResults( "Comp_Mesh" ) != 0 )                { Print( "---> Error: API DeleteAllResults" ); }
+    Print( "Deferred Geoms: " + GetNumDeferredGeoms() );
     \endcode
+    \sa GetDeferGeomLoad, LoadDeferredGeoms, GetNumDeferredGeoms
+    \param [in] flag True to defer building hidden Geoms
 */)";
-    r = se->RegisterGlobalFunction( "void DeleteAllResults()", asFUNCTION( vsp::DeleteAllResults ), asCALL_CDECL, doc_struct );
+    r = se->RegisterGlobalFunction( "void SetDeferGeomLoad( bool flag )", asFUNCTION( vsp::SetDeferGeomLoad ), asCALL_CDECL, doc_struct );
     assert( r >= 0 );
 
     doc_struct.comment = R"(
 /*!
-    Delete a particular result
-    \code{.cpp}
-    //==== Test Comp Geom ====//
-    gid1 = AddGeom( "POD", "" );
-
-    string mesh_id = ComputeCompGeom( 0, false, 0 );
-
-    //==== Test Comp Geom Mesh Results ====//
-    string mesh_geom_res_id = CreateGeomResults( mesh_id, "Comp_Mesh" );
+    Get whether deferred Geom loading is on
+    \sa SetDeferGeomLoad
+    \return True if hidden Geoms are built on first use
+*/)";
+    r = se->RegisterGlobalFunction( "bool GetDeferGeomLoad()", asFUNCTION( vsp::GetDeferGeomLoad ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
 
-    DeleteResult( mesh_geom_res_id );
+    doc_struct.comment = R"(
+/*!
+    Build the surfaces of every Geom still deferred since the file was read
+    \sa SetDeferGeomLoad, GetNumDeferredGeoms
+*/)";
+    r = se->RegisterGlobalFunction( "void LoadDeferredGeoms()", asFUNCTION( vsp::LoadDeferredGeoms ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
 
-    if ( GetNumResults( "Comp_Mesh" ) != 0 )                { Print( "---> Error: API DeleteResult" ); }
-    \endcode
-    \param [in] id Result ID
+    doc_struct.comment = R"(
+/*!
+    Get the number of Geoms whose surfaces have not yet been built
+    \sa SetDeferGeomLoad, LoadDeferredGeoms
+    \return Number of deferred Geoms
 */)";
-    r = se->RegisterGlobalFunction( "void DeleteResult( const string & in id )", asFUNCTION( vsp::DeleteResult ), asCALL_CDECL, doc_struct );
+    r = se->RegisterGlobalFunction( "int GetNumDeferredGeoms()", asFUNCTION( vsp::GetNumDeferredGeoms ), asCALL_CDECL, doc_struct );
     assert( r >= 0 );
 
     doc_struct.comment = R"(
 /*!
-    Export a result to CSV
+    Set how often the GUI saves changed models in the background to a recovery file (name.autosave.vsp3) beside the current file. The save never blocks the GUI.
     \code{.cpp}
-    // Add Pod Geom
-    string pid = AddGeom( "POD" );
-
-    string analysis_name = "VSPAEROComputeGeometry";
-
-    string rid = ExecAnalysis( analysis_name );
+    SetAutoSaveInterval( 300.0 ); // Every five minutes
 
-    WriteResultsCSVFile( rid, "CompGeomRes.csv" );
+    SetAutoSaveInterval( 0.0 ); // Off
     \endcode
-    \param [in] id Rsult ID
-    \param [in] file_name CSV output file name
+    \sa GetAutoSaveInterval
+    \param [in] interval_sec Seconds between autosaves, zero or less turns autosave off
 */)";
-    r = se->RegisterGlobalFunction( "void WriteResultsCSVFile( const string & in id, const string & in file_name )", asFUNCTION( vsp::WriteResultsCSVFile ), asCALL_CDECL, doc_struct );
+    r = se->RegisterGlobalFunction( "void SetAutoSaveInterval( double interval_sec )", asFUNCTION( vsp::SetAutoSaveInterval ), asCALL_CDECL, doc_struct );
     assert( r >= 0 );
 
     doc_struct.comment = R"(
 /*!
-    Print a result's name value pairs to stdout
+    Get the autosave interval
+    \sa SetAutoSaveInterval
+    \return Seconds between autosaves, zero or less if off
+*/)";
+    r = se->RegisterGlobalFunction( "double GetAutoSaveInterval()", asFUNCTION( vsp::GetAutoSaveInterval ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Create a "Memory_Usage" result of the approximate bytes held. Each Geom is listed by Geom_ID and Geom_Name with Surf_Bytes, Tess_Bytes, DrawObj_Bytes, SubSurf_Bytes, Mesh_Bytes and Geom_Total_Bytes. Geoms_Bytes, Results_Bytes, SurfIntersect_Bytes, CfdMesh_Bytes, FeaMesh_Bytes, Undo_Bytes and Total_Bytes hold the totals, and Peak_Mem_MB the peak resident memory of the process.
     \code{.cpp}
-    // Add Pod Geom
     string pid = AddGeom( "POD" );
 
-    string analysis_name = "VSPAEROComputeGeometry";
+    Update();
 
-    string rid = ExecAnalysis( analysis_name );
+    string rid = CreateMemoryUsageResults();
 
-    // Get & Display Results
     PrintResults( rid );
     \endcode
-    \param [in] id Result ID
+    \sa PurgeDrawObjs, PurgeTessCache
+    \return Result ID
 */)";
-    r = se->RegisterGlobalFunction( "void PrintResults( const string & in id )", asFUNCTION( vsp::PrintResults ), asCALL_CDECL, doc_struct );
+    r = se->RegisterGlobalFunction( "string CreateMemoryUsageResults()", asFUNCTION( vsp::CreateMemoryUsageResults ), asCALL_CDECL, doc_struct );
     assert( r >= 0 );
 
     doc_struct.comment = R"(
 /*!
-    Create two sets of test results, each conatining int, string, vec3d, double, and vector< double > data types. 
-    \code{.cpp}
-    //==== Write Some Fake Test Results =====//
-    WriteTestResults();
+    Release the display buffers of every Geom. They are rebuilt when each Geom next updates, so this is meant for batch runs without a GUI.
+    \sa CreateMemoryUsageResults, PurgeTessCache
+*/)";
+    r = se->RegisterGlobalFunction( "void PurgeDrawObjs()", asFUNCTION( vsp::PurgeDrawObjs ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
 
-    if ( GetNumResults( "Test_Results" ) != 2 )                { Print( "---> Error: API GetNumResults" ); }
-    \endcode
+    doc_struct.comment = R"(
+/*!
+    Release the cached surface tessellations of every Geom. They are rebuilt as they are next needed.
+    \sa CreateMemoryUsageResults, PurgeDrawObjs
 */)";
-    r = se->RegisterGlobalFunction( "void WriteTestResults()", asMETHOD( ResultsMgrSingleton, WriteTestResults ), asCALL_THISCALL_ASGLOBAL, &ResultsMgr, doc_struct );
+    r = se->RegisterGlobalFunction( "void PurgeTessCache()", asFUNCTION( vsp::PurgeTessCache ), asCALL_CDECL, doc_struct );
     assert( r >= 0 );
 
 
@@ -8342,6 +9244,69 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
                                     asFUNCTIONPR( vsp::SetParmValUpdate, ( const string &, const string &, const string &, double val ), double ), asCALL_CDECL, doc_struct );
     assert( r >= 0 );
 
+    doc_struct.comment = R"(
+/*!
+    Set the values of a list of Parms, then update each changed Geom once. Parms that can not be found are skipped and reported as errors.
+    \code{.cpp}
+    //==== Add Pod Geometry ====//
+    string pod_id = AddGeom( "POD" );
+
+    array< string > parm_ids;
+    array< double > vals;
+
+    parm_ids.push_back( GetParm( pod_id, "X_Rel_Location", "XForm" ) );
+    vals.push_back( 5.0 );
+
+    parm_ids.push_back( GetParm( pod_id, "Length", "Design" ) );
+    vals.push_back( 12.0 );
+
+    SetParmValBatch( parm_ids, vals );
+    \endcode
+    \sa SetParmValUpdate, BeginParmBatch, EndParmBatch
+    \param [in] parm_ids Array of Parm IDs
+    \param [in] vals Array of Parm values, one per Parm ID
+*/)";
+    r = se->RegisterGlobalFunction( "void SetParmValBatch( array<string>@ parm_ids, array<double>@ vals )", asMETHOD( ScriptMgrSingleton, SetParmValBatch ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Start a batch of Parm changes. Geom updates triggered by Parm changes are deferred until the matching EndParmBatch. Batches may be nested.
+    \code{.cpp}
+    //==== Add Pod Geometry ====//
+    string pod_id = AddGeom( "POD" );
+
+    BeginParmBatch();
+
+    SetParmValUpdate( pod_id, "X_Rel_Location", "XForm", 5.0 );
+    SetParmValUpdate( pod_id, "Length", "Design", 12.0 );
+
+    EndParmBatch();                 // Pod is updated once
+    \endcode
+    \sa EndParmBatch, SetParmValBatch
+*/)";
+    r = se->RegisterGlobalFunction( "void BeginParmBatch()", asFUNCTION( vsp::BeginParmBatch ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    End a batch of Parm changes started by BeginParmBatch. The outermost EndParmBatch updates each Geom changed during the batch once, parents before children.
+    \code{.cpp}
+    //==== Add Pod Geometry ====//
+    string pod_id = AddGeom( "POD" );
+
+    BeginParmBatch();
+
+    SetParmValUpdate( pod_id, "X_Rel_Location", "XForm", 5.0 );
+    SetParmValUpdate( pod_id, "Length", "Design", 12.0 );
+
+    EndParmBatch();                 // Pod is updated once
+    \endcode
+    \sa BeginParmBatch, SetParmValBatch
+*/)";
+    r = se->RegisterGlobalFunction( "void EndParmBatch()", asFUNCTION( vsp::EndParmBatch ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
     doc_struct.comment = R"(
 /*!
     Get the value of the specified Parm. The data type of the Parm value will be cast to a double
@@ -10512,6 +11477,95 @@ void ScriptMgrSingleton::RegisterAPI( asIScriptEngine* se )
     r = se->RegisterGlobalFunction( "void ComputeFeaMesh( const string & in struct_id, int file_type )", asFUNCTIONPR( vsp::ComputeFeaMesh, ( const string & in, int ), void ), asCALL_CDECL, doc_struct );
     assert( r >= 0 );
 
+    doc_struct.comment = R"(
+/*!
+    Compute FEA Meshes for several Structures at once. Each Structure is meshed and exported on its own thread,
+    so the export file names of the Structures must differ. Only a single output file type can be generated with this function.
+    \code{.cpp}
+    //==== Add Pod Geometry ====//
+    string pod_id = AddGeom( "POD" );
+
+    //==== Add Two FeaStructures to Pod ====//
+    int struct_ind_0 = AddFeaStruct( pod_id );
+    int struct_ind_1 = AddFeaStruct( pod_id );
+
+    array< string > struct_ids = { GetFeaStructID( pod_id, struct_ind_0 ), GetFeaStructID( pod_id, struct_ind_1 ) };
+
+    SetFeaMeshFileName( pod_id, struct_ind_0, FEA_NASTRAN_FILE_NAME, "pod_struct_0.dat" );
+    SetFeaMeshFileName( pod_id, struct_ind_1, FEA_NASTRAN_FILE_NAME, "pod_struct_1.dat" );
+
+    //==== Generate FEA Meshes and Export ====//
+    Print( string( "--> Generating FeaMeshes " ) );
+
+    ComputeFeaMeshes( struct_ids, FEA_NASTRAN_FILE_NAME );
+    \endcode
+    \sa ComputeFeaMesh, SetFeaMeshFileName, FEA_EXPORT_TYPE
+    \param [in] struct_ids Array of FEA Structure IDs
+    \param [in] file_type FEA output file type enum (i.e. FEA_EXPORT_TYPE)
+*/)";
+    r = se->RegisterGlobalFunction( "void ComputeFeaMeshes( array<string>@ struct_ids, int file_type )", asMETHOD( ScriptMgrSingleton, ComputeFeaMeshes ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Get the number of elements in the last FEA Mesh built by ComputeFeaMesh. The elements stay available until the next FEA Mesh is started.
+    \code{.cpp}
+    //==== Add Pod Geometry ====//
+    string pod_id = AddGeom( "POD" );
+
+    int struct_ind = AddFeaStruct( pod_id );
+
+    ComputeFeaMesh( pod_id, struct_ind, FEA_NASTRAN_FILE_NAME );
+
+    int num_elem = GetFeaMeshNumElements();
+
+    for ( int start = 0; start < num_elem; start += 10000 )
+    {
+        array<int> @num_node_arr = GetFeaMeshElementNumNodes( start, 10000 );
+        array<int> @node_arr = GetFeaMeshElementNodeChunk( start, 10000 );
+        array<vec3d> @pnt_arr = GetFeaMeshElementPntChunk( start, 10000 );
+    }
+    \endcode
+    \sa ComputeFeaMesh, GetFeaMeshElementNumNodes, GetFeaMeshElementNodeChunk, GetFeaMeshElementPntChunk
+    \return Number of FEA elements
+*/)";
+    r = se->RegisterGlobalFunction( "int GetFeaMeshNumElements()", asFUNCTION( vsp::GetFeaMeshNumElements ), asCALL_CDECL, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Get the number of nodes (corners then midside nodes) of each FEA element in [start, start + num)
+    \sa GetFeaMeshNumElements
+    \param [in] start Index of the first element
+    \param [in] num Maximum number of elements
+    \return Array of node counts, one per element
+*/)";
+    r = se->RegisterGlobalFunction( "array<int>@ GetFeaMeshElementNumNodes( int start, int num )", asMETHOD( ScriptMgrSingleton, GetFeaMeshElementNumNodes ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Get the node numbers, as written to the exported FEA files, of the FEA elements in [start, start + num).
+    The nodes of each element are packed back to back, with the count per element given by GetFeaMeshElementNumNodes.
+    \sa GetFeaMeshNumElements, GetFeaMeshElementNumNodes
+    \param [in] start Index of the first element
+    \param [in] num Maximum number of elements
+    \return Array of node numbers
+*/)";
+    r = se->RegisterGlobalFunction( "array<int>@ GetFeaMeshElementNodeChunk( int start, int num )", asMETHOD( ScriptMgrSingleton, GetFeaMeshElementNodeChunk ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr, doc_struct );
+    assert( r >= 0 );
+
+    doc_struct.comment = R"(
+/*!
+    Get the node coordinates of the FEA elements in [start, start + num), in the same order as GetFeaMeshElementNodeChunk
+    \sa GetFeaMeshNumElements, GetFeaMeshElementNodeChunk
+    \param [in] start Index of the first element
+    \param [in] num Maximum number of elements
+    \return Array of node coordinates
+*/)";
+    r = se->RegisterGlobalFunction( "array<vec3d>@ GetFeaMeshElementPntChunk( int start, int num )", asMETHOD( ScriptMgrSingleton, GetFeaMeshElementPntChunk ), asCALL_THISCALL_ASGLOBAL, &ScriptMgr, doc_struct );
+    assert( r >= 0 );
+
     doc_struct.comment = R"(
 /*!
     Add an FEA Part to a Structure
@@ -11224,6 +12278,48 @@ CScriptArray* ScriptMgrSingleton::GetVec3dResults( const string & id, const stri
     return GetProxyVec3dArray();
 }
 
+CScriptArray* ScriptMgrSingleton::GetIntResultsChunk( const string & id, const string & name, int start, int num, int index )
+{
+    m_ProxyIntArray = vsp::GetIntResultsChunk( id, name, start, num, index );
+    return GetProxyIntArray();
+}
+
+CScriptArray* ScriptMgrSingleton::GetDoubleResultsChunk( const string & id, const string & name, int start, int num, int index )
+{
+    m_ProxyDoubleArray = vsp::GetDoubleResultsChunk( id, name, start, num, index );
+    return GetProxyDoubleArray();
+}
+
+CScriptArray* ScriptMgrSingleton::GetStringResultsChunk( const string & id, const string & name, int start, int num, int index )
+{
+    m_ProxyStringArray = vsp::GetStringResultsChunk( id, name, start, num, index );
+    return GetProxyStringArray();
+}
+
+CScriptArray* ScriptMgrSingleton::GetVec3dResultsChunk( const string & id, const string & name, int start, int num, int index )
+{
+    m_ProxyVec3dArray = vsp::GetVec3dResultsChunk( id, name, start, num, index );
+    return GetProxyVec3dArray();
+}
+
+CScriptArray* ScriptMgrSingleton::GetFeaMeshElementNumNodes( int start, int num )
+{
+    m_ProxyIntArray = vsp::GetFeaMeshElementNumNodes( start, num );
+    return GetProxyIntArray();
+}
+
+CScriptArray* ScriptMgrSingleton::GetFeaMeshElementNodeChunk( int start, int num )
+{
+    m_ProxyIntArray = vsp::GetFeaMeshElementNodeChunk( start, num );
+    return GetProxyIntArray();
+}
+
+CScriptArray* ScriptMgrSingleton::GetFeaMeshElementPntChunk( int start, int num )
+{
+    m_ProxyVec3dArray = vsp::GetFeaMeshElementPntChunk( start, num );
+    return GetProxyVec3dArray();
+}
+
 CScriptArray* ScriptMgrSingleton::FindContainers()
 {
     m_ProxyStringArray = vsp::FindContainers();
@@ -11373,6 +12469,41 @@ CScriptArray* ScriptMgrSingleton::GetEllipsoidCpDist( CScriptArray* surf_pnt_arr
     return GetProxyDoubleArray();
 }
 
+CScriptArray* ScriptMgrSingleton::ComputePlaneSliceBatch( int set, CScriptArray* norm_arr, CScriptArray* num_arr, bool auto_bnd, CScriptArray* start_arr, CScriptArray* end_arr )
+{
+    vector< vec3d > norm_vec;
+    norm_vec.resize( norm_arr->GetSize() );
+    for ( int i = 0; i < (int)norm_arr->GetSize(); i++ )
+    {
+        norm_vec[i] = *(vec3d*)( norm_arr->At( i ) );
+    }
+
+    vector< int > num_vec;
+    num_vec.resize( num_arr->GetSize() );
+    for ( int i = 0; i < (int)num_arr->GetSize(); i++ )
+    {
+        num_vec[i] = *(int*)( num_arr->At( i ) );
+    }
+
+    vector< double > start_vec;
+    start_vec.resize( start_arr->GetSize() );
+    for ( int i = 0; i < (int)start_arr->GetSize(); i++ )
+    {
+        start_vec[i] = *(double*)( start_arr->At( i ) );
+    }
+
+    vector< double > end_vec;
+    end_vec.resize( end_arr->GetSize() );
+    for ( int i = 0; i < (int)end_arr->GetSize(); i++ )
+    {
+        end_vec[i] = *(double*)( end_arr->At( i ) );
+    }
+
+    m_ProxyStringArray = vsp::ComputePlaneSliceBatch( set, norm_vec, num_vec, auto_bnd, start_vec, end_vec );
+
+    return GetProxyStringArray();
+}
+
 void ScriptMgrSingleton::SetUpperCST( const string& xsec_id, int deg, CScriptArray* coefs_arr )
 {
     vector < double > coefs_vec;
@@ -11623,6 +12754,37 @@ void ScriptMgrSingleton::SetVec3dAnalysisInput( const string& analysis, const st
     vsp::SetVec3dAnalysisInput( analysis, name, indata_vec, index );
 }
 
+void ScriptMgrSingleton::SetParmValBatch( CScriptArray* parm_ids, CScriptArray* vals )
+{
+    vector < string > parm_id_vec;
+    parm_id_vec.resize( parm_ids->GetSize() );
+    for ( int i = 0 ; i < ( int )parm_ids->GetSize() ; i++ )
+    {
+        parm_id_vec[i] = * ( string* )( parm_ids->At( i ) );
+    }
+
+    vector < double > val_vec;
+    val_vec.resize( vals->GetSize() );
+    for ( int i = 0 ; i < ( int )vals->GetSize() ; i++ )
+    {
+        val_vec[i] = * ( double* )( vals->At( i ) );
+    }
+
+    vsp::SetParmValBatch( parm_id_vec, val_vec );
+}
+
+void ScriptMgrSingleton::ComputeFeaMeshes( CScriptArray* struct_ids, int file_type )
+{
+    vector < string > struct_id_vec;
+    struct_id_vec.resize( struct_ids->GetSize() );
+    for ( int i = 0 ; i < ( int )struct_ids->GetSize() ; i++ )
+    {
+        struct_id_vec[i] = * ( string* )( struct_ids->At( i ) );
+    }
+
+    vsp::ComputeFeaMeshes( struct_id_vec, file_type );
+}
+
 CScriptArray* ScriptMgrSingleton::CompVecPnt01(const string &geom_id, const int &surf_indx, CScriptArray* us, CScriptArray* ws)
 {
     vector < double > in_us;
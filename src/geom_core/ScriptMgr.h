@@ -29,10 +29,41 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <set>
+#include <mutex>
 using std::string;
 using std::map;
+using std::set;
 using std::vector;
 
+//==== JIT Compiler Gate ====//
+// Forwards functions of JIT enabled modules to the JIT backend.  Anything else, and any
+// function the backend declines, returns an error so AngelScript runs it in the interpreter.
+class ScriptJITFilter : public asIJITCompiler
+{
+public:
+    ScriptJITFilter();
+
+    void SetBackend( asIJITCompiler* backend )              { m_Backend = backend; }
+    asIJITCompiler* GetBackend()                            { return m_Backend; }
+
+    void SetModuleFlag( const string & module_name, bool flag );
+    bool GetModuleFlag( const string & module_name ) const;
+
+    int GetNumCompiled() const                              { return m_NumCompiled; }
+    int GetNumFallback() const                              { return m_NumFallback; }
+
+    virtual int CompileFunction( asIScriptFunction* function, asJITFunction* output );
+    virtual void ReleaseJITFunction( asJITFunction func );
+
+private:
+    asIJITCompiler* m_Backend;
+    set< string > m_ModuleSet;
+
+    int m_NumCompiled;
+    int m_NumFallback;
+};
+
 class ScriptMgrSingleton
 {
 public:
@@ -48,22 +79,57 @@ public:
     void ReadExecuteScriptFile( const string &  file_name, const string &  function_name = "void main()" );
 
     //==== Read Script From File - Return Module Name ====//
-    string ReadScriptFromFile( const string & module_name, const string &  file_name );
+    string ReadScriptFromFile( const string & module_name, const string &  file_name, bool jit_flag = false );
 
     //==== Read All Scripts In Dir and Return Module Names ====//
-    static vector< string > ReadScriptsFromDir( const string & dir_name, const string & suffix );
+    static vector< string > ReadScriptsFromDir( const string & dir_name, const string & suffix, bool jit_flag = false );
 
     //==== Read Script From Memory - Return Module Name ====//
-    string ReadScriptFromMemory( const string &  module_name, const string & script_content );
+    // jit_flag marks the module for the JIT compiler, when one is installed.
+    string ReadScriptFromMemory( const string &  module_name, const string & script_content, bool jit_flag = false );
 
     //==== Find Script And Remove ====//
     bool RemoveScript( const string &  module_name );
 
+    //==== Compiled Bytecode Cache ====//
+    // When a cache directory is set, compiled modules are saved there keyed by a hash of the
+    // script and of the registered API, and later reads of the same script load the bytecode
+    // instead of compiling.  Defaults to the VSP_SCRIPT_CACHE_DIR environment variable.
+    void SetByteCodeCacheDir( const string & dir )          { m_ByteCodeCacheDir = dir; }
+    string GetByteCodeCacheDir()                            { return m_ByteCodeCacheDir; }
+
+    //==== JIT Compiler ====//
+    // The backend (e.g. a native JIT for the platform) must be installed before scripts are
+    // compiled.  Only modules read with jit_flag set are handed to it, everything else and
+    // any function it fails to compile keeps running in the interpreter.
+    void SetJITCompiler( asIJITCompiler* backend );
+    bool GetJITEnabled()                                    { return m_JITFilter.GetBackend() != NULL; }
+    ScriptJITFilter* GetJITFilter()                         { return &m_JITFilter; }
+
+    //==== Execute Function In Module ====//
+    // Safe to call from several threads at once, each run takes its own context from a
+    // shared pool.  Script globals are shared by every run of a module though, see
+    // IsModuleStateless.
     bool ExecuteScript(  const char* module_name,  const char* function_name, bool arg_flag = false, double arg = 0.0 );
 
-    void AddToMessages( const string & msg )                { m_ScriptMessages += msg; }
-    void ClearMessages()                                    { m_ScriptMessages.clear(); }
-    string GetMessages()                                    { return m_ScriptMessages; }   
+    //==== Module Has No Mutable Globals, So Concurrent Runs Cannot Interfere ====//
+    bool IsModuleStateless( const string & module_name );
+
+    void AddToMessages( const string & msg )
+    {
+        std::lock_guard< std::mutex > lock( m_MessageMutex );
+        m_ScriptMessages += msg;
+    }
+    void ClearMessages()
+    {
+        std::lock_guard< std::mutex > lock( m_MessageMutex );
+        m_ScriptMessages.clear();
+    }
+    string GetMessages()
+    {
+        std::lock_guard< std::mutex > lock( m_MessageMutex );
+        return m_ScriptMessages;
+    }
 
     string FindModuleContent( const string & module_name );
     static string ExtractContent( const string & file_name );
@@ -111,6 +177,7 @@ public:
 private:
 
     ScriptMgrSingleton();
+    ~ScriptMgrSingleton();
     ScriptMgrSingleton( ScriptMgrSingleton const& copy );          // Not Implemented
     ScriptMgrSingleton& operator=( ScriptMgrSingleton const& copy ); // Not Implemented
 
@@ -123,6 +190,16 @@ private:
     static void RegisterAPI( asIScriptEngine* se );
     static void RegisterUtility( asIScriptEngine* se );
 
+    //==== Context Pool, Handed To The Engine For RequestContext And ReturnContext ====//
+    static asIScriptContext* RequestPooledContext( asIScriptEngine* engine, void* param );
+    static void ReturnPooledContext( asIScriptEngine* engine, asIScriptContext* ctx, void* param );
+    void ReleasePooledContexts();
+
+    unsigned long long ComputeAPIKey();
+    string ByteCodeCacheFileName( unsigned long long content_hash );
+    bool LoadCachedByteCode( const string & module_name, const string & script_content );
+    void SaveCachedByteCode( const string & module_name, const string & script_content );
+
     //==== Member Variables ====//
     asIScriptEngine* m_ScriptEngine;
 //    map< string, CScriptBuilder > m_BuilderMap;
@@ -130,6 +207,20 @@ private:
     map< string, string > m_ModuleContentMap;
     string m_ScriptMessages;
 
+    string m_ByteCodeCacheDir;
+    unsigned long long m_APIKey;        // Hash of everything registered with the engine
+
+    ScriptJITFilter m_JITFilter;
+
+    // Module + "|" + declaration, cleared whenever a module is built or discarded.
+    map< string, asIScriptFunction* > m_FunctionCache;
+    std::mutex m_FunctionCacheMutex;
+
+    vector< asIScriptContext* > m_ContextPool;      // Idle contexts, each used by one thread at a time
+    std::mutex m_ContextPoolMutex;
+
+    std::mutex m_MessageMutex;
+
     //==== Test Proxy Stuff ====//
     int m_SaveInt;
     vector< vec3d > m_ProxyVec3dArray;
@@ -175,6 +266,13 @@ private:
     CScriptArray* GetDoubleMatResults( const string & id, const string & name, int index );
     CScriptArray* GetStringResults( const string & id, const string & name, int index );
     CScriptArray* GetVec3dResults( const string & id, const string & name, int index );
+    CScriptArray* GetIntResultsChunk( const string & id, const string & name, int start, int num, int index );
+    CScriptArray* GetDoubleResultsChunk( const string & id, const string & name, int start, int num, int index );
+    CScriptArray* GetStringResultsChunk( const string & id, const string & name, int start, int num, int index );
+    CScriptArray* GetVec3dResultsChunk( const string & id, const string & name, int start, int num, int index );
+    CScriptArray* GetFeaMeshElementNumNodes( int start, int num );
+    CScriptArray* GetFeaMeshElementNodeChunk( int start, int num );
+    CScriptArray* GetFeaMeshElementPntChunk( int start, int num );
     CScriptArray* FindContainers();
     CScriptArray* FindContainersWithName( const string & name );
     CScriptArray* FindContainerGroupNames( const string & parm_container_id );
@@ -200,6 +298,8 @@ private:
     CScriptArray* GetFeatureLinePnts( const string & geom_id );
     CScriptArray* GetEllipsoidCpDist( CScriptArray* surf_pnt_vec, const vec3d& abc_rad, const vec3d& V_inf );
 
+    CScriptArray* ComputePlaneSliceBatch( int set, CScriptArray* norm_arr, CScriptArray* num_arr, bool auto_bnd, CScriptArray* start_arr, CScriptArray* end_arr );
+
     CScriptArray* GetAirfoilCoordinates( const string & geom_id, const double &foilsurf_u );
 
     void SetUpperCST( const string& xsec_id, int deg, CScriptArray* coefs );
@@ -209,6 +309,8 @@ private:
     void SetDoubleAnalysisInput( const string& analysis, const string & name, CScriptArray* indata, int index );
     void SetStringAnalysisInput( const string& analysis, const string & name, CScriptArray* indata, int index );
     void SetVec3dAnalysisInput( const string& analysis, const string & name, CScriptArray* indata, int index );
+    void SetParmValBatch( CScriptArray* parm_ids, CScriptArray* vals );
+    void ComputeFeaMeshes( CScriptArray* struct_ids, int file_type );
 
     // ==== Variable Preset Functions ====//
     CScriptArray* GetVarPresetGroupNames();
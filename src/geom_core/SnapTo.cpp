@@ -23,10 +23,179 @@ SnapTo::SnapTo() : ParmContainer()
     m_LastMinDist = 0;
     m_LastTargetDist = 0;
     m_LastIncFlag = 0;
+
+    m_MoveRigidFlag = false;
 }
 
 SnapTo::~SnapTo()
 {
+    ClearMeshCache();
+}
+
+void SnapTo::ClearMeshCache()
+{
+    ClearOtherTMeshVec();
+    ClearMoveTMeshVec();
+}
+
+void SnapTo::ClearOtherTMeshVec()
+{
+    for ( int i = 0 ; i < (int)m_OtherGeomTMeshVec.size() ; i++ )
+    {
+        for ( int j = 0 ; j < (int)m_OtherGeomTMeshVec[i].size() ; j++ )
+        {
+            delete m_OtherGeomTMeshVec[i][j];
+        }
+    }
+    m_OtherGeomIDVec.clear();
+    m_OtherRevisionVec.clear();
+    m_OtherGeomTMeshVec.clear();
+    m_OtherTMeshVec.clear();
+}
+
+void SnapTo::ClearMoveTMeshVec()
+{
+    for ( int i = 0 ; i < (int)m_MoveTMeshVec.size() ; i++ )
+    {
+        delete m_MoveTMeshVec[i];
+    }
+    m_MoveTMeshVec.clear();
+    m_MoveLocalPntVec.clear();
+    m_MoveGeomID.clear();
+}
+
+//==== Rebuild Meshes Only For Other Geoms Whose Surfaces Changed ====//
+const vector< TMesh* > & SnapTo::UpdateOtherTMeshVec( const string & geom_id )
+{
+    Vehicle* veh = VehicleMgr.GetVehicle();
+
+    //==== Find Other Geoms ====//
+    vector< string > geom_id_vec = veh->GetGeomSet( m_CollisionSet );
+    vector< string > other_geom_vec;
+    for ( int i = 0 ; i < (int)geom_id_vec.size() ; i++ )
+    {
+        if ( geom_id != geom_id_vec[i] )
+            other_geom_vec.push_back( geom_id_vec[i] );
+    }
+
+    if ( other_geom_vec != m_OtherGeomIDVec )
+    {
+        ClearOtherTMeshVec();
+        m_OtherGeomIDVec = other_geom_vec;
+        m_OtherRevisionVec.resize( other_geom_vec.size(), -1 );
+        m_OtherGeomTMeshVec.resize( other_geom_vec.size() );
+    }
+
+    bool changed_flag = false;
+    for ( int i = 0 ; i < (int)m_OtherGeomIDVec.size() ; i++ )
+    {
+        Geom* g_ptr = veh->FindGeom( m_OtherGeomIDVec[i] );
+        int revision = g_ptr ? g_ptr->GetSurfRevision() : -1;
+
+        if ( revision == m_OtherRevisionVec[i] && ( revision != -1 || m_OtherGeomTMeshVec[i].empty() ) )
+        {
+            continue;
+        }
+
+        for ( int j = 0 ; j < (int)m_OtherGeomTMeshVec[i].size() ; j++ )
+        {
+            delete m_OtherGeomTMeshVec[i][j];
+        }
+        m_OtherGeomTMeshVec[i].clear();
+
+        if ( g_ptr )
+        {
+            m_OtherGeomTMeshVec[i] = g_ptr->CreateTMeshVec();
+            for ( int j = 0 ; j < (int)m_OtherGeomTMeshVec[i].size() ; j++ )
+            {
+                m_OtherGeomTMeshVec[i][j]->LoadBndBox();
+            }
+        }
+        m_OtherRevisionVec[i] = revision;
+        changed_flag = true;
+    }
+
+    if ( changed_flag || m_OtherTMeshVec.empty() )
+    {
+        m_OtherTMeshVec.clear();
+        for ( int i = 0 ; i < (int)m_OtherGeomTMeshVec.size() ; i++ )
+        {
+            m_OtherTMeshVec.insert( m_OtherTMeshVec.end(), m_OtherGeomTMeshVec[i].begin(), m_OtherGeomTMeshVec[i].end() );
+        }
+    }
+
+    return m_OtherTMeshVec;
+}
+
+//==== Parms That Only Move The Geom's Model Matrix ====//
+bool SnapTo::IsXFormParm( Geom* geom_ptr, Parm* parm_ptr )
+{
+    return ( parm_ptr == &geom_ptr->m_XLoc || parm_ptr == &geom_ptr->m_YLoc || parm_ptr == &geom_ptr->m_ZLoc ||
+             parm_ptr == &geom_ptr->m_XRelLoc || parm_ptr == &geom_ptr->m_YRelLoc || parm_ptr == &geom_ptr->m_ZRelLoc ||
+             parm_ptr == &geom_ptr->m_XRot || parm_ptr == &geom_ptr->m_YRot || parm_ptr == &geom_ptr->m_ZRot ||
+             parm_ptr == &geom_ptr->m_XRelRot || parm_ptr == &geom_ptr->m_YRelRot || parm_ptr == &geom_ptr->m_ZRelRot ||
+             parm_ptr == &geom_ptr->m_Origin );
+}
+
+//==== Meshes Of The Moving Geom At Its Current State ====//
+const vector< TMesh* > & SnapTo::UpdateMoveTMeshVec( Geom* geom_ptr )
+{
+    vector< Matrix4d > trans_vec = geom_ptr->GetTransMatVec();
+
+    //==== Rigid Move - Place Stored Local Points With The New Surface Transforms ====//
+    if ( m_MoveRigidFlag && m_MoveGeomID == geom_ptr->GetID() && !m_MoveTMeshVec.empty() )
+    {
+        bool valid_flag = true;
+        for ( int i = 0 ; i < (int)m_MoveTMeshVec.size() ; i++ )
+        {
+            if ( m_MoveTMeshVec[i]->m_SurfNum >= (int)trans_vec.size() ||
+                 m_MoveLocalPntVec[i].size() != m_MoveTMeshVec[i]->m_NVec.size() )
+            {
+                valid_flag = false;
+            }
+        }
+
+        if ( valid_flag )
+        {
+            for ( int i = 0 ; i < (int)m_MoveTMeshVec.size() ; i++ )
+            {
+                TMesh* tmesh = m_MoveTMeshVec[i];
+                const Matrix4d & mat = trans_vec[ tmesh->m_SurfNum ];
+                for ( int n = 0 ; n < (int)tmesh->m_NVec.size() ; n++ )
+                {
+                    tmesh->m_NVec[n]->m_Pnt = mat.xform( m_MoveLocalPntVec[i][n] );
+                }
+                tmesh->LoadBndBox();
+            }
+            return m_MoveTMeshVec;
+        }
+    }
+
+    //==== Tessellate ====//
+    ClearMoveTMeshVec();
+    m_MoveGeomID = geom_ptr->GetID();
+    m_MoveTMeshVec = geom_ptr->CreateTMeshVec();
+    m_MoveLocalPntVec.resize( m_MoveTMeshVec.size() );
+
+    for ( int i = 0 ; i < (int)m_MoveTMeshVec.size() ; i++ )
+    {
+        TMesh* tmesh = m_MoveTMeshVec[i];
+        tmesh->LoadBndBox();
+
+        if ( m_MoveRigidFlag && tmesh->m_SurfNum < (int)trans_vec.size() )
+        {
+            Matrix4d inv = trans_vec[ tmesh->m_SurfNum ];
+            inv.affineInverse();
+
+            m_MoveLocalPntVec[i].resize( tmesh->m_NVec.size() );
+            for ( int n = 0 ; n < (int)tmesh->m_NVec.size() ; n++ )
+            {
+                m_MoveLocalPntVec[i][n] = inv.xform( tmesh->m_NVec[n]->m_Pnt );
+            }
+        }
+    }
+
+    return m_MoveTMeshVec;
 }
 
 //==== Parm Changed ====//
@@ -63,30 +232,19 @@ void SnapTo::PreventCollision( const string & geom_id, const string & parm_id )
 //===== Vectors of TMeshs with Bounding Boxes Already Set Up ====//
 bool SnapTo::CheckIntersect( Geom* geom_ptr, const vector<TMesh*> & other_tmesh_vec )
 {
-    bool intsect_flag = false;
-
-    vector< TMesh* > tmesh_vec = geom_ptr->CreateTMeshVec();
+    const vector< TMesh* > & tmesh_vec = UpdateMoveTMeshVec( geom_ptr );
     for ( int i = 0 ; i < (int)tmesh_vec.size() ; i++ )
     {
-        tmesh_vec[i]->LoadBndBox();
         for ( int j = 0 ; j < (int)other_tmesh_vec.size() ; j++ )
         {
             if ( tmesh_vec[i]->CheckIntersect( other_tmesh_vec[j] ) )
             {
-                    intsect_flag = true;
-                    break;
+                return true;
             }
         }
-        if ( intsect_flag )
-            break;
     }
 
-    for ( int i = 0 ; i < (int)tmesh_vec.size() ; i++ )
-    {
-        delete tmesh_vec[i];
-    }
-
-    return intsect_flag;
+    return false;
 }
 
 //==== Returns Large Neg Number If Error and 0.0 If Collision ====//
@@ -102,13 +260,13 @@ double SnapTo::FindMinDistance( const string & geom_id, const vector< TMesh* > &
         return 0.0;
     }
 
-    vector< TMesh* > tmesh_vec = geom_ptr->CreateTMeshVec();        // Must Delete!!!
+    //==== Meshes Are Current After CheckIntersect ====//
+    const vector< TMesh* > & tmesh_vec = m_MoveTMeshVec;
 
-    //==== Find Min Dist ====//
+    //==== Find Min Dist - BVH Pairs Farther Than The Current Min Are Skipped ====//
     double min_dist = 1.0e12;
     for ( int i = 0 ; i < (int)tmesh_vec.size() ; i++ )
     {
-        tmesh_vec[i]->LoadBndBox();
         for ( int j = 0 ; j < (int)other_tmesh_vec.size() ; j++ )
         {
             double d =  tmesh_vec[i]->MinDistance(  other_tmesh_vec[j], min_dist );
@@ -116,11 +274,6 @@ double SnapTo::FindMinDistance( const string & geom_id, const vector< TMesh* > &
         }
     }
 
-    for ( int i = 0 ; i < (int)tmesh_vec.size() ; i++ )
-    {
-        delete tmesh_vec[i];
-    }
-
     return min_dist;
 }
 
@@ -160,30 +313,11 @@ void SnapTo::AdjParmToMinDist( const string & parm_id, bool inc_flag )
 
     Vehicle* veh = VehicleMgr.GetVehicle();
 
-    //==== Find Other Geoms ====//
-    vector< string > geom_id_vec = veh->GetGeomSet( m_CollisionSet );
-    vector< string > other_geom_vec;
-    for ( int i = 0 ; i < (int)geom_id_vec.size() ; i++ )
-    {
-        if ( geom_id != geom_id_vec[i] )
-            other_geom_vec.push_back( geom_id_vec[i] );
-    }
+    //==== Other Geoms Stay Put While The Parm Is Adjusted ====//
+    const vector< TMesh* > & other_tmesh_vec = UpdateOtherTMeshVec( geom_id );
 
-    //==== Create TMeshes =====//
-    vector< TMesh* > other_tmesh_vec;
-    for ( int i = 0 ; i < (int)other_geom_vec.size() ; i++ )
-    {
-        Geom* g_ptr = veh->FindGeom( other_geom_vec[i] );
-        if ( g_ptr )
-        {
-             vector< TMesh* > tvec = g_ptr->CreateTMeshVec();       /////////// MUST DELETE!!!
-             for ( int j = 0 ; j < (int)tvec.size() ; j++ )
-             {
-                tvec[j]->LoadBndBox();
-                other_tmesh_vec.push_back( tvec[j] );
-             }
-        }
-    }
+    m_MoveRigidFlag = IsXFormParm( geom_ptr, parm_ptr );
+    ClearMoveTMeshVec();
 
     double direction = 1.0;
     if ( !inc_flag )
@@ -295,8 +429,7 @@ void SnapTo::AdjParmToMinDist( const string & parm_id, bool inc_flag )
             m_CollisionErrorFlag = vsp::COLLISION_CLEAR_NO_SOLUTION;
         parm_ptr->Set( revert_val );              // Restore Val
         veh->Update( false );
-        for ( int i = 0 ; i < (int)other_tmesh_vec.size() ; i++ )
-            delete other_tmesh_vec[i];
+        ClearMoveTMeshVec();
         return;
     }
 
@@ -376,9 +509,7 @@ void SnapTo::AdjParmToMinDist( const string & parm_id, bool inc_flag )
     m_CollisionMinDist = FindMinDistance( geom_id, other_tmesh_vec, iflag );
     m_CollisionErrorFlag = vsp::COLLISION_OK;
 
-    //==== Delete Created TMeshes ====//
-    for ( int i = 0 ; i < (int)other_tmesh_vec.size() ; i++ )
-        delete other_tmesh_vec[i];
+    ClearMoveTMeshVec();
 
     //==== Store Last Results ====//
     m_LastParmID = parm_id;
@@ -402,38 +533,14 @@ void SnapTo::CheckClearance( )
     Geom* geom_ptr = select_vec[0];
     if ( !geom_ptr )    return;
     string geom_id = geom_ptr->GetID();
- 
-    //==== Find Other Geoms ====//
-    vector< string > geom_id_vec = veh->GetGeomSet( m_CollisionSet );
-    vector< string > other_geom_vec;
-    for ( int i = 0 ; i < (int)geom_id_vec.size() ; i++ )
-    {
-        if ( geom_id != geom_id_vec[i] )
-            other_geom_vec.push_back( geom_id_vec[i] );
-    }
 
-    //==== Create TMeshes =====//
-    vector< TMesh* > other_tmesh_vec;
-    for ( int i = 0 ; i < (int)other_geom_vec.size() ; i++ )
-    {
-        Geom* g_ptr = veh->FindGeom( other_geom_vec[i] );
-        if ( g_ptr )
-        {
-             vector< TMesh* > tvec = g_ptr->CreateTMeshVec();       /////////// MUST DELETE!!!
-             for ( int j = 0 ; j < (int)tvec.size() ; j++ )
-             {
-                tvec[j]->LoadBndBox();
-                other_tmesh_vec.push_back( tvec[j] );
-             }
-        }
-    }
+    const vector< TMesh* > & other_tmesh_vec = UpdateOtherTMeshVec( geom_id );
+
+    m_MoveRigidFlag = false;
+    ClearMoveTMeshVec();
 
     bool iflag;
     m_CollisionMinDist = FindMinDistance( geom_id, other_tmesh_vec, iflag );
 
-    //==== Delete Created TMeshes ====//
-    for ( int i = 0 ; i < (int)other_tmesh_vec.size() ; i++ )
-        delete other_tmesh_vec[i];
-
-
-}
\ No newline at end of file
+    ClearMoveTMeshVec();
+}
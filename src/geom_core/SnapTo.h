@@ -24,12 +24,14 @@ public:
     virtual void ParmChanged( Parm* parm_ptr, int type );
 
     void PreventCollision( const string & geom_id, const string & parm_id );
-    static double FindMinDistance(const string & geom_id, const vector< TMesh* > & other_tmesh_vec, bool & intersect_flag );
+    double FindMinDistance( const string & geom_id, const vector< TMesh* > & other_tmesh_vec, bool & intersect_flag );
     static double FindMaxMinDistance( const vector< TMesh* > & mesh_1, const vector< TMesh* > & mesh_2 );
-    static bool CheckIntersect( Geom* geom_ptr, const vector<TMesh*> & other_tmesh_vec );
+    bool CheckIntersect( Geom* geom_ptr, const vector<TMesh*> & other_tmesh_vec );
     void AdjParmToMinDist( const string & parm_id, bool inc_flag );
     void CheckClearance(  );
 
+    void ClearMeshCache();
+
 
     //==== Collision Stuff ====//
     BoolParm m_CollisionDetection;
@@ -47,6 +49,27 @@ protected:
     double m_LastTargetDist;
     bool m_LastIncFlag;
 
+    //==== Meshes Of The Other Geoms In The Set, Kept Across Drag Events ====//
+    const vector< TMesh* > & UpdateOtherTMeshVec( const string & geom_id );
+    void ClearOtherTMeshVec();
+
+    vector< string > m_OtherGeomIDVec;
+    vector< int > m_OtherRevisionVec;
+    vector< vector< TMesh* > > m_OtherGeomTMeshVec;
+    vector< TMesh* > m_OtherTMeshVec;
+
+    //==== Meshes Of The Moving Geom ====//
+    // While only its XForm changes the geom's surfaces move rigidly, so the
+    // mesh is built once and its nodes are placed with each new surface transform.
+    const vector< TMesh* > & UpdateMoveTMeshVec( Geom* geom_ptr );
+    void ClearMoveTMeshVec();
+    static bool IsXFormParm( Geom* geom_ptr, Parm* parm_ptr );
+
+    bool m_MoveRigidFlag;
+    string m_MoveGeomID;
+    vector< TMesh* > m_MoveTMeshVec;
+    vector< vector< vec3d > > m_MoveLocalPntVec;       // Node points with their surface transform removed
+
 };
 
 
@@ -13,6 +13,7 @@
 #include "Vehicle.h"
 #include "ParmMgr.h"
 #include "StructureMgr.h"
+#include "StlHelper.h"
 
 #include "eli/geom/intersect/specified_distance_curve.hpp"
 
@@ -111,6 +112,18 @@ void SubSurface::LoadDrawObjs( std::vector< DrawObj* > & draw_obj_vec )
     draw_obj_vec.push_back( &m_SubSurfDO );
 }
 
+size_t SubSurface::MemoryUsage() const
+{
+    size_t bytes = vector_mem_bytes( m_LVec ) + vector_mem_bytes( m_SplitLVec ) + vector_mem_bytes( m_PolyPntsVec );
+
+    bytes += m_SubSurfDO.MemoryUsage();
+    for ( int i = 0 ; i < ( int )m_SubSurfHighlightDO.size() ; i++ )
+    {
+        bytes += m_SubSurfHighlightDO[i].MemoryUsage();
+    }
+    return bytes;
+}
+
 void SubSurface::LoadPartialColoredDrawObjs( const string & ss_id, int surf_num, std::vector < DrawObj* > & draw_obj_vec, vec3d color )
 {
     Vehicle* veh = VehicleMgr.GetVehicle();
@@ -261,6 +274,41 @@ bool SubSurface::Subtag( const vec3d & center )
     return false;
 }
 
+//==== Bounds Of The Polygons Tested By Subtag ====//
+// Points outside the box are in no polygon, so Subtag returns true exactly when m_TestType is OUTSIDE.
+bool SubSurface::GetSubtagBounds( vec2d & lo, vec2d & hi )
+{
+    UpdatePolygonPnts();
+
+    bool found = false;
+    for ( int p = 0; p < ( int )m_PolyPntsVec.size(); p++ )
+    {
+        for ( int i = 0; i < ( int )m_PolyPntsVec[p].size(); i++ )
+        {
+            const vec2d & pnt = m_PolyPntsVec[p][i];
+            if ( !found )
+            {
+                lo = pnt;
+                hi = pnt;
+                found = true;
+            }
+            else
+            {
+                lo.set_xy( min( lo.x(), pnt.x() ), min( lo.y(), pnt.y() ) );
+                hi.set_xy( max( hi.x(), pnt.x() ), max( hi.y(), pnt.y() ) );
+            }
+        }
+    }
+
+    if ( !found )
+    {
+        // No polygons, Subtag never finds a point inside.
+        lo.set_xy( 1.0, 1.0 );
+        hi.set_xy( -1.0, -1.0 );
+    }
+    return true;
+}
+
 int SubSurface::GetFeaMaterialIndex()
 {
     FeaProperty* fea_prop = StructureMgr.GetFeaProperty( m_FeaPropertyIndex() );
@@ -109,6 +109,7 @@ public:
     }
     virtual void LoadDrawObjs( std::vector< DrawObj* >& draw_obj_vec );
     virtual void LoadPartialColoredDrawObjs( const string & ss_id, int surf_num, std::vector < DrawObj * > & draw_obj_vec, vec3d color );
+    virtual size_t MemoryUsage() const;                     // Approximate bytes held
     virtual void SetUpdateDraw( bool flag )
     {
         m_UpdateDrawFlag = flag;
@@ -123,6 +124,7 @@ public:
 
     virtual bool Subtag( TTri* tri ); // Method to subtag triangles from TMesh.
     virtual bool Subtag( const vec3d & center );
+    virtual bool GetSubtagBounds( vec2d & lo, vec2d & hi ); // UW box outside which Subtag is decided by m_TestType alone
     virtual void Update();
     virtual void UpdatePolygonPnts();
     virtual std::vector< TMesh* > CreateTMeshVec(); // Method to create a TMeshVector
@@ -197,6 +199,10 @@ public:
 
     virtual bool Subtag( TTri* tri );
     virtual bool Subtag( const vec3d & center );
+    virtual bool GetSubtagBounds( vec2d & lo, vec2d & hi )
+    {
+        return false; // Half plane test, no bounds
+    }
 
     virtual void Update();
 
@@ -25,6 +25,24 @@
 #include "Geom.h"
 #include "SubSurfaceMgr.h"
 #include "PntNodeMerge.h"
+#include "UsingCpp11.h"
+#include "FileUtil.h"
+#include "Util.h"
+#include "StlHelper.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+//==== Thread Number In The Innermost Parallel Team (0 If Serial) ====//
+static int TMeshThreadNum()
+{
+#ifdef _OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
 
 
 //===============================================//
@@ -37,6 +55,7 @@ TNode::TNode()
     m_IsectFlag = 0;
     m_XYZFlag = true; // true if xyz
     m_CoordInfo = HAS_UNKNOWN;
+    m_ArenaFlag = false;
 }
 
 TNode::~TNode()
@@ -134,6 +153,7 @@ TEdge::TEdge()
     m_N0 = m_N1 = 0;
     m_ParTri = NULL;
     m_Tri0 = m_Tri1 = NULL;
+    m_ArenaFlag = false;
 }
 
 TEdge::TEdge( TNode* n0, TNode* n1, TTri* par_tri )
@@ -142,6 +162,7 @@ TEdge::TEdge( TNode* n0, TNode* n1, TTri* par_tri )
     m_N1 = n1;
     m_ParTri = par_tri;
     m_Tri0 = m_Tri1 = NULL;
+    m_ArenaFlag = false;
 }
 
 TMesh* TEdge::GetParTMesh()
@@ -352,6 +373,129 @@ DegenGeomTriShellMassProp::DegenGeomTriShellMassProp( const string& id, const ve
 //===========================================================================================================//
 
 
+//==== STL Facet Output ====//
+// Facets are passed as three consecutive vertices.  Normals are computed from the vertices.
+void AddSTLTri( vector< vec3d > & pnt_vec, const vec3d & v0, const vec3d & v1, const vec3d & v2 )
+{
+    if ( dist( v2, v1 ) > 0.000001 )
+    {
+        pnt_vec.push_back( v0 );
+        pnt_vec.push_back( v1 );
+        pnt_vec.push_back( v2 );
+    }
+}
+
+static vec3d STLNormal( const vec3d & v0, const vec3d & v1, const vec3d & v2 )
+{
+    vec3d norm = cross( v2 - v1, v0 - v1 );
+    norm.normalize();
+    return norm;
+}
+
+class STLFacetFormatter
+{
+public:
+    STLFacetFormatter( const vector< vec3d > & pnt_vec ) : m_PntVec( pnt_vec )      {}
+
+    void operator()( int i, string & buf ) const
+    {
+        const vec3d & v0 = m_PntVec[ 3 * i ];
+        const vec3d & v1 = m_PntVec[ 3 * i + 1 ];
+        const vec3d & v2 = m_PntVec[ 3 * i + 2 ];
+        vec3d norm = STLNormal( v0, v1, v2 );
+
+        AppendFormat( buf, " facet normal  %2.10le %2.10le %2.10le\n",  norm.x(), norm.y(), norm.z() );
+        buf.append( "   outer loop\n" );
+        AppendFormat( buf, "     vertex %2.10le %2.10le %2.10le\n", v0.x(), v0.y(), v0.z() );
+        AppendFormat( buf, "     vertex %2.10le %2.10le %2.10le\n", v1.x(), v1.y(), v1.z() );
+        AppendFormat( buf, "     vertex %2.10le %2.10le %2.10le\n", v2.x(), v2.y(), v2.z() );
+        buf.append( "   endloop\n" );
+        buf.append( " endfacet\n" );
+    }
+
+protected:
+    const vector< vec3d > & m_PntVec;
+};
+
+void WriteSTLFacets( FILE* file_id, const vector< vec3d > & pnt_vec )
+{
+    WriteChunked( file_id, ( int )pnt_vec.size() / 3, STLFacetFormatter( pnt_vec ) );
+}
+
+//==== Little Endian Binary STL - 80 Byte Header, Facet Count, 50 Bytes Per Facet ====//
+void WriteBinarySTL( FILE* file_id, const vector< vec3d > & pnt_vec )
+{
+    WriteBinarySTL( file_id, pnt_vec, vector< int >() );
+}
+
+// attr_vec holds the attribute word for each facet, or is empty to write zeros.
+void WriteBinarySTL( FILE* file_id, const vector< vec3d > & pnt_vec, const vector< int > & attr_vec )
+{
+    WriteBinarySTLHeader( file_id, ( unsigned int )( pnt_vec.size() / 3 ) );
+    WriteBinarySTLFacets( file_id, pnt_vec, attr_vec );
+}
+
+void WriteBinarySTLHeader( FILE* file_id, unsigned int num_facet )
+{
+    char header[80];
+    memset( header, 0, sizeof( header ) );
+    snprintf( header, sizeof( header ), "OpenVSP binary STL" );
+    fwrite( header, 1, sizeof( header ), file_id );
+
+    unsigned char cnt[4];
+    for ( int b = 0 ; b < 4 ; b++ )
+    {
+        cnt[b] = ( unsigned char )( ( num_facet >> ( 8 * b ) ) & 0xFF );
+    }
+    fwrite( cnt, 1, 4, file_id );
+}
+
+void WriteBinarySTLFacets( FILE* file_id, const vector< vec3d > & pnt_vec, const vector< int > & attr_vec )
+{
+    unsigned int num_facet = ( unsigned int )( pnt_vec.size() / 3 );
+
+    const int facet_size = 50;
+    const int chunk_size = 8192;
+    vector< unsigned char > buf( facet_size * chunk_size );
+
+    for ( int f0 = 0 ; f0 < ( int )num_facet ; f0 += chunk_size )
+    {
+        int num = min( chunk_size, ( int )num_facet - f0 );
+
+        #pragma omp parallel for
+        for ( int f = 0 ; f < num ; f++ )
+        {
+            const vec3d* v = &pnt_vec[ 3 * ( f0 + f ) ];
+            vec3d norm = STLNormal( v[0], v[1], v[2] );
+
+            float val[12];
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                val[k] = ( float )norm[k];
+                val[3 + k] = ( float )v[0][k];
+                val[6 + k] = ( float )v[1][k];
+                val[9 + k] = ( float )v[2][k];
+            }
+
+            unsigned char* rec = &buf[ facet_size * f ];
+            for ( int k = 0 ; k < 12 ; k++ )
+            {
+                unsigned int bits;
+                memcpy( &bits, &val[k], 4 );
+                for ( int b = 0 ; b < 4 ; b++ )
+                {
+                    rec[ 4 * k + b ] = ( unsigned char )( ( bits >> ( 8 * b ) ) & 0xFF );
+                }
+            }
+            unsigned int attr = attr_vec.empty() ? 0 : ( unsigned int )attr_vec[ f0 + f ];
+            rec[48] = ( unsigned char )( attr & 0xFF );      // Attribute byte count
+            rec[49] = ( unsigned char )( ( attr >> 8 ) & 0xFF );
+        }
+
+        fwrite( &buf[0], 1, facet_size * num, file_id );
+    }
+}
+
 //===============================================//
 //===============================================//
 //===============================================//
@@ -379,22 +523,156 @@ TMesh::TMesh()
 
 TMesh::~TMesh()
 {
+    FreeTopology();
+}
 
+void TMesh::FreeTopology()
+{
     int i;
 
+    //==== Heap Objects Added From Outside The Pools ====//
+    for ( i = 0 ; i < ( int )m_TVec.size() ; i++ )
+    {
+        FreeTObj( m_TVec[i] );
+    }
+    for ( i = 0 ; i < ( int )m_NVec.size() ; i++ )
+    {
+        FreeTObj( m_NVec[i] );
+    }
+    for ( i = 0 ; i < ( int )m_EVec.size() ; i++ )
+    {
+        FreeTObj( m_EVec[i] );
+    }
+
+    //==== Tris First - Their Destructors Look At Edges and Nodes ====//
+    m_TriPool.Clear();
+    for ( i = 0 ; i < ( int )m_WorkerTriPool.size() ; i++ )
+    {
+        delete m_WorkerTriPool[i];
+    }
+    m_EdgePool.Clear();
+    for ( i = 0 ; i < ( int )m_WorkerEdgePool.size() ; i++ )
+    {
+        delete m_WorkerEdgePool[i];
+    }
+    m_NodePool.Clear();
+    for ( i = 0 ; i < ( int )m_WorkerNodePool.size() ; i++ )
+    {
+        delete m_WorkerNodePool[i];
+    }
+    m_WorkerTriPool.clear();
+    m_WorkerEdgePool.clear();
+    m_WorkerNodePool.clear();
+
+    vector< TTri* >().swap( m_TVec );
+    vector< TNode* >().swap( m_NVec );
+    vector< TEdge* >().swap( m_EVec );
+}
+
+size_t TMesh::MemoryUsage() const
+{
+    int i, j;
+    size_t bytes = sizeof( TMesh ) + m_TBox.MemoryUsage();
+
+    bytes += m_NodePool.MemoryUsage() + m_EdgePool.MemoryUsage() + m_TriPool.MemoryUsage();
+    for ( i = 0 ; i < ( int )m_WorkerTriPool.size() ; i++ )
+    {
+        bytes += m_WorkerNodePool[i]->MemoryUsage() + m_WorkerEdgePool[i]->MemoryUsage() + m_WorkerTriPool[i]->MemoryUsage();
+    }
+
+    bytes += vector_mem_bytes( m_TVec ) + vector_mem_bytes( m_NVec ) + vector_mem_bytes( m_EVec );
+    bytes += vector_mem_bytes( m_NonClosedTriVec ) + vector_mem_bytes( m_VertVec );
+    bytes += vector_mem_bytes( m_UWPnts ) + vector_mem_bytes( m_XYZPnts );
+    bytes += vector_mem_bytes( m_CompAreaVec ) + vector_mem_bytes( m_TagTheoAreaVec ) + vector_mem_bytes( m_TagWetAreaVec );
+
+    //==== Topology Not From The Pools, And What Each Tri Holds ====//
     for ( i = 0 ; i < ( int )m_TVec.size() ; i++ )
     {
-        delete m_TVec[i];
+        const TTri* tri = m_TVec[i];
+        if ( !tri->m_ArenaFlag )
+        {
+            bytes += sizeof( TTri );
+        }
+        bytes += vector_mem_bytes( tri->m_ISectEdgeVec ) + vector_mem_bytes( tri->m_Tags );
+        bytes += vector_mem_bytes( tri->m_SplitVec ) + vector_mem_bytes( tri->m_NVec ) + vector_mem_bytes( tri->m_EVec );
+        for ( j = 0 ; j < ( int )tri->m_EVec.size() ; j++ )
+        {
+            bytes += tri->m_EVec[j]->m_ArenaFlag ? 0 : sizeof( TEdge );
+        }
+        for ( j = 3 ; j < ( int )tri->m_NVec.size() ; j++ )
+        {
+            bytes += tri->m_NVec[j]->m_ArenaFlag ? 0 : sizeof( TNode );
+        }
+        for ( j = 0 ; j < ( int )tri->m_SplitVec.size() ; j++ )
+        {
+            bytes += tri->m_SplitVec[j]->m_ArenaFlag ? 0 : sizeof( TTri );
+            bytes += vector_mem_bytes( tri->m_SplitVec[j]->m_Tags );
+        }
     }
     for ( i = 0 ; i < ( int )m_NVec.size() ; i++ )
     {
-        delete m_NVec[i];
+        if ( !m_NVec[i]->m_ArenaFlag )
+        {
+            bytes += sizeof( TNode );
+        }
     }
     for ( i = 0 ; i < ( int )m_EVec.size() ; i++ )
     {
-        delete m_EVec[i];
+        if ( !m_EVec[i]->m_ArenaFlag )
+        {
+            bytes += sizeof( TEdge );
+        }
+    }
+
+    return bytes;
+}
+
+//==== Extra Threads Working On This Mesh Allocate From Their Own Pool ====//
+TNode* TMesh::NewNode()
+{
+    int tid = TMeshThreadNum();
+    if ( tid > 0 && tid <= ( int )m_WorkerNodePool.size() )
+    {
+        return m_WorkerNodePool[tid - 1]->Alloc();
+    }
+    return m_NodePool.Alloc();
+}
+
+TEdge* TMesh::NewEdge()
+{
+    int tid = TMeshThreadNum();
+    if ( tid > 0 && tid <= ( int )m_WorkerEdgePool.size() )
+    {
+        return m_WorkerEdgePool[tid - 1]->Alloc();
+    }
+    return m_EdgePool.Alloc();
+}
+
+TTri* TMesh::NewTri()
+{
+    TTri* tri;
+    int tid = TMeshThreadNum();
+    if ( tid > 0 && tid <= ( int )m_WorkerTriPool.size() )
+    {
+        tri = m_WorkerTriPool[tid - 1]->Alloc();
+    }
+    else
+    {
+        tri = m_TriPool.Alloc();
     }
+    tri->SetTMeshPtr( this );
+    return tri;
+}
 
+//==== Make Sure Each Thread Past The First Has Its Own Pools ====//
+void TMesh::AllocWorkerPools( int num_threads )
+{
+    while ( ( int )m_WorkerNodePool.size() < num_threads - 1 )
+    {
+        m_WorkerNodePool.push_back( new TObjPool< TNode >() );
+        m_WorkerEdgePool.push_back( new TObjPool< TEdge >() );
+        m_WorkerTriPool.push_back( new TObjPool< TTri >() );
+    }
 }
 
 void TMesh::copy( TMesh* m )
@@ -405,10 +683,10 @@ void TMesh::copy( TMesh* m )
 
     for ( int i = 0 ; i < ( int )m->m_TVec.size() ; i++ )
     {
-        TTri* tri = new TTri();
-        tri->m_N0   = new TNode();
-        tri->m_N1   = new TNode();
-        tri->m_N2   = new TNode();
+        TTri* tri = NewTri();
+        tri->m_N0   = NewNode();
+        tri->m_N1   = NewNode();
+        tri->m_N2   = NewNode();
 
         tri->m_Norm    = m->m_TVec[i]->m_Norm;
         tri->m_N0->m_Pnt = m->m_TVec[i]->m_N0->m_Pnt;
@@ -542,11 +820,11 @@ void TMesh::DecodeTriList( xmlNodePtr & node, int num_tris )
         if ( !xmlStrcmp( iter_node->name, ( const xmlChar * )"Tri" ) )
         {
             tri = XmlUtil::GetVectorVec3dNode( iter_node );
-            m_TVec[i] = new TTri();
+            m_TVec[i] = NewTri();
             // Create Nodes
-            m_TVec[i]->m_N0 = new TNode();
-            m_TVec[i]->m_N1 = new TNode();
-            m_TVec[i]->m_N2 = new TNode();
+            m_TVec[i]->m_N0 = NewNode();
+            m_TVec[i]->m_N1 = NewNode();
+            m_TVec[i]->m_N2 = NewNode();
 
             m_NVec.push_back( m_TVec[i]->m_N0 );
             m_NVec.push_back( m_TVec[i]->m_N1 );
@@ -566,6 +844,33 @@ void TMesh::DecodeTriList( xmlNodePtr & node, int num_tris )
     }
 }
 
+//==== Copy The Same Tri Data EncodeTriList/DecodeTriList Round Trip ====//
+void TMesh::CopyTriList( TMesh* m )
+{
+    int num_tris = ( int )m->m_TVec.size();
+    m_TVec.resize( num_tris );
+    m_NVec.reserve( m_NVec.size() + 3 * num_tris );
+
+    for ( int i = 0 ; i < num_tris ; i++ )
+    {
+        TTri* from_tri = m->m_TVec[i];
+
+        m_TVec[i] = NewTri();
+        m_TVec[i]->m_N0 = NewNode();
+        m_TVec[i]->m_N1 = NewNode();
+        m_TVec[i]->m_N2 = NewNode();
+
+        m_NVec.push_back( m_TVec[i]->m_N0 );
+        m_NVec.push_back( m_TVec[i]->m_N1 );
+        m_NVec.push_back( m_TVec[i]->m_N2 );
+
+        m_TVec[i]->m_N0->m_Pnt = from_tri->m_N0->m_Pnt;
+        m_TVec[i]->m_N1->m_Pnt = from_tri->m_N1->m_Pnt;
+        m_TVec[i]->m_N2->m_Pnt = from_tri->m_N2->m_Pnt;
+        m_TVec[i]->m_Norm = from_tri->m_Norm;
+    }
+}
+
 void TMesh::LoadGeomAttributes( Geom* geomPtr )
 {
     /*color       = geomPtr->getColor();
@@ -614,7 +919,7 @@ int TMesh::RemoveDegenerate()
         else
         {
             num_deleted++;
-            delete tri;
+            FreeTObj( tri );
         }
     }
 
@@ -626,39 +931,12 @@ int TMesh::RemoveDegenerate()
 
 void TMesh::CheckIfClosed()
 {
-    int n, s, t;
+    int t;
 
     MatchNodes();
 
-    //==== Clear Refs to Tris ====//
-    for ( n = 0 ; n < ( int )m_NVec.size() ; n++ )
-    {
-        m_NVec[n]->m_TriVec.clear();
-    }
-
-    //==== Check If All Tris Have 3 Edges ====//
-    for ( t = 0 ; t < ( int )m_TVec.size() ; t++ )
-    {
-        m_TVec[t]->m_N0->m_TriVec.push_back( m_TVec[t] );
-        m_TVec[t]->m_N1->m_TriVec.push_back( m_TVec[t] );
-        m_TVec[t]->m_N2->m_TriVec.push_back( m_TVec[t] );
-        m_TVec[t]->m_E0 = 0;
-        m_TVec[t]->m_E1 = 0;
-        m_TVec[t]->m_E2 = 0;
-    }
-
     //==== Create Edges For Adjacent Tris ====//
-    for ( n = 0 ; n < ( int )m_NVec.size() ; n++ )
-    {
-        TNode* n0 = m_NVec[n];
-        for ( t = 0 ; t < ( int )n0->m_TriVec.size() ; t++ )
-        {
-            for ( s = t + 1 ; s < ( int )n0->m_TriVec.size() ; s++ )
-            {
-                FindEdge( n0, n0->m_TriVec[t], n0->m_TriVec[s] );
-            }
-        }
-    }
+    BuildTriEdges();
 
     //==== Check If All Tris Have 3 Edges ====//
     m_NonClosedTriVec.clear();
@@ -739,6 +1017,36 @@ void TMesh::Intersect( TMesh* tm, bool UWFlag )
     m_TBox.Intersect( &tm->m_TBox, UWFlag );
 }
 
+//==== Intersect Without Touching Either Mesh - Edges Are Returned In isectVec ====//
+void TMesh::Intersect( TMesh* tm, vector< TISectSeg > & isectVec )
+{
+    m_TBox.Intersect( &tm->m_TBox, isectVec );
+}
+
+//==== FNV-1a Hash Of Tri Vertex Positions ====//
+// Positions are unscaled and rounded so a mesh hashes the same after being rescaled.
+unsigned long long TMesh::ComputeGeomHash( double scale )
+{
+    unsigned long long num_tris = m_TVec.size();
+    unsigned long long h = HashBytes( HASH_SEED, &num_tris, sizeof( num_tris ) );
+
+    double fact = 1.0e8 / scale;
+    for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
+    {
+        TTri* tri = m_TVec[t];
+        for ( int i = 0 ; i < 3 ; i++ )
+        {
+            const vec3d & p = tri->GetTriNode( i )->m_Pnt;
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                long long val = llround( p[k] * fact );
+                h = HashBytes( h, &val, sizeof( val ) );
+            }
+        }
+    }
+    return h;
+}
+
 bool TMesh::CheckIntersect( TMesh* tm )
 {
     return m_TBox.CheckIntersect( &tm->m_TBox );
@@ -749,18 +1057,41 @@ double TMesh::MinDistance( TMesh* tm, double curr_min_dist )
     return m_TBox.MinDistance( &tm->m_TBox, curr_min_dist );
 }
 
+//==== Split All Intersected Tris - Tris Are Independent So Split Them In Parallel ====//
 void TMesh::Split()
 {
     int t;
-    for ( t = 0 ; t < ( int )m_TVec.size() ; t++ )
+    int num_tris = ( int )m_TVec.size();
+
+    //==== Only Start Threads From Serial Code - Nested Calls Run On The Calling Thread ====//
+    int num_threads = 1;
+#ifdef _OPENMP
+    if ( !omp_in_parallel() )
+    {
+        num_threads = omp_get_max_threads();
+    }
+#endif
+
+    AllocWorkerPools( num_threads );
+    vector< TriSplitBuffer > buf_vec( num_threads );
+
+    #pragma omp parallel for schedule( dynamic, 64 ) if ( num_threads > 1 )
+    for ( t = 0 ; t < num_tris ; t++ )
     {
-        m_TVec[t]->SplitTri();
+        if ( m_TVec[t]->m_ISectEdgeVec.size() )
+        {
+            m_TVec[t]->SplitTri( &buf_vec[ TMeshThreadNum() ] );
+        }
     }
 }
 
 
-void TMesh::DeterIntExt( vector< TMesh* >& meshVec )
+//==== Collect Tris To Classify - Split Tris Replace Their Parent ====//
+void TMesh::GatherIntExtTris( vector< TTri* > & triVec )
 {
+    triVec.clear();
+    triVec.reserve( m_TVec.size() );
+
     for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
     {
         TTri* tri = m_TVec[t];
@@ -771,21 +1102,68 @@ void TMesh::DeterIntExt( vector< TMesh* >& meshVec )
             tri->m_InteriorFlag = 1;
             for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
             {
-                DeterIntExtTri( tri->m_SplitVec[s], meshVec );
+                triVec.push_back( tri->m_SplitVec[s] );
             }
         }
         else
         {
-            DeterIntExtTri( tri, meshVec );
+            triVec.push_back( tri );
+        }
+    }
+}
+
+//==== Ray Origins For Packet of Tris ====//
+static void IntExtRayOrigins( TTri** triArr, int num, vec3d* origArr )
+{
+    for ( int k = 0 ; k < num ; k++ )
+    {
+        TTri* tri = triArr[k];
+        vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
+        origArr[k] = ( orig + tri->m_N2->m_Pnt ) * 0.5;
+    }
+}
+
+//==== Classify Tris In Parallel - Neighboring Tris Are Traced Together As Ray Packets ====//
+void TMesh::DeterIntExt( vector< TMesh* >& meshVec )
+{
+    vector< TTri* > tri_vec;
+    GatherIntExtTris( tri_vec );
+
+    const int pack_size = TBndBox::RAY_PACKET_SIZE;
+    int num_tris = ( int )tri_vec.size();
+    int num_packs = ( num_tris + pack_size - 1 ) / pack_size;
+
+    #pragma omp parallel
+    {
+        vector< double > tparm_vec_arr[ TBndBox::RAY_PACKET_SIZE ];  // Per thread scratch
+
+        #pragma omp for schedule( dynamic, 16 )
+        for ( int p = 0 ; p < num_packs ; p++ )
+        {
+            int start = p * pack_size;
+            DeterIntExtPacket( &tri_vec[ start ], min( pack_size, num_tris - start ), meshVec, tparm_vec_arr );
         }
     }
 }
 
 void TMesh::DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
 {
-    vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
-    orig = ( orig + tri->m_N2->m_Pnt ) * 0.5;
-    tri->m_InteriorFlag = 0;
+    vector< double > tparm_vec_arr[ TBndBox::RAY_PACKET_SIZE ];
+    DeterIntExtPacket( &tri, 1, meshVec, tparm_vec_arr );
+}
+
+void TMesh::DeterIntExtPacket( TTri** triArr, int num, vector< TMesh* >& meshVec, vector< double >* tParmVecArr )
+{
+    vec3d orig_arr[ TBndBox::RAY_PACKET_SIZE ];
+    bool active_arr[ TBndBox::RAY_PACKET_SIZE ];
+    IntExtRayOrigins( triArr, num, orig_arr );
+
+    for ( int k = 0 ; k < num ; k++ )
+    {
+        triArr[k]->m_InteriorFlag = 0;
+        active_arr[k] = true;
+    }
+    int num_active = num;
 
     vec3d dir( 1.0, 0.000001, 0.000001 );
 
@@ -793,12 +1171,21 @@ void TMesh::DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
     {
         if ( meshVec[m] != this )
         {
-            vector<double > tParmVec;
-            meshVec[m]->m_TBox.RayCast( orig, dir, tParmVec );
-            if ( tParmVec.size() % 2 )
+            meshVec[m]->m_TBox.RayCastPacket( orig_arr, active_arr, num, dir, tParmVecArr );
+
+            for ( int k = 0 ; k < num ; k++ )
+            {
+                if ( active_arr[k] && ( tParmVecArr[k].size() % 2 ) )
+                {
+                    triArr[k]->m_InteriorFlag = 1;
+                    active_arr[k] = false;
+                    num_active--;
+                }
+            }
+
+            if ( num_active == 0 )
             {
-                tri->m_InteriorFlag = 1;
-                return ;
+                return;
             }
         }
     }
@@ -806,33 +1193,45 @@ void TMesh::DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
 
 void TMesh::MassDeterIntExt( vector< TMesh* >& meshVec )
 {
-    for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
+    vector< TTri* > tri_vec;
+    GatherIntExtTris( tri_vec );
+
+    const int pack_size = TBndBox::RAY_PACKET_SIZE;
+    int num_tris = ( int )tri_vec.size();
+    int num_packs = ( num_tris + pack_size - 1 ) / pack_size;
+
+    #pragma omp parallel
     {
-        TTri* tri = m_TVec[t];
+        vector< double > tparm_vec_arr[ TBndBox::RAY_PACKET_SIZE ];  // Per thread scratch
 
-        //==== Do Interior Tris ====//
-        if ( tri->m_SplitVec.size() )
-        {
-            tri->m_InteriorFlag = 1;
-            for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
-            {
-                MassDeterIntExtTri( tri->m_SplitVec[s], meshVec );
-            }
-        }
-        else
+        #pragma omp for schedule( dynamic, 16 )
+        for ( int p = 0 ; p < num_packs ; p++ )
         {
-            MassDeterIntExtTri( tri, meshVec );
+            int start = p * pack_size;
+            MassDeterIntExtPacket( &tri_vec[ start ], min( pack_size, num_tris - start ), meshVec, tparm_vec_arr );
         }
     }
 }
 
-
 void TMesh::MassDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
 {
-    vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
-    orig = ( orig + tri->m_N2->m_Pnt ) * 0.5;
-    tri->m_InteriorFlag = 1;
-    int prior = -1;
+    vector< double > tparm_vec_arr[ TBndBox::RAY_PACKET_SIZE ];
+    MassDeterIntExtPacket( &tri, 1, meshVec, tparm_vec_arr );
+}
+
+void TMesh::MassDeterIntExtPacket( TTri** triArr, int num, vector< TMesh* >& meshVec, vector< double >* tParmVecArr )
+{
+    vec3d orig_arr[ TBndBox::RAY_PACKET_SIZE ];
+    bool active_arr[ TBndBox::RAY_PACKET_SIZE ];
+    int prior_arr[ TBndBox::RAY_PACKET_SIZE ];
+    IntExtRayOrigins( triArr, num, orig_arr );
+
+    for ( int k = 0 ; k < num ; k++ )
+    {
+        triArr[k]->m_InteriorFlag = 1;
+        active_arr[k] = true;
+        prior_arr[k] = -1;
+    }
 
     vec3d dir( 1.0, 0.000001, 0.000001 );
 
@@ -840,50 +1239,61 @@ void TMesh::MassDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
     {
         if ( meshVec[m] != this )
         {
-            vector<double > tParmVec;
-            meshVec[m]->m_TBox.RayCast( orig, dir, tParmVec );
-            if ( tParmVec.size() % 2 )
+            meshVec[m]->m_TBox.RayCastPacket( orig_arr, active_arr, num, dir, tParmVecArr );
+
+            for ( int k = 0 ; k < num ; k++ )
             {
-                if ( meshVec[m]->m_MassPrior > prior )
+                if ( tParmVecArr[k].size() % 2 )
                 {
-                    tri->m_InteriorFlag = 0;
-                    tri->m_ID = meshVec[m]->m_PtrID;
-                    tri->m_Density = meshVec[m]->m_Density;
-                    prior = meshVec[m]->m_MassPrior;
+                    if ( meshVec[m]->m_MassPrior > prior_arr[k] )
+                    {
+                        triArr[k]->m_InteriorFlag = 0;
+                        triArr[k]->m_ID = meshVec[m]->m_PtrID;
+                        triArr[k]->m_Density = meshVec[m]->m_Density;
+                        prior_arr[k] = meshVec[m]->m_MassPrior;
+                    }
                 }
             }
         }
     }
 }
 
-void TMesh::WaveDeterIntExt( vector< TMesh* >& meshVec )
+//==== Index Of The Highest Mass Priority Other Mesh Enclosing Each Tri, -1 For None ====//
+// Equal priorities go to the earlier mesh, matching MassDeterIntExt.
+void TMesh::MassOwners( vector< TMesh* >& meshVec, vector< TTri* > & triVec, vector< int > & ownerVec )
 {
-    for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
+    GatherIntExtTris( triVec );
+
+    const int pack_size = TBndBox::RAY_PACKET_SIZE;
+    int num_tris = ( int )triVec.size();
+    int num_packs = ( num_tris + pack_size - 1 ) / pack_size;
+    ownerVec.assign( num_tris, -1 );
+
+    #pragma omp parallel
     {
-        TTri* tri = m_TVec[t];
+        vector< double > tparm_vec_arr[ TBndBox::RAY_PACKET_SIZE ];  // Per thread scratch
 
-        //==== Do Interior Tris ====//
-        if ( tri->m_SplitVec.size() )
-        {
-            tri->m_InteriorFlag = 1;
-            for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
-            {
-                WaveDeterIntExtTri( tri->m_SplitVec[s], meshVec );
-            }
-        }
-        else
+        #pragma omp for schedule( dynamic, 16 )
+        for ( int p = 0 ; p < num_packs ; p++ )
         {
-            WaveDeterIntExtTri( tri, meshVec );
+            int start = p * pack_size;
+            MassOwnersPacket( &triVec[ start ], min( pack_size, num_tris - start ), meshVec, tparm_vec_arr, &ownerVec[ start ] );
         }
     }
 }
 
-void TMesh::WaveDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
+void TMesh::MassOwnersPacket( TTri** triArr, int num, vector< TMesh* >& meshVec, vector< double >* tParmVecArr, int* ownerArr )
 {
-    vec3d orig = ( tri->m_N0->m_Pnt + tri->m_N1->m_Pnt ) * 0.5;
-    orig = ( orig + tri->m_N2->m_Pnt ) * 0.5;
-    tri->m_InteriorFlag = 0;
-    int prior = -1;
+    vec3d orig_arr[ TBndBox::RAY_PACKET_SIZE ];
+    bool active_arr[ TBndBox::RAY_PACKET_SIZE ];
+    int prior_arr[ TBndBox::RAY_PACKET_SIZE ];
+    IntExtRayOrigins( triArr, num, orig_arr );
+
+    for ( int k = 0 ; k < num ; k++ )
+    {
+        active_arr[k] = true;
+        prior_arr[k] = -1;
+    }
 
     vec3d dir( 1.0, 0.000001, 0.000001 );
 
@@ -891,27 +1301,92 @@ void TMesh::WaveDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
     {
         if ( meshVec[m] != this )
         {
-            vector<double > tParmVec;
-            meshVec[m]->m_TBox.RayCast( orig, dir, tParmVec );
-            if ( tParmVec.size() % 2 )
+            meshVec[m]->m_TBox.RayCastPacket( orig_arr, active_arr, num, dir, tParmVecArr );
+
+            for ( int k = 0 ; k < num ; k++ )
             {
-                if ( meshVec[m]->m_MassPrior > prior )
+                if ( ( tParmVecArr[k].size() % 2 ) && meshVec[m]->m_MassPrior > prior_arr[k] )
                 {
-                    tri->m_InteriorFlag = 1;
-                    tri->m_ID = meshVec[m]->m_PtrID;
-                    prior = meshVec[m]->m_MassPrior;
+                    ownerArr[k] = m;
+                    prior_arr[k] = meshVec[m]->m_MassPrior;
                 }
             }
         }
     }
 }
 
-double TMesh::ComputeTheoArea()
+void TMesh::WaveDeterIntExt( vector< TMesh* >& meshVec )
 {
-    m_TheoArea = 0;
-    m_TagTheoAreaVec.clear();
-    unsigned int ntags = SubSurfaceMgr.GetNumTags() - 1;
-    if ( ntags > 0 )
+    vector< TTri* > tri_vec;
+    GatherIntExtTris( tri_vec );
+
+    const int pack_size = TBndBox::RAY_PACKET_SIZE;
+    int num_tris = ( int )tri_vec.size();
+    int num_packs = ( num_tris + pack_size - 1 ) / pack_size;
+
+    #pragma omp parallel
+    {
+        vector< double > tparm_vec_arr[ TBndBox::RAY_PACKET_SIZE ];  // Per thread scratch
+
+        #pragma omp for schedule( dynamic, 16 )
+        for ( int p = 0 ; p < num_packs ; p++ )
+        {
+            int start = p * pack_size;
+            WaveDeterIntExtPacket( &tri_vec[ start ], min( pack_size, num_tris - start ), meshVec, tparm_vec_arr );
+        }
+    }
+}
+
+void TMesh::WaveDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec )
+{
+    vector< double > tparm_vec_arr[ TBndBox::RAY_PACKET_SIZE ];
+    WaveDeterIntExtPacket( &tri, 1, meshVec, tparm_vec_arr );
+}
+
+void TMesh::WaveDeterIntExtPacket( TTri** triArr, int num, vector< TMesh* >& meshVec, vector< double >* tParmVecArr )
+{
+    vec3d orig_arr[ TBndBox::RAY_PACKET_SIZE ];
+    bool active_arr[ TBndBox::RAY_PACKET_SIZE ];
+    int prior_arr[ TBndBox::RAY_PACKET_SIZE ];
+    IntExtRayOrigins( triArr, num, orig_arr );
+
+    for ( int k = 0 ; k < num ; k++ )
+    {
+        triArr[k]->m_InteriorFlag = 0;
+        active_arr[k] = true;
+        prior_arr[k] = -1;
+    }
+
+    vec3d dir( 1.0, 0.000001, 0.000001 );
+
+    for ( int m = 0 ; m < ( int )meshVec.size() ; m++ )
+    {
+        if ( meshVec[m] != this )
+        {
+            meshVec[m]->m_TBox.RayCastPacket( orig_arr, active_arr, num, dir, tParmVecArr );
+
+            for ( int k = 0 ; k < num ; k++ )
+            {
+                if ( tParmVecArr[k].size() % 2 )
+                {
+                    if ( meshVec[m]->m_MassPrior > prior_arr[k] )
+                    {
+                        triArr[k]->m_InteriorFlag = 1;
+                        triArr[k]->m_ID = meshVec[m]->m_PtrID;
+                        prior_arr[k] = meshVec[m]->m_MassPrior;
+                    }
+                }
+            }
+        }
+    }
+}
+
+double TMesh::ComputeTheoArea()
+{
+    m_TheoArea = 0;
+    m_TagTheoAreaVec.clear();
+    unsigned int ntags = SubSurfaceMgr.GetNumTags() - 1;
+    if ( ntags > 0 )
     {
         m_TagTheoAreaVec.resize( ntags, 0.0);
     }
@@ -1093,13 +1568,12 @@ void TMesh::AddTri( const vec3d & p0, const vec3d & p1, const vec3d & p2 )
 void TMesh::AddTri( const vec3d & v0, const vec3d & v1, const vec3d & v2, const vec3d & norm )
 {
     // Use For XYZ Tri
-    TTri* ttri = new TTri();
+    TTri* ttri = NewTri();
     ttri->m_Norm = norm;
-    ttri->SetTMeshPtr( this );
 
-    ttri->m_N0 = new TNode();
-    ttri->m_N1 = new TNode();
-    ttri->m_N2 = new TNode();
+    ttri->m_N0 = NewNode();
+    ttri->m_N1 = NewNode();
+    ttri->m_N2 = NewNode();
 
     ttri->m_N0->m_Pnt = v0;
     ttri->m_N1->m_Pnt = v1;
@@ -1117,13 +1591,12 @@ void TMesh::AddTri( const vec3d & v0, const vec3d & v1, const vec3d & v2, const
 
 void TMesh::AddTri( TNode* node0, TNode* node1, TNode* node2, const vec3d & norm )
 {
-    TTri* ttri = new TTri();
+    TTri* ttri = NewTri();
     ttri->m_Norm = norm;
-    ttri->SetTMeshPtr( this );
 
-    ttri->m_N0 = new TNode();
-    ttri->m_N1 = new TNode();
-    ttri->m_N2 = new TNode();
+    ttri->m_N0 = NewNode();
+    ttri->m_N1 = NewNode();
+    ttri->m_N2 = NewNode();
 
     ttri->m_N0->m_Pnt = node0->m_Pnt;
     ttri->m_N1->m_Pnt = node1->m_Pnt;
@@ -1169,7 +1642,7 @@ void TMesh::AddTri( const vec3d & v0, const vec3d & v1, const vec3d & v2, const
 void TMesh::AddTri( const TTri* tri)
 {
     // Copys and existing triangle and pushes back into the existing
-    TTri* new_tri = new TTri();
+    TTri* new_tri = NewTri();
 
     new_tri->CopyFrom( tri );
     m_TVec.push_back( new_tri );
@@ -1181,13 +1654,12 @@ void TMesh::AddTri( const TTri* tri)
 void TMesh::AddUWTri( const vec3d & uw0, const vec3d & uw1, const vec3d & uw2, const vec3d & norm )
 {
     // Use For XYZ Tri
-    TTri* ttri = new TTri();
+    TTri* ttri = NewTri();
     ttri->m_Norm = norm;
-    ttri->SetTMeshPtr( this );
 
-    ttri->m_N0 = new TNode();
-    ttri->m_N1 = new TNode();
-    ttri->m_N2 = new TNode();
+    ttri->m_N0 = NewNode();
+    ttri->m_N1 = NewNode();
+    ttri->m_N2 = NewNode();
 
     ttri->m_N0->m_Pnt = uw0;
     ttri->m_N1->m_Pnt = uw1;
@@ -1222,67 +1694,34 @@ void TMesh::LoadBndBox()
 //==== Write STL Tris =====//
 void TMesh::WriteSTLTris( FILE* file_id, Matrix4d XFormMat )
 {
-    int t, s;
-    vec3d norm;
-    vec3d v0, v1, v2;
-    vec3d d30, d21;
+    vector< vec3d > pnt_vec;
+    LoadSTLTris( pnt_vec, XFormMat );
+    WriteSTLFacets( file_id, pnt_vec );
+}
 
-    for ( t = 0 ; t < ( int )m_TVec.size() ; t++ )
+//==== Append Transformed Vertices Of Each Exterior, Non Degenerate Facet ====//
+void TMesh::LoadSTLTris( vector< vec3d > & pnt_vec, Matrix4d XFormMat )
+{
+    for ( int t = 0 ; t < ( int )m_TVec.size() ; t++ )
     {
         TTri* tri = m_TVec[t];
 
         if ( tri->m_SplitVec.size() )
         {
-            for ( s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
+            for ( int s = 0 ; s < ( int )tri->m_SplitVec.size() ; s++ )
             {
                 if ( !tri->m_SplitVec[s]->m_InteriorFlag )
                 {
-                    v0 = XFormMat.xform( tri->m_SplitVec[s]->m_N0->m_Pnt );
-                    v1 = XFormMat.xform( tri->m_SplitVec[s]->m_N1->m_Pnt );
-                    v2 = XFormMat.xform( tri->m_SplitVec[s]->m_N2->m_Pnt );
-
-                    d21 = v2 - v1;
-
-                    if ( d21.mag() > 0.000001 )
-                    {
-                        norm = cross( d21, v0 - v1 );
-                        norm.normalize();
-
-                        fprintf( file_id, " facet normal  %2.10le %2.10le %2.10le\n",  norm.x(), norm.y(), norm.z() );
-                        fprintf( file_id, "   outer loop\n" );
-                        fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", v0.x(), v0.y(), v0.z() );
-                        fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", v1.x(), v1.y(), v1.z() );
-                        fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", v2.x(), v2.y(), v2.z() );
-                        fprintf( file_id, "   endloop\n" );
-                        fprintf( file_id, " endfacet\n" );
-                    }
+                    AddSTLTri( pnt_vec, XFormMat.xform( tri->m_SplitVec[s]->m_N0->m_Pnt ),
+                               XFormMat.xform( tri->m_SplitVec[s]->m_N1->m_Pnt ),
+                               XFormMat.xform( tri->m_SplitVec[s]->m_N2->m_Pnt ) );
                 }
             }
         }
-        else
+        else if ( !tri->m_InteriorFlag )
         {
-            if ( !tri->m_InteriorFlag )
-            {
-                v0 = XFormMat.xform( tri->m_N0->m_Pnt );
-                v1 = XFormMat.xform( tri->m_N1->m_Pnt );
-                v2 = XFormMat.xform( tri->m_N2->m_Pnt );
-
-                d21 = v2 - v1;
-
-                if ( d21.mag() > 0.000001 )
-                {
-                    norm = cross( d21, v0 - v1 );
-                    norm.normalize();
-
-                    fprintf( file_id, " facet normal  %2.10le %2.10le %2.10le\n",  norm.x(), norm.y(), norm.z() );
-                    fprintf( file_id, "   outer loop\n" );
-                    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", v0.x(), v0.y(), v0.z() );
-                    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", v1.x(), v1.y(), v1.z() );
-                    fprintf( file_id, "     vertex %2.10le %2.10le %2.10le\n", v2.x(), v2.y(), v2.z() );
-                    fprintf( file_id, "   endloop\n" );
-                    fprintf( file_id, " endfacet\n" );
-                }
-            }
+            AddSTLTri( pnt_vec, XFormMat.xform( tri->m_N0->m_Pnt ), XFormMat.xform( tri->m_N1->m_Pnt ),
+                       XFormMat.xform( tri->m_N2->m_Pnt ) );
         }
     }
 }
@@ -1319,63 +1758,58 @@ int TMesh::NumVerts()
 
 TTri::TTri()
 {
-    static int cnt = 0;
-    cnt++;
-//printf("Tri Construct Cnt = %d \n", cnt);
     m_E0 = m_E1 = m_E2 = 0;
     m_N0 = m_N1 = m_N2 = 0;
     m_InteriorFlag = 0;
     m_InvalidFlag  = 0;
     m_Density = 1.0;
     m_TMesh = NULL;
+    m_ArenaFlag = false;
     m_PEArr[0] = m_PEArr[1] = m_PEArr[2] = NULL;
 }
 
 TTri::~TTri()
 {
-    static int cnt = 0;
-    cnt++;
-//printf("Tri Destruct Cnt = %d \n", cnt);
     int i;
 
     //==== Delete Split Edges ====//
     for ( i = 0 ; i < ( int )m_EVec.size() ; i++ )
     {
-        delete m_EVec[i];
+        FreeTObj( m_EVec[i] );
     }
 
     //==== Delete Perimeter Edges ====//
     for ( i = 0 ; i < 3 ; i++ )
     {
-        delete m_PEArr[i];
+        FreeTObj( m_PEArr[i] );
     }
 
     //==== Delete Nodes - Not First 3 ====//
     for ( i = 3 ; i < ( int )m_NVec.size() ; i++ )
     {
-        delete m_NVec[i];
+        FreeTObj( m_NVec[i] );
     }
 
     //==== Delete Sub Tris ====//
     for ( i = 0 ; i < ( int )m_SplitVec.size() ; i++ )
     {
-        delete m_SplitVec[i];
+        FreeTObj( m_SplitVec[i] );
     }
 
     for ( i = 0 ; i < ( int )m_ISectEdgeVec.size() ; i++ )
     {
-        delete m_ISectEdgeVec[i]->m_N0;
-        delete m_ISectEdgeVec[i]->m_N1;
-        delete m_ISectEdgeVec[i];
+        FreeTObj( m_ISectEdgeVec[i]->m_N0 );
+        FreeTObj( m_ISectEdgeVec[i]->m_N1 );
+        FreeTObj( m_ISectEdgeVec[i] );
     }
 
 }
 
 void TTri::CopyFrom( const TTri* tri )
 {
-    m_N0 = new TNode();
-    m_N1 = new TNode();
-    m_N2 = new TNode();
+    m_N0 = NewNode();
+    m_N1 = NewNode();
+    m_N2 = NewNode();
 
     m_N0->CopyFrom( tri->m_N0 );
     m_N1->CopyFrom( tri->m_N1 );
@@ -1395,16 +1829,66 @@ void TTri::BuildPermEdges()
     {
         for ( int i = 0 ; i < 3 ; i++ )
         {
-            delete m_PEArr[i];
+            FreeTObj( m_PEArr[i] );
             m_PEArr[i] = NULL;
         }
     }
     if ( m_N0 != NULL && m_N1 != NULL && m_N2 != NULL )
     {
-        m_PEArr[0] = new TEdge( m_N0, m_N1, this );
-        m_PEArr[1] = new TEdge( m_N1, m_N2, this );
-        m_PEArr[2] = new TEdge( m_N2, m_N0, this );
+        m_PEArr[0] = NewEdge();
+        m_PEArr[1] = NewEdge();
+        m_PEArr[2] = NewEdge();
+
+        m_PEArr[0]->m_N0 = m_N0;
+        m_PEArr[0]->m_N1 = m_N1;
+        m_PEArr[1]->m_N0 = m_N1;
+        m_PEArr[1]->m_N1 = m_N2;
+        m_PEArr[2]->m_N0 = m_N2;
+        m_PEArr[2]->m_N1 = m_N0;
+
+        for ( int i = 0 ; i < 3 ; i++ )
+        {
+            m_PEArr[i]->SetParTri( this );
+        }
+    }
+}
+
+TNode* TTri::NewNode()
+{
+    if ( m_TMesh )
+    {
+        return m_TMesh->NewNode();
+    }
+    return new TNode();
+}
+
+TEdge* TTri::NewEdge()
+{
+    if ( m_TMesh )
+    {
+        return m_TMesh->NewEdge();
+    }
+    return new TEdge();
+}
+
+TTri* TTri::NewTri()
+{
+    if ( m_TMesh )
+    {
+        return m_TMesh->NewTri();
     }
+    return new TTri();
+}
+
+//==== Add Intersection Edge With Its Own Pair Of Nodes ====//
+void TTri::AddISectEdge( const vec3d & p0, const vec3d & p1 )
+{
+    TEdge* ie = NewEdge();
+    ie->m_N0 = NewNode();
+    ie->m_N0->m_Pnt = p0;
+    ie->m_N1 = NewNode();
+    ie->m_N1->m_Pnt = p1;
+    m_ISectEdgeVec.push_back( ie );
 }
 
 vec3d TTri::CompNorm()
@@ -1497,7 +1981,7 @@ bool TTri::MatchEdge( TNode* n0, TNode* n1, TNode* nA, TNode* nB, double tol )
 #define ON_EDGE_TOL 1e-5
 
 //==== Split A Triangle Along Edges in ISectEdges Vec =====//
-void TTri::SplitTri()
+void TTri::SplitTri( TriSplitBuffer* buf )
 {
     int i, j;
     double onEdgeTol = ON_EDGE_TOL; // was 1e-5
@@ -1510,6 +1994,12 @@ void TTri::SplitTri()
         return;
     }
 
+    TriSplitBuffer local_buf;
+    if ( !buf )
+    {
+        buf = &local_buf;
+    }
+
     //==== Delete Duplicate Edges ====//
     vector< TEdge* > noDupVec;
     noDupVec.push_back( m_ISectEdgeVec[0] );
@@ -1531,9 +2021,9 @@ void TTri::SplitTri()
         }
         else
         {
-            delete m_ISectEdgeVec[i]->m_N0;
-            delete m_ISectEdgeVec[i]->m_N1;
-            delete m_ISectEdgeVec[i];
+            FreeTObj( m_ISectEdgeVec[i]->m_N0 );
+            FreeTObj( m_ISectEdgeVec[i]->m_N1 );
+            FreeTObj( m_ISectEdgeVec[i] );
         }
     }
     m_ISectEdgeVec = noDupVec;
@@ -1553,7 +2043,7 @@ void TTri::SplitTri()
     //==== Add Edges For Perimeter ====//
     for ( i = 0 ; i < 3 ; i++ )
     {
-        m_EVec.push_back(  new TEdge() );
+        m_EVec.push_back(  NewEdge() );
     }
 
     m_EVec[0]->m_N0 = m_N0;
@@ -1563,6 +2053,14 @@ void TTri::SplitTri()
     m_EVec[2]->m_N0 = m_N2;
     m_EVec[2]->m_N1 = m_N0;
 
+    //==== Track Which Perimeter Side Each Node And Edge Lies On ====//
+    vector< int > & nodeSide = buf->m_NodeSide;
+    vector< double > & nodeT = buf->m_NodeT;
+    nodeSide.assign( 3, -1 );
+    nodeT.assign( 3, 0.0 );
+    int edgeSide[3] = { 0, 1, 2 };
+    vector< int > perimSide( edgeSide, edgeSide + 3 );
+
     //==== Load All Possible Nodes to Add ====//
     vector< vec3d > pVec;               // Pnts to be added
     vector< vec3d > uwVec;
@@ -1600,7 +2098,7 @@ void TTri::SplitTri()
             if ( onEdgeFlag )
             {
                 //==== SplitEdge ====//
-                TNode* sn = new TNode();        // New node
+                TNode* sn = NewNode();        // New node
                 sn->m_IsectFlag = 1;
                 m_NVec.push_back( sn );
                 matchNodeIndex[i] = m_NVec.size() - 1;
@@ -1610,11 +2108,20 @@ void TTri::SplitTri()
                 {
                     sn->MakePntUW();
                 }
-                TEdge* se = new TEdge();        // New Edge
+                TEdge* se = NewEdge();        // New Edge
                 se->m_N0 = m_EVec[j]->m_N0;
                 se->m_N1 = sn;
                 m_EVec[j]->m_N0 = sn;               // Change Split Edge
                 m_EVec.push_back( se );
+
+                int side = perimSide[j];
+                vec3d c0 = m_NVec[side]->m_Pnt;
+                vec3d c1 = m_NVec[ ( side + 1 ) % 3 ]->m_Pnt;
+                vec3d p = uwflag ? uwVec[i] : pVec[i];
+                double len2 = dist_squared( c0, c1 );
+                perimSide.push_back( side );
+                nodeSide.push_back( side );
+                nodeT.push_back( len2 > 0.0 ? dot( p - c0, c1 - c0 ) / len2 : 0.0 );
                 break;
             }
         }
@@ -1649,7 +2156,7 @@ void TTri::SplitTri()
         //==== Didnt Find One - Add New ====//
         if ( matchNodeIndex[i] == -1 )
         {
-            TNode* sn = new TNode();        // New node
+            TNode* sn = NewNode();        // New node
             sn->m_IsectFlag = 1;
             m_NVec.push_back( sn );
             matchNodeIndex[i] = m_NVec.size() - 1;
@@ -1659,9 +2166,14 @@ void TTri::SplitTri()
             {
                 sn->MakePntUW();
             }
+            nodeSide.push_back( -2 );
+            nodeT.push_back( 0.0 );
         }
     }
 
+    //==== Edges Past This Point Are Chords Across The Tri ====//
+    buf->m_NumPerimEdges = ( int )m_EVec.size();
+
     //==== Add Edges ====//
     for ( i = 0 ; i < ( int )matchNodeIndex.size() ; i += 2 )
     {
@@ -1685,7 +2197,7 @@ void TTri::SplitTri()
 
             if ( !existFlag )
             {
-                TEdge* se = new TEdge();        // New Edge
+                TEdge* se = NewEdge();        // New Edge
                 se->m_N0 = m_NVec[ind0];
                 se->m_N1 = m_NVec[ind1];
                 m_EVec.push_back( se );
@@ -1739,7 +2251,7 @@ void TTri::SplitTri()
                         else if ( u < uvMinTol && v >= uvMinTol && v <= uvMaxTol )
                         {
                             //==== Break Along Line Seg 2 ====//
-                            TEdge* se = new TEdge();        // New Edge
+                            TEdge* se = NewEdge();        // New Edge
                             se->m_N0 = en0;
                             se->m_N1 = en3;
                             m_EVec[j]->m_N0 = en2;
@@ -1749,7 +2261,7 @@ void TTri::SplitTri()
                         else if ( u > uvMaxTol && v >= uvMinTol && v <= uvMaxTol )
                         {
                             //==== Break Along Line Seg 2 ====//
-                            TEdge* se = new TEdge();        // New Edge
+                            TEdge* se = NewEdge();        // New Edge
                             se->m_N0 = en1;
                             se->m_N1 = en3;
                             m_EVec[j]->m_N0 = en2;
@@ -1759,7 +2271,7 @@ void TTri::SplitTri()
                         else if ( v < uvMinTol && u >= uvMinTol && u <= uvMaxTol )
                         {
                             //==== Break Along Line Seg 1 ====//
-                            TEdge* se = new TEdge();        // New Edge
+                            TEdge* se = NewEdge();        // New Edge
                             se->m_N0 = en2;
                             se->m_N1 = en1;
                             m_EVec[i]->m_N0 = en2;
@@ -1769,7 +2281,7 @@ void TTri::SplitTri()
                         else if ( v > uvMaxTol && u >= uvMinTol && u <= uvMaxTol )
                         {
                             //==== Break Along Line Seg 1 ====//
-                            TEdge* se = new TEdge();        // New Edge
+                            TEdge* se = NewEdge();        // New Edge
                             se->m_N0 = en3;
                             se->m_N1 = en1;
                             m_EVec[i]->m_N0 = en3;
@@ -1779,7 +2291,7 @@ void TTri::SplitTri()
                         else
                         {
                             //==== New Node at Crossing Point ====//
-                            TNode* sn = new TNode();
+                            TNode* sn = NewNode();
                             sn->m_IsectFlag = 1;
                             m_NVec.push_back( sn );
 
@@ -1801,12 +2313,12 @@ void TTri::SplitTri()
                                 sn->SetXYZPnt( crossing_node );
                             }
 
-                            TEdge* se0 = new TEdge();       // New Edge
+                            TEdge* se0 = NewEdge();       // New Edge
                             se0->m_N0 = en0;
                             se0->m_N1 = sn;
                             m_EVec[i]->m_N0 = sn;
                             m_EVec[i]->m_N1 = en1;
-                            TEdge* se1 = new TEdge();       // New Edge
+                            TEdge* se1 = NewEdge();       // New Edge
                             se1->m_N0 = en2;
                             se1->m_N1 = sn;
                             m_EVec[j]->m_N0 = sn;
@@ -1818,6 +2330,7 @@ void TTri::SplitTri()
 
                         if ( findCross )
                         {
+                            buf->m_NumPerimEdges = -1;  // Edges were split - perimeter order is lost
                             j = m_EVec.size();
                         }
                     }
@@ -1856,7 +2369,7 @@ void TTri::SplitTri()
     }
 
     //==== Use Triangle to Split Tri ====//
-    TriangulateSplit( flattenAxis );
+    TriangulateSplit( flattenAxis, *buf );
 
     if ( !uwflag )
     {
@@ -1886,7 +2399,185 @@ void TTri::SplitTri()
     }
 }
 
-void TTri::TriangulateSplit( int flattenAxis )
+//==== Twice The Signed Area Of A Flattened Tri ====//
+static double SplitOrient2d( const double* pnts, int a, int b, int c )
+{
+    const double* pa = pnts + a * 2;
+    const double* pb = pnts + b * 2;
+    const double* pc = pnts + c * 2;
+    return ( pb[0] - pa[0] ) * ( pc[1] - pa[1] ) - ( pb[1] - pa[1] ) * ( pc[0] - pa[0] );
+}
+
+//==== Positive If d Is Inside The Circle Through Counter Clockwise a, b, c ====//
+static double SplitInCircle( const double* pnts, int a, int b, int c, int d )
+{
+    double adx = pnts[a * 2] - pnts[d * 2];
+    double ady = pnts[a * 2 + 1] - pnts[d * 2 + 1];
+    double bdx = pnts[b * 2] - pnts[d * 2];
+    double bdy = pnts[b * 2 + 1] - pnts[d * 2 + 1];
+    double cdx = pnts[c * 2] - pnts[d * 2];
+    double cdy = pnts[c * 2 + 1] - pnts[d * 2 + 1];
+
+    return ( adx * adx + ady * ady ) * ( bdx * cdy - cdx * bdy ) +
+           ( bdx * bdx + bdy * bdy ) * ( cdx * ady - adx * cdy ) +
+           ( cdx * cdx + cdy * cdy ) * ( adx * bdy - bdx * ady );
+}
+
+//==== Sort Perimeter Nodes Along A Side ====//
+class SplitSideCompare
+{
+public:
+    SplitSideCompare( const vector< double > & t_vec ) : m_TVec( t_vec )  {}
+    bool operator()( int a, int b ) const
+    {
+        return m_TVec[a] < m_TVec[b];
+    }
+    const vector< double > & m_TVec;
+};
+
+//==== Constrained Triangulation When Every Node Is On The Perimeter ====//
+// The usual split has one or two intersection edges running between points on the tri
+// perimeter.  The perimeter loop is cut along each chord and the resulting triangles and
+// convex quads are triangulated directly, quads with their Delaunay diagonal.  Returns
+// false for anything else so the general path through triangle() is taken instead.
+static bool SplitPerimTriangulate( TriSplitBuffer & buf, int num_pnts )
+{
+    const vector< int > & seg_ind = buf.m_SegIndList;
+    const double min_orient = 1e-12;
+    const double* pnts = &buf.m_PntList[0];
+    int i, j, k;
+
+    if ( buf.m_NumPerimEdges < 0 || ( int )buf.m_NodeSide.size() != num_pnts )
+    {
+        return false;
+    }
+
+    //==== Perimeter Loop - Corner, Nodes Along Side, Next Corner... ====//
+    vector< int > & bnd = buf.m_BndList;
+    bnd.clear();
+    for ( k = 0 ; k < 3 ; k++ )
+    {
+        bnd.push_back( k );
+        int first = ( int )bnd.size();
+        for ( i = 3 ; i < num_pnts ; i++ )
+        {
+            if ( buf.m_NodeSide[i] == k )
+            {
+                bnd.push_back( i );
+            }
+            else if ( buf.m_NodeSide[i] < 0 )
+            {
+                return false;            // Interior node
+            }
+        }
+        sort( bnd.begin() + first, bnd.end(), SplitSideCompare( buf.m_NodeT ) );
+    }
+
+    //==== Cut Loop Along Each Chord ====//
+    vector< vector< int > > & face_vec = buf.m_FaceVec;
+    face_vec.resize( 1 );
+    face_vec[0] = bnd;
+    int num_faces = 1;
+
+    for ( i = buf.m_NumPerimEdges * 2 ; i < ( int )seg_ind.size() ; i += 2 )
+    {
+        int a = seg_ind[i];
+        int b = seg_ind[i + 1];
+
+        bool cut = false;
+        for ( j = 0 ; j < num_faces && !cut ; j++ )
+        {
+            vector< int > & f = face_vec[j];
+            int n = ( int )f.size();
+            int ia = ( int )( find( f.begin(), f.end(), a ) - f.begin() );
+            int ib = ( int )( find( f.begin(), f.end(), b ) - f.begin() );
+            if ( ia == n || ib == n )
+            {
+                continue;
+            }
+            if ( ia > ib )
+            {
+                swap( ia, ib );
+            }
+            if ( ib - ia < 2 || ib - ia > n - 2 )
+            {
+                return false;            // Chord along the perimeter
+            }
+
+            if ( ( int )face_vec.size() < num_faces + 1 )
+            {
+                face_vec.resize( num_faces + 1 );     // May move f
+            }
+            vector< int > & cf = face_vec[j];
+            face_vec[num_faces].assign( cf.begin() + ia, cf.begin() + ib + 1 );
+            cf.erase( cf.begin() + ia + 1, cf.begin() + ib );
+            num_faces++;
+            cut = true;
+        }
+
+        if ( !cut )
+        {
+            return false;
+        }
+    }
+
+    //==== Triangulate Each Face ====//
+    vector< int > & tri_list = buf.m_TriList;
+    tri_list.clear();
+    for ( j = 0 ; j < num_faces ; j++ )
+    {
+        vector< int > & f = face_vec[j];
+        if ( f.size() == 3 )
+        {
+            if ( std::abs( SplitOrient2d( pnts, f[0], f[1], f[2] ) ) < min_orient )
+            {
+                return false;
+            }
+            tri_list.push_back( f[0] );
+            tri_list.push_back( f[1] );
+            tri_list.push_back( f[2] );
+        }
+        else if ( f.size() == 4 )
+        {
+            //==== Must Be Strictly Convex ====//
+            double o[4];
+            for ( k = 0 ; k < 4 ; k++ )
+            {
+                o[k] = SplitOrient2d( pnts, f[k], f[( k + 1 ) % 4], f[( k + 2 ) % 4] );
+            }
+            double sgn = o[0] > 0.0 ? 1.0 : -1.0;
+            for ( k = 0 ; k < 4 ; k++ )
+            {
+                if ( sgn * o[k] < min_orient )
+                {
+                    return false;
+                }
+            }
+
+            //==== Delaunay Diagonal ====//
+            double inc = sgn > 0.0 ? SplitInCircle( pnts, f[0], f[1], f[2], f[3] ) :
+                                     SplitInCircle( pnts, f[0], f[2], f[1], f[3] );
+            if ( inc > 0.0 )
+            {
+                int tri[6] = { f[0], f[1], f[3], f[1], f[2], f[3] };
+                tri_list.insert( tri_list.end(), tri, tri + 6 );
+            }
+            else
+            {
+                int tri[6] = { f[0], f[1], f[2], f[0], f[2], f[3] };
+                tri_list.insert( tri_list.end(), tri, tri + 6 );
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void TTri::TriangulateSplit( int flattenAxis, TriSplitBuffer & buf )
 {
     int i, j;
 
@@ -1897,11 +2588,14 @@ void TTri::TriangulateSplit( int flattenAxis )
     memset( &in, 0, sizeof( in ) ); // Load Zeros
     memset( &out, 0, sizeof( out ) );
 
-    //==== PreAllocate Data For In/Out ====//
-    in.pointlist    = ( REAL * ) malloc( m_NVec.size() * 2 * sizeof( REAL ) );
+    //==== Point And Segment Arrays Are Reused From The Buffer ====//
+    buf.m_PntList.resize( m_NVec.size() * 2 + 2 );
+    buf.m_SegList.resize( m_EVec.size() * 2 + 2 );
+
+    in.pointlist    = &buf.m_PntList[0];
     out.pointlist   = NULL;
 
-    in.segmentlist  = ( int * ) malloc( m_EVec.size() * 2 * sizeof( int ) );
+    in.segmentlist  = &buf.m_SegList[0];
     out.segmentlist  = NULL;
     out.trianglelist  = NULL;
 
@@ -1966,26 +2660,10 @@ void TTri::TriangulateSplit( int flattenAxis )
             cnt++;
         }
     }
-//static FILE* fp = fopen( "debug.txt", "w" );
-//
-//static int static_cnt = 0;
-//fprintf(fp, "Triangle Cnt = %d\n", static_cnt++ );
-//if ( static_cnt == 843 )
-//{
-//  for ( i = 0 ; i < in.numberofpoints ; i++ )
-//  {
-//      fprintf(fp, "%f %f \n", in.pointlist[i*2],  in.pointlist[i*2 + 1] );
-//  }
-//
-//  for ( j = 0 ; j < (int)nVec.size() ; j++ )
-//  {
-//      fprintf(fp, "%f %f %f \n", nVec[j]->pnt.x(), nVec[j]->pnt.y(), nVec[j]->pnt.z() );
-//  }
-//
-//}
 
     //==== Match Edge Nodes to Indices in NVec ====//
-    vector< int > segIndList;
+    vector< int > & segIndList = buf.m_SegIndList;
+    segIndList.clear();
     for ( i = 0 ; i < ( int )m_EVec.size() ; i++ )
     {
         for ( j = 0 ; j < ( int )m_NVec.size() ; j++ )
@@ -2006,7 +2684,7 @@ void TTri::TriangulateSplit( int flattenAxis )
         }
     }
     cnt = 0;
-    for ( j = 0 ; j < ( int )segIndList.size() ; j += 2 )
+    for ( j = 0 ; j + 1 < ( int )segIndList.size() ; j += 2 )
     {
         in.segmentlist[cnt] = segIndList[j];
         cnt++;
@@ -2016,6 +2694,9 @@ void TTri::TriangulateSplit( int flattenAxis )
 
     in.numberofsegments = segIndList.size() / 2;
 
+    const int* tri_ind = NULL;
+    int num_out_tris = 0;
+
     if ( in.numberofpoints > 3 && in.numberofsegments > 3 )
     {
         //==== Check For Duplicate Points =====//
@@ -2034,61 +2715,43 @@ void TTri::TriangulateSplit( int flattenAxis )
 
         if ( !dupFlag )
         {
-            //==== Constrained Delaunay Trianglulation ====//
-            triangulate ( "zpQ", &in, &out, ( struct triangulateio * ) NULL );
+            //==== Chords Between Perimeter Nodes Do Not Need Triangle ====//
+            if ( SplitPerimTriangulate( buf, in.numberofpoints ) )
+            {
+                tri_ind = &buf.m_TriList[0];
+                num_out_tris = buf.m_TriList.size() / 3;
+            }
+            else
+            {
+                //==== Constrained Delaunay Trianglulation ====//
+                triangulate ( "zpQ", &in, &out, ( struct triangulateio * ) NULL );
+                tri_ind = out.trianglelist;
+                num_out_tris = out.numberoftriangles;
+            }
         }
-//fprintf(fp, "Triangulate in = %d out = %d \n", in.numberofpoints, out.numberofpoints );
     }
 
 
     //==== Load Triangles if No New Point Created ====//
     cnt = 0;
-    for ( i = 0 ; i < out.numberoftriangles ; i++ )
+    for ( i = 0 ; i < num_out_tris ; i++ )
     {
-        if ( out.trianglelist[cnt]   < ( int )m_NVec.size() &&
-                out.trianglelist[cnt + 1] < ( int )m_NVec.size() &&
-                out.trianglelist[cnt + 2] < ( int )m_NVec.size() )
+        if ( tri_ind[cnt]   < ( int )m_NVec.size() &&
+                tri_ind[cnt + 1] < ( int )m_NVec.size() &&
+                tri_ind[cnt + 2] < ( int )m_NVec.size() )
         {
-            TTri* t = new TTri();
-            t->m_N0 = m_NVec[out.trianglelist[cnt]];
-            t->m_N1 = m_NVec[out.trianglelist[cnt + 1]];
-            t->m_N2 = m_NVec[out.trianglelist[cnt + 2]];
+            TTri* t = NewTri();
+            t->m_N0 = m_NVec[tri_ind[cnt]];
+            t->m_N1 = m_NVec[tri_ind[cnt + 1]];
+            t->m_N2 = m_NVec[tri_ind[cnt + 2]];
             t->m_Tags = m_Tags; // Set split tri to have same tags as original triangle
             t->m_Norm = m_Norm;
             m_SplitVec.push_back( t );
         }
-        else
-        {
-            /* jrg problem - look into...
-                        printf("\n");
-                        printf("m\n");
-                        printf("c red\n");
-                        printf("%12.8f, %12.8f, %12.8f \n", n0->pnt.x(), n0->pnt.y(), n0->pnt.z());
-                        printf("%12.8f, %12.8f, %12.8f \n", n1->pnt.x(), n1->pnt.y(), n1->pnt.z());
-                        printf("%12.8f, %12.8f, %12.8f \n", n2->pnt.x(), n2->pnt.y(), n2->pnt.z());
-                        printf("c blue\n");
-                        for ( j = 0 ; j < iSectEdgeVec.size() ; j++ )
-                        {
-                            printf("m\n");
-                            printf("%12.8f, %12.8f, %12.8f \n", iSectEdgeVec[j]->n0->pnt.x(), iSectEdgeVec[j]->n0->pnt.y(), iSectEdgeVec[j]->n0->pnt.z());
-                            printf("%12.8f, %12.8f, %12.8f \n", iSectEdgeVec[j]->n0->pnt.x(), iSectEdgeVec[j]->n1->pnt.y(), iSectEdgeVec[j]->n1->pnt.z());
-                        }
-            */
-
-        }
         cnt += 3;
     }
 
-    //==== Free Local Memory ====//
-    if ( in.pointlist )
-    {
-        free( in.pointlist );
-    }
-    if ( in.segmentlist )
-    {
-        free( in.segmentlist );
-    }
-
+    //==== Free Triangle Output ====//
     if ( out.pointlist )
     {
         free( out.pointlist );
@@ -2180,28 +2843,28 @@ void TTri::SplitEdges( TNode* n01, TNode* n12, TNode* n20 )
     TTri* tri;
     if ( n01 && n12 && n20 )        // Three Split - Make Four Tris
     {
-        tri = new TTri();
+        tri = NewTri();
         tri->m_N0 = m_N0;
         tri->m_N1 = n01;
         tri->m_N2 = n20;
         tri->m_Norm = m_Norm;
         m_SplitVec.push_back( tri );
 
-        tri = new TTri();
+        tri = NewTri();
         tri->m_N0 = m_N1;
         tri->m_N1 = n12;
         tri->m_N2 = n01;
         tri->m_Norm = m_Norm;
         m_SplitVec.push_back( tri );
 
-        tri = new TTri();
+        tri = NewTri();
         tri->m_N0 = m_N2;
         tri->m_N1 = n20;
         tri->m_N2 = n12;
         tri->m_Norm = m_Norm;
         m_SplitVec.push_back( tri );
 
-        tri = new TTri();
+        tri = NewTri();
         tri->m_N0 = n01;
         tri->m_N1 = n12;
         tri->m_N2 = n20;
@@ -2230,99 +2893,657 @@ void TTri::SplitEdges( TNode* n01, TNode* n12, TNode* n20 )
 //===============================================//
 //===============================================//
 
-TBndBox::TBndBox()
+//==== Spatial Index Selection ====//
+// TBndBox builds a flattened SAH bounding volume hierarchy by default.  Define VSP_TMESH_OCTREE
+// at build time to fall back to the original pointer based octree for benchmarking.
+
+const int BVH_MAX_LEAF_TRIS = 8;         // Always split nodes with more tris than this
+const int BVH_NUM_BINS = 16;             // Centroid bins per axis for SAH evaluation
+
+static double BoxSurfArea( const BndBox & b )
 {
-    for ( int i = 0 ; i < 8 ; i++ )
-    {
-        m_SBoxVec[i] = 0;
-    }
+    double dx = b.GetMax( 0 ) - b.GetMin( 0 );
+    double dy = b.GetMax( 1 ) - b.GetMin( 1 );
+    double dz = b.GetMax( 2 ) - b.GetMin( 2 );
+    return 2.0 * ( dx * dy + dy * dz + dz * dx );
 }
 
-TBndBox::~TBndBox()
+//==== Predicate For Partitioning Tri Indices About A Centroid Bin Split ====//
+class BvhBinPred
 {
-    for ( int i = 0 ; i < 8 ; i++ )
+public:
+    BvhBinPred( const vector< vec3d > & cen_vec, int axis, double cmin, double scale, int split ) :
+        m_CenVec( cen_vec ), m_Axis( axis ), m_CMin( cmin ), m_Scale( scale ), m_Split( split )
     {
-        delete m_SBoxVec[i];
     }
-}
 
-void TBndBox::Reset()
-{
-    for ( int i = 0 ; i < 8 ; i++ )
+    bool operator()( int id ) const
     {
-        delete m_SBoxVec[i];
-        m_SBoxVec[i] = 0;
+        int b = min( ( int )( ( m_CenVec[id].v[m_Axis] - m_CMin ) * m_Scale ), BVH_NUM_BINS - 1 );
+        return b < m_Split;
     }
 
-    m_Box.Reset();
-    m_TriVec.clear();
-}
+protected:
+    const vector< vec3d > & m_CenVec;
+    int m_Axis;
+    double m_CMin;
+    double m_Scale;
+    int m_Split;
+};
 
-//==== Create Oct Tree of Overlaping BndBoxes ====//
-void TBndBox::SplitBox()
+//==== Tri Set Laid Out For Batched Rejection With tri_tri_reject_batch ====//
+// Only pairs the batch filter cannot rule out are passed to the exact Moller routine.
+const int TRI_BATCH_LOCAL_CHUNKS = 8;          // Chunks held without allocating, covers BVH leaves
+
+class TriBatchSet
 {
-    int i;
-    if ( m_TriVec.size() > 32 )
+public:
+    TriBatchSet( TTri* const * triArr, int num ) : m_Num( num )
     {
-        //==== Find Split Points ====//
-        double hx = 0.5 * ( m_Box.GetMax( 0 ) + m_Box.GetMin( 0 ) );
-        double hy = 0.5 * ( m_Box.GetMax( 1 ) + m_Box.GetMin( 1 ) );
-        double hz = 0.5 * ( m_Box.GetMax( 2 ) + m_Box.GetMin( 2 ) );
-
-        for ( i = 0 ; i < 8 ; i++ )
+        int num_chunk = ( num + TRI_TRI_BATCH - 1 ) / TRI_TRI_BATCH;
+        m_Soa = m_SoaBuf;
+        m_Id = m_IdBuf;
+        if ( num_chunk > TRI_BATCH_LOCAL_CHUNKS )
         {
-            m_SBoxVec[i] = new TBndBox();
+            m_SoaVec.resize( num_chunk * CHUNK_SIZE );
+            m_IdVec.resize( num );
+            m_Soa = &m_SoaVec[0];
+            m_Id = &m_IdVec[0];
         }
 
-        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+        for ( int i = 0 ; i < num ; i++ )
         {
-            int cnt = 0;
-            if ( m_TriVec[i]->m_N0->m_Pnt.x() > hx )
-            {
-                cnt += 1;
-            }
-            if ( m_TriVec[i]->m_N0->m_Pnt.y() > hy )
-            {
-                cnt += 2;
-            }
-            if ( m_TriVec[i]->m_N0->m_Pnt.z() > hz )
+            double* chunk = m_Soa + ( i / TRI_TRI_BATCH ) * CHUNK_SIZE;
+            int lane = i % TRI_TRI_BATCH;
+            const TNode* node_arr[3] = { triArr[i]->m_N0, triArr[i]->m_N1, triArr[i]->m_N2 };
+            for ( int k = 0 ; k < 3 ; k++ )
             {
-                cnt += 4;
+                for ( int a = 0 ; a < 3 ; a++ )
+                {
+                    chunk[ ( k * 3 + a ) * TRI_TRI_BATCH + lane ] = node_arr[k]->m_Pnt.v[a];
+                }
             }
-            m_SBoxVec[cnt]->AddTri( m_TriVec[i] );
         }
+    }
 
-        int contSplitFlag = 1;
-
-        for ( i = 0 ; i < 8 ; i++ )
-        {
-            if ( m_TriVec.size() == m_SBoxVec[i]->m_TriVec.size() )
-            {
-                contSplitFlag = 0;
-                break;
-            }
-        }
-        if ( contSplitFlag )
+    //==== Indices Of Tris That May Cross t, In Increasing Order ====//
+    int Survivors( const TTri* t, const int* & idArr )
+    {
+        int num_surv = 0;
+        int survive[ TRI_TRI_BATCH ];
+        for ( int start = 0 ; start < m_Num ; start += TRI_TRI_BATCH )
         {
-            for ( i = 0 ; i < 8 ; i++ )
+            int n = tri_tri_reject_batch( t->m_N0->m_Pnt.v, t->m_N1->m_Pnt.v, t->m_N2->m_Pnt.v,
+                                          m_Soa + ( start / TRI_TRI_BATCH ) * CHUNK_SIZE, TRI_TRI_BATCH,
+                                          min( TRI_TRI_BATCH, m_Num - start ), survive );
+            for ( int s = 0 ; s < n ; s++ )
             {
-                m_SBoxVec[i]->SplitBox();
+                m_Id[ num_surv++ ] = start + survive[s];
             }
         }
-    }
-}
-
-void TBndBox::AddTri( TTri* t )
+        idArr = m_Id;
+        return num_surv;
+    }
+
+protected:
+    static const int CHUNK_SIZE = 9 * TRI_TRI_BATCH;
+
+    int m_Num;
+    double* m_Soa;
+    int* m_Id;
+    double m_SoaBuf[ TRI_BATCH_LOCAL_CHUNKS * CHUNK_SIZE ];
+    int m_IdBuf[ TRI_BATCH_LOCAL_CHUNKS * TRI_TRI_BATCH ];
+    vector< double > m_SoaVec;
+    vector< int > m_IdVec;
+};
+
+//==== Intersect Two Sets of Tris and Store Intersection Edges On Each Tri ====//
+// If isectVec is given the segments are recorded there (in the order they would have been
+// attached) instead of being added to the tris, so nothing is allocated while meshes are
+// intersected concurrently.  Deferred recording is only used for XYZ intersection.
+static void IntersectTris( TTri* const * triArr0, int num0, TTri* const * triArr1, int num1, bool UWFlag,
+                           vector< TISectSeg > * isectVec )
 {
-    m_TriVec.push_back( t );
-    m_Box.Update( t->m_N0->m_Pnt );
-    m_Box.Update( t->m_N1->m_Pnt );
-    m_Box.Update( t->m_N2->m_Pnt );
-}
+    double tol = 1e-6; // was 1e-6
 
-void  TBndBox::AddLeafNodes( vector< TBndBox* > & leafVec )
-{
-    int i;
+    int coplanarFlag;
+    vec3d e0;
+    vec3d e1;
+
+    TriBatchSet batch1( triArr1, num1 );
+
+    for ( int i = 0 ; i < num0 ; i++ )
+    {
+        TTri* t0 = triArr0[i];
+
+        const int* id_arr;
+        int num_surv = batch1.Survivors( t0, id_arr );
+        for ( int s = 0 ; s < num_surv ; s++ )
+        {
+            TTri* t1 = triArr1[ id_arr[s] ];
+
+            int iflag = tri_tri_intersect_with_isectline(
+                            t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
+                            t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
+                            &coplanarFlag, e0.v, e1.v );
+
+            if ( iflag && !coplanarFlag )
+            {
+                if ( UWFlag )
+                {
+                    if ( dist( e0, e1 ) > tol ) // was 1e-6
+                    {
+                        // Figure out with tri has xyz info
+                        TTri* tri;
+                        int d_info = TNode::HAS_XYZ; // desired info number
+                        if ( ( t0->m_N0->GetCoordInfo() & d_info ) == d_info &&  ( t0->m_N1->GetCoordInfo() & d_info ) == d_info
+                                && ( t0->m_N2->GetCoordInfo() & d_info ) == d_info )
+                        {
+                            tri = t0;
+                        }
+                        else
+                        {
+                            tri = t1;
+                        }
+                        // Use Bilinear interpolation to convert edge uw points to xyz points
+                        vec3d e0xyz = tri->CompPnt( e0 );
+                        vec3d e1xyz = tri->CompPnt( e1 );
+
+                        // Create the new edges
+
+                        TEdge* ie0 = t0->NewEdge();
+                        int info = TNode::HAS_UW | TNode::HAS_XYZ;
+                        ie0->m_N0 = t0->NewNode();
+                        ie0->m_N0->SetUWPnt( e0 );
+                        ie0->m_N0->SetXYZPnt( e0xyz );
+                        ie0->m_N0->MakePntUW();
+                        ie0->m_N0->SetCoordInfo( info );
+                        ie0->m_N1 = t0->NewNode();
+                        ie0->m_N1->SetUWPnt( e1 );
+                        ie0->m_N1->SetXYZPnt( e1xyz );
+                        ie0->m_N1->MakePntUW();
+                        ie0->m_N1->SetCoordInfo( info );
+
+                        TEdge* ie1 = t1->NewEdge();
+                        ie1->m_N0 = t1->NewNode();
+                        ie1->m_N0->SetUWPnt( e0 );
+                        ie1->m_N0->SetXYZPnt( e0xyz );
+                        ie1->m_N0->MakePntUW();
+                        ie1->m_N0->SetCoordInfo( info );
+                        ie1->m_N1 = t1->NewNode();
+                        ie1->m_N1->SetUWPnt( e1 );
+                        ie1->m_N1->SetXYZPnt( e1xyz );
+                        ie1->m_N1->MakePntUW();
+                        ie1->m_N1->SetCoordInfo( info );
+
+                        t0->m_ISectEdgeVec.push_back( ie0 );
+                        t1->m_ISectEdgeVec.push_back( ie1 );
+
+                        if ( tri->GetTMeshPtr() )
+                        {
+                            tri->GetTMeshPtr()->SplitAliasEdges( tri, tri->m_ISectEdgeVec.back() );
+                        }
+
+                    }
+                }
+                else
+                {
+                    if ( dist( e0, e1 ) > tol )
+                    {
+                        if ( isectVec )
+                        {
+                            TISectSeg seg;
+                            seg.m_Tri0 = t0;
+                            seg.m_Tri1 = t1;
+                            seg.m_Pnt0 = e0;
+                            seg.m_Pnt1 = e1;
+                            isectVec->push_back( seg );
+                        }
+                        else
+                        {
+                            t0->AddISectEdge( e0, e1 );
+                            t1->AddISectEdge( e0, e1 );
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+//==== Check If Any Tri In One Set Crosses Any Tri In The Other ====//
+static bool CheckIntersectTris( TTri* const * triArr0, int num0, TTri* const * triArr1, int num1 )
+{
+    int coplanarFlag;
+    vec3d e0;
+    vec3d e1;
+
+    TriBatchSet batch1( triArr1, num1 );
+
+    for ( int i = 0 ; i < num0 ; i++ )
+    {
+        TTri* t0 = triArr0[i];
+
+        const int* id_arr;
+        int num_surv = batch1.Survivors( t0, id_arr );
+        for ( int s = 0 ; s < num_surv ; s++ )
+        {
+            TTri* t1 = triArr1[ id_arr[s] ];
+
+            int iflag = tri_tri_intersect_with_isectline(
+                            t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
+                            t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
+                            &coplanarFlag, e0.v, e1.v );
+
+            if ( iflag && !coplanarFlag )
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+//==== Find Min Distance Between Two Sets of Tris ====//
+static double MinDistanceTris( TTri* const * triArr0, int num0, TTri* const * triArr1, int num1, double curr_min_dist )
+{
+    for ( int i = 0 ; i < num0 ; i++ )
+    {
+        TTri* t0 = triArr0[i];
+        for ( int j = 0 ; j < num1 ; j++ )
+        {
+            TTri* t1 = triArr1[j];
+            double d = tri_tri_min_dist( t0->m_N0->m_Pnt, t0->m_N1->m_Pnt, t0->m_N2->m_Pnt,
+                                         t1->m_N0->m_Pnt, t1->m_N1->m_Pnt, t1->m_N2->m_Pnt );
+
+            if ( d < curr_min_dist )
+            {
+                curr_min_dist = d;
+            }
+        }
+    }
+    return curr_min_dist;
+}
+
+//==== Cast Ray Against Set of Tris and Store Positive Hit Parameters ====//
+static void RayCastTris( TTri* const * triArr, int num, const vec3d & orig, const vec3d & dir, vector<double> & tParmVec )
+{
+    double tparm, uparm, vparm;
+
+    for ( int i = 0 ; i < num ; i++ )
+    {
+        TTri* tri = triArr[i];
+        int iFlag = intersect_triangle( const_cast< double* >( orig.v ), const_cast< double* >( dir.v ),
+                                        tri->m_N0->m_Pnt.v, tri->m_N1->m_Pnt.v, tri->m_N2->m_Pnt.v, &tparm, &uparm, &vparm );
+
+        if ( iFlag && tparm > 0.0 )
+        {
+            tParmVec.push_back( tparm );
+        }
+    }
+}
+
+//==== Sort Hit Parameters and Remove Duplicates (Ray Through Shared Edge or Node) ====//
+static void RemoveDupHits( vector<double> & tParmVec )
+{
+    if ( tParmVec.size() < 2 )
+    {
+        return;
+    }
+
+    std::sort( tParmVec.begin(), tParmVec.end() );
+
+    int num_unique = 1;
+    for ( int i = 1 ; i < ( int )tParmVec.size() ; i++ )
+    {
+        if ( tParmVec[i] - tParmVec[num_unique - 1] >= 0.0000001 )
+        {
+            tParmVec[num_unique] = tParmVec[i];
+            num_unique++;
+        }
+    }
+    tParmVec.resize( num_unique );
+}
+
+//==== Intersect Segment With Set of Tris ====//
+static void SegIntersectTris( TTri* const * triArr, int num, vec3d & p0, vec3d & p1, vector< vec3d > & ipntVec )
+{
+    double tparm, uparm, vparm;
+    for ( int t = 0 ; t < num ; t++ )
+    {
+        TTri* tri = triArr[t];
+        vec3d n0pnt  = tri->m_N0->m_Pnt;
+        vec3d n10pnt = tri->m_N1->m_Pnt - tri->m_N0->m_Pnt;
+        vec3d n20pnt = tri->m_N2->m_Pnt - tri->m_N0->m_Pnt;
+        vec3d p10    = p1 - p0;
+        if ( tri_seg_intersect( n0pnt,  n10pnt, n20pnt,
+                                p0, p10, uparm, vparm, tparm ) )
+        {
+            vec3d pnt = p0 + ( p1 - p0 ) * tparm;
+            ipntVec.push_back( pnt );
+        }
+    }
+}
+
+//==== Should Dual Traversal Descend Into First Node (Else Second) ====//
+static bool DescendFirst( const TBvhNode & n0, const TBvhNode & n1 )
+{
+    if ( n0.IsLeaf() )
+    {
+        return false;
+    }
+    if ( n1.IsLeaf() )
+    {
+        return true;
+    }
+    return BoxSurfArea( n0.m_Box ) >= BoxSurfArea( n1.m_Box );
+}
+
+TBndBox::TBndBox()
+{
+    for ( int i = 0 ; i < 8 ; i++ )
+    {
+        m_SBoxVec[i] = 0;
+    }
+}
+
+TBndBox::~TBndBox()
+{
+    for ( int i = 0 ; i < 8 ; i++ )
+    {
+        delete m_SBoxVec[i];
+    }
+}
+
+void TBndBox::Reset()
+{
+    for ( int i = 0 ; i < 8 ; i++ )
+    {
+        delete m_SBoxVec[i];
+        m_SBoxVec[i] = 0;
+    }
+
+    m_BvhNodeVec.clear();
+    m_Box.Reset();
+    m_TriVec.clear();
+}
+
+size_t TBndBox::MemoryUsage() const
+{
+    size_t bytes = vector_mem_bytes( m_TriVec ) + vector_mem_bytes( m_BvhNodeVec );
+    for ( int i = 0 ; i < 8 ; i++ )
+    {
+        if ( m_SBoxVec[i] )
+        {
+            bytes += sizeof( TBndBox ) + m_SBoxVec[i]->MemoryUsage();
+        }
+    }
+    return bytes;
+}
+
+#ifdef VSP_TMESH_OCTREE
+
+//==== Create Oct Tree of Overlaping BndBoxes ====//
+void TBndBox::SplitBox()
+{
+    int i;
+    if ( m_TriVec.size() > 32 )
+    {
+        //==== Find Split Points ====//
+        double hx = 0.5 * ( m_Box.GetMax( 0 ) + m_Box.GetMin( 0 ) );
+        double hy = 0.5 * ( m_Box.GetMax( 1 ) + m_Box.GetMin( 1 ) );
+        double hz = 0.5 * ( m_Box.GetMax( 2 ) + m_Box.GetMin( 2 ) );
+
+        for ( i = 0 ; i < 8 ; i++ )
+        {
+            m_SBoxVec[i] = new TBndBox();
+        }
+
+        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+        {
+            int cnt = 0;
+            if ( m_TriVec[i]->m_N0->m_Pnt.x() > hx )
+            {
+                cnt += 1;
+            }
+            if ( m_TriVec[i]->m_N0->m_Pnt.y() > hy )
+            {
+                cnt += 2;
+            }
+            if ( m_TriVec[i]->m_N0->m_Pnt.z() > hz )
+            {
+                cnt += 4;
+            }
+            m_SBoxVec[cnt]->AddTri( m_TriVec[i] );
+        }
+
+        int contSplitFlag = 1;
+
+        for ( i = 0 ; i < 8 ; i++ )
+        {
+            if ( m_TriVec.size() == m_SBoxVec[i]->m_TriVec.size() )
+            {
+                contSplitFlag = 0;
+                break;
+            }
+        }
+        if ( contSplitFlag )
+        {
+            for ( i = 0 ; i < 8 ; i++ )
+            {
+                m_SBoxVec[i]->SplitBox();
+            }
+        }
+    }
+}
+
+#else
+
+//==== Create Flattened BVH ====//
+void TBndBox::SplitBox()
+{
+    BuildBvh();
+}
+
+#endif
+
+//==== Build BVH Using Binned Surface Area Heuristic On Tri Centroids ====//
+void TBndBox::BuildBvh()
+{
+    m_BvhNodeVec.clear();
+
+    int num_tris = ( int )m_TriVec.size();
+    if ( num_tris == 0 )
+    {
+        return;
+    }
+
+    vector< BndBox > tri_box_vec( num_tris );
+    vector< vec3d > cen_vec( num_tris );
+    vector< int > index_vec( num_tris );
+
+    for ( int i = 0 ; i < num_tris ; i++ )
+    {
+        TTri* t = m_TriVec[i];
+        tri_box_vec[i].Update( t->m_N0->m_Pnt );
+        tri_box_vec[i].Update( t->m_N1->m_Pnt );
+        tri_box_vec[i].Update( t->m_N2->m_Pnt );
+        cen_vec[i] = tri_box_vec[i].GetCenter();
+        index_vec[i] = i;
+    }
+
+    m_BvhNodeVec.reserve( 2 * ( num_tris / BVH_MAX_LEAF_TRIS + 1 ) );
+    m_BvhNodeVec.push_back( TBvhNode() );
+
+    // Pending nodes to build: node index, start and end of tri range
+    struct BuildTask
+    {
+        int m_Node;
+        int m_Start;
+        int m_End;
+    };
+
+    vector< BuildTask > task_stack;
+    BuildTask root = { 0, 0, num_tris };
+    task_stack.push_back( root );
+
+    int bin_cnt[BVH_NUM_BINS];
+    BndBox bin_box[BVH_NUM_BINS];
+    double right_area[BVH_NUM_BINS];
+    int right_cnt[BVH_NUM_BINS];
+
+    while ( !task_stack.empty() )
+    {
+        BuildTask task = task_stack.back();
+        task_stack.pop_back();
+
+        int num = task.m_End - task.m_Start;
+
+        BndBox node_box, cen_box;
+        for ( int i = task.m_Start ; i < task.m_End ; i++ )
+        {
+            node_box.Update( tri_box_vec[ index_vec[i] ] );
+            cen_box.Update( cen_vec[ index_vec[i] ] );
+        }
+        m_BvhNodeVec[ task.m_Node ].m_Box = node_box;
+
+        //==== Find Lowest Cost Split Along Axis of Largest Centroid Spread ====//
+        int axis = 0;
+        for ( int i = 1 ; i < 3 ; i++ )
+        {
+            if ( cen_box.GetMax( i ) - cen_box.GetMin( i ) > cen_box.GetMax( axis ) - cen_box.GetMin( axis ) )
+            {
+                axis = i;
+            }
+        }
+
+        double cmin = cen_box.GetMin( axis );
+        double extent = cen_box.GetMax( axis ) - cmin;
+        double scale = extent > 0.0 ? BVH_NUM_BINS / extent : 0.0;
+
+        int best_split = -1;
+        double best_cost = num * BoxSurfArea( node_box );
+
+        if ( num > 1 && extent > 0.0 )
+        {
+            for ( int b = 0 ; b < BVH_NUM_BINS ; b++ )
+            {
+                bin_cnt[b] = 0;
+                bin_box[b].Reset();
+            }
+
+            for ( int i = task.m_Start ; i < task.m_End ; i++ )
+            {
+                int id = index_vec[i];
+                int b = min( ( int )( ( cen_vec[id].v[axis] - cmin ) * scale ), BVH_NUM_BINS - 1 );
+                bin_cnt[b]++;
+                bin_box[b].Update( tri_box_vec[id] );
+            }
+
+            //==== Sweep From Right To Accumulate Right Side Area and Count ====//
+            BndBox acc_box;
+            int acc_cnt = 0;
+            for ( int b = BVH_NUM_BINS - 1 ; b > 0 ; b-- )
+            {
+                if ( bin_cnt[b] )
+                {
+                    acc_box.Update( bin_box[b] );
+                    acc_cnt += bin_cnt[b];
+                }
+                right_cnt[b] = acc_cnt;
+                right_area[b] = acc_cnt ? BoxSurfArea( acc_box ) : 0.0;
+            }
+
+            //==== Sweep From Left and Evaluate Each Split Plane ====//
+            acc_box.Reset();
+            acc_cnt = 0;
+            for ( int b = 1 ; b < BVH_NUM_BINS ; b++ )
+            {
+                if ( bin_cnt[b - 1] )
+                {
+                    acc_box.Update( bin_box[b - 1] );
+                    acc_cnt += bin_cnt[b - 1];
+                }
+
+                if ( acc_cnt == 0 || right_cnt[b] == 0 )
+                {
+                    continue;
+                }
+
+                double cost = acc_cnt * BoxSurfArea( acc_box ) + right_cnt[b] * right_area[b];
+                if ( cost < best_cost )
+                {
+                    best_cost = cost;
+                    best_split = b;
+                }
+            }
+        }
+
+        //==== Make Leaf If Splitting Does Not Pay Off ====//
+        if ( best_split < 0 && num <= BVH_MAX_LEAF_TRIS )
+        {
+            m_BvhNodeVec[ task.m_Node ].m_Offset = task.m_Start;
+            m_BvhNodeVec[ task.m_Node ].m_NumTris = num;
+            continue;
+        }
+
+        int mid;
+        if ( best_split >= 0 )
+        {
+            int* split_ptr = std::partition( &index_vec[task.m_Start], &index_vec[0] + task.m_End,
+                                             BvhBinPred( cen_vec, axis, cmin, scale, best_split ) );
+            mid = ( int )( split_ptr - &index_vec[0] );
+        }
+        else
+        {
+            //==== Too Many Tris For Leaf and No Useful Plane - Split By Count ====//
+            mid = task.m_Start + num / 2;
+        }
+
+        int child = ( int )m_BvhNodeVec.size();
+        m_BvhNodeVec.push_back( TBvhNode() );
+        m_BvhNodeVec.push_back( TBvhNode() );
+        m_BvhNodeVec[ task.m_Node ].m_Offset = child;
+        m_BvhNodeVec[ task.m_Node ].m_NumTris = 0;
+
+        BuildTask right_task = { child + 1, mid, task.m_End };
+        BuildTask left_task = { child, task.m_Start, mid };
+        task_stack.push_back( right_task );
+        task_stack.push_back( left_task );
+    }
+
+    //==== Reorder Tris So Each Leaf Owns A Contiguous Range ====//
+    vector< TTri* > sorted_vec( num_tris );
+    for ( int i = 0 ; i < num_tris ; i++ )
+    {
+        sorted_vec[i] = m_TriVec[ index_vec[i] ];
+    }
+    m_TriVec.swap( sorted_vec );
+}
+
+void TBndBox::AddTri( TTri* t )
+{
+    m_TriVec.push_back( t );
+    m_Box.Update( t->m_N0->m_Pnt );
+    m_Box.Update( t->m_N1->m_Pnt );
+    m_Box.Update( t->m_N2->m_Pnt );
+}
+
+void TBndBox::Intersect( TBndBox* iBox, bool UWFlag )
+{
+    IntersectBoxes( iBox, UWFlag, NULL );
+}
+
+void TBndBox::Intersect( TBndBox* iBox, vector< TISectSeg > & isectVec )
+{
+    IntersectBoxes( iBox, false, &isectVec );
+}
+
+#ifdef VSP_TMESH_OCTREE
+
+void  TBndBox::AddLeafNodes( vector< TBndBox* > & leafVec )
+{
+    int i;
 
     if ( m_SBoxVec[0] )     // Keep Moving Down
     {
@@ -2339,7 +3560,7 @@ void  TBndBox::AddLeafNodes( vector< TBndBox* > & leafVec )
 
 bool TBndBox::CheckIntersect( TBndBox* iBox  )
 {
-    int i, j;
+    int i;
 
     //==== Compare Bounding Boxes ====//
     if ( !Compare( m_Box, iBox->m_Box ) )
@@ -2366,34 +3587,15 @@ bool TBndBox::CheckIntersect( TBndBox* iBox  )
     }
     else
     {
-        int coplanarFlag;
-        vec3d e0;
-        vec3d e1;
-
         //==== Check All Tris In One Box Against The Other ====//
-        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
-        {
-            TTri* t0 = m_TriVec[i];
-            for ( j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
-            {
-                TTri* t1 = iBox->m_TriVec[j];
-
-                int iflag = tri_tri_intersect_with_isectline(
-                                t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
-                                t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
-                                &coplanarFlag, e0.v, e1.v );
-
-                if ( iflag && !coplanarFlag )
-                    return true;
-            }
-        }
+        return CheckIntersectTris( m_TriVec.data(), ( int )m_TriVec.size(), iBox->m_TriVec.data(), ( int )iBox->m_TriVec.size() );
     }
     return false;
 }
 
 double TBndBox::MinDistance( TBndBox* iBox, double curr_min_dist )
 {
-    int i, j;
+    int i;
 
     //==== Compare Bounding Boxes ====//
     if ( !Compare( m_Box, iBox->m_Box, curr_min_dist ) )
@@ -2419,33 +3621,85 @@ double TBndBox::MinDistance( TBndBox* iBox, double curr_min_dist )
     //==== Check All Points Against Other Points ====//
     else
     {
-        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+        curr_min_dist = MinDistanceTris( m_TriVec.data(), ( int )m_TriVec.size(), iBox->m_TriVec.data(), ( int )iBox->m_TriVec.size(), curr_min_dist );
+    }
+
+    return curr_min_dist;
+}
+
+
+void TBndBox::IntersectBoxes( TBndBox* iBox, bool UWFlag, vector< TISectSeg > * isectVec )
+{
+    int i;
+
+    if ( !Compare( m_Box, iBox->m_Box ) )
+    {
+        return;
+    }
+
+    if ( m_SBoxVec[0] )
+    {
+        for ( i = 0 ; i < 8 ; i++ )
         {
-            TTri* t0 = m_TriVec[i];
-            for ( j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
-            {
+            iBox->IntersectBoxes( m_SBoxVec[i], UWFlag, isectVec );
+        }
+    }
+    else if ( iBox->m_SBoxVec[0] )
+    {
+        for ( i = 0 ; i < 8 ; i++ )
+        {
+            iBox->m_SBoxVec[i]->IntersectBoxes( this, UWFlag, isectVec );
+        }
+    }
+    else
+    {
+        IntersectTris( m_TriVec.data(), ( int )m_TriVec.size(), iBox->m_TriVec.data(), ( int )iBox->m_TriVec.size(), UWFlag, isectVec );
+    }
+}
 
-                TTri* t1 = iBox->m_TriVec[j];
-                double d = tri_tri_min_dist( t0->m_N0->m_Pnt, t0->m_N1->m_Pnt, t0->m_N2->m_Pnt,
-                                             t1->m_N0->m_Pnt, t1->m_N1->m_Pnt, t1->m_N2->m_Pnt);
+void  TBndBox::NumCrossXRay( vec3d & orig, vector<double> & tParmVec )
+{
+    int i;
 
-                if ( d < curr_min_dist )
-                    curr_min_dist = d;
-            }
+    if ( orig.y() < m_Box.GetMin( 1 ) )
+    {
+        return;
+    }
+    if ( orig.y() > m_Box.GetMax( 1 ) )
+    {
+        return;
+    }
+    if ( orig.z() < m_Box.GetMin( 2 ) )
+    {
+        return;
+    }
+    if ( orig.z() > m_Box.GetMax( 2 ) )
+    {
+        return;
+    }
+
+    if ( m_SBoxVec[0] )
+    {
+        for ( i = 0 ; i < 8 ; i++ )
+        {
+            m_SBoxVec[i]->NumCrossXRay( orig, tParmVec );
         }
+        return;
     }
 
-    return curr_min_dist;
+    //==== Check All Tris In Box ====//
+    vec3d dir( 1.0, 0.0, 0.0 );
+    RayCastTris( m_TriVec.data(), ( int )m_TriVec.size(), orig, dir, tParmVec );
+    RemoveDupHits( tParmVec );
 }
 
-
-void TBndBox::Intersect( TBndBox* iBox, bool UWFlag )
+void  TBndBox::RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec )
 {
     int i;
 
-    double tol = 1e-6; // was 1e-6
+    double coord[3];
 
-    if ( !Compare( m_Box, iBox->m_Box ) )
+    if( !intersectRayAABB( m_Box.GetMin().v, m_Box.GetMax().v, orig.v, dir.v, coord ) )
     {
         return;
     }
@@ -2454,280 +3708,390 @@ void TBndBox::Intersect( TBndBox* iBox, bool UWFlag )
     {
         for ( i = 0 ; i < 8 ; i++ )
         {
-            iBox->Intersect( m_SBoxVec[i], UWFlag );
+            m_SBoxVec[i]->RayCast( orig, dir, tParmVec );
+        }
+        return;
+    }
+
+    //==== Check All Tris In Box ====//
+    RayCastTris( m_TriVec.data(), ( int )m_TriVec.size(), orig, dir, tParmVec );
+    RemoveDupHits( tParmVec );
+}
+
+void TBndBox::RayCastPacket( const vec3d* origArr, const bool* activeArr, int num, const vec3d & dir, vector<double>* tParmVecArr )
+{
+    for ( int k = 0 ; k < num ; k++ )
+    {
+        tParmVecArr[k].clear();
+        if ( activeArr[k] )
+        {
+            vec3d orig = origArr[k];
+            vec3d d = dir;
+            RayCast( orig, d, tParmVecArr[k] );
+        }
+    }
+}
+
+void TBndBox::SegIntersect( vec3d & p0, vec3d & p1, vector< vec3d > & ipntVec )
+{
+    int i;
+
+    if ( !m_Box.CheckPnt( p0.x(), p0.y(), p0.z() ) && !m_Box.CheckPnt( p1.x(), p1.y(), p1.z() ) )
+    {
+        return;
+    }
+
+    if ( m_SBoxVec[0] )
+    {
+        for ( i = 0 ; i < 8 ; i++ )
+        {
+            m_SBoxVec[i]->SegIntersect( p0, p1, ipntVec );
+        }
+        return;
+    }
+
+    //==== Check All Tris In Box ====//
+    SegIntersectTris( m_TriVec.data(), ( int )m_TriVec.size(), p0, p1, ipntVec );
+}
+
+#else
+
+//==== BVH Has No Child TBndBoxes - The Whole Box Is The Only Leaf ====//
+void  TBndBox::AddLeafNodes( vector< TBndBox* > & leafVec )
+{
+    leafVec.push_back( this );
+}
+
+bool TBndBox::CheckIntersect( TBndBox* iBox  )
+{
+    if ( m_BvhNodeVec.empty() || iBox->m_BvhNodeVec.empty() )
+    {
+        return false;
+    }
+
+    vector< pair< int, int > > stack;
+    stack.push_back( make_pair( 0, 0 ) );
+
+    while ( !stack.empty() )
+    {
+        int a = stack.back().first;
+        int b = stack.back().second;
+        stack.pop_back();
+
+        const TBvhNode & na = m_BvhNodeVec[a];
+        const TBvhNode & nb = iBox->m_BvhNodeVec[b];
+
+        if ( !Compare( na.m_Box, nb.m_Box ) )
+        {
+            continue;
+        }
+
+        if ( na.IsLeaf() && nb.IsLeaf() )
+        {
+            if ( CheckIntersectTris( &m_TriVec[ na.m_Offset ], na.m_NumTris, &iBox->m_TriVec[ nb.m_Offset ], nb.m_NumTris ) )
+            {
+                return true;
+            }
+        }
+        else if ( DescendFirst( na, nb ) )
+        {
+            stack.push_back( make_pair( na.m_Offset + 1, b ) );
+            stack.push_back( make_pair( na.m_Offset, b ) );
+        }
+        else
+        {
+            stack.push_back( make_pair( a, nb.m_Offset + 1 ) );
+            stack.push_back( make_pair( a, nb.m_Offset ) );
+        }
+    }
+    return false;
+}
+
+double TBndBox::MinDistance( TBndBox* iBox, double curr_min_dist )
+{
+    if ( m_BvhNodeVec.empty() || iBox->m_BvhNodeVec.empty() )
+    {
+        return curr_min_dist;
+    }
+
+    vector< pair< int, int > > stack;
+    stack.push_back( make_pair( 0, 0 ) );
+
+    while ( !stack.empty() )
+    {
+        int a = stack.back().first;
+        int b = stack.back().second;
+        stack.pop_back();
+
+        const TBvhNode & na = m_BvhNodeVec[a];
+        const TBvhNode & nb = iBox->m_BvhNodeVec[b];
+
+        //==== Skip Pairs Farther Apart Than Current Min ====//
+        if ( !Compare( na.m_Box, nb.m_Box, curr_min_dist ) )
+        {
+            continue;
+        }
+
+        if ( na.IsLeaf() && nb.IsLeaf() )
+        {
+            curr_min_dist = MinDistanceTris( &m_TriVec[ na.m_Offset ], na.m_NumTris, &iBox->m_TriVec[ nb.m_Offset ], nb.m_NumTris, curr_min_dist );
+        }
+        else if ( DescendFirst( na, nb ) )
+        {
+            stack.push_back( make_pair( na.m_Offset + 1, b ) );
+            stack.push_back( make_pair( na.m_Offset, b ) );
         }
-    }
-    else if ( iBox->m_SBoxVec[0] )
-    {
-        for ( i = 0 ; i < 8 ; i++ )
+        else
         {
-            iBox->m_SBoxVec[i]->Intersect( this, UWFlag );
+            stack.push_back( make_pair( a, nb.m_Offset + 1 ) );
+            stack.push_back( make_pair( a, nb.m_Offset ) );
         }
     }
-    else
-    {
-        int coplanarFlag;
-        vec3d e0;
-        vec3d e1;
 
-        int iCnt = 0;
-
-        for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
-        {
-            TTri* t0 = m_TriVec[i];
-            for ( int j = 0 ; j < ( int )iBox->m_TriVec.size() ; j++ )
-            {
-                TTri* t1 = iBox->m_TriVec[j];
+    return curr_min_dist;
+}
 
-                int iflag = tri_tri_intersect_with_isectline(
-                                t0->m_N0->m_Pnt.v, t0->m_N1->m_Pnt.v, t0->m_N2->m_Pnt.v,
-                                t1->m_N0->m_Pnt.v, t1->m_N1->m_Pnt.v, t1->m_N2->m_Pnt.v,
-                                &coplanarFlag, e0.v, e1.v );
+void TBndBox::IntersectBoxes( TBndBox* iBox, bool UWFlag, vector< TISectSeg > * isectVec )
+{
+    if ( m_BvhNodeVec.empty() || iBox->m_BvhNodeVec.empty() )
+    {
+        return;
+    }
 
-                iCnt += iflag;
-                if ( iflag && !coplanarFlag )
-                {
-                    if ( UWFlag )
-                    {
-                        if ( dist( e0, e1 ) > tol ) // was 1e-6
-                        {
-                            // Figure out with tri has xyz info
-                            TTri* tri;
-                            int d_info = TNode::HAS_XYZ; // desired info number
-                            if ( ( t0->m_N0->GetCoordInfo() & d_info ) == d_info &&  ( t0->m_N1->GetCoordInfo() & d_info ) == d_info
-                                    && ( t0->m_N2->GetCoordInfo() & d_info ) == d_info )
-                            {
-                                tri = t0;
-                            }
-                            else
-                            {
-                                tri = t1;
-                            }
-                            // Use Bilinear interpolation to convert edge uw points to xyz points
-                            vec3d e0xyz = tri->CompPnt( e0 );
-                            vec3d e1xyz = tri->CompPnt( e1 );
-
-                            // Create the new edges
-
-                            TEdge* ie0 = new TEdge();
-                            int info = TNode::HAS_UW | TNode::HAS_XYZ;
-                            ie0->m_N0 = new TNode();
-                            ie0->m_N0->SetUWPnt( e0 );
-                            ie0->m_N0->SetXYZPnt( e0xyz );
-                            ie0->m_N0->MakePntUW();
-                            ie0->m_N0->SetCoordInfo( info );
-                            ie0->m_N1 = new TNode();
-                            ie0->m_N1->SetUWPnt( e1 );
-                            ie0->m_N1->SetXYZPnt( e1xyz );
-                            ie0->m_N1->MakePntUW();
-                            ie0->m_N1->SetCoordInfo( info );
-
-                            TEdge* ie1 = new TEdge();
-                            ie1->m_N0 = new TNode();
-                            ie1->m_N0->SetUWPnt( e0 );
-                            ie1->m_N0->SetXYZPnt( e0xyz );
-                            ie1->m_N0->MakePntUW();
-                            ie1->m_N0->SetCoordInfo( info );
-                            ie1->m_N1 = new TNode();
-                            ie1->m_N1->SetUWPnt( e1 );
-                            ie1->m_N1->SetXYZPnt( e1xyz );
-                            ie1->m_N1->MakePntUW();
-                            ie1->m_N1->SetCoordInfo( info );
-
-                            t0->m_ISectEdgeVec.push_back( ie0 );
-                            t1->m_ISectEdgeVec.push_back( ie1 );
-
-                            if ( tri->GetTMeshPtr() )
-                            {
-                                tri->GetTMeshPtr()->SplitAliasEdges( tri, tri->m_ISectEdgeVec.back() );
-                            }
+    vector< pair< int, int > > stack;
+    stack.push_back( make_pair( 0, 0 ) );
 
-                        }
-                    }
-                    else
-                    {
-                        TEdge* ie0 = new TEdge();
-                        ie0->m_N0 = new TNode();
-                        ie0->m_N0->m_Pnt = e0;
-                        ie0->m_N1 = new TNode();
-                        ie0->m_N1->m_Pnt = e1;
+    while ( !stack.empty() )
+    {
+        int a = stack.back().first;
+        int b = stack.back().second;
+        stack.pop_back();
 
-                        TEdge* ie1 = new TEdge();
-                        ie1->m_N0 = new TNode();
-                        ie1->m_N0->m_Pnt = e0;
-                        ie1->m_N1 = new TNode();
-                        ie1->m_N1->m_Pnt = e1;
+        const TBvhNode & na = m_BvhNodeVec[a];
+        const TBvhNode & nb = iBox->m_BvhNodeVec[b];
 
+        if ( !Compare( na.m_Box, nb.m_Box ) )
+        {
+            continue;
+        }
 
-                        if ( dist( e0, e1 ) > tol )
-                        {
-                            t0->m_ISectEdgeVec.push_back( ie0 );
-                            t1->m_ISectEdgeVec.push_back( ie1 );
-                        }
-                        else
-                        {
-                            delete ie0->m_N0;
-                            delete ie0->m_N1;
-                            delete ie1->m_N0;
-                            delete ie1->m_N1;
-                            delete ie0;
-                            delete ie1;
-                        }
-                    }
-                }
-            }
+        if ( na.IsLeaf() && nb.IsLeaf() )
+        {
+            IntersectTris( &m_TriVec[ na.m_Offset ], na.m_NumTris, &iBox->m_TriVec[ nb.m_Offset ], nb.m_NumTris, UWFlag, isectVec );
+        }
+        else if ( DescendFirst( na, nb ) )
+        {
+            stack.push_back( make_pair( na.m_Offset + 1, b ) );
+            stack.push_back( make_pair( na.m_Offset, b ) );
+        }
+        else
+        {
+            stack.push_back( make_pair( a, nb.m_Offset + 1 ) );
+            stack.push_back( make_pair( a, nb.m_Offset ) );
         }
     }
 }
+
 void  TBndBox::NumCrossXRay( vec3d & orig, vector<double> & tParmVec )
 {
-    int i;
-
-    if ( orig.y() < m_Box.GetMin( 1 ) )
-    {
-        return;
-    }
-    if ( orig.y() > m_Box.GetMax( 1 ) )
-    {
-        return;
-    }
-    if ( orig.z() < m_Box.GetMin( 2 ) )
-    {
-        return;
-    }
-    if ( orig.z() > m_Box.GetMax( 2 ) )
+    if ( m_BvhNodeVec.empty() )
     {
         return;
     }
 
-    if ( m_SBoxVec[0] )
+    vec3d dir( 1.0, 0.0, 0.0 );
+
+    vector< int > stack;
+    stack.push_back( 0 );
+
+    while ( !stack.empty() )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        const TBvhNode & node = m_BvhNodeVec[ stack.back() ];
+        stack.pop_back();
+
+        if ( orig.y() < node.m_Box.GetMin( 1 ) || orig.y() > node.m_Box.GetMax( 1 ) ||
+             orig.z() < node.m_Box.GetMin( 2 ) || orig.z() > node.m_Box.GetMax( 2 ) )
         {
-            m_SBoxVec[i]->NumCrossXRay( orig, tParmVec );
+            continue;
+        }
+
+        if ( node.IsLeaf() )
+        {
+            RayCastTris( &m_TriVec[ node.m_Offset ], node.m_NumTris, orig, dir, tParmVec );
         }
+        else
+        {
+            stack.push_back( node.m_Offset + 1 );
+            stack.push_back( node.m_Offset );
+        }
+    }
+
+    RemoveDupHits( tParmVec );
+}
+
+void  TBndBox::RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec )
+{
+    if ( m_BvhNodeVec.empty() )
+    {
         return;
     }
 
-    //==== Check All Tris In Box ====//
-    double tparm, uparm, vparm;
-    vec3d dir( 1.0, 0.0, 0.0 );
-    for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+    double coord[3];
+
+    vector< int > stack;
+    stack.push_back( 0 );
+
+    while ( !stack.empty() )
     {
-        TTri* tri = m_TriVec[i];
-        int iFlag = intersect_triangle( orig.v, dir.v,
-                                        tri->m_N0->m_Pnt.v, tri->m_N1->m_Pnt.v, tri->m_N2->m_Pnt.v, &tparm, &uparm, &vparm );
+        const TBvhNode & node = m_BvhNodeVec[ stack.back() ];
+        stack.pop_back();
 
-        if ( iFlag && tparm > 0.0 )
+        if( !intersectRayAABB( node.m_Box.GetMin().v, node.m_Box.GetMax().v, orig.v, dir.v, coord ) )
         {
-            //==== Find If T is Already Included ====//
-            int dupFlag = 0;
-            for ( int j = 0 ; j < ( int )tParmVec.size() ; j++ )
-            {
-                if ( std::abs( tparm - tParmVec[j] ) < 0.0000001 )
-                {
-                    dupFlag = 1;
-                    break;
-                }
-            }
+            continue;
+        }
 
-            if ( !dupFlag )
-            {
-                tParmVec.push_back( tparm );
-            }
+        if ( node.IsLeaf() )
+        {
+            RayCastTris( &m_TriVec[ node.m_Offset ], node.m_NumTris, orig, dir, tParmVec );
+        }
+        else
+        {
+            stack.push_back( node.m_Offset + 1 );
+            stack.push_back( node.m_Offset );
         }
     }
 
+    RemoveDupHits( tParmVec );
 }
 
-void  TBndBox::RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec )
+//==== Cast Packet of Rays With Common Direction In One Traversal ====//
+// Box tests are done for every ray of the packet at once on structure-of-arrays origins so the
+// slab test vectorizes.  Only rays flagged in activeArr are traced; each gets its own sorted,
+// de-duplicated list of hit parameters in tParmVecArr.
+void TBndBox::RayCastPacket( const vec3d* origArr, const bool* activeArr, int num, const vec3d & dir, vector<double>* tParmVecArr )
 {
-    int i;
-
-    double coord[3];
+    for ( int k = 0 ; k < num ; k++ )
+    {
+        tParmVecArr[k].clear();
+    }
 
-    if( !intersectRayAABB( m_Box.GetMin().v, m_Box.GetMax().v, orig.v, dir.v, coord ) )
+    if ( m_BvhNodeVec.empty() )
     {
         return;
     }
 
-    if ( m_SBoxVec[0] )
+    double ox[RAY_PACKET_SIZE], oy[RAY_PACKET_SIZE], oz[RAY_PACKET_SIZE];
+    double active[RAY_PACKET_SIZE];
+    for ( int k = 0 ; k < RAY_PACKET_SIZE ; k++ )
     {
-        for ( i = 0 ; i < 8 ; i++ )
-        {
-            m_SBoxVec[i]->RayCast( orig, dir, tParmVec );
-        }
-        return;
+        bool on = k < num && activeArr[k];
+        ox[k] = on ? origArr[k].x() : 0.0;
+        oy[k] = on ? origArr[k].y() : 0.0;
+        oz[k] = on ? origArr[k].z() : 0.0;
+        active[k] = on ? 1.0 : 0.0;
     }
 
-    //==== Check All Tris In Box ====//
-    double tparm, uparm, vparm;
+    double inv[3];
+    for ( int i = 0 ; i < 3 ; i++ )
+    {
+        inv[i] = dir[i] != 0.0 ? 1.0 / dir[i] : 1.0e300;
+    }
 
-    for ( i = 0 ; i < ( int )m_TriVec.size() ; i++ )
+    bool hit[RAY_PACKET_SIZE];
+
+    vector< int > stack;
+    stack.push_back( 0 );
+
+    while ( !stack.empty() )
     {
-        TTri* tri = m_TriVec[i];
-        int iFlag = intersect_triangle( orig.v, dir.v,
-                                        tri->m_N0->m_Pnt.v, tri->m_N1->m_Pnt.v, tri->m_N2->m_Pnt.v, &tparm, &uparm, &vparm );
+        const TBvhNode & node = m_BvhNodeVec[ stack.back() ];
+        stack.pop_back();
 
-        if ( iFlag && tparm > 0.0 )
+        const double bmin0 = node.m_Box.GetMin( 0 ), bmax0 = node.m_Box.GetMax( 0 );
+        const double bmin1 = node.m_Box.GetMin( 1 ), bmax1 = node.m_Box.GetMax( 1 );
+        const double bmin2 = node.m_Box.GetMin( 2 ), bmax2 = node.m_Box.GetMax( 2 );
+
+        //==== Slab Test All Rays Against Node Box ====//
+        int any_hit = 0;
+        for ( int k = 0 ; k < RAY_PACKET_SIZE ; k++ )
+        {
+            double tx0 = ( bmin0 - ox[k] ) * inv[0];
+            double tx1 = ( bmax0 - ox[k] ) * inv[0];
+            double ty0 = ( bmin1 - oy[k] ) * inv[1];
+            double ty1 = ( bmax1 - oy[k] ) * inv[1];
+            double tz0 = ( bmin2 - oz[k] ) * inv[2];
+            double tz1 = ( bmax2 - oz[k] ) * inv[2];
+
+            double tnear = max( max( min( tx0, tx1 ), min( ty0, ty1 ) ), min( tz0, tz1 ) );
+            double tfar = min( min( max( tx0, tx1 ), max( ty0, ty1 ) ), max( tz0, tz1 ) );
+
+            hit[k] = ( active[k] > 0.0 ) && ( tfar >= tnear ) && ( tfar >= 0.0 );
+            any_hit += hit[k];
+        }
+
+        if ( !any_hit )
         {
-            //==== Find If T is Already Included ====//
-            int dupFlag = 0;
-            for ( int j = 0 ; j < ( int )tParmVec.size() ; j++ )
+            continue;
+        }
+
+        if ( node.IsLeaf() )
+        {
+            for ( int k = 0 ; k < num ; k++ )
             {
-                if ( std::abs( tparm - tParmVec[j] ) < 0.0000001 )
+                if ( hit[k] )
                 {
-                    dupFlag = 1;
-                    break;
+                    RayCastTris( &m_TriVec[ node.m_Offset ], node.m_NumTris, origArr[k], dir, tParmVecArr[k] );
                 }
             }
-
-            if ( !dupFlag )
-            {
-                tParmVec.push_back( tparm );
-            }
+        }
+        else
+        {
+            stack.push_back( node.m_Offset + 1 );
+            stack.push_back( node.m_Offset );
         }
     }
 
+    for ( int k = 0 ; k < num ; k++ )
+    {
+        RemoveDupHits( tParmVecArr[k] );
+    }
 }
 
 void TBndBox::SegIntersect( vec3d & p0, vec3d & p1, vector< vec3d > & ipntVec )
 {
-    int i, t;
-
-    if ( !m_Box.CheckPnt( p0.x(), p0.y(), p0.z() ) && !m_Box.CheckPnt( p1.x(), p1.y(), p1.z() ) )
+    if ( m_BvhNodeVec.empty() )
     {
         return;
     }
 
-    if ( m_SBoxVec[0] )
+    vector< int > stack;
+    stack.push_back( 0 );
+
+    while ( !stack.empty() )
     {
-        for ( i = 0 ; i < 8 ; i++ )
+        const TBvhNode & node = m_BvhNodeVec[ stack.back() ];
+        stack.pop_back();
+
+        if ( !node.m_Box.CheckPnt( p0.x(), p0.y(), p0.z() ) && !node.m_Box.CheckPnt( p1.x(), p1.y(), p1.z() ) )
         {
-            m_SBoxVec[i]->SegIntersect( p0, p1, ipntVec );
+            continue;
         }
-        return;
-    }
 
-    //==== Check All Tris In Box ====//
-    double tparm, uparm, vparm;
-    for ( t = 0 ; t < ( int )m_TriVec.size() ; t++ )
-    {
-        TTri* tri = m_TriVec[t];
-        vec3d n0pnt  = tri->m_N0->m_Pnt;
-        vec3d n10pnt = tri->m_N1->m_Pnt - tri->m_N0->m_Pnt;
-        vec3d n20pnt = tri->m_N2->m_Pnt - tri->m_N0->m_Pnt;
-        vec3d p10    = p1 - p0;
-        if ( tri_seg_intersect( n0pnt,  n10pnt, n20pnt,
-                                p0, p10, uparm, vparm, tparm ) )
+        if ( node.IsLeaf() )
         {
-            vec3d pnt = p0 + ( p1 - p0 ) * tparm;
-            ipntVec.push_back( pnt );
+            SegIntersectTris( &m_TriVec[ node.m_Offset ], node.m_NumTris, p0, p1, ipntVec );
+        }
+        else
+        {
+            stack.push_back( node.m_Offset + 1 );
+            stack.push_back( node.m_Offset );
         }
     }
-
 }
 
+#endif
+
 //===============================================//
 //===============================================//
 //===============================================//
@@ -2847,67 +4211,277 @@ void TMesh::MoveNode( TNode* n0, TNode* n1 )
     }
     else if ( n0->m_IsectFlag )
     {
-        n1->m_Pnt = n0->m_Pnt;
+        n1->m_Pnt = n0->m_Pnt;
+    }
+    else if ( n1->m_IsectFlag )
+    {
+        n0->m_Pnt = n1->m_Pnt;
+    }
+    else
+    {
+        vec3d p = ( n0->m_Pnt + n1->m_Pnt ) * 0.5;
+        n0->m_Pnt = p;
+        n1->m_Pnt = p;
+    }
+}
+
+//==== Node Other Than node On The Edge Shared By tri0 and tri1 - NULL If None ====//
+static TNode* FindEdgeNode( TNode* node, TTri* tri0, TTri* tri1 )
+{
+    TNode* t0n0;
+    TNode* t0n1;
+    TNode* t1n0;
+    TNode* t1n1;
+
+    t0n0 = t0n1 = t1n0 = t1n1 = NULL;
+
+    if ( tri0->m_N0 == node )
+    {
+        t0n0 = tri0->m_N1;
+        t0n1 = tri0->m_N2;
+    }
+    else if ( tri0->m_N1 == node )
+    {
+        t0n0 = tri0->m_N0;
+        t0n1 = tri0->m_N2;
+    }
+    else if ( tri0->m_N2 == node )
+    {
+        t0n0 = tri0->m_N0;
+        t0n1 = tri0->m_N1;
+    }
+    if ( tri1->m_N0 == node )
+    {
+        t1n0 = tri1->m_N1;
+        t1n1 = tri1->m_N2;
+    }
+    else if ( tri1->m_N1 == node )
+    {
+        t1n0 = tri1->m_N0;
+        t1n1 = tri1->m_N2;
+    }
+    else if ( tri0->m_N2 == node )
+    {
+        t1n0 = tri1->m_N0;
+        t1n1 = tri1->m_N1;
+    }
+
+    if ( t0n0 == t1n0 || t0n0 == t1n1 )
+    {
+        return t0n0;
+    }
+    else if ( t0n1 == t1n0 || t0n1 == t1n1 )
+    {
+        return t0n1;
+    }
+    return NULL;
+}
+
+void TMesh::FindEdge( TNode* node, TTri* tri0, TTri* tri1 )
+{
+    TNode* other = FindEdgeNode( node, tri0, tri1 );
+    if ( other )
+    {
+        AddEdge( tri0, tri1, node, other );
+    }
+}
+
+//==== One Entry Per Tri Side Keyed By Its Two Node Indices ====//
+class TriSideRec
+{
+public:
+    int m_Lo;
+    int m_Hi;
+    int m_Tri;
+
+    bool operator<( const TriSideRec & r ) const
+    {
+        if ( m_Lo != r.m_Lo )
+        {
+            return m_Lo < r.m_Lo;
+        }
+        if ( m_Hi != r.m_Hi )
+        {
+            return m_Hi < r.m_Hi;
+        }
+        return m_Tri < r.m_Tri;
+    }
+};
+
+//==== Edge Found At A Node Between Two Tris ====//
+class TriEdgeEvent
+{
+public:
+    int m_Node;
+    int m_Tri0;
+    int m_Tri1;
+    TNode* m_Other;
+
+    bool operator<( const TriEdgeEvent & e ) const
+    {
+        if ( m_Node != e.m_Node )
+        {
+            return m_Node < e.m_Node;
+        }
+        if ( m_Tri0 != e.m_Tri0 )
+        {
+            return m_Tri0 < e.m_Tri0;
+        }
+        return m_Tri1 < e.m_Tri1;
+    }
+    bool operator==( const TriEdgeEvent & e ) const
+    {
+        return m_Node == e.m_Node && m_Tri0 == e.m_Tri0 && m_Tri1 == e.m_Tri1;
     }
-    else if ( n1->m_IsectFlag )
+};
+
+//==== Create Edges For Adjacent Tris ====//
+// Tri sides are bucketed by node index so only tris that really share a side are paired.
+// Edges are then added in the same order as visiting every pair of tris around every node
+// in m_NVec order, so edge direction and m_Tri0/m_Tri1 do not depend on the table.
+void TMesh::BuildTriEdges()
+{
+    int n, t, k;
+
+    //==== Clear Refs to Tris ====//
+    for ( n = 0 ; n < ( int )m_NVec.size() ; n++ )
     {
-        n0->m_Pnt = n1->m_Pnt;
+        m_NVec[n]->m_TriVec.clear();
     }
-    else
+
+    //==== Number Nodes - Nodes Not In m_NVec Go Last And Never Start An Edge ====//
+    int num_nodes = ( int )m_NVec.size();
+    int num_tris = ( int )m_TVec.size();
+    vector< TNode* > node_vec( m_NVec );
+    vector< int > save_id( num_nodes );
+    for ( n = 0 ; n < num_nodes ; n++ )
     {
-        vec3d p = ( n0->m_Pnt + n1->m_Pnt ) * 0.5;
-        n0->m_Pnt = p;
-        n1->m_Pnt = p;
+        save_id[n] = m_NVec[n]->m_ID;
+        m_NVec[n]->m_ID = n;
     }
-}
 
-void TMesh::FindEdge( TNode* node, TTri* tri0, TTri* tri1 )
-{
-    TNode* t0n0;
-    TNode* t0n1;
-    TNode* t1n0;
-    TNode* t1n1;
+    for ( t = 0 ; t < num_tris ; t++ )
+    {
+        TTri* tri = m_TVec[t];
+        for ( k = 0 ; k < 3 ; k++ )
+        {
+            TNode* node = tri->GetTriNode( k );
+            if ( node->m_ID < 0 || node->m_ID >= ( int )node_vec.size() || node_vec[ node->m_ID ] != node )
+            {
+                save_id.push_back( node->m_ID );
+                node->m_ID = ( int )node_vec.size();
+                node_vec.push_back( node );
+            }
+            node->m_TriVec.push_back( tri );
+        }
+        tri->m_E0 = 0;
+        tri->m_E1 = 0;
+        tri->m_E2 = 0;
+    }
 
-    t0n0 = t0n1 = t1n0 = t1n1 = NULL;
+    //==== Bucket Tri Sides By Lower Node Index ====//
+    int num_ind = ( int )node_vec.size();
+    vector< TriSideRec > side_vec( num_tris * 3 );
 
-    if ( tri0->m_N0 == node )
+    #pragma omp parallel for
+    for ( t = 0 ; t < num_tris ; t++ )
     {
-        t0n0 = tri0->m_N1;
-        t0n1 = tri0->m_N2;
+        TTri* tri = m_TVec[t];
+        int ind[3] = { tri->m_N0->m_ID, tri->m_N1->m_ID, tri->m_N2->m_ID };
+        for ( int e = 0 ; e < 3 ; e++ )
+        {
+            TriSideRec & r = side_vec[ t * 3 + e ];
+            r.m_Lo = min( ind[e], ind[( e + 1 ) % 3] );
+            r.m_Hi = max( ind[e], ind[( e + 1 ) % 3] );
+            r.m_Tri = t;
+        }
     }
-    else if ( tri0->m_N1 == node )
+
+    vector< int > offset( num_ind + 1, 0 );
+    for ( k = 0 ; k < ( int )side_vec.size() ; k++ )
     {
-        t0n0 = tri0->m_N0;
-        t0n1 = tri0->m_N2;
+        offset[ side_vec[k].m_Lo + 1 ]++;
     }
-    else if ( tri0->m_N2 == node )
+    for ( n = 0 ; n < num_ind ; n++ )
     {
-        t0n0 = tri0->m_N0;
-        t0n1 = tri0->m_N1;
+        offset[n + 1] += offset[n];
     }
-    if ( tri1->m_N0 == node )
+    vector< TriSideRec > bucket_vec( side_vec.size() );
+    vector< int > fill( offset.begin(), offset.end() - 1 );
+    for ( k = 0 ; k < ( int )side_vec.size() ; k++ )
     {
-        t1n0 = tri1->m_N1;
-        t1n1 = tri1->m_N2;
+        bucket_vec[ fill[ side_vec[k].m_Lo ]++ ] = side_vec[k];
     }
-    else if ( tri1->m_N1 == node )
+
+    //==== Pair Tris On Each Shared Side - Either End May Find The Edge ====//
+    vector< vector< TriEdgeEvent > > bucket_event_vec( num_ind );
+
+    #pragma omp parallel for schedule( dynamic, 256 )
+    for ( n = 0 ; n < num_ind ; n++ )
     {
-        t1n0 = tri1->m_N0;
-        t1n1 = tri1->m_N2;
+        sort( bucket_vec.begin() + offset[n], bucket_vec.begin() + offset[n + 1] );
+
+        int g0 = offset[n];
+        while ( g0 < offset[n + 1] )
+        {
+            int g1 = g0 + 1;
+            while ( g1 < offset[n + 1] && bucket_vec[g1].m_Hi == bucket_vec[g0].m_Hi )
+            {
+                g1++;
+            }
+
+            for ( int i = g0 ; i < g1 ; i++ )
+            {
+                for ( int j = i + 1 ; j < g1 ; j++ )
+                {
+                    if ( bucket_vec[i].m_Tri == bucket_vec[j].m_Tri )
+                    {
+                        continue;
+                    }
+                    TTri* tri0 = m_TVec[ bucket_vec[i].m_Tri ];
+                    TTri* tri1 = m_TVec[ bucket_vec[j].m_Tri ];
+
+                    int end_ind[2] = { bucket_vec[g0].m_Lo, bucket_vec[g0].m_Hi };
+                    for ( int e = 0 ; e < 2 ; e++ )
+                    {
+                        if ( end_ind[e] >= num_nodes || ( e == 1 && end_ind[1] == end_ind[0] ) )
+                        {
+                            continue;
+                        }
+                        TriEdgeEvent ev;
+                        ev.m_Node = end_ind[e];
+                        ev.m_Tri0 = bucket_vec[i].m_Tri;
+                        ev.m_Tri1 = bucket_vec[j].m_Tri;
+                        ev.m_Other = FindEdgeNode( node_vec[ ev.m_Node ], tri0, tri1 );
+                        if ( ev.m_Other )
+                        {
+                            bucket_event_vec[n].push_back( ev );
+                        }
+                    }
+                }
+            }
+            g0 = g1;
+        }
     }
-    else if ( tri0->m_N2 == node )
+
+    vector< TriEdgeEvent > event_vec;
+    for ( n = 0 ; n < num_ind ; n++ )
     {
-        t1n0 = tri1->m_N0;
-        t1n1 = tri1->m_N1;
+        event_vec.insert( event_vec.end(), bucket_event_vec[n].begin(), bucket_event_vec[n].end() );
     }
+    sort( event_vec.begin(), event_vec.end() );
+    event_vec.erase( unique( event_vec.begin(), event_vec.end() ), event_vec.end() );
 
-    if ( t0n0 == t1n0 || t0n0 == t1n1 )
+    for ( k = 0 ; k < ( int )event_vec.size() ; k++ )
     {
-        AddEdge( tri0, tri1, node, t0n0 );
+        const TriEdgeEvent & ev = event_vec[k];
+        AddEdge( m_TVec[ ev.m_Tri0 ], m_TVec[ ev.m_Tri1 ], node_vec[ ev.m_Node ], ev.m_Other );
     }
-    else if ( t0n1 == t1n0 || t0n1 == t1n1 )
+
+    //==== Restore Node IDs ====//
+    for ( n = 0 ; n < ( int )node_vec.size() ; n++ )
     {
-        AddEdge( tri0, tri1, node, t0n1 );
+        node_vec[n]->m_ID = save_id[n];
     }
 }
 
@@ -2929,7 +4503,7 @@ void TMesh::AddEdge( TTri* tri0, TTri* tri1, TNode* node0, TNode* node1 )
     }
 
     //==== Create Edge ====//
-    TEdge* edge = new TEdge();
+    TEdge* edge = NewEdge();
 
     edge->m_N0 = node0;
     edge->m_N1 = node1;
@@ -3038,6 +4612,34 @@ void TMesh::BuildMergeMaps()
     BuildEdgeMaps();
 }
 
+//==== Perimeter Edge Keyed By Its Master Nodes ====//
+class PermEdgeRec
+{
+public:
+    TNode* m_Lo;
+    TNode* m_Hi;
+    int m_Tri;
+    int m_Pei;
+    TEdge* m_Edge;
+
+    bool operator<( const PermEdgeRec & r ) const
+    {
+        if ( m_Lo != r.m_Lo )
+        {
+            return less< TNode* >()( m_Lo, r.m_Lo );
+        }
+        if ( m_Hi != r.m_Hi )
+        {
+            return less< TNode* >()( m_Hi, r.m_Hi );
+        }
+        if ( m_Tri != r.m_Tri )
+        {
+            return m_Tri < r.m_Tri;
+        }
+        return m_Pei < r.m_Pei;
+    }
+};
+
 void TMesh::BuildEdgeMaps()
 {
     // Build maps between shared edges using node maps
@@ -3052,76 +4654,73 @@ void TMesh::BuildEdgeMaps()
         m_NSMMap[m_TVec[t]->m_N2]->m_TriVec.push_back( m_TVec[t] );
     }
 
-    // Loop through triangles sharing nodes to find alias edges
-    map< TNode*, list<TNode*> >::iterator mit; // map iterator
+    //==== Group Perimeter Edges By Their Master Nodes ====//
+    int num_tris = ( int )m_TVec.size();
+    vector< PermEdgeRec > rec_vec( num_tris * 3 );
+
+    #pragma omp parallel for
+    for ( int t = 0 ; t < num_tris ; t++ )
+    {
+        for ( int pei = 0 ; pei < 3 ; pei++ )
+        {
+            TEdge* e = m_TVec[t]->m_PEArr[pei];
+            PermEdgeRec & r = rec_vec[ t * 3 + pei ];
+            r.m_Edge = e;
+            r.m_Tri = t;
+            r.m_Pei = pei;
+
+            TNode* m0 = NULL;
+            TNode* m1 = NULL;
+            map< TNode*, TNode* >::const_iterator it = m_NSMMap.find( e->m_N0 );
+            if ( it != m_NSMMap.end() )
+            {
+                m0 = it->second;
+            }
+            it = m_NSMMap.find( e->m_N1 );
+            if ( it != m_NSMMap.end() )
+            {
+                m1 = it->second;
+            }
+            r.m_Lo = min( m0, m1 );
+            r.m_Hi = max( m0, m1 );
+        }
+    }
+
+    sort( rec_vec.begin(), rec_vec.end() );
 
-    for ( mit = m_NAMap.begin(); mit != m_NAMap.end() ; ++mit ) // Loop over all master nodes
+    //==== First Edge In Tri Order Is Master - Later Tris With The Same Nodes Are Its Aliases ====//
+    int g0 = 0;
+    while ( g0 < ( int )rec_vec.size() )
     {
-        TNode* n = mit->first;
-        for ( int t = 0 ; t < ( int )n->m_TriVec.size() ; t++ ) // Loop over triangles sharing the master node
+        int g1 = g0 + 1;
+        while ( g1 < ( int )rec_vec.size() && rec_vec[g1].m_Lo == rec_vec[g0].m_Lo && rec_vec[g1].m_Hi == rec_vec[g0].m_Hi )
         {
-            TTri* tri1 = n->m_TriVec[t];
+            g1++;
+        }
 
-            for ( int pei = 0 ; pei < 3 ; pei++ ) // Loop over the perimeter edges of first triangle
+        if ( rec_vec[g0].m_Lo )         // Nodes without a master are never matched
+        {
+            for ( int g = g0 ; g < g1 ; g++ )
             {
-                TEdge* e1 = tri1->m_PEArr[pei];
-                if ( m_ESMMap.find( e1 ) == m_ESMMap.end() // only continue if this edge isn't already a master
-                        && ( m_NSMMap[e1->m_N0] == n || m_NSMMap[e1->m_N1] == n ) ) // only continue if this edge contains to common node
+                TEdge* e1 = rec_vec[g].m_Edge;
+                if ( m_ESMMap.find( e1 ) != m_ESMMap.end() )
                 {
-
-                    for ( int t2 = t + 1 ; t2 < ( int )n->m_TriVec.size(); t2++ ) // Loop over the next triangle in list sharing the master node
+                    continue;
+                }
+                for ( int h = g + 1 ; h < g1 ; h++ )
+                {
+                    if ( rec_vec[h].m_Tri > rec_vec[g].m_Tri )
                     {
-                        TTri* tri2 = n->m_TriVec[t2];
-
-                        for ( int pei2 = 0 ; pei2 < 3; pei2++ ) // Loop over the next triangle's perimeter edges
-                        {
-                            TEdge* e2 = tri2->m_PEArr[pei2];
-                            if ( ( m_NSMMap[e1->m_N0] == m_NSMMap[e2->m_N0] && m_NSMMap[e1->m_N1] == m_NSMMap[e2->m_N1] ) ||
-                                    ( m_NSMMap[e1->m_N1] == m_NSMMap[e2->m_N0] && m_NSMMap[e1->m_N0] == m_NSMMap[e2->m_N1] ) )
-                            {
-                                m_ESMMap[e2] = e1;
-                                m_EAMap[e1].push_back( e2 );
-                            }
-                        }
+                        TEdge* e2 = rec_vec[h].m_Edge;
+                        m_ESMMap[e2] = e1;
+                        m_EAMap[e1].push_back( e2 );
                     }
-
-                    m_ESMMap[e1] = e1; // Set first edge to be its own master
                 }
+                m_ESMMap[e1] = e1; // Set first edge to be its own master
             }
         }
+        g0 = g1;
     }
-
-    // Brute Force Check
-//  vector<TEdge*> edges;
-//  for (int t = 0 ; t < (int) m_TVec.size(); t++ )
-//  {
-//      for ( int pi = 0; pi < 3 ; pi++)
-//          edges.push_back( m_TVec[t]->m_PEArr[pi] );
-//  }
-//
-//  for ( int ei = 0 ; ei < (int) edges.size(); ei++ )
-//  {
-//      TEdge* e1 = edges[ei];
-//
-//      if ( m_ESMMap.find(e1) == m_ESMMap.end() ) // continue if edge doesn't already have master
-//      {
-//          for ( int ei2 = ei+1 ; ei2 < (int)edges.size(); ei2++)
-//          {
-//              TEdge* e2 = edges[ei2];
-//              if ( e1 != e2 )
-//              {
-//                  if ( ( m_NSMMap[e1->m_N0] == m_NSMMap[e2->m_N0] && m_NSMMap[e1->m_N1] == m_NSMMap[e2->m_N1] ) ||
-//                       ( m_NSMMap[e1->m_N1] == m_NSMMap[e2->m_N0] && m_NSMMap[e1->m_N0] == m_NSMMap[e2->m_N1] ) )
-//                  {
-//                      m_ESMMap[e2] = e1;
-//                      m_EAMap[e1].push_back(e2);
-//                  }
-//              }
-//          }
-//          m_ESMMap[e1] = e1;
-//      }
-//
-//  }
 }
 
 void TMesh::BuildNodeMaps()
@@ -3143,8 +4742,8 @@ void TMesh::BuildNodeMaps()
         pnCloud.AddPntNode( m_NVec[n]->m_Pnt );
     }
 
-    //==== Use NanoFlann to Find Close Points and Group ====//
-    IndexPntNodes( pnCloud, tol );
+    //==== Group Close Points On A Voxel Grid ====//
+    HashPntNodes( pnCloud, tol );
 
     for ( n = 0 ; n < ( int )m_NVec.size() ; n++ )
     {
@@ -3205,7 +4804,7 @@ void TMesh::DeleteDupNodes()
         }
         else
         {
-            delete m_TVec[t];
+            FreeTObj( m_TVec[t] );
         }
     }
     m_TVec = tempTVec;
@@ -3226,7 +4825,7 @@ void TMesh::DeleteDupNodes()
 
         for ( lit = ++dnodes.begin() ; lit != dnodes.end() ; ++lit ) // Start at second element since first is the master node itself
         {
-            delete *lit;
+            FreeTObj( *lit );
         }
 
         nk->m_MergeVec.clear();
@@ -3242,10 +4841,98 @@ void TMesh::DeleteDupNodes()
 
 }
 
+//==== Weld Coincident Nodes - Same Result As BuildMergeMaps And DeleteDupNodes Without The Maps ====//
 void TMesh::MatchNodes()
 {
-    BuildMergeMaps();
-    DeleteDupNodes();
+    int n, t;
+    int num_nodes = ( int )m_NVec.size();
+
+    if ( num_nodes == 0 )
+    {
+        return;
+    }
+
+    //==== Group Close Points On A Voxel Grid ====//
+    PntNodeCloud pnCloud;
+    pnCloud.ReserveMorePntNodes( num_nodes );
+    for ( n = 0 ; n < num_nodes ; n++ )
+    {
+        m_NVec[n]->m_MergeVec.clear();
+        pnCloud.AddPntNode( m_NVec[n]->m_Pnt );
+    }
+    HashPntNodes( pnCloud, 1.0e-12 );
+
+    //==== Number Nodes So Tri Corners Find Their Master ====//
+    vector< int > save_id( num_nodes );
+    for ( n = 0 ; n < num_nodes ; n++ )
+    {
+        save_id[n] = m_NVec[n]->m_ID;
+        m_NVec[n]->m_ID = n;
+    }
+
+    //==== Go Thru All Tri And Set All Nodes to their Master ====//
+    int num_tris = ( int )m_TVec.size();
+
+    #pragma omp parallel for
+    for ( t = 0 ; t < num_tris ; t++ )
+    {
+        TNode** corner[3] = { &m_TVec[t]->m_N0, &m_TVec[t]->m_N1, &m_TVec[t]->m_N2 };
+        for ( int k = 0 ; k < 3 ; k++ )
+        {
+            int id = ( *corner[k] )->m_ID;
+            if ( id >= 0 && id < num_nodes && m_NVec[id] == *corner[k] )
+            {
+                *corner[k] = m_NVec[ pnCloud.GetNodeBaseIndex( id ) ];
+            }
+        }
+    }
+
+    //==== Nuke Degenerate Tris ====//
+    vector< TTri* > tempTVec;
+    tempTVec.reserve( num_tris );
+    for ( t = 0 ; t < num_tris ; t++ )
+    {
+        if ( m_TVec[t]->m_N0 != m_TVec[t]->m_N1 &&
+                m_TVec[t]->m_N0 != m_TVec[t]->m_N2 &&
+                m_TVec[t]->m_N1 != m_TVec[t]->m_N2 )
+        {
+            tempTVec.push_back( m_TVec[t] );
+        }
+        else
+        {
+            FreeTObj( m_TVec[t] );
+        }
+    }
+    m_TVec.swap( tempTVec );
+
+    //==== Nuke Redundant Nodes And Update NVec ====//
+    vector< TNode* > masterVec;
+    masterVec.reserve( pnCloud.m_NumUsedPts );
+    for ( n = 0 ; n < num_nodes ; n++ )
+    {
+        TNode* nk = m_NVec[n];
+        nk->m_ID = save_id[n];
+        if ( pnCloud.UsedNode( n ) )
+        {
+            nk->m_MergeVec.clear();
+            nk->m_TriVec.clear();
+            masterVec.push_back( nk );
+        }
+    }
+    for ( n = 0 ; n < num_nodes ; n++ )
+    {
+        if ( !pnCloud.UsedNode( n ) )
+        {
+            FreeTObj( m_NVec[n] );
+        }
+    }
+    m_NVec.swap( masterVec );
+
+    // Node and Edge maps no longer match the nodes
+    m_NAMap.clear();
+    m_NSMMap.clear();
+    m_EAMap.clear();
+    m_ESMMap.clear();
 }
 
 void TMesh::SwapEdges( double ang )
@@ -3266,19 +4953,19 @@ void TMesh::SwapEdges( double ang )
         TEdge* edge = 0;
         if ( a0 > ang )
         {
-            edge = new TEdge();
+            edge = NewEdge();
             edge->m_N0 = m_TVec[t]->m_N1;
             edge->m_N1 = m_TVec[t]->m_N2;
         }
         else if ( a1 > ang  )
         {
-            edge = new TEdge();
+            edge = NewEdge();
             edge->m_N0 = m_TVec[t]->m_N0;
             edge->m_N1 = m_TVec[t]->m_N2;
         }
         else if ( a2 > ang  )
         {
-            edge = new TEdge();
+            edge = NewEdge();
             edge->m_N0 = m_TVec[t]->m_N0;
             edge->m_N1 = m_TVec[t]->m_N1;
         }
@@ -3342,37 +5029,10 @@ void TMesh::SwapEdges( double ang )
 
 void TMesh::CheckValid( FILE* fid )
 {
-    int n, s, t;
-
-    //==== Clear Refs to Tris ====//
-    for ( n = 0 ; n < ( int )m_NVec.size() ; n++ )
-    {
-        m_NVec[n]->m_TriVec.clear();
-    }
-
-    //==== Check If All Tris Have 3 Edges ====//
-    for ( t = 0 ; t < ( int )m_TVec.size() ; t++ )
-    {
-        m_TVec[t]->m_N0->m_TriVec.push_back( m_TVec[t] );
-        m_TVec[t]->m_N1->m_TriVec.push_back( m_TVec[t] );
-        m_TVec[t]->m_N2->m_TriVec.push_back( m_TVec[t] );
-        m_TVec[t]->m_E0 = 0;
-        m_TVec[t]->m_E1 = 0;
-        m_TVec[t]->m_E2 = 0;
-    }
+    int t;
 
     //==== Create Edges For Adjacent Tris ====//
-    for ( n = 0 ; n < ( int )m_NVec.size() ; n++ )
-    {
-        TNode* n0 = m_NVec[n];
-        for ( t = 0 ; t < ( int )n0->m_TriVec.size() ; t++ )
-        {
-            for ( s = t + 1 ; s < ( int )n0->m_TriVec.size() ; s++ )
-            {
-                FindEdge( n0, n0->m_TriVec[t], n0->m_TriVec[s] );
-            }
-        }
-    }
+    BuildTriEdges();
 
     //==== Check If All Tris Have 3 Edges ====//
     vector< TTri* > ivTriVec;
@@ -3809,9 +5469,9 @@ void TMesh::SplitAliasEdges( TTri* orig_tri, TEdge* isect_edge )
                             }
 
                             // Create Fake Edge
-                            TEdge *n_edge = new TEdge();
-                            n_edge->m_N0 = new TNode();
-                            n_edge->m_N1 = new TNode();
+                            TEdge *n_edge = NewEdge();
+                            n_edge->m_N0 = NewNode();
+                            n_edge->m_N1 = NewNode();
                             n_edge->SetParTri(ta);
                             n_edge->m_N0->SetUWPnt(uwn);
                             n_edge->m_N0->SetXYZPnt(*nn);
@@ -3836,26 +5496,97 @@ void TMesh::SubTag( int part_num, bool tag_subs )
     vector<SubSurface*> sub_surfs;
     if ( tag_subs ) sub_surfs = SubSurfaceMgr.GetSubSurfs( m_PtrID, m_SurfNum );
     int ss_num = ( int )sub_surfs.size();
+    int ntri = ( int )m_TVec.size();
+    int t, s;
+
+    // Tri centers and their UW extent
+    vector< vec3d > center_vec( ntri );
+    vec2d uw_min, uw_max;
+    for ( t = 0 ; t < ntri ; t++ )
+    {
+        center_vec[t] = m_TVec[t]->ComputeCenterUW();
+        if ( t == 0 )
+        {
+            uw_min.set_xy( center_vec[t].x(), center_vec[t].y() );
+            uw_max = uw_min;
+        }
+        else
+        {
+            uw_min.set_xy( min( uw_min.x(), center_vec[t].x() ), min( uw_min.y(), center_vec[t].y() ) );
+            uw_max.set_xy( max( uw_max.x(), center_vec[t].x() ), max( uw_max.y(), center_vec[t].y() ) );
+        }
+    }
+
+    //==== Grid Of Sub-Surfaces Whose Subtag Bounds Touch Each UW Cell ====//
+    // Outside its bounds a sub-surface's result depends only on its test type, so only listed ones are tested.
+    // Polygons are also brought up to date here so Subtag does not modify the sub-surfaces below.
+    const int ncell = 32;
+    double du = max( uw_max.x() - uw_min.x(), 1.0e-12 ) / ncell;
+    double dw = max( uw_max.y() - uw_min.y(), 1.0e-12 ) / ncell;
+
+    vector< char > outside_vec( ss_num );
+    vector< vector< char > > cell_mask( ncell * ncell, vector< char >( ss_num, 0 ) );
+    for ( s = 0 ; s < ss_num ; s++ )
+    {
+        outside_vec[s] = ( sub_surfs[s]->m_TestType() == vsp::OUTSIDE );
+
+        vec2d lo, hi;
+        if ( !sub_surfs[s]->GetSubtagBounds( lo, hi ) )
+        {
+            lo = uw_min;
+            hi = uw_max;
+        }
+
+        double tol = 1.0e-9;
+        int i0 = max( 0, ( int )floor( ( lo.x() - tol - uw_min.x() ) / du ) );
+        int i1 = min( ncell - 1, ( int )floor( ( hi.x() + tol - uw_min.x() ) / du ) );
+        int j0 = max( 0, ( int )floor( ( lo.y() - tol - uw_min.y() ) / dw ) );
+        int j1 = min( ncell - 1, ( int )floor( ( hi.y() + tol - uw_min.y() ) / dw ) );
+        for ( int i = i0 ; i <= i1 ; i++ )
+        {
+            for ( int j = j0 ; j <= j1 ; j++ )
+            {
+                cell_mask[ i * ncell + j ][s] = 1;
+            }
+        }
+    }
 
-    for ( int t = 0 ; t < ( int )m_TVec.size(); t ++ )
+    #pragma omp parallel for schedule( dynamic, 256 )
+    for ( t = 0 ; t < ntri ; t++ )
     {
         TTri* tri = m_TVec[t];
         tri->m_Tags.push_back( part_num ); // Give Tri overall surface ID number
-        for ( int s = 0; s < ss_num; s++ )
+
+        if ( ss_num > 0 )
         {
-            if ( sub_surfs[s]->Subtag( tri ) )
+            int i = min( ncell - 1, max( 0, ( int )floor( ( center_vec[t].x() - uw_min.x() ) / du ) ) );
+            int j = min( ncell - 1, max( 0, ( int )floor( ( center_vec[t].y() - uw_min.y() ) / dw ) ) );
+            const vector< char > & mask = cell_mask[ i * ncell + j ];
+
+            for ( int k = 0; k < ss_num; k++ )
             {
-                tri->m_Tags.push_back( sub_surfs[s]->m_Tag );
+                bool tag = mask[k] ? sub_surfs[k]->Subtag( center_vec[t] ) : ( outside_vec[k] != 0 );
+                if ( tag )
+                {
+                    tri->m_Tags.push_back( sub_surfs[k]->m_Tag );
+                }
             }
         }
 
-        SubSurfaceMgr.m_TagCombos.insert( tri->m_Tags );
-
         for ( int st = 0; st < ( int )tri->m_SplitVec.size() ; st++ ) // Set split tris to have same tags as main tri
         {
             tri->m_SplitVec[st]->m_Tags = tri->m_Tags;
         }
     }
+
+    // Neighboring tris mostly share a combination, so only insert when it changes.
+    for ( t = 0 ; t < ntri ; t++ )
+    {
+        if ( t == 0 || m_TVec[t]->m_Tags != m_TVec[t - 1]->m_Tags )
+        {
+            SubSurfaceMgr.m_TagCombos.insert( m_TVec[t]->m_Tags );
+        }
+    }
 }
 
 vec3d TMesh::CompPnt( const vec3d & uw_pnt )
@@ -3915,3 +5646,88 @@ vec3d TMesh::CompPnt( const vec3d & uw_pnt )
     return ( p0 * weights[0] + p1 * weights[1] + p2 * weights[2] + p3 * weights[3] );
 
 }
+
+//===============================================//
+//                  TMeshPairCache
+//===============================================//
+void TMeshPairCache::Clear()
+{
+    m_PairMap.clear();
+    m_UsedSet.clear();
+}
+
+bool TMeshPairCache::Find( unsigned long long hash0, unsigned long long hash1, TMesh* tm0, TMesh* tm1, double scale,
+                           vector< TISectSeg > & isectVec )
+{
+    HashPair key( hash0, hash1 );
+    map< HashPair, vector< TISectRec > >::iterator it = m_PairMap.find( key );
+    if ( it == m_PairMap.end() )
+    {
+        return false;
+    }
+
+    const vector< TISectRec > & rec_vec = it->second;
+    for ( int i = 0 ; i < ( int )rec_vec.size() ; i++ )
+    {
+        if ( rec_vec[i].m_Tri0 >= ( int )tm0->m_TVec.size() || rec_vec[i].m_Tri1 >= ( int )tm1->m_TVec.size() )
+        {
+            // Hash collision - recompute the pair
+            isectVec.clear();
+            return false;
+        }
+
+        TISectSeg seg;
+        seg.m_Tri0 = tm0->m_TVec[ rec_vec[i].m_Tri0 ];
+        seg.m_Tri1 = tm1->m_TVec[ rec_vec[i].m_Tri1 ];
+        seg.m_Pnt0 = rec_vec[i].m_Pnt0 * scale;
+        seg.m_Pnt1 = rec_vec[i].m_Pnt1 * scale;
+        isectVec.push_back( seg );
+    }
+
+    m_UsedSet.insert( key );
+    return true;
+}
+
+void TMeshPairCache::Store( unsigned long long hash0, unsigned long long hash1, TMesh* tm0, TMesh* tm1, double scale,
+                            const vector< TISectSeg > & isectVec )
+{
+    unordered_map< TTri*, int > ind_map0, ind_map1;
+    for ( int t = 0 ; t < ( int )tm0->m_TVec.size() ; t++ )
+    {
+        ind_map0[ tm0->m_TVec[t] ] = t;
+    }
+    for ( int t = 0 ; t < ( int )tm1->m_TVec.size() ; t++ )
+    {
+        ind_map1[ tm1->m_TVec[t] ] = t;
+    }
+
+    HashPair key( hash0, hash1 );
+    vector< TISectRec > & rec_vec = m_PairMap[ key ];
+    rec_vec.resize( isectVec.size() );
+    for ( int i = 0 ; i < ( int )isectVec.size() ; i++ )
+    {
+        rec_vec[i].m_Tri0 = ind_map0[ isectVec[i].m_Tri0 ];
+        rec_vec[i].m_Tri1 = ind_map1[ isectVec[i].m_Tri1 ];
+        rec_vec[i].m_Pnt0 = isectVec[i].m_Pnt0 / scale;
+        rec_vec[i].m_Pnt1 = isectVec[i].m_Pnt1 / scale;
+    }
+
+    m_UsedSet.insert( key );
+}
+
+void TMeshPairCache::EndRun()
+{
+    map< HashPair, vector< TISectRec > >::iterator it = m_PairMap.begin();
+    while ( it != m_PairMap.end() )
+    {
+        if ( m_UsedSet.find( it->first ) == m_UsedSet.end() )
+        {
+            m_PairMap.erase( it++ );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    m_UsedSet.clear();
+}
@@ -30,6 +30,8 @@
 #include <string>
 #include <map>
 #include <list>
+#include <set>
+#include <new>
 using namespace std;            //jrg windows??
 
 extern "C"
@@ -44,6 +46,85 @@ class TBndBox;
 class NBndBox;
 class TMesh;
 
+//==== Slab Pool For Mesh Topology Objects ====//
+// Objects are constructed in place in large blocks and are all destroyed
+// together when the pool is cleared.  Objects handed out by the pool are
+// tagged with m_ArenaFlag so they are never passed to delete individually.
+template < class T >
+class TObjPool
+{
+public:
+    TObjPool()
+    {
+        m_NumInBlock = BLOCK_SIZE;
+    }
+    ~TObjPool()
+    {
+        Clear();
+    }
+
+    T* Alloc()
+    {
+        if ( m_NumInBlock == BLOCK_SIZE )
+        {
+            m_BlockVec.push_back( static_cast< T* >( ::operator new( BLOCK_SIZE * sizeof( T ) ) ) );
+            m_NumInBlock = 0;
+        }
+        T* obj = new ( m_BlockVec.back() + m_NumInBlock ) T();
+        obj->m_ArenaFlag = true;
+        m_NumInBlock++;
+        return obj;
+    }
+
+    void Clear()
+    {
+        for ( int b = 0 ; b < ( int )m_BlockVec.size() ; b++ )
+        {
+            int num = ( b == ( int )m_BlockVec.size() - 1 ) ? m_NumInBlock : BLOCK_SIZE;
+            for ( int i = 0 ; i < num ; i++ )
+            {
+                m_BlockVec[b][i].~T();
+            }
+            ::operator delete( m_BlockVec[b] );
+        }
+        m_BlockVec.clear();
+        m_NumInBlock = BLOCK_SIZE;
+    }
+
+    int Size() const
+    {
+        if ( m_BlockVec.empty() )
+        {
+            return 0;
+        }
+        return ( ( int )m_BlockVec.size() - 1 ) * BLOCK_SIZE + m_NumInBlock;
+    }
+
+    size_t MemoryUsage() const
+    {
+        return m_BlockVec.size() * BLOCK_SIZE * sizeof( T ) + m_BlockVec.capacity() * sizeof( T* );
+    }
+
+private:
+    TObjPool( const TObjPool& );                // Not copyable
+    TObjPool& operator=( const TObjPool& );
+
+    enum { BLOCK_SIZE = 1024 };
+
+    vector< T* > m_BlockVec;
+    int m_NumInBlock;
+};
+
+//==== Delete Heap Allocated Topology - Pool Objects Are Released With Their Pool ====//
+template < class T >
+inline void FreeTObj( T* obj )
+{
+    if ( obj && !obj->m_ArenaFlag )
+    {
+        delete obj;
+    }
+}
+
 class TetraMassProp
 {
 public:
@@ -234,6 +315,7 @@ public:
 //  TNode* mapNode;
 
     int m_IsectFlag;
+    bool m_ArenaFlag;                   // Owned by a TMesh pool
 
     enum { HAS_UNKNOWN = 0, HAS_XYZ = 1, HAS_UW = 2 };
 
@@ -255,6 +337,8 @@ public:
     TTri* m_Tri0;                           // For WaterTight Check
     TTri* m_Tri1;
 
+    bool m_ArenaFlag;                       // Owned by a TMesh pool
+
     virtual void SetParTri( TTri* par_tri )
     {
         m_ParTri = par_tri;
@@ -271,6 +355,27 @@ protected:
 };
 
 
+//==== Scratch Storage Reused Across TTri::SplitTri Calls - One Per Thread ====//
+class TriSplitBuffer
+{
+public:
+    TriSplitBuffer()
+    {
+        m_NumPerimEdges = -1;
+    }
+
+    int m_NumPerimEdges;                    // Leading m_EVec entries on the tri perimeter, -1 if unknown
+    vector< int > m_NodeSide;               // Perimeter side of each m_NVec node, -1 corner, -2 interior
+    vector< double > m_NodeT;               // Parameter along the perimeter side
+
+    vector< double > m_PntList;             // Flattened points passed to triangle
+    vector< int > m_SegList;                // Segment node indices passed to triangle
+    vector< int > m_SegIndList;             // Node indices of each m_EVec edge
+    vector< int > m_TriList;                // Three node indices per output tri
+    vector< int > m_BndList;                // Perimeter node loop
+    vector< vector< int > > m_FaceVec;      // Perimeter loop cut by chords
+};
+
 
 class TTri
 {
@@ -291,8 +396,8 @@ public:
     TEdge* m_PEArr[3];                          // Perimeter Edge Array
 
     virtual void CopyFrom( const TTri* tri );
-    virtual void SplitTri();              // Split Tri to Fit ISect Edges
-    virtual void TriangulateSplit( int flattenAxis );
+    virtual void SplitTri( TriSplitBuffer* buf = NULL );  // Split Tri to Fit ISect Edges
+    virtual void TriangulateSplit( int flattenAxis, TriSplitBuffer & buf );
     virtual vec3d ComputeCenter()
     {
         return ( m_N0->m_Pnt + m_N1->m_Pnt + m_N2->m_Pnt ) / 3.0;
@@ -344,6 +449,12 @@ public:
 
     virtual void BuildPermEdges();
 
+    //==== Allocate From The Owning TMesh Pool (Heap If No TMesh) ====//
+    TNode* NewNode();
+    TEdge* NewEdge();
+    TTri* NewTri();
+    void AddISectEdge( const vec3d & p0, const vec3d & p1 );
+
     virtual int OnEdge( const vec3d & p, TEdge* e, double onEdgeTol, double * t = NULL );
     virtual vec3d CompPnt( const vec3d & uw_pnt );
 
@@ -352,6 +463,7 @@ public:
     vector<int> m_Tags;
     double m_Density;
     int m_InvalidFlag;
+    bool m_ArenaFlag;                       // Owned by a TMesh pool
 
     TEdge* m_E0;
     TEdge* m_E1;
@@ -366,34 +478,85 @@ private:
 
 };
 
+//==== Intersection Segment Recorded Between Two Tris ====//
+class TISectSeg
+{
+public:
+    TTri* m_Tri0;
+    TTri* m_Tri1;
+    vec3d m_Pnt0;
+    vec3d m_Pnt1;
+};
+
+//==== Node of Flattened Bounding Volume Hierarchy ====//
+class TBvhNode
+{
+public:
+    TBvhNode()
+    {
+        m_Offset = 0;
+        m_NumTris = 0;
+    }
+
+    bool IsLeaf() const
+    {
+        return m_NumTris > 0;
+    }
+
+    BndBox m_Box;
+    int m_Offset;               // Leaf: Index of First Tri, Interior: Index of First Child (Second Child Follows)
+    int m_NumTris;              // Number of Tris In Leaf, Zero For Interior Nodes
+};
+
 class TBndBox
 {
 public:
     TBndBox();
     virtual ~TBndBox();
 
+    enum { RAY_PACKET_SIZE = 8 }; // Max rays traced together by RayCastPacket
+
     virtual void Reset();
 
     BndBox m_Box;
     vector< TTri* > m_TriVec;
 
-    TBndBox* m_SBoxVec[8];      // Split Bnd Boxes
+    TBndBox* m_SBoxVec[8];      // Split Bnd Boxes (Octree Only)
+
+    vector< TBvhNode > m_BvhNodeVec;   // Flattened SAH BVH, Root At Index Zero (BVH Only)
 
     void SplitBox();
     void AddTri( TTri* t );
     virtual void Intersect( TBndBox* iBox, bool UWFlag = false );
+    virtual void Intersect( TBndBox* iBox, vector< TISectSeg > & isectVec );
     virtual void NumCrossXRay( vec3d & orig, vector<double> & tParmVec );
     virtual void RayCast( vec3d & orig, vec3d & dir, vector<double> & tParmVec );
+    virtual void RayCastPacket( const vec3d* origArr, const bool* activeArr, int num, const vec3d & dir, vector<double>* tParmVecArr );
     virtual void AddLeafNodes( vector< TBndBox* > & leafVec );
 
     virtual void SegIntersect( vec3d & p0, vec3d & p1, vector< vec3d > & ipntVec );
     virtual bool CheckIntersect( TBndBox* iBox );
     virtual double MinDistance( TBndBox* iBox, double curr_min_dist );
 
+    virtual size_t MemoryUsage() const;
+
+protected:
+
+    void BuildBvh();
+    void IntersectBoxes( TBndBox* iBox, bool UWFlag, vector< TISectSeg > * isectVec );
+
 };
 
 class Geom;
 
+//==== STL Facet Output - Three Consecutive Vertices Per Facet ====//
+void AddSTLTri( vector< vec3d > & pnt_vec, const vec3d & v0, const vec3d & v1, const vec3d & v2 );
+void WriteSTLFacets( FILE* file_id, const vector< vec3d > & pnt_vec );       // Text facets, formatted in parallel
+void WriteBinarySTL( FILE* file_id, const vector< vec3d > & pnt_vec );       // Complete binary STL file
+void WriteBinarySTL( FILE* file_id, const vector< vec3d > & pnt_vec, const vector< int > & attr_vec );
+void WriteBinarySTLHeader( FILE* file_id, unsigned int num_facet );          // Facets written in pieces follow the header
+void WriteBinarySTLFacets( FILE* file_id, const vector< vec3d > & pnt_vec, const vector< int > & attr_vec );
+
 class TMesh
 {
 public:
@@ -406,12 +569,21 @@ public:
 
     TBndBox m_TBox;
 
+    //==== Topology Owned By This Mesh - Released All At Once In ~TMesh ====//
+    TNode* NewNode();
+    TEdge* NewEdge();
+    TTri* NewTri();
+
+    //==== Approximate Bytes Held, Including Pools, Split Tris And Search Tree ====//
+    virtual size_t MemoryUsage() const;
+
     void copy( TMesh* m );
     void CopyFlatten( TMesh* m );
     virtual xmlNodePtr EncodeXml( xmlNodePtr & node );
     virtual void DecodeXml( xmlNodePtr & node );
     virtual xmlNodePtr EncodeTriList( xmlNodePtr & node );
     virtual void DecodeTriList( xmlNodePtr & node, int num_tris );
+    virtual void CopyTriList( TMesh* m );
 
     //==== Stuff Copied From Geom That Created This Mesh ====//
     string m_PtrID;
@@ -439,15 +611,23 @@ public:
     void LoadGeomAttributes( Geom* geomPtr );
     int  RemoveDegenerate();
     void Intersect( TMesh* tm, bool UWFlag = false );
+    void Intersect( TMesh* tm, vector< TISectSeg > & isectVec );
+    unsigned long long ComputeGeomHash( double scale );
     bool CheckIntersect( TMesh* tm );
     double MinDistance( TMesh* tm, double curr_min_dist );
     void Split();
     void DeterIntExt( vector< TMesh* >& meshVec );
     void DeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec );
+    void DeterIntExtPacket( TTri** triArr, int num, vector< TMesh* >& meshVec, vector< double >* tParmVecArr );
     void MassDeterIntExt( vector< TMesh* >& meshVec );
     void MassDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec );
+    void MassDeterIntExtPacket( TTri** triArr, int num, vector< TMesh* >& meshVec, vector< double >* tParmVecArr );
+    void MassOwners( vector< TMesh* >& meshVec, vector< TTri* > & triVec, vector< int > & ownerVec );
+    void MassOwnersPacket( TTri** triArr, int num, vector< TMesh* >& meshVec, vector< double >* tParmVecArr, int* ownerArr );
     void WaveDeterIntExt( vector< TMesh* >& meshVec );
     void WaveDeterIntExtTri( TTri* tri, vector< TMesh* >& meshVec );
+    void WaveDeterIntExtPacket( TTri** triArr, int num, vector< TMesh* >& meshVec, vector< double >* tParmVecArr );
+    void GatherIntExtTris( vector< TTri* > & triVec );
 
     void LoadBndBox();
 
@@ -466,12 +646,14 @@ public:
     virtual void AddUWTri( const vec3d & uw0, const vec3d & uw1, const vec3d & uw2, const vec3d & norm );
 
     virtual void WriteSTLTris( FILE* file_id, Matrix4d XFormMat );
+    virtual void LoadSTLTris( vector< vec3d > & pnt_vec, Matrix4d XFormMat );
 
     virtual vec3d GetVertex( int index );
     virtual int   NumVerts();
 
     virtual void WaterTightCheck( FILE* fid, vector< TMesh* > & tMeshVec );
     virtual void FindEdge( TNode* node, TTri* tri0, TTri* tri1 );
+    virtual void BuildTriEdges();           // Edges between all adjacent tris via an edge table
     virtual void AddEdge( TTri* tri0, TTri* tri1, TNode* node0, TNode* node1 );
     virtual void SwapEdge( TEdge* edge );
 
@@ -485,7 +667,7 @@ public:
     virtual void BuildEdgeMaps();
     virtual void DeleteDupNodes();
 
-    virtual void MatchNodes();
+    virtual void MatchNodes();              // Weld coincident nodes without building alias maps
     virtual void CheckValid( FILE* fid );
     virtual void SwapEdges( double size );
     virtual vec3d ProjectOnISectPairs( vec3d & offPnt, vector< vec3d > & pairVec );
@@ -516,15 +698,65 @@ public:
 
 protected:
     void CopyAttributes( TMesh* m );
+    void FreeTopology();
 
     map< TNode*, list<TNode*> > m_NAMap; // Map from a master node to list of nodes that are aliases
     map< TNode*, TNode* > m_NSMMap;      // Map of node slave to master node
     map< TEdge*, vector<TEdge*> > m_EAMap; // Map from a master edge to a list of edges that are aliases
     map< TEdge*, TEdge* > m_ESMMap;      // Map from edge slave to master edge
 
+    TObjPool< TNode > m_NodePool;
+    TObjPool< TEdge > m_EdgePool;
+    TObjPool< TTri > m_TriPool;             // Destroyed first, tris reference edges and nodes
+
+    //==== Pools For The Extra Threads Of A Parallel Split - Index Is Thread Number - 1 ====//
+    vector< TObjPool< TNode >* > m_WorkerNodePool;
+    vector< TObjPool< TEdge >* > m_WorkerEdgePool;
+    vector< TObjPool< TTri >* > m_WorkerTriPool;
+    void AllocWorkerPools( int num_threads );
+
+};
+
+
+
+
+//==== Intersection Segment Stored By Tri Index In Unscaled Coordinates ====//
+class TISectRec
+{
+public:
+    int m_Tri0;
+    int m_Tri1;
+    vec3d m_Pnt0;
+    vec3d m_Pnt1;
 };
 
+//==== Pairwise TMesh Intersections Kept Between CompGeom Runs ====//
+// Pairs are keyed by the geometry hash of both meshes, so only pairs involving
+// a mesh that actually changed need to be re-intersected.  Entries not used by
+// the latest run are dropped by EndRun().
+class TMeshPairCache
+{
+public:
+    TMeshPairCache()            {}
+    virtual ~TMeshPairCache()   {}
+
+    virtual void Clear();
+    virtual bool Find( unsigned long long hash0, unsigned long long hash1, TMesh* tm0, TMesh* tm1, double scale,
+                       vector< TISectSeg > & isectVec );
+    virtual void Store( unsigned long long hash0, unsigned long long hash1, TMesh* tm0, TMesh* tm1, double scale,
+                        const vector< TISectSeg > & isectVec );
+    virtual void EndRun();
 
+    int NumPairs() const
+    {
+        return ( int )m_PairMap.size();
+    }
 
+protected:
+    typedef pair< unsigned long long, unsigned long long > HashPair;
+
+    map< HashPair, vector< TISectRec > > m_PairMap;
+    set< HashPair > m_UsedSet;
+};
 
 #endif
@@ -16,13 +16,20 @@
 #include "Vehicle.h"
 #include "VehicleMgr.h"
 #include "VSPAEROMgr.h"
+#include "DesignVarMgr.h"
 #include "WingGeom.h"
 #include "PropGeom.h"
 #include "StringUtil.h"
 #include "FileUtil.h"
+#include "Util.h"
+#include "PerfStats.h"
+#include "ThreadMgr.h"
 
 #include <regex>
 
+// Threads beyond which a single VSPAERO solve stops scaling
+#define VSPAERO_CASE_THREADS 8
+
 //==== Constructor ====//
 VspAeroControlSurf::VspAeroControlSurf()
 {
@@ -104,6 +111,8 @@ VSPAEROMgrSingleton::VSPAEROMgrSingleton() : ParmContainer()
     m_FixedWakeFlag.SetDescript( "Flag to enable a fixed wake." );
     m_WakeNumIter.Init( "WakeNumIter", groupname, this, 5, 3, 255 );
     m_WakeNumIter.SetDescript( "Number of wake iterations to execute, Default = 5" );
+    m_AdaptiveWakeFlag.Init( "AdaptiveWakeFlag", groupname, this, false, false, true );
+    m_AdaptiveWakeFlag.SetDescript( "Flag to stop the wake iterations once the wake and forces have converged" );
     m_NumWakeNodes.SetPowShift( 2, 0 ); // Must come before Init
     m_NumWakeNodes.Init( "RootWakeNodes", groupname, this, 64, 0, 10e12 );
     m_NumWakeNodes.SetDescript( "Number of Wake Nodes (f(n^2))" );
@@ -116,6 +125,9 @@ VSPAEROMgrSingleton::VSPAEROMgrSingleton() : ParmContainer()
     UpdateFilenames();
 
     m_SolverProcessKill = false;
+    m_ConcurrentCasesRunning = false;
+    m_CaseIngest = NULL;
+    m_ExecBackend = ExecBackend::CreateFromEnv();
 
     // Plot limits
     m_ConvergenceXMinIsManual.Init( "m_ConvergenceXMinIsManual", groupname, this, 0, 0, 1 );
@@ -193,6 +205,8 @@ VSPAEROMgrSingleton::VSPAEROMgrSingleton() : ParmContainer()
     m_Symmetry.SetDescript( "Toggle X-Z Symmetry to Improve Calculation Time" );
     m_Write2DFEMFlag.Init( "Write2DFEMFlag", groupname, this, false, false, true );
     m_Write2DFEMFlag.SetDescript( "Toggle File Write for 2D FEM" );
+    m_AdjointFlag.Init( "AdjointFlag", groupname, this, false, false, true );
+    m_AdjointFlag.SetDescript( "Solve the adjoint for node and design variable sensitivities of CL, CDi and CMy" );
     m_ClMax.Init( "Clmax", groupname, this, -1, -1, 1e3 );
     m_ClMax.SetDescript( "Cl Max of Aircraft" );
     m_ClMaxToggle.Init( "ClmaxToggle", groupname, this, false, false, true );
@@ -260,6 +274,22 @@ VSPAEROMgrSingleton::VSPAEROMgrSingleton() : ParmContainer()
     m_Verbose = false;
 }
 
+VSPAEROMgrSingleton::~VSPAEROMgrSingleton()
+{
+    delete m_ExecBackend;
+}
+
+void VSPAEROMgrSingleton::SetExecBackend( const string & spec )
+{
+    if ( IsSolverRunning() )
+    {
+        return;
+    }
+
+    delete m_ExecBackend;
+    m_ExecBackend = ExecBackend::Create( spec );
+}
+
 void VSPAEROMgrSingleton::ParmChanged( Parm* parm_ptr, int type )
 {
     Vehicle* veh = VehicleMgr.GetVehicle();
@@ -565,6 +595,7 @@ void VSPAEROMgrSingleton::UpdateFilenames()    //A.K.A. SetupDegenFile()
     m_HistoryFile       = string();
     m_LoadFile          = string();
     m_StabFile          = string();
+    m_AdjointFile       = string();
     m_CutsFile          = string();
     m_SliceFile         = string();
     m_GroupsFile        = string();
@@ -620,6 +651,7 @@ void VSPAEROMgrSingleton::UpdateFilenames()    //A.K.A. SetupDegenFile()
                 m_StabFile = m_ModelNameBase + string( ".stab" );
             }
 
+            m_AdjointFile       = m_ModelNameBase + string( ".adjoint" );
             m_CutsFile          = m_ModelNameBase + string( ".cuts" );
             m_SliceFile         = m_ModelNameBase + string( ".slc" );
             m_GroupsFile        = m_ModelNameBase + string( ".groups" );
@@ -669,6 +701,7 @@ void VSPAEROMgrSingleton::UpdateFilenames()    //A.K.A. SetupDegenFile()
                 m_StabFile = m_ModelNameBase + string( ".stab" );
             }
 
+            m_AdjointFile       = m_ModelNameBase + string( ".adjoint" );
             m_CutsFile          = m_ModelNameBase + string( ".cuts" );
             m_SliceFile         = m_ModelNameBase + string( ".slc" );
             m_GroupsFile        = m_ModelNameBase + string( ".groups" );
@@ -1019,6 +1052,8 @@ void VSPAEROMgrSingleton::InitControlSurfaceGroups()
 
 string VSPAEROMgrSingleton::ComputeGeometry()
 {
+    PERF_SCOPE( "VSPAERO::ComputeGeometry" );
+
     Vehicle *veh = VehicleMgr.GetVehicle();
     if ( !veh )
     {
@@ -1045,43 +1080,25 @@ string VSPAEROMgrSingleton::ComputeGeometry()
         }
     }
 
-    m_DegenGeomVec.clear();
-    veh->CreateDegenGeom( m_GeomSet() );
-    m_DegenGeomVec = veh->GetDegenGeomVec();
-
-    //Update information derived from the degenerate geometry
-    UpdateRotorDisks();
-    UpdateCompleteControlSurfVec();
-
-    // record original values
-    bool exptMfile_orig = veh->getExportDegenGeomMFile();
-    bool exptCSVfile_orig = veh->getExportDegenGeomCsvFile();
-    veh->setExportDegenGeomMFile( false );
-    veh->setExportDegenGeomCsvFile( true );
-
     UpdateFilenames();
 
-    // Note: while in panel mode the degen file required by vspaero is
-    // dependent on the tri filename and not necessarily what the current
-    // setting is for the vsp::DEGEN_GEOM_CSV_TYPE
-    string degenGeomFile_orig = veh->getExportFileName( vsp::DEGEN_GEOM_CSV_TYPE );
-    veh->setExportFileName( vsp::DEGEN_GEOM_CSV_TYPE, m_DegenFileFull );
+    //==== Files On Disk Were Written From This Same Geometry, Skip Regeneration ====//
+    string hash = BuildGeometryHash( geom_vec );
+    bool reuse = GeometryFilesValid( hash );
 
-    veh->WriteDegenGeomFile();
-
-    // restore original values
-    veh->setExportDegenGeomMFile( exptMfile_orig );
-    veh->setExportDegenGeomCsvFile( exptCSVfile_orig );
-    veh->setExportFileName( vsp::DEGEN_GEOM_CSV_TYPE, degenGeomFile_orig );
-
-    WaitForFile( m_DegenFileFull );
-    if ( !FileExist( m_DegenFileFull ) )
+    if ( !reuse )
     {
-        fprintf( stderr, "WARNING: DegenGeom file not found: %s\n\tFile: %s \tLine:%d\n", m_DegenFileFull.c_str(), __FILE__, __LINE__ );
+        m_DegenGeomVec.clear();
+        veh->CreateDegenGeom( m_GeomSet() );
+        m_DegenGeomVec = veh->GetDegenGeomVec();
     }
 
+    //Update information derived from the degenerate geometry
+    UpdateRotorDisks();
+    UpdateCompleteControlSurfVec();
+
     // Generate *.tri geometry file for Panel method
-    if ( m_AnalysisMethod.Get() == vsp::PANEL )
+    if ( !reuse && m_AnalysisMethod.Get() == vsp::PANEL )
     {
         // Compute intersected and trimmed geometry
         int halfFlag = 0;
@@ -1113,6 +1130,45 @@ string VSPAEROMgrSingleton::ComputeGeometry()
 
     }
 
+    // Written after the panel mesh so the hash is taken once the runs are done, as they
+    // may themselves update the Geoms.  The panel method reads this file too.
+    if ( !reuse )
+    {
+        hash = BuildGeometryHash( veh->GetGeomSet( m_GeomSet() ) );
+
+        // record original values
+        bool exptMfile_orig = veh->getExportDegenGeomMFile();
+        bool exptCSVfile_orig = veh->getExportDegenGeomCsvFile();
+        veh->setExportDegenGeomMFile( false );
+        veh->setExportDegenGeomCsvFile( true );
+
+        // Note: while in panel mode the degen file required by vspaero is
+        // dependent on the tri filename and not necessarily what the current
+        // setting is for the vsp::DEGEN_GEOM_CSV_TYPE
+        string degenGeomFile_orig = veh->getExportFileName( vsp::DEGEN_GEOM_CSV_TYPE );
+        veh->setExportFileName( vsp::DEGEN_GEOM_CSV_TYPE, m_DegenFileFull );
+
+        veh->WriteDegenGeomFile( hash );
+
+        // restore original values
+        veh->setExportDegenGeomMFile( exptMfile_orig );
+        veh->setExportDegenGeomCsvFile( exptCSVfile_orig );
+        veh->setExportFileName( vsp::DEGEN_GEOM_CSV_TYPE, degenGeomFile_orig );
+
+        WaitForFile( m_DegenFileFull );
+        if ( !FileExist( m_DegenFileFull ) )
+        {
+            fprintf( stderr, "WARNING: DegenGeom file not found: %s\n\tFile: %s \tLine:%d\n", m_DegenFileFull.c_str(), __FILE__, __LINE__ );
+        }
+    }
+    m_GeometryHash = hash;
+
+    // The perturbed files depend on the design variables as well as the geometry, so are always written
+    if ( DoAdjoint() )
+    {
+        WriteAdjointDesignFiles();
+    }
+
     // Clear previous results
     while ( ResultsMgr.GetNumResults( "VSPAERO_Geom" ) > 0 )
     {
@@ -1128,6 +1184,8 @@ string VSPAEROMgrSingleton::ComputeGeometry()
     res->Add( NameValData( "GeometrySet", m_GeomSet() ) );
     res->Add( NameValData( "AnalysisMethod", m_AnalysisMethod.Get() ) );
     res->Add( NameValData( "DegenGeomFileName", m_DegenFileFull ) );
+    res->Add( NameValData( "GeometryHash", m_GeometryHash ) );
+    res->Add( NameValData( "GeometryReused", reuse ? 1 : 0 ) );
     if ( m_AnalysisMethod.Get() == vsp::PANEL )
     {
         res->Add( NameValData( "CompGeomFileName", m_CompGeomFileFull ) );
@@ -1143,8 +1201,171 @@ string VSPAEROMgrSingleton::ComputeGeometry()
 
 }
 
+//==== Hash Of Everything The Geometry Files Are Built From ====//
+// Any Parm change, tessellation included, bumps the Geom's surface revision.
+// Sub-Surfaces are keyed by ID and change count, as in Vehicle::GetDegenCacheKey.
+// The panel mesh made by the last run is left out unless it is the only Geom
+// in the set, as it is itself an output.
+string VSPAEROMgrSingleton::BuildGeometryHash( const vector < string > & geom_vec )
+{
+    Vehicle *veh = VehicleMgr.GetVehicle();
+    if ( !veh )
+    {
+        return string();
+    }
+
+    char str[256];
+    sprintf( str, "%d:%d:%d:%d", m_GeomSet(), m_AnalysisMethod(), m_Symmetry() ? 1 : 0, veh->m_CompGeomSymm() ? 1 : 0 );
+    string key = str;
+    key += "|" + m_DegenFileFull + "|" + m_CompGeomFileFull;
+
+    for ( size_t i = 0; i < geom_vec.size(); i++ )
+    {
+        if ( geom_vec.size() > 1 && geom_vec[i] == m_LastPanelMeshGeomId )
+        {
+            continue;
+        }
+
+        Geom* geom = veh->FindGeom( geom_vec[i] );
+        if ( geom )
+        {
+            sprintf( str, ":%d:", geom->GetSurfRevision() );
+            key += "|" + geom->GetID() + str + geom->GetName();
+
+            // Sub-Surface edits reach the DegenGeom and the panel tags without touching the surface.
+            vector< SubSurface* > ss_vec = geom->GetSubSurfVec();
+            for ( size_t j = 0; j < ss_vec.size(); j++ )
+            {
+                sprintf( str, ":%d", ss_vec[j]->GetLatestChangeCnt() );
+                key += "|" + ss_vec[j]->GetID() + str;
+            }
+        }
+    }
+
+    unsigned long long h = HashBytes( HASH_SEED, key.c_str(), key.size() );
+
+    sprintf( str, "%016llx", h );
+    return string( str );
+}
+
+//==== The DegenGeom Header Carries The Hash, The Panel Mesh Must Still Exist ====//
+bool VSPAEROMgrSingleton::GeometryFilesValid( const string & hash )
+{
+    Vehicle *veh = VehicleMgr.GetVehicle();
+    if ( !veh || hash.empty() || m_DegenGeomVec.empty() )
+    {
+        return false;
+    }
+
+    if ( m_AnalysisMethod() == vsp::PANEL )
+    {
+        if ( !veh->FindGeom( m_LastPanelMeshGeomId ) || !FileExist( m_CompGeomFileFull ) )
+        {
+            return false;
+        }
+    }
+
+    FILE* fp = fopen( m_DegenFileFull.c_str(), "r" );
+    if ( !fp )
+    {
+        return false;
+    }
+
+    char line[256];
+    string header;
+    if ( fgets( line, 255, fp ) && fgets( line, 255, fp ) )
+    {
+        header = line;
+    }
+    fclose( fp );
+
+    return header == "# GEOMETRY HASH " + hash + "\n";
+}
+
+//==== Adjoint Design Sensitivities Are For Steady Vortex Lattice Runs Only ====//
+bool VSPAEROMgrSingleton::DoAdjoint()
+{
+    return m_AdjointFlag() && m_AnalysisMethod() == vsp::VORTEX_LATTICE && !m_RotateBladesFlag();
+}
+
+//==== Perturbed DegenGeom File For Each Design Variable ====//
+// VSPAERO re-meshes <base>_dv<n>.csv and chains its node sensitivities through
+// the node displacements, so the full gradient costs one adjoint solve per
+// coefficient rather than one flow solve per variable.  <base>.dvs lists the
+// step and Parm ID of each variable.
+void VSPAEROMgrSingleton::WriteAdjointDesignFiles()
+{
+    Vehicle *veh = VehicleMgr.GetVehicle();
+    if ( !veh )
+    {
+        return;
+    }
+
+    string dvs_file = m_ModelNameBase + string( ".dvs" );
+    FILE* fp = fopen( dvs_file.c_str(), "w" );
+    if ( !fp )
+    {
+        fprintf( stderr, "ERROR %d: Unable to create design variable file: %s\n\tFile: %s \tLine:%d\n", vsp::VSP_FILE_WRITE_FAILURE, dvs_file.c_str(), __FILE__, __LINE__ );
+        return;
+    }
+
+    int nvar = DesignVarMgr.GetNumVars();
+    fprintf( fp, "%d\n", nvar );
+
+    if ( nvar > 0 )
+    {
+        bool exptMfile_orig = veh->getExportDegenGeomMFile();
+        bool exptCSVfile_orig = veh->getExportDegenGeomCsvFile();
+        string degenGeomFile_orig = veh->getExportFileName( vsp::DEGEN_GEOM_CSV_TYPE );
+        veh->setExportDegenGeomMFile( false );
+        veh->setExportDegenGeomCsvFile( true );
+
+        for ( int i = 0; i < nvar; i++ )
+        {
+            DesignVar* dv = DesignVarMgr.GetVar( i );
+            Parm* p = dv ? ParmMgr.FindParm( dv->m_ParmID ) : NULL;
+
+            double step = 0.0;
+            if ( p )
+            {
+                double orig = p->Get();
+
+                // Step away from the nearer limit, and use what the Parm actually took
+                step = 1.0e-4 * max( 1.0, std::abs( orig ) );
+                if ( orig + step > p->GetUpperLimit() )
+                {
+                    step = -step;
+                }
+                p->Set( orig + step );
+                step = p->Get() - orig;
+
+                veh->Update();
+                veh->CreateDegenGeom( m_GeomSet() );
+                veh->setExportFileName( vsp::DEGEN_GEOM_CSV_TYPE, m_ModelNameBase + string( "_dv" ) + to_string( i + 1 ) + string( ".csv" ) );
+                veh->WriteDegenGeomFile();
+
+                p->Set( orig );
+                veh->Update();
+            }
+
+            fprintf( fp, "%.*e %s\n", DBL_DIG + 3, step, dv ? dv->m_ParmID.c_str() : "" );
+        }
+
+        // Leave the vehicle with the degenerate geometry of the baseline
+        veh->CreateDegenGeom( m_GeomSet() );
+
+        veh->setExportDegenGeomMFile( exptMfile_orig );
+        veh->setExportDegenGeomCsvFile( exptCSVfile_orig );
+        veh->setExportFileName( vsp::DEGEN_GEOM_CSV_TYPE, degenGeomFile_orig );
+    }
+
+    fclose( fp );
+}
+
 string VSPAEROMgrSingleton::CreateSetupFile()
 {
+    PERF_SCOPE( "VSPAERO::CreateSetupFile" );
+
     string retStr = string();
 
     Update(); // Ensure correct control surface and rotor groups when this function is called through the API
@@ -1467,6 +1688,8 @@ Optional input of logFile allows outputting to a log file or the console
 */
 string VSPAEROMgrSingleton::ComputeSolver( FILE * logFile )
 {
+    PERF_SCOPE( "VSPAERO::ComputeSolver" );
+
     UpdateFilenames();
 
     if ( m_DegenGeomVec.size() == 0 )
@@ -1512,6 +1735,7 @@ string VSPAEROMgrSingleton::ComputeSolverSingle( FILE * logFile )
         string historyFileName = m_HistoryFile;
         string loadFileName = m_LoadFile;
         string stabFileName = m_StabFile;
+        string adjointFileName = m_AdjointFile;
         string modelNameBase = m_ModelNameBase;
         vector < string > group_res_vec = m_GroupResFiles;
         vector < string > rotor_res_vec = m_RotorResFiles;
@@ -1545,6 +1769,12 @@ string VSPAEROMgrSingleton::ComputeSolverSingle( FILE * logFile )
         vector<double> machVec;
         GetSweepVectors( alphaVec, betaVec, machVec );
 
+        int nconcurrent = GetNumConcurrentCases( alphaVec.size() * betaVec.size() * machVec.size() );
+        if ( nconcurrent > 1 || ( !m_ExecBackend->IsLocal() && CanSplitCases() ) )
+        {
+            return ComputeSolverConcurrent( logFile, alphaVec, betaVec, machVec, nconcurrent );
+        }
+
         for ( int iAlpha = 0; iAlpha < alphaVec.size(); iAlpha++ )
         {
             //Set current alpha value
@@ -1595,97 +1825,7 @@ string VSPAEROMgrSingleton::ComputeSolverSingle( FILE * logFile )
                     }
 
                     //====== Send command to be executed by the system at the command prompt ======//
-                    vector<string> args;
-                    // Set mach, alpha, beta (save to local "current*" variables to use as header information in the results manager)
-                    args.push_back( "-fs" );       // "freestream" override flag
-                    args.push_back( StringUtil::double_to_string( current_mach, "%.2f" ) );
-                    args.push_back( "END" );
-                    args.push_back( StringUtil::double_to_string( current_alpha, "%.3f" ) );
-                    args.push_back( "END" );
-                    args.push_back( StringUtil::double_to_string( current_beta, "%.3f" ) );
-                    args.push_back( "END" );
-                    // Set number of openmp threads
-                    args.push_back( "-omp" );
-                    args.push_back( StringUtil::int_to_string( m_NCPU.Get(), "%d" ) );
-                    // Set stability run arguments
-                    if ( stabilityType != vsp::STABILITY_OFF )
-                    {
-                        switch ( stabilityType )
-                        {
-                            case vsp::STABILITY_DEFAULT:
-                                args.push_back( "-stab" );
-                                break;
-
-                            case vsp::STABILITY_P_ANALYSIS:
-                                args.push_back( "-pstab" );
-                                break;
-
-                            case vsp::STABILITY_Q_ANALYSIS:
-                                args.push_back( "-qstab" );
-                                break;
-
-                            case vsp::STABILITY_R_ANALYSIS:
-                                args.push_back( "-rstab" );
-                                break;
-
-                            // === To Be Implemented ===
-                            //case vsp::STABILITY_HEAVE:
-                            //    AnalysisType = "HEAVE";
-                            //    break;
-
-                            //case vsp::STABILITY_IMPULSE:
-                            //    AnalysisType = "IMPULSE";
-                            //    break;
-                            
-                            //case vsp::STABILITY_UNSTEADY:
-                            //    args.push_back( "-unsteady" );
-                            //    break;
-                        }
-                    }
-
-                    if ( m_FromSteadyState() )
-                    {
-                        args.push_back( "-fromsteadystate" );
-                    }
-
-                    if ( m_GroundEffectToggle() )
-                    {
-                        args.push_back( "-groundheight" );
-                        args.push_back( StringUtil::double_to_string( m_GroundEffect(), "%f" ) );
-                    }
-
-                    if( m_Write2DFEMFlag() )
-                    {
-                        args.push_back( "-write2dfem" );
-                    }
-
-                    if ( m_Precondition() == vsp::PRECON_JACOBI )
-                    {
-                        args.push_back( "-jacobi" );
-                    }
-                    else if ( m_Precondition() == vsp::PRECON_SSOR )
-                    {
-                        args.push_back( "-ssor" );
-                    }
-
-                    if ( m_KTCorrection() )
-                    {
-                        args.push_back( "-dokt" );
-                    }
-
-                    if ( m_RotateBladesFlag() )
-                    {
-                        args.push_back( "-unsteady" );
-
-                        if ( m_HoverRampFlag() )
-                        {
-                            args.push_back( "-hoverramp" );
-                            args.push_back( StringUtil::double_to_string( m_HoverRamp(), "%f" ) );
-                        }
-                    }
-
-                    // Add model file name
-                    args.push_back( modelNameBase );
+                    vector<string> args = GetSolverArgs( current_mach, current_alpha, current_beta, GetSolverNumThreads(), modelNameBase );
 
                     //Print out execute command
                     string cmdStr = m_SolverProcess.PrettyCmd( veh->GetExePath(), veh->GetVSPAEROCmd(), args );
@@ -1728,6 +1868,11 @@ string VSPAEROMgrSingleton::ComputeSolverSingle( FILE * logFile )
                         ReadStabFile( stabFileName, res_id_vector, analysisMethod, stabilityType );      //*.STAB stability coeff file
                     }
 
+                    if ( DoAdjoint() )
+                    {
+                        ReadAdjointFile( adjointFileName, res_id_vector );
+                    }
+
                     // CpSlice Latest *.adb File if slices are defined
                     if ( m_CpSliceFlag() && m_CpSliceVec.size() > 0 )
                     {
@@ -1780,6 +1925,493 @@ string VSPAEROMgrSingleton::ComputeSolverSingle( FILE * logFile )
     }
 }
 
+// Unsteady, noise and Cp slice runs post-process the files of the latest case
+bool VSPAEROMgrSingleton::CanSplitCases()
+{
+    return !( m_RotateBladesFlag() || m_NoiseCalcFlag() || m_CpSliceFlag() );
+}
+
+/* GetSolverNumThreads()
+    Local solves share the cores with the rest of the process, so they are held to the
+    process thread budget.  Remote and cluster backends get the requested count.
+*/
+int VSPAEROMgrSingleton::GetSolverNumThreads()
+{
+    if ( !m_ExecBackend->IsLocal() )
+    {
+        return m_NCPU.Get();
+    }
+    return ThreadMgr.LimitThreads( m_NCPU.Get() );
+}
+
+/* GetNumConcurrentCases( ncase )
+    Thread scaling of a single VSPAERO solve flattens past VSPAERO_CASE_THREADS threads,
+    so larger core budgets are split among that many concurrent flight condition cases.
+    Remote and cluster backends run one case per slot, each with the full core budget.
+*/
+int VSPAEROMgrSingleton::GetNumConcurrentCases( int ncase )
+{
+    if ( !CanSplitCases() )
+    {
+        return 1;
+    }
+
+    if ( !m_ExecBackend->IsLocal() )
+    {
+        return max( 1, min( m_ExecBackend->GetNumSlots(), ncase ) );
+    }
+
+    int nconcurrent = GetSolverNumThreads() / VSPAERO_CASE_THREADS;
+
+    return max( 1, min( nconcurrent, ncase ) );
+}
+
+/* ComputeSolverConcurrent( logFile, alphaVec, betaVec, machVec, nconcurrent, batch_order )
+    Runs the flight condition sweep with up to nconcurrent VSPAERO processes at once.  Each
+    case runs on its own copy of the setup and geometry files, and results are read back
+    in sweep order so the result vector matches ComputeSolverSingle, or ComputeSolverBatch
+    when batch_order is set.  Cases are started through m_ExecBackend, which stages the
+    case files to and from remote hosts.
+*/
+string VSPAEROMgrSingleton::ComputeSolverConcurrent( FILE * logFile, const vector < double > &alphaVec, const vector < double > &betaVec, const vector < double > &machVec, int nconcurrent, bool batch_order )
+{
+    std::vector <string> res_id_vector;
+
+    Vehicle *veh = VehicleMgr.GetVehicle();
+    if ( !veh )
+    {
+        return string();
+    }
+
+    vsp::VSPAERO_ANALYSIS_METHOD analysisMethod = ( vsp::VSPAERO_ANALYSIS_METHOD )m_AnalysisMethod.Get();
+    vsp::VSPAERO_STABILITY_TYPE stabilityType = ( vsp::VSPAERO_STABILITY_TYPE )m_StabilityType.Get();
+
+    string geomFile = m_DegenFileFull;
+    string geomExt = string( ".csv" );
+    if ( analysisMethod == vsp::PANEL )
+    {
+        geomFile = m_CompGeomFileFull;
+        geomExt = string( ".tri" );
+    }
+    string stabExt = m_StabFile.substr( m_ModelNameBase.size() );
+
+    // Output files of a case, the last case in the sweep is left under the model name
+    vector < string > outExtVec;
+    outExtVec.push_back( ".history" );
+    outExtVec.push_back( ".lod" );
+    outExtVec.push_back( ".adb" );
+    outExtVec.push_back( ".adb.cases" );
+    outExtVec.push_back( ".fem" );
+    outExtVec.push_back( ".fem2d" );
+    outExtVec.push_back( ".polar" );
+    outExtVec.push_back( ".flt" );
+    outExtVec.push_back( stabExt );
+
+    // Perturbed geometry inputs for the adjoint design sensitivities, removed with the case
+    vector < string > adjointExtVec;
+    if ( DoAdjoint() )
+    {
+        outExtVec.push_back( ".adjoint" );
+
+        adjointExtVec.push_back( ".dvs" );
+        for ( int i = 0; i < ( int )DesignVarMgr.GetNumVars(); i++ )
+        {
+            adjointExtVec.push_back( string( "_dv" ) + to_string( i + 1 ) + string( ".csv" ) );
+        }
+    }
+    vector < string > caseExtVec = outExtVec;
+    caseExtVec.insert( caseExtVec.end(), adjointExtVec.begin(), adjointExtVec.end() );
+
+    // Flatten the sweep in the same alpha, beta, Mach order as the serial loops,
+    // or the beta, Mach, alpha order of a VSPAERO batch run
+    vector < double > caseAlpha, caseBeta, caseMach;
+    for ( int iAlpha = 0; iAlpha < alphaVec.size(); iAlpha++ )
+    {
+        for ( int iBeta = 0; iBeta < betaVec.size(); iBeta++ )
+        {
+            for ( int iMach = 0; iMach < machVec.size(); iMach++ )
+            {
+                caseAlpha.push_back( alphaVec[iAlpha] );
+                caseBeta.push_back( betaVec[iBeta] );
+                caseMach.push_back( machVec[iMach] );
+            }
+        }
+    }
+
+    if ( batch_order )
+    {
+        caseAlpha.clear();
+        caseBeta.clear();
+        caseMach.clear();
+        for ( int iBeta = 0; iBeta < betaVec.size(); iBeta++ )
+        {
+            for ( int iMach = 0; iMach < machVec.size(); iMach++ )
+            {
+                for ( int iAlpha = 0; iAlpha < alphaVec.size(); iAlpha++ )
+                {
+                    caseAlpha.push_back( alphaVec[iAlpha] );
+                    caseBeta.push_back( betaVec[iBeta] );
+                    caseMach.push_back( machVec[iMach] );
+                }
+            }
+        }
+    }
+
+    int ncase = caseAlpha.size();
+    int ncpu = m_ExecBackend->IsLocal() ? max( 1, GetSolverNumThreads() / nconcurrent ) : GetSolverNumThreads();
+
+    vector < string > caseBase( ncase );
+    vector < string > caseOutput( ncase );
+    vector < bool > caseDone( ncase, false );
+    vector < int > slotCase( nconcurrent, -1 );
+
+    m_CaseProcessVec.clear();
+    m_CaseProcessVec.resize( nconcurrent );
+    m_ConcurrentCasesRunning = true;
+
+    int bufsize = 16384;
+    char *buf = ( char* ) malloc( sizeof( char ) * ( bufsize + 1 ) );
+
+    int nextCase = 0;
+    int nextRead = 0;
+    while ( nextRead < ncase )
+    {
+        bool active = false;
+
+        // Start cases on free slots
+        for ( int islot = 0; islot < nconcurrent; islot++ )
+        {
+            if ( slotCase[islot] < 0 && nextCase < ncase && !m_SolverProcessKill )
+            {
+                int icase = nextCase++;
+                caseBase[icase] = m_ModelNameBase + string( "_case" ) + to_string( icase + 1 );
+
+                CopyFileContents( m_SetupFile, caseBase[icase] + string( ".vspaero" ) );
+                CopyFileContents( geomFile, caseBase[icase] + geomExt );
+                for ( size_t j = 0; j < adjointExtVec.size(); j++ )
+                {
+                    if ( FileExist( m_ModelNameBase + adjointExtVec[j] ) )
+                    {
+                        CopyFileContents( m_ModelNameBase + adjointExtVec[j], caseBase[icase] + adjointExtVec[j] );
+                    }
+                }
+                for ( size_t j = 0; j < outExtVec.size(); j++ )
+                {
+                    remove( ( caseBase[icase] + outExtVec[j] ).c_str() );
+                }
+
+                vector<string> args = GetSolverArgs( caseMach[icase], caseAlpha[icase], caseBeta[icase], ncpu, caseBase[icase] );
+                caseOutput[icase] = m_ExecBackend->PrettyCmd( islot, veh->GetExePath(), veh->GetVSPAEROCmd(), args );
+
+                if ( !m_ExecBackend->StageIn( islot, CaseFiles( caseBase[icase], geomExt, adjointExtVec ) ) )
+                {
+                    caseOutput[icase] += string( "Error: Could not stage case files to " ) + m_ExecBackend->GetName() + string( " slot " ) + to_string( islot ) + string( "\n" );
+                    caseDone[icase] = true;
+                    active = true;
+                    continue;
+                }
+
+                m_ExecBackend->Launch( islot, m_CaseProcessVec[islot], veh->GetExePath(), veh->GetVSPAEROCmd(), args );
+                slotCase[islot] = icase;
+                active = true;
+            }
+        }
+
+        // Drain solver output without blocking on idle pipes
+        for ( int islot = 0; islot < nconcurrent; islot++ )
+        {
+            int icase = slotCase[islot];
+            if ( icase < 0 )
+            {
+                continue;
+            }
+
+            bool running = m_CaseProcessVec[islot].IsRunning();
+
+            unsigned long navail = m_CaseProcessVec[islot].StdoutPipeBytesAvailable();
+            while ( navail > 0 )
+            {
+                unsigned long nread = 0;
+                m_CaseProcessVec[islot].ReadStdoutPipe( buf, min( ( int ) navail, bufsize ), &nread );
+                if ( nread == 0 || nread == ( unsigned long ) - 1 )
+                {
+                    break;
+                }
+                buf[nread] = 0;
+                StringUtil::change_from_to( buf, '\r', '\n' );
+                caseOutput[icase] += string( buf );
+                navail = m_CaseProcessVec[islot].StdoutPipeBytesAvailable();
+                active = true;
+            }
+
+            if ( !running )
+            {
+#ifdef WIN32
+                CloseHandle( m_CaseProcessVec[islot].m_StdoutPipe[0] );
+                m_CaseProcessVec[islot].m_StdoutPipe[0] = NULL;
+#else
+                close( m_CaseProcessVec[islot].m_StdoutPipe[0] );
+                m_CaseProcessVec[islot].m_StdoutPipe[0] = -1;
+#endif
+                if ( !m_SolverProcessKill )
+                {
+                    m_ExecBackend->StageOut( islot, CaseFiles( caseBase[icase], string(), outExtVec ) );
+                }
+                m_ExecBackend->Cleanup( islot, CaseFiles( caseBase[icase], geomExt, caseExtVec ) );
+                caseDone[icase] = true;
+                slotCase[islot] = -1;
+                active = true;
+            }
+        }
+
+        // Check if the kill solver flag has been raised, if so clean up once all cases stop
+        if ( m_SolverProcessKill )
+        {
+            bool anyRunning = false;
+            for ( int islot = 0; islot < nconcurrent; islot++ )
+            {
+                if ( slotCase[islot] >= 0 )
+                {
+                    m_CaseProcessVec[islot].Kill();
+                    anyRunning = true;
+                }
+            }
+
+            if ( !anyRunning )
+            {
+                for ( int icase = nextRead; icase < nextCase; icase++ )
+                {
+                    RemoveCaseFiles( caseBase[icase], geomExt, caseExtVec );
+                }
+
+                m_SolverProcessKill = false;    //reset kill flag
+                m_ConcurrentCasesRunning = false;
+                free( buf );
+
+                return string();    //return empty result ID vector
+            }
+        }
+
+        // Read finished cases in sweep order
+        while ( nextRead < ncase && caseDone[nextRead] && !m_SolverProcessKill )
+        {
+            int icase = nextRead++;
+
+            if( logFile )
+            {
+                fprintf( logFile, "%s", caseOutput[icase].c_str() );
+            }
+            else
+            {
+                MessageData data;
+                data.m_String = "VSPAEROSolverMessage";
+                data.m_StringVec.push_back( caseOutput[icase] );
+                MessageMgr::getInstance().Send( "ScreenMgr", NULL, data );
+            }
+            caseOutput[icase] = string();
+
+            ReadHistoryFile( caseBase[icase] + string( ".history" ), res_id_vector, analysisMethod );
+
+            ReadLoadFile( caseBase[icase] + string( ".lod" ), res_id_vector, analysisMethod );
+
+            if ( stabilityType != vsp::STABILITY_OFF )
+            {
+                ReadStabFile( caseBase[icase] + stabExt, res_id_vector, analysisMethod, stabilityType );      //*.STAB stability coeff file
+            }
+
+            if ( DoAdjoint() )
+            {
+                ReadAdjointFile( caseBase[icase] + string( ".adjoint" ), res_id_vector );
+            }
+
+            if ( icase == ncase - 1 )
+            {
+                for ( size_t j = 0; j < outExtVec.size(); j++ )
+                {
+                    string outFile = m_ModelNameBase + outExtVec[j];
+                    remove( outFile.c_str() );
+                    rename( ( caseBase[icase] + outExtVec[j] ).c_str(), outFile.c_str() );
+                }
+            }
+            RemoveCaseFiles( caseBase[icase], geomExt, caseExtVec );
+
+            // Send the message to update the screens
+            MessageData data;
+            data.m_String = "UpdateAllScreens";
+            MessageMgr::getInstance().Send( "ScreenMgr", NULL, data );
+        }
+
+        if ( !active )
+        {
+            SleepForMilliseconds( 100 );
+        }
+    }
+
+    free( buf );
+    m_ConcurrentCasesRunning = false;
+
+    // Create "wrapper" result to contain a vector of result IDs (this maintains compatibility to return a single result after computation)
+    Results *res = ResultsMgr.CreateResults( "VSPAERO_Wrapper" );
+    if( !res )
+    {
+        return string();
+    }
+    else
+    {
+        res->Add( NameValData( "ResultsVec", res_id_vector ) );
+        return res->GetID();
+    }
+}
+
+// Remove the inputs and any remaining outputs of a concurrent sweep case
+void VSPAEROMgrSingleton::RemoveCaseFiles( const string &caseBase, const string &geomExt, const vector < string > &outExtVec )
+{
+    remove( ( caseBase + string( ".vspaero" ) ).c_str() );
+    remove( ( caseBase + geomExt ).c_str() );
+
+    for ( size_t j = 0; j < outExtVec.size(); j++ )
+    {
+        remove( ( caseBase + outExtVec[j] ).c_str() );
+    }
+
+    // Component group coefficient files written by the solver
+    int igroup = 1;
+    while ( FileExist( caseBase + string( ".group." ) + to_string( igroup ) ) )
+    {
+        remove( ( caseBase + string( ".group." ) + to_string( igroup ) ).c_str() );
+        igroup++;
+    }
+}
+
+// Input files of a concurrent sweep case, when geomExt is given, and its outputs
+vector < string > VSPAEROMgrSingleton::CaseFiles( const string &caseBase, const string &geomExt, const vector < string > &outExtVec )
+{
+    vector < string > files;
+    if ( !geomExt.empty() )
+    {
+        files.push_back( caseBase + string( ".vspaero" ) );
+        files.push_back( caseBase + geomExt );
+    }
+
+    for ( size_t j = 0; j < outExtVec.size(); j++ )
+    {
+        files.push_back( caseBase + outExtVec[j] );
+    }
+    return files;
+}
+
+/* GetSolverArgs( mach, alpha, beta, ncpu, modelNameBase )
+    Command line arguments for a single steady or unsteady flight condition run of VSPAERO
+*/
+vector < string > VSPAEROMgrSingleton::GetSolverArgs( double mach, double alpha, double beta, int ncpu, const string &modelNameBase )
+{
+    vsp::VSPAERO_STABILITY_TYPE stabilityType = ( vsp::VSPAERO_STABILITY_TYPE )m_StabilityType.Get();
+
+    vector<string> args;
+    // Set mach, alpha, beta
+    args.push_back( "-fs" );       // "freestream" override flag
+    args.push_back( StringUtil::double_to_string( mach, "%.2f" ) );
+    args.push_back( "END" );
+    args.push_back( StringUtil::double_to_string( alpha, "%.3f" ) );
+    args.push_back( "END" );
+    args.push_back( StringUtil::double_to_string( beta, "%.3f" ) );
+    args.push_back( "END" );
+    // Set number of openmp threads
+    args.push_back( "-omp" );
+    args.push_back( StringUtil::int_to_string( ncpu, "%d" ) );
+    // Set stability run arguments
+    if ( stabilityType != vsp::STABILITY_OFF )
+    {
+        switch ( stabilityType )
+        {
+            case vsp::STABILITY_DEFAULT:
+                args.push_back( "-stab" );
+                break;
+
+            case vsp::STABILITY_P_ANALYSIS:
+                args.push_back( "-pstab" );
+                break;
+
+            case vsp::STABILITY_Q_ANALYSIS:
+                args.push_back( "-qstab" );
+                break;
+
+            case vsp::STABILITY_R_ANALYSIS:
+                args.push_back( "-rstab" );
+                break;
+
+            // === To Be Implemented ===
+            //case vsp::STABILITY_HEAVE:
+            //    AnalysisType = "HEAVE";
+            //    break;
+
+            //case vsp::STABILITY_IMPULSE:
+            //    AnalysisType = "IMPULSE";
+            //    break;
+            
+            //case vsp::STABILITY_UNSTEADY:
+            //    args.push_back( "-unsteady" );
+            //    break;
+        }
+    }
+
+    if ( m_FromSteadyState() )
+    {
+        args.push_back( "-fromsteadystate" );
+    }
+
+    if ( m_GroundEffectToggle() )
+    {
+        args.push_back( "-groundheight" );
+        args.push_back( StringUtil::double_to_string( m_GroundEffect(), "%f" ) );
+    }
+
+    if( m_Write2DFEMFlag() )
+    {
+        args.push_back( "-write2dfem" );
+    }
+
+    if ( DoAdjoint() )
+    {
+        args.push_back( "-adjoint" );
+    }
+
+    if ( m_Precondition() == vsp::PRECON_JACOBI )
+    {
+        args.push_back( "-jacobi" );
+    }
+    else if ( m_Precondition() == vsp::PRECON_SSOR )
+    {
+        args.push_back( "-ssor" );
+    }
+
+    if ( m_KTCorrection() )
+    {
+        args.push_back( "-dokt" );
+    }
+
+    if ( m_AdaptiveWakeFlag() )
+    {
+        args.push_back( "-adaptwake" );
+    }
+
+    if ( m_RotateBladesFlag() )
+    {
+        args.push_back( "-unsteady" );
+
+        if ( m_HoverRampFlag() )
+        {
+            args.push_back( "-hoverramp" );
+            args.push_back( StringUtil::double_to_string( m_HoverRamp(), "%f" ) );
+        }
+    }
+
+    // Add model file name
+    args.push_back( modelNameBase );
+
+    return args;
+}
+
 /* ComputeSolverBatch(FILE * logFile)
 */
 string VSPAEROMgrSingleton::ComputeSolverBatch( FILE * logFile )
@@ -1866,6 +2498,13 @@ string VSPAEROMgrSingleton::ComputeSolverBatch( FILE * logFile )
             }
         }
 
+        // Farm the sweep out one case per job when solving on remote hosts or a cluster
+        if ( !m_ExecBackend->IsLocal() && CanSplitCases() )
+        {
+            int ncase = alphaVec.size() * betaVec.size() * machVec.size();
+            return ComputeSolverConcurrent( logFile, alphaVec, betaVec, machVec, GetNumConcurrentCases( ncase ), true );
+        }
+
         //====== generate batch mode command to be executed by the system at the command prompt ======//
         vector<string> args;
         // Set mach, alpha, beta (save to local "current*" variables to use as header information in the results manager)
@@ -1893,7 +2532,7 @@ string VSPAEROMgrSingleton::ComputeSolverBatch( FILE * logFile )
 
         // Set number of openmp threads
         args.push_back( "-omp" );
-        args.push_back( StringUtil::int_to_string( m_NCPU.Get(), "%d" ) );
+        args.push_back( StringUtil::int_to_string( GetSolverNumThreads(), "%d" ) );
 
         // Set stability run arguments
         if ( stabilityType != vsp::STABILITY_OFF )
@@ -1947,6 +2586,11 @@ string VSPAEROMgrSingleton::ComputeSolverBatch( FILE * logFile )
             args.push_back( "-write2dfem" );
         }
 
+        if ( DoAdjoint() )
+        {
+            args.push_back( "-adjoint" );
+        }
+
         if ( m_Precondition() == vsp::PRECON_JACOBI )
         {
             args.push_back( "-jacobi" );
@@ -1961,6 +2605,11 @@ string VSPAEROMgrSingleton::ComputeSolverBatch( FILE * logFile )
             args.push_back( "-dokt" );
         }
 
+        if ( m_AdaptiveWakeFlag() )
+        {
+            args.push_back( "-adaptwake" );
+        }
+
         if ( m_RotateBladesFlag() )
         {
             args.push_back( "-unsteady" );
@@ -1989,11 +2638,23 @@ string VSPAEROMgrSingleton::ComputeSolverBatch( FILE * logFile )
             MessageMgr::getInstance().Send( "ScreenMgr", NULL, data );
         }
 
+        // Cases are read as the solver finishes them so partial sweeps can be plotted
+        VSPAEROCaseIngest ingest;
+        ingest.m_HistoryTail.Reset( historyFileName );
+        ingest.m_LoadTail.Reset( loadFileName );
+        ingest.m_StabTail.Reset( stabFileName );
+        ingest.m_AnalysisMethod = analysisMethod;
+        ingest.m_StabilityType = stabilityType;
+        ingest.m_UnsteadyFlag = unsteady_flag;
+        ingest.m_LastCheckTime = GetWallTime();
+
         // Execute VSPAero
         m_SolverProcess.ForkCmd( veh->GetExePath(), veh->GetVSPAEROCmd(), args );
 
         // ==== MonitorSolverProcess ==== //
+        m_CaseIngest = &ingest;
         MonitorSolver( logFile );
+        m_CaseIngest = NULL;
 
 
         // Check if the kill solver flag has been raised, if so clean up and return
@@ -2005,15 +2666,12 @@ string VSPAEROMgrSingleton::ComputeSolverBatch( FILE * logFile )
             return string();    //return empty result ID vector
         }
 
-        //====== Read in all of the results ======//
-        ReadHistoryFile( historyFileName, res_id_vector, analysisMethod, unsteady_flag );
-
-        ReadLoadFile( loadFileName, res_id_vector, analysisMethod );
+        //====== Read in the rest of the results ======//
+        IngestFinishedCases( ingest, true );
 
-        if ( stabilityType != vsp::STABILITY_OFF )
-        {
-            ReadStabFile( stabFileName, res_id_vector, analysisMethod, stabilityType );      //*.STAB stability coeff file
-        }
+        res_id_vector.insert( res_id_vector.end(), ingest.m_HistoryResIDs.begin(), ingest.m_HistoryResIDs.end() );
+        res_id_vector.insert( res_id_vector.end(), ingest.m_LoadResIDs.begin(), ingest.m_LoadResIDs.end() );
+        res_id_vector.insert( res_id_vector.end(), ingest.m_StabResIDs.begin(), ingest.m_StabResIDs.end() );
 
         // CpSlice *.adb File and slices are defined
         if ( m_CpSliceFlag() && m_CpSliceVec.size() > 0 )
@@ -2061,17 +2719,22 @@ string VSPAEROMgrSingleton::ComputeSolverBatch( FILE * logFile )
     }
 }
 
-void VSPAEROMgrSingleton::MonitorSolver( FILE * logFile )
+void VSPAEROMgrSingleton::MonitorSolver( FILE * logFile, ProcessUtil * process )
 {
+    if ( !process )
+    {
+        process = &m_SolverProcess;
+    }
+
     // ==== MonitorSolverProcess ==== //
-    int bufsize = 1000;
+    int bufsize = 16384;
     char *buf;
     buf = ( char* ) malloc( sizeof( char ) * ( bufsize + 1 ) );
     unsigned long nread = 1;
-    bool runflag = m_SolverProcess.IsRunning();
+    bool runflag = process->IsRunning();
     while ( runflag || ( nread > 0 && nread != ( unsigned long ) - 1 ) )
     {
-        m_SolverProcess.ReadStdoutPipe( buf, bufsize, &nread );
+        process->ReadStdoutPipe( buf, bufsize, &nread );
         if( nread > 0 && nread != ( unsigned long ) - 1 )
         {
             if ( buf )
@@ -2091,22 +2754,75 @@ void VSPAEROMgrSingleton::MonitorSolver( FILE * logFile )
                 }
             }
         }
+        else if ( nread == 0 )
+        {
+            // Pipe closed, the process is about to exit
+            SleepForMilliseconds( 1 );
+        }
+        else
+        {
+            // Wake on new output or process exit rather than sleeping a fixed interval
+            process->WaitForStdout( 100 );
+        }
+        runflag = process->IsRunning();
 
-        SleepForMilliseconds( 100 );
-        runflag = m_SolverProcess.IsRunning();
+        // Pick up cases the solver has finished, at most twice a second
+        if ( m_CaseIngest && runflag && GetWallTime() - m_CaseIngest->m_LastCheckTime > 0.5 )
+        {
+            IngestFinishedCases( *m_CaseIngest, false );
+            m_CaseIngest->m_LastCheckTime = GetWallTime();
+        }
     }
 
 #ifdef WIN32
-    CloseHandle( m_SolverProcess.m_StdoutPipe[0] );
-    m_SolverProcess.m_StdoutPipe[0] = NULL;
+    CloseHandle( process->m_StdoutPipe[0] );
+    process->m_StdoutPipe[0] = NULL;
 #else
-    close( m_SolverProcess.m_StdoutPipe[0] );
-    m_SolverProcess.m_StdoutPipe[0] = -1;
+    close( process->m_StdoutPipe[0] );
+    process->m_StdoutPipe[0] = -1;
 #endif
 
     free( buf );
 }
 
+//==== Read Cases The Solver Has Finished Writing ====//
+void VSPAEROMgrSingleton::IngestFinishedCases( VSPAEROCaseIngest & ingest, bool solver_done )
+{
+    bool new_cases = false;
+
+    if ( ingest.m_HistoryTail.Update( solver_done ) )
+    {
+        ReadHistoryFile( ingest.m_HistoryTail.GetFileName(), ingest.m_HistoryResIDs, ingest.m_AnalysisMethod, ingest.m_UnsteadyFlag,
+                         ingest.m_HistoryTail.GetReadOffset(), ingest.m_HistoryTail.GetCompleteOffset() );
+        ingest.m_HistoryTail.MarkRead();
+        new_cases = true;
+    }
+
+    if ( ingest.m_LoadTail.Update( solver_done ) )
+    {
+        ReadLoadFile( ingest.m_LoadTail.GetFileName(), ingest.m_LoadResIDs, ingest.m_AnalysisMethod,
+                      ingest.m_LoadTail.GetReadOffset(), ingest.m_LoadTail.GetCompleteOffset() );
+        ingest.m_LoadTail.MarkRead();
+        new_cases = true;
+    }
+
+    if ( ingest.m_StabilityType != vsp::STABILITY_OFF && ingest.m_StabTail.Update( solver_done ) )
+    {
+        ReadStabFile( ingest.m_StabTail.GetFileName(), ingest.m_StabResIDs, ingest.m_AnalysisMethod, ingest.m_StabilityType,
+                      ingest.m_StabTail.GetReadOffset(), ingest.m_StabTail.GetCompleteOffset() );
+        ingest.m_StabTail.MarkRead();
+        new_cases = true;
+    }
+
+    // The caller updates the screens once the run is done
+    if ( new_cases && !solver_done )
+    {
+        MessageData data;
+        data.m_String = "UpdateAllScreens";
+        MessageMgr::getInstance().Send( "ScreenMgr", NULL, data );
+    }
+}
+
 void VSPAEROMgrSingleton::AddResultHeader( string res_id, double mach, double alpha, double beta, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod )
 {
     // Add Flow Condition header to each result
@@ -2120,12 +2836,12 @@ void VSPAEROMgrSingleton::AddResultHeader( string res_id, double mach, double al
 // helper thread functions for VSPAERO GUI interface and multi-threaded impleentation
 bool VSPAEROMgrSingleton::IsSolverRunning()
 {
-    return m_SolverProcess.IsRunning();
+    return m_SolverProcess.IsRunning() || m_ConcurrentCasesRunning;
 }
 
 void VSPAEROMgrSingleton::KillSolver()
 {
-    // Raise flag to break the compute solver thread
+    // Raise flag to break the compute solver thread, concurrent cases are killed by that thread
     m_SolverProcessKill = true;
     return m_SolverProcess.Kill();
 }
@@ -2138,18 +2854,29 @@ ProcessUtil* VSPAEROMgrSingleton::GetSolverProcess()
 // function is used to wait for the result to show up on the file system
 int VSPAEROMgrSingleton::WaitForFile( string filename )
 {
+    // Callers wait only after the writer has finished, so an existing file is complete
+    if ( FileExist( filename ) )
+    {
+        return vsp::VSP_OK;
+    }
+
     // Wait until the results show up on the file system
     int n_wait = 0;
     // wait no more than 5 seconds = (50*100)/1000
     while ( ( !FileExist( filename ) ) & ( n_wait < 50 ) )
     {
+        // Solver and slicer exit only after closing their output, so nothing more is coming
+        if ( !VSPAEROMgr.IsSolverRunning() && !VSPAEROMgr.m_SlicerThread.IsRunning() )
+        {
+            break;
+        }
         n_wait++;
         SleepForMilliseconds( 100 );
     }
-    SleepForMilliseconds( 100 );  //additional wait for file
 
     if ( FileExist( filename ) )
     {
+        SleepForMilliseconds( 100 );  //additional wait for a file that just appeared
         return vsp::VSP_OK;
     }
     else
@@ -2167,8 +2894,10 @@ line 4407 - void VSP_SOLVER::OutputZeroLiftDragToStatusFile(void)
 TODO:
 - Update this function to use the generic table read as used in: string VSPAEROMgrSingleton::ReadStabFile()
 *******************************************************/
-void VSPAEROMgrSingleton::ReadHistoryFile( string filename, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod, bool unsteady_analysis_flag )
+void VSPAEROMgrSingleton::ReadHistoryFile( string filename, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod, bool unsteady_analysis_flag, long start_offset, long end_offset )
 {
+    PERF_SCOPE( "VSPAERO::ReadHistoryFile" );
+
     //TODO return success or failure
     FILE *fp = NULL;
     //size_t result;
@@ -2183,11 +2912,16 @@ void VSPAEROMgrSingleton::ReadHistoryFile( string filename, vector <string> &res
         return;
     }
 
+    if ( start_offset > 0 )
+    {
+        fseek( fp, start_offset, SEEK_SET );
+    }
+
     Results* res = NULL;
     std::vector<string> data_string_array;
 
     char seps[]   = " :,\t\n";
-    while ( !feof( fp ) )
+    while ( !feof( fp ) && ( end_offset < 0 || ftell( fp ) < end_offset ) )
     {
         data_string_array = ReadDelimLine( fp, seps ); //this is also done in some of the embedded loops below
 
@@ -2378,6 +3112,49 @@ void VSPAEROMgrSingleton::ReadHistoryFile( string filename, vector <string> &res
 
         } // end of wake iteration
 
+        //READ solver timing table
+        /* Example solver timing table
+        Solver Timings:
+
+        Phase                                        Calls      Time
+        Setup                                            1       0.00078
+        InteractionLists                                 1       0.02869
+        ...
+        GMRESIterations                                  5
+        MatrixMultiplies                                15
+        */
+        if ( data_string_array.size() == 2 && strcmp( data_string_array[0].c_str(), "Solver" ) == 0 && strcmp( data_string_array[1].c_str(), "Timings" ) == 0 )
+        {
+            //skip ahead to the header row
+            data_string_array = ReadDelimLine( fp, seps );
+            while ( data_string_array.size() == 0 && !feof( fp ) )
+            {
+                data_string_array = ReadDelimLine( fp, seps );
+            }
+
+            //discard the header row and read the phase timers and counters
+            data_string_array = ReadDelimLine( fp, seps );
+
+            while ( data_string_array.size() == 2 || data_string_array.size() == 3 )
+            {
+                if ( res )
+                {
+                    if ( data_string_array.size() == 3 )
+                    {
+                        res->Add( NameValData( "Timing_" + data_string_array[0], std::stod( data_string_array[2] ) ) );
+                        res->Add( NameValData( "Calls_" + data_string_array[0], std::stoi( data_string_array[1] ) ) );
+                    }
+                    else
+                    {
+                        res->Add( NameValData( "Count_" + data_string_array[0], std::stoi( data_string_array[1] ) ) );
+                    }
+                }
+
+                data_string_array = ReadDelimLine( fp, seps );
+            }
+
+        } // end of solver timings
+
     } //end feof loop to read entire history file
 
     fclose ( fp );
@@ -2393,8 +3170,10 @@ TODO:
 - Update this function to use the generic table read as used in: string VSPAEROMgrSingleton::ReadStabFile()
 - Read in Component table information, this is the 2nd table at the bottom of the .lod file
 *******************************************************/
-void VSPAEROMgrSingleton::ReadLoadFile( string filename, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod )
+void VSPAEROMgrSingleton::ReadLoadFile( string filename, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod, long start_offset, long end_offset )
 {
+    PERF_SCOPE( "VSPAERO::ReadLoadFile" );
+
     FILE *fp = NULL;
     bool read_success = false;
 
@@ -2407,6 +3186,11 @@ void VSPAEROMgrSingleton::ReadLoadFile( string filename, vector <string> &res_id
         return;
     }
 
+    if ( start_offset > 0 )
+    {
+        fseek( fp, start_offset, SEEK_SET );
+    }
+
     Results* res = NULL;
     std::vector< std::string > data_string_array;
     std::vector< std::vector< double > > data_array;
@@ -2414,7 +3198,7 @@ void VSPAEROMgrSingleton::ReadLoadFile( string filename, vector <string> &res_id
     double cref = 1.0;
 
     char seps[]   = " :,\t\n";
-    while ( !feof( fp ) )
+    while ( !feof( fp ) && ( end_offset < 0 || ftell( fp ) < end_offset ) )
     {
         data_string_array = ReadDelimLine( fp, seps ); //this is also done in some of the embedded loops below
 
@@ -2507,30 +3291,30 @@ void VSPAEROMgrSingleton::ReadLoadFile( string filename, vector <string> &res_id
             }
 
             // Finish up by adding the data to the result res
-            res->Add( NameValData( "WingId", WingId ) );
-            res->Add( NameValData( "S", S ) );
-            res->Add( NameValData( "Yavg", Yavg ) );
-            res->Add( NameValData( "Chord", Chord ) );
-            res->Add( NameValData( "V/Vref", VoVref ) );
-            res->Add( NameValData( "cl", Cl ) );
-            res->Add( NameValData( "cd", Cd ) );
-            res->Add( NameValData( "cs", Cs ) );
-            res->Add( NameValData( "cx", Cx ) );
-            res->Add( NameValData( "cy", Cy ) );
-            res->Add( NameValData( "cz", Cz ) );
-            res->Add( NameValData( "cmx", Cmx ) );
-            res->Add( NameValData( "cmy", Cmy ) );
-            res->Add( NameValData( "cmz", Cmz ) );
-
-            res->Add( NameValData( "cl*c/cref", Clc_cref ) );
-            res->Add( NameValData( "cd*c/cref", Cdc_cref ) );
-            res->Add( NameValData( "cs*c/cref", Csc_cref ) );
-            res->Add( NameValData( "cx*c/cref", Cxc_cref ) );
-            res->Add( NameValData( "cy*c/cref", Cyc_cref ) );
-            res->Add( NameValData( "cz*c/cref", Czc_cref ) );
-            res->Add( NameValData( "cmx*c/cref", Cmxc_cref ) );
-            res->Add( NameValData( "cmy*c/cref", Cmyc_cref ) );
-            res->Add( NameValData( "cmz*c/cref", Cmzc_cref ) );
+            res->Add( NameValData( "WingId", std::move( WingId ) ) );
+            res->Add( NameValData( "S", std::move( S ) ) );
+            res->Add( NameValData( "Yavg", std::move( Yavg ) ) );
+            res->Add( NameValData( "Chord", std::move( Chord ) ) );
+            res->Add( NameValData( "V/Vref", std::move( VoVref ) ) );
+            res->Add( NameValData( "cl", std::move( Cl ) ) );
+            res->Add( NameValData( "cd", std::move( Cd ) ) );
+            res->Add( NameValData( "cs", std::move( Cs ) ) );
+            res->Add( NameValData( "cx", std::move( Cx ) ) );
+            res->Add( NameValData( "cy", std::move( Cy ) ) );
+            res->Add( NameValData( "cz", std::move( Cz ) ) );
+            res->Add( NameValData( "cmx", std::move( Cmx ) ) );
+            res->Add( NameValData( "cmy", std::move( Cmy ) ) );
+            res->Add( NameValData( "cmz", std::move( Cmz ) ) );
+
+            res->Add( NameValData( "cl*c/cref", std::move( Clc_cref ) ) );
+            res->Add( NameValData( "cd*c/cref", std::move( Cdc_cref ) ) );
+            res->Add( NameValData( "cs*c/cref", std::move( Csc_cref ) ) );
+            res->Add( NameValData( "cx*c/cref", std::move( Cxc_cref ) ) );
+            res->Add( NameValData( "cy*c/cref", std::move( Cyc_cref ) ) );
+            res->Add( NameValData( "cz*c/cref", std::move( Czc_cref ) ) );
+            res->Add( NameValData( "cmx*c/cref", std::move( Cmxc_cref ) ) );
+            res->Add( NameValData( "cmy*c/cref", std::move( Cmyc_cref ) ) );
+            res->Add( NameValData( "cmz*c/cref", std::move( Cmzc_cref ) ) );
 
         } // end sectional table read
 
@@ -2545,8 +3329,10 @@ void VSPAEROMgrSingleton::ReadLoadFile( string filename, vector <string> &res_id
 Read .STAB file output from VSPAERO
 See: VSP_Solver.C in vspaero project
 *******************************************************/
-void VSPAEROMgrSingleton::ReadStabFile( string filename, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod, vsp::VSPAERO_STABILITY_TYPE stabilityType )
+void VSPAEROMgrSingleton::ReadStabFile( string filename, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod, vsp::VSPAERO_STABILITY_TYPE stabilityType, long start_offset, long end_offset )
 {
+    PERF_SCOPE( "VSPAERO::ReadStabFile" );
+
     FILE *fp = NULL;
     bool read_success = false;
     WaitForFile( filename );
@@ -2557,6 +3343,11 @@ void VSPAEROMgrSingleton::ReadStabFile( string filename, vector <string> &res_id
         return;
     }
 
+    if ( start_offset > 0 )
+    {
+        fseek( fp, start_offset, SEEK_SET );
+    }
+
     Results* res = NULL;
 
     std::vector<string> table_column_names;
@@ -2564,7 +3355,7 @@ void VSPAEROMgrSingleton::ReadStabFile( string filename, vector <string> &res_id
 
     // Read in all of the data into the results manager
     char seps[] = " :,\t\n";
-    while ( !feof( fp ) )
+    while ( !feof( fp ) && ( end_offset < 0 || ftell( fp ) < end_offset ) )
     {
         data_string_array = ReadDelimLine( fp, seps ); //this is also done in some of the embedded loops below
 
@@ -2712,6 +3503,127 @@ void VSPAEROMgrSingleton::ReadStabFile( string filename, vector <string> &res_id
     return;
 }
 
+/*******************************************************
+Read .ADJOINT file output from VSPAERO
+    Each case holds the CL, CDi, CMy and E values followed by their
+    sensitivities to the design variables and to the mesh nodes
+*******************************************************/
+void VSPAEROMgrSingleton::ReadAdjointFile( string filename, vector <string> &res_id_vector )
+{
+    PERF_SCOPE( "VSPAERO::ReadAdjointFile" );
+
+    WaitForFile( filename );
+    FILE *fp = fopen( filename.c_str() , "r" );
+    if ( fp == NULL )
+    {
+        fprintf( stderr, "ERROR %d: Could not open Adjoint file: %s\n\tFile: %s \tLine:%d\n", vsp::VSP_FILE_DOES_NOT_EXIST, filename.c_str(), __FILE__, __LINE__ );
+        return;
+    }
+
+    Results* res = NULL;
+
+    std::vector<string> data_string_array;
+
+    char seps[] = " :,\t\n";
+    while ( !feof( fp ) )
+    {
+        data_string_array = ReadDelimLine( fp, seps );
+
+        if ( CheckForCaseHeader( data_string_array ) )
+        {
+            res = ResultsMgr.CreateResults( "VSPAERO_Adjoint" );
+            res_id_vector.push_back( res->GetID() );
+
+            if ( ReadVSPAEROCaseHeader( res, fp, vsp::VORTEX_LATTICE ) != 0 )
+            {
+                fprintf( stderr, "ERROR %d: Could not read case header in VSPAERO file: %s\n\tFile: %s \tLine:%d\n", vsp::VSP_FILE_READ_FAILURE, filename.c_str(), __FILE__, __LINE__ );
+                fclose( fp );
+                return;
+            }
+        }
+        else if ( res && data_string_array.size() == 2 && strcmp( data_string_array[0].c_str(), "DesignVariables" ) == 0 )
+        {
+            int ndv = atoi( data_string_array[1].c_str() );
+
+            // Skip the column names
+            ReadDelimLine( fp, seps );
+
+            vector < string > parm_ids;
+            vector < double > dcl, dcdi, dcmy, de;
+
+            for ( int i = 0; i < ndv && !feof( fp ); i++ )
+            {
+                data_string_array = ReadDelimLine( fp, seps );
+                if ( data_string_array.size() < 6 )
+                {
+                    break;
+                }
+
+                dcl.push_back( atof( data_string_array[1].c_str() ) );
+                dcdi.push_back( atof( data_string_array[2].c_str() ) );
+                dcmy.push_back( atof( data_string_array[3].c_str() ) );
+                de.push_back( atof( data_string_array[4].c_str() ) );
+                parm_ids.push_back( data_string_array[5] );
+            }
+
+            res->Add( NameValData( "DV_ParmID", parm_ids ) );
+            res->Add( NameValData( "dCL_dDV", dcl ) );
+            res->Add( NameValData( "dCDi_dDV", dcdi ) );
+            res->Add( NameValData( "dCMy_dDV", dcmy ) );
+            res->Add( NameValData( "dE_dDV", de ) );
+        }
+        else if ( res && data_string_array.size() == 2 && strcmp( data_string_array[0].c_str(), "Nodes" ) == 0 )
+        {
+            int nnode = atoi( data_string_array[1].c_str() );
+
+            // Skip the column names
+            ReadDelimLine( fp, seps );
+
+            vector < vec3d > pnts, dcl, dcdi, dcmy;
+            pnts.reserve( nnode );
+            dcl.reserve( nnode );
+            dcdi.reserve( nnode );
+            dcmy.reserve( nnode );
+
+            for ( int i = 0; i < nnode && !feof( fp ); i++ )
+            {
+                data_string_array = ReadDelimLine( fp, seps );
+                if ( data_string_array.size() < 13 )
+                {
+                    break;
+                }
+
+                vector < double > v( 12 );
+                for ( int j = 0; j < 12; j++ )
+                {
+                    v[j] = atof( data_string_array[j + 1].c_str() );
+                }
+
+                pnts.push_back( vec3d( v[0], v[1], v[2] ) );
+                dcl.push_back( vec3d( v[3], v[4], v[5] ) );
+                dcdi.push_back( vec3d( v[6], v[7], v[8] ) );
+                dcmy.push_back( vec3d( v[9], v[10], v[11] ) );
+            }
+
+            res->Add( NameValData( "Node", pnts ) );
+            res->Add( NameValData( "dCL_dNode", dcl ) );
+            res->Add( NameValData( "dCDi_dNode", dcdi ) );
+            res->Add( NameValData( "dCMy_dNode", dcmy ) );
+        }
+        else if ( res && data_string_array.size() == 2 )
+        {
+            // CL, CDi, CMy and E
+            double value;
+            if ( sscanf( data_string_array[1].c_str(), "%lf", &value ) == 1 )
+            {
+                res->Add( NameValData( data_string_array[0], value ) );
+            }
+        }
+    }
+
+    fclose( fp );
+}
+
 vector <string> VSPAEROMgrSingleton::ReadDelimLine( FILE * fp, char * delimeters )
 {
 
@@ -3321,7 +4233,7 @@ string VSPAEROMgrSingleton::ExecuteCpSlicer( FILE * logFile )
     m_SlicerThread.ForkCmd( veh->GetExePath(), veh->GetSLICERCmd(), args );
 
     // ==== MonitorSolverProcess ==== //
-    MonitorSolver( logFile );
+    MonitorSolver( logFile, &m_SlicerThread );
 
     // Write out new results
     Results* res = ResultsMgr.CreateResults( "CpSlice_Wrapper" );
@@ -3489,9 +4401,18 @@ void VSPAEROMgrSingleton::ClearCpSliceVec()
 
 void VSPAEROMgrSingleton::ReadSliceFile( string filename, vector <string> &res_id_vector )
 {
+    PERF_SCOPE( "VSPAERO::ReadSliceFile" );
+
     FILE *fp = NULL;
     bool read_success = false;
     WaitForFile( filename );
+
+    // The slicer writes a binary copy of the slices alongside the text file, which is much faster to load
+    if ( ReadBinarySliceFile( filename + ".bin", res_id_vector ) )
+    {
+        return;
+    }
+
     fp = fopen( filename.c_str(), "r" );
     if ( fp == NULL )
     {
@@ -3561,17 +4482,17 @@ void VSPAEROMgrSingleton::ReadSliceFile( string filename, vector <string> &res_i
                 skip = true;
 
                 //Add to the results manager
-                res->Add( NameValData( "X_Loc", x_data_vec ) );
-                res->Add( NameValData( "Y_Loc", y_data_vec ) );
-                res->Add( NameValData( "Z_Loc", z_data_vec ) );
+                res->Add( NameValData( "X_Loc", std::move( x_data_vec ) ) );
+                res->Add( NameValData( "Y_Loc", std::move( y_data_vec ) ) );
+                res->Add( NameValData( "Z_Loc", std::move( z_data_vec ) ) );
 
                 if ( m_CpSliceAnalysisType == vsp::VORTEX_LATTICE )
                 {
-                    res->Add( NameValData( "dCp", Cp_data_vec ) );
+                    res->Add( NameValData( "dCp", std::move( Cp_data_vec ) ) );
                 }
                 else if ( m_CpSliceAnalysisType == vsp::PANEL )
                 {
-                    res->Add( NameValData( "Cp", Cp_data_vec ) );
+                    res->Add( NameValData( "Cp", std::move( Cp_data_vec ) ) );
                 }
             } // end of cut data
         }
@@ -3582,6 +4503,106 @@ void VSPAEROMgrSingleton::ReadSliceFile( string filename, vector <string> &res_i
     return;
 }
 
+bool VSPAEROMgrSingleton::ReadBinarySliceFile( string filename, vector <string> &res_id_vector )
+{
+    FILE *fp = fopen( filename.c_str(), "rb" );
+    if ( fp == NULL )
+    {
+        return false;
+    }
+
+    // Header: coded id, number of cases, number of cuts, model type
+    int header[4];
+    if ( fread( header, sizeof( int ), 4, fp ) != 4 || header[0] != -123456789 )
+    {
+        std::fclose( fp );
+        return false;
+    }
+
+    int num_slice = header[1] * header[2];
+    vector < Results* > res_vec;
+
+    // Each slice: case, cut, cut type, cut location, Mach, Alpha, Beta, number of points, then x, y, z, Cp per point
+    bool read_success = true;
+    for ( int i = 0; i < num_slice && read_success; i++ )
+    {
+        int slice_int[3];
+        float slice_float[4];
+        int num_pnt;
+
+        if ( fread( slice_int, sizeof( int ), 3, fp ) != 3 ||
+             fread( slice_float, sizeof( float ), 4, fp ) != 4 ||
+             fread( &num_pnt, sizeof( int ), 1, fp ) != 1 || num_pnt < 0 )
+        {
+            read_success = false;
+            break;
+        }
+
+        vector < float > pnt_data( 4 * num_pnt );
+        if ( num_pnt > 0 && fread( &pnt_data[0], sizeof( float ), 4 * num_pnt, fp ) != (size_t)( 4 * num_pnt ) )
+        {
+            read_success = false;
+            break;
+        }
+
+        Results* res = ResultsMgr.CreateResults( "CpSlicer_Case" );
+        res_vec.push_back( res );
+
+        res->Add( NameValData( "Cut_Type", slice_int[2] - 1 ) );
+        res->Add( NameValData( "Cut_Loc", (double)slice_float[0] ) );
+        res->Add( NameValData( "Cut_Num", slice_int[1] ) );
+        res->Add( NameValData( "Case", slice_int[0] ) );
+        res->Add( NameValData( "Mach", (double)slice_float[1] ) );
+        res->Add( NameValData( "Alpha", (double)slice_float[2] ) );
+        res->Add( NameValData( "Beta", (double)slice_float[3] ) );
+
+        if ( num_pnt > 0 )
+        {
+            vector < double > x_data_vec( num_pnt ), y_data_vec( num_pnt ), z_data_vec( num_pnt ), Cp_data_vec( num_pnt );
+
+            for ( int j = 0; j < num_pnt; j++ )
+            {
+                x_data_vec[j] = pnt_data[4 * j];
+                y_data_vec[j] = pnt_data[4 * j + 1];
+                z_data_vec[j] = pnt_data[4 * j + 2];
+                Cp_data_vec[j] = pnt_data[4 * j + 3];
+            }
+
+            res->Add( NameValData( "X_Loc", x_data_vec ) );
+            res->Add( NameValData( "Y_Loc", y_data_vec ) );
+            res->Add( NameValData( "Z_Loc", z_data_vec ) );
+
+            if ( m_CpSliceAnalysisType == vsp::VORTEX_LATTICE )
+            {
+                res->Add( NameValData( "dCp", Cp_data_vec ) );
+            }
+            else if ( m_CpSliceAnalysisType == vsp::PANEL )
+            {
+                res->Add( NameValData( "Cp", Cp_data_vec ) );
+            }
+        }
+    }
+
+    std::fclose( fp );
+
+    // Truncated file, drop what was read and let the text file be parsed instead
+    if ( !read_success )
+    {
+        for ( size_t i = 0; i < res_vec.size(); i++ )
+        {
+            ResultsMgr.DeleteResult( res_vec[i]->GetID() );
+        }
+        return false;
+    }
+
+    for ( size_t i = 0; i < res_vec.size(); i++ )
+    {
+        res_id_vector.push_back( res_vec[i]->GetID() );
+    }
+
+    return true;
+}
+
 bool VSPAEROMgrSingleton::ValidUnsteadyGroupInd( int index )
 {
     if ( (int)m_UnsteadyGroupVec.size() > 0 && index >= 0 && index < (int)m_UnsteadyGroupVec.size() )
@@ -4861,6 +5882,87 @@ void CpSlice::LoadDrawObj( vector < DrawObj* > &draw_obj_vec, int id, bool highl
     }
 }
 
+/*##############################################################################
+#                                                                              #
+#                          VSPAEROCaseFileTail                                 #
+#                                                                              #
+##############################################################################*/
+
+VSPAEROCaseFileTail::VSPAEROCaseFileTail()
+{
+    Reset( string() );
+}
+
+void VSPAEROCaseFileTail::Reset( const string & file_name )
+{
+    m_FileName = file_name;
+    m_ReadOffset = 0;
+    m_ScanOffset = 0;
+    m_CompleteOffset = 0;
+    m_HeaderFound = false;
+}
+
+bool VSPAEROCaseFileTail::Update( bool writer_done )
+{
+    FILE* fp = fopen( m_FileName.c_str(), "r" );
+    if ( !fp )
+    {
+        return false;
+    }
+
+    // Only lines written since the last scan are read
+    fseek( fp, m_ScanOffset, SEEK_SET );
+
+    char seps[] = " :,\t\n\r";
+    char buf[1024];
+    string line;
+    while ( fgets( buf, 1024, fp ) != NULL )
+    {
+        line += buf;
+
+        // Wait for the rest of a line that is still being written
+        if ( line[ line.size() - 1 ] != '\n' && !feof( fp ) )
+        {
+            continue;
+        }
+        if ( line[ line.size() - 1 ] != '\n' && !writer_done )
+        {
+            break;
+        }
+
+        vector < string > data_string_array;
+        char * pch = strtok( &line[0], seps );
+        while ( pch != NULL )
+        {
+            data_string_array.push_back( pch );
+            pch = strtok( NULL, seps );
+        }
+
+        // Everything before a case header belongs to finished cases
+        if ( VSPAEROMgrSingleton::CheckForCaseHeader( data_string_array ) )
+        {
+            if ( m_HeaderFound )
+            {
+                m_CompleteOffset = m_ScanOffset;
+            }
+            m_HeaderFound = true;
+        }
+
+        m_ScanOffset = ftell( fp );
+        line.clear();
+    }
+
+    if ( writer_done && m_HeaderFound )
+    {
+        fseek( fp, 0, SEEK_END );
+        m_CompleteOffset = ftell( fp );
+    }
+
+    fclose( fp );
+
+    return m_CompleteOffset > m_ReadOffset;
+}
+
 /*##############################################################################
 #                                                                              #
 #                              RotorDisk                                       #
@@ -209,6 +209,53 @@ private:
     int m_SelectedCompIndex;
 };
 
+//==== Follows A VSPAERO Output File While The Solver Appends Cases To It ====//
+class VSPAEROCaseFileTail
+{
+public:
+    VSPAEROCaseFileTail();
+
+    void Reset( const string & file_name );
+
+    // Scans lines written since the last call.  A case is complete once the
+    // next case header appears, or when the writer is done.  Returns true if
+    // complete cases are waiting to be read.
+    bool Update( bool writer_done );
+
+    // Unread complete cases span [ GetReadOffset(), GetCompleteOffset() )
+    long GetReadOffset() const                  { return m_ReadOffset; }
+    long GetCompleteOffset() const              { return m_CompleteOffset; }
+    void MarkRead()                             { m_ReadOffset = m_CompleteOffset; }
+
+    const string & GetFileName() const          { return m_FileName; }
+
+private:
+    string m_FileName;
+    long m_ReadOffset;
+    long m_ScanOffset;                          // Start of the first line not yet scanned
+    long m_CompleteOffset;
+    bool m_HeaderFound;
+};
+
+//==== Cases Of A Batch Run Read While The Solver Is Still Running ====//
+struct VSPAEROCaseIngest
+{
+    VSPAEROCaseFileTail m_HistoryTail;
+    VSPAEROCaseFileTail m_LoadTail;
+    VSPAEROCaseFileTail m_StabTail;
+
+    // Kept per file so the final result order matches reading each file whole
+    vector < string > m_HistoryResIDs;
+    vector < string > m_LoadResIDs;
+    vector < string > m_StabResIDs;
+
+    vsp::VSPAERO_ANALYSIS_METHOD m_AnalysisMethod;
+    vsp::VSPAERO_STABILITY_TYPE m_StabilityType;
+    bool m_UnsteadyFlag;
+
+    double m_LastCheckTime;
+};
+
 //==== VSPAERO Manager ====//
 class VSPAEROMgrSingleton : public ParmContainer
 {
@@ -274,7 +321,10 @@ public:
     string ComputeSolver( FILE * logFile = NULL ); // returns a result with a vector of results id's under the name ResultVec
     string ComputeSolverBatch( FILE * logFile = NULL );
     string ComputeSolverSingle( FILE * logFile = NULL );
+    string ComputeSolverConcurrent( FILE * logFile, const vector < double > &alphaVec, const vector < double > &betaVec, const vector < double > &machVec, int nconcurrent, bool batch_order = false );
     ProcessUtil* GetSolverProcess();
+    ExecBackend* GetExecBackend()                           { return m_ExecBackend; }
+    void SetExecBackend( const string & spec );             // See ExecBackend::Create
     bool IsSolverRunning();
     void KillSolver();
 
@@ -355,6 +405,7 @@ public:
     string m_HistoryFile;
     string m_LoadFile;
     string m_StabFile;
+    string m_AdjointFile;
     string m_CutsFile;
     string m_SliceFile;
     string m_GroupsFile;
@@ -389,6 +440,7 @@ public:
     IntParm m_NCPU;
     BoolParm m_FixedWakeFlag;
     IntParm m_WakeNumIter;
+    BoolParm m_AdaptiveWakeFlag;
     PowIntParm m_NumWakeNodes;
 
     // Other Setup Parameters
@@ -402,6 +454,7 @@ public:
     BoolParm m_KTCorrection;
     BoolParm m_Symmetry;
     BoolParm m_Write2DFEMFlag;
+    BoolParm m_AdjointFlag;
     BoolParm m_ClMaxToggle;
     Parm m_ClMax;
     BoolParm m_MaxTurnToggle;
@@ -506,21 +559,49 @@ protected:
 
     string m_LastPanelMeshGeomId;
 
+    // Geometry file reuse
+    string BuildGeometryHash( const vector < string > & geom_vec );
+    bool GeometryFilesValid( const string & hash );
+    string m_GeometryHash;
+
+    // Perturbed geometry files for the adjoint design sensitivities
+    void WriteAdjointDesignFiles();
+    bool DoAdjoint();
+
     static int WaitForFile( string filename );  // function is used to wait for the result to show up on the file system
     void GetSweepVectors( vector<double> &alphaVec, vector<double> &betaVec, vector<double> &machVec );
 
-    void MonitorSolver( FILE * logFile );
+    void MonitorSolver( FILE * logFile, ProcessUtil * process = NULL );
     bool m_SolverProcessKill;
 
+    // incremental reading of batch run results
+    friend class VSPAEROCaseFileTail;
+    void IngestFinishedCases( VSPAEROCaseIngest & ingest, bool solver_done );
+    VSPAEROCaseIngest* m_CaseIngest;            // Non NULL while MonitorSolver should read finished cases
+
+    // helper functions for concurrent flight condition cases
+    bool CanSplitCases();
+    int GetSolverNumThreads();
+    int GetNumConcurrentCases( int ncase );
+    vector < string > GetSolverArgs( double mach, double alpha, double beta, int ncpu, const string &modelNameBase );
+    static void RemoveCaseFiles( const string &caseBase, const string &geomExt, const vector < string > &outExtVec );
+    static vector < string > CaseFiles( const string &caseBase, const string &geomExt, const vector < string > &outExtVec );
+    vector < ProcessUtil > m_CaseProcessVec;
+    bool m_ConcurrentCasesRunning;
+    ExecBackend* m_ExecBackend;                 // Where concurrent cases run, local unless VSP_EXEC_BACKEND is set
+
     // helper functions for VSPAERO files
-    void ReadHistoryFile( string filename, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod, bool unsteady_analysis_flag = false );
-    void ReadLoadFile( string filename, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod );
-    void ReadStabFile( string filename, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod, vsp::VSPAERO_STABILITY_TYPE stabilityType );
+    // start_offset and end_offset limit reading to a range of whole cases, -1 reads to the end
+    void ReadHistoryFile( string filename, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod, bool unsteady_analysis_flag = false, long start_offset = 0, long end_offset = -1 );
+    void ReadLoadFile( string filename, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod, long start_offset = 0, long end_offset = -1 );
+    void ReadStabFile( string filename, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod, vsp::VSPAERO_STABILITY_TYPE stabilityType, long start_offset = 0, long end_offset = -1 );
+    void ReadAdjointFile( string filename, vector <string> &res_id_vector );
     static vector <string> ReadDelimLine( FILE * fp, char * delimeters );
     static bool CheckForCaseHeader( std::vector<string> headerStr );
     static bool CheckForResultHeader( std::vector < string > headerstr );
     static int ReadVSPAEROCaseHeader( Results * res, FILE * fp, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod );
     void ReadSliceFile( string filename, vector <string> &res_id_vector );
+    bool ReadBinarySliceFile( string filename, vector <string> &res_id_vector );
     void ReadGroupResFile( string filename, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod, string group_name = "" );
     void ReadRotorResFile( string filename, vector <string> &res_id_vector, vsp::VSPAERO_ANALYSIS_METHOD analysisMethod, string group_name = "" );
 
@@ -529,6 +610,7 @@ protected:
 
 private:
     VSPAEROMgrSingleton();
+    virtual ~VSPAEROMgrSingleton();
     VSPAEROMgrSingleton( VSPAEROMgrSingleton const& copy );            // Not Implemented
     VSPAEROMgrSingleton& operator=( VSPAEROMgrSingleton const& copy ); // Not Implemented
 
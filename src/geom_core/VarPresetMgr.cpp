@@ -560,13 +560,23 @@ void VarPresetMgrSingleton::ApplySetting()
     {
         vector <string> p_IDs = m_PresetVec[ group_index ].GetParmIDs();
         vector <double> p_val = m_PresetVec[ group_index ].GetParmVals( m_CurSettingIndex );
+
+        // Apply as one batch, so each changed Geom updates once, parents before children,
+        // and the whole setting is a single undo step
+        Vehicle* veh = VehicleMgr.GetVehicle();
+        veh->BeginParmBatch();
+
         for ( int j = 0; j < p_IDs.size(); j++ )
         {
             // Change Values in ParmScreen
-            ParmMgr.FindParm( p_IDs[ j ] )->Set( p_val[ j ] );
+            Parm* p = ParmMgr.FindParm( p_IDs[ j ] );
+            if ( p )
+            {
+                p->Set( p_val[ j ] );
+            }
         }
 
-        VehicleMgr.GetVehicle()->Update();
+        veh->EndParmBatch();
     }
 }
 
@@ -5,6 +5,9 @@
 //
 //////////////////////////////////////////////////////////////////////
 
+// Ahead of the STEP headers, whose nullptr macro <thread> cannot parse
+#include <thread>
+
 #include "Vehicle.h"
 #include "PodGeom.h"
 #include "FuselageGeom.h"
@@ -36,6 +39,7 @@
 #include "SVGUtil.h"
 #include "FitModelMgr.h"
 #include "FileUtil.h"
+#include "ProcessUtil.h"
 #include "VarPresetMgr.h"
 #include "VSPAEROMgr.h"
 #include "WireGeom.h"
@@ -44,12 +48,29 @@
 #include "ProjectionMgr.h"
 #include "DXFUtil.h"
 #include "DegenGeom.h"
+#include "PerfStats.h"
+#include "ThreadMgr.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 using namespace vsp;
 
+bool Vehicle::m_HeadlessFlag = false;
+
+//==== Background Save Thread ====//
+struct SaveWorker
+{
+    std::thread m_Thread;
+};
+
 //==== Constructor ====//
 Vehicle::Vehicle()
 {
+    // Read VSP_NUM_THREADS before the first parallel region of the main thread.
+    ThreadMgr.ApplyToThread();
+
     m_STEPLenUnit.Init( "LenUnit", "STEPSettings", this, vsp::LEN_FT, vsp::LEN_MM, vsp::LEN_YD );
     m_STEPTol.Init( "Tolerance", "STEPSettings", this, 1e-6, 1e-12, 1e12 );
     m_STEPSplitSurfs.Init( "SplitSurfs", "STEPSettings", this, true, 0, 1 );
@@ -149,8 +170,25 @@ Vehicle::Vehicle()
     m_AFAppendGeomIDFlag.SetDescript( "Airfoil W Tessellation Factor" );
 
     m_STLMultiSolid.Init( "MultiSolid", "STLSettings", this, false, 0, 1 );
+    m_STLBinary.Init( "Binary", "STLSettings", this, false, 0, 1 );
+    m_STLBinary.SetDescript( "Flag to write binary rather than ASCII STL" );
     m_STLExportPropMainSurf.Init( "ExportPropMainSurf", "STLSettings", this, false, 0, 1 );
 
+    m_ParmBatchDepth = 0;
+    m_ParmBatchVehicleFlag = false;
+    m_DeferDeviceUpdates = false;
+    m_DeferGeomLoadFlag = false;
+    m_TMeshTessStride = 1;
+    m_UpdateTime = 0;
+
+    m_SaveWorker = new SaveWorker;
+    m_SaveInProgress = false;
+    m_SaveResult = true;
+    m_AutoSaveInterval = 0;
+    m_LastAutoSaveTime = 0;
+    m_AutoSaveChangeCnt = -1;
+
+    m_BBoxFullUpdate = true;
     m_UpdatingBBox = false;
     m_BbXLen.Init( "X_Len", "BBox", this, 0, 0, 1e12 );
     m_BbXLen.SetDescript( "X length of vehicle bounding box" );
@@ -169,6 +207,21 @@ Vehicle::Vehicle()
     m_exportDragBuildTsvFile.Init( "DragBuild_TSV_Export", "ExportFlag", this, true, 0, 1 );
     m_exportDegenGeomCsvFile.Init( "DegenGeom_CSV_Export", "ExportFlag", this, true, 0, 1 );
     m_exportDegenGeomMFile.Init( "DegenGeom_M_Export", "ExportFlag", this, true, 0, 1 );
+    m_exportDegenGeomBinFile.Init( "DegenGeom_Bin_Export", "ExportFlag", this, false, 0, 1 );
+
+    m_CompGeomIncremental.Init( "Incremental", "CompGeom", this, false, 0, 1 );
+    m_CompGeomIncremental.SetDescript( "Reuse intersections of unchanged component pairs between CompGeom runs" );
+    m_CompGeomSymm.Init( "XZSymmetry", "CompGeom", this, false, 0, 1 );
+    m_CompGeomSymm.SetDescript( "Trim only the +Y half of models symmetric about the XZ plane and mirror it for CompGeom and MassProps" );
+    m_CompGeomTessStride.Init( "TessStride", "CompGeom", this, 1, 1, 64 );
+    m_CompGeomTessStride.SetDescript( "Keep every Nth point of the display tessellation for quick-look CompGeom and MassProps" );
+    m_CompGeomErrorEst.Init( "ErrorEstimate", "CompGeom", this, false, 0, 1 );
+    m_CompGeomErrorEst.SetDescript( "Estimate CompGeom and MassProps tessellation error from a second run at twice the stride" );
+    m_DegenGeomIncremental.Init( "Incremental", "DegenGeom", this, true, 0, 1 );
+    m_DegenGeomIncremental.SetDescript( "Regenerate DegenGeom only for Geoms changed since the last run" );
+
+    m_ParallelUpdate.Init( "ParallelUpdate", "Update", this, true, 0, 1 );
+    m_ParallelUpdate.SetDescript( "Update independent top level components concurrently" );
 
     m_AxisLength.Init( "AxisLength", "Axis", this, 1.0, 1e-12, 1e12 );
     m_AxisLength.SetDescript( "Length of axis icon displayed on screen" );
@@ -195,6 +248,9 @@ Vehicle::Vehicle()
 //==== Destructor ====//
 Vehicle::~Vehicle()
 {
+    WaitForSave();
+    delete m_SaveWorker;
+
     LinkMgr.UnRegisterContainer( this->GetID() );
 
     for ( int i = 0 ; i < ( int )m_GeomStoreVec.size() ; i++ )
@@ -304,6 +360,7 @@ void Vehicle::Init()
     m_SVGView4_rot.Set( vsp::ROT_0 );
 
     m_STLMultiSolid.Set( false );
+    m_STLBinary.Set( false );
     m_STLExportPropMainSurf.Set( false );
 
     m_BEMPropID = string();
@@ -313,6 +370,10 @@ void Vehicle::Init()
     m_AFAppendGeomIDFlag.Set( true );
     m_AFFileDir = string();
 
+    m_ParmBatchDepth = 0;
+    m_ParmBatchGeomVec.clear();
+    m_ParmBatchVehicleFlag = false;
+
     m_UpdatingBBox = false;
     m_BbXLen.Set( 0 );
     m_BbYLen.Set( 0 );
@@ -325,6 +386,15 @@ void Vehicle::Init()
     m_exportDragBuildTsvFile.Set( true );
     m_exportDegenGeomCsvFile.Set( true );
     m_exportDegenGeomMFile.Set( true );
+    m_exportDegenGeomBinFile.Set( false );
+
+    m_CompGeomIncremental.Set( false );
+    m_CompGeomSymm.Set( false );
+    m_CompGeomTessStride.Set( 1 );
+    m_CompGeomErrorEst.Set( false );
+    m_DegenGeomIncremental.Set( true );
+
+    m_ParallelUpdate.Set( true );
 
     AnalysisMgr.Init();
 }
@@ -368,6 +438,7 @@ void Vehicle::Wype()
     }
 
     m_GeomStoreVec.clear();
+    m_GeomIDMap.clear();
 
     m_ActiveGeom.clear();
     m_TopGeom.clear();
@@ -378,9 +449,15 @@ void Vehicle::Wype()
     m_GeomTypeVec.clear();
 
     m_BBox = BndBox();
+    m_BBoxFullUpdate = true;
+    m_BBoxDirtyGeomVec.clear();
+    m_GeomBBoxMap.clear();
 
     m_ExportFileNames.clear();
 
+    m_CompGeomCache.Clear();
+    m_DegenGeomCache.clear();
+
     // Clear out various managers...
     LinkMgr.Renew();
     AdvLinkMgr.Renew();
@@ -457,6 +534,12 @@ void Vehicle::ParmChanged( Parm* parm_ptr, int type )
         return;
     }
 
+    if ( InParmBatch() )
+    {
+        m_ParmBatchVehicleFlag = true;
+        return;
+    }
+
     m_UpdatingBBox = true;
     UpdateBBox();
     m_UpdatingBBox = false;
@@ -466,34 +549,462 @@ void Vehicle::ParmChanged( Parm* parm_ptr, int type )
         ForceUpdate();
     }
 
-    UpdateGui();
+    if ( parm_ptr )
+    {
+        UpdateGui( parm_ptr->GetContainerID() );
+    }
+    else
+    {
+        UpdateGui();
+    }
+}
+
+//==== Defer Updates Until The Matching EndParmBatch ====//
+// Batches nest; only the outermost EndParmBatch updates.
+void Vehicle::BeginParmBatch()
+{
+    m_ParmBatchDepth++;
+    ParmMgr.BeginUndoGroup();
+}
+
+void Vehicle::EndParmBatch()
+{
+    if ( m_ParmBatchDepth <= 0 )
+    {
+        return;
+    }
+
+    m_ParmBatchDepth--;
+    ParmMgr.EndUndoGroup();
+
+    if ( m_ParmBatchDepth == 0 )
+    {
+        UpdateParmBatch();
+    }
+}
+
+//==== Record A Geom Whose Update Was Deferred By A Batch ====//
+void Vehicle::AddParmBatchGeom( const string & geom_id )
+{
+    if ( !vector_contains_val( m_ParmBatchGeomVec, geom_id ) )
+    {
+        m_ParmBatchGeomVec.push_back( geom_id );
+    }
+}
+
+//==== Update Geoms Whose Device Changes Were Deferred ====//
+// Deferred Geoms wait in the batch list, so only the latest values of a drag
+// are rebuilt, once per flush.
+void Vehicle::FlushDeferredUpdates()
+{
+    if ( InParmBatch() || m_ParmBatchGeomVec.empty() )
+    {
+        return;
+    }
+
+    UpdateParmBatch();
+}
+
+//==== Update Each Geom Changed In A Batch Once ====//
+// The hierarchy is walked from the top Geoms down.  A changed Geom updates its
+// children, so changed Geoms below it are covered and not updated again.
+void Vehicle::UpdateParmBatch()
+{
+    vector< string > batch_vec = m_ParmBatchGeomVec;
+    bool veh_flag = m_ParmBatchVehicleFlag;
+
+    m_ParmBatchGeomVec.clear();
+    m_ParmBatchVehicleFlag = false;
+
+    if ( batch_vec.empty() && !veh_flag )
+    {
+        return;
+    }
+
+    double start_time = GetWallTime();
+
+    stack< Geom* > geom_stack;
+    vector< Geom* > top_vec = FindGeomVec( m_TopGeom );
+    for ( int i = ( int )top_vec.size() - 1 ; i >= 0 ; i-- )
+    {
+        geom_stack.push( top_vec[i] );
+    }
+
+    while ( !geom_stack.empty() )
+    {
+        Geom* geom_ptr = geom_stack.top();
+        geom_stack.pop();
+
+        if ( !geom_ptr )
+        {
+            continue;
+        }
+
+        if ( vector_contains_val( batch_vec, geom_ptr->GetID() ) )
+        {
+            geom_ptr->SetStagedUpdateFlag( true );
+            geom_ptr->Update();
+            continue;
+        }
+
+        vector< Geom* > child_vec = FindGeomVec( geom_ptr->GetChildIDVec() );
+        for ( int i = ( int )child_vec.size() - 1 ; i >= 0 ; i-- )
+        {
+            geom_stack.push( child_vec[i] );
+        }
+    }
+
+    AddUpdateTime( GetWallTime() - start_time );
+
+    if ( veh_flag )
+    {
+        ParmChanged( NULL, Parm::SET_FROM_DEVICE );
+        return;
+    }
+
+    //==== Only Geoms Changed, So Only Their Screens Need Refreshing ====//
+    m_UpdatingBBox = true;
+    UpdateBBox();
+    m_UpdatingBBox = false;
+
+    for ( int i = 0 ; i < ( int )batch_vec.size() ; i++ )
+    {
+        UpdateGui( batch_vec[i] );
+    }
+}
+
+//==== Enter Or Leave Headless Mode ====//
+// Entering releases the display buffers.  Leaving only marks them stale, so
+// they are rebuilt as each Geom's draw objects are next fetched.
+void Vehicle::SetHeadless( bool flag )
+{
+    if ( flag == m_HeadlessFlag )
+    {
+        return;
+    }
+
+    m_HeadlessFlag = flag;
+
+    for ( int i = 0 ; i < ( int )m_GeomStoreVec.size() ; i++ )
+    {
+        if ( flag )
+        {
+            m_GeomStoreVec[i]->PurgeDrawObjs();
+        }
+        m_GeomStoreVec[i]->MarkDrawObjStale();
+    }
+
+    if ( !flag )
+    {
+        UpdateGui();
+    }
+}
+
+//==== Defer Every Geom Whose Subtree Is Hidden ====//
+// Parms, links and sets are all decoded, only the surface builds wait until a
+// Geom is shown or its surfaces are fetched by an export or analysis.
+void Vehicle::DeferHiddenGeoms()
+{
+    for ( int i = 0 ; i < ( int )m_GeomStoreVec.size() ; i++ )
+    {
+        Geom* geom_ptr = m_GeomStoreVec[i];
+        if ( geom_ptr->CanDeferLoad() && IsGeomTreeHidden( geom_ptr ) )
+        {
+            geom_ptr->SetDeferredFlag( true );
+        }
+    }
+}
+
+//==== A Geom Defers Only When Nothing Drawn Depends On It ====//
+bool Vehicle::IsGeomTreeHidden( Geom* geom_ptr )
+{
+    if ( !geom_ptr->m_GuiDraw.GetNoShowFlag() )
+    {
+        return false;
+    }
+
+    vector< string > child_id_vec = geom_ptr->GetChildIDVec();
+    for ( int i = 0 ; i < ( int )child_id_vec.size() ; i++ )
+    {
+        Geom* child_ptr = FindGeom( child_id_vec[i] );
+        if ( child_ptr && !IsGeomTreeHidden( child_ptr ) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//==== Build Every Deferred Geom ====//
+void Vehicle::LoadDeferredGeoms()
+{
+    for ( int i = 0 ; i < ( int )m_GeomStoreVec.size() ; i++ )
+    {
+        m_GeomStoreVec[i]->LoadDeferred();
+    }
+    UpdateBBox();
+}
+
+int Vehicle::GetNumDeferredGeoms()
+{
+    int ndeferred = 0;
+    for ( int i = 0 ; i < ( int )m_GeomStoreVec.size() ; i++ )
+    {
+        if ( m_GeomStoreVec[i]->IsDeferred() )
+        {
+            ndeferred++;
+        }
+    }
+    return ndeferred;
 }
 
 //==== Update All Screens ====//
 void Vehicle::UpdateGui()
 {
+    if ( m_HeadlessFlag )
+    {
+        return;
+    }
+
     MessageMgr::getInstance().Send( "ScreenMgr", "UpdateAllScreens" );
 }
 
+//==== Update Screens Showing One Changed Container ====//
+// ScreenMgr folds these into its next refresh, and skips Geom screens
+// that show none of the changed containers.
+void Vehicle::UpdateGui( const string & container_id )
+{
+    if ( m_HeadlessFlag )
+    {
+        return;
+    }
+
+    MessageData data;
+    data.m_String = "UpdateAllScreens";
+    data.m_StringVec.push_back( container_id );
+    MessageMgr::getInstance().Send( "ScreenMgr", data );
+}
+
 //==== Undo Last Parameter Change ====//
+// Groups of changes are restored in one batch, so each Geom updates once.
 void Vehicle::UnDo()
 {
+    BeginParmBatch();
     ParmMgr.UnDo();
+    EndParmBatch();
+}
+
+//==== Lock For Readers On Other Threads ====//
+RWLock* Vehicle::GetStateLock()
+{
+#ifdef _OPENMP
+    if ( omp_in_parallel() )
+    {
+        return NULL;
+    }
+#endif
+    return &m_StateLock;
 }
 
 //===== Update All Geometry ====//
 void Vehicle::Update( bool fullupdate )
 {
-    for ( int i = 0 ; i < ( int )m_TopGeom.size() ; i++ )
+    WriteLockGuard lock( GetStateLock() );
+    PERF_SCOPE( "Vehicle::Update" );
+
+    double start_time = GetWallTime();
+
+    //==== Parm Changes On Every Thread Read The Link Graph, So It Is Built Here ====//
+    LinkMgr.UpdateLinkGraph();
+
+    vector< Geom* > parallel_vec;
+    vector< Geom* > serial_vec;
+    BuildUpdateSchedule( parallel_vec, serial_vec );
+
+    //==== Independent Subtrees, Most Expensive First ====//
+    #pragma omp parallel for schedule( dynamic, 1 ) if ( parallel_vec.size() > 1 )
+    for ( int i = 0 ; i < ( int )parallel_vec.size() ; i++ )
     {
-        Geom* g_ptr = FindGeom( m_TopGeom[i] );
-        if ( g_ptr )
+        parallel_vec[i]->SetStagedUpdateFlag( true );
+        parallel_vec[i]->Update( fullupdate );
+    }
+
+    //==== Linked Or Unsafe Subtrees In Hierarchy Order ====//
+    for ( int i = 0 ; i < ( int )serial_vec.size() ; i++ )
+    {
+        serial_vec[i]->SetStagedUpdateFlag( true );
+        serial_vec[i]->Update( fullupdate );
+    }
+
+    MeasureMgr.Update();
+
+    AddUpdateTime( GetWallTime() - start_time );
+}
+
+//==== Return And Clear Time Spent Updating Geoms ====//
+double Vehicle::TakeUpdateTime()
+{
+    double t = m_UpdateTime;
+    m_UpdateTime = 0;
+    return t;
+}
+
+void Vehicle::AddMemoryUsage( GeomMemUsage & usage )
+{
+    for ( int i = 0 ; i < ( int )m_GeomStoreVec.size() ; i++ )
+    {
+        m_GeomStoreVec[i]->AddMemoryUsage( usage );
+    }
+}
+
+void Vehicle::PurgeDrawObjs()
+{
+    for ( int i = 0 ; i < ( int )m_GeomStoreVec.size() ; i++ )
+    {
+        m_GeomStoreVec[i]->PurgeDrawObjs();
+        m_GeomStoreVec[i]->MarkDrawObjStale();
+    }
+}
+
+void Vehicle::PurgeTessCache()
+{
+    for ( int i = 0 ; i < ( int )m_GeomStoreVec.size() ; i++ )
+    {
+        m_GeomStoreVec[i]->PurgeTessCache();
+    }
+    m_SnapTo.ClearMeshCache();
+    m_DegenGeomCache.clear();
+}
+
+//==== Split Top Geoms Into Subtrees That May Update Concurrently And Serially ====//
+// A top Geom and its descendants form one subtree.  Attachments only reach up the
+// hierarchy, so distinct subtrees are independent unless a Parm link or advanced
+// link crosses them, or one of their Geoms touches shared state while updating.
+// Those subtrees are updated serially, in m_TopGeom order, after the rest.
+void Vehicle::BuildUpdateSchedule( vector< Geom* > & parallel_vec, vector< Geom* > & serial_vec )
+{
+    parallel_vec.clear();
+    serial_vec = FindGeomVec( m_TopGeom );
+
+    int num_threads = 1;
+#ifdef _OPENMP
+    if ( !omp_in_parallel() )
+    {
+        num_threads = omp_get_max_threads();
+    }
+#endif
+
+    if ( !m_ParallelUpdate() || num_threads < 2 || serial_vec.size() < 2 )
+    {
+        return;
+    }
+
+    vector< Geom* > top_vec = serial_vec;
+    serial_vec.clear();
+
+    //==== Map Every Geom To Its Subtree ====//
+    map< string, int > top_index_map;
+    vector< int > cost_vec( top_vec.size(), 0 );
+    vector< bool > serial_flag_vec( top_vec.size(), false );
+
+    for ( int i = 0 ; i < ( int )top_vec.size() ; i++ )
+    {
+        vector< string > stack_vec( 1, top_vec[i]->GetID() );
+        while ( !stack_vec.empty() )
+        {
+            Geom* g_ptr = FindGeom( stack_vec.back() );
+            stack_vec.pop_back();
+
+            if ( !g_ptr || top_index_map.find( g_ptr->GetID() ) != top_index_map.end() )
+            {
+                continue;
+            }
+
+            top_index_map[ g_ptr->GetID() ] = i;
+            cost_vec[i]++;
+
+            if ( !g_ptr->IsParallelUpdateSafe() )
+            {
+                serial_flag_vec[i] = true;
+            }
+
+            vector< string > child_vec = g_ptr->GetChildIDVec();
+            stack_vec.insert( stack_vec.end(), child_vec.begin(), child_vec.end() );
+        }
+    }
+
+    //==== Subtrees Owning Linked Parms Propagate Into Each Other ====//
+    vector< string > link_parm_vec;
+    for ( int i = 0 ; i < LinkMgr.GetNumLinks() ; i++ )
+    {
+        Link* pl = LinkMgr.GetLink( i );
+        if ( pl )
         {
-            g_ptr->Update( fullupdate );
+            link_parm_vec.push_back( pl->GetParmA() );
+            link_parm_vec.push_back( pl->GetParmB() );
         }
     }
 
-    MeasureMgr.Update();
+    vector< AdvLink* > adv_link_vec = AdvLinkMgr.GetLinks();
+    for ( int i = 0 ; i < ( int )adv_link_vec.size() ; i++ )
+    {
+        vector< VarDef > input_vec = adv_link_vec[i]->GetInputVars();
+        for ( int j = 0 ; j < ( int )input_vec.size() ; j++ )
+        {
+            link_parm_vec.push_back( input_vec[j].m_ParmID );
+        }
+
+        vector< VarDef > output_vec = adv_link_vec[i]->GetOutputVars();
+        for ( int j = 0 ; j < ( int )output_vec.size() ; j++ )
+        {
+            link_parm_vec.push_back( output_vec[j].m_ParmID );
+        }
+    }
+
+    for ( int i = 0 ; i < ( int )link_parm_vec.size() ; i++ )
+    {
+        Parm* parm_ptr = ParmMgr.FindParm( link_parm_vec[i] );
+        ParmContainer* pc = parm_ptr ? parm_ptr->GetContainer() : NULL;
+
+        //==== XSecs, SubSurfs etc. Nest Inside Their Geom ====//
+        while ( pc )
+        {
+            map< string, int >::iterator iter = top_index_map.find( pc->GetID() );
+            if ( iter != top_index_map.end() )
+            {
+                serial_flag_vec[ iter->second ] = true;
+                break;
+            }
+            pc = pc->GetParentContainerPtr();
+        }
+    }
+
+    vector< pair< int, int > > cost_index_vec;
+    for ( int i = 0 ; i < ( int )top_vec.size() ; i++ )
+    {
+        if ( serial_flag_vec[i] )
+        {
+            serial_vec.push_back( top_vec[i] );
+        }
+        else
+        {
+            cost_index_vec.push_back( make_pair( -cost_vec[i], i ) );
+        }
+    }
+
+    //==== Nothing To Overlap - Keep Hierarchy Order ====//
+    if ( cost_index_vec.size() < 2 )
+    {
+        serial_vec = top_vec;
+        return;
+    }
+
+    sort( cost_index_vec.begin(), cost_index_vec.end() );
+
+    for ( int i = 0 ; i < ( int )cost_index_vec.size() ; i++ )
+    {
+        parallel_vec.push_back( top_vec[ cost_index_vec[i].second ] );
+    }
 }
 
 void Vehicle::UpdateGeom( const string &geom_id )
@@ -532,14 +1043,68 @@ Geom* Vehicle::FindGeom( const string & geom_id )
     {
         return NULL;
     }
+
+    unordered_map< string, Geom* >::iterator iter = m_GeomIDMap.find( geom_id );
+    if ( iter != m_GeomIDMap.end() )
+    {
+        return iter->second;
+    }
+    return NULL;
+}
+
+//==== Keep Geom ID Index In Sync With Geom Store ====//
+void Vehicle::AddToGeomStore( Geom* geom_ptr )
+{
+    m_GeomStoreVec.push_back( geom_ptr );
+    m_BBoxFullUpdate = true;
+
+    // First stored Geom wins on duplicate IDs, as with a front to back search.
+    m_GeomIDMap.insert( make_pair( geom_ptr->GetID(), geom_ptr ) );
+}
+
+void Vehicle::RemoveFromGeomStore( Geom* geom_ptr )
+{
+    vector_remove_val( m_GeomStoreVec, geom_ptr );
+    m_BBoxFullUpdate = true;
+
+    unordered_map< string, Geom* >::iterator iter = m_GeomIDMap.find( geom_ptr->GetID() );
+    if ( iter != m_GeomIDMap.end() && iter->second == geom_ptr )
+    {
+        m_GeomIDMap.erase( iter );
+
+        //==== Fall Back To Any Other Geom Sharing The ID ====//
+        for ( int i = 0 ; i < ( int )m_GeomStoreVec.size() ; i++ )
+        {
+            if ( m_GeomStoreVec[i]->IsMatch( geom_ptr->GetID() ) )
+            {
+                m_GeomIDMap[ geom_ptr->GetID() ] = m_GeomStoreVec[i];
+                break;
+            }
+        }
+    }
+}
+
+//==== Called By Geom::ChangeID ====//
+void Vehicle::GeomIDChanged( const string & old_id, Geom* geom_ptr )
+{
+    unordered_map< string, Geom* >::iterator iter = m_GeomIDMap.find( old_id );
+    if ( iter == m_GeomIDMap.end() || iter->second != geom_ptr )
+    {
+        return;         // Not (yet) stored
+    }
+
+    m_GeomIDMap.erase( iter );
+
     for ( int i = 0 ; i < ( int )m_GeomStoreVec.size() ; i++ )
     {
-        if ( m_GeomStoreVec[i]->IsMatch( geom_id ) )
+        if ( m_GeomStoreVec[i]->IsMatch( old_id ) )
         {
-            return m_GeomStoreVec[i];
+            m_GeomIDMap[ old_id ] = m_GeomStoreVec[i];
+            break;
         }
     }
-    return NULL;
+
+    m_GeomIDMap.insert( make_pair( geom_ptr->GetID(), geom_ptr ) );
 }
 
 //==== Find Vector of Geom Ptrs Based on GeomID ====//
@@ -630,7 +1195,7 @@ string Vehicle::CreateGeom( const GeomType & type )
         return "NONE";
     }
 
-    m_GeomStoreVec.push_back( new_geom );
+    AddToGeomStore( new_geom );
 
     Geom* type_geom_ptr = FindGeom( type.m_GeomID );
     if ( type_geom_ptr )
@@ -703,6 +1268,8 @@ string Vehicle::AddGeom( const GeomType & type )
 //=== Create Geom and Set Up Parent/Child ====//
 string Vehicle::AddGeom( Geom* add_geom )
 {
+    WriteLockGuard lock( GetStateLock() );
+
     if ( !add_geom )
     {
         return string( "NONE" );
@@ -731,7 +1298,7 @@ string Vehicle::AddGeom( Geom* add_geom )
     return add_id;
 }
 
-string Vehicle::AddMeshGeom( int set )
+string Vehicle::AddMeshGeom( int set, int tess_stride )
 {
     ClearActiveGeom();
 
@@ -757,6 +1324,7 @@ string Vehicle::AddMeshGeom( int set )
     }
 
     // Create TMeshVec
+    m_TMeshTessStride = max( tess_stride, 1 );
     for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
     {
         Geom* g_ptr = FindGeom( geom_vec[i] );
@@ -772,6 +1340,7 @@ string Vehicle::AddMeshGeom( int set )
             }
         }
     }
+    m_TMeshTessStride = 1;
 
     SetActiveGeom( id );
     return id;
@@ -855,6 +1424,8 @@ bool Vehicle::IsGeomActive( const string & geom_id )
 
 void Vehicle::DeleteGeomVec( const vector< string > & del_vec )
 {
+    WriteLockGuard lock( GetStateLock() );
+
     RemoveGeomVecFromHierarchy( del_vec );
 
     for ( int c = 0 ; c < ( int )del_vec.size() ; c++ )
@@ -866,6 +1437,8 @@ void Vehicle::DeleteGeomVec( const vector< string > & del_vec )
 
 void Vehicle::CutGeomVec( const vector< string > & cut_vec )
 {
+    WriteLockGuard lock( GetStateLock() );
+
     RemoveGeomVecFromHierarchy( cut_vec );
 
     //=== All Geoms To Be Cut ====//
@@ -965,6 +1538,7 @@ void Vehicle::RemoveGeomVecFromHierarchy( const vector< string > & cut_vec )
         vector_remove_val( m_TopGeom, id );
     }
 
+    m_BBoxFullUpdate = true;
     Update();
 }
 
@@ -1096,7 +1670,7 @@ void Vehicle::DeleteClipBoard()
         Geom* gPtr = FindGeom( m_ClipBoard[i] );
         if ( gPtr )
         {
-            vector_remove_val( m_GeomStoreVec, gPtr );
+            RemoveFromGeomStore( gPtr );
             delete gPtr;
         }
     }
@@ -1108,7 +1682,7 @@ void Vehicle::DeleteGeom( const string & geom_id )
     Geom* gPtr = FindGeom( geom_id );
     if ( gPtr )
     {
-        vector_remove_val( m_GeomStoreVec, gPtr );
+        RemoveFromGeomStore( gPtr );
         vector_remove_val( m_ActiveGeom, geom_id );
         delete gPtr;
     }
@@ -1170,6 +1744,8 @@ vector< string > Vehicle::PasteClipboard()
         }
     }
 
+    m_BBoxFullUpdate = true;
+
     //==== Store ids of pasted geoms ====//
     vector<string> pasted_ids = m_ClipBoard;
 
@@ -1252,6 +1828,12 @@ vector< DrawObj* > Vehicle::GetDrawObjs()
     vector< Geom* > geom_vec = FindGeomVec( GetGeomVec() );
     for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
     {
+        // Deferred Geoms are built once shown
+        if ( !geom_vec[i]->m_GuiDraw.GetNoShowFlag() )
+        {
+            geom_vec[i]->LoadDeferred();
+        }
+        geom_vec[i]->UpdateStaleDrawObj();
         geom_vec[i]->LoadDrawObjs( draw_obj_vec );
     }
 
@@ -1485,7 +2067,7 @@ void Vehicle::DeleteType( int index )
     Geom* gPtr = FindGeom( type.m_GeomID );
     if ( gPtr )
     {
-        vector_remove_val( m_GeomStoreVec, gPtr );
+        RemoveFromGeomStore( gPtr );
         delete gPtr;
     }
 
@@ -1638,11 +2220,417 @@ xmlNodePtr Vehicle::DecodeXmlGeomsOnly( xmlNodePtr & node )
     AdvLinkMgr.DecodeXml( node );
     VarPresetMgr.DecodeXml( node );
 
-    return vehicle_node;
+    return vehicle_node;
+}
+
+//==== Write File ====//
+//==== Write A Doc Beside The Target, Then Move It Into Place ====//
+// An interrupted save leaves the previous file intact.
+static bool SaveXmlDocAtomic( xmlDocPtr doc, const string & file_name )
+{
+    PERF_SCOPE( "Vehicle::SaveXmlFile" );
+
+    string tmp_name = file_name + ".tmp";
+    if ( xmlSaveFormatFile( tmp_name.c_str(), doc, 1 ) == -1 )  // Failure occurred
+    {
+        remove( tmp_name.c_str() );
+        return false;
+    }
+
+    if ( rename( tmp_name.c_str(), file_name.c_str() ) != 0 )
+    {
+        // rename does not replace an existing file on Windows.
+        remove( file_name.c_str() );
+        if ( rename( tmp_name.c_str(), file_name.c_str() ) != 0 )
+        {
+            remove( tmp_name.c_str() );
+            return false;
+        }
+    }
+    return true;
+}
+
+//==== Snapshot Of The Vehicle As An XML Doc, Owned By The Caller ====//
+xmlDocPtr Vehicle::EncodeXmlDoc( int set )
+{
+    ReadLockGuard lock( GetStateLock() );
+
+    xmlDocPtr doc = xmlNewDoc( ( const xmlChar * )"1.0" );
+
+    xmlNodePtr root = xmlNewNode( NULL, ( const xmlChar * )"Vsp_Geometry" );
+    xmlDocSetRootElement( doc, root );
+    XmlUtil::AddIntNode( root, "Version", CURRENT_FILE_VER );
+
+    {
+        PERF_SCOPE( "Vehicle::EncodeXml" );
+        EncodeXml( root, set );
+    }
+
+    return doc;
+}
+
+bool Vehicle::WriteXMLFile( const string & file_name, int set )
+{
+    // A background save may be writing the same file.
+    WaitForSave();
+
+    xmlDocPtr doc = EncodeXmlDoc( set );
+
+    //===== Save XML Tree and Free Doc =====//
+    bool ok = SaveXmlDocAtomic( doc, file_name );
+    xmlFreeDoc( doc );
+
+    return ok;
+}
+
+//==== Save Without Blocking ====//
+// The doc is encoded on the calling thread, so it is a consistent snapshot
+// that later edits cannot touch.  Only formatting and writing run on the
+// worker.  A save still in flight is finished first.
+void Vehicle::WriteXMLFileAsync( const string & file_name, int set )
+{
+    WaitForSave();
+
+    xmlDocPtr doc = EncodeXmlDoc( set );
+
+    m_SaveInProgress = true;
+    m_SaveWorker->m_Thread = std::thread( [ this, doc, file_name ]()
+    {
+        m_SaveResult = SaveXmlDocAtomic( doc, file_name );
+        xmlFreeDoc( doc );
+        m_SaveInProgress = false;
+    } );
+}
+
+//==== Block Until The Background Save Is Written, Return Its Result ====//
+bool Vehicle::WaitForSave()
+{
+    if ( m_SaveWorker->m_Thread.joinable() )
+    {
+        m_SaveWorker->m_Thread.join();
+    }
+    return m_SaveResult;
+}
+
+void Vehicle::SetAutoSaveInterval( double interval_sec )
+{
+    m_AutoSaveInterval = interval_sec;
+    m_LastAutoSaveTime = GetWallTime();
+}
+
+//==== Recovery File Beside The Current .vsp3 File ====//
+string Vehicle::GetAutoSaveFileName()
+{
+    string file_name = m_VSP3FileName;
+    int pos = ( int )file_name.rfind( ".vsp3" );
+    if ( pos != ( int )string::npos && pos == ( int )file_name.size() - 5 )
+    {
+        file_name.erase( pos );
+    }
+    return file_name + ".autosave.vsp3";
+}
+
+//==== Start An Autosave When The Interval Passed And Parms Changed ====//
+// Called from the GUI timer.  Skipped while a save is still being written.
+void Vehicle::CheckAutoSave()
+{
+    if ( m_AutoSaveInterval <= 0 || m_SaveInProgress )
+    {
+        return;
+    }
+
+    double now = GetWallTime();
+    if ( now - m_LastAutoSaveTime < m_AutoSaveInterval )
+    {
+        return;
+    }
+    m_LastAutoSaveTime = now;
+
+    int change_cnt = ParmMgr.GetLastChangeCnt() + ParmMgr.GetNumParmChanges();
+    if ( change_cnt == m_AutoSaveChangeCnt )
+    {
+        return;
+    }
+    m_AutoSaveChangeCnt = change_cnt;
+
+    WriteXMLFileAsync( GetAutoSaveFileName(), vsp::SET_ALL );
+}
+
+//==== Read File ====//
+int Vehicle::ReadXMLFile( const string & file_name )
+{
+    WriteLockGuard lock( GetStateLock() );
+
+    string lastreset = ParmMgr.ResetRemapID();
+
+    //==== Read Xml File ====//
+    xmlDocPtr doc;
+
+    LIBXML_TEST_VERSION
+    xmlKeepBlanksDefault( 0 );
+
+    //==== Build an XML tree from a the file ====//
+    {
+        PERF_SCOPE( "Vehicle::ParseXmlFile" );
+        doc = xmlParseFile( file_name.c_str() );
+    }
+    if ( doc == NULL )
+    {
+        fprintf( stderr, "could not parse XML document\n" );
+        return 1;
+    }
+
+    int err;
+    {
+        PERF_SCOPE( "Vehicle::DecodeXml" );
+        err = DecodeXmlDoc( doc, false );
+    }
+
+    //===== Free Doc =====//
+    xmlFreeDoc( doc );
+
+    if ( err != 0 )
+    {
+        return err;
+    }
+
+    ParmMgr.ResetRemapID( lastreset );
+
+    if ( m_DeferGeomLoadFlag )
+    {
+        DeferHiddenGeoms();
+    }
+
+    Update();
+
+    m_FileOpenVersion = -1;
+    return 0;
+}
+
+//==== Read File ====//
+int Vehicle::ReadXMLFileGeomsOnly( const string & file_name )
+{
+    string lastreset = ParmMgr.ResetRemapID();
+
+    //==== Read Xml File ====//
+    xmlDocPtr doc;
+
+    LIBXML_TEST_VERSION
+    xmlKeepBlanksDefault( 0 );
+
+    //==== Build an XML tree from a the file ====//
+    doc = xmlParseFile( file_name.c_str() );
+    if ( doc == NULL )
+    {
+        fprintf( stderr, "could not parse XML document\n" );
+        return 1;
+    }
+
+    int err = DecodeXmlDoc( doc, true );
+
+    //===== Free Doc =====//
+    xmlFreeDoc( doc );
+
+    if ( err != 0 )
+    {
+        return err;
+    }
+
+    ParmMgr.ResetRemapID( lastreset );
+
+    Update();
+
+    m_FileOpenVersion = -1;
+    return 0;
+}
+
+//==== Check And Decode A Parsed Vsp_Geometry Document ====//
+int Vehicle::DecodeXmlDoc( xmlDocPtr doc, bool geoms_only )
+{
+    xmlNodePtr root = xmlDocGetRootElement( doc );
+    if ( root == NULL )
+    {
+        fprintf( stderr, "empty document\n" );
+        return 2;
+    }
+
+    if ( xmlStrcmp( root->name, ( const xmlChar * )"Vsp_Geometry" ) )
+    {
+        fprintf( stderr, "document of the wrong type, Vsp Geometry not found\n" );
+        return 3;
+    }
+
+    //==== Find Version Number ====//
+    m_FileOpenVersion = XmlUtil::FindInt( root, "Version", 0 );
+
+    if ( m_FileOpenVersion < MIN_FILE_VER )
+    {
+        fprintf( stderr, "document version not supported \n");
+        m_FileOpenVersion = -1;
+        return 4;
+    }
+
+    //==== Decode Vehicle from document ====//
+    XmlUtil::BeginNodeIndex();
+    ParmMgr.BeginBulkDecode();
+    if ( geoms_only )
+    {
+        DecodeXmlGeomsOnly( root );
+    }
+    else
+    {
+        DecodeXml( root );
+    }
+    ParmMgr.EndBulkDecode();
+    XmlUtil::EndNodeIndex();
+
+    return 0;
+}
+
+//==== Binary Snapshot Layout ====//
+// Magic, byte order mark, layout version, flags, set written ( version 2 and up ), then:
+//   Geom IDs written              int count, then ( int length, chars ) per ID
+//   Parm values                   int count, then ( int length, chars, double ) per Parm
+//   Vsp_Geometry document         int length, chars
+// Every count and length is a native int; files are not portable across byte orders.
+static const char VSP_BIN_MAGIC[8] = { 'V', 'S', 'P', 'B', 'I', 'N', '\r', '\n' };
+static const int VSP_BIN_BYTE_ORDER = 0x01020304;
+
+static void WriteBinInt( FILE* fp, int val )
+{
+    fwrite( &val, sizeof( int ), 1, fp );
+}
+
+static void WriteBinString( FILE* fp, const string & str )
+{
+    WriteBinInt( fp, ( int )str.size() );
+    fwrite( str.data(), sizeof( char ), str.size(), fp );
+}
+
+static bool ReadBinInt( FILE* fp, int & val )
+{
+    return fread( &val, sizeof( int ), 1, fp ) == 1;
+}
+
+// IDs are short; a longer length means a damaged snapshot, so nothing is allocated for it.
+static const int VSP_BIN_MAX_ID_LEN = 1024;
+
+static bool ReadBinString( FILE* fp, string & str, long max_len )
+{
+    int len;
+    if ( !ReadBinInt( fp, len ) || len < 0 || len > max_len )
+    {
+        return false;
+    }
+    str.resize( len );
+    return len == 0 || fread( &str[0], sizeof( char ), len, fp ) == ( size_t )len;
+}
+
+//==== Collect IDs Of Parms Encoded In A Document ====//
+static void FindEncodedParmIDs( xmlNodePtr node, vector< string > & id_vec )
+{
+    for ( xmlNodePtr iter_node = node->xmlChildrenNode ; iter_node != NULL ; iter_node = iter_node->next )
+    {
+        if ( iter_node->type != XML_ELEMENT_NODE )
+        {
+            continue;
+        }
+
+        if ( xmlHasProp( iter_node, BAD_CAST "Value" ) && xmlHasProp( iter_node, BAD_CAST "ID" ) )
+        {
+            id_vec.push_back( XmlUtil::FindStringProp( iter_node, "ID", string() ) );
+        }
+
+        FindEncodedParmIDs( iter_node, id_vec );
+    }
+}
+
+//==== Compare Two Documents, Ignoring Only The Values Of Parms ====//
+static bool SameXmlIgnoringParmValues( xmlNodePtr a, xmlNodePtr b )
+{
+    if ( a->type != b->type || !xmlStrEqual( a->name, b->name ) )
+    {
+        return false;
+    }
+
+    if ( a->type != XML_ELEMENT_NODE )
+    {
+        return xmlStrEqual( a->content, b->content ) != 0;
+    }
+
+    bool parm = xmlHasProp( a, BAD_CAST "Value" ) && xmlHasProp( a, BAD_CAST "ID" );
+
+    xmlAttrPtr attr_a = a->properties;
+    xmlAttrPtr attr_b = b->properties;
+    for ( ; attr_a && attr_b ; attr_a = attr_a->next, attr_b = attr_b->next )
+    {
+        if ( !xmlStrEqual( attr_a->name, attr_b->name ) )
+        {
+            return false;
+        }
+
+        if ( parm && xmlStrEqual( attr_a->name, BAD_CAST "Value" ) )
+        {
+            continue;
+        }
+
+        xmlChar* val_a = xmlNodeGetContent( ( xmlNodePtr )attr_a );
+        xmlChar* val_b = xmlNodeGetContent( ( xmlNodePtr )attr_b );
+        bool same = xmlStrEqual( val_a, val_b ) != 0;
+        xmlFree( val_a );
+        xmlFree( val_b );
+        if ( !same )
+        {
+            return false;
+        }
+    }
+    if ( attr_a || attr_b )
+    {
+        return false;
+    }
+
+    xmlNodePtr child_a = a->children;
+    xmlNodePtr child_b = b->children;
+    for ( ; child_a && child_b ; child_a = child_a->next, child_b = child_b->next )
+    {
+        if ( !SameXmlIgnoringParmValues( child_a, child_b ) )
+        {
+            return false;
+        }
+    }
+    return !child_a && !child_b;
+}
+
+//==== Parms Encoded In A Document That Still Exist, In Document Order ====//
+static void FindEncodedParms( xmlNodePtr root, vector< Parm* > & parm_vec )
+{
+    vector< string > parm_id_vec;
+    FindEncodedParmIDs( root, parm_id_vec );
+
+    for ( int i = 0 ; i < ( int )parm_id_vec.size() ; i++ )
+    {
+        Parm* p = ParmMgr.FindParm( parm_id_vec[i] );
+        if ( p )
+        {
+            parm_vec.push_back( p );
+        }
+    }
+}
+
+bool Vehicle::IsBinaryFileName( const string & file_name )
+{
+    string ext = ".vspb";
+    if ( file_name.size() < ext.size() )
+    {
+        return false;
+    }
+    string tail = file_name.substr( file_name.size() - ext.size() );
+    std::transform( tail.begin(), tail.end(), tail.begin(), ::tolower );
+    return tail == ext;
 }
 
-//==== Write File ====//
-bool Vehicle::WriteXMLFile( const string & file_name, int set )
+//==== Write Binary Snapshot ====//
+bool Vehicle::WriteBinaryFile( const string & file_name, int set )
 {
     xmlDocPtr doc = xmlNewDoc( ( const xmlChar * )"1.0" );
 
@@ -1652,130 +2640,206 @@ bool Vehicle::WriteXMLFile( const string & file_name, int set )
 
     EncodeXml( root, set );
 
-    //===== Save XML Tree and Free Doc =====//
-    int err = xmlSaveFormatFile( file_name.c_str(), doc, 1 );
+    vector< Parm* > parm_vec;
+    FindEncodedParms( root, parm_vec );
+
+    xmlChar* doc_buf = NULL;
+    int doc_size = 0;
+    xmlDocDumpMemory( doc, &doc_buf, &doc_size );
     xmlFreeDoc( doc );
 
-    if( err == -1 )  // Failure occurred
+    FILE* fp = fopen( file_name.c_str(), "wb" );
+    if ( !fp )
     {
+        xmlFree( doc_buf );
         return false;
     }
 
-    return true;
-}
+    fwrite( VSP_BIN_MAGIC, sizeof( char ), sizeof( VSP_BIN_MAGIC ), fp );
+    WriteBinInt( fp, VSP_BIN_BYTE_ORDER );
+    WriteBinInt( fp, CURRENT_BIN_FILE_VER );
+    WriteBinInt( fp, 0 );                       // Flags, Reserved
+    WriteBinInt( fp, set );
 
-//==== Read File ====//
-int Vehicle::ReadXMLFile( const string & file_name )
-{
-    string lastreset = ParmMgr.ResetRemapID();
+    vector< string > geom_id_vec;
+    vector< Geom* > geom_vec = FindGeomVec( GetGeomVec() );
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        if ( geom_vec[i]->GetSetFlag( set ) )
+        {
+            geom_id_vec.push_back( geom_vec[i]->GetID() );
+        }
+    }
+    WriteBinInt( fp, ( int )geom_id_vec.size() );
+    for ( int i = 0 ; i < ( int )geom_id_vec.size() ; i++ )
+    {
+        WriteBinString( fp, geom_id_vec[i] );
+    }
 
-    //==== Read Xml File ====//
-    xmlDocPtr doc;
+    WriteBinInt( fp, ( int )parm_vec.size() );
+    for ( int i = 0 ; i < ( int )parm_vec.size() ; i++ )
+    {
+        double val = parm_vec[i]->Get();
+        WriteBinString( fp, parm_vec[i]->GetID() );
+        fwrite( &val, sizeof( double ), 1, fp );
+    }
 
-    LIBXML_TEST_VERSION
-    xmlKeepBlanksDefault( 0 );
+    WriteBinInt( fp, doc_size );
+    fwrite( doc_buf, sizeof( char ), doc_size, fp );
+    xmlFree( doc_buf );
 
-    //==== Build an XML tree from a the file ====//
-    doc = xmlParseFile( file_name.c_str() );
-    if ( doc == NULL )
+    bool ok = !ferror( fp );
+    fclose( fp );
+    return ok;
+}
+
+//==== Read Binary Snapshot ====//
+// When this vehicle would write exactly the snapshot's document apart from Parm values,
+// only the values are applied.  Otherwise the vehicle is cleared and the embedded
+// document is decoded, so either way the vehicle ends up holding the snapshot.  Error
+// codes match ReadXMLFile, with 5 for a damaged snapshot.
+int Vehicle::ReadBinaryFile( const string & file_name )
+{
+    WriteLockGuard lock( GetStateLock() );
+
+    FILE* fp = fopen( file_name.c_str(), "rb" );
+    if ( !fp )
     {
-        fprintf( stderr, "could not parse XML document\n" );
         return 1;
     }
 
-    xmlNodePtr root = xmlDocGetRootElement( doc );
-    if ( root == NULL )
-    {
-        fprintf( stderr, "empty document\n" );
-        xmlFreeDoc( doc );
-        return 2;
-    }
+    fseek( fp, 0, SEEK_END );
+    long file_size = ftell( fp );
+    rewind( fp );
 
-    if ( xmlStrcmp( root->name, ( const xmlChar * )"Vsp_Geometry" ) )
+    char magic[ sizeof( VSP_BIN_MAGIC ) ];
+    int byte_order = 0;
+    int version = 0;
+    int flags = 0;
+    if ( fread( magic, sizeof( char ), sizeof( magic ), fp ) != sizeof( magic ) ||
+         memcmp( magic, VSP_BIN_MAGIC, sizeof( magic ) ) != 0 ||
+         !ReadBinInt( fp, byte_order ) || byte_order != VSP_BIN_BYTE_ORDER ||
+         !ReadBinInt( fp, version ) || !ReadBinInt( fp, flags ) )
     {
-        fprintf( stderr, "document of the wrong type, Vsp Geometry not found\n" );
-        xmlFreeDoc( doc );
+        fclose( fp );
         return 3;
     }
 
-    //==== Find Version Number ====//
-    m_FileOpenVersion = XmlUtil::FindInt( root, "Version", 0 );
-
-    if ( m_FileOpenVersion < MIN_FILE_VER )
+    if ( version > CURRENT_BIN_FILE_VER )
     {
-        fprintf( stderr, "document version not supported \n");
-        xmlFreeDoc( doc );
-        m_FileOpenVersion = -1;
+        fprintf( stderr, "binary snapshot version not supported \n");
+        fclose( fp );
         return 4;
     }
 
-    //==== Decode Vehicle from document ====//
-    DecodeXml( root );
-
-    //===== Free Doc =====//
-    xmlFreeDoc( doc );
-
-    ParmMgr.ResetRemapID( lastreset );
+    bool ok = true;
+    int set = -1;                       // Not Recorded Before Version 2, Always Decoded
+    if ( version >= 2 )
+    {
+        ok = ReadBinInt( fp, set );
+    }
 
-    Update();
+    int num_geom = 0;
+    ok = ok && ReadBinInt( fp, num_geom ) && num_geom >= 0;
+    vector< string > geom_id_vec;
+    for ( int i = 0 ; ok && i < num_geom ; i++ )
+    {
+        geom_id_vec.push_back( string() );
+        ok = ReadBinString( fp, geom_id_vec.back(), VSP_BIN_MAX_ID_LEN );
+    }
 
-    m_FileOpenVersion = -1;
-    return 0;
-}
+    int num_parm = 0;
+    ok = ok && ReadBinInt( fp, num_parm ) && num_parm >= 0;
+    vector< string > parm_id_vec;
+    vector< double > val_vec;
+    for ( int i = 0 ; ok && i < num_parm ; i++ )
+    {
+        double val = 0.0;
+        parm_id_vec.push_back( string() );
+        ok = ReadBinString( fp, parm_id_vec.back(), VSP_BIN_MAX_ID_LEN ) && fread( &val, sizeof( double ), 1, fp ) == 1;
+        val_vec.push_back( val );
+    }
 
-//==== Read File ====//
-int Vehicle::ReadXMLFileGeomsOnly( const string & file_name )
-{
-    string lastreset = ParmMgr.ResetRemapID();
+    string doc_str;
+    ok = ok && ReadBinString( fp, doc_str, file_size - ftell( fp ) );
+    fclose( fp );
 
-    //==== Read Xml File ====//
-    xmlDocPtr doc;
+    if ( !ok )
+    {
+        return 5;
+    }
 
     LIBXML_TEST_VERSION
     xmlKeepBlanksDefault( 0 );
 
-    //==== Build an XML tree from a the file ====//
-    doc = xmlParseFile( file_name.c_str() );
+    xmlDocPtr doc = xmlReadMemory( doc_str.data(), ( int )doc_str.size(), NULL, NULL, 0 );
     if ( doc == NULL )
     {
         fprintf( stderr, "could not parse XML document\n" );
         return 1;
     }
 
-    xmlNodePtr root = xmlDocGetRootElement( doc );
-    if ( root == NULL )
-    {
-        fprintf( stderr, "empty document\n" );
-        xmlFreeDoc( doc );
-        return 2;
-    }
+    //==== Same Model Already Loaded, Restore Values Only ====//
+    // Every Parm existing is not enough, XSecs, Sub-Surfaces or settings may have changed since.
+    vector< string > curr_geom_vec = GetGeomVec();
+    std::sort( curr_geom_vec.begin(), curr_geom_vec.end() );
+    std::sort( geom_id_vec.begin(), geom_id_vec.end() );
 
-    if ( xmlStrcmp( root->name, ( const xmlChar * )"Vsp_Geometry" ) )
+    vector< Parm* > parm_vec;
+    bool same_model = ( set >= 0 && curr_geom_vec == geom_id_vec );
+    if ( same_model )
     {
-        fprintf( stderr, "document of the wrong type, Vsp Geometry not found\n" );
-        xmlFreeDoc( doc );
-        return 3;
-    }
+        xmlNodePtr root = xmlNewNode( NULL, ( const xmlChar * )"Vsp_Geometry" );
+        XmlUtil::AddIntNode( root, "Version", CURRENT_FILE_VER );
+        EncodeXml( root, set );
 
-    //==== Find Version Number ====//
-    m_FileOpenVersion = XmlUtil::FindInt( root, "Version", 0 );
+        same_model = SameXmlIgnoringParmValues( xmlDocGetRootElement( doc ), root );
+        if ( same_model )
+        {
+            FindEncodedParms( root, parm_vec );
+        }
+        xmlFreeNode( root );
 
-    if ( m_FileOpenVersion < MIN_FILE_VER )
+        same_model = same_model && ( ( int )parm_vec.size() == num_parm );
+        for ( int i = 0 ; same_model && i < num_parm ; i++ )
+        {
+            same_model = ( parm_vec[i]->GetID() == parm_id_vec[i] );
+        }
+    }
+
+    if ( same_model )
     {
-        fprintf( stderr, "document version not supported \n");
         xmlFreeDoc( doc );
-        m_FileOpenVersion = -1;
-        return 4;
+
+        BeginParmBatch();
+        for ( int i = 0 ; i < num_parm ; i++ )
+        {
+            parm_vec[i]->Set( val_vec[i] );
+        }
+        EndParmBatch();
+        return 0;
     }
 
-    //==== Decode Vehicle from document ====//
-    DecodeXmlGeomsOnly( root );
+    //==== Decode Embedded Document Into A Cleared Vehicle ====//
+    Renew();
 
-    //===== Free Doc =====//
+    string lastreset = ParmMgr.ResetRemapID();
+
+    int err = DecodeXmlDoc( doc, false );
     xmlFreeDoc( doc );
 
+    if ( err != 0 )
+    {
+        return err;
+    }
+
     ParmMgr.ResetRemapID( lastreset );
 
+    if ( m_DeferGeomLoadFlag )
+    {
+        DeferHiddenGeoms();
+    }
+
     Update();
 
     m_FileOpenVersion = -1;
@@ -1921,6 +2985,30 @@ void Vehicle::WriteSTLFile( const string & file_name, int write_set )
         }
     }
 
+    if ( m_STLBinary() )
+    {
+        vector< vec3d > pnt_vec;
+        for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+        {
+            if ( geom_vec[i]->GetSetFlag( write_set ) && geom_vec[i]->GetType().m_Type == MESH_GEOM_TYPE )
+            {
+                MeshGeom* mg = dynamic_cast<MeshGeom*>( geom_vec[i] );
+                if ( mg )
+                {
+                    mg->LoadStlTris( pnt_vec );
+                }
+            }
+        }
+
+        FILE* fid = fopen( file_name.c_str(), "wb" );
+        if ( fid )
+        {
+            WriteBinarySTL( fid, pnt_vec );
+            fclose( fid );
+        }
+        return;
+    }
+
     // Open File
     FILE* fid = fopen( file_name.c_str(), "w" );
     fprintf( fid, "solid\n" );
@@ -2737,6 +3825,24 @@ void Vehicle::FetchXFerSurfs( int write_set, vector< XferSurf > &xfersurfs )
     }
 }
 
+//==== Prepare CAD Export Surfaces Concurrently ====//
+// Splitting and cubic conversion only read each VspSurf.  Creating the STEP and
+// IGES entities is not thread safe, so the callers do that serially afterward.
+static void PrepCADSurfVec( vector < VspSurf > & surf_vec, const vector < vector < double > > & usplit_vec,
+                            const vector < vector < double > > & wsplit_vec, bool splitsurf, bool tocubic, double tol,
+                            bool trimte, vector < vector < piecewise_surface_type > > & prep_vec )
+{
+    int nsurf = ( int )surf_vec.size();
+    prep_vec.clear();
+    prep_vec.resize( nsurf );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int k = 0; k < nsurf; k++ )
+    {
+        prep_vec[k] = surf_vec[k].PrepCADSurfs( splitsurf, tocubic, tol, trimte, usplit_vec[k], wsplit_vec[k] );
+    }
+}
+
 void Vehicle::WriteSTEPFile( const string & file_name, int write_set )
 {
     WriteSTEPFile( file_name, write_set, m_STEPLabelID(), m_STEPLabelName(), m_STEPLabelSurfNo(), m_STEPLabelDelim() );
@@ -2749,6 +3855,11 @@ void Vehicle::WriteSTEPFile( const string & file_name, int write_set, bool label
 
     STEPutil step( m_STEPLenUnit(), m_STEPTol() );
 
+    vector < VspSurf > cad_surf_vec;
+    vector < vector < double > > usplit_vec;
+    vector < vector < double > > wsplit_vec;
+    vector < string > prefix_vec;
+
     vector< Geom* > geom_vec = FindGeomVec( GetGeomVec() );
     for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
     {
@@ -2818,14 +3929,25 @@ void Vehicle::WriteSTEPFile( const string & file_name, int write_set, bool label
                     prefix.append( to_string( j ) );
                 }
 
-                vector < SdaiB_spline_surface_with_knots* > surfs;
-                surf_vec[j].ToSTEP_BSpline_Quilt( &step, surfs, m_STEPSplitSurfs(), m_STEPMergePoints(), m_STEPToCubic(), m_STEPToCubicTol(), m_STEPTrimTE(), usplit, wsplit );
-
-                step.RepresentUntrimmedSurfs( surfs, prefix );
+                cad_surf_vec.push_back( surf_vec[j] );
+                usplit_vec.push_back( usplit );
+                wsplit_vec.push_back( wsplit );
+                prefix_vec.push_back( prefix );
             }
         }
     }
 
+    vector < vector < piecewise_surface_type > > prep_vec;
+    PrepCADSurfVec( cad_surf_vec, usplit_vec, wsplit_vec, m_STEPSplitSurfs(), m_STEPToCubic(), m_STEPToCubicTol(), m_STEPTrimTE(), prep_vec );
+
+    for ( int k = 0; k < ( int )cad_surf_vec.size(); k++ )
+    {
+        vector < SdaiB_spline_surface_with_knots* > surfs;
+        cad_surf_vec[k].ToSTEP_BSpline_Quilt( &step, surfs, prep_vec[k], m_STEPSplitSurfs(), m_STEPMergePoints() );
+
+        step.RepresentUntrimmedSurfs( surfs, prefix_vec[k] );
+    }
+
     step.WriteFile( file_name );
 }
 
@@ -2864,8 +3986,9 @@ void Vehicle::WriteStructureSTEPFile( const string & file_name )
 
     STEPutil step( len, m_STEPStructureTol() );
 
-    vector < double > usplit;
-    vector < double > wsplit;
+    vector < VspSurf > cad_surf_vec;
+    vector < vector < double > > usplit_vec;
+    vector < vector < double > > wsplit_vec;
 
     fea_struct->Update();
 
@@ -2876,13 +3999,21 @@ void Vehicle::WriteStructureSTEPFile( const string & file_name )
         FeaPart* part = fea_part_vec[i];
         vector < VspSurf > surf_vec = part->GetFeaPartSurfVec();
 
-        for ( int j = 0; j < surf_vec.size(); j++ )
-        {
-            vector < SdaiB_spline_surface_with_knots* > surfs;
-            surf_vec[j].ToSTEP_BSpline_Quilt( &step, surfs, m_STEPStructureSplitSurfs(), m_STEPStructureMergePoints(), m_STEPStructureToCubic(), m_STEPStructureToCubicTol(), false, usplit, wsplit );
+        cad_surf_vec.insert( cad_surf_vec.end(), surf_vec.begin(), surf_vec.end() );
+    }
 
-            step.RepresentUntrimmedSurfs( surfs );
-        }
+    usplit_vec.resize( cad_surf_vec.size() );
+    wsplit_vec.resize( cad_surf_vec.size() );
+
+    vector < vector < piecewise_surface_type > > prep_vec;
+    PrepCADSurfVec( cad_surf_vec, usplit_vec, wsplit_vec, m_STEPStructureSplitSurfs(), m_STEPStructureToCubic(), m_STEPStructureToCubicTol(), false, prep_vec );
+
+    for ( int k = 0; k < ( int )cad_surf_vec.size(); k++ )
+    {
+        vector < SdaiB_spline_surface_with_knots* > surfs;
+        cad_surf_vec[k].ToSTEP_BSpline_Quilt( &step, surfs, prep_vec[k], m_STEPStructureSplitSurfs(), m_STEPStructureMergePoints() );
+
+        step.RepresentUntrimmedSurfs( surfs );
     }
 
     step.WriteFile( file_name );
@@ -2903,6 +4034,11 @@ void Vehicle::WriteIGESFile( const string & file_name, int write_set, int lenUni
 
     IGESutil iges( lenUnit );
 
+    vector < VspSurf > cad_surf_vec;
+    vector < vector < double > > usplit_vec;
+    vector < vector < double > > wsplit_vec;
+    vector < string > prefix_vec;
+
     vector< Geom* > geom_vec = FindGeomVec( GetGeomVec() );
     for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
     {
@@ -2972,11 +4108,22 @@ void Vehicle::WriteIGESFile( const string & file_name, int write_set, int lenUni
                     prefix.append( to_string( j ) );
                 }
 
-                surf_vec[j].ToIGES( &iges, splitSurfs, toCubic, toCubicTol, trimTE, usplit, wsplit, prefix, labelSplitNo, delim );
+                cad_surf_vec.push_back( surf_vec[j] );
+                usplit_vec.push_back( usplit );
+                wsplit_vec.push_back( wsplit );
+                prefix_vec.push_back( prefix );
             }
         }
     }
 
+    vector < vector < piecewise_surface_type > > prep_vec;
+    PrepCADSurfVec( cad_surf_vec, usplit_vec, wsplit_vec, splitSurfs, toCubic, toCubicTol, trimTE, prep_vec );
+
+    for ( int k = 0; k < ( int )cad_surf_vec.size(); k++ )
+    {
+        cad_surf_vec[k].ToIGES( &iges, prep_vec[k], splitSurfs, prefix_vec[k], labelSplitNo, delim );
+    }
+
     iges.WriteFile( file_name.c_str(), true );
 }
 
@@ -3002,8 +4149,10 @@ void Vehicle::WriteStructureIGESFile( const string & file_name, int feaMeshStruc
 
     IGESutil iges( m_StructUnit() );
 
-    vector < double > usplit;
-    vector < double > wsplit;
+    vector < VspSurf > cad_surf_vec;
+    vector < vector < double > > usplit_vec;
+    vector < vector < double > > wsplit_vec;
+    vector < string > prefix_vec;
 
     fea_struct->Update();
 
@@ -3041,10 +4190,22 @@ void Vehicle::WriteStructureIGESFile( const string & file_name, int feaMeshStruc
                 prefix.append( to_string( j ) );
             }
 
-            surf_vec[j].ToIGES( &iges, splitSurfs, toCubic, toCubicTol, false, usplit, wsplit, prefix, labelSplitNo, delim );
+            cad_surf_vec.push_back( surf_vec[j] );
+            prefix_vec.push_back( prefix );
         }
     }
 
+    usplit_vec.resize( cad_surf_vec.size() );
+    wsplit_vec.resize( cad_surf_vec.size() );
+
+    vector < vector < piecewise_surface_type > > prep_vec;
+    PrepCADSurfVec( cad_surf_vec, usplit_vec, wsplit_vec, splitSurfs, toCubic, toCubicTol, false, prep_vec );
+
+    for ( int k = 0; k < ( int )cad_surf_vec.size(); k++ )
+    {
+        cad_surf_vec[k].ToIGES( &iges, prep_vec[k], splitSurfs, prefix_vec[k], labelSplitNo, delim );
+    }
+
     iges.WriteFile( file_name.c_str(), true );
 }
 
@@ -3105,6 +4266,36 @@ void Vehicle::WriteAirfoilFile( const string &file_name, int write_set )
     fclose( meta_fid );
 }
 
+
+//==== Tessellate The Geoms Of A Drawing Concurrently ====//
+// Each Geom only builds meshes from its own cached tessellation.  The meshes are
+// gathered in Geom order.
+static void CreateProjectionTMeshVec( const vector< Geom* > & geom_vec, int write_set, vector< TMesh* > & tmv )
+{
+    vector< Geom* > set_geom_vec;
+    for ( int i = 0; i < (int)geom_vec.size(); i++ )
+    {
+        if ( geom_vec[i]->GetSetFlag( write_set ) )
+        {
+            set_geom_vec.push_back( geom_vec[i] );
+        }
+    }
+
+    int ngeom = ( int )set_geom_vec.size();
+    vector< vector< TMesh* > > tmesh_blocks( ngeom );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int i = 0; i < ngeom; i++ )
+    {
+        tmesh_blocks[i] = set_geom_vec[i]->CreateTMeshVec();
+    }
+
+    for ( int i = 0; i < ngeom; i++ )
+    {
+        tmv.insert( tmv.end(), tmesh_blocks[i].begin(), tmesh_blocks[i].end() );
+    }
+}
+
 void Vehicle::WriteDXFFile( const string & file_name, int write_set )
 {
     FILE* dxf_file = fopen( file_name.c_str(), "w" );
@@ -3197,18 +4388,7 @@ void Vehicle::WriteDXFFile( const string & file_name, int write_set )
         {
             // Generate Mesh for Projections:
             vector < TMesh* > TotalProjectMeshVec;
-
-            for ( int i = 0; i < (int)geom_vec.size(); i++ )
-            {
-                if ( geom_vec[i]->GetSetFlag( write_set ) )
-                {
-                    vector< TMesh* > tMeshVec = geom_vec[i]->CreateTMeshVec();
-                    for ( int j = 0; j < (int)tMeshVec.size(); j++ )
-                    {
-                        TotalProjectMeshVec.push_back( tMeshVec[j] );
-                    }
-                }
-            }
+            CreateProjectionTMeshVec( geom_vec, write_set, TotalProjectMeshVec );
             // Generate Geom and Vehicle Projection Line Vectors:
             ProjectionMgr.ExportProjectLines( TotalProjectMeshVec );
 
@@ -3404,18 +4584,7 @@ void Vehicle::WriteSVGFile( const string & file_name, int write_set )
     {
         // Generate Mesh for Projections:
         vector < TMesh* > TotalProjectMeshVec;
-
-        for ( int i = 0; i < (int)geom_vec.size(); i++ )
-        {
-            if ( geom_vec[i]->GetSetFlag( write_set ) )
-            {
-                vector< TMesh* > tMeshVec = geom_vec[i]->CreateTMeshVec();
-                for ( int j = 0; j < (int)tMeshVec.size(); j++ )
-                {
-                    TotalProjectMeshVec.push_back( tMeshVec[j] );
-                }
-            }
-        }
+        CreateProjectionTMeshVec( geom_vec, write_set, TotalProjectMeshVec );
 
         // Generate Geom and Vehicle Projection Line Vectors:
         ProjectionMgr.ExportProjectLines( TotalProjectMeshVec );
@@ -3886,29 +5055,112 @@ void Vehicle::AddLinkableContainers( vector< string > & linkable_container_vec )
     StructureMgr.AddLinkableContainers( linkable_container_vec );
 }
 
+//==== Bring The Vehicle Box Up To Date ====//
+// Boxes that grew, or moved without touching the vehicle box boundary, are merged in.
+// A box that touched the boundary and then shrank or moved, or any change to the set
+// of Geoms, rebuilds the box from every Geom.
 void Vehicle::UpdateBBox()
 {
-    BndBox new_box;
-    int ngeom;
-    vector< Geom* > geom_vec = FindGeomVec( GetGeomVec() );
-    ngeom = (int) geom_vec.size();
-    for ( int i = 0 ; i < ngeom ; i++ )
+    if ( !m_BBoxFullUpdate )
+    {
+        for ( int i = 0 ; i < ( int )m_BBoxDirtyGeomVec.size() && !m_BBoxFullUpdate ; i++ )
+        {
+            Geom* geom_ptr = FindGeom( m_BBoxDirtyGeomVec[i] );
+            unordered_map< string, BndBox >::iterator iter = m_GeomBBoxMap.find( m_BBoxDirtyGeomVec[i] );
+
+            if ( iter == m_GeomBBoxMap.end() )
+            {
+                if ( geom_ptr && InGeomTree( geom_ptr ) )
+                {
+                    m_GeomBBoxMap[ geom_ptr->GetID() ] = geom_ptr->GetBndBox();
+                    m_BBox.Update( geom_ptr->GetBndBox() );
+                }
+                continue;
+            }
+
+            if ( !geom_ptr )
+            {
+                m_BBoxFullUpdate = true;
+                continue;
+            }
+
+            BndBox old_box = iter->second;
+            BndBox new_box = geom_ptr->GetBndBox();
+
+            for ( int k = 0 ; k < 3 ; k++ )
+            {
+                if ( ( old_box.GetMin( k ) <= m_BBox.GetMin( k ) && new_box.GetMin( k ) > old_box.GetMin( k ) ) ||
+                     ( old_box.GetMax( k ) >= m_BBox.GetMax( k ) && new_box.GetMax( k ) < old_box.GetMax( k ) ) )
+                {
+                    m_BBoxFullUpdate = true;
+                }
+            }
+
+            iter->second = new_box;
+            m_BBox.Update( new_box );
+        }
+    }
+
+    m_BBoxDirtyGeomVec.clear();
+
+    if ( m_BBoxFullUpdate )
+    {
+        BndBox new_box;
+        m_GeomBBoxMap.clear();
+
+        vector< Geom* > geom_vec = FindGeomVec( GetGeomVec() );
+        for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+        {
+            new_box.Update( geom_vec[i]->GetBndBox() );
+            m_GeomBBoxMap[ geom_vec[i]->GetID() ] = geom_vec[i]->GetBndBox();
+        }
+
+        m_BBox = new_box;
+        m_BBoxFullUpdate = false;
+    }
+
+    if( !m_GeomBBoxMap.empty() )
     {
-        new_box.Update( geom_vec[i]->GetBndBox() );
+        m_BbXLen = m_BBox.GetMax( 0 ) - m_BBox.GetMin( 0 );
+        m_BbYLen = m_BBox.GetMax( 1 ) - m_BBox.GetMin( 1 );
+        m_BbZLen = m_BBox.GetMax( 2 ) - m_BBox.GetMin( 2 );
+
+        m_BbXMin = m_BBox.GetMin( 0 );
+        m_BbYMin = m_BBox.GetMin( 1 );
+        m_BbZMin = m_BBox.GetMin( 2 );
     }
+}
 
-    if( ngeom > 0 )
+//==== Called By Geom::Update After A Geom Box Is Rebuilt ====//
+void Vehicle::GeomBBoxChanged( const string & geom_id )
+{
+    #pragma omp critical ( VehicleBBox )
     {
-        m_BbXLen = new_box.GetMax( 0 ) - new_box.GetMin( 0 );
-        m_BbYLen = new_box.GetMax( 1 ) - new_box.GetMin( 1 );
-        m_BbZLen = new_box.GetMax( 2 ) - new_box.GetMin( 2 );
+        // Many updates without an UpdateBBox are cheaper to settle with a rebuild.
+        if ( m_BBoxDirtyGeomVec.size() > 2 * m_GeomStoreVec.size() )
+        {
+            m_BBoxDirtyGeomVec.clear();
+            m_BBoxFullUpdate = true;
+        }
+
+        if ( !m_BBoxFullUpdate )
+        {
+            m_BBoxDirtyGeomVec.push_back( geom_id );
+        }
+    }
+}
 
-        m_BbXMin = new_box.GetMin( 0 );
-        m_BbYMin = new_box.GetMin( 1 );
-        m_BbZMin = new_box.GetMin( 2 );
+//==== Check If A Geom Hangs From One Of The Top Geoms ====//
+bool Vehicle::InGeomTree( Geom* geom_ptr )
+{
+    int depth = 0;
+    while ( geom_ptr && geom_ptr->GetParentID() != "NONE" && depth < ( int )m_GeomStoreVec.size() )
+    {
+        geom_ptr = FindGeom( geom_ptr->GetParentID() );
+        depth++;
     }
 
-    m_BBox = new_box;
+    return geom_ptr && vector_contains_val( m_TopGeom, geom_ptr->GetID() );
 }
 
 bool Vehicle::GetVisibleBndBox( BndBox &b )
@@ -3960,7 +5212,11 @@ string Vehicle::getExportFileName( int type )
     {
         doreturn = true;
     }
-    else if ( type == DEGEN_GEOM_M_TYPE )
+    else if ( type == DEGEN_GEOM_M_TYPE )
+    {
+        doreturn = true;
+    }
+    else if ( type == DEGEN_GEOM_BIN_TYPE )
     {
         doreturn = true;
     }
@@ -4028,6 +5284,10 @@ void Vehicle::setExportFileName( int type, string f_name )
     {
         doset = true;
     }
+    else if ( type == DEGEN_GEOM_BIN_TYPE )
+    {
+        doset = true;
+    }
     else if ( type == PROJ_AREA_CSV_TYPE )
     {
         doset = true;
@@ -4053,8 +5313,8 @@ void Vehicle::setExportFileName( int type, string f_name )
 
 void Vehicle::resetExportFileNames()
 {
-    const char *suffix[] = {"_CompGeom.txt", "_CompGeom.csv", "_DragBuild.tsv", "_AwaveSlice.txt", "_MassProps.txt", "_DegenGeom.csv", "_DegenGeom.m", "_ProjArea.csv", "_WaveDrag.txt", ".tri", "_ParasiteBuildUp.csv" };
-    const int types[] = { COMP_GEOM_TXT_TYPE, COMP_GEOM_CSV_TYPE, DRAG_BUILD_TSV_TYPE, SLICE_TXT_TYPE, MASS_PROP_TXT_TYPE, DEGEN_GEOM_CSV_TYPE, DEGEN_GEOM_M_TYPE, PROJ_AREA_CSV_TYPE, WAVE_DRAG_TXT_TYPE, VSPAERO_PANEL_TRI_TYPE, DRAG_BUILD_CSV_TYPE };
+    const char *suffix[] = {"_CompGeom.txt", "_CompGeom.csv", "_DragBuild.tsv", "_AwaveSlice.txt", "_MassProps.txt", "_DegenGeom.csv", "_DegenGeom.m", "_ProjArea.csv", "_WaveDrag.txt", ".tri", "_ParasiteBuildUp.csv", "_DegenGeom.bin" };
+    const int types[] = { COMP_GEOM_TXT_TYPE, COMP_GEOM_CSV_TYPE, DRAG_BUILD_TSV_TYPE, SLICE_TXT_TYPE, MASS_PROP_TXT_TYPE, DEGEN_GEOM_CSV_TYPE, DEGEN_GEOM_M_TYPE, PROJ_AREA_CSV_TYPE, WAVE_DRAG_TXT_TYPE, VSPAERO_PANEL_TRI_TYPE, DRAG_BUILD_CSV_TYPE, DEGEN_GEOM_BIN_TYPE };
     const int ntype = ( sizeof(types) / sizeof(types[0]) );
     int pos;
 
@@ -4071,10 +5331,44 @@ void Vehicle::resetExportFileNames()
     }
 }
 
-string Vehicle::CompGeom( int set, int halfFlag, int intSubsFlag)
+string Vehicle::CompGeom( int set, int halfFlag, int intSubsFlag )
 {
+    int stride = m_CompGeomTessStride();
 
-    string id = AddMeshGeom( set );
+    if ( !m_CompGeomErrorEst() )
+    {
+        return CompGeomAtStride( set, halfFlag, intSubsFlag, stride );
+    }
+
+    //==== Second Level First, So The Requested Level Leaves The Latest Results And Files ====//
+    string coarse_id = CompGeomAtStride( set, halfFlag, intSubsFlag, 2 * stride );
+    if ( coarse_id.compare( "NONE" ) == 0 )
+    {
+        return coarse_id;
+    }
+    string coarse_res_id = ResultsMgr.FindLatestResultsID( "Comp_Geom" );
+
+    SetActiveGeom( coarse_id );
+    CutActiveGeomVec();
+    DeleteClipBoard();
+
+    string id = CompGeomAtStride( set, halfFlag, intSubsFlag, stride );
+
+    vector< string > data_names;
+    data_names.push_back( "Total_Theo_Area" );
+    data_names.push_back( "Total_Wet_Area" );
+    data_names.push_back( "Total_Theo_Vol" );
+    data_names.push_back( "Total_Wet_Vol" );
+    AddTessErrorEstimates( "Comp_Geom", coarse_res_id, data_names );
+
+    ResultsMgr.DeleteResult( coarse_res_id );
+
+    return id;
+}
+
+string Vehicle::CompGeomAtStride( int set, int halfFlag, int intSubsFlag, int stride )
+{
+    string id = AddMeshGeom( set, stride );
     if ( id.compare( "NONE" ) == 0 )
     {
         return id;
@@ -4095,7 +5389,7 @@ string Vehicle::CompGeom( int set, int halfFlag, int intSubsFlag)
 
     if ( mesh_ptr->m_TMeshVec.size() )
     {
-        mesh_ptr->IntersectTrim( halfFlag, intSubsFlag );
+        mesh_ptr->IntersectTrim( halfFlag, intSubsFlag, m_CompGeomSymm() );
     }
     else
     {
@@ -4122,9 +5416,82 @@ string Vehicle::CompGeomAndFlatten( int set, int halfFlag, int intSubsFlag )
     return id;
 }
 
-string Vehicle::MassProps( int set, int numSlices, bool hidegeom, bool writefile )
+string Vehicle::MassProps( int set, int numSlices, bool hidegeom, bool writefile, int mode )
 {
-    string id = AddMeshGeom( set );
+    int stride = m_CompGeomTessStride();
+
+    if ( !m_CompGeomErrorEst() )
+    {
+        return MassPropsAtStride( set, numSlices, hidegeom, writefile, mode, stride );
+    }
+
+    string coarse_id = MassPropsAtStride( set, numSlices, hidegeom, false, mode, 2 * stride );
+    if ( coarse_id.compare( "NONE" ) == 0 )
+    {
+        return coarse_id;
+    }
+    string coarse_res_id = ResultsMgr.FindLatestResultsID( "Mass_Properties" );
+
+    SetActiveGeom( coarse_id );
+    CutActiveGeomVec();
+    DeleteClipBoard();
+
+    string id = MassPropsAtStride( set, numSlices, hidegeom, writefile, mode, stride );
+
+    vector< string > data_names;
+    data_names.push_back( "Total_Mass" );
+    data_names.push_back( "Total_Volume" );
+    data_names.push_back( "Total_CG" );
+    data_names.push_back( "Total_Ixx" );
+    data_names.push_back( "Total_Iyy" );
+    data_names.push_back( "Total_Izz" );
+    data_names.push_back( "Total_Ixy" );
+    data_names.push_back( "Total_Ixz" );
+    data_names.push_back( "Total_Iyz" );
+    AddTessErrorEstimates( "Mass_Properties", coarse_res_id, data_names );
+
+    ResultsMgr.DeleteResult( coarse_res_id );
+
+    return id;
+}
+
+//==== Add Tessellation Error Estimates To The Latest Results ====//
+// Faceted areas, volumes and inertias converge with the square of the facet size,
+// so the error of the finer run is a third of its difference from the run at twice
+// the stride.  Each estimate is stored as <name>_Err.
+void Vehicle::AddTessErrorEstimates( const string & res_name, const string & coarse_res_id, const vector< string > & data_names )
+{
+    Results* fine_res = ResultsMgr.FindResultsPtr( ResultsMgr.FindLatestResultsID( res_name ) );
+    Results* coarse_res = ResultsMgr.FindResultsPtr( coarse_res_id );
+    if ( !fine_res || !coarse_res || fine_res == coarse_res )
+    {
+        return;
+    }
+
+    for ( int i = 0 ; i < ( int )data_names.size() ; i++ )
+    {
+        NameValData* fine_nvd = fine_res->FindPtr( data_names[i] );
+        NameValData* coarse_nvd = coarse_res->FindPtr( data_names[i] );
+        if ( !fine_nvd || !coarse_nvd )
+        {
+            continue;
+        }
+
+        if ( fine_nvd->GetType() == vsp::VEC3D_DATA )
+        {
+            vec3d diff = fine_nvd->GetVec3d( 0 ) - coarse_nvd->GetVec3d( 0 );
+            fine_res->Add( NameValData( data_names[i] + "_Err", vec3d( std::abs( diff.x() ), std::abs( diff.y() ), std::abs( diff.z() ) ) / 3.0 ) );
+        }
+        else
+        {
+            fine_res->Add( NameValData( data_names[i] + "_Err", std::abs( fine_nvd->GetDouble( 0 ) - coarse_nvd->GetDouble( 0 ) ) / 3.0 ) );
+        }
+    }
+}
+
+string Vehicle::MassPropsAtStride( int set, int numSlices, bool hidegeom, bool writefile, int mode, int stride )
+{
+    string id = AddMeshGeom( set, stride );
     if ( id.compare( "NONE" ) == 0 )
     {
         return id;
@@ -4168,7 +5535,14 @@ string Vehicle::MassProps( int set, int numSlices, bool hidegeom, bool writefile
 
     if ( mesh_ptr->m_TMeshVec.size() || mesh_ptr->m_PointMassVec.size() )
     {
-        mesh_ptr->MassSliceX( numSlices, writefile );
+        if ( mode == vsp::MASS_PROP_ANALYTIC )
+        {
+            mesh_ptr->MassPropsAnalytic( writefile );
+        }
+        else
+        {
+            mesh_ptr->MassSliceX( numSlices, writefile, m_CompGeomSymm() );
+        }
         m_TotalMass = mesh_ptr->m_TotalMass;
         m_IxxIyyIzz = vec3d( mesh_ptr->m_TotalIxx, mesh_ptr->m_TotalIyy, mesh_ptr->m_TotalIzz );
         m_IxyIxzIyz = vec3d( mesh_ptr->m_TotalIxy, mesh_ptr->m_TotalIxz, mesh_ptr->m_TotalIyz );
@@ -4185,9 +5559,9 @@ string Vehicle::MassProps( int set, int numSlices, bool hidegeom, bool writefile
     return id;
 }
 
-string Vehicle::MassPropsAndFlatten( int set, int numSlices, bool hidegeom, bool writefile )
+string Vehicle::MassPropsAndFlatten( int set, int numSlices, bool hidegeom, bool writefile, int mode )
 {
-    string id = MassProps( set, numSlices, hidegeom, writefile );
+    string id = MassProps( set, numSlices, hidegeom, writefile, mode );
     Geom* geom = FindGeom( id );
     if ( !geom )
     {
@@ -4200,6 +5574,186 @@ string Vehicle::MassPropsAndFlatten( int set, int numSlices, bool hidegeom, bool
     return id;
 }
 
+//==== All-Pairs Interference And Clearance Between The Components In A Set ====//
+// Each Geom is one component.  The meshes are built and BVH loaded once per
+// component, then every pair is checked in parallel.  Pairs whose boxes are
+// farther apart than max_clearance are not searched and report max_clearance;
+// a negative max_clearance searches every pair.
+string Vehicle::Interference( int set, double max_clearance )
+{
+    PERF_SCOPE( "Interference" );
+
+    vector< Geom* > geom_vec;
+    vector< vector< TMesh* > > comp_tmv;
+    vector< BndBox > comp_box;
+
+    vector< Geom* > all_geom_vec = FindGeomVec( GetGeomVec() );
+    for ( int i = 0 ; i < ( int )all_geom_vec.size() ; i++ )
+    {
+        if ( all_geom_vec[i]->GetSetFlag( set ) )
+        {
+            geom_vec.push_back( all_geom_vec[i] );
+        }
+    }
+
+    int ngeom = ( int )geom_vec.size();
+    comp_tmv.resize( ngeom );
+    comp_box.resize( ngeom );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int i = 0 ; i < ngeom ; i++ )
+    {
+        comp_tmv[i] = geom_vec[i]->CreateTMeshVec();
+        for ( int j = 0 ; j < ( int )comp_tmv[i].size() ; j++ )
+        {
+            comp_tmv[i][j]->LoadBndBox();
+            comp_box[i].Update( comp_tmv[i][j]->m_TBox.m_Box );
+        }
+    }
+
+    //==== Drop Components Without Surfaces (Blank, Hinge, ...) ====//
+    vector< int > comp_index;
+    for ( int i = 0 ; i < ngeom ; i++ )
+    {
+        if ( comp_tmv[i].size() )
+        {
+            comp_index.push_back( i );
+        }
+    }
+    int ncomp = ( int )comp_index.size();
+
+    double search_dist = max_clearance;
+    if ( search_dist < 0.0 )
+    {
+        search_dist = 1.0e12;
+    }
+
+    vector< pair< int, int > > pair_vec;
+    for ( int i = 0 ; i < ncomp ; i++ )
+    {
+        for ( int j = i + 1 ; j < ncomp ; j++ )
+        {
+            pair_vec.push_back( make_pair( i, j ) );
+        }
+    }
+    int npair = ( int )pair_vec.size();
+
+    vector< int > isect_vec( ncomp * ncomp, 0 );
+    vector< double > length_vec( ncomp * ncomp, 0.0 );
+    vector< double > clear_vec( ncomp * ncomp, 0.0 );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int p = 0 ; p < npair ; p++ )
+    {
+        int a = pair_vec[p].first;
+        int b = pair_vec[p].second;
+        const vector< TMesh* > & tmv_a = comp_tmv[ comp_index[a] ];
+        const vector< TMesh* > & tmv_b = comp_tmv[ comp_index[b] ];
+
+        bool isect = false;
+        double length = 0.0;
+        double clear = search_dist;
+
+        if ( Compare( comp_box[ comp_index[a] ], comp_box[ comp_index[b] ], search_dist ) )
+        {
+            //==== Interference First - Stops At The First Crossing Tri Pair ====//
+            for ( int i = 0 ; i < ( int )tmv_a.size() ; i++ )
+            {
+                for ( int j = 0 ; j < ( int )tmv_b.size() ; j++ )
+                {
+                    if ( tmv_a[i]->CheckIntersect( tmv_b[j] ) )
+                    {
+                        vector< TISectSeg > seg_vec;
+                        tmv_a[i]->Intersect( tmv_b[j], seg_vec );
+                        for ( int k = 0 ; k < ( int )seg_vec.size() ; k++ )
+                        {
+                            length += dist( seg_vec[k].m_Pnt0, seg_vec[k].m_Pnt1 );
+                        }
+                        isect = true;
+                    }
+                }
+            }
+
+            if ( isect )
+            {
+                clear = 0.0;
+            }
+            else
+            {
+                for ( int i = 0 ; i < ( int )tmv_a.size() ; i++ )
+                {
+                    for ( int j = 0 ; j < ( int )tmv_b.size() ; j++ )
+                    {
+                        clear = tmv_a[i]->MinDistance( tmv_b[j], clear );
+                    }
+                }
+            }
+        }
+
+        isect_vec[ a * ncomp + b ] = isect_vec[ b * ncomp + a ] = isect ? 1 : 0;
+        length_vec[ a * ncomp + b ] = length_vec[ b * ncomp + a ] = length;
+        clear_vec[ a * ncomp + b ] = clear_vec[ b * ncomp + a ] = clear;
+    }
+
+    //==== Results - Matrices Are Row Major, ncomp By ncomp ====//
+    Results* res = ResultsMgr.CreateResults( "Interference" );
+    if ( res )
+    {
+        vector< string > id_vec, name_vec;
+        for ( int i = 0 ; i < ncomp ; i++ )
+        {
+            id_vec.push_back( geom_vec[ comp_index[i] ]->GetID() );
+            name_vec.push_back( geom_vec[ comp_index[i] ]->GetName() );
+        }
+
+        vector< string > pair_a_vec, pair_b_vec;
+        vector< double > pair_length_vec;
+        double min_clear = search_dist;
+        for ( int p = 0 ; p < npair ; p++ )
+        {
+            int a = pair_vec[p].first;
+            int b = pair_vec[p].second;
+            if ( isect_vec[ a * ncomp + b ] )
+            {
+                pair_a_vec.push_back( id_vec[a] );
+                pair_b_vec.push_back( id_vec[b] );
+                pair_length_vec.push_back( length_vec[ a * ncomp + b ] );
+            }
+            else
+            {
+                min_clear = min( min_clear, clear_vec[ a * ncomp + b ] );
+            }
+        }
+
+        res->Add( NameValData( "Num_Comps", ncomp ) );
+        res->Add( NameValData( "Comp_ID", id_vec ) );
+        res->Add( NameValData( "Comp_Name", name_vec ) );
+        res->Add( NameValData( "Max_Clearance", search_dist ) );
+        res->Add( NameValData( "Interference_Matrix", isect_vec ) );
+        res->Add( NameValData( "Intersection_Length_Matrix", length_vec ) );
+        res->Add( NameValData( "Clearance_Matrix", clear_vec ) );
+        res->Add( NameValData( "Num_Interfering_Pairs", ( int )pair_a_vec.size() ) );
+        res->Add( NameValData( "Interfering_Pair_ID_A", pair_a_vec ) );
+        res->Add( NameValData( "Interfering_Pair_ID_B", pair_b_vec ) );
+        res->Add( NameValData( "Interfering_Pair_Length", pair_length_vec ) );
+        res->Add( NameValData( "Min_Clearance", min_clear ) );
+    }
+
+    for ( int i = 0 ; i < ngeom ; i++ )
+    {
+        for ( int j = 0 ; j < ( int )comp_tmv[i].size() ; j++ )
+        {
+            delete comp_tmv[i][j];
+        }
+    }
+
+    if ( !res )
+    {
+        return string();
+    }
+    return res->GetID();
+}
+
 string Vehicle::PSlice( int set, int numSlices, vec3d axis, bool autoBoundsFlag, double start, double end )
 {
 
@@ -4246,6 +5800,42 @@ string Vehicle::PSliceAndFlatten( int set, int numSlices, vec3d axis, bool autoB
     return id;
 }
 
+//==== Slice One MeshGeom With Several Sets Of Planes ====//
+string Vehicle::PSliceBatchAndFlatten( int set, const vector< AreaSliceRequest > & req_vec, vector< string > & res_id_vec )
+{
+    res_id_vec.clear();
+
+    string id = AddMeshGeom( set );
+    if ( id.compare( "NONE" ) == 0 )
+    {
+        return id;
+    }
+
+    HideAllExcept( id );
+
+    MeshGeom* mesh_ptr = ( MeshGeom* )FindGeom( id );
+    if ( mesh_ptr == NULL )
+    {
+        return string( "NONE" );
+    }
+
+    if ( mesh_ptr->m_TMeshVec.size() )
+    {
+        res_id_vec = mesh_ptr->AreaSliceBatch( req_vec );
+    }
+    else
+    {
+        CutActiveGeomVec();
+        DeleteClipBoard();
+        return string( "NONE" );
+    }
+
+    mesh_ptr->FlattenTMeshVec();
+    mesh_ptr->FlattenSliceVec();
+    mesh_ptr->Update();
+    return id;
+}
+
 //==== Import File Methods ====//
 string Vehicle::ImportFile( const string & file_name, int file_type )
 {
@@ -4790,6 +6380,23 @@ void Vehicle::ExportFile( const string & file_name, int write_set, int file_type
     }
 }
 
+//==== Changes To A Geom Or Its Sub-Surfaces Since Its DegenGeom Was Built ====//
+// Parm changes on the Geom, its XSecs and its placement all bump the surface revision.
+string Vehicle::GetDegenCacheKey( Geom* geom_ptr )
+{
+    char str[256];
+    snprintf( str, sizeof( str ), "%d:%d:", geom_ptr->GetSurfRevision(), geom_ptr->GetLatestChangeCnt() );
+    string key = geom_ptr->GetName() + ":" + str;
+
+    vector< SubSurface* > ss_vec = geom_ptr->GetSubSurfVec();
+    for ( int i = 0 ; i < ( int )ss_vec.size() ; i++ )
+    {
+        snprintf( str, sizeof( str ), ":%d", ss_vec[i]->GetLatestChangeCnt() );
+        key += ss_vec[i]->GetID() + str;
+    }
+    return key;
+}
+
 void Vehicle::CreateDegenGeom( int set )
 {
     vector< string > geom_id_vec;
@@ -4797,6 +6404,7 @@ void Vehicle::CreateDegenGeom( int set )
     m_DegenPtMassVec.clear();
 
     vector< Geom* > geom_vec = FindGeomVec( GetGeomVec() );
+    vector< Geom* > degen_geom_vec;
     for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
     {
         if ( geom_vec[i]->GetSetFlag( set ) )
@@ -4816,9 +6424,102 @@ void Vehicle::CreateDegenGeom( int set )
             }
             else
             {
-                geom_vec[i]->CreateDegenGeom( m_DegenGeomVec );
+                degen_geom_vec.push_back( geom_vec[i] );
+            }
+        }
+    }
+
+    //==== Reuse The Output Of Geoms Unchanged Since The Last Run ====//
+    int ndegen = ( int )degen_geom_vec.size();
+    vector< vector< DegenGeom > > geom_dg_vec( ndegen );
+    vector< string > key_vec( ndegen );
+    vector< int > build_vec;                // Geoms to regenerate
+
+    unordered_map< string, DegenGeomCacheEntry > old_cache;
+    old_cache.swap( m_DegenGeomCache );
+
+    for ( int i = 0 ; i < ndegen ; i++ )
+    {
+        key_vec[i] = GetDegenCacheKey( degen_geom_vec[i] );
+
+        unordered_map< string, DegenGeomCacheEntry >::iterator iter = old_cache.find( degen_geom_vec[i]->GetID() );
+        if ( m_DegenGeomIncremental() && iter != old_cache.end() &&
+             iter->second.m_Geom == degen_geom_vec[i] && iter->second.m_Key == key_vec[i] )
+        {
+            geom_dg_vec[i].swap( iter->second.m_DegenVec );
+        }
+        else
+        {
+            build_vec.push_back( i );
+        }
+    }
+    old_cache.clear();
+
+    //==== Each Geom Only Touches Its Own Tessellation - Tessellate Them In Parallel ====//
+    int nbuild = ( int )build_vec.size();
+    vector< int > num_surf_vec( ndegen, -1 );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int b = 0 ; b < nbuild ; b++ )
+    {
+        int i = build_vec[b];
+        num_surf_vec[i] = degen_geom_vec[i]->PrepareDegenSurfs();
+    }
+
+    //==== Then Build Surfaces As Separate Tasks So One Large Geom Does Not Run Alone ====//
+    vector< pair< int, int > > task_vec;    // Geom, surface or -1 for the whole geom
+    for ( int b = 0 ; b < nbuild ; b++ )
+    {
+        int i = build_vec[b];
+        if ( num_surf_vec[i] >= 0 )
+        {
+            for ( int s = 0 ; s < num_surf_vec[i] ; s++ )
+            {
+                task_vec.push_back( make_pair( i, s ) );
             }
         }
+        else
+        {
+            task_vec.push_back( make_pair( i, -1 ) );
+        }
+    }
+
+    int ntask = ( int )task_vec.size();
+    vector< vector< DegenGeom > > dg_blocks( ntask );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int t = 0 ; t < ntask ; t++ )
+    {
+        Geom* geom_ptr = degen_geom_vec[ task_vec[t].first ];
+        if ( task_vec[t].second < 0 )
+        {
+            geom_ptr->CreateDegenGeom( dg_blocks[t] );
+        }
+        else
+        {
+            geom_ptr->CreateDegenSurf( task_vec[t].second, dg_blocks[t] );
+        }
+    }
+
+    //==== Keep The Serial Geom And Surface Order ====//
+    for ( int t = 0 ; t < ntask ; t++ )
+    {
+        vector< DegenGeom > & dg_vec = geom_dg_vec[ task_vec[t].first ];
+        dg_vec.insert( dg_vec.end(), dg_blocks[t].begin(), dg_blocks[t].end() );
+    }
+
+    for ( int i = 0 ; i < ndegen ; i++ )
+    {
+        m_DegenGeomVec.insert( m_DegenGeomVec.end(), geom_dg_vec[i].begin(), geom_dg_vec[i].end() );
+
+        // The copies above are completed by the trims below, the cache keeps each Geom's own output.
+        if ( m_DegenGeomIncremental() )
+        {
+            DegenGeomCacheEntry & entry = m_DegenGeomCache[ degen_geom_vec[i]->GetID() ];
+            entry.m_Geom = degen_geom_vec[i];
+            entry.m_Key = key_vec[i];
+            entry.m_DegenVec.swap( geom_dg_vec[i] );
+        }
     }
 
     vector< string > active_vec_store = GetActiveGeomVec();
@@ -4850,7 +6551,8 @@ void Vehicle::CreateDegenGeom( int set )
 }
 
 //==== Write Degen Geom File ====//
-string Vehicle::WriteDegenGeomFile()
+//==== A Non Empty geom_hash Is Recorded On The Second Header Line ====//
+string Vehicle::WriteDegenGeomFile( const string & geom_hash )
 {
     int geomCnt = 0, blankCnt = 0;
     string outStr = "\n";
@@ -4880,7 +6582,14 @@ string Vehicle::WriteDegenGeomFile()
         }
         else
         {
-            fprintf(file_id, "# DEGENERATE GEOMETRY CSV FILE\n\n");
+            if ( geom_hash.empty() )
+            {
+                fprintf(file_id, "# DEGENERATE GEOMETRY CSV FILE\n\n");
+            }
+            else
+            {
+                fprintf(file_id, "# DEGENERATE GEOMETRY CSV FILE\n# GEOMETRY HASH %s\n", geom_hash.c_str());
+            }
             fprintf(file_id, "# NUMBER OF COMPONENTS\n%d\n", geomCnt);
 
             if ( m_DegenPtMassVec.size() > 0 )
@@ -4989,6 +6698,52 @@ string Vehicle::WriteDegenGeomFile()
 
     res->Add( NameValData( "Degen_BlankGeoms", blank_degen_result_ids ) );
     res->Add( NameValData( "Degen_DegenGeoms", degen_results_ids ) );
+
+    //==== Binary File Holds The Same Results, Each DegenGeom Followed By Its Parts ====//
+    if ( getExportDegenGeomBinFile() )
+    {
+        string file_name = getExportFileName( DEGEN_GEOM_BIN_TYPE );
+
+        const char *part_names[] = { "surf", "plates", "sticks", "point", "disk", "subsurfs", "hinges" };
+        const int npart = ( sizeof( part_names ) / sizeof( part_names[0] ) );
+
+        vector < string > bin_ids;
+        bin_ids.push_back( res->GetID() );
+        bin_ids.insert( bin_ids.end(), blank_degen_result_ids.begin(), blank_degen_result_ids.end() );
+
+        for ( int i = 0; i < ( int )degen_results_ids.size(); i++ )
+        {
+            bin_ids.push_back( degen_results_ids[i] );
+
+            Results *degen_res = ResultsMgr.FindResultsPtr( degen_results_ids[i] );
+            if ( degen_res )
+            {
+                for ( int j = 0; j < npart; j++ )
+                {
+                    NameValData *nvd = degen_res->FindPtr( part_names[j] );
+                    if ( nvd )
+                    {
+                        const vector < string > & part_ids = nvd->GetStringData();
+                        bin_ids.insert( bin_ids.end(), part_ids.begin(), part_ids.end() );
+                    }
+                }
+            }
+        }
+
+        if ( ResultsMgr.WriteBinaryFile( file_name, bin_ids ) == vsp::VSP_OK )
+        {
+            outStr += "\t";
+            outStr += file_name;
+            outStr += "\n";
+        }
+        else
+        {
+            outStr += "\tFAILED TO OPEN: ";
+            outStr += file_name;
+            outStr += "\n";
+        }
+    }
+
     return outStr;
 }
 
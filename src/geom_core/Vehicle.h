@@ -28,6 +28,8 @@
 #include "MaterialMgr.h"
 #include "WaveDragMgr.h"
 #include "GroupTransformations.h"
+#include "UsingCpp11.h"
+#include "RWLock.h"
 
 #include <cassert>
 
@@ -36,10 +38,12 @@
 #include <deque>
 #include <stack>
 #include <memory>
+#include <atomic>
 
 // File versions must be integers.
 #define MIN_FILE_VER 4 // Lowest file version number for 3.X vsp file
 #define CURRENT_FILE_VER 5 // File version number for 3.X files that this executable writes
+#define CURRENT_BIN_FILE_VER 2 // Binary snapshot (.vspb) layout version
 
 // We have not made substantial use of this flag to determine file compatibility issues.  However,
 // its use will likely increase going forward.  Most parameters additions and file format changes
@@ -52,6 +56,17 @@
 #define NUM_SETS 20 // Number of sets
 #define DEFAULT_SET vsp::SET_TYPE::SET_SHOWN // Default set index
 
+class AreaSliceRequest;
+struct SaveWorker;              // Holds The std::thread, Which This Header Cannot Include After CADutil.h
+
+//==== One Geom's DegenGeom Output, Reused While Its Key Is Unchanged ====//
+struct DegenGeomCacheEntry
+{
+    Geom* m_Geom;
+    string m_Key;
+    vector< DegenGeom > m_DegenVec;
+};
+
 /*!
 * Centralized place to access all GUI related Parm objects.
 */
@@ -82,21 +97,57 @@ public:
     void GenAPIDocs( const string & file_name );
 
     void ParmChanged( Parm* parm_ptr, int type );
-    static void UnDo();
+    void UnDo();
 
     void Update( bool fullupdate = true );
     void UpdateGeom( const string &geom_id );
     void ForceUpdate();
     static void UpdateGui();
+    static void UpdateGui( const string & container_id );
+
+    //==== Headless Mode Skips Draw Object Builds And GUI Notifications ====//
+    void SetHeadless( bool flag );
+    static bool IsHeadless()                    { return m_HeadlessFlag; }
+
+    //==== Deferred Load, Hidden Geoms Read From File Build Their Surfaces On First Use ====//
+    void SetDeferGeomLoad( bool flag )          { m_DeferGeomLoadFlag = flag; }
+    bool GetDeferGeomLoad()                     { return m_DeferGeomLoadFlag; }
+    void DeferHiddenGeoms();
+    void LoadDeferredGeoms();
+    int GetNumDeferredGeoms();
+
+    //==== Held For Writing While The Model Changes, Shared By Readers On Other Threads ====//
+    // NULL within a parallel region of an update, whose threads must not wait on it.
+    RWLock* GetStateLock();
+
+    void BeginParmBatch();
+    void EndParmBatch();
+    bool InParmBatch()                          { return m_ParmBatchDepth > 0; }
+    void AddParmBatchGeom( const string & geom_id );
+
+    //==== Slider Drags Defer Geom Updates To The Next GUI Timer Tick ====//
+    void SetDeferDeviceUpdates( bool flag )     { m_DeferDeviceUpdates = flag; }
+    bool GetDeferDeviceUpdates()                { return m_DeferDeviceUpdates && !InParmBatch(); }
+    void FlushDeferredUpdates();
+
+    void AddUpdateTime( double t )              { m_UpdateTime += t; }
+    double TakeUpdateTime();
+
+    //==== Memory Held By Every Geom, And Release Of Their Rebuildable Caches ====//
+    void AddMemoryUsage( GeomMemUsage & usage );
+    void PurgeDrawObjs();
+    void PurgeTessCache();
     static void RunScript( const string & file_name, const string & function_name = "void main()" );
 
     Geom* FindGeom( const string & geom_id );
+    void GeomIDChanged( const string & old_id, Geom* geom_ptr );
     vector< Geom* > FindGeomVec( const vector< string > & geom_id_vec );
 
     string CreateGeom( const GeomType & type );
     string AddGeom( const GeomType & type );
     string AddGeom( Geom* add_geom );
-    string AddMeshGeom( int set );
+    string AddMeshGeom( int set, int tess_stride = 1 );
+    int GetTMeshTessStride()                    { return m_TMeshTessStride; }
 
     virtual void AddLinkableContainers( vector< string > & linkable_container_vec );
 
@@ -154,6 +205,7 @@ public:
 
     BndBox GetBndBox()                                        { return m_BBox; }
     void UpdateBBox();
+    void GeomBBoxChanged( const string & geom_id );
     bool GetVisibleBndBox( BndBox &b );
 
     xmlNodePtr EncodeXml( xmlNodePtr & node, int set );
@@ -170,6 +222,11 @@ public:
     int ReadXMLFile( const string & file_name );
     int ReadXMLFileGeomsOnly( const string & file_name );
 
+    //==== Binary Snapshot: Document Plus Exact Parm Values ====//
+    static bool IsBinaryFileName( const string & file_name );
+    int ReadBinaryFile( const string & file_name );
+    bool WriteBinaryFile( const string & file_name, int set );
+
     void SetVSP3FileName( const string & f_name );
     string GetVSP3FileName()                                { return m_VSP3FileName; }
     int GetFileVersion()                                    { return m_FileOpenVersion; }
@@ -194,6 +251,17 @@ public:
     //=== Export Files ===//
     void ExportFile( const string & file_name, int write_set, int file_type );
     bool WriteXMLFile( const string & file_name, int set );
+
+    //==== Encode Now, Write On A Worker Thread; One Save In Flight At A Time ====//
+    void WriteXMLFileAsync( const string & file_name, int set );
+    bool IsSaveInProgress()                     { return m_SaveInProgress; }
+    bool WaitForSave();
+
+    //==== Periodic Background Save To A Recovery File, Off When interval <= 0 ====//
+    void SetAutoSaveInterval( double interval_sec );
+    double GetAutoSaveInterval()                { return m_AutoSaveInterval; }
+    string GetAutoSaveFileName();
+    void CheckAutoSave();
     void WriteXSecFile( const string & file_name, int write_set );
     void WritePLOT3DFile( const string & file_name, int write_set );
     void WriteSTLFile( const string & file_name, int write_set );
@@ -254,8 +322,10 @@ public:
 
     bool getExportDegenGeomCsvFile( )                  { return m_exportDegenGeomCsvFile(); }
     bool getExportDegenGeomMFile( )                    { return m_exportDegenGeomMFile(); }
+    bool getExportDegenGeomBinFile( )                  { return m_exportDegenGeomBinFile(); }
     void setExportDegenGeomCsvFile( bool b )           { m_exportDegenGeomCsvFile.Set( b ); }
     void setExportDegenGeomMFile( bool b )             { m_exportDegenGeomMFile.Set( b ); }
+    void setExportDegenGeomBinFile( bool b )           { m_exportDegenGeomBinFile.Set( b ); }
 
     //==== Import Files ====//
     string ImportFile( const string & file_name, int file_type );
@@ -265,15 +335,17 @@ public:
     //Comp Geom
     string CompGeom( int set, int halfFlag, int intSubsFlag = 1 );
     string CompGeomAndFlatten( int set, int halfFlag, int intSubsFlag = 1 );
-    string MassProps( int set, int numSlices, bool hidegeom = true, bool writefile = true );
-    string MassPropsAndFlatten( int set, int numSlices, bool hidegeom = true, bool writefile = true );
+    string MassProps( int set, int numSlices, bool hidegeom = true, bool writefile = true, int mode = vsp::MASS_PROP_SLICE );
+    string MassPropsAndFlatten( int set, int numSlices, bool hidegeom = true, bool writefile = true, int mode = vsp::MASS_PROP_SLICE );
+    string Interference( int set, double max_clearance = -1.0 );
     string PSlice( int set, int numSlices, vec3d norm, bool autoBoundsFlag, double start = 0, double end = 0 );
     string PSliceAndFlatten( int set, int numSlices, vec3d norm, bool autoBoundsFlag, double start = 0, double end = 0 );
+    string PSliceBatchAndFlatten( int set, const vector< AreaSliceRequest > & req_vec, vector< string > & res_id_vec );
 
     //==== Degenerate Geometry ====//
     void CreateDegenGeom( int set );
     vector< DegenGeom > GetDegenGeomVec()    { return m_DegenGeomVec; }
-    string WriteDegenGeomFile();
+    string WriteDegenGeomFile( const string & geom_hash = string() );
     void ClearDegenGeom()   { m_DegenGeomVec.clear(); }
 
     //==== Surface Query ====//
@@ -424,12 +496,23 @@ public:
     string m_AFFileDir;
 
     BoolParm m_STLMultiSolid;
+    BoolParm m_STLBinary;
     BoolParm m_STLExportPropMainSurf;
 
     BoolParm m_exportCompGeomCsvFile;
     BoolParm m_exportDragBuildTsvFile;
     BoolParm m_exportDegenGeomCsvFile;
     BoolParm m_exportDegenGeomMFile;
+    BoolParm m_exportDegenGeomBinFile;
+
+    BoolParm m_CompGeomIncremental;         // Reuse unchanged pair intersections between CompGeom runs
+    BoolParm m_CompGeomSymm;                // Trim the +Y half of XZ symmetric models and mirror it
+    IntParm m_CompGeomTessStride;           // Keep every Nth tessellation point for quick-look runs
+    BoolParm m_CompGeomErrorEst;            // Estimate the tessellation error from a second run at twice the stride
+    BoolParm m_DegenGeomIncremental;        // Reuse the DegenGeom output of unchanged Geoms
+
+    BoolParm m_ParallelUpdate;              // Update independent top level Geoms concurrently
+    TMeshPairCache m_CompGeomCache;
 
     Parm m_AxisLength;
     Parm m_TextSize;
@@ -442,10 +525,19 @@ protected:
 
     virtual void SetExportPropMainSurf( bool b );
 
+    virtual void BuildUpdateSchedule( vector< Geom* > & parallel_vec, vector< Geom* > & serial_vec );
+
     vector< Geom* > m_GeomStoreVec;                 // All Geom Ptrs
+    unordered_map< string, Geom* > m_GeomIDMap;     // Geom ID -> Geom Ptr For Everything In m_GeomStoreVec
+
+    void AddToGeomStore( Geom* geom_ptr );
+    void RemoveFromGeomStore( Geom* geom_ptr );
 
     vector< DegenGeom > m_DegenGeomVec;         // Vector of components in degenerate representation
     vector< DegenPtMass > m_DegenPtMassVec;
+    unordered_map< string, DegenGeomCacheEntry > m_DegenGeomCache;     // Keyed By Geom ID
+
+    string GetDegenCacheKey( Geom* geom_ptr );
 
     vector < vector < vector < vec3d > > > m_VehProjectVec3d; // Vector of projection lines for each view direction (x, y, or z)
 
@@ -457,9 +549,46 @@ protected:
 
     vector< GeomType > m_GeomTypeVec;
 
+    virtual void UpdateParmBatch();
+
+    int DecodeXmlDoc( xmlDocPtr doc, bool geoms_only );
+
+    int m_ParmBatchDepth;                       // Nesting Depth Of BeginParmBatch Calls
+    vector< string > m_ParmBatchGeomVec;        // Geoms Changed While Batching
+    bool m_ParmBatchVehicleFlag;                // Vehicle Parms Changed While Batching
+    bool m_DeferDeviceUpdates;                  // Device Changes Only Mark Geoms For The Next Flush
+    double m_UpdateTime;                        // Wall Seconds Spent Updating Geoms, For Profiling
+    static bool m_HeadlessFlag;                 // No GUI Attached, Display Work Is Deferred
+    bool m_DeferGeomLoadFlag;                   // Files Are Read Without Building Hidden Geoms
+    int m_TMeshTessStride;                      // Stride Applied By CreateTMeshVec While AddMeshGeom Runs
+
+    string CompGeomAtStride( int set, int halfFlag, int intSubsFlag, int stride );
+    string MassPropsAtStride( int set, int numSlices, bool hidegeom, bool writefile, int mode, int stride );
+    void AddTessErrorEstimates( const string & res_name, const string & coarse_res_id, const vector< string > & data_names );
+
+    bool IsGeomTreeHidden( Geom* geom_ptr );
+
+    RWLock m_StateLock;
+
+    xmlDocPtr EncodeXmlDoc( int set );
+
+    SaveWorker* m_SaveWorker;
+    std::atomic< bool > m_SaveInProgress;
+    bool m_SaveResult;                          // Result Of The Last Background Save
+
+    double m_AutoSaveInterval;                  // Seconds Between Autosaves
+    double m_LastAutoSaveTime;
+    int m_AutoSaveChangeCnt;                    // Parm Changes Seen By The Last Autosave
+
     bool m_UpdatingBBox;
     BndBox m_BBox;                              // Bounding Box Around All Geometries
 
+    virtual bool InGeomTree( Geom* geom_ptr );
+
+    bool m_BBoxFullUpdate;                      // Rebuild m_BBox From Every Geom On The Next UpdateBBox
+    vector< string > m_BBoxDirtyGeomVec;        // Geoms Whose Box Changed Since The Last UpdateBBox
+    unordered_map< string, BndBox > m_GeomBBoxMap;  // Box Each Geom Contributed To m_BBox
+
     void SetApplyAbsIgnoreFlag( const vector< string > &g_vec, bool val );
 
     //==== Primary file name ====//
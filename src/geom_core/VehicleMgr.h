@@ -14,6 +14,11 @@
 class Vehicle;
 
 //==== Vehicle Manager ====//
+// Owns the one Vehicle in the process.  The Vehicle is not self contained --
+// ParmMgr, ResultsMgr, LinkMgr, AdvLinkMgr, SubSurfaceMgr, CfdMeshMgr and the
+// other managers are process wide singletons that hold per-model state and are
+// Renew'd along with the Vehicle.  Evaluating a second design in the same
+// process means Renew / ReadVSPFile on this Vehicle, not a second instance.
 class VehicleMgrSingleton
 {
 private:
@@ -1661,25 +1661,25 @@ void WingGeom::UpdateSurf()
 {
     //==== Check If Total Span/Chord/Area Has Changed ====//
     bool total_change_flag = false;
-    if ( UpdatedParm( m_TotalSpan.GetID() ) )
+    if ( UpdatedParm( m_TotalSpan ) )
     {
         UpdateTotalSpan();
         total_change_flag = true;
     }
 
-    if ( UpdatedParm( m_TotalProjSpan.GetID() ) )
+    if ( UpdatedParm( m_TotalProjSpan ) )
     {
         UpdateTotalProjSpan();
         total_change_flag = true;
     }
 
-    if ( UpdatedParm( m_TotalChord.GetID() ) )
+    if ( UpdatedParm( m_TotalChord ) )
     {
         UpdateTotalChord();
         total_change_flag = true;
     }
 
-    if ( UpdatedParm( m_TotalArea.GetID() ) )
+    if ( UpdatedParm( m_TotalArea ) )
     {
         UpdateTotalArea();
         total_change_flag = true;
@@ -18,11 +18,19 @@ public:
     WireGeom( Vehicle* vehicle_ptr );
     virtual ~WireGeom();
 
+    //==== Points Are Transformed As The Surface Is Built ====//
+    virtual bool SurfDependsOnPlacement()           { return true; }
+
     virtual int GetNumMainSurfs()
     {
         return 0;
     };
 
+    virtual bool CanDeferLoad()
+    {
+        return false;
+    }
+
     virtual void UpdateSurf();
     virtual void UpdateDrawObj();
 
@@ -39,6 +47,7 @@ public:
     virtual vector< TMesh* > CreateTMeshVec();
 
     virtual void CreateDegenGeom( vector<DegenGeom> &dgs, bool preview = false );
+    virtual int PrepareDegenSurfs()                     { return -1; }
 
     virtual int GetNumTotalHrmSurfs();
     virtual void WriteXSecFile( int geom_no, FILE* dump_file );
@@ -107,6 +107,7 @@ void CfdMeshScreen::CreateGlobalTab()
     m_GlobalTabLayout.AddDividerBox("Geometry Control");
     m_GlobalTabLayout.AddYGap();
     m_GlobalTabLayout.AddButton(m_IntersectSubsurfaces, "Intersect Subsurfaces");
+    m_GlobalTabLayout.AddButton(m_OutOfCore, "Keep Finished Meshes Out of Core");
     m_GlobalTabLayout.AddYGap();
 
     m_GlobalTabLayout.SetChoiceButtonWidth(m_GlobalTabLayout.GetRemainX() / 2.0);
@@ -174,6 +175,7 @@ void CfdMeshScreen::CreateOutputTab()
 
     m_OutputTabLayout.SetFitWidthFlag( true );
     m_OutputTabLayout.AddButton(m_TaggedMultiSolid, "Tagged Multi Sold STL (Non-Standard)");
+    m_OutputTabLayout.AddButton(m_BinarySTL, "Binary STL");
     m_OutputTabLayout.SetFitWidthFlag( false );
     m_OutputTabLayout.ForceNewLine();
     m_OutputTabLayout.AddYGap();
@@ -208,6 +210,11 @@ void CfdMeshScreen::CreateOutputTab()
     m_OutputTabLayout.SetButtonWidth( m_OutputTabLayout.GetRemainX() );
     m_OutputTabLayout.AddButton(m_SelectMshFile, "...");
     m_OutputTabLayout.ForceNewLine();
+
+    m_OutputTabLayout.SetFitWidthFlag( true );
+    m_OutputTabLayout.AddButton(m_ExportBinary, "Binary .tri and .msh (Gmsh 4.1)");
+    m_OutputTabLayout.SetFitWidthFlag( false );
+    m_OutputTabLayout.ForceNewLine();
     m_OutputTabLayout.AddYGap();
 
     m_OutputTabLayout.SetFitWidthFlag( true );
@@ -678,6 +685,7 @@ void CfdMeshScreen::UpdateGlobalTab()
 
     //===== Geometry Control =====//
     m_IntersectSubsurfaces.Update( m_Vehicle->GetCfdSettingsPtr()->m_IntersectSubSurfs.GetID() );
+    m_OutOfCore.Update( m_Vehicle->GetCfdSettingsPtr()->m_OutOfCoreFlag.GetID() );
 }
 
 void CfdMeshScreen::UpdateDisplayTab()
@@ -734,6 +742,8 @@ void CfdMeshScreen::UpdateOutputTab()
     //==== Update File Output Flags ====//
     m_StlFile.Update( m_Vehicle->GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_STL_FILE_NAME )->GetID() );
     m_TaggedMultiSolid.Update( m_Vehicle->m_STLMultiSolid.GetID() );
+    m_BinarySTL.Update( m_Vehicle->m_STLBinary.GetID() );
+    m_ExportBinary.Update( m_Vehicle->GetCfdSettingsPtr()->m_ExportBinaryFlag.GetID() );
     m_PolyFile.Update( m_Vehicle->GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_POLY_FILE_NAME )->GetID() );
     m_TriFile.Update( m_Vehicle->GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_TRI_FILE_NAME )->GetID() );
     m_FacFile.Update( m_Vehicle->GetCfdSettingsPtr()->GetExportFileFlag( vsp::CFD_FACET_FILE_NAME )->GetID() );
@@ -68,6 +68,7 @@ protected:
 
     ToggleButton m_Rig3dGrowthLimit;
     ToggleButton m_IntersectSubsurfaces;
+    ToggleButton m_OutOfCore;
 
     TriggerButton m_GlobSrcAdjustLenLftLft;
     TriggerButton m_GlobSrcAdjustLenLft;
@@ -105,6 +106,8 @@ protected:
 
     ToggleButton m_StlFile;
     ToggleButton m_TaggedMultiSolid;
+    ToggleButton m_BinarySTL;
+    ToggleButton m_ExportBinary;
     ToggleButton m_PolyFile;
     ToggleButton m_TriFile;
     ToggleButton m_FacFile;
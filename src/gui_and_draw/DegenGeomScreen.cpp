@@ -9,7 +9,7 @@
 #include "CfdMeshMgr.h"
 #include "StringUtil.h"
 
-DegenGeomScreen::DegenGeomScreen( ScreenMgr* mgr ) : BasicScreen( mgr, 375, 365, "Degen Geom - Compute Models, File IO" )
+DegenGeomScreen::DegenGeomScreen( ScreenMgr* mgr ) : BasicScreen( mgr, 375, 395, "Degen Geom - Compute Models, File IO" )
 {
     m_FLTK_Window->callback( staticCloseCB, this );
     m_MainLayout.SetGroupAndScreen( m_FLTK_Window, this );
@@ -42,6 +42,12 @@ DegenGeomScreen::DegenGeomScreen( ScreenMgr* mgr ) : BasicScreen( mgr, 375, 365,
     m_BorderLayout.ForceNewLine();
     m_BorderLayout.AddYGap();
 
+    m_BorderLayout.AddButton(m_BinToggle, ".bin");
+    m_BorderLayout.AddOutput(m_BinOutput);
+    m_BorderLayout.AddButton(m_BinSelect, "...");
+    m_BorderLayout.ForceNewLine();
+    m_BorderLayout.AddYGap();
+
     m_BorderLayout.SetFitWidthFlag( true );
     m_BorderLayout.SetSameLineFlag( false );
 
@@ -108,12 +114,15 @@ bool DegenGeomScreen::Update()
     //===== Update File Toggle Buttons =====//
     m_CsvToggle.Update( vehiclePtr->m_exportDegenGeomCsvFile.GetID() );
     m_MToggle.Update( vehiclePtr->m_exportDegenGeomMFile.GetID() );
+    m_BinToggle.Update( vehiclePtr->m_exportDegenGeomBinFile.GetID() );
 
     //===== Update File Output Text =====//
     string csvName = vehiclePtr->getExportFileName( vsp::DEGEN_GEOM_CSV_TYPE );
     string mName = vehiclePtr->getExportFileName( vsp::DEGEN_GEOM_M_TYPE );
     m_CsvOutput.Update( StringUtil::truncateFileName( csvName, 40 ).c_str() );
     m_MOutput.Update( StringUtil::truncateFileName( mName, 40 ).c_str() );
+    string binName = vehiclePtr->getExportFileName( vsp::DEGEN_GEOM_BIN_TYPE );
+    m_BinOutput.Update( StringUtil::truncateFileName( binName, 40 ).c_str() );
 
     m_FLTK_Window->redraw();
     return false;
@@ -151,6 +160,12 @@ void DegenGeomScreen::GuiDeviceCallBack( GuiDevice* device )
                                        m_ScreenMgr->GetSelectFileScreen()->FileChooser(
                                                "Select degen geom Matlab output file.", "*.m" ) );
     }
+    else if ( device == &m_BinSelect )
+    {
+        vehiclePtr->setExportFileName( vsp::DEGEN_GEOM_BIN_TYPE,
+                                       m_ScreenMgr->GetSelectFileScreen()->FileChooser(
+                                               "Select degen geom binary output file.", "*.bin" ) );
+    }
     else if ( device == &m_UseSet )
     {
         m_SelectedSetIndex = m_UseSet.GetVal();
@@ -164,7 +179,7 @@ void DegenGeomScreen::GuiDeviceCallBack( GuiDevice* device )
         vehiclePtr->CreateDegenGeom( m_SelectedSetIndex );
         m_TextDisplay->buffer()->append("Done!\n");
 
-        if ( vehiclePtr->getExportDegenGeomCsvFile() || vehiclePtr->getExportDegenGeomMFile() )
+        if ( vehiclePtr->getExportDegenGeomCsvFile() || vehiclePtr->getExportDegenGeomMFile() || vehiclePtr->getExportDegenGeomBinFile() )
         {
             m_TextDisplay->buffer()->append("--------------------------------\n");
             m_TextDisplay->buffer()->append("\nWriting output...\n");
@@ -11,6 +11,8 @@
 
 #include "GuiDevice.h"
 #include "ParmMgr.h"
+#include "VehicleMgr.h"
+#include "Vehicle.h"
 #include "ScreenBase.h"
 #include "ScreenMgr.h"
 #include "LinkMgr.h"
@@ -227,6 +229,22 @@ bool GuiDevice::CheckValUpdate( double val )
 }
 
 //==== Update ====//
+//==== Set Parm From A Slider, Deferring Geom Rebuilds While Dragging ====//
+void GuiDevice::SetFromDrag( Parm* parm_ptr, double new_val, bool drag_flag )
+{
+    Vehicle* veh = VehicleMgr.GetVehicle();
+    if ( veh && drag_flag )
+    {
+        veh->SetDeferDeviceUpdates( true );
+        parm_ptr->SetFromDevice( new_val, drag_flag );
+        veh->SetDeferDeviceUpdates( false );
+    }
+    else
+    {
+        parm_ptr->SetFromDevice( new_val, drag_flag );
+    }
+}
+
 void GuiDevice::Update( const string& parm_id )
 {
     //==== Set ParmID And Check For Valid ParmPtr ====//
@@ -604,7 +622,7 @@ void Slider::DeviceCB( Fl_Widget* w )
         {
             new_val = m_Slider->value();
         }
-        parm_ptr->SetFromDevice( new_val, drag_flag );
+        SetFromDrag( parm_ptr, new_val, drag_flag );
     }
 
     m_Screen->GuiDeviceCallBack( this );
@@ -726,7 +744,7 @@ void SliderAdjRange::DeviceCB( Fl_Widget* w )
                 new_val /= fp->GetRefVal();  // Unscale result to set m_Val
             }
         }
-        parm_ptr->SetFromDevice( new_val, drag_flag );
+        SetFromDrag( parm_ptr, new_val, drag_flag );
         FindStopState( parm_ptr );
     }
     else if ( w == m_MinButton )
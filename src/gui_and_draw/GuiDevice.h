@@ -166,6 +166,7 @@ protected:
 
     virtual bool CheckValUpdate( double val );
     virtual Parm* SetParmID( const string& parm_id );
+    virtual void SetFromDrag( Parm* parm_ptr, double new_val, bool drag_flag );
     virtual void SetValAndLimits( Parm* parm_ptr ) = 0;
 
     //==== First Widget Is Assumed Resizable For Set Width =====//
@@ -61,7 +61,7 @@ void ImportScreen::ImportFile( string & in_file, int type )
     }
     else if ( type == IMPORT_PTS )
     {
-        in_file = m_ScreenMgr->GetSelectFileScreen()->FileChooser( "Import Points File?", "*.pts" );
+        in_file = m_ScreenMgr->GetSelectFileScreen()->FileChooser( "Import Points File?", "*.{pts,ply,las}" );
     }
     else if ( type == IMPORT_V2 )
     {
@@ -37,9 +37,18 @@
 #include "WaveDragScreen.h"
 #include "VSPAEROScreen.h"
 #include "MeasureMgr.h"
+#include "FrameStats.h"
+#include "ProcessUtil.h"
+#include "CfdMeshMgr.h"
+#include "FeaMeshMgr.h"
+
+#include <FL/gl.h>
 
 #pragma warning(disable:4244)
 
+#define TEXTURE_LOADS_PER_FRAME 1
+#define PROFILE_NUM_FRAMES 600
+
 using namespace VSPGraphic;
 
 namespace VSPGUI
@@ -71,6 +80,12 @@ VspGlWindow::VspGlWindow( int x, int y, int w, int h, ScreenMgr * mgr, DrawObj::
 
     m_hasSetSize = false;
 
+    m_syncRevision = 0;
+
+    m_ShowProfiler = false;
+    m_CurrProfile = FrameProfile();
+    m_ProfileIndx = 0;
+
 #ifdef __APPLE__
 #if FL_API_VERSION >= 10304
     Fl::use_high_res_GL( true );
@@ -163,7 +178,133 @@ void VspGlWindow::draw()
         m_ScreenMgr->GetScreen( ScreenMgr::VSP_SCREENSHOT_SCREEN )->Update();
     }
 
+    // Decode queued textures a few per frame, so loading a model with many
+    // decals doesn't freeze the GUI.  Redraw until the queue is empty.
+    if ( VSPGraphic::GlobalTextureRepo()->loadPending( TEXTURE_LOADS_PER_FRAME ) )
+    {
+        redraw();
+    }
+
+    FrameStatsSingle.setGpuTiming( m_ShowProfiler );
+
+    double start_time = GetWallTime();
     m_GEngine->draw( m_mouse_x, m_mouse_y );
+    m_CurrProfile.drawTime = 1000.0 * ( GetWallTime() - start_time );
+
+    _recordProfile();
+
+    if ( m_ShowProfiler )
+    {
+        _drawProfiler();
+    }
+}
+
+//==== Close Out This Frame's Profile And Start The Next ====//
+void VspGlWindow::_recordProfile()
+{
+    Vehicle* vPtr = VehicleMgr.GetVehicle();
+    if ( vPtr )
+    {
+        m_CurrProfile.updateTime = 1000.0 * vPtr->TakeUpdateTime();
+    }
+    m_CurrProfile.gpuTime = FrameStatsSingle.getGpuTime();
+    m_CurrProfile.drawCalls = FrameStatsSingle.getDrawCalls();
+    m_CurrProfile.uploadBytes = FrameStatsSingle.getUploadBytes();
+
+    if ( ( int )m_ProfileVec.size() < PROFILE_NUM_FRAMES )
+    {
+        m_ProfileVec.push_back( m_CurrProfile );
+    }
+    else
+    {
+        m_ProfileVec[ m_ProfileIndx ] = m_CurrProfile;
+    }
+    m_ProfileIndx = ( m_ProfileIndx + 1 ) % PROFILE_NUM_FRAMES;
+
+    m_CurrProfile = FrameProfile();
+    FrameStatsSingle.reset();
+}
+
+//==== Draw Latest Frame Profile In Upper Left Corner ====//
+void VspGlWindow::_drawProfiler()
+{
+    if ( m_ProfileVec.empty() )
+    {
+        return;
+    }
+
+    int last = ( m_ProfileIndx + PROFILE_NUM_FRAMES - 1 ) % PROFILE_NUM_FRAMES;
+    const FrameProfile & p = m_ProfileVec[ last ];
+
+    //==== Approximate Memory Held By The Geoms And The Mesh Managers ====//
+    GeomMemUsage usage;
+    Vehicle* vPtr = VehicleMgr.GetVehicle();
+    if ( vPtr )
+    {
+        vPtr->AddMemoryUsage( usage );
+    }
+    double mb = 1024.0 * 1024.0;
+    double mesh_mb = ( CfdMeshMgr.MemoryUsage() + FeaMeshMgr.MemoryUsage() ) / mb;
+
+    char str[8][256];
+    sprintf( str[0], "Update  %8.2f ms", p.updateTime );
+    sprintf( str[1], "Collect %8.2f ms", p.collectTime );
+    sprintf( str[2], "Upload  %8.2f ms  %10.0f KB", p.uploadTime, p.uploadBytes / 1024.0 );
+    sprintf( str[3], "Draw    %8.2f ms  %10u calls", p.drawTime, p.drawCalls );
+    sprintf( str[4], "GPU     %8.2f ms", p.gpuTime );
+    sprintf( str[5], "Geoms   %8.1f MB  %8.1f MB draw  %8.1f MB tess", usage.Total() / mb, usage.m_DrawObj / mb, usage.m_Tess / mb );
+    sprintf( str[6], "Memory  %8.1f MB mesh  %8.1f MB peak", mesh_mb, GetPeakMemoryMB() );
+    sprintf( str[7], "Shift+F12 Writes %s", "vsp_frame_profile.csv" );
+
+    glViewport( 0, 0, pixel_w(), pixel_h() );
+    glMatrixMode( GL_PROJECTION );
+    glPushMatrix();
+    glLoadIdentity();
+    glOrtho( 0, pixel_w(), 0, pixel_h(), -1, 1 );
+    glMatrixMode( GL_MODELVIEW );
+    glPushMatrix();
+    glLoadIdentity();
+
+    glDisable( GL_DEPTH_TEST );
+    glDisable( GL_LIGHTING );
+    glDisable( GL_TEXTURE_2D );
+
+    glColor3f( 0.8f, 0.0f, 0.0f );
+    gl_font( FL_COURIER, 12 );
+
+    int line_h = gl_height() + 2;
+    for ( int i = 0; i < 8; i++ )
+    {
+        gl_draw( str[i], 10, pixel_h() - ( i + 1 ) * line_h );
+    }
+
+    glMatrixMode( GL_PROJECTION );
+    glPopMatrix();
+    glMatrixMode( GL_MODELVIEW );
+    glPopMatrix();
+}
+
+//==== Write Recent Frame Profiles, Oldest First ====//
+void VspGlWindow::_dumpProfiler()
+{
+    FILE* fp = fopen( "vsp_frame_profile.csv", "w" );
+    if ( !fp )
+    {
+        return;
+    }
+
+    fprintf( fp, "Frame,Update_ms,Collect_ms,Upload_ms,Draw_ms,GPU_ms,DrawCalls,UploadBytes\n" );
+
+    int n = m_ProfileVec.size();
+    int first = ( n < PROFILE_NUM_FRAMES ) ? 0 : m_ProfileIndx;
+    for ( int i = 0; i < n; i++ )
+    {
+        const FrameProfile & p = m_ProfileVec[ ( first + i ) % n ];
+        fprintf( fp, "%d,%f,%f,%f,%f,%f,%u,%.0f\n", i, p.updateTime, p.collectTime, p.uploadTime,
+                 p.drawTime, p.gpuTime, p.drawCalls, p.uploadBytes );
+    }
+
+    fclose( fp );
 }
 
 int VspGlWindow::handle( int fl_event )
@@ -264,6 +405,8 @@ void VspGlWindow::update()
             }
         }
 
+        double start_time = GetWallTime();
+
         // Get Render Objects from Vehicle.
         vector<DrawObj *> drawObjs = vPtr->GetDrawObjs();
 
@@ -367,9 +510,14 @@ void VspGlWindow::update()
             AeroScreen->LoadDrawObjs( drawObjs );
         }
 
+        double collect_time = GetWallTime();
+        m_CurrProfile.collectTime += 1000.0 * ( collect_time - start_time );
+
         // Load Objects to Renderer.
         _update( drawObjs );
 
+        m_CurrProfile.uploadTime += 1000.0 * ( GetWallTime() - collect_time );
+
         // Once updated data is stored in buffer, 
         // reset geometry changed flag to false.
         vPtr->ResetDrawObjsGeomChangedFlags();
@@ -440,10 +588,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_ENTITY, &id );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
             eObj = dynamic_cast<VSPGraphic::Entity*> ( m_GEngine->getScene()->getObject( id ) );
             if( eObj )
@@ -471,10 +616,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_ENTITY, &id );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
             eObj = dynamic_cast<VSPGraphic::Entity*> ( m_GEngine->getScene()->getObject( id ) );
             if( eObj )
@@ -501,10 +643,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_ENTITY, &id );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
             eObj = dynamic_cast<VSPGraphic::Entity*> ( m_GEngine->getScene()->getObject( id ) );
             if( eObj )
@@ -531,10 +670,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_ENTITY, &id );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
             eObj = dynamic_cast<VSPGraphic::Entity*> ( m_GEngine->getScene()->getObject( id ) );
             if( eObj )
@@ -561,10 +697,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_CFD_ENTITY, &id );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
             eObj = dynamic_cast<VSPGraphic::Entity*> ( m_GEngine->getScene()->getObject( id ) );
             if( eObj )
@@ -591,10 +724,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_CFD_ENTITY, &id );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
             eObj = dynamic_cast<VSPGraphic::Entity*> ( m_GEngine->getScene()->getObject( id ) );
             if( eObj )
@@ -621,10 +751,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_ENTITY, &id );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
             eObj = dynamic_cast<VSPGraphic::Entity*> ( m_GEngine->getScene()->getObject( id ) );
             if( eObj )
@@ -651,10 +778,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_ENTITY, &id );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
             eObj = dynamic_cast<VSPGraphic::Entity*> ( m_GEngine->getScene()->getObject( id ) );
             if ( eObj )
@@ -679,10 +803,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_ENTITY, &id );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
             eObj = dynamic_cast<VSPGraphic::Entity*> ( m_GEngine->getScene()->getObject( id ) );
             if ( eObj )
@@ -709,10 +830,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_ENTITY, &id );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
             eObj = dynamic_cast<VSPGraphic::Entity*> ( m_GEngine->getScene()->getObject( id ) );
             if ( eObj )
@@ -739,10 +857,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_ENTITY, &id );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
             eObj = dynamic_cast<VSPGraphic::Entity*> ( m_GEngine->getScene()->getObject( id ) );
             if( eObj )
@@ -767,10 +882,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_ENTITY, &id );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
             eObj = dynamic_cast<VSPGraphic::Entity*> ( m_GEngine->getScene()->getObject( id ) );
             if( eObj )
@@ -795,10 +907,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_ENTITY, &id );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
             eObj = dynamic_cast<VSPGraphic::Entity*> ( m_GEngine->getScene()->getObject( id ) );
             if( eObj )
@@ -854,10 +963,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_RULER, &id );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
             ruler = dynamic_cast<VSPGraphic::Ruler*> ( m_GEngine->getScene()->getObject( id ) );
             if( ruler )
@@ -919,10 +1025,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_PROBE, &id );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
             probe = dynamic_cast<VSPGraphic::Probe*> ( m_GEngine->getScene()->getObject( id ) );
             if( probe )
@@ -1014,10 +1117,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
                 {
                     m_GEngine->getScene()->createObject( Common::VSP_OBJECT_PICK_GEOM, &id, sourceId->bufferID );
 
-                    ID idInfo;
-                    idInfo.bufferID = id;
-                    idInfo.geomID = objects[i]->m_GeomID;
-                    m_ids.push_back( idInfo );
+                    _addID( id, objects[i]->m_GeomID );
                 }
             }
             pObj = dynamic_cast<Pickable*> ( m_GEngine->getScene()->getObject( id ) );
@@ -1037,10 +1137,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
                 {
                     m_GEngine->getScene()->createObject( Common::VSP_OBJECT_PICK_VERTEX, &id, sourceId->bufferID );
 
-                    ID idInfo;
-                    idInfo.bufferID = id;
-                    idInfo.geomID = objects[i]->m_GeomID;
-                    m_ids.push_back( idInfo );
+                    _addID( id, objects[i]->m_GeomID );
                 }
             }
             ppntObj = dynamic_cast<PickablePnts*> ( m_GEngine->getScene()->getObject( id ) );
@@ -1058,10 +1155,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_PICK_LOCATION, &id, 0 );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
             pObj = dynamic_cast<Pickable*> ( m_GEngine->getScene()->getObject( id ) );
             if( pObj )
@@ -1116,10 +1210,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_MARKER, &id );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
 
             rObj = dynamic_cast<Renderable*> ( m_GEngine->getScene()->getObject( id ) );
@@ -1144,10 +1235,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_MARKER, &id );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
 
             rObj = dynamic_cast<Renderable*> ( m_GEngine->getScene()->getObject( id ) );
@@ -1170,10 +1258,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_MARKER, &id );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
             rObj = dynamic_cast<Renderable*> ( m_GEngine->getScene()->getObject( id ) );
             if( rObj )
@@ -1195,10 +1280,7 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
             {
                 m_GEngine->getScene()->createObject( Common::VSP_OBJECT_MARKER, &id );
 
-                ID idInfo;
-                idInfo.bufferID = id;
-                idInfo.geomID = objects[i]->m_GeomID;
-                m_ids.push_back( idInfo );
+                _addID( id, objects[i]->m_GeomID );
             }
             rObj = dynamic_cast<Renderable*> ( m_GEngine->getScene()->getObject( id ) );
             if( rObj )
@@ -1223,63 +1305,69 @@ void VspGlWindow::_update( std::vector<DrawObj *> objects )
 
 VspGlWindow::ID * VspGlWindow::_findID( std::string geomID )
 {
-    for( int i = 0; i < ( int )m_ids.size(); i++ )
+    std::unordered_map< std::string, ID >::iterator it = m_ids.find( geomID );
+    if( it != m_ids.end() )
     {
-        if( m_ids[i].geomID == geomID )
-        {
-            return &m_ids[i];
-        }
+        return &it->second;
     }
     return NULL;
 }
 
 VspGlWindow::ID * VspGlWindow::_findID( unsigned int bufferID )
 {
-    for( int i = 0; i < ( int )m_ids.size(); i++ )
+    std::unordered_map< unsigned int, std::string >::iterator it = m_bufferIDs.find( bufferID );
+    if( it != m_bufferIDs.end() )
     {
-        if( m_ids[i].bufferID == bufferID )
-        {
-            return &m_ids[i];
-        }
+        return _findID( it->second );
     }
     return NULL;
 }
 
+void VspGlWindow::_addID( unsigned int bufferID, const std::string & geomID )
+{
+    // Map nodes never move, so ID pointers from _findID stay valid across inserts.
+    ID & idInfo = m_ids[ geomID ];
+    idInfo.bufferID = bufferID;
+    idInfo.geomID = geomID;
+    idInfo.revision = m_syncRevision;
+
+    m_bufferIDs[ bufferID ] = geomID;
+}
+
 void VspGlWindow::_updateBuffer( std::vector<DrawObj *> objects )
 {
-    std::vector<ID> idsToRemove;
-    std::vector<ID> idsToKeep;
+    // Stamp every buffer object that still has a DrawObj with this sync's
+    // revision.  "Default" objects are rebuilt every update.
+    m_syncRevision++;
 
-    // Figure out if any buffer object no longer exists in DrawObjs.
-    for( int i = 0; i < ( int )m_ids.size(); i++ )
+    for( int i = 0; i < ( int )objects.size(); i++ )
     {
-        bool exist = false;
-        for( int j = 0; j < ( int )objects.size(); j++ )
+        if( objects[i]->m_GeomID == std::string( "Default" ) )
         {
-            if( m_ids[i].geomID == objects[j]->m_GeomID && m_ids[i].geomID != std::string( "Default" ) )
-            {
-                idsToKeep.push_back( m_ids[i] );
-                exist = true;
-                break;
-            }
+            continue;
         }
-        if( !exist )
+
+        ID * idPtr = _findID( objects[i]->m_GeomID );
+        if( idPtr )
         {
-            idsToRemove.push_back( m_ids[i] );
+            idPtr->revision = m_syncRevision;
         }
     }
 
-    // Remove unnecessary buffers.
-    for( int i = 0; i < ( int )idsToRemove.size(); i++ )
+    // Remove buffers whose DrawObj no longer exists.
+    std::unordered_map< std::string, ID >::iterator it = m_ids.begin();
+    while( it != m_ids.end() )
     {
-        m_GEngine->getScene()->removeObject( idsToRemove[i].bufferID );
-    }
-
-    // Update m_ids.
-    m_ids.clear();
-    for( int i = 0; i < ( int )idsToKeep.size(); i++ )
-    {
-        m_ids.push_back( idsToKeep[i] );
+        if( it->second.revision != m_syncRevision )
+        {
+            m_GEngine->getScene()->removeObject( it->second.bufferID );
+            m_bufferIDs.erase( it->second.bufferID );
+            it = m_ids.erase( it );
+        }
+        else
+        {
+            ++it;
+        }
     }
 }
 
@@ -1352,7 +1440,7 @@ void VspGlWindow::_updateTextures( DrawObj * drawObj )
                     TextureID newTex;
                     newTex.geomTexID = drawObjTexList[i].ID;
                     newTex.bufferTexID = entity->getTextureMgr()
-                        ->add( VSPGraphic::GlobalTextureRepo()->get2DTexture(drawObjTexList[i].FileName.c_str() ) );
+                        ->add( VSPGraphic::GlobalTextureRepo()->get2DTexture( drawObjTexList[i].FileName.c_str(), true ) );
                     id->textureIDs.push_back( newTex );
 
                     texBufferID = newTex.bufferTexID;
@@ -1385,6 +1473,60 @@ void VspGlWindow::_updateTextures( DrawObj * drawObj )
 
 void VspGlWindow::_loadXSecData( Renderable * destObj, DrawObj * drawObj )
 {
+    // Symmetric copies drawn as instances of one buffer.
+    std::vector<glm::mat4> instances( drawObj->m_InstanceXFormVec.size() );
+    for ( int i = 0; i < ( int )drawObj->m_InstanceXFormVec.size(); i++ )
+    {
+        const double * m = drawObj->m_InstanceXFormVec[i].data();
+        for ( int j = 0; j < 16; j++ )
+        {
+            instances[i][j / 4][j % 4] = ( float )m[j];
+        }
+    }
+    destObj->setInstances( instances );
+
+    // Packed data is already in buffer layout, upload it without repacking.
+    if ( !drawObj->m_PackedVerts.empty() )
+    {
+        destObj->setFacingCW( drawObj->m_FlipNormals );
+
+        destObj->loadVBuffer( &drawObj->m_PackedVerts[0], sizeof( float ) * drawObj->m_PackedVerts.size() );
+
+        if ( drawObj->m_PackedQuadIndx.empty() )
+        {
+            destObj->emptyEBuffer();
+        }
+        else
+        {
+            destObj->loadEBuffer( &drawObj->m_PackedQuadIndx[0], sizeof( unsigned int ) * drawObj->m_PackedQuadIndx.size() );
+        }
+        destObj->enableEBuffer( true );
+
+        // Coarser levels of detail, picked per frame from the size on screen.
+        destObj->clearLodEBuffers();
+        for ( int i = 0; i < ( int )drawObj->m_PackedLodQuadIndx.size(); i++ )
+        {
+            const std::vector< unsigned int > & lod = drawObj->m_PackedLodQuadIndx[i];
+            if ( !lod.empty() )
+            {
+                destObj->loadLodEBuffer( i + 1, ( void* )&lod[0], sizeof( unsigned int ) * lod.size() );
+            }
+        }
+
+        glm::vec3 bmin( drawObj->m_PackedVerts[0], drawObj->m_PackedVerts[1], drawObj->m_PackedVerts[2] );
+        glm::vec3 bmax = bmin;
+        for ( int i = 8; i < ( int )drawObj->m_PackedVerts.size(); i += 8 )
+        {
+            glm::vec3 p( drawObj->m_PackedVerts[i], drawObj->m_PackedVerts[i + 1], drawObj->m_PackedVerts[i + 2] );
+            bmin = glm::min( bmin, p );
+            bmax = glm::max( bmax, p );
+        }
+        destObj->setBoundingBox( bmin, bmax );
+        return;
+    }
+
+    destObj->clearLodEBuffers();
+
     std::vector<float> vdata;
     std::vector<unsigned int> edata;
 
@@ -1460,13 +1602,21 @@ void VspGlWindow::_loadXSecData( Renderable * destObj, DrawObj * drawObj )
 
     destObj->setFacingCW( drawObj->m_FlipNormals );
 
-    destObj->emptyVBuffer();
-    destObj->appendVBuffer( vdata.data(), sizeof(float) * vdata.size() );
+    destObj->loadVBuffer( vdata.data(), sizeof(float) * vdata.size() );
 
-    destObj->emptyEBuffer();
-    destObj->appendEBuffer( edata.data(), sizeof( unsigned int ) * edata.size() );
+    destObj->loadEBuffer( edata.data(), sizeof( unsigned int ) * edata.size() );
     destObj->enableEBuffer( true );
 
+    std::vector< vec3d > pnts;
+    pnts.reserve( vtotal );
+    for ( int k = 0; k < num_mesh; k++ )
+    {
+        for ( int i = 0 ; i < ( int )drawObj->m_PntMesh[k].size() ; i++ )
+        {
+            pnts.insert( pnts.end(), drawObj->m_PntMesh[k][i].begin(), drawObj->m_PntMesh[k][i].end() );
+        }
+    }
+    _setBounds( destObj, pnts );
 }
 
 void VspGlWindow::_loadTrisData( Renderable * destObj, DrawObj * drawObj )
@@ -1490,8 +1640,9 @@ void VspGlWindow::_loadTrisData( Renderable * destObj, DrawObj * drawObj )
     }
     destObj->setFacingCW( drawObj->m_FlipNormals );
 
-    destObj->emptyVBuffer();
-    destObj->appendVBuffer( data.data(), sizeof( float ) * data.size() );
+    destObj->loadVBuffer( data.data(), sizeof( float ) * data.size() );
+
+    _setBounds( destObj, drawObj->m_PntVec );
 }
 
 // Currently identical to _loadTrisData.  Should make more generic.  Possibly _loadVertNormData
@@ -1519,8 +1670,26 @@ void VspGlWindow::_loadQuadsData( Renderable * destObj, DrawObj * drawObj )
     }
     destObj->setFacingCW( drawObj->m_FlipNormals );
 
-    destObj->emptyVBuffer();
-    destObj->appendVBuffer( data.data(), sizeof( float ) * data.size() );
+    destObj->loadVBuffer( data.data(), sizeof( float ) * data.size() );
+
+    _setBounds( destObj, drawObj->m_PntVec );
+}
+
+void VspGlWindow::_setBounds( Renderable * destObj, const std::vector< vec3d > & pnts )
+{
+    if ( pnts.empty() )
+    {
+        return;
+    }
+
+    BndBox bb;
+    for ( int i = 0; i < ( int )pnts.size(); i++ )
+    {
+        bb.Update( pnts[i] );
+    }
+
+    destObj->setBoundingBox( glm::vec3( bb.GetMin( 0 ), bb.GetMin( 1 ), bb.GetMin( 2 ) ),
+                             glm::vec3( bb.GetMax( 0 ), bb.GetMax( 1 ), bb.GetMax( 2 ) ) );
 }
 
 void VspGlWindow::_loadMarkData( Renderable * destObj, DrawObj * drawObj )
@@ -1979,6 +2148,18 @@ int VspGlWindow::OnKeyup( int x, int y )
         handled = 1;
         break;
 
+    case FL_F+12:
+        if( Fl::event_state( FL_SHIFT ) )
+        {
+            _dumpProfiler();
+        }
+        else
+        {
+            m_ShowProfiler = !m_ShowProfiler;
+        }
+        handled = 1;
+        break;
+
     case FL_Alt_L:
     case FL_Alt_R:
 
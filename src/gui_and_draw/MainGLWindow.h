@@ -6,6 +6,8 @@
 #include <vector>
 #include <string>
 
+#include "UsingCpp11.h"
+
 #include <glm/glm.hpp>
 
 #include "Vec3d.h"
@@ -141,6 +143,8 @@ private:
     static void _loadXSecData( VSPGraphic::Renderable * destObj, DrawObj * drawObj );
     static void _loadMarkData( VSPGraphic::Renderable * destObj, DrawObj * drawObj );
 
+    static void _setBounds( VSPGraphic::Renderable * destObj, const std::vector< vec3d > & pnts );
+
     void _update( std::vector<DrawObj *> objects );
 
     void _setLighting( DrawObj * drawObj );
@@ -152,6 +156,8 @@ private:
     ID * _findID( std::string geomID );
     ID * _findID( unsigned int bufferID );
 
+    void _addID( unsigned int bufferID, const std::string & geomID );
+
     void _updateBuffer( std::vector<DrawObj *> objects );
 
     void _sendFeedback( VSPGraphic::Selectable * selected );
@@ -163,6 +169,10 @@ private:
     int OnKeyup( int x, int y );
     int OnKeydown();
 
+    void _recordProfile();
+    void _drawProfiler();
+    void _dumpProfiler();
+
 private:
     VSPGraphic::GraphicEngine * m_GEngine;
     ScreenMgr * m_ScreenMgr;
@@ -179,6 +189,9 @@ private:
         std::string geomID;
         std::vector<TextureID> textureIDs;
 
+        // Sync revision of the last update that saw this DrawObj.
+        unsigned int revision;
+
         TextureID * find( std::string geomTexID )
         {
             for( int i = 0; i < ( int )textureIDs.size(); i++ )
@@ -191,7 +204,12 @@ private:
             return NULL;
         }
     };
-    std::vector<ID> m_ids;
+    // Buffer objects keyed by DrawObj GeomID, and the reverse lookup by buffer ID.
+    std::unordered_map< std::string, ID > m_ids;
+    std::unordered_map< unsigned int, std::string > m_bufferIDs;
+
+    // Incremented on every scene sync; used to find stale buffer objects.
+    unsigned int m_syncRevision;
 
     int m_mouse_x;
     int m_mouse_y;
@@ -203,6 +221,22 @@ private:
     // Boolean for setting default opengl screen size once
     bool m_hasSetSize;
 
+    // Per frame stage times in ms.  F12 shows them, Shift+F12 dumps recent frames to CSV.
+    struct FrameProfile
+    {
+        double updateTime;      // Geom updates since the previous frame
+        double collectTime;     // Gathering DrawObjs
+        double uploadTime;      // Loading DrawObjs into buffers
+        double drawTime;        // CPU time issuing GL draws
+        double gpuTime;         // GPU draw time, from a timer query
+        unsigned int drawCalls;
+        double uploadBytes;
+    };
+    bool m_ShowProfiler;
+    FrameProfile m_CurrProfile;
+    std::vector< FrameProfile > m_ProfileVec;
+    int m_ProfileIndx;
+
     glm::vec2 m_prevLB;
     glm::vec2 m_prevMB;
     glm::vec2 m_prevRB;
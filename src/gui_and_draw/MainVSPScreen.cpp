@@ -263,6 +263,8 @@ void MainVSPScreen::ExitVSP()
             return;
 
         case(1):
+            // Let a background save that is still writing finish.
+            VehicleMgr.GetVehicle()->WaitForSave();
             exit( 0 );
 
         case(2):
@@ -322,7 +324,7 @@ void MainVSPScreen::ActionCB( void * data )
         if ( savefile.compare( "" ) != 0 )
         {
             VehicleMgr.GetVehicle()->SetVSP3FileName( savefile );
-            VehicleMgr.GetVehicle()->WriteXMLFile( savefile, vsp::SET_ALL );
+            VehicleMgr.GetVehicle()->WriteXMLFileAsync( savefile, vsp::SET_ALL );
 
             SetFileLabel( savefile );
         }
@@ -333,7 +335,7 @@ void MainVSPScreen::ActionCB( void * data )
         if ( savefile.compare( "" ) != 0 )
         {
             VehicleMgr.GetVehicle()->SetVSP3FileName( savefile );
-            VehicleMgr.GetVehicle()->WriteXMLFile( savefile, vsp::SET_ALL );
+            VehicleMgr.GetVehicle()->WriteXMLFileAsync( savefile, vsp::SET_ALL );
 
             SetFileLabel( savefile );
         }
@@ -347,7 +349,7 @@ void MainVSPScreen::ActionCB( void * data )
             string savefile = m_ScreenMgr->GetSelectFileScreen()->FileChooser( "Save VSP Set File As", "*.vsp3" );
             if ( savefile.compare( "" ) != 0 )
             {
-                VehicleMgr.GetVehicle()->WriteXMLFile( savefile, set );
+                VehicleMgr.GetVehicle()->WriteXMLFileAsync( savefile, set );
             }
         }
     }
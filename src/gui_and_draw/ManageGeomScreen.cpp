@@ -10,6 +10,8 @@
 #include "StlHelper.h"
 #include "StringUtil.h"
 
+#include <algorithm>
+
 using namespace vsp;
 
 
@@ -155,6 +157,12 @@ bool ManageGeomScreen::Update()
 //==== Update All Geom Screens ====//
 void ManageGeomScreen::UpdateGeomScreens()
 {
+    //==== Skip Refreshing Widgets Of A Geom Nothing Touched ====//
+    if ( !m_ScreenMgr->IsGeomChanged( m_ScreenMgr->GetCurrGeom() ) )
+    {
+        return;
+    }
+
     for ( int i = 0 ; i < ( int )m_GeomScreenVec.size() ; i++ )
     {
         if ( m_GeomScreenVec[i]->IsShown() )
@@ -179,6 +187,9 @@ void ManageGeomScreen::Hide()
 }
 
 //==== Load Geom Browser ====//
+// Row text is rebuilt each update, but only rows that differ are changed in the
+// Fl_Browser, which draws visible rows only.  Parm changes that leave the tree,
+// names and selection alone do not touch the browser.
 void ManageGeomScreen::LoadBrowser()
 {
     //==== Save List of Selected Geoms ====//
@@ -187,12 +198,18 @@ void ManageGeomScreen::LoadBrowser()
     m_LastTopLine = m_GeomBrowser->topline();
 
     //==== Display Vehicle Name ====//
-    m_GeomBrowser->clear();
-    m_GeomBrowser->add( m_VehiclePtr->GetName().c_str() );
+    vector< string > line_vec;
+    line_vec.push_back( m_VehiclePtr->GetName() );
 
     //==== Get Geoms To Display ====//
     m_DisplayedGeomVec = m_VehiclePtr->GetGeomVec( true );
 
+    m_DisplayedGeomIndexMap.clear();
+    for ( int i = 0 ; i < ( int )m_DisplayedGeomVec.size() ; i++ )
+    {
+        m_DisplayedGeomIndexMap[ m_DisplayedGeomVec[i] ] = i;
+    }
+
     //==== Step Thru Comps ====//
     for ( int i = 0 ; i < ( int )m_DisplayedGeomVec.size() ; i++ )
     {
@@ -238,37 +255,103 @@ void ManageGeomScreen::LoadBrowser()
                 str.append( "(no show)" );
             }
 
-            m_GeomBrowser->add( str.c_str() );
+            line_vec.push_back( str );
+        }
+        else
+        {
+            line_vec.push_back( string() );
         }
     }
 
-    //==== Restore List of Selected Geoms ====//
+    bool changed = UpdateBrowserLines( line_vec );
+
+    //==== Sync Selection Row By Row ====//
+    vector< bool > sel_vec( m_DisplayedGeomVec.size() + 1, false );
     for ( int i = 0 ; i < ( int )activeVec.size() ; i++ )
     {
-        SelectGeomBrowser( activeVec[i] );
+        unordered_map< string, int >::const_iterator it = m_DisplayedGeomIndexMap.find( activeVec[i] );
+        if ( it != m_DisplayedGeomIndexMap.end() )
+        {
+            sel_vec[ it->second + 1 ] = true;
+        }
     }
-}
 
-void ManageGeomScreen::SelectGeomBrowser( string geom_id )
-{
-    //==== Select If Match ====//
-    for ( int i = 0 ; i < ( int )m_DisplayedGeomVec.size() ; i++ )
+    for ( int i = 0 ; i < ( int )sel_vec.size() && i < m_GeomBrowser->size() ; i++ )
     {
-        if ( m_DisplayedGeomVec[i] == geom_id )
+        if ( sel_vec[i] != ( m_GeomBrowser->selected( i + 1 ) != 0 ) )
         {
-            m_GeomBrowser->select( i + 2 );
+            m_GeomBrowser->select( i + 1, sel_vec[i] );
+            changed = true;
         }
     }
 
-    //==== Position Browser ====//
-    for ( int i = 0 ; i < ( int )m_DisplayedGeomVec.size() ; i++ )
+    //==== Restore List of Selected Geoms ====//
+    if ( changed )
     {
-        if ( m_DisplayedGeomVec[i] == geom_id )
+        for ( int i = 0 ; i < ( int )activeVec.size() ; i++ )
         {
-            m_GeomBrowser->topline( i + 2 );
-            break;
+            SelectGeomBrowser( activeVec[i] );
         }
     }
+}
+
+//==== Change Only The Browser Rows That Differ From line_vec ====//
+// The rows between the unchanged head and tail are replaced in place, with any
+// extra rows removed or inserted.  Returns false if nothing changed.
+bool ManageGeomScreen::UpdateBrowserLines( const vector< string > & line_vec )
+{
+    int nold = ( int )m_BrowserLineVec.size();
+    int nnew = ( int )line_vec.size();
+    int nmin = std::min( nold, nnew );
+
+    int head = 0;
+    while ( head < nmin && m_BrowserLineVec[ head ] == line_vec[ head ] )
+    {
+        head++;
+    }
+
+    if ( head == nold && head == nnew )
+    {
+        return false;
+    }
+
+    int tail = 0;
+    while ( tail < nmin - head && m_BrowserLineVec[ nold - 1 - tail ] == line_vec[ nnew - 1 - tail ] )
+    {
+        tail++;
+    }
+
+    int nold_mid = nold - head - tail;
+    int nnew_mid = nnew - head - tail;
+    int nreplace = std::min( nold_mid, nnew_mid );
+
+    // Fl_Browser lines are numbered from one.
+    for ( int i = 0 ; i < nreplace ; i++ )
+    {
+        m_GeomBrowser->text( head + i + 1, line_vec[ head + i ].c_str() );
+    }
+    for ( int i = nreplace ; i < nold_mid ; i++ )
+    {
+        m_GeomBrowser->remove( head + nreplace + 1 );
+    }
+    for ( int i = nreplace ; i < nnew_mid ; i++ )
+    {
+        m_GeomBrowser->insert( head + i + 1, line_vec[ head + i ].c_str() );
+    }
+
+    m_BrowserLineVec = line_vec;
+    return true;
+}
+
+void ManageGeomScreen::SelectGeomBrowser( string geom_id )
+{
+    unordered_map< string, int >::const_iterator it = m_DisplayedGeomIndexMap.find( geom_id );
+    if ( it != m_DisplayedGeomIndexMap.end() )
+    {
+        //==== Select And Position Browser ====//
+        m_GeomBrowser->select( it->second + 2 );
+        m_GeomBrowser->topline( it->second + 2 );
+    }
 
     if ( !m_CollapseFlag && m_LastTopLine < ( ( int )m_DisplayedGeomVec.size() - 2 ) )
     {
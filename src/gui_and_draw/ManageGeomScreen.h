@@ -33,8 +33,11 @@
 #include "WireScreen.h"
 #include "HumanGeomScreen.h"
 
+#include <unordered_map>
+
 using std::string;
 using std::vector;
+using std::unordered_map;
 
 class ManageGeomScreen : public BasicScreen
 {
@@ -144,11 +147,14 @@ protected:
     vector< VspScreen* > m_GeomScreenVec;
 
     vector< string > m_DisplayedGeomVec;
+    unordered_map< string, int > m_DisplayedGeomIndexMap;  // Index in m_DisplayedGeomVec
+    vector< string > m_BrowserLineVec;                      // Text of each row in m_GeomBrowser
 
     std::vector<DrawObj> m_PickList;
 
     void AddGeom();
     void LoadBrowser();
+    bool UpdateBrowserLines( const vector< string > & line_vec );
     void LoadActiveGeomOutput();
     void LoadSetChoice();
     void LoadTypeChoice();
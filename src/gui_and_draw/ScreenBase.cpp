@@ -312,6 +312,14 @@ GeomScreen::GeomScreen( ScreenMgr* mgr, int w, int h, const string & title ) :
     m_GenLayout.AddSlider( m_NumUSlider, "Num_U", 100, " %5.0f" );
     m_GenLayout.AddSlider( m_NumWSlider, "Num_W", 100, " %5.0f" );
 
+    m_GenLayout.SetFitWidthFlag( false );
+    m_GenLayout.SetSameLineFlag( true );
+    m_GenLayout.AddButton( m_AdaptTessToggle, "Adaptive" );
+    m_GenLayout.SetFitWidthFlag( true );
+    m_GenLayout.AddSlider( m_AdaptTessTolSlider, "Tol", 0.1, " %7.5f", 0, true );
+    m_GenLayout.ForceNewLine();
+    m_GenLayout.SetSameLineFlag( false );
+
     m_GenLayout.AddYGap();
     m_GenLayout.AddDividerBox( "Mass Properties" );
 
@@ -834,6 +842,17 @@ bool GeomScreen::Update()
 
     m_NumUSlider.Update( geom_ptr->m_TessU.GetID() );
     m_NumWSlider.Update( geom_ptr->m_TessW.GetID() );
+    m_AdaptTessToggle.Update( geom_ptr->m_AdaptTessFlag.GetID() );
+    m_AdaptTessTolSlider.Update( geom_ptr->m_AdaptTessTol.GetID() );
+
+    if ( geom_ptr->m_AdaptTessFlag() )
+    {
+        m_AdaptTessTolSlider.Activate();
+    }
+    else
+    {
+        m_AdaptTessTolSlider.Deactivate();
+    }
 
     //==== Set Browser ====//
     vector< string > set_name_vec = m_ScreenMgr->GetVehiclePtr()->GetSetNameVec();
@@ -200,6 +200,8 @@ public:
     //==== Tessellation ====//
     SliderInput m_NumUSlider;
     SliderInput m_NumWSlider;
+    ToggleButton m_AdaptTessToggle;
+    SliderInput m_AdaptTessTolSlider;
 
     //==== Mass Props ====//
     Input m_DensityInput;
@@ -36,6 +36,7 @@
 #include "ParasiteDragScreen.h"
 #include "ParmDebugScreen.h"
 #include "ParmLinkScreen.h"
+#include "ParmMgr.h"
 #include "ParmScreen.h"
 #include "ProjectionScreen.h"
 #include "PSliceScreen.h"
@@ -65,8 +66,13 @@ ScreenMgr::ScreenMgr( Vehicle* vPtr )
         Init();
     }
     m_UpdateFlag = true;
+    m_UpdateAllFlag = true;
+    m_PartialUpdate = false;
     MessageBase::Register( string( "ScreenMgr" ) );
 
+    // Messages from solver and mesher threads are handled here, in TimerCB.
+    SetQueuedDelivery( true );
+
     Fl::scheme( "GTK+" );
     Fl::add_timeout( UPDATE_TIME, StaticTimerCB, this );
     Fl::add_handler( GlobalHandler );
@@ -93,12 +99,22 @@ ScreenMgr::~ScreenMgr()
 void ScreenMgr::ForceUpdate()
 {
     m_UpdateFlag = false;
+    m_UpdateAllFlag = true;
     UpdateAllScreens();
 }
 
 //==== Timer Callback ====//
 void ScreenMgr::TimerCB()
 {
+    DeliverQueuedMessages();
+
+    // Rebuild Geoms dragged since the last tick, with the latest slider values.
+    if ( m_VehiclePtr )
+    {
+        m_VehiclePtr->FlushDeferredUpdates();
+        m_VehiclePtr->CheckAutoSave();
+    }
+
     if ( m_UpdateFlag )
     {
         if (m_ShowPlotScreenOnce)
@@ -119,6 +135,57 @@ void ScreenMgr::TimerCB()
 void ScreenMgr::SetUpdateFlag( bool flag )
 {
     m_UpdateFlag = flag;
+    if ( flag )
+    {
+        m_UpdateAllFlag = true;
+    }
+}
+
+//==== Note A Changed Container For The Next Refresh ====//
+// Parms owned by a Geom or its XSecs and SubSurfs mark just that Geom.
+// Anything else (Vehicle, analyses, ...) refreshes every screen.
+void ScreenMgr::AddChangedContainer( const string & container_id )
+{
+    m_UpdateFlag = true;
+
+    if ( !m_VehiclePtr )
+    {
+        m_UpdateAllFlag = true;
+        return;
+    }
+
+    ParmContainer* pc = ParmMgr.FindParmContainer( container_id );
+    while ( pc )
+    {
+        if ( m_VehiclePtr->FindGeom( pc->GetID() ) )
+        {
+            m_ChangedGeomSet.insert( pc->GetID() );
+            return;
+        }
+        pc = pc->GetParentContainerPtr();
+    }
+
+    m_UpdateAllFlag = true;
+}
+
+//==== Does The Screen For This Geom Need Refreshing ====//
+// A Geom moves with its ancestors, so their changes count too.
+bool ScreenMgr::IsGeomChanged( Geom* geom_ptr )
+{
+    if ( !m_PartialUpdate || !geom_ptr || !m_VehiclePtr )
+    {
+        return true;
+    }
+
+    while ( geom_ptr )
+    {
+        if ( m_ChangedGeomSet.find( geom_ptr->GetID() ) != m_ChangedGeomSet.end() )
+        {
+            return true;
+        }
+        geom_ptr = m_VehiclePtr->FindGeom( geom_ptr->GetParentID() );
+    }
+    return false;
 }
 
 //==== Message Callbacks ====//
@@ -126,7 +193,14 @@ void ScreenMgr::MessageCallback( const MessageBase* from, const MessageData& dat
 {
     if ( data.m_String == string( "UpdateAllScreens" ) )
     {
-        SetUpdateFlag( true );
+        if ( data.m_StringVec.empty() )
+        {
+            SetUpdateFlag( true );
+        }
+        for ( int i = 0 ; i < ( int )data.m_StringVec.size() ; i++ )
+        {
+            AddChangedContainer( data.m_StringVec[i] );
+        }
     }
     else if ( data.m_String == string( "VSPAEROSolverMessage" ) )
     {
@@ -286,6 +360,8 @@ void ScreenMgr::UpdateAllScreens()
 //int del_tics = timeGetTime() - last_tics;
 //last_tics = timeGetTime();
 //printf("Update Screens %d\n",  del_tics );
+    m_PartialUpdate = !m_UpdateAllFlag;
+
     for ( int i = 0 ; i < ( int )m_ScreenVec.size() ; i++ )
     {
         //===== Force Update Of ManageGeomScreen ====//
@@ -294,6 +370,10 @@ void ScreenMgr::UpdateAllScreens()
             m_ScreenVec[i]->Update();
         }
     }
+
+    m_PartialUpdate = false;
+    m_UpdateAllFlag = false;
+    m_ChangedGeomSet.clear();
 }
 
 //==== Show Screen ====//
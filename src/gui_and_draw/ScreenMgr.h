@@ -20,6 +20,7 @@
 
 #include <vector>
 #include <string>
+#include <set>
 
 
 //==== ScreenMgr ====//
@@ -91,6 +92,7 @@ public:
     virtual Geom* GetCurrGeom();
     virtual void SetUpdateFlag( bool flag );
     virtual void ForceUpdate();
+    virtual bool IsGeomChanged( Geom* geom_ptr );
     virtual void Alert( const char * message );
 
     SelectFileScreen* GetSelectFileScreen()
@@ -138,6 +140,13 @@ protected:
     bool m_UpdateFlag;
     virtual void UpdateAllScreens();
 
+    virtual void AddChangedContainer( const string & container_id );
+
+    //==== Geoms Changed Since The Last Refresh, Unless Everything Must Refresh ====//
+    bool m_UpdateAllFlag;
+    bool m_PartialUpdate;
+    set< string > m_ChangedGeomSet;
+
     Vehicle* m_VehiclePtr;
     vector< VspScreen* > m_ScreenVec;
 
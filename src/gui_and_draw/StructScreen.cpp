@@ -775,6 +775,12 @@ StructScreen::StructScreen( ScreenMgr* mgr ) : TabScreen( mgr, 430, 650, "FEA Me
     m_OutputTabLayout.AddButton( m_SelectNkeyFile, "..." );
     m_OutputTabLayout.ForceNewLine();
 
+    m_OutputTabLayout.SetSameLineFlag( false );
+    m_OutputTabLayout.SetFitWidthFlag( true );
+    m_OutputTabLayout.AddButton( m_NastLargeField, "Large Field Nastran GRID Cards" );
+    m_OutputTabLayout.SetFitWidthFlag( false );
+    m_OutputTabLayout.SetSameLineFlag( true );
+
     m_OutputTabLayout.AddYGap();
 
     m_OutputTabLayout.SetButtonWidth( 75 );
@@ -2085,6 +2091,7 @@ bool StructScreen::Update()
             m_MassFile.Update( curr_struct->GetStructSettingsPtr()->GetExportFileFlag( vsp::FEA_MASS_FILE_NAME )->GetID() );
             m_NastFile.Update( curr_struct->GetStructSettingsPtr()->GetExportFileFlag( vsp::FEA_NASTRAN_FILE_NAME )->GetID() );
             m_NkeyFile.Update( curr_struct->GetStructSettingsPtr()->GetExportFileFlag( vsp::FEA_NKEY_FILE_NAME )->GetID() );
+            m_NastLargeField.Update( curr_struct->GetStructSettingsPtr()->m_NASTRANLargeFieldFlag.GetID() );
             m_CalcFile.Update( curr_struct->GetStructSettingsPtr()->GetExportFileFlag( vsp::FEA_CALCULIX_FILE_NAME )->GetID() );
             m_StlFile.Update( curr_struct->GetStructSettingsPtr()->GetExportFileFlag( vsp::FEA_STL_FILE_NAME )->GetID() );
             m_GmshFile.Update( curr_struct->GetStructSettingsPtr()->GetExportFileFlag( vsp::FEA_GMSH_FILE_NAME )->GetID() );
@@ -2094,12 +2101,14 @@ bool StructScreen::Update()
                 m_NkeyFile.Deactivate();
                 m_NkeyOutput.Deactivate();
                 m_SelectNkeyFile.Deactivate();
+                m_NastLargeField.Deactivate();
             }
             else
             {
                 m_NkeyFile.Activate();
                 m_NkeyOutput.Activate();
                 m_SelectNkeyFile.Activate();
+                m_NastLargeField.Activate();
             }
 
             string srfname = curr_struct->GetStructSettingsPtr()->GetExportFileName( vsp::FEA_SRF_FILE_NAME );
@@ -265,6 +265,7 @@ private:
     ToggleButton m_MassFile;
     ToggleButton m_NastFile;
     ToggleButton m_NkeyFile;
+    ToggleButton m_NastLargeField;
     ToggleButton m_CalcFile;
 
     TriggerButton m_SelectStlFile;
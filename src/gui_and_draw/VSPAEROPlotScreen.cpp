@@ -646,6 +646,8 @@ void VSPAEROPlotScreen::SetDefaultView()
 
 bool VSPAEROPlotScreen::Update()
 {
+    PruneSeriesCache();
+
     string resultName = "VSPAERO_Stab";
     Results* res = ResultsMgr.FindResults( resultName, 0 );
     bool stabFlag = false;
@@ -683,6 +685,7 @@ bool VSPAEROPlotScreen::Update()
         m_UnsteadyYDataBrowser->clear();
         m_UnsteadyPlotCanvas->clear();
         m_UnsteadyLegendGroup->clear();
+        m_UnsteadyPlotKey.clear();
     }
     else // P, Q, or R unsteady analysis
     {
@@ -691,6 +694,7 @@ bool VSPAEROPlotScreen::Update()
         m_ConvergenceYDataBrowser->clear();
         m_ConvergencePlotCanvas->clear();
         m_ConvergenceLegendGroup->clear();
+        m_ConvergencePlotKey.clear();
 
         m_UnsteadyTab->activate();
 
@@ -749,6 +753,7 @@ bool VSPAEROPlotScreen::Update()
         m_LoadDistYDataBrowser->clear();
         m_LoadDistPlotCanvas->clear();
         m_LoadDistLegendGroup->clear();
+        m_LoadDistPlotKey.clear();
     }
 
     // Update sweep condition plot canvas
@@ -1254,6 +1259,12 @@ void VSPAEROPlotScreen::GuiDeviceCallBack( GuiDevice* device )
 
 void VSPAEROPlotScreen::UpdateConvergenceFlowConditionBrowser()
 {
+    // Cases read while the solver is still running only add rows
+    if ( AppendFlowConditionRows( m_ConvergenceFlowConditionBrowser, m_ConvergenceFlowConditionResultIDs, m_ConvergenceFlowConditionSelectedResultIDs, "VSPAERO_History" ) )
+    {
+        return;
+    }
+
     // keeps track of the previously selected rows (browser uses 1-based indexing)
     vector<bool> wasSelected;
     for ( unsigned int iCase = 1; iCase <= m_ConvergenceFlowConditionBrowser->size(); iCase++ )
@@ -1264,6 +1275,7 @@ void VSPAEROPlotScreen::UpdateConvergenceFlowConditionBrowser()
     int scrollPos = m_ConvergenceFlowConditionBrowser->position();
     m_ConvergenceFlowConditionBrowser->clear();
     m_ConvergenceFlowConditionSelectedResultIDs.clear();
+    m_ConvergenceFlowConditionResultIDs.clear();
 
     string resultName = "VSPAERO_History";
 
@@ -1277,6 +1289,7 @@ void VSPAEROPlotScreen::UpdateConvergenceFlowConditionBrowser()
             char strbuf[1024];
             ConstructFlowConditionString( strbuf, res, false );
             m_ConvergenceFlowConditionBrowser->add( strbuf );
+            m_ConvergenceFlowConditionResultIDs.push_back( res->GetID() );
             if( m_SelectDefaultData )   //select ALL flow conditions
             {
                 m_ConvergenceFlowConditionSelectedResultIDs.push_back( res->GetID() );
@@ -1424,6 +1437,12 @@ void VSPAEROPlotScreen::UpdateLoadDistSelectionBrowser()
 
 void VSPAEROPlotScreen::UpdateSweepFlowConditionBrowser()
 {
+    // Cases read while the solver is still running only add rows
+    if ( AppendFlowConditionRows( m_SweepFlowConditionBrowser, m_SweepFlowConditionResultIDs, m_SweepFlowConditionSelectedResultIDs, "VSPAERO_History" ) )
+    {
+        return;
+    }
+
     // keeps track of the previously selected rows (browser uses 1-based indexing)
     vector<bool> wasSelected;
     for ( unsigned int iCase = 1; iCase <= m_SweepFlowConditionBrowser->size(); iCase++ )
@@ -1434,6 +1453,7 @@ void VSPAEROPlotScreen::UpdateSweepFlowConditionBrowser()
     int scrollPos = m_SweepFlowConditionBrowser->position();
     m_SweepFlowConditionBrowser->clear();
     m_SweepFlowConditionSelectedResultIDs.clear();
+    m_SweepFlowConditionResultIDs.clear();
 
     string resultName = "VSPAERO_History";
 
@@ -1446,6 +1466,7 @@ void VSPAEROPlotScreen::UpdateSweepFlowConditionBrowser()
             char strbuf[1024];
             ConstructFlowConditionString( strbuf, res, false );
             m_SweepFlowConditionBrowser->add( strbuf );
+            m_SweepFlowConditionResultIDs.push_back( res->GetID() );
             if( m_SelectDefaultData )   //select ALL flow conditions
             {
                 m_SweepFlowConditionSelectedResultIDs.push_back( res->GetID() );
@@ -1656,6 +1677,71 @@ void VSPAEROPlotScreen::UpdateUnsteadySelectionBrowser()
     m_UnsteadySelectBrowser->position( scrollPos );
 }
 
+// Adds rows for results not yet in a flow condition browser.  Returns false,
+// leaving the browser alone, if the existing rows no longer match the results.
+bool VSPAEROPlotScreen::AppendFlowConditionRows( Fl_Browser * browser, vector< string > & row_ids, vector< string > & selected_ids, const string & result_name )
+{
+    int numCases = ResultsMgr.GetNumResults( result_name );
+    int numRows = row_ids.size();
+
+    if ( numRows == 0 || numRows > numCases || browser->size() != numRows )
+    {
+        return false;
+    }
+
+    for ( int iCase = 0; iCase < numRows; iCase++ )
+    {
+        Results* res = ResultsMgr.FindResults( result_name, iCase );
+        if ( !res || res->GetID() != row_ids[iCase] )
+        {
+            return false;
+        }
+    }
+
+    // Selection follows the browser, new cases join it if every case so far
+    // is selected so a polar grows as the sweep runs
+    bool allSelected = true;
+    selected_ids.clear();
+    for ( int iCase = 0; iCase < numRows; iCase++ )
+    {
+        if ( m_SelectDefaultData )
+        {
+            browser->select( iCase + 1 ); //account for browser using 1-based indexing
+        }
+
+        if ( browser->selected( iCase + 1 ) )
+        {
+            selected_ids.push_back( row_ids[iCase] );
+        }
+        else
+        {
+            allSelected = false;
+        }
+    }
+
+    for ( int iCase = numRows; iCase < numCases; iCase++ )
+    {
+        Results* res = ResultsMgr.FindResults( result_name, iCase );
+        if ( !res )
+        {
+            return false;
+        }
+
+        char strbuf[1024];
+        ConstructFlowConditionString( strbuf, res, false );
+        browser->add( strbuf );
+        row_ids.push_back( res->GetID() );
+
+        if ( allSelected )
+        {
+            selected_ids.push_back( res->GetID() );
+            browser->select( iCase + 1 ); //account for browser using 1-based indexing
+        }
+    }
+
+    return true;
+}
+
 void VSPAEROPlotScreen::ConstructFlowConditionString( char * strbuf, Results * res, bool includeResultId )
 {
     if( strbuf && res )
@@ -2163,14 +2249,6 @@ void VSPAEROPlotScreen::UpdateUnsteadyYDataBrowser()
 
 void VSPAEROPlotScreen::RedrawConvergencePlot()
 {
-    Ca_Canvas::current( m_ConvergencePlotCanvas );
-    m_ConvergencePlotCanvas->clear();
-
-    m_ConvergenceLegendGroup->clear();
-    m_ConvergenceLegendLayout.SetGroup( m_ConvergenceLegendGroup );
-    m_ConvergenceLegendLayout.InitWidthHeightVals();
-    m_ConvergenceLegendLayout.SetButtonWidth( (int)(m_ConvergenceLegendLayout.GetW() * m_PercentLegendColor) );
-
     // Get selected y data names
     vector <string> yDataSetNames;
     for ( int i = 1 ; i <= m_ConvergenceYDataBrowser->size() ; i++ )
@@ -2181,6 +2259,29 @@ void VSPAEROPlotScreen::RedrawConvergencePlot()
         }
     }
 
+    // Nothing to do unless the selection, options or canvas size changed
+    vector <int> flagVec;
+    flagVec.push_back( m_ConvergencePlotCanvas->w() );
+    flagVec.push_back( m_ConvergenceYDataResidualToggle.GetFlButton()->value() );
+    flagVec.push_back( VSPAEROMgr.m_ConvergenceXMinIsManual() );
+    flagVec.push_back( VSPAEROMgr.m_ConvergenceXMaxIsManual() );
+    flagVec.push_back( VSPAEROMgr.m_ConvergenceYMinIsManual() );
+    flagVec.push_back( VSPAEROMgr.m_ConvergenceYMaxIsManual() );
+    string plotKey = MakePlotKey( m_ConvergenceFlowConditionSelectedResultIDs, yDataSetNames, flagVec );
+    if ( plotKey == m_ConvergencePlotKey )
+    {
+        return;
+    }
+    m_ConvergencePlotKey = plotKey;
+
+    Ca_Canvas::current( m_ConvergencePlotCanvas );
+    m_ConvergencePlotCanvas->clear();
+
+    m_ConvergenceLegendGroup->clear();
+    m_ConvergenceLegendLayout.SetGroup( m_ConvergenceLegendGroup );
+    m_ConvergenceLegendLayout.InitWidthHeightVals();
+    m_ConvergenceLegendLayout.SetButtonWidth( (int)(m_ConvergenceLegendLayout.GetW() * m_PercentLegendColor) );
+
     m_ConvergenceNLines = m_ConvergenceFlowConditionSelectedResultIDs.size() * yDataSetNames.size();
     m_ConvergenceiPlot = 0;
 
@@ -2201,14 +2302,6 @@ void VSPAEROPlotScreen::RedrawConvergencePlot()
 
 void VSPAEROPlotScreen::RedrawLoadDistPlot()
 {
-    Ca_Canvas::current( m_LoadDistPlotCanvas );
-    m_LoadDistPlotCanvas->clear();
-
-    m_LoadDistLegendGroup->clear();
-    m_LoadDistLegendLayout.SetGroup( m_LoadDistLegendGroup );
-    m_LoadDistLegendLayout.InitWidthHeightVals();
-    m_LoadDistLegendLayout.SetButtonWidth( (int)(m_LoadDistLegendLayout.GetW() * m_PercentLegendColor) );
-
     // Get selected y data names
     vector <string> yDataSetNames;
     for ( int i = 1 ; i <= m_LoadDistYDataBrowser->size() ; i++ )
@@ -2219,6 +2312,44 @@ void VSPAEROPlotScreen::RedrawLoadDistPlot()
         }
     }
 
+    // Collect the results to plot
+    vector <string> plotIDs;
+    if ( VSPAEROMgr.m_LoadDistSelectType.Get() == VSPAEROMgrSingleton::LOAD_SELECT_TYPE )
+    {
+        plotIDs = m_LoadDistFlowConditionSelectedResultIDs;
+    }
+    else if ( VSPAEROMgr.m_LoadDistSelectType.Get() == VSPAEROMgrSingleton::BLADE_SELECT_TYPE )
+    {
+        for ( unsigned int iCase = 0; iCase < m_LoadSelectedBladeVec.size(); iCase++ )
+        {
+            plotIDs.push_back( ResultsMgr.FindResultsID( "VSPAERO_Blade_Avg", m_LoadSelectedBladeVec[iCase] ) );
+        }
+    }
+
+    // Nothing to do unless the selection, options or canvas size changed
+    vector <int> flagVec;
+    flagVec.push_back( m_LoadDistPlotCanvas->w() );
+    flagVec.push_back( VSPAEROMgr.m_LoadDistSelectType.Get() );
+    flagVec.push_back( m_LoadDistFlowConditionSelectedResultIDs.size() );
+    flagVec.push_back( VSPAEROMgr.m_LoadDistXMinIsManual() );
+    flagVec.push_back( VSPAEROMgr.m_LoadDistXMaxIsManual() );
+    flagVec.push_back( VSPAEROMgr.m_LoadDistYMinIsManual() );
+    flagVec.push_back( VSPAEROMgr.m_LoadDistYMaxIsManual() );
+    string plotKey = MakePlotKey( plotIDs, yDataSetNames, flagVec );
+    if ( plotKey == m_LoadDistPlotKey )
+    {
+        return;
+    }
+    m_LoadDistPlotKey = plotKey;
+
+    Ca_Canvas::current( m_LoadDistPlotCanvas );
+    m_LoadDistPlotCanvas->clear();
+
+    m_LoadDistLegendGroup->clear();
+    m_LoadDistLegendLayout.SetGroup( m_LoadDistLegendGroup );
+    m_LoadDistLegendLayout.InitWidthHeightVals();
+    m_LoadDistLegendLayout.SetButtonWidth( (int)(m_LoadDistLegendLayout.GetW() * m_PercentLegendColor) );
+
     m_LoadDistNLines = yDataSetNames.size() * m_LoadDistFlowConditionSelectedResultIDs.size();
     if ( m_LoadSelectedBladeVec.size() > 0 ) // Since "Load" is not included in the vector
     {
@@ -2232,30 +2363,16 @@ void VSPAEROPlotScreen::RedrawLoadDistPlot()
     {
         bool expandOnly = false;
 
-        if ( VSPAEROMgr.m_LoadDistSelectType.Get() == VSPAEROMgrSingleton::LOAD_SELECT_TYPE )
+        for ( unsigned int iCase = 0; iCase < plotIDs.size(); iCase++ )
         {
-            for ( unsigned int iCase = 0; iCase < m_LoadDistFlowConditionSelectedResultIDs.size(); iCase++ )
-            {
-                PlotLoadDistribution( m_LoadDistFlowConditionSelectedResultIDs[iCase], yDataSetNames, expandOnly, iCase );
-                expandOnly = true;
-            }
-        }
-        else if ( VSPAEROMgr.m_LoadDistSelectType.Get() == VSPAEROMgrSingleton::BLADE_SELECT_TYPE )
-        {
-            for ( unsigned int iCase = 0; iCase < m_LoadSelectedBladeVec.size(); iCase++ )
-            {
-                PlotLoadDistribution( ResultsMgr.FindResultsID( "VSPAERO_Blade_Avg", m_LoadSelectedBladeVec[iCase] ), yDataSetNames, expandOnly, iCase );
-                expandOnly = true;
-            }
+            PlotLoadDistribution( plotIDs[iCase], yDataSetNames, expandOnly, iCase );
+            expandOnly = true;
         }
     }
 }
 
 void VSPAEROPlotScreen::RedrawSweepPlot()
 {
-    Ca_Canvas::current( m_SweepPlotCanvas );
-    m_SweepPlotCanvas->clear();
-
     // Get selected dataset names
     vector <string> xDataSetNames;
     for ( int i = 1 ; i <= m_SweepXDataBrowser->size() ; i++ )
@@ -2274,6 +2391,25 @@ void VSPAEROPlotScreen::RedrawSweepPlot()
         }
     }
 
+    // Nothing to do unless the selection or options changed
+    vector <string> dataSetNames = xDataSetNames;
+    dataSetNames.push_back( "|" );
+    dataSetNames.insert( dataSetNames.end(), yDataSetNames.begin(), yDataSetNames.end() );
+    vector <int> flagVec;
+    flagVec.push_back( VSPAEROMgr.m_SweepXMinIsManual() );
+    flagVec.push_back( VSPAEROMgr.m_SweepXMaxIsManual() );
+    flagVec.push_back( VSPAEROMgr.m_SweepYMinIsManual() );
+    flagVec.push_back( VSPAEROMgr.m_SweepYMaxIsManual() );
+    string plotKey = MakePlotKey( m_SweepFlowConditionSelectedResultIDs, dataSetNames, flagVec );
+    if ( plotKey == m_SweepPlotKey )
+    {
+        return;
+    }
+    m_SweepPlotKey = plotKey;
+
+    Ca_Canvas::current( m_SweepPlotCanvas );
+    m_SweepPlotCanvas->clear();
+
     int iplot = 0; // Serialized counter for legend colors/symbols
     int nlines = xDataSetNames.size() * yDataSetNames.size();
 
@@ -2504,14 +2640,6 @@ void VSPAEROPlotScreen::RedrawCpSlicePlot()
 
 void VSPAEROPlotScreen::RedrawUnsteadyPlot()
 {
-    Ca_Canvas::current( m_UnsteadyPlotCanvas );
-    m_UnsteadyPlotCanvas->clear();
-
-    m_UnsteadyLegendGroup->clear();
-    m_UnsteadyLegendLayout.SetGroup( m_UnsteadyLegendGroup );
-    m_UnsteadyLegendLayout.InitWidthHeightVals();
-    m_UnsteadyLegendLayout.SetButtonWidth( (int)( m_UnsteadyLegendLayout.GetW() * m_PercentLegendColor ) );
-
     // Get selected y data names
     vector <string> yDataSetNames;
     for ( int i = 1; i <= m_UnsteadyYDataBrowser->size(); i++ )
@@ -2522,15 +2650,50 @@ void VSPAEROPlotScreen::RedrawUnsteadyPlot()
         }
     }
 
-    // Get selected rotor/groups
-    vector <string> selectSetNames;
-    for ( int i = 1; i <= m_UnsteadySelectBrowser->size(); i++ )
+    // Collect the results to plot
+    vector <string> plotIDs;
+    if ( VSPAEROMgr.m_UnsteadyGroupSelectType.Get() == VSPAEROMgrSingleton::GROUP_SELECT_TYPE )
     {
-        if ( m_UnsteadySelectBrowser->selected( i ) )
+        for ( unsigned int iCase = 0; iCase < m_UnsteadySelectedTypeVec.size(); iCase++ )
         {
-            selectSetNames.push_back( m_UnsteadySelectBrowser->text( i ) );
+            plotIDs.push_back( ResultsMgr.FindResultsID( "VSPAERO_Group", m_UnsteadySelectedTypeVec[iCase] ) );
         }
     }
+    else if ( VSPAEROMgr.m_UnsteadyGroupSelectType.Get() == VSPAEROMgrSingleton::ROTOR_SELECT_TYPE )
+    {
+        for ( unsigned int iCase = 0; iCase < m_UnsteadySelectedTypeVec.size(); iCase++ )
+        {
+            plotIDs.push_back( ResultsMgr.FindResultsID( "VSPAERO_Rotor", m_UnsteadySelectedTypeVec[iCase] ) );
+        }
+    }
+    else if ( VSPAEROMgr.m_UnsteadyGroupSelectType.Get() == VSPAEROMgrSingleton::HISTORY_SELECT_TYPE )
+    {
+        plotIDs = m_UnsteadyFlowConditionSelectedResultIDs;
+    }
+
+    // Nothing to do unless the selection, options or canvas size changed
+    vector <int> flagVec;
+    flagVec.push_back( m_UnsteadyPlotCanvas->w() );
+    flagVec.push_back( VSPAEROMgr.m_UnsteadyGroupSelectType.Get() );
+    flagVec.push_back( m_UnsteadyFlowConditionSelectedResultIDs.size() );
+    flagVec.push_back( VSPAEROMgr.m_UnsteadyXMinIsManual() );
+    flagVec.push_back( VSPAEROMgr.m_UnsteadyXMaxIsManual() );
+    flagVec.push_back( VSPAEROMgr.m_UnsteadyYMinIsManual() );
+    flagVec.push_back( VSPAEROMgr.m_UnsteadyYMaxIsManual() );
+    string plotKey = MakePlotKey( plotIDs, yDataSetNames, flagVec );
+    if ( plotKey == m_UnsteadyPlotKey )
+    {
+        return;
+    }
+    m_UnsteadyPlotKey = plotKey;
+
+    Ca_Canvas::current( m_UnsteadyPlotCanvas );
+    m_UnsteadyPlotCanvas->clear();
+
+    m_UnsteadyLegendGroup->clear();
+    m_UnsteadyLegendLayout.SetGroup( m_UnsteadyLegendGroup );
+    m_UnsteadyLegendLayout.InitWidthHeightVals();
+    m_UnsteadyLegendLayout.SetButtonWidth( (int)( m_UnsteadyLegendLayout.GetW() * m_PercentLegendColor ) );
 
     m_UnsteadyNLines = m_UnsteadyFlowConditionSelectedResultIDs.size() * yDataSetNames.size();
     if ( m_UnsteadySelectedTypeVec.size() > 0 ) // Since "History" is not included in the vector
@@ -2545,29 +2708,10 @@ void VSPAEROPlotScreen::RedrawUnsteadyPlot()
     {
         bool expandOnly = false;
 
-        if ( VSPAEROMgr.m_UnsteadyGroupSelectType.Get() == VSPAEROMgrSingleton::GROUP_SELECT_TYPE )
+        for ( unsigned int iCase = 0; iCase < plotIDs.size(); iCase++ )
         {
-            for ( unsigned int iCase = 0; iCase < m_UnsteadySelectedTypeVec.size(); iCase++ )
-            {
-                PlotUnsteady( ResultsMgr.FindResultsID( "VSPAERO_Group", m_UnsteadySelectedTypeVec[iCase] ), yDataSetNames, expandOnly, iCase );
-                expandOnly = true;
-            }
-        }
-        else if ( VSPAEROMgr.m_UnsteadyGroupSelectType.Get() == VSPAEROMgrSingleton::ROTOR_SELECT_TYPE )
-        {
-            for ( unsigned int iCase = 0; iCase < m_UnsteadySelectedTypeVec.size(); iCase++ )
-            {
-                PlotUnsteady( ResultsMgr.FindResultsID( "VSPAERO_Rotor", m_UnsteadySelectedTypeVec[iCase] ), yDataSetNames, expandOnly, iCase );
-                expandOnly = true;
-            }
-        }
-        else if ( VSPAEROMgr.m_UnsteadyGroupSelectType.Get() == VSPAEROMgrSingleton::HISTORY_SELECT_TYPE )
-        {
-            for ( unsigned int iCase = 0; iCase < m_UnsteadyFlowConditionSelectedResultIDs.size(); iCase++ )
-            {
-                PlotUnsteady( m_UnsteadyFlowConditionSelectedResultIDs[iCase], yDataSetNames, expandOnly, iCase );
-                expandOnly = true;
-            }
+            PlotUnsteady( plotIDs[iCase], yDataSetNames, expandOnly, iCase );
+            expandOnly = true;
         }
     }
 }
@@ -2602,66 +2746,41 @@ void VSPAEROPlotScreen::PlotConvergence( string resultID, vector <string> yDataS
 
         //  Get the X Data
         vector <double> xDoubleData_orig;
-        NameValData* xResultDataPtr;
-        xResultDataPtr = res->FindPtr( "WakeIter" );
-        if ( (xResultDataPtr != NULL) )
+        if ( res->FindPtr( "WakeIter" ) != NULL )
         {
-            vector <int> tIntData = xResultDataPtr->GetIntData();
-            copy( tIntData.begin(), tIntData.end(), back_inserter( xDoubleData_orig ) );
+            xDoubleData_orig = GetCachedSeries( res, "WakeIter" );
         }
                 
         // Get the Y-Data
-        NameValData* yResultDataPtr;
         for ( int iDataSet = 0; iDataSet < ( int )yDataSetNames.size(); iDataSet++ )
         {
-            yResultDataPtr = res->FindPtr( yDataSetNames[iDataSet] );
-            if (  yResultDataPtr != NULL  )
+            if ( res->FindPtr( yDataSetNames[iDataSet] ) != NULL )
             {
                 vector <double> xDoubleData = xDoubleData_orig;
-                vector <double> yDoubleData;
-                if ( yResultDataPtr->GetType() == vsp::INT_DATA )
-                {
-                    vector <int> tIntData = yResultDataPtr->GetIntData();
-                    copy( tIntData.begin(), tIntData.end(), back_inserter( yDoubleData ) );
-                }
-                else
-                {
-                    yDoubleData = yResultDataPtr->GetDoubleData();
-                }
+                vector <double> yDoubleData = GetCachedSeries( res, yDataSetNames[iDataSet] );
 
                 if (  (xDoubleData.size() == yDoubleData.size()) && (xDoubleData.size()>0) )
                 {
                     //normalize the iteration data w.r.t. the final value
                     if ( m_ConvergenceYDataResidualToggle.GetFlButton()->value() == 1 )
                     {
-                        double diffY;
-                        vector <double> tempY = yDoubleData;
-                        unsigned int j = 1;
-                        unsigned int jMax = ( unsigned int )tempY.size();
-                        while( j < jMax )
+                        // No residual for 1st data point, and points where the value did not
+                        // change are dropped, this eliminates "jumping" on plot screen
+                        vector <double> xResid;
+                        vector <double> yResid;
+                        double yLast = yDoubleData[0];
+                        for ( unsigned int j = 1; j < yDoubleData.size(); j++ )
                         {
-                            diffY = tempY[j] - tempY[j - 1];
+                            double diffY = yDoubleData[j] - yLast;
                             if ( diffY != 0 ) // inf protection on log10()
                             {
-                                yDoubleData[j] = log10( std::abs( diffY ) );
-                                j++;
-                            }
-                            else
-                            {
-                                //value did not change, eliminate the data point, this eliminates "jumping" on plot screen
-                                xDoubleData.erase( xDoubleData.begin() + j );
-                                yDoubleData.erase( yDoubleData.begin() + j );
-                                tempY.erase( tempY.begin() + j );
-                                jMax--;
+                                xResid.push_back( xDoubleData[j] );
+                                yResid.push_back( log10( std::abs( diffY ) ) );
+                                yLast = yDoubleData[j];
                             }
                         }
-
-                        // No residual for 1st data point, so remove it
-                        if ( xDoubleData.size() > 0 )
-                        {
-                            xDoubleData.erase( xDoubleData.begin() );
-                            yDoubleData.erase( yDoubleData.begin() );
-                        }
+                        xDoubleData.swap( xResid );
+                        yDoubleData.swap( yResid );
                     }
 
                     // check again if there are still points to plot
@@ -2669,8 +2788,10 @@ void VSPAEROPlotScreen::PlotConvergence( string resultID, vector <string> yDataS
                     {
                         Fl_Color c = ColorWheel( m_ConvergenceiPlot, m_ConvergenceNLines );
 
-                        //add the normalized data to the plot
-                        AddPointLine( xDoubleData, yDoubleData, 2, c, 4, StyleWheel( m_ConvergenceiPlot ) );
+                        //add the normalized data to the plot, at most a few points per pixel column
+                        vector <double> xPlotData, yPlotData;
+                        DecimateSeries( xDoubleData, yDoubleData, m_ConvergencePlotCanvas->w(), xPlotData, yPlotData );
+                        AddPointLine( xPlotData, yPlotData, 2, c, 4, StyleWheel( m_ConvergenceiPlot ) );
 
                         char strbuf[100];
                         ConstructFlowConditionString( strbuf, res, false );
@@ -2765,8 +2886,7 @@ void VSPAEROPlotScreen::PlotLoadDistribution( string resultID, vector <string> y
 
             if ( ( xResultDataPtr != NULL ) )
             {
-                vector <int> tIntData = xResultDataPtr->GetIntData();
-                copy( tIntData.begin(), tIntData.end(), back_inserter( xDoubleData_orig ) );
+                xDoubleData_orig = GetCachedSeries( res, "Station" );
             }
 
             NameValData* name_nvd = res->FindPtr( "Group_Name" );
@@ -2798,18 +2918,21 @@ void VSPAEROPlotScreen::PlotLoadDistribution( string resultID, vector <string> y
                     vector <int> wingIdIntDataUnique;
                     std::unique_copy( wingIdIntDataRaw.begin(), wingIdIntDataRaw.end(), std::back_inserter( wingIdIntDataUnique ) );
 
+                    const vector <double> & xSeries = GetCachedSeries( res, "Yavg" );
+                    const vector <double> & ySeries = GetCachedSeries( res, yDataSetNames[iDataSet] );
+
                     // Collect data for each wing and plot individual line for each wing (assumes unsorted list)
                     for ( int iWing = 0; iWing < wingIdIntDataUnique.size(); iWing++ )
                     {
                         //collect the data for each wing checking each point
                         vector <double> xDoubleData;
                         vector <double> yDoubleData;
-                        for ( unsigned int iPt = 0; iPt < wingIdIntDataRaw.size(); iPt++ )
+                        for ( unsigned int iPt = 0; iPt < wingIdIntDataRaw.size() && iPt < xSeries.size() && iPt < ySeries.size(); iPt++ )
                         {
                             if ( wingIdIntDataRaw[iPt] == wingIdIntDataUnique[iWing] )
                             {
-                                xDoubleData.push_back( xResultDataPtr->GetDouble( iPt ) );
-                                yDoubleData.push_back( yResultDataPtr->GetDouble( iPt ) );
+                                xDoubleData.push_back( xSeries[iPt] );
+                                yDoubleData.push_back( ySeries[iPt] );
                             }
                         }
 
@@ -2830,8 +2953,10 @@ void VSPAEROPlotScreen::PlotLoadDistribution( string resultID, vector <string> y
                             yDoubleData_sorted[iPt] = yDoubleData[Indx[iPt]];
                         }
 
-                        //add the data to the plot
-                        AddPointLine( xDoubleData_sorted, yDoubleData_sorted, 2, c, 4, StyleWheel( m_LoadDistiPlot ) );
+                        //add the data to the plot, at most a few points per pixel column
+                        vector <double> xPlotData, yPlotData;
+                        DecimateSeries( xDoubleData_sorted, yDoubleData_sorted, m_LoadDistPlotCanvas->w(), xPlotData, yPlotData );
+                        AddPointLine( xPlotData, yPlotData, 2, c, 4, StyleWheel( m_LoadDistiPlot ) );
 
                         //Handle axis limits
                         UpdateAxisLimits( m_LoadDistPlotCanvas, xDoubleData_sorted, yDoubleData_sorted, expandOnly );
@@ -2844,22 +2969,15 @@ void VSPAEROPlotScreen::PlotLoadDistribution( string resultID, vector <string> y
                 }
                 else if ( VSPAEROMgr.m_LoadDistSelectType.Get() == VSPAEROMgrSingleton::BLADE_SELECT_TYPE )
                 {
-                    vector <double> yDoubleData;
-                    if ( yResultDataPtr->GetType() == vsp::INT_DATA )
-                    {
-                        vector <int> tIntData = yResultDataPtr->GetIntData();
-                        copy( tIntData.begin(), tIntData.end(), back_inserter( yDoubleData ) );
-                    }
-                    else
-                    {
-                        yDoubleData = yResultDataPtr->GetDoubleData();
-                    }
+                    const vector <double> & yDoubleData = GetCachedSeries( res, yDataSetNames[iDataSet] );
 
                     // check again if there are still points to plot
                     if ( ( xDoubleData_orig.size() == yDoubleData.size() ) && ( xDoubleData_orig.size() > 0 ) )
                     {
-                        //add the normalized data to the plot
-                        AddPointLine( xDoubleData_orig, yDoubleData, 2, c, 4, StyleWheel( m_LoadDistiPlot ) );
+                        //add the normalized data to the plot, at most a few points per pixel column
+                        vector <double> xPlotData, yPlotData;
+                        DecimateSeries( xDoubleData_orig, yDoubleData, m_LoadDistPlotCanvas->w(), xPlotData, yPlotData );
+                        AddPointLine( xPlotData, yPlotData, 2, c, 4, StyleWheel( m_LoadDistiPlot ) );
 
                         legendstr = group_name;
 
@@ -2915,13 +3033,9 @@ void VSPAEROPlotScreen::PlotUnsteady( string resultID, vector <string> yDataSetN
     {
         //  Get the X Data
         vector <double> xDoubleData_orig;
-        NameValData* xResultDataPtr;
-        xResultDataPtr = res->FindPtr( "Time" );
-
-        if ( ( xResultDataPtr != NULL ) )
+        if ( res->FindPtr( "Time" ) != NULL )
         {
-            vector <double> tDoubledata = xResultDataPtr->GetDoubleData();
-            copy( tDoubledata.begin(), tDoubledata.end(), back_inserter( xDoubleData_orig ) );
+            xDoubleData_orig = GetCachedSeries( res, "Time" );
         }
 
         string group_name;
@@ -2944,23 +3058,12 @@ void VSPAEROPlotScreen::PlotUnsteady( string resultID, vector <string> yDataSetN
         }
 
         // Get the Y-Data
-        NameValData* yResultDataPtr;
         for ( int iDataSet = 0; iDataSet < (int)yDataSetNames.size(); iDataSet++ )
         {
-            yResultDataPtr = res->FindPtr( yDataSetNames[iDataSet] );
-            if ( yResultDataPtr != NULL )
+            if ( res->FindPtr( yDataSetNames[iDataSet] ) != NULL )
             {
-                vector <double> xDoubleData = xDoubleData_orig;
-                vector <double> yDoubleData;
-                if ( yResultDataPtr->GetType() == vsp::INT_DATA )
-                {
-                    vector <int> tIntData = yResultDataPtr->GetIntData();
-                    copy( tIntData.begin(), tIntData.end(), back_inserter( yDoubleData ) );
-                }
-                else
-                {
-                    yDoubleData = yResultDataPtr->GetDoubleData();
-                }
+                const vector <double> & xDoubleData = xDoubleData_orig;
+                const vector <double> & yDoubleData = GetCachedSeries( res, yDataSetNames[iDataSet] );
 
                 if ( ( xDoubleData.size() == yDoubleData.size() ) && ( xDoubleData.size()>0 ) )
                 {
@@ -2969,8 +3072,10 @@ void VSPAEROPlotScreen::PlotUnsteady( string resultID, vector <string> yDataSetN
                     {
                         Fl_Color c = ColorWheel( m_UnsteadyiPlot, m_UnsteadyNLines );
 
-                        //add the normalized data to the plot
-                        AddPointLine( xDoubleData, yDoubleData, 2, c, 4, StyleWheel( m_UnsteadyiPlot ) );
+                        //add the normalized data to the plot, at most a few points per pixel column
+                        vector <double> xPlotData, yPlotData;
+                        DecimateSeries( xDoubleData, yDoubleData, m_UnsteadyPlotCanvas->w(), xPlotData, yPlotData );
+                        AddPointLine( xPlotData, yPlotData, 2, c, 4, StyleWheel( m_UnsteadyiPlot ) );
 
                         char strbuf[100];
                         string legendstr;
@@ -3034,13 +3139,13 @@ void VSPAEROPlotScreen::PlotUnsteady( string resultID, vector <string> yDataSetN
 
 }
 
-void VSPAEROPlotScreen::UpdateAxisLimits( Ca_Canvas * canvas, vector <double> xDoubleData, vector <double> yDoubleData, bool expandOnly )
+void VSPAEROPlotScreen::UpdateAxisLimits( Ca_Canvas * canvas, const vector <double> & xDoubleData, const vector <double> & yDoubleData, bool expandOnly )
 {
     UpdateSingleAxisLimits( canvas->current_x(), xDoubleData, expandOnly );
     UpdateSingleAxisLimits( canvas->current_y(), yDoubleData, expandOnly );
 }
 
-void VSPAEROPlotScreen::UpdateSingleAxisLimits( Ca_Axis_ * tAxis, vector <double> doubleData, bool expandOnly, bool keepZero )
+void VSPAEROPlotScreen::UpdateSingleAxisLimits( Ca_Axis_ * tAxis, const vector <double> & doubleData, bool expandOnly, bool keepZero )
 {
     //TODO Get data from canvas and make this a part of the Canvas class
     if ( doubleData.size() > 0 )
@@ -3097,3 +3202,131 @@ void VSPAEROPlotScreen::UpdateSingleAxisLimits( Ca_Axis_ * tAxis, vector <double
     }
 }
 
+//==== Result Data As Doubles, Extracted Once Per Result ID And Data Name ====//
+const vector <double> & VSPAEROPlotScreen::GetCachedSeries( Results * res, const string & dataName )
+{
+    pair < string, string > key( res->GetID(), dataName );
+
+    map < pair < string, string >, vector <double> >::iterator it = m_SeriesCache.find( key );
+    if ( it != m_SeriesCache.end() )
+    {
+        return it->second;
+    }
+
+    vector <double> & series = m_SeriesCache[ key ];
+
+    NameValData* nvd = res->FindPtr( dataName );
+    if ( nvd )
+    {
+        if ( nvd->GetType() == vsp::INT_DATA )
+        {
+            const vector <int> & tIntData = nvd->GetIntData();
+            series.assign( tIntData.begin(), tIntData.end() );
+        }
+        else if ( nvd->GetType() == vsp::DOUBLE_DATA )
+        {
+            series = nvd->GetDoubleData();
+        }
+    }
+
+    return series;
+}
+
+//==== Drop Cached Series Of Results That Have Been Deleted ====//
+void VSPAEROPlotScreen::PruneSeriesCache()
+{
+    map < pair < string, string >, vector <double> >::iterator it = m_SeriesCache.begin();
+    while ( it != m_SeriesCache.end() )
+    {
+        if ( !ResultsMgr.FindResultsPtr( it->first.first ) )
+        {
+            m_SeriesCache.erase( it++ );
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+//==== Keep The First, Last, Min And Max Point Of Each Pixel Column ====//
+void VSPAEROPlotScreen::DecimateSeries( const vector <double> & xData, const vector <double> & yData, int nColumns, vector <double> & xDec, vector <double> & yDec )
+{
+    int n = std::min( xData.size(), yData.size() );
+
+    // Columns are spread over the x range, so x must be monotonic for this to pay off
+    double xMin = n > 0 ? xData[0] : 0.0;
+    double xMax = n > 0 ? xData[n - 1] : 0.0;
+
+    if ( nColumns < 1 || n <= 4 * nColumns || !( xMax > xMin ) )
+    {
+        xDec.assign( xData.begin(), xData.begin() + n );
+        yDec.assign( yData.begin(), yData.begin() + n );
+        return;
+    }
+
+    xDec.clear();
+    yDec.clear();
+    xDec.reserve( 4 * nColumns + 2 );
+    yDec.reserve( 4 * nColumns + 2 );
+
+    double scale = nColumns / ( xMax - xMin );
+
+    int i = 0;
+    while ( i < n )
+    {
+        int col = ( int )( ( xData[i] - xMin ) * scale );
+
+        int iFirst = i;
+        int iMin = i;
+        int iMax = i;
+        int j = i + 1;
+        while ( j < n && ( int )( ( xData[j] - xMin ) * scale ) == col )
+        {
+            if ( yData[j] < yData[iMin] )
+            {
+                iMin = j;
+            }
+            if ( yData[j] > yData[iMax] )
+            {
+                iMax = j;
+            }
+            j++;
+        }
+        int iLast = j - 1;
+
+        // Emit the kept points in their original order
+        int keep[4] = { iFirst, std::min( iMin, iMax ), std::max( iMin, iMax ), iLast };
+        for ( int k = 0; k < 4; k++ )
+        {
+            if ( k == 0 || keep[k] != keep[k - 1] )
+            {
+                xDec.push_back( xData[ keep[k] ] );
+                yDec.push_back( yData[ keep[k] ] );
+            }
+        }
+
+        i = j;
+    }
+}
+
+//==== Signature Of The Inputs To One Plot ====//
+string VSPAEROPlotScreen::MakePlotKey( const vector <string> & idVec, const vector <string> & nameVec, const vector <int> & flagVec )
+{
+    string key;
+    for ( int i = 0; i < ( int )idVec.size(); i++ )
+    {
+        key += idVec[i] + "\n";
+    }
+    key += "\t";
+    for ( int i = 0; i < ( int )nameVec.size(); i++ )
+    {
+        key += nameVec[i] + "\n";
+    }
+    key += "\t";
+    for ( int i = 0; i < ( int )flagVec.size(); i++ )
+    {
+        key += to_string( flagVec[i] ) + "\n";
+    }
+    return key;
+}
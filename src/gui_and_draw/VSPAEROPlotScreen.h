@@ -56,10 +56,24 @@ protected:
     void UpdateCpSliceAutoManualAxisLimits();
     void UpdateUnsteadyAutoManualAxisLimits();
     static string MakeAxisLabelStr( vector <string> dataSetNames );
-    void UpdateAxisLimits( Ca_Canvas * canvas, vector <double> xDoubleData, vector <double> yDoubleData, bool expand_only );
-    static void UpdateSingleAxisLimits( Ca_Axis_ * tAxis, vector <double> doubleData, bool expandOnly, bool keepZero = false );
+    void UpdateAxisLimits( Ca_Canvas * canvas, const vector <double> & xDoubleData, const vector <double> & yDoubleData, bool expand_only );
+    static void UpdateSingleAxisLimits( Ca_Axis_ * tAxis, const vector <double> & doubleData, bool expandOnly, bool keepZero = false );
+    static void DecimateSeries( const vector <double> & xData, const vector <double> & yData, int nColumns, vector <double> & xDec, vector <double> & yDec );
+    static string MakePlotKey( const vector <string> & idVec, const vector <string> & nameVec, const vector <int> & flagVec );
     //  general utility
     static void ConstructFlowConditionString( char * strbuf, Results * res, bool includeResultId );
+    bool AppendFlowConditionRows( Fl_Browser * browser, vector< string > & row_ids, vector< string > & selected_ids, const string & result_name );
+
+    //  result data as doubles, cached by ( result ID, data name ) since results do not change once stored
+    const vector <double> & GetCachedSeries( Results * res, const string & dataName );
+    void PruneSeriesCache();
+    map < pair < string, string >, vector <double> > m_SeriesCache;
+
+    //  inputs of the last plot drawn on each canvas, a plot is only rebuilt when these change
+    string m_ConvergencePlotKey;
+    string m_LoadDistPlotKey;
+    string m_SweepPlotKey;
+    string m_UnsteadyPlotKey;
 
     //==== Convergence Tab ====//
     Fl_Group* m_ConvergenceTab;
@@ -77,6 +91,7 @@ protected:
     Fl_Browser * m_ConvergenceYDataBrowser;
     Fl_Browser * m_ConvergenceFlowConditionBrowser;
     vector< string > m_ConvergenceFlowConditionSelectedResultIDs;
+    vector< string > m_ConvergenceFlowConditionResultIDs;  // result shown on each browser row
 
     ToggleButton m_ConvergenceManualXMinToggle;
     ToggleButton m_ConvergenceManualXMaxToggle;
@@ -145,6 +160,7 @@ protected:
     Fl_Browser * m_SweepYDataBrowser;
     Fl_Browser * m_SweepFlowConditionBrowser;
     vector< string > m_SweepFlowConditionSelectedResultIDs;
+    vector< string > m_SweepFlowConditionResultIDs;        // result shown on each browser row
 
     ToggleButton m_SweepManualXMinToggle;
     ToggleButton m_SweepManualXMaxToggle;
@@ -304,16 +304,27 @@ VSPAEROScreen::VSPAEROScreen( ScreenMgr* mgr ) : TabScreen( mgr, VSPAERO_SCREEN_
 
     m_AdvancedCaseSetupLayout.AddButton( m_KTCorrectionToggle, "2nd Order Karman-Tsien Mach Correction" );
 
-    m_AdvancedCaseSetupLayout.AddButton(m_Write2DFEMToggle, "Write 2D FEM");
+    m_AdvancedCaseSetupLayout.SetFitWidthFlag( false );
+    m_AdvancedCaseSetupLayout.SetSameLineFlag( true );
+
+    m_AdvancedCaseSetupLayout.SetButtonWidth( m_AdvancedCaseSetupLayout.GetW() / 2 );
+
+    m_AdvancedCaseSetupLayout.AddButton( m_Write2DFEMToggle, "Write 2D FEM" );
+    m_AdvancedCaseSetupLayout.AddButton( m_AdjointToggle, "Adjoint Sensitivities" );
+
+    m_AdvancedCaseSetupLayout.ForceNewLine();
+    m_AdvancedCaseSetupLayout.SetFitWidthFlag( true );
+    m_AdvancedCaseSetupLayout.SetSameLineFlag( false );
 
     // Wake Layout
     m_AdvancedLeftLayout.AddSubGroupLayout( m_WakeLayout,
         m_AdvancedLeftLayout.GetW(),
-        4 * m_AdvancedLeftLayout.GetStdHeight() );
+        5 * m_AdvancedLeftLayout.GetStdHeight() );
     m_AdvancedLeftLayout.AddY( m_WakeLayout.GetH() );
 
     m_WakeLayout.AddDividerBox( "Wake" );
     m_WakeLayout.AddButton( m_FixedWakeToggle, "Fixed Wake" );
+    m_WakeLayout.AddButton( m_AdaptiveWakeToggle, "Stop Wake Iterations When Converged" );
 
     m_WakeLayout.SetButtonWidth( 80 ); // Match with m_NCPUSlider
     m_WakeLayout.SetInputWidth( 50 );
@@ -1283,6 +1294,8 @@ void VSPAEROScreen::UpdateCaseSetupDevices()
         m_CompGeomFileName.Deactivate();
         m_CompGeomFileButton.Deactivate();
 
+        m_AdjointToggle.Activate();
+
         break;
 
     case vsp::PANEL:
@@ -1294,6 +1307,8 @@ void VSPAEROScreen::UpdateCaseSetupDevices()
         m_CompGeomFileName.Activate();
         m_CompGeomFileButton.Activate();
 
+        m_AdjointToggle.Deactivate();
+
         break;
 
     default:
@@ -1330,10 +1345,12 @@ void VSPAEROScreen::UpdateAdvancedTabDevices()
     m_KTCorrectionToggle.Update( VSPAEROMgr.m_KTCorrection.GetID() );
     m_SymmetryToggle.Update( VSPAEROMgr.m_Symmetry.GetID() );
     m_Write2DFEMToggle.Update( VSPAEROMgr.m_Write2DFEMFlag.GetID() );
+    m_AdjointToggle.Update( VSPAEROMgr.m_AdjointFlag.GetID() );
 
     // Wake Options
     m_FixedWakeToggle.Update( VSPAEROMgr.m_FixedWakeFlag.GetID() );
     m_WakeNumIterSlider.Update(VSPAEROMgr.m_WakeNumIter.GetID());
+    m_AdaptiveWakeToggle.Update( VSPAEROMgr.m_AdaptiveWakeFlag.GetID() );
     m_NumWakeNodeSlider.Update( VSPAEROMgr.m_NumWakeNodes.GetID() );
 
     bool time_dependent = false;
@@ -1355,10 +1372,12 @@ void VSPAEROScreen::UpdateAdvancedTabDevices()
     if ( time_dependent || VSPAEROMgr.m_FixedWakeFlag() )
     {
         m_WakeNumIterSlider.Deactivate();
+        m_AdaptiveWakeToggle.Deactivate();
     }
     else
     {
         m_WakeNumIterSlider.Activate();
+        m_AdaptiveWakeToggle.Activate();
     }
 
     // Other Set Up Parms
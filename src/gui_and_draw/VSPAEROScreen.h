@@ -184,6 +184,7 @@ protected:
     ToggleButton m_BatchCalculationToggle;
     ToggleButton m_SymmetryToggle;
     ToggleButton m_Write2DFEMToggle;
+    ToggleButton m_AdjointToggle;
     Choice m_PreconditionChoice;
     ToggleButton m_KTCorrectionToggle;
     ToggleButton m_FromSteadyStateToggle;
@@ -191,6 +192,7 @@ protected:
     // Wake calculation options
     ToggleButton m_FixedWakeToggle;
     SliderAdjRangeInput m_WakeNumIterSlider;
+    ToggleButton m_AdaptiveWakeToggle;
     SliderAdjRangeInput m_NumWakeNodeSlider;
 
     // Other Setup Parms Setup
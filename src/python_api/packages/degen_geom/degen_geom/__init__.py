@@ -19,3 +19,4 @@
 # THE SOFTWARE.
 
 from .degen_geom import *
+from .binary_reader import *
@@ -0,0 +1,185 @@
+# Copyright (c) 2018 Uber Technologies, Inc.
+
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+# THE SOFTWARE.
+
+
+"""Readers for the binary results and DegenGeom files written by OpenVSP"""
+from collections import namedtuple
+import struct
+import numpy as np
+
+from .degen_geom import DegenGeom, DegenSurf, DegenStick, DegenHinge, DegenPoint, DegenDisk
+
+# Data type ids, matching vsp::RES_DATA_TYPE
+INT_DATA = 0
+DOUBLE_DATA = 1
+STRING_DATA = 2
+VEC3D_DATA = 3
+DOUBLE_MATRIX_DATA = 4
+
+_MAGIC = b'VSPRSLT1'
+_ENDIAN_CHECK = -123456789
+
+
+class BinaryResult:
+    """
+    One results record read from a binary results file
+    """
+
+    def __init__(self, name, res_id, timestamp, data):
+        self.name = name
+        self.id = res_id
+        self.timestamp = timestamp
+        self.data = data
+        """
+        Dictionary of data name to a list with one entry per data of that name
+        """
+
+    def as_namedtuple(self):
+        """
+        Returns the first data for each name as a named tuple, like openvsp.parse_results_object
+        """
+        names = sorted(self.data.keys())
+        res_tuple = namedtuple(self.name, names, rename=True)
+        return res_tuple(*[self.data[n][0] for n in names])
+
+
+class _Reader:
+    def __init__(self, buf):
+        self.buf = buf
+        self.pos = 0
+        self.endian = '<'
+
+    def done(self):
+        return self.pos >= len(self.buf)
+
+    def read_header(self):
+        if self.buf[self.pos:self.pos + 8] != _MAGIC:
+            raise ValueError("Not an OpenVSP binary results file")
+        self.pos += 8
+        if struct.unpack_from('<i', self.buf, self.pos)[0] != _ENDIAN_CHECK:
+            self.endian = '>'
+        self.pos += 4
+
+    def int(self):
+        val = struct.unpack_from(self.endian + 'i', self.buf, self.pos)[0]
+        self.pos += 4
+        return val
+
+    def int64(self):
+        val = struct.unpack_from(self.endian + 'q', self.buf, self.pos)[0]
+        self.pos += 8
+        return val
+
+    def string(self):
+        n = self.int()
+        val = self.buf[self.pos:self.pos + n].decode('utf-8', 'replace')
+        self.pos += n
+        return val
+
+    def array(self, dtype, n):
+        dt = np.dtype(dtype).newbyteorder(self.endian)
+        val = np.frombuffer(self.buf, dtype=dt, count=n, offset=self.pos)
+        self.pos += n * dt.itemsize
+        return val
+
+    def column(self, type):
+        n = self.int()
+        if type == INT_DATA:
+            return self.array('i4', n)
+        elif type == DOUBLE_DATA:
+            return self.array('f8', n)
+        elif type == VEC3D_DATA:
+            # Stored as an x, y and z column
+            return self.array('f8', 3 * n).reshape(3, n).T
+        elif type == STRING_DATA:
+            return [self.string() for i in range(n)]
+        elif type == DOUBLE_MATRIX_DATA:
+            rows = [self.array('f8', self.int()) for i in range(n)]
+            if rows and all(len(r) == len(rows[0]) for r in rows):
+                return np.array(rows)
+            return rows
+        return []
+
+    def result(self):
+        name = self.string()
+        res_id = self.string()
+        timestamp = self.int64()
+        data = {}
+        for i in range(self.int()):
+            data_name = self.string()
+            type = self.int()
+            data.setdefault(data_name, []).append(self.column(type))
+        return BinaryResult(name, res_id, timestamp, data)
+
+
+def read_results_binary(file_name):
+    """
+    Reads every results record from a binary results file. Appended runs are all returned.
+
+    :param file_name: binary file written by WriteResultsBinaryFile or a DegenGeom binary export
+    :return: list of :class:`BinaryResult` in file order
+    """
+    with open(file_name, 'rb') as f:
+        reader = _Reader(f.read())
+
+    reader.read_header()
+    results = []
+    while not reader.done():
+        results.append(reader.result())
+    return results
+
+
+def read_degen_geom_binary(file_name):
+    """
+    Reads a DegenGeom binary file into the same objects as openvsp.parse_degen_geom
+
+    :param file_name: the _DegenGeom.bin file
+    :return: list of :class:`DegenGeom` objects
+    """
+    results = read_results_binary(file_name)
+    by_id = dict((r.id, r) for r in results)
+
+    def parts(res, name):
+        if name not in res.data:
+            return []
+        return [by_id[i].as_namedtuple() for i in res.data[name][0] if i in by_id]
+
+    degen_objects = []
+    for degen_root in [r for r in results if r.name == 'DegenGeom']:
+        for degen_id in degen_root.data.get('Degen_DegenGeoms', [[]])[0]:
+            if degen_id not in by_id:
+                continue
+            res = by_id[degen_id]
+            degen_obj = DegenGeom(res.as_namedtuple())
+
+            for surf in parts(res, 'surf'):
+                degen_obj.surf = DegenSurf(surf)
+            for stick in parts(res, 'sticks'):
+                degen_obj.sticks.append(DegenStick(stick))
+            for hinge in parts(res, 'hinges'):
+                degen_obj.hinge_lines.append(DegenHinge(hinge))
+            for point in parts(res, 'point'):
+                degen_obj.point = DegenPoint(point)
+            for disk in parts(res, 'disk'):
+                degen_obj.disk = DegenDisk(disk)
+
+            degen_objects.append(degen_obj)
+
+    return degen_objects
@@ -1,5 +1,5 @@
 /* File : vsp.i */
-%module vsp
+%module(threads="1") vsp
 %include vsp_common.i
 
 
@@ -30,6 +30,252 @@ namespace std {
 %apply ( std::vector<double> &OUTPUT ) { std::vector < double > &w_out_vec };
 %apply ( std::vector<double> &OUTPUT ) { std::vector < double > &d_out_vec };
 
+/* Threading
+   The modules are built with SWIG thread support, but only the long running
+   calls below give up the GIL, so other Python threads (progress reporting,
+   I/O, other Python work) keep running while OpenVSP computes.
+
+   There is one model per process, so OpenVSP itself never runs two API
+   calls at once; every wrapped call takes the API lock first.  A thread that
+   has to wait for the lock releases the GIL while it waits.  Calls from
+   several threads are therefore safe but are serialized.  The exception is
+   CancelMeshGeneration, which skips the lock so it can stop a ComputeCFDMesh
+   or ComputeFeaMesh that is running in another thread.  To run several
+   models in parallel, use separate processes. */
+%{
+static PyThread_type_lock s_VSPAPILock = NULL;
+
+static void VSPAPILockAcquire()
+{
+    if ( PyThread_acquire_lock( s_VSPAPILock, NOWAIT_LOCK ) )
+    {
+        return;
+    }
+
+    if ( PyGILState_Check() )
+    {
+        Py_BEGIN_ALLOW_THREADS
+        PyThread_acquire_lock( s_VSPAPILock, WAIT_LOCK );
+        Py_END_ALLOW_THREADS
+    }
+    else
+    {
+        PyThread_acquire_lock( s_VSPAPILock, WAIT_LOCK );
+    }
+}
+
+static void VSPAPILockRelease()
+{
+    PyThread_release_lock( s_VSPAPILock );
+}
+%}
+
+%init %{
+    s_VSPAPILock = PyThread_allocate_lock();
+%}
+
+%exception {
+    VSPAPILockAcquire();
+    $action
+    VSPAPILockRelease();
+}
+
+%exception vsp::CancelMeshGeneration {
+    $action
+}
+
+%nothread;
+%thread vsp::Update;
+%thread vsp::ReadVSPFile;
+%thread vsp::WriteVSPFile;
+%thread vsp::InsertVSPFile;
+%thread vsp::ExportFile;
+%thread vsp::ImportFile;
+%thread vsp::ComputeMassProps;
+%thread vsp::ComputeCompGeom;
+%thread vsp::ComputePlaneSlice;
+%thread vsp::ComputePlaneSliceBatch;
+%thread vsp::ComputeDegenGeom;
+%thread vsp::ComputeCFDMesh;
+%thread vsp::ComputeFeaMesh;
+%thread vsp::ComputeFeaMeshes;
+%thread vsp::ExecAnalysis;
+%thread vsp::ComputeMinClearanceDistance;
+
+/* Contiguous array access - the data moves through the buffer protocol in one block */
+%{
+/* Read-only view of memory owned by OpenVSP, no copy */
+static PyObject* VSPBufferView( const void* data, size_t nbytes )
+{
+    static char empty = 0;
+    return PyMemoryView_FromMemory( nbytes ? ( char* ) data : &empty, ( Py_ssize_t ) nbytes, PyBUF_READ );
+}
+
+/* Single block copy of a temporary result into a new bytearray */
+static PyObject* VSPBufferCopy( const void* data, size_t nbytes )
+{
+    return PyByteArray_FromStringAndSize( ( const char* ) data, ( Py_ssize_t ) nbytes );
+}
+
+/* Fill a vector from any C contiguous buffer of doubles */
+template < class T >
+static bool VSPBufferToVec( PyObject* obj, std::vector< T > & vec, const char* name )
+{
+    Py_buffer view;
+    if ( PyObject_GetBuffer( obj, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT ) != 0 )
+    {
+        return false;
+    }
+
+    const char* fmt = view.format ? view.format : "B";
+    if ( *fmt == '<' || *fmt == '=' || *fmt == '@' )
+    {
+        fmt++;
+    }
+
+    bool ok = ( strcmp( fmt, "d" ) == 0 && view.itemsize == sizeof( double ) && view.len % sizeof( T ) == 0 );
+    if ( ok )
+    {
+        const T* data = ( const T* ) view.buf;
+        vec.assign( data, data + view.len / sizeof( T ) );
+    }
+    else
+    {
+        PyErr_Format( PyExc_TypeError, "%s must be a contiguous float64 buffer", name );
+    }
+
+    PyBuffer_Release( &view );
+    return ok;
+}
+%}
+
+%inline %{
+/* Views stay valid until the results are deleted */
+PyObject* GetIntResultsBuffer( const std::string & id, const std::string & name, int index = 0 )
+{
+    const std::vector< int > & d = vsp::GetIntResults( id, name, index );
+    return VSPBufferView( d.empty() ? NULL : &d[0], d.size() * sizeof( int ) );
+}
+
+PyObject* GetDoubleResultsBuffer( const std::string & id, const std::string & name, int index = 0 )
+{
+    const std::vector< double > & d = vsp::GetDoubleResults( id, name, index );
+    return VSPBufferView( d.empty() ? NULL : &d[0], d.size() * sizeof( double ) );
+}
+
+PyObject* GetVec3dResultsBuffer( const std::string & id, const std::string & name, int index = 0 )
+{
+    const std::vector< vec3d > & d = vsp::GetVec3dResults( id, name, index );
+    return VSPBufferView( d.empty() ? NULL : &d[0], d.size() * sizeof( vec3d ) );
+}
+
+PyObject* CompVecPnt01Buffer( const std::string & geom_id, int surf_indx, PyObject* u_in, PyObject* w_in )
+{
+    std::vector< double > us, ws;
+    if ( !VSPBufferToVec( u_in, us, "u" ) || !VSPBufferToVec( w_in, ws, "w" ) )
+    {
+        return NULL;
+    }
+    std::vector< vec3d > pnts = vsp::CompVecPnt01( geom_id, surf_indx, us, ws );
+    return VSPBufferCopy( pnts.empty() ? NULL : &pnts[0], pnts.size() * sizeof( vec3d ) );
+}
+
+PyObject* CompVecNorm01Buffer( const std::string & geom_id, int surf_indx, PyObject* u_in, PyObject* w_in )
+{
+    std::vector< double > us, ws;
+    if ( !VSPBufferToVec( u_in, us, "u" ) || !VSPBufferToVec( w_in, ws, "w" ) )
+    {
+        return NULL;
+    }
+    std::vector< vec3d > norms = vsp::CompVecNorm01( geom_id, surf_indx, us, ws );
+    return VSPBufferCopy( norms.empty() ? NULL : &norms[0], norms.size() * sizeof( vec3d ) );
+}
+
+PyObject* ProjVecPnt01Buffer( const std::string & geom_id, int surf_indx, PyObject* pts_in )
+{
+    std::vector< vec3d > pts;
+    if ( !VSPBufferToVec( pts_in, pts, "pts" ) )
+    {
+        return NULL;
+    }
+    std::vector< double > us, ws, ds;
+    vsp::ProjVecPnt01( geom_id, surf_indx, pts, us, ws, ds );
+    return Py_BuildValue( "(NNN)", VSPBufferCopy( us.empty() ? NULL : &us[0], us.size() * sizeof( double ) ),
+                                   VSPBufferCopy( ws.empty() ? NULL : &ws[0], ws.size() * sizeof( double ) ),
+                                   VSPBufferCopy( ds.empty() ? NULL : &ds[0], ds.size() * sizeof( double ) ) );
+}
+%}
+
+%pythoncode %{
+def GetIntResultsArray(id, name, index=0, copy=False):
+    """Int results as a NumPy array viewing OpenVSP memory. Use copy=True to keep it past DeleteResult."""
+    import numpy as np
+    a = np.frombuffer(GetIntResultsBuffer(id, name, index), dtype=np.intc)
+    return a.copy() if copy else a
+
+def GetDoubleResultsArray(id, name, index=0, copy=False):
+    """Double results as a NumPy array viewing OpenVSP memory. Use copy=True to keep it past DeleteResult."""
+    import numpy as np
+    a = np.frombuffer(GetDoubleResultsBuffer(id, name, index), dtype=np.float64)
+    return a.copy() if copy else a
+
+def GetVec3dResultsArray(id, name, index=0, copy=False):
+    """Vec3d results as an Nx3 NumPy array viewing OpenVSP memory. Use copy=True to keep it past DeleteResult."""
+    import numpy as np
+    a = np.frombuffer(GetVec3dResultsBuffer(id, name, index), dtype=np.float64).reshape(-1, 3)
+    return a.copy() if copy else a
+
+def IterResultsChunks(id, name, chunk_size=65536, index=0):
+    """Yield results data in chunks of up to chunk_size entries. Numeric chunks are NumPy views of OpenVSP memory."""
+    import numpy as np
+    res_type = GetResultsType(id, name)
+    if res_type == INT_DATA:
+        a = GetIntResultsArray(id, name, index)
+    elif res_type == DOUBLE_DATA:
+        a = GetDoubleResultsArray(id, name, index)
+    elif res_type == VEC3D_DATA:
+        a = GetVec3dResultsArray(id, name, index)
+    else:
+        num = GetResultsDataLength(id, name, index)
+        for start in range(0, num, chunk_size):
+            yield GetStringResultsChunk(id, name, start, chunk_size, index)
+        return
+    for start in range(0, len(a), chunk_size):
+        yield a[start:start + chunk_size]
+
+def IterFeaMeshElements(chunk_size=65536):
+    """Yield (num_nodes, nodes, pnts) NumPy arrays for chunks of up to chunk_size elements of the last FEA mesh."""
+    import numpy as np
+    num_elem = GetFeaMeshNumElements()
+    for start in range(0, num_elem, chunk_size):
+        num_nodes = np.array(GetFeaMeshElementNumNodes(start, chunk_size), dtype=np.intc)
+        nodes = np.array(GetFeaMeshElementNodeChunk(start, chunk_size), dtype=np.intc)
+        pnts = np.array([[p.x(), p.y(), p.z()] for p in GetFeaMeshElementPntChunk(start, chunk_size)], dtype=np.float64).reshape(-1, 3)
+        yield num_nodes, nodes, pnts
+
+def CompVecPnt01Array(geom_id, surf_indx, u, w):
+    """CompVecPnt01 taking array-like u and w and returning an Nx3 NumPy array."""
+    import numpy as np
+    u = np.ascontiguousarray(u, dtype=np.float64)
+    w = np.ascontiguousarray(w, dtype=np.float64)
+    return np.frombuffer(CompVecPnt01Buffer(geom_id, surf_indx, u, w), dtype=np.float64).reshape(-1, 3)
+
+def CompVecNorm01Array(geom_id, surf_indx, u, w):
+    """CompVecNorm01 taking array-like u and w and returning an Nx3 NumPy array."""
+    import numpy as np
+    u = np.ascontiguousarray(u, dtype=np.float64)
+    w = np.ascontiguousarray(w, dtype=np.float64)
+    return np.frombuffer(CompVecNorm01Buffer(geom_id, surf_indx, u, w), dtype=np.float64).reshape(-1, 3)
+
+def ProjVecPnt01Array(geom_id, surf_indx, pts):
+    """ProjVecPnt01 taking an Nx3 array-like of points and returning NumPy arrays u, w and d."""
+    import numpy as np
+    pts = np.ascontiguousarray(pts, dtype=np.float64).reshape(-1, 3)
+    u, w, d = ProjVecPnt01Buffer(geom_id, surf_indx, pts)
+    return (np.frombuffer(u, dtype=np.float64), np.frombuffer(w, dtype=np.float64),
+            np.frombuffer(d, dtype=np.float64))
+%}
+
 /* Let's just grab the original header file here */
 %include "APIDefines.h"
 %include "APIErrorMgr.h"
@@ -1,3 +1,3 @@
 /* File : vsp_g.i */
-%module vsp_g
+%module(threads="1") vsp_g
 %include vsp_common.i
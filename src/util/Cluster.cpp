@@ -100,15 +100,6 @@ double asinhc_approx( const double &y )
 //
 double asinhc( const double &y )
 {
-    static double lasty = -1.0; // Negative argument impossible
-    static double lastx = 0;
-
-    if ( y == lasty )
-    {
-        return lastx;
-    }
-    lasty = y;
-
     // Initialize with series expansion initial guess.
     double x = asinhc_approx( y );
 
@@ -133,7 +124,6 @@ double asinhc( const double &y )
         {
             // x fell below xmin
             x = 0.0;
-            lastx = x;
             return x;
         }
 
@@ -141,7 +131,6 @@ double asinhc( const double &y )
         if ( std::abs( f ) < tol )
         {
             // Converged
-            lastx = x;
             return x;
         }
 
@@ -149,7 +138,6 @@ double asinhc( const double &y )
     }
 
     // Exceeded max iterations.
-    lastx = x;
     return x;
 }
 
@@ -187,15 +175,6 @@ double asinc_approx( const double &y )
 //
 double asinc( const double &y )
 {
-    static double lasty = -1.0; // Negative argument impossible
-    static double lastx = 0;
-
-    if ( y == lasty )
-    {
-        return lastx;
-    }
-    lasty = y;
-
     // Initialize with series expansion initial guess.
     double x = asinc_approx( y );
 
@@ -220,14 +199,12 @@ double asinc( const double &y )
         {
             // x fell below xmin
             x = 0.0;
-            lastx = x;
             return x;
         }
 
         if ( std::abs( f ) < tol )
         {
             // Converged
-            lastx = x;
             return x;
         }
 
@@ -235,6 +212,5 @@ double asinc( const double &y )
     }
 
     // Exceeded max iterations
-    lastx = x;
     return x;
 }
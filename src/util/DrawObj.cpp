@@ -11,6 +11,7 @@
 
 #include "DrawObj.h"
 #include "Matrix.h"
+#include "StlHelper.h"
 
 void MakeArrowhead( const vec3d &ptip, const vec3d &uref, double len, vector < vec3d > &pts )
 {
@@ -236,6 +237,118 @@ DrawObj::~DrawObj()
 {
 }
 
+void DrawObj::AppendPackedMesh( const vector< vector< vec3d > > &pnts, const vector< vector< vec3d > > &norms,
+                                const vector< vector< double > > &utex, const vector< vector< double > > &vtex )
+{
+    int num_pnts = pnts.size();
+    int num_xsecs = 0;
+    if ( num_pnts )
+    {
+        num_xsecs = pnts[0].size();
+    }
+
+    unsigned int offset = m_PackedVerts.size() / 8;
+
+    m_PackedVerts.reserve( m_PackedVerts.size() + 8 * num_pnts * num_xsecs );
+    for ( int i = 0 ; i < num_pnts ; i++ )
+    {
+        for ( int j = 0 ; j < num_xsecs ; j++ )
+        {
+            m_PackedVerts.push_back( ( float )pnts[i][j].x() );
+            m_PackedVerts.push_back( ( float )pnts[i][j].y() );
+            m_PackedVerts.push_back( ( float )pnts[i][j].z() );
+
+            m_PackedVerts.push_back( ( float )norms[i][j].x() );
+            m_PackedVerts.push_back( ( float )norms[i][j].y() );
+            m_PackedVerts.push_back( ( float )norms[i][j].z() );
+
+            m_PackedVerts.push_back( ( float )utex[i][j] );
+            m_PackedVerts.push_back( ( float )vtex[i][j] );
+        }
+    }
+
+    if ( num_pnts > 1 && num_xsecs > 1 )
+    {
+        m_PackedQuadIndx.reserve( m_PackedQuadIndx.size() + 4 * ( num_pnts - 1 ) * ( num_xsecs - 1 ) );
+        for ( int i = 0 ; i < num_pnts - 1 ; i++ )
+        {
+            for ( int j = 0 ; j < num_xsecs - 1 ; j++ )
+            {
+                m_PackedQuadIndx.push_back( offset + i * num_xsecs + j );
+                m_PackedQuadIndx.push_back( offset + ( i + 1 ) * num_xsecs + j );
+                m_PackedQuadIndx.push_back( offset + ( i + 1 ) * num_xsecs + j + 1 );
+                m_PackedQuadIndx.push_back( offset + i * num_xsecs + j + 1 );
+            }
+        }
+    }
+
+    //==== Coarser Levels Keep Every Few Rows And Columns, Plus The Last ====//
+    m_PackedLodQuadIndx.resize( DRAW_NUM_LOD );
+    if ( num_pnts < 2 || num_xsecs < 2 )
+    {
+        return;
+    }
+
+    int step = 1;
+    for ( int ilod = 0 ; ilod < DRAW_NUM_LOD ; ilod++ )
+    {
+        step *= 2;
+
+        vector< int > irow, jcol;
+        for ( int i = 0 ; i < num_pnts - 1 ; i += step )
+        {
+            irow.push_back( i );
+        }
+        irow.push_back( num_pnts - 1 );
+
+        for ( int j = 0 ; j < num_xsecs - 1 ; j += step )
+        {
+            jcol.push_back( j );
+        }
+        jcol.push_back( num_xsecs - 1 );
+
+        vector< unsigned int > & indx = m_PackedLodQuadIndx[ ilod ];
+        indx.reserve( indx.size() + 4 * ( irow.size() - 1 ) * ( jcol.size() - 1 ) );
+        for ( int i = 0 ; i < ( int )irow.size() - 1 ; i++ )
+        {
+            for ( int j = 0 ; j < ( int )jcol.size() - 1 ; j++ )
+            {
+                indx.push_back( offset + irow[i] * num_xsecs + jcol[j] );
+                indx.push_back( offset + irow[i + 1] * num_xsecs + jcol[j] );
+                indx.push_back( offset + irow[i + 1] * num_xsecs + jcol[j + 1] );
+                indx.push_back( offset + irow[i] * num_xsecs + jcol[j + 1] );
+            }
+        }
+    }
+}
+
+size_t DrawObj::MemoryUsage() const
+{
+    size_t bytes = sizeof( DrawObj );
+    bytes += vector_mem_bytes( m_PntVec ) + vector_mem_bytes( m_NormVec );
+    bytes += vector_mem_bytes( m_PntMesh ) + vector_mem_bytes( m_NormMesh );
+    bytes += vector_mem_bytes( m_uTexMesh ) + vector_mem_bytes( m_vTexMesh );
+    bytes += vector_mem_bytes( m_PackedVerts ) + vector_mem_bytes( m_PackedQuadIndx );
+    bytes += vector_mem_bytes( m_PackedLodQuadIndx ) + vector_mem_bytes( m_InstanceXFormVec );
+    return bytes;
+}
+
+void DrawObj::ClearGeomData()
+{
+    // Swap with empties so the capacity is released too
+    vector< vec3d >().swap( m_PntVec );
+    vector< vec3d >().swap( m_NormVec );
+    vector< vector< vector< vec3d > > >().swap( m_PntMesh );
+    vector< vector< vector< vec3d > > >().swap( m_NormMesh );
+    vector< vector< vector< double > > >().swap( m_uTexMesh );
+    vector< vector< vector< double > > >().swap( m_vTexMesh );
+    vector< float >().swap( m_PackedVerts );
+    vector< unsigned int >().swap( m_PackedQuadIndx );
+    vector< vector< unsigned int > >().swap( m_PackedLodQuadIndx );
+    vector< Matrix4d >().swap( m_InstanceXFormVec );
+    m_GeomChanged = true;
+}
+
 vec3d DrawObj::ColorWheel( double angle )
 {
     // Returns rgb for an angle in degrees on color wheel
@@ -12,6 +12,7 @@
 #define VSP_DRAWOBJ_H
 
 #include "Vec3d.h"
+#include "Matrix.h"
 
 #include <vector>
 #include <string>
@@ -24,6 +25,8 @@ using namespace std;
 #define BBOXHEADER "BBOX_"
 #define XSECHEADER "XSEC_"
 
+#define DRAW_NUM_LOD 2 // Coarser display levels of detail kept for packed meshes
+
 class DrawObj
 {
 public:
@@ -388,6 +391,49 @@ public:
     vector< vector< vector< double > > > m_uTexMesh;
     vector< vector< vector< double > > > m_vTexMesh;
 
+    /*
+    * Packed XSec mesh data, an alternative to m_PntMesh, m_NormMesh, m_uTexMesh
+    * and m_vTexMesh filled directly at tessellation time by AppendPackedMesh.
+    * When m_PackedVerts is not empty, it is uploaded to the graphics buffers as is.
+    *
+    * Data format:
+    * m_PackedVerts - x, y, z, nx, ny, nz, u, v per vertex.
+    * m_PackedQuadIndx - four vertex indices per quad.
+    */
+    vector< float > m_PackedVerts;
+    vector< unsigned int > m_PackedQuadIndx;
+
+    /*
+    * Coarser display levels of detail for the packed mesh, for surfaces that are
+    * small on screen.  Each level holds quad indices into m_PackedVerts that step
+    * over twice as many rows and columns as the level before it.
+    */
+    vector< vector< unsigned int > > m_PackedLodQuadIndx;
+
+    /*
+    * Instance transformations for the packed mesh.  When not empty, the packed
+    * buffers hold the geometry once, and it is drawn once per transformation.
+    */
+    vector< Matrix4d > m_InstanceXFormVec;
+
+    /*
+    * Append one tessellated surface mesh to the packed buffers.
+    * All inputs are indexed [pnts on xsec][xsec index].
+    */
+    void AppendPackedMesh( const vector< vector< vec3d > > &pnts, const vector< vector< vec3d > > &norms,
+                           const vector< vector< double > > &utex, const vector< vector< double > > &vtex );
+
+    /*
+    * Approximate bytes held by the point, normal, texture and packed buffers.
+    */
+    size_t MemoryUsage() const;
+
+    /*
+    * Release the point, normal, texture and packed buffers and set m_GeomChanged.
+    * The owner must rebuild them before this DrawObj is drawn again.
+    */
+    void ClearGeomData();
+
     /*
     * List of attached textures to this drawobj.  Default is empty.
     */
@@ -6,6 +6,10 @@
 #include "FileUtil.h"
 #include "tinydir.h"
 
+#include <cstdarg>
+#include <cstdlib>
+#include <cstring>
+
 #ifdef __APPLE__
 #include <mach-o/dyld.h>    /* _NSGetExecutablePath */
 #endif
@@ -17,6 +21,9 @@
 #include <unistd.h>
 #include <libgen.h>
 #include <pwd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #endif
 
 #ifdef __FreeBSD__
@@ -284,6 +291,42 @@ bool FileExist( const string & file )
     }
 }
 
+//==== Byte For Byte Copy Of A File ====//
+bool CopyFileContents( const string & src_file, const string & dst_file )
+{
+    FILE *src = fopen( src_file.c_str(), "rb" );
+    if ( !src )
+    {
+        return false;
+    }
+
+    FILE *dst = fopen( dst_file.c_str(), "wb" );
+    if ( !dst )
+    {
+        fclose( src );
+        return false;
+    }
+
+    bool ok = true;
+    vector< char > buf( 1 << 16 );
+    size_t nread;
+    while ( ( nread = fread( &buf[0], 1, buf.size(), src ) ) > 0 )
+    {
+        if ( fwrite( &buf[0], 1, nread, dst ) != nread )
+        {
+            ok = false;
+            break;
+        }
+    }
+
+    fclose( src );
+    if ( fclose( dst ) != 0 )
+    {
+        ok = false;
+    }
+    return ok;
+}
+
 // This is similar to basename() on linux and returns the last portion of the pathfile string
 string GetFilename( const string &pathfile )
 {
@@ -317,3 +360,283 @@ string GetFilename( const string &pathfile )
     return fileParts.back();
 
 }
+
+void AppendFormat( string & buf, const char* format, ... )
+{
+    char str[512];
+
+    va_list args;
+    va_start( args, format );
+    int n = vsnprintf( str, sizeof( str ), format, args );
+    va_end( args );
+
+    if ( n < 0 )
+    {
+        return;
+    }
+
+    if ( n < ( int )sizeof( str ) )
+    {
+        buf.append( str, n );
+    }
+    else
+    {
+        // Rare long line - format again into a buffer of the full size
+        vector< char > long_str( n + 1 );
+        va_start( args, format );
+        vsnprintf( &long_str[0], long_str.size(), format, args );
+        va_end( args );
+        buf.append( &long_str[0], n );
+    }
+}
+
+//==== Memory Mapped File ====//
+MappedFile::MappedFile()
+{
+    m_Data = NULL;
+    m_Size = 0;
+    m_Map = NULL;
+    m_MapSize = 0;
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open( const string & file_name )
+{
+    Close();
+
+#ifdef WIN32
+    HANDLE file = CreateFileA( file_name.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+    if ( file != INVALID_HANDLE_VALUE )
+    {
+        LARGE_INTEGER size;
+        if ( GetFileSizeEx( file, &size ) && size.QuadPart > 0 )
+        {
+            HANDLE mapping = CreateFileMapping( file, NULL, PAGE_READONLY, 0, 0, NULL );
+            if ( mapping )
+            {
+                void* view = MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+                CloseHandle( mapping );
+                if ( view )
+                {
+                    m_Map = view;
+                    m_MapSize = ( size_t )size.QuadPart;
+                }
+            }
+        }
+        CloseHandle( file );
+    }
+#else
+    int fd = open( file_name.c_str(), O_RDONLY );
+    if ( fd >= 0 )
+    {
+        struct stat st;
+        if ( fstat( fd, &st ) == 0 && st.st_size > 0 )
+        {
+            void* view = mmap( NULL, ( size_t )st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+            if ( view != MAP_FAILED )
+            {
+                madvise( view, ( size_t )st.st_size, MADV_SEQUENTIAL );
+                m_Map = view;
+                m_MapSize = ( size_t )st.st_size;
+            }
+        }
+        close( fd );
+    }
+#endif
+
+    if ( m_Map )
+    {
+        m_Data = ( const char* )m_Map;
+        m_Size = m_MapSize;
+        return true;
+    }
+
+    //==== Fall Back To Reading Whole File ====//
+    FILE* fp = fopen( file_name.c_str(), "rb" );
+    if ( !fp )
+    {
+        return false;
+    }
+
+    char buf[65536];
+    size_t n;
+    while ( ( n = fread( buf, 1, sizeof( buf ), fp ) ) > 0 )
+    {
+        m_Buffer.insert( m_Buffer.end(), buf, buf + n );
+    }
+    fclose( fp );
+
+    m_Data = m_Buffer.empty() ? NULL : &m_Buffer[0];
+    m_Size = m_Buffer.size();
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if ( m_Map )
+    {
+#ifdef WIN32
+        UnmapViewOfFile( m_Map );
+#else
+        munmap( m_Map, m_MapSize );
+#endif
+    }
+    m_Map = NULL;
+    m_MapSize = 0;
+    m_Buffer.clear();
+    m_Data = NULL;
+    m_Size = 0;
+}
+
+//==== Token Scanning ====//
+static inline bool IsSpace( char c )
+{
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\v' || c == '\f';
+}
+
+const char* SkipSpace( const char* p, const char* end )
+{
+    while ( p < end && IsSpace( *p ) )
+    {
+        p++;
+    }
+    return p;
+}
+
+const char* SkipToken( const char* p, const char* end )
+{
+    while ( p < end && !IsSpace( *p ) )
+    {
+        p++;
+    }
+    return p;
+}
+
+const char* SkipLine( const char* p, const char* end )
+{
+    const char* nl = ( const char* )memchr( p, '\n', end - p );
+    return nl ? nl + 1 : end;
+}
+
+bool TokenEquals( const char* p, const char* end, const char* word )
+{
+    size_t len = strlen( word );
+    if ( ( size_t )( end - p ) < len || strncmp( p, word, len ) != 0 )
+    {
+        return false;
+    }
+    return p + len == end || IsSpace( p[len] );
+}
+
+// The text is not NUL terminated, so numbers are copied to a local buffer for strtod/strtol.
+static const char* CopyToken( const char* p, const char* end, char* str, int max_len )
+{
+    p = SkipSpace( p, end );
+    const char* tok_end = SkipToken( p, end );
+    int len = ( int )( tok_end - p );
+    if ( len >= max_len )
+    {
+        len = max_len - 1;
+    }
+    memcpy( str, p, len );
+    str[len] = '\0';
+    return tok_end;
+}
+
+bool ParseFloat( const char* & p, const char* end, float & val )
+{
+    char str[64];
+    const char* tok_end = CopyToken( p, end, str, sizeof( str ) );
+
+    char* num_end;
+    val = strtof( str, &num_end );
+    if ( num_end == str )
+    {
+        return false;
+    }
+    p = tok_end;
+    return true;
+}
+
+bool ParseDouble( const char* & p, const char* end, double & val )
+{
+    char str[64];
+    const char* tok_end = CopyToken( p, end, str, sizeof( str ) );
+
+    char* num_end;
+    val = strtod( str, &num_end );
+    if ( num_end == str )
+    {
+        return false;
+    }
+    p = tok_end;
+    return true;
+}
+
+bool ParseInt( const char* & p, const char* end, int & val )
+{
+    char str[64];
+    const char* tok_end = CopyToken( p, end, str, sizeof( str ) );
+
+    char* num_end;
+    val = ( int )strtol( str, &num_end, 10 );
+    if ( num_end == str )
+    {
+        return false;
+    }
+    p = tok_end;
+    return true;
+}
+
+int CountTokens( const char* begin, const char* end )
+{
+    int num = 0;
+    const char* p = SkipSpace( begin, end );
+    while ( p < end )
+    {
+        num++;
+        p = SkipSpace( SkipToken( p, end ), end );
+    }
+    return num;
+}
+
+//==== Split Text Into Line Aligned Blocks ====//
+void SplitTextBlocks( const char* begin, const char* end, int num_block, vector< const char* > & split_vec )
+{
+    split_vec.clear();
+    split_vec.push_back( begin );
+
+    if ( num_block < 1 )
+    {
+        num_block = 1;
+    }
+
+    size_t size = end - begin;
+    for ( int b = 1 ; b < num_block ; b++ )
+    {
+        const char* p = begin + ( size * b ) / num_block;
+
+        if ( p < split_vec.back() )
+        {
+            p = split_vec.back();
+        }
+        if ( p > begin )
+        {
+            p = SkipLine( p - 1, end );       // Leave p alone when it already starts a line
+        }
+
+        split_vec.push_back( p );
+    }
+    split_vec.push_back( end );
+}
+
+int NumTextBlocks( const char* begin, const char* end )
+{
+    const size_t block_size = 1 << 20;
+    size_t num = ( end - begin ) / block_size + 1;
+    return ( int )std::min( num, ( size_t )1024 );
+}
@@ -8,6 +8,8 @@
 
 #include <vector>
 #include <string>
+#include <cstdio>
+#include <algorithm>
 using std::vector;
 using std::string;
 
@@ -19,7 +21,135 @@ string PathToHome();
 
 bool CheckForFile( const string & path, string &file );
 bool FileExist( const string & file );
+bool CopyFileContents( const string & src_file, const string & dst_file );
 string GetFilename( const string &pathfile );
 
+//==== Append printf Style Text To A String ====//
+void AppendFormat( string & buf, const char* format, ... );
+
+//==== Format Items In Parallel And Write Them In Order ====//
+// fmt( i, buf ) must append the text for item i to buf and be safe to call
+// concurrently.  Items are formatted in chunks into large buffers which are
+// then written in item order with a few big fwrite calls.
+template < class Formatter >
+void WriteChunked( FILE* fid, int num, const Formatter & fmt )
+{
+    const int chunk_size = 1024;
+    const int batch_size = 32;          // Chunks formatted per pass - bounds the buffer memory
+
+    int num_chunk = ( num + chunk_size - 1 ) / chunk_size;
+    vector< string > buf_vec( batch_size );
+
+    for ( int b = 0 ; b < num_chunk ; b += batch_size )
+    {
+        int num_batch = std::min( batch_size, num_chunk - b );
+
+        #pragma omp parallel for schedule( dynamic )
+        for ( int c = 0 ; c < num_batch ; c++ )
+        {
+            string & buf = buf_vec[c];
+            buf.clear();
+
+            int start = ( b + c ) * chunk_size;
+            int end = std::min( num, start + chunk_size );
+            for ( int i = start ; i < end ; i++ )
+            {
+                fmt( i, buf );
+            }
+        }
+
+        for ( int c = 0 ; c < num_batch ; c++ )
+        {
+            fwrite( buf_vec[c].data(), 1, buf_vec[c].size(), fid );
+        }
+    }
+}
+
+//==== Read Only Memory Mapped File ====//
+// Falls back to reading the whole file into memory when it can not be mapped.
+class MappedFile
+{
+public:
+    MappedFile();
+    virtual ~MappedFile();
+
+    bool Open( const string & file_name );
+    void Close();
+
+    const char* Begin() const                  { return m_Data; }
+    const char* End() const                    { return m_Data + m_Size; }
+    size_t Size() const                        { return m_Size; }
+
+protected:
+    const char* m_Data;
+    size_t m_Size;
+    void* m_Map;                               // Mapping handle - NULL when m_Buffer holds the data
+    size_t m_MapSize;
+    vector< char > m_Buffer;
+
+private:
+    MappedFile( const MappedFile & );
+    MappedFile & operator=( const MappedFile & );
+};
+
+//==== Whitespace Delimited Tokens In Unterminated Text ====//
+const char* SkipSpace( const char* p, const char* end );
+const char* SkipToken( const char* p, const char* end );
+const char* SkipLine( const char* p, const char* end );
+bool TokenEquals( const char* p, const char* end, const char* word );
+bool ParseFloat( const char* & p, const char* end, float & val );
+bool ParseDouble( const char* & p, const char* end, double & val );
+bool ParseInt( const char* & p, const char* end, int & val );
+int CountTokens( const char* begin, const char* end );
+
+//==== Split Text For Parallel Parsing ====//
+// Fills split_vec with num_block + 1 pointers from begin to end.  Interior
+// splits are moved forward onto the start of a line so no token or line
+// straddles two blocks.
+void SplitTextBlocks( const char* begin, const char* end, int num_block, vector< const char* > & split_vec );
+int NumTextBlocks( const char* begin, const char* end );
+
+//==== Parse Tokens In Parallel ====//
+// Calls fn( index, tok_begin, tok_end ) for every token in [begin, end) where
+// index is the global token number.  Tokens are counted per block in a first
+// parallel pass so the second pass can hand out global indices, letting fn
+// store straight into preallocated arrays.  fn must be safe to call concurrently.
+template < class TokenFn >
+int ParseTokensParallel( const char* begin, const char* end, const TokenFn & fn )
+{
+    vector< const char* > split_vec;
+    SplitTextBlocks( begin, end, NumTextBlocks( begin, end ), split_vec );
+    int num_block = ( int )split_vec.size() - 1;
+
+    vector< int > start_vec( num_block + 1, 0 );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int b = 0 ; b < num_block ; b++ )
+    {
+        start_vec[b + 1] = CountTokens( split_vec[b], split_vec[b + 1] );
+    }
+
+    for ( int b = 0 ; b < num_block ; b++ )
+    {
+        start_vec[b + 1] += start_vec[b];
+    }
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int b = 0 ; b < num_block ; b++ )
+    {
+        int index = start_vec[b];
+        const char* p = SkipSpace( split_vec[b], split_vec[b + 1] );
+        while ( p < split_vec[b + 1] )
+        {
+            const char* tok_end = SkipToken( p, split_vec[b + 1] );
+            fn( index, p, tok_end );
+            index++;
+            p = SkipSpace( tok_end, split_vec[b + 1] );
+        }
+    }
+
+    return start_vec[num_block];
+}
+
 #endif
 
@@ -253,20 +253,93 @@ void Matrix4d::flipx()
     mat[0] *= -1.0;
 }
 
-vec3d Matrix4d::xform( const vec3d & in ) const
+void Matrix4d::xformvec( std::vector < vec3d > & in ) const
 {
-    vec3d out;
-    out[0] = mat[0] * in[0] + mat[4] * in[1] + mat[8] * in[2] + mat[12];
-    out[1] = mat[1] * in[0] + mat[5] * in[1] + mat[9] * in[2] + mat[13];
-    out[2] = mat[2] * in[0] + mat[6] * in[1] + mat[10] * in[2] + mat[14];
-    return out;
+    if ( !in.empty() )
+    {
+        xformvec( &in[0], &in[0], ( int )in.size() );
+    }
 }
 
-void Matrix4d::xformvec( std::vector < vec3d > & in ) const
+void Matrix4d::xformvec( vec3d* pnts, int n ) const
+{
+    xformvec( pnts, pnts, n );
+}
+
+void Matrix4d::xformvec( const vec3d* in, vec3d* out, int n ) const
+{
+    const double m0 = mat[0], m1 = mat[1], m2 = mat[2];
+    const double m4 = mat[4], m5 = mat[5], m6 = mat[6];
+    const double m8 = mat[8], m9 = mat[9], m10 = mat[10];
+    const double m12 = mat[12], m13 = mat[13], m14 = mat[14];
+
+    for ( int i = 0; i < n; i++ )
+    {
+        const double x = in[i].v[0];
+        const double y = in[i].v[1];
+        const double z = in[i].v[2];
+        out[i].v[0] = m0 * x + m4 * y + m8 * z + m12;
+        out[i].v[1] = m1 * x + m5 * y + m9 * z + m13;
+        out[i].v[2] = m2 * x + m6 * y + m10 * z + m14;
+    }
+}
+
+void Matrix4d::xformnormvec( std::vector < vec3d > & in ) const
+{
+    if ( !in.empty() )
+    {
+        xformnormvec( &in[0], ( int )in.size() );
+    }
+}
+
+void Matrix4d::xformnormvec( vec3d* norms, int n ) const
 {
-    for ( int i = 0; i < in.size(); i++ )
+    const double m0 = mat[0], m1 = mat[1], m2 = mat[2];
+    const double m4 = mat[4], m5 = mat[5], m6 = mat[6];
+    const double m8 = mat[8], m9 = mat[9], m10 = mat[10];
+
+    for ( int i = 0; i < n; i++ )
+    {
+        const double x = norms[i].v[0];
+        const double y = norms[i].v[1];
+        const double z = norms[i].v[2];
+        norms[i].v[0] = m0 * x + m4 * y + m8 * z;
+        norms[i].v[1] = m1 * x + m5 * y + m9 * z;
+        norms[i].v[2] = m2 * x + m6 * y + m10 * z;
+    }
+}
+
+void Matrix4d::xformmat( std::vector < std::vector < vec3d > > & in ) const
+{
+    for ( int i = 0; i < ( int )in.size(); i++ )
+    {
+        xformvec( in[i] );
+    }
+}
+
+void Matrix4d::xformnormmat( std::vector < std::vector < vec3d > > & in ) const
+{
+    for ( int i = 0; i < ( int )in.size(); i++ )
+    {
+        xformnormvec( in[i] );
+    }
+}
+
+void Matrix4d::xformxyz( double* x, double* y, double* z, int n ) const
+{
+    const double m0 = mat[0], m1 = mat[1], m2 = mat[2];
+    const double m4 = mat[4], m5 = mat[5], m6 = mat[6];
+    const double m8 = mat[8], m9 = mat[9], m10 = mat[10];
+    const double m12 = mat[12], m13 = mat[13], m14 = mat[14];
+
+    for ( int i = 0; i < n; i++ )
     {
-        in[i] = xform( in[i] );
+        const double xi = x[i];
+        const double yi = y[i];
+        const double zi = z[i];
+        x[i] = m0 * xi + m4 * yi + m8 * zi + m12;
+        y[i] = m1 * xi + m5 * yi + m9 * zi + m13;
+        z[i] = m2 * xi + m6 * yi + m10 * zi + m14;
     }
 }
 
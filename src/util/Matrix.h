@@ -53,8 +53,30 @@ public:
     void loadXYRef();
     void loadYZRef();
 
-    vec3d xform( const vec3d & in ) const;
+    vec3d xform( const vec3d & in ) const
+    {
+        return vec3d( mat[0] * in.v[0] + mat[4] * in.v[1] + mat[8] * in.v[2] + mat[12],
+                      mat[1] * in.v[0] + mat[5] * in.v[1] + mat[9] * in.v[2] + mat[13],
+                      mat[2] * in.v[0] + mat[6] * in.v[1] + mat[10] * in.v[2] + mat[14] );
+    }
+    vec3d xformnorm( const vec3d & in ) const       // Rotation part only, same as xform( in ) - xform( 0 )
+    {
+        return vec3d( mat[0] * in.v[0] + mat[4] * in.v[1] + mat[8] * in.v[2],
+                      mat[1] * in.v[0] + mat[5] * in.v[1] + mat[9] * in.v[2],
+                      mat[2] * in.v[0] + mat[6] * in.v[1] + mat[10] * in.v[2] );
+    }
+
+    //==== Batch Transforms Over Contiguous Arrays ====//
+    // The matrix is held in locals for the whole loop so the compiler can keep it
+    // in registers and vectorize.  in and out may be the same array.
     void xformvec( std::vector < vec3d > & in ) const;
+    void xformvec( vec3d* pnts, int n ) const;
+    void xformvec( const vec3d* in, vec3d* out, int n ) const;
+    void xformnormvec( std::vector < vec3d > & in ) const;
+    void xformnormvec( vec3d* norms, int n ) const;
+    void xformmat( std::vector < std::vector < vec3d > > & in ) const;
+    void xformnormmat( std::vector < std::vector < vec3d > > & in ) const;
+    void xformxyz( double* x, double* y, double* z, int n ) const;     // Separate coordinate arrays
     vec3d getAngles() const;
 
     void buildXForm( const vec3d & pos, const vec3d & rot, const vec3d & cent_rot );
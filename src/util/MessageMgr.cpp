@@ -3,27 +3,57 @@
 // version 1.3 as detailed in the LICENSE file which accompanies this software.
 //
 #include <cassert>
+#include <atomic>
+#include <mutex>
 
 #include "MessageMgr.h"
 using std::map;
 using std::string;
 using std::deque;
 
+struct MessageQueue
+{
+    std::atomic< MessageQueueNode* > m_Head;
+
+    // Nodes taken by the owner and not yet delivered, guarded by the registry lock.
+    vector< MessageQueueNode* > m_DeliverVec;
+};
+
+//==== Registry Lock - Constant Initialized, So Usable From Static Constructors ====//
+static std::mutex s_RegMutex;
+
+//==== Address Unique To The Calling Thread ====//
+static const void* CurrentThreadToken()
+{
+    static thread_local char token;
+    return &token;
+}
+
 //==== Message Data ====//
 MessageData::MessageData()
 {
 }
 
+bool MessageData::operator==( const MessageData & data ) const
+{
+    return m_String == data.m_String && m_IntVec == data.m_IntVec && m_StringVec == data.m_StringVec;
+}
+
 //==== Message Base ====//
 MessageBase::MessageBase()
 {
     m_Name = "DefaultName";
+    m_QueuedFlag = false;
+    m_OwnerThread = NULL;
+    m_Queue = new MessageQueue;
+    m_Queue->m_Head.store( NULL );
 }
 
 //==== Message Base ====//
 MessageBase::~MessageBase()
 {
-    UnRegister();
+    UnRegister();                       // Also Drops Pending Messages To And From This Listener
+    delete m_Queue;
 }
 
 /** @brief Register this MessageBase listener.
@@ -51,6 +81,150 @@ void MessageBase::UnRegister()
     MessageMgr::getInstance().UnRegister( this );
 }
 
+void MessageBase::SetQueuedDelivery( bool flag )
+{
+    m_OwnerThread = CurrentThreadToken();
+    m_QueuedFlag = flag;
+}
+
+bool MessageBase::NeedsQueue() const
+{
+    return m_QueuedFlag && CurrentThreadToken() != m_OwnerThread;
+}
+
+/** @brief Push a message onto the pending queue.  Safe to call from any number of threads.
+ *
+ * @param[in] from   MessageBase that sent message.
+ * @param[in] data   Message data.
+ */
+void MessageBase::PushQueued( const MessageBase* from, const MessageData& data )
+{
+    MessageQueueNode* node = new MessageQueueNode;
+    node->m_From = from;
+    node->m_Data = data;
+    node->m_Next = m_Queue->m_Head.load( std::memory_order_relaxed );
+
+    while ( !m_Queue->m_Head.compare_exchange_weak( node->m_Next, node, std::memory_order_release, std::memory_order_relaxed ) )
+    {
+    }
+}
+
+/** @brief Deliver all pending messages on the calling (owner) thread.
+ *
+ * The queue is taken in one exchange, so messages pushed during delivery wait for the
+ * next call.  Repeats of an identical message are dropped, keeping the last copy so
+ * its position after any other pending message is preserved.
+ *
+ * @return Number of messages delivered.
+ */
+int MessageBase::DeliverQueuedMessages()
+{
+    int start, end;
+    {
+        // Taken with the registry locked so UnRegister can reach every undelivered node.
+        std::lock_guard< std::mutex > lock( s_RegMutex );
+        MessageQueueNode* node = m_Queue->m_Head.exchange( NULL, std::memory_order_acquire );
+        if ( !node )
+        {
+            return 0;
+        }
+
+        // List is newest first; keep the newest copy of each message and restore send order.
+        vector< MessageQueueNode* > node_vec;
+        while ( node )
+        {
+            MessageQueueNode* next = node->m_Next;
+
+            bool dup = false;
+            for ( int i = 0 ; i < ( int )node_vec.size() ; i++ )
+            {
+                if ( node_vec[i]->m_From == node->m_From && node_vec[i]->m_Data == node->m_Data )
+                {
+                    dup = true;
+                    break;
+                }
+            }
+
+            if ( dup )
+            {
+                delete node;
+            }
+            else
+            {
+                node_vec.push_back( node );
+            }
+            node = next;
+        }
+
+        start = ( int )m_Queue->m_DeliverVec.size();
+        m_Queue->m_DeliverVec.insert( m_Queue->m_DeliverVec.end(), node_vec.rbegin(), node_vec.rend() );
+        end = ( int )m_Queue->m_DeliverVec.size();
+    }
+
+    // Callbacks run unlocked; a node dropped by UnRegister since the take is skipped.
+    int ndeliver = 0;
+    for ( int i = start ; i < end ; i++ )
+    {
+        MessageQueueNode* node;
+        {
+            std::lock_guard< std::mutex > lock( s_RegMutex );
+            node = m_Queue->m_DeliverVec[i];
+            m_Queue->m_DeliverVec[i] = NULL;
+        }
+
+        if ( node )
+        {
+            MessageCallback( node->m_From, node->m_Data );
+            delete node;
+            ndeliver++;
+        }
+    }
+
+    std::lock_guard< std::mutex > lock( s_RegMutex );
+    m_Queue->m_DeliverVec.resize( start );
+    return ndeliver;
+}
+
+/** @brief Drop pending messages sent by from, or every pending message if all is set.
+ *
+ * Called with the registry locked, so no producer is pushing and the list can be rebuilt.
+ *
+ * @param[in] from   MessageBase whose messages are dropped.
+ * @param[in] all    Drop messages from every sender.
+ */
+void MessageBase::RemoveQueued( const MessageBase* from, bool all )
+{
+    MessageQueueNode* node = m_Queue->m_Head.exchange( NULL, std::memory_order_acquire );
+    MessageQueueNode* keep = NULL;
+    MessageQueueNode** tail = &keep;
+    while ( node )
+    {
+        MessageQueueNode* next = node->m_Next;
+        if ( all || node->m_From == from )
+        {
+            delete node;
+        }
+        else
+        {
+            *tail = node;
+            tail = &node->m_Next;
+        }
+        node = next;
+    }
+    *tail = NULL;
+    m_Queue->m_Head.store( keep, std::memory_order_release );
+
+    for ( int i = 0 ; i < ( int )m_Queue->m_DeliverVec.size() ; i++ )
+    {
+        MessageQueueNode* dnode = m_Queue->m_DeliverVec[i];
+        if ( dnode && ( all || dnode->m_From == from ) )
+        {
+            delete dnode;
+            m_Queue->m_DeliverVec[i] = NULL;
+        }
+    }
+}
+
 //==== Constructor ====//
 MessageMgr::MessageMgr()
 {
@@ -62,17 +236,32 @@ MessageMgr::MessageMgr()
  */
 void MessageMgr::Register( MessageBase* msg_base )
 {
+    std::lock_guard< std::mutex > lock( s_RegMutex );
     m_MessageRegMap[msg_base->GetName()].push_back( msg_base );
 }
 
 /** @brief UnRegister MessageBase listener.
+ *
+ * Messages still queued for the listener, and messages it sent that are queued for
+ * any other listener, are dropped.
  *
  * @param[in] msg_base Listener to unregister.
  */
 void MessageMgr::UnRegister( MessageBase* msg_base )
 {
+    std::lock_guard< std::mutex > lock( s_RegMutex );
     map< string, deque< MessageBase* > >::iterator iter;
 
+    //==== Queued Nodes Hold Raw Sender Pointers, Drop Any From This Base ====//
+    msg_base->RemoveQueued( NULL, true );
+    for ( iter = m_MessageRegMap.begin(); iter != m_MessageRegMap.end(); ++iter )
+    {
+        for ( int i = 0 ; i < ( int )( iter->second ).size() ; i++ )
+        {
+            ( iter->second )[i]->RemoveQueued( msg_base, false );
+        }
+    }
+
     if ( m_MessageRegMap.size() == 0 )
     {
         return;
@@ -123,6 +312,14 @@ void MessageMgr::UnRegister( MessageBase* msg_base )
 
 }
 
+/** @brief UnRegister every listener, e.g. in a forked child process.
+ */
+void MessageMgr::UnRegisterAll()
+{
+    std::lock_guard< std::mutex > lock( s_RegMutex );
+    m_MessageRegMap.clear();
+}
+
 /** @brief Send string message to designated receiver, from undesignated sender.
  *
  * @param[in] to_name Targeted message receiver.
@@ -153,16 +350,19 @@ void MessageMgr::Send( const string& to_name, const MessageData& data )
  */
 void MessageMgr::Send( const string& to_name, const MessageBase* from_base, const MessageData& data  )
 {
-    map< string, deque< MessageBase* > >::iterator iter;
-
-    iter = m_MessageRegMap.find( to_name );
-    if ( iter != m_MessageRegMap.end() )
+    deque< MessageBase* > sync_receivers;
     {
-        for ( int i = 0 ; i < ( int )iter->second.size() ; i++ )
+        std::lock_guard< std::mutex > lock( s_RegMutex );
+        map< string, deque< MessageBase* > >::iterator iter;
+
+        iter = m_MessageRegMap.find( to_name );
+        if ( iter != m_MessageRegMap.end() )
         {
-            iter->second[i]->MessageCallback( from_base, data );
+            QueueOrCollect( iter->second, from_base, data, sync_receivers );
         }
     }
+
+    DeliverCollected( sync_receivers, from_base, data );
 }
 
 /** @brief Send string message to all receivers, from undesignated sender.
@@ -192,13 +392,76 @@ void MessageMgr::SendAll( const MessageData& data )
  */
 void MessageMgr::SendAll( const MessageBase* from_base, const MessageData& data  )
 {
-    map< string, deque< MessageBase* > >::iterator iter;
+    deque< MessageBase* > sync_receivers;
+    {
+        std::lock_guard< std::mutex > lock( s_RegMutex );
+        map< string, deque< MessageBase* > >::iterator iter;
 
+        for ( iter = m_MessageRegMap.begin(); iter != m_MessageRegMap.end(); ++iter )
+        {
+            QueueOrCollect( iter->second, from_base, data, sync_receivers );
+        }
+    }
+
+    DeliverCollected( sync_receivers, from_base, data );
+}
+
+/** @brief Queue message for listeners that deliver on their own thread, collect the rest.
+ *
+ * Called with the registry locked, so queued listeners cannot be destroyed mid-push.
+ */
+void MessageMgr::QueueOrCollect( const deque< MessageBase* > & receivers, const MessageBase* from_base,
+                                 const MessageData& data, deque< MessageBase* > & sync_receivers )
+{
+    for ( int i = 0 ; i < ( int )receivers.size() ; i++ )
+    {
+        if ( receivers[i]->NeedsQueue() )
+        {
+            receivers[i]->PushQueued( from_base, data );
+        }
+        else
+        {
+            sync_receivers.push_back( receivers[i] );
+        }
+    }
+}
+
+/** @brief Call each collected listener that is still registered.
+ *
+ * Callbacks run outside the lock so they may send or (un)register listeners.  Each
+ * listener is checked against the live registry first, so one unregistered or deleted
+ * by an earlier callback is skipped.
+ */
+void MessageMgr::DeliverCollected( const deque< MessageBase* > & sync_receivers, const MessageBase* from_base,
+                                   const MessageData& data )
+{
+    for ( int i = 0 ; i < ( int )sync_receivers.size() ; i++ )
+    {
+        {
+            std::lock_guard< std::mutex > lock( s_RegMutex );
+            if ( !IsRegistered( sync_receivers[i] ) )
+            {
+                continue;
+            }
+        }
+        sync_receivers[i]->MessageCallback( from_base, data );
+    }
+}
+
+/** @brief Return true if the listener is in the registry.  Called with the registry locked.
+ */
+bool MessageMgr::IsRegistered( const MessageBase* msg_base ) const
+{
+    map< string, deque< MessageBase* > >::const_iterator iter;
     for ( iter = m_MessageRegMap.begin(); iter != m_MessageRegMap.end(); ++iter )
     {
-        for ( int i = 0 ; i < ( int )iter->second.size() ; i++ )
+        for ( int i = 0 ; i < ( int )( iter->second ).size() ; i++ )
         {
-            iter->second[i]->MessageCallback( from_base, data );
+            if ( ( iter->second )[i] == msg_base )
+            {
+                return true;
+            }
         }
     }
+    return false;
 }
@@ -28,6 +28,12 @@
  * the listener side can have full access to the geometry core API to send or receive
  * complex data or commands.
  *
+ * Messages are normally delivered synchronously on the sender's thread.  A listener
+ * that owns a thread with an event loop (the GUI) can instead ask for queued
+ * delivery.  Messages sent to it from any other thread are then pushed onto a
+ * lock-free multi-producer queue and delivered in one batch, with identical pending
+ * messages coalesced, when the owning thread calls DeliverQueuedMessages().
+ *
  */
 
 #if !defined(MESSAGE_MGR__INCLUDED_)
@@ -54,8 +60,25 @@ public:
     string m_String;
     vector< int > m_IntVec;
     vector< string > m_StringVec;
+
+    bool operator==( const MessageData & data ) const;
+};
+
+class MessageBase;
+
+/** @brief Pending message in a listener's queue.
+ */
+struct MessageQueueNode
+{
+    const MessageBase* m_From;          // Dropped By MessageMgr::UnRegister, So Never Dangles
+    MessageData m_Data;
+    MessageQueueNode* m_Next;
 };
 
+// Lock-free head of a listener's pending messages, defined in MessageMgr.cpp so
+// this widely included header stays free of the standard thread headers.
+struct MessageQueue;
+
 
 /** @class MessageBase
  * @brief Message listener base class.
@@ -89,6 +112,19 @@ public:
     virtual void Register( const string & name );
     virtual void UnRegister();
 
+    /** @brief Queue messages sent from other threads for delivery on the calling thread.
+     *
+     * @param[in] flag   True to queue cross-thread messages, false to deliver them immediately.
+     */
+    void SetQueuedDelivery( bool flag );
+
+    /** @brief Return true if a message sent from the calling thread must be queued.
+     */
+    bool NeedsQueue() const;
+
+    void PushQueued( const MessageBase* from, const MessageData& data );
+    int DeliverQueuedMessages();
+
     /** @brief Callback function executed when message received.
      *
      * @param[in] from   MessageBase that sent message.
@@ -98,6 +134,19 @@ public:
 
 protected:
     string m_Name;
+
+    bool m_QueuedFlag;
+    const void* m_OwnerThread;          // Token Of The Thread That Delivers Queued Messages
+
+    // Producers push with compare-exchange, the owner takes the whole list at once.
+    MessageQueue* m_Queue;
+
+private:
+    MessageBase( MessageBase const& copy );             // Not Implemented
+    MessageBase& operator=( MessageBase const& copy );  // Not Implemented
+
+    friend class MessageMgr;
+    void RemoveQueued( const MessageBase* from, bool all );
 };
 
 /** @class MessageMgr
@@ -113,8 +162,15 @@ private:
     MessageMgr( MessageMgr const& copy );          // Not Implemented
     MessageMgr& operator=( MessageMgr const& copy ); // Not Implemented
 
+    // Guarded by a registry mutex in MessageMgr.cpp, so a listener is not removed while another thread sends to it.
     std::map< string, std::deque< MessageBase* > > m_MessageRegMap;
 
+    void QueueOrCollect( const std::deque< MessageBase* > & receivers, const MessageBase* from_base,
+                         const MessageData& data, std::deque< MessageBase* > & sync_receivers );
+    void DeliverCollected( const std::deque< MessageBase* > & sync_receivers, const MessageBase* from_base,
+                           const MessageData& data );
+    bool IsRegistered( const MessageBase* msg_base ) const;
+
 public:
     /** @brief Get common instance of MessageMgr.
      */
@@ -126,6 +182,7 @@ public:
 
     void Register( MessageBase* msg_base );
     void UnRegister( MessageBase* msg_base );
+    void UnRegisterAll();
 
     void Send( const string& to_name, const string& msg );
     void Send( const string& to_name, const MessageData& data  );
@@ -0,0 +1,220 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// PerfStats.cpp: Scoped timers, counters and peak memory for the major stages.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "PerfStats.h"
+#include "ProcessUtil.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+
+//==== PerfStat ====//
+PerfStat::PerfStat()
+{
+    m_Count = 0;
+    m_Total = 0.0;
+    m_Min = 0.0;
+    m_Max = 0.0;
+    m_PeakMem = 0.0;
+}
+
+void PerfStat::Add( double sec, double peak_mem )
+{
+    m_Min = ( m_Count == 0 ) ? sec : std::min( m_Min, sec );
+    m_Max = ( m_Count == 0 ) ? sec : std::max( m_Max, sec );
+    m_Total += sec;
+    m_Count++;
+    m_PeakMem = std::max( m_PeakMem, peak_mem );
+}
+
+void PerfStat::Merge( const PerfStat & stat )
+{
+    if ( stat.m_Count == 0 )
+    {
+        return;
+    }
+
+    m_Min = ( m_Count == 0 ) ? stat.m_Min : std::min( m_Min, stat.m_Min );
+    m_Max = ( m_Count == 0 ) ? stat.m_Max : std::max( m_Max, stat.m_Max );
+    m_Total += stat.m_Total;
+    m_Count += stat.m_Count;
+    m_PeakMem = std::max( m_PeakMem, stat.m_PeakMem );
+}
+
+//==== PerfStatsSingleton ====//
+PerfStatsSingleton::PerfStatsSingleton()
+{
+    m_Enabled = false;
+    m_TraceFlag = false;
+    m_StartTime = 0.0;
+    m_StartTime = Now();
+
+    const char* trace_file = getenv( "VSP_PERF_TRACE" );
+    if ( trace_file && trace_file[0] != '\0' )
+    {
+        m_TraceFileName = trace_file;
+        m_Enabled = true;
+        m_TraceFlag = true;
+    }
+}
+
+PerfStatsSingleton::~PerfStatsSingleton()
+{
+    if ( !m_TraceFileName.empty() )
+    {
+        WriteTrace( m_TraceFileName );
+    }
+
+    for ( int i = 0 ; i < ( int )m_ThreadDataVec.size() ; i++ )
+    {
+        delete m_ThreadDataVec[i];
+    }
+}
+
+void PerfStatsSingleton::Reset()
+{
+    for ( int i = 0 ; i < ( int )m_ThreadDataVec.size() ; i++ )
+    {
+        m_ThreadDataVec[i]->m_StatMap.clear();
+        m_ThreadDataVec[i]->m_CountMap.clear();
+        m_ThreadDataVec[i]->m_TraceVec.clear();
+    }
+    m_StartTime = 0.0;
+    m_StartTime = Now();
+}
+
+//==== Seconds Since Startup Or The Last Reset ====//
+double PerfStatsSingleton::Now() const
+{
+    return GetWallTime() - m_StartTime;
+}
+
+//==== Records Of The Calling Thread, Created On First Use ====//
+PerfThreadData* PerfStatsSingleton::GetThreadData()
+{
+    static thread_local PerfThreadData* data = NULL;
+
+    if ( !data )
+    {
+        #pragma omp critical( perf_stats_thread )
+        {
+            data = new PerfThreadData;
+            data->m_Thread = ( int )m_ThreadDataVec.size();
+            m_ThreadDataVec.push_back( data );
+        }
+    }
+    return data;
+}
+
+void PerfStatsSingleton::AddTime( const char* name, double start, double end )
+{
+    PerfThreadData* data = GetThreadData();
+
+    data->m_StatMap[ name ].Add( end - start, GetPeakMemoryMB() );
+
+    if ( m_TraceFlag )
+    {
+        PerfTraceEvent event;
+        event.m_Name = name;
+        event.m_Start = start;
+        event.m_Dur = end - start;
+        event.m_Thread = data->m_Thread;
+        data->m_TraceVec.push_back( event );
+    }
+}
+
+//==== Stable Pointer For A Name Built At Run Time ====//
+const char* PerfStatsSingleton::StoreName( const string & name )
+{
+    const char* ptr = NULL;
+    #pragma omp critical( perf_stats_name )
+    {
+        ptr = m_NameSet.insert( name ).first->c_str();
+    }
+    return ptr;
+}
+
+void PerfStatsSingleton::AddCount( const char* name, double n )
+{
+    GetThreadData()->m_CountMap[ name ] += n;
+}
+
+void PerfStatsSingleton::GetStats( vector< string > & name_vec, vector< PerfStat > & stat_vec ) const
+{
+    map< string, PerfStat > merged;
+    for ( int i = 0 ; i < ( int )m_ThreadDataVec.size() ; i++ )
+    {
+        map< const char*, PerfStat >::const_iterator it;
+        for ( it = m_ThreadDataVec[i]->m_StatMap.begin() ; it != m_ThreadDataVec[i]->m_StatMap.end() ; ++it )
+        {
+            merged[ string( it->first ) ].Merge( it->second );
+        }
+    }
+
+    name_vec.clear();
+    stat_vec.clear();
+    map< string, PerfStat >::const_iterator it;
+    for ( it = merged.begin() ; it != merged.end() ; ++it )
+    {
+        name_vec.push_back( it->first );
+        stat_vec.push_back( it->second );
+    }
+}
+
+void PerfStatsSingleton::GetCounts( vector< string > & name_vec, vector< double > & count_vec ) const
+{
+    map< string, double > merged;
+    for ( int i = 0 ; i < ( int )m_ThreadDataVec.size() ; i++ )
+    {
+        map< const char*, double >::const_iterator it;
+        for ( it = m_ThreadDataVec[i]->m_CountMap.begin() ; it != m_ThreadDataVec[i]->m_CountMap.end() ; ++it )
+        {
+            merged[ string( it->first ) ] += it->second;
+        }
+    }
+
+    name_vec.clear();
+    count_vec.clear();
+    map< string, double >::const_iterator it;
+    for ( it = merged.begin() ; it != merged.end() ; ++it )
+    {
+        name_vec.push_back( it->first );
+        count_vec.push_back( it->second );
+    }
+}
+
+//==== Chrome Trace Event Format, Times In Microseconds ====//
+bool PerfStatsSingleton::WriteTrace( const string & file_name ) const
+{
+    FILE* fid = fopen( file_name.c_str(), "w" );
+    if ( !fid )
+    {
+        return false;
+    }
+
+    fprintf( fid, "{\"traceEvents\":[\n" );
+
+    bool first = true;
+    for ( int i = 0 ; i < ( int )m_ThreadDataVec.size() ; i++ )
+    {
+        const vector< PerfTraceEvent > & trace_vec = m_ThreadDataVec[i]->m_TraceVec;
+        for ( int j = 0 ; j < ( int )trace_vec.size() ; j++ )
+        {
+            fprintf( fid, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                     first ? "" : ",\n", trace_vec[j].m_Name, trace_vec[j].m_Thread,
+                     trace_vec[j].m_Start * 1.0e6, trace_vec[j].m_Dur * 1.0e6 );
+            first = false;
+        }
+    }
+
+    fprintf( fid, "\n],\"displayTimeUnit\":\"ms\"}\n" );
+    fclose( fid );
+    return true;
+}
@@ -0,0 +1,150 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// PerfStats.h: Scoped timers, counters and peak memory for the major stages.
+//
+// PERF_SCOPE( "Name" ) times the enclosing block and PERF_COUNT( "Name", n )
+// adds to a counter.  Both cost one flag test while collection is off and
+// compile to nothing when VSP_NO_PERF_STATS is defined.  Each thread records
+// into its own buffers, which are merged when the statistics are read.
+//
+// Setting the VSP_PERF_TRACE environment variable to a file name turns
+// collection on at startup and writes a Chrome trace (chrome://tracing) of
+// every timed scope to that file at exit.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(VSP_PERF_STATS__INCLUDED_)
+#define VSP_PERF_STATS__INCLUDED_
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+using std::map;
+using std::set;
+using std::string;
+using std::vector;
+
+//==== Statistics Of One Named Scope ====//
+struct PerfStat
+{
+    PerfStat();
+
+    void Add( double sec, double peak_mem );
+    void Merge( const PerfStat & stat );
+
+    int m_Count;
+    double m_Total;                     // Seconds
+    double m_Min;
+    double m_Max;
+    double m_PeakMem;                   // Process peak memory in MB when the scope ended
+};
+
+//==== One Timed Scope For Trace Output ====//
+struct PerfTraceEvent
+{
+    const char* m_Name;
+    double m_Start;
+    double m_Dur;
+    int m_Thread;
+};
+
+//==== Per Thread Records, Keyed By Name Pointer To Avoid String Work In Scopes ====//
+struct PerfThreadData
+{
+    int m_Thread;
+    map< const char*, PerfStat > m_StatMap;
+    map< const char*, double > m_CountMap;
+    vector< PerfTraceEvent > m_TraceVec;
+};
+
+//==== Performance Statistics Manager ====//
+class PerfStatsSingleton
+{
+public:
+    static PerfStatsSingleton& getInstance()
+    {
+        static PerfStatsSingleton instance;
+        return instance;
+    }
+
+    void SetEnabled( bool flag )                { m_Enabled = flag; }
+    bool GetEnabled() const                     { return m_Enabled; }
+    void SetTraceFlag( bool flag )              { m_TraceFlag = flag; }
+    bool GetTraceFlag() const                   { return m_TraceFlag; }
+
+    // Not safe to call while other threads are recording.
+    void Reset();
+
+    double Now() const;
+
+    void AddTime( const char* name, double start, double end );
+    void AddCount( const char* name, double n );
+
+    // Names are keyed by pointer, so stage names built at run time are stored here first.
+    const char* StoreName( const string & name );
+
+    // Merged over threads and sorted by name.
+    void GetStats( vector< string > & name_vec, vector< PerfStat > & stat_vec ) const;
+    void GetCounts( vector< string > & name_vec, vector< double > & count_vec ) const;
+
+    bool WriteTrace( const string & file_name ) const;
+
+private:
+    PerfStatsSingleton();
+    ~PerfStatsSingleton();
+    PerfStatsSingleton( PerfStatsSingleton const& copy );          // Not Implemented
+    PerfStatsSingleton& operator=( PerfStatsSingleton const& copy ); // Not Implemented
+
+    PerfThreadData* GetThreadData();
+
+    bool m_Enabled;
+    bool m_TraceFlag;
+    double m_StartTime;
+    string m_TraceFileName;
+    set< string > m_NameSet;
+
+    vector< PerfThreadData* > m_ThreadDataVec;
+};
+
+#define PerfStatsMgr PerfStatsSingleton::getInstance()
+
+//==== Time The Enclosing Block ====//
+class PerfScope
+{
+public:
+    PerfScope( const char* name ) : m_Name( name ), m_Start( -1.0 )
+    {
+        if ( PerfStatsMgr.GetEnabled() )
+        {
+            m_Start = PerfStatsMgr.Now();
+        }
+    }
+    ~PerfScope()
+    {
+        if ( m_Start >= 0.0 )
+        {
+            PerfStatsMgr.AddTime( m_Name, m_Start, PerfStatsMgr.Now() );
+        }
+    }
+
+private:
+    const char* m_Name;
+    double m_Start;
+};
+
+#ifndef VSP_NO_PERF_STATS
+#define PERF_SCOPE_CAT2( a, b ) a##b
+#define PERF_SCOPE_CAT( a, b ) PERF_SCOPE_CAT2( a, b )
+#define PERF_SCOPE( name ) PerfScope PERF_SCOPE_CAT( perf_scope_, __LINE__ )( name )
+#define PERF_COUNT( name, n ) if ( PerfStatsMgr.GetEnabled() ) { PerfStatsMgr.AddCount( name, n ); }
+#else
+#define PERF_SCOPE( name )
+#define PERF_COUNT( name, n )
+#endif
+
+#endif
@@ -13,6 +13,39 @@
 
 #include "PntNodeMerge.h"
 
+#include <algorithm>
+#include <cmath>
+
+//==== Voxel Cell Of A Point ====//
+struct PntCell
+{
+    long long m_I;
+    long long m_J;
+    long long m_K;
+    int m_Pnt;
+};
+
+//==== Order By Cell Then Point Index ====//
+class PntCellLess
+{
+public:
+    bool operator()( const PntCell & a, const PntCell & b ) const
+    {
+        if ( a.m_I != b.m_I )
+        {
+            return a.m_I < b.m_I;
+        }
+        if ( a.m_J != b.m_J )
+        {
+            return a.m_J < b.m_J;
+        }
+        if ( a.m_K != b.m_K )
+        {
+            return a.m_K < b.m_K;
+        }
+        return a.m_Pnt < b.m_Pnt;
+    }
+};
 
 void PntNodeCloud::AddPntNodes( const vector< vec3d > & pnts )
 {
@@ -67,28 +100,177 @@ void IndexPntNodes( PntNodeCloud & cloud, double tol )
     PNTree index( 3, cloud, KDTreeSingleIndexAdaptorParams( 10 )  );
     index.buildIndex();
 
-    //==== Find Close Point Groups ====//
+    //==== Search Blocks Of Points In Parallel - Points Grouped Earlier Are Skipped ====//
+    const int block_size = 4096;
+    int num_pnts = ( int )cloud.m_PntNodes.size();
+    vector< vector< int > > match_vec( min( num_pnts, block_size ) );
+
     int cnt = 0;
-    for ( size_t i = 0 ; i < cloud.m_PntNodes.size() ; i++ )
+    for ( int b0 = 0 ; b0 < num_pnts ; b0 += block_size )
     {
-        if ( cloud.m_PntNodes[i].m_Index == -1 )
+        int b1 = min( num_pnts, b0 + block_size );
+
+        #pragma omp parallel
         {
-            std::vector<std::pair<size_t, double> >   ret_matches;
+            // Grouping overwrites every match the same way, so results need not be sorted.
+            nanoflann::SearchParams params( 32, 0, false );
+            PNTreeResults ret_matches;
+
+            #pragma omp for schedule( dynamic, 64 )
+            for ( int i = b0 ; i < b1 ; i++ )
+            {
+                vector< int > & match = match_vec[ i - b0 ];
+                match.clear();
 
-            nanoflann::SearchParams params;
-            index.radiusSearch( &cloud.m_PntNodes[i].m_Pnt[0], tol, ret_matches, params );
+                if ( cloud.m_PntNodes[i].m_Index == -1 )
+                {
+                    ret_matches.clear();
+                    index.radiusSearch( &cloud.m_PntNodes[i].m_Pnt[0], tol, ret_matches, params );
 
-            for ( size_t j = 0 ; j < ret_matches.size() ; j++ )
+                    match.resize( ret_matches.size() );
+                    for ( size_t j = 0 ; j < ret_matches.size() ; j++ )
+                    {
+                        match[j] = ( int )ret_matches[j].first;
+                    }
+                }
+            }
+        }
+
+        //==== Find Close Point Groups ====//
+        for ( int i = b0 ; i < b1 ; i++ )
+        {
+            if ( cloud.m_PntNodes[i].m_Index == -1 )
             {
-                size_t m_ind = ret_matches[j].first;
-                cloud.m_PntNodes[ m_ind ].m_Index = i;
+                vector< int > & match = match_vec[ i - b0 ];
+                for ( size_t j = 0 ; j < match.size() ; j++ )
+                {
+                    int m_ind = match[j];
+                    cloud.m_PntNodes[ m_ind ].m_Index = i;
+                }
+                cloud.m_PntNodes[i].m_UsedIndex = cnt;
+                cnt++;
             }
-            cloud.m_PntNodes[i].m_UsedIndex = cnt;
-            cnt++;
         }
     }
     cloud.m_NumUsedPts = cnt;
 }
 
+//==== Append Points Within Tol Of Cell Entry c From The 27 Surrounding Cells ====//
+// Cells are sorted by K within each ( I, J ) column, so the three cells of a
+// column are one contiguous run.
+static void FindCellNeighbors( const PntNodeCloud & cloud, const vector< PntCell > & cells, int c, double tol, vector< int > & nbrs )
+{
+    const PntCell & pc = cells[c];
+    const double* p = &cloud.m_PntNodes[ pc.m_Pnt ].m_Pnt[0];
+
+    for ( int di = -1 ; di <= 1 ; di++ )
+    {
+        for ( int dj = -1 ; dj <= 1 ; dj++ )
+        {
+            PntCell key;
+            key.m_I = pc.m_I + di;
+            key.m_J = pc.m_J + dj;
+            key.m_K = pc.m_K - 1;
+            key.m_Pnt = -1;
+
+            vector< PntCell >::const_iterator it = lower_bound( cells.begin(), cells.end(), key, PntCellLess() );
 
+            for ( ; it != cells.end() && it->m_I == key.m_I && it->m_J == key.m_J && it->m_K <= pc.m_K + 1 ; ++it )
+            {
+                if ( cloud.kdtree_distance( p, it->m_Pnt, 3 ) < tol )
+                {
+                    nbrs.push_back( it->m_Pnt );
+                }
+            }
+        }
+    }
+}
+
+//==== Group Close Points With A Voxel Grid ====//
+// Gives the same grouping as IndexPntNodes.  As there, tol bounds the squared
+// distance, so cells are sqrt( tol ) wide and every match of a point lies in
+// its own or a neighboring cell.  Neighbors are found in parallel and only the
+// greedy grouping pass is serial.
+void HashPntNodes( PntNodeCloud & cloud, double tol )
+{
+    int num_pnts = ( int )cloud.m_PntNodes.size();
+    double h = sqrt( tol );
 
+    if ( num_pnts == 0 || !( h > 0.0 ) )
+    {
+        IndexPntNodes( cloud, tol );
+        return;
+    }
+
+    vector< PntCell > cells( num_pnts );
+
+    #pragma omp parallel for
+    for ( int i = 0 ; i < num_pnts ; i++ )
+    {
+        const vec3d & p = cloud.m_PntNodes[i].m_Pnt;
+        cells[i].m_I = ( long long )floor( p.x() / h );
+        cells[i].m_J = ( long long )floor( p.y() / h );
+        cells[i].m_K = ( long long )floor( p.z() / h );
+        cells[i].m_Pnt = i;
+    }
+
+    sort( cells.begin(), cells.end(), PntCellLess() );
+
+    //==== Neighbor Lists In Cell Order, Built Per Block Then Joined ====//
+    const int block_size = 4096;
+    int num_block = ( num_pnts + block_size - 1 ) / block_size;
+
+    vector< vector< int > > block_nbr_vec( num_block );
+    vector< int > nbr_start( num_pnts + 1, 0 );
+    vector< int > cell_of( num_pnts );
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int b = 0 ; b < num_block ; b++ )
+    {
+        int c1 = min( num_pnts, ( b + 1 ) * block_size );
+        for ( int c = b * block_size ; c < c1 ; c++ )
+        {
+            nbr_start[c] = ( int )block_nbr_vec[b].size();
+            cell_of[ cells[c].m_Pnt ] = c;
+            FindCellNeighbors( cloud, cells, c, tol, block_nbr_vec[b] );
+        }
+    }
+
+    vector< int > block_start( num_block + 1, 0 );
+    for ( int b = 0 ; b < num_block ; b++ )
+    {
+        block_start[b + 1] = block_start[b] + ( int )block_nbr_vec[b].size();
+    }
+
+    vector< int > nbr_vec( block_start[ num_block ] );
+    nbr_start[ num_pnts ] = block_start[ num_block ];
+
+    #pragma omp parallel for schedule( dynamic )
+    for ( int b = 0 ; b < num_block ; b++ )
+    {
+        int c1 = min( num_pnts, ( b + 1 ) * block_size );
+        for ( int c = b * block_size ; c < c1 ; c++ )
+        {
+            nbr_start[c] += block_start[b];
+        }
+        std::copy( block_nbr_vec[b].begin(), block_nbr_vec[b].end(), nbr_vec.begin() + block_start[b] );
+        vector< int >().swap( block_nbr_vec[b] );
+    }
+
+    //==== Find Close Point Groups ====//
+    int cnt = 0;
+    for ( int i = 0 ; i < num_pnts ; i++ )
+    {
+        if ( cloud.m_PntNodes[i].m_Index == -1 )
+        {
+            int c = cell_of[i];
+            for ( int j = nbr_start[c] ; j < nbr_start[c + 1] ; j++ )
+            {
+                cloud.m_PntNodes[ nbr_vec[j] ].m_Index = i;
+            }
+            cloud.m_PntNodes[i].m_UsedIndex = cnt;
+            cnt++;
+        }
+    }
+    cloud.m_NumUsedPts = cnt;
+}
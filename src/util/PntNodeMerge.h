@@ -118,5 +118,6 @@ struct PntNodeCloud
 };
 
 void IndexPntNodes( PntNodeCloud & cloud, double tol );
+void HashPntNodes( PntNodeCloud & cloud, double tol );
 
 #endif
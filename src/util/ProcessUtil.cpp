@@ -4,22 +4,33 @@
 //
 
 #include "ProcessUtil.h"
+#include "ThreadMgr.h"
 
 #include <cstdlib>
+#include <cstdio>
+#include <map>
 
 #ifdef __APPLE__
 
 #endif
 
 #ifdef WIN32
-
+#include <direct.h>
+#include <psapi.h>
+#ifdef _MSC_VER
+#pragma comment( lib, "psapi.lib" )
+#endif
 #else
+#include <sys/time.h>
+#include <sys/resource.h>
 #include <sys/wait.h>
 #include <sys/types.h>
 #include <unistd.h>
 
 #include <fcntl.h>
 #include <csignal>
+#include <sys/ioctl.h>
+#include <poll.h>
 #endif
 
 
@@ -32,6 +43,70 @@ void SleepForMilliseconds( unsigned int sleep_time)
 #endif
 }
 
+double GetWallTime()
+{
+#ifdef WIN32
+    LARGE_INTEGER freq, count;
+    QueryPerformanceFrequency( &freq );
+    QueryPerformanceCounter( &count );
+    return ( double )count.QuadPart / ( double )freq.QuadPart;
+#else
+    struct timeval tv;
+    gettimeofday( &tv, NULL );
+    return ( double )tv.tv_sec + 1.0e-6 * ( double )tv.tv_usec;
+#endif
+}
+
+double GetProcessCPUTime()
+{
+#ifdef WIN32
+    FILETIME create_time, exit_time, kernel_time, user_time;
+    if ( GetProcessTimes( GetCurrentProcess(), &create_time, &exit_time, &kernel_time, &user_time ) )
+    {
+        ULARGE_INTEGER k, u;
+        k.LowPart = kernel_time.dwLowDateTime;
+        k.HighPart = kernel_time.dwHighDateTime;
+        u.LowPart = user_time.dwLowDateTime;
+        u.HighPart = user_time.dwHighDateTime;
+
+        // FILETIME counts 100 ns ticks
+        return 1.0e-7 * ( double )( k.QuadPart + u.QuadPart );
+    }
+    return 0.0;
+#else
+    struct rusage usage;
+    if ( getrusage( RUSAGE_SELF, &usage ) == 0 )
+    {
+        return ( double )( usage.ru_utime.tv_sec + usage.ru_stime.tv_sec ) +
+               1.0e-6 * ( double )( usage.ru_utime.tv_usec + usage.ru_stime.tv_usec );
+    }
+    return 0.0;
+#endif
+}
+
+double GetPeakMemoryMB()
+{
+#ifdef WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if ( GetProcessMemoryInfo( GetCurrentProcess(), &pmc, sizeof( pmc ) ) )
+    {
+        return ( double )pmc.PeakWorkingSetSize / ( 1024.0 * 1024.0 );
+    }
+    return 0.0;
+#else
+    struct rusage usage;
+    if ( getrusage( RUSAGE_SELF, &usage ) == 0 )
+    {
+#ifdef __APPLE__
+        return ( double )usage.ru_maxrss / ( 1024.0 * 1024.0 );  // Bytes
+#else
+        return ( double )usage.ru_maxrss / 1024.0;               // Kilobytes
+#endif
+    }
+    return 0.0;
+#endif
+}
+
 ProcessUtil::ProcessUtil()
 {
 #ifdef WIN32
@@ -343,10 +418,30 @@ bool ProcessUtil::IsRunning()
     return true;
 }
 
+//==== Started Threads Adopt The Process Thread Budget Before Running ====//
 #ifdef WIN32
+struct ThreadStart
+{
+    LPTHREAD_START_ROUTINE m_Fun;
+    LPVOID m_Data;
+};
+
+static DWORD WINAPI ThreadStartFun( LPVOID data )
+{
+    ThreadStart start = *( ThreadStart* ) data;
+    delete ( ThreadStart* ) data;
+
+    ThreadMgr.ApplyToThread();
+    return start.m_Fun( start.m_Data );
+}
+
 void ProcessUtil::StartThread( LPTHREAD_START_ROUTINE threadfun, LPVOID data )
 {
-    HANDLE m_Handle = CreateThread( 0, 0, threadfun, data, 0, &m_ThreadID );
+    ThreadStart* start = new ThreadStart;
+    start->m_Fun = threadfun;
+    start->m_Data = data;
+
+    HANDLE m_Handle = CreateThread( 0, 0, ThreadStartFun, start, 0, &m_ThreadID );
 
     if(m_Handle==NULL)
     {
@@ -355,8 +450,27 @@ void ProcessUtil::StartThread( LPTHREAD_START_ROUTINE threadfun, LPVOID data )
     }
 }
 #else
+struct ThreadStart
+{
+    void *(*m_Fun)( void * );
+    void *m_Data;
+};
+
+static void* ThreadStartFun( void *data )
+{
+    ThreadStart start = *( ThreadStart* ) data;
+    delete ( ThreadStart* ) data;
+
+    ThreadMgr.ApplyToThread();
+    return start.m_Fun( start.m_Data );
+}
+
 void ProcessUtil::StartThread( void *(*threadfun)( void *data ), void *data )
 {
+    ThreadStart* start = new ThreadStart;
+    start->m_Fun = threadfun;
+    start->m_Data = data;
+
 // Example code for setting thread stack size.
 //    pthread_attr_t thread_attr;
 //    size_t tmp_size=0;
@@ -365,7 +479,7 @@ void ProcessUtil::StartThread( void *(*threadfun)( void *data ), void *data )
 //    pthread_attr_getstacksize( &thread_attr , &tmp_size );
 //    pthread_create( &m_Thread, &thread_attr, threadfun, data );
 
-    pthread_create( &m_Thread, NULL, threadfun, data );
+    pthread_create( &m_Thread, NULL, ThreadStartFun, start );
 
     //TODO return thread creation success/failure
 }
@@ -381,6 +495,58 @@ void ProcessUtil::ReadStdoutPipe(char * bufptr, int bufsize, unsigned long * nre
 #endif
 }
 
+// Number of bytes waiting in the child stdout pipe.  Lets one thread drain several
+// children without blocking on an idle pipe (ReadFile blocks on Windows).
+unsigned long ProcessUtil::StdoutPipeBytesAvailable()
+{
+#ifdef WIN32
+    DWORD navail = 0;
+    if ( !PeekNamedPipe( m_StdoutPipe[PIPE_READ], NULL, 0, NULL, &navail, NULL ) )
+    {
+        return 0;
+    }
+    return navail;
+#else
+    int navail = 0;
+    if ( ioctl( m_StdoutPipe[PIPE_READ], FIONREAD, &navail ) < 0 )
+    {
+        return 0;
+    }
+    return navail;
+#endif
+}
+
+// Block until the child writes to stdout, closes its end of the pipe, or exits.
+// Returns false when timeout (milliseconds) passes with nothing to read.
+bool ProcessUtil::WaitForStdout( unsigned int timeout )
+{
+#ifdef WIN32
+    DWORD start = GetTickCount();
+    while ( true )
+    {
+        if ( StdoutPipeBytesAvailable() > 0 )
+        {
+            return true;
+        }
+        if ( pi.dwProcessId == 0 || WaitForSingleObject( pi.hProcess, 1 ) == WAIT_OBJECT_0 )
+        {
+            return true;
+        }
+        if ( GetTickCount() - start >= timeout )
+        {
+            return false;
+        }
+    }
+#else
+    struct pollfd pfd;
+    pfd.fd = m_StdoutPipe[PIPE_READ];
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+
+    return poll( &pfd, 1, timeout ) > 0;
+#endif
+}
+
 /* PrettyCmd( path, cmd, opts )
     Returns a command string that could be used on the command line
 */
@@ -405,3 +571,336 @@ string ProcessUtil::PrettyCmd( const string &path, const string &cmd, const vect
 
     return command;
 }
+
+//==== Execution Backends ====//
+ExecBackend* ExecBackend::Create( const string &spec )
+{
+    size_t colon = spec.find( ':' );
+    string type = spec.substr( 0, colon );
+    string rest = ( colon == string::npos ) ? string() : spec.substr( colon + 1 );
+
+    if ( type == "ssh" )
+    {
+        vector< string > host_vec;
+        size_t start = 0;
+        while ( start <= rest.size() )
+        {
+            size_t comma = rest.find( ',', start );
+            if ( comma == string::npos )
+            {
+                comma = rest.size();
+            }
+            string host = rest.substr( start, comma - start );
+            if ( !host.empty() )
+            {
+                host_vec.push_back( host );
+            }
+            start = comma + 1;
+        }
+
+        if ( !host_vec.empty() )
+        {
+            return new SSHExecBackend( host_vec );
+        }
+    }
+    else if ( type == "batch" )
+    {
+        size_t colon2 = rest.find( ':' );
+        int njob = atoi( rest.substr( 0, colon2 ).c_str() );
+        if ( njob > 0 && colon2 != string::npos && colon2 + 1 < rest.size() )
+        {
+            return new BatchExecBackend( njob, rest.substr( colon2 + 1 ) );
+        }
+    }
+
+    if ( !spec.empty() && type != "local" )
+    {
+        printf( "Unknown execution backend '%s', running locally\n", spec.c_str() );
+    }
+    return new LocalExecBackend();
+}
+
+ExecBackend* ExecBackend::CreateFromEnv()
+{
+    const char* spec = getenv( "VSP_EXEC_BACKEND" );
+    return Create( spec ? string( spec ) : string() );
+}
+
+/* ShellQuote( str )
+    Quotes a word for a POSIX shell, used for commands run on remote hosts
+*/
+string ExecBackend::ShellQuote( const string &str )
+{
+    string qstr = "'";
+    for ( size_t i = 0; i < str.size(); i++ )
+    {
+        if ( str[i] == '\'' )
+        {
+            qstr += "'\\''";
+        }
+        else
+        {
+            qstr.push_back( str[i] );
+        }
+    }
+    qstr += "'";
+    return qstr;
+}
+
+/* ShellCmd( exe, opts )
+    Command line for the local shell started by ForkShell and RunShell
+*/
+string ExecBackend::ShellCmd( const string &exe, const vector<string> &opts )
+{
+#ifdef WIN32
+    string command = ProcessUtil::QuoteString( exe );
+    for( int i = 0; i < opts.size(); i++ )
+    {
+        command += string(" ") + ProcessUtil::QuoteString( opts[i] );
+    }
+#else
+    string command = ShellQuote( exe );
+    for( unsigned int i = 0; i < opts.size(); i++ )
+    {
+        command += string(" ") + ShellQuote( opts[i] );
+    }
+#endif
+    return command;
+}
+
+string ExecBackend::JoinPath( const string &path, const string &cmd )
+{
+#ifdef WIN32
+    return path + string("\\") + cmd;
+#else
+    return path + string("/") + cmd;
+#endif
+}
+
+string ExecBackend::AbsolutePath( const string &file )
+{
+    char buf[4096];
+#ifdef WIN32
+    if ( ( file.size() > 1 && file[1] == ':' ) || ( file.size() > 0 && ( file[0] == '\\' || file[0] == '/' ) ) )
+    {
+        return file;
+    }
+    if ( !_getcwd( buf, sizeof( buf ) ) )
+    {
+        return file;
+    }
+    return string( buf ) + string( "\\" ) + file;
+#else
+    if ( file.size() > 0 && file[0] == '/' )
+    {
+        return file;
+    }
+    if ( !getcwd( buf, sizeof( buf ) ) )
+    {
+        return file;
+    }
+    return string( buf ) + string( "/" ) + file;
+#endif
+}
+
+/* ForkShell( proc, command )
+    Starts command through the local shell as a child of proc.  On POSIX the shell execs
+    the command so that ProcessUtil::Kill signals the launcher itself.
+*/
+int ExecBackend::ForkShell( ProcessUtil &proc, const string &command )
+{
+    vector< string > opts;
+#ifdef WIN32
+    const char* sysroot = getenv( "SystemRoot" );
+    opts.push_back( "/S" );
+    opts.push_back( "/C" );
+    opts.push_back( command );
+    return proc.ForkCmd( string( sysroot ? sysroot : "C:\\Windows" ) + string( "\\System32" ), "cmd.exe", opts );
+#else
+    opts.push_back( "-c" );
+    opts.push_back( string( "exec " ) + command );
+    return proc.ForkCmd( "/bin", "sh", opts );
+#endif
+}
+
+/* RunShell( command )
+    Runs command through the local shell and waits for it, returns its exit status
+*/
+int ExecBackend::RunShell( const string &command )
+{
+    return system( command.c_str() );
+}
+
+//==== Local Child Process ====//
+int LocalExecBackend::Launch( int slot, ProcessUtil &proc, const string &path, const string &cmd, const vector<string> &opts )
+{
+    return proc.ForkCmd( path, cmd, opts );
+}
+
+string LocalExecBackend::PrettyCmd( int slot, const string &path, const string &cmd, const vector<string> &opts )
+{
+    return ProcessUtil::PrettyCmd( path, cmd, opts );
+}
+
+//==== Remote Hosts Over SSH ====//
+SSHExecBackend::SSHExecBackend( const vector< string > &host_vec ) : ExecBackend()
+{
+    m_HostVec = host_vec;
+
+    const char* remote_path = getenv( "VSP_EXEC_REMOTE_PATH" );
+    if ( remote_path )
+    {
+        m_RemotePath = remote_path;
+    }
+}
+
+// Group absolute file paths by directory so each directory takes one scp
+static std::map< string, vector< string > > GroupByDirectory( const vector< string > &files )
+{
+    std::map< string, vector< string > > dir_map;
+    for ( size_t i = 0; i < files.size(); i++ )
+    {
+        size_t slash = files[i].find_last_of( "/\\" );
+        string dir = ( slash == string::npos ) ? string( "." ) : files[i].substr( 0, slash );
+        dir_map[ dir ].push_back( files[i] );
+    }
+    return dir_map;
+}
+
+bool SSHExecBackend::StageIn( int slot, const vector< string > &files )
+{
+    const string &host = GetHost( slot );
+
+    vector< string > abs_files;
+    for ( size_t i = 0; i < files.size(); i++ )
+    {
+        abs_files.push_back( AbsolutePath( files[i] ) );
+    }
+    std::map< string, vector< string > > dir_map = GroupByDirectory( abs_files );
+
+    string mkdir_cmd = "mkdir -p";
+    std::map< string, vector< string > >::iterator it;
+    for ( it = dir_map.begin(); it != dir_map.end(); ++it )
+    {
+        mkdir_cmd += string( " " ) + ShellQuote( it->first );
+    }
+
+    vector< string > opts;
+    opts.push_back( "-o" );
+    opts.push_back( "BatchMode=yes" );
+    opts.push_back( host );
+    opts.push_back( mkdir_cmd );
+    if ( RunShell( ShellCmd( "ssh", opts ) ) != 0 )
+    {
+        return false;
+    }
+
+    for ( it = dir_map.begin(); it != dir_map.end(); ++it )
+    {
+        opts.clear();
+        opts.push_back( "-q" );
+        opts.push_back( "-o" );
+        opts.push_back( "BatchMode=yes" );
+        opts.insert( opts.end(), it->second.begin(), it->second.end() );
+        opts.push_back( host + string( ":" ) + it->first + string( "/" ) );
+        if ( RunShell( ShellCmd( "scp", opts ) ) != 0 )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SSHExecBackend::StageOut( int slot, const vector< string > &files )
+{
+    const string &host = GetHost( slot );
+
+    vector< string > abs_files;
+    for ( size_t i = 0; i < files.size(); i++ )
+    {
+        abs_files.push_back( AbsolutePath( files[i] ) );
+    }
+    std::map< string, vector< string > > dir_map = GroupByDirectory( abs_files );
+
+    // scp copies the files that exist and reports the rest, so the status is not checked
+    std::map< string, vector< string > >::iterator it;
+    for ( it = dir_map.begin(); it != dir_map.end(); ++it )
+    {
+        vector< string > opts;
+        opts.push_back( "-q" );
+        opts.push_back( "-o" );
+        opts.push_back( "BatchMode=yes" );
+        for ( size_t i = 0; i < it->second.size(); i++ )
+        {
+            opts.push_back( host + string( ":" ) + it->second[i] );
+        }
+        opts.push_back( it->first );
+        RunShell( ShellCmd( "scp", opts ) );
+    }
+    return true;
+}
+
+void SSHExecBackend::Cleanup( int slot, const vector< string > &files )
+{
+    string rm_cmd = "rm -f";
+    for ( size_t i = 0; i < files.size(); i++ )
+    {
+        rm_cmd += string( " " ) + ShellQuote( AbsolutePath( files[i] ) );
+    }
+
+    vector< string > opts;
+    opts.push_back( "-o" );
+    opts.push_back( "BatchMode=yes" );
+    opts.push_back( GetHost( slot ) );
+    opts.push_back( rm_cmd );
+    RunShell( ShellCmd( "ssh", opts ) );
+}
+
+/* RemoteCmd( slot, path, cmd, opts )
+    ssh command line that runs the solver on the slot's host from the current directory.
+    A forced pseudo terminal makes the remote solver exit when the local ssh is killed.
+*/
+string SSHExecBackend::RemoteCmd( int slot, const string &path, const string &cmd, const vector<string> &opts )
+{
+    string remote = string( "cd " ) + ShellQuote( AbsolutePath( "." ) ) + string( " && " );
+    remote += ShellQuote( ( m_RemotePath.empty() ? path : m_RemotePath ) + string( "/" ) + cmd );
+    for ( size_t i = 0; i < opts.size(); i++ )
+    {
+        remote += string( " " ) + ShellQuote( opts[i] );
+    }
+
+    vector< string > ssh_opts;
+    ssh_opts.push_back( "-tt" );
+    ssh_opts.push_back( "-o" );
+    ssh_opts.push_back( "BatchMode=yes" );
+    ssh_opts.push_back( GetHost( slot ) );
+    ssh_opts.push_back( remote );
+    return ShellCmd( "ssh", ssh_opts );
+}
+
+int SSHExecBackend::Launch( int slot, ProcessUtil &proc, const string &path, const string &cmd, const vector<string> &opts )
+{
+    return ForkShell( proc, RemoteCmd( slot, path, cmd, opts ) );
+}
+
+string SSHExecBackend::PrettyCmd( int slot, const string &path, const string &cmd, const vector<string> &opts )
+{
+    return RemoteCmd( slot, path, cmd, opts ) + string( "\n" );
+}
+
+//==== Scheduler Launcher ====//
+BatchExecBackend::BatchExecBackend( int njob, const string &launch_cmd ) : ExecBackend()
+{
+    m_NumJob = njob;
+    m_LaunchCmd = launch_cmd;
+}
+
+int BatchExecBackend::Launch( int slot, ProcessUtil &proc, const string &path, const string &cmd, const vector<string> &opts )
+{
+    return ForkShell( proc, m_LaunchCmd + string( " " ) + ShellCmd( JoinPath( path, cmd ), opts ) );
+}
+
+string BatchExecBackend::PrettyCmd( int slot, const string &path, const string &cmd, const vector<string> &opts )
+{
+    return m_LaunchCmd + string( " " ) + ShellCmd( JoinPath( path, cmd ), opts ) + string( "\n" );
+}
@@ -24,6 +24,10 @@ using std::vector;
 
 void SleepForMilliseconds( unsigned int sleep_time);
 
+double GetWallTime();           // Seconds from an arbitrary start, for timing intervals
+double GetProcessCPUTime();     // User + system seconds summed over every thread of this process
+double GetPeakMemoryMB();       // Peak resident memory of this process, 0 where unavailable
+
 class ProcessUtil
 {
 public:
@@ -40,6 +44,8 @@ public:
     bool IsRunning();
 
     void ReadStdoutPipe(char * buf, int bufsize, unsigned long * nread );
+    unsigned long StdoutPipeBytesAvailable();
+    bool WaitForStdout( unsigned int timeout );
 
     static string PrettyCmd( const string &path, const string &cmd, const vector<string> &opts ); //returns a command string that could be used on the command line
 
@@ -69,5 +75,107 @@ private:
 
 };
 
+//==== Where An External Solver Runs ====//
+// Every backend starts a local child process (the solver itself, ssh or a
+// scheduler launcher), so output monitoring and Kill go through ProcessUtil.
+// Slots are independent jobs that may run at the same time, e.g. one per host.
+class ExecBackend
+{
+public:
+
+    ExecBackend()                                       {}
+    virtual ~ExecBackend()                              {}
+
+    virtual bool IsLocal() const                        { return false; }
+    virtual int GetNumSlots() const = 0;
+    virtual string GetName() const = 0;
+
+    // Copy inputs to, and outputs back from, the slot's host.  Missing outputs are skipped.
+    virtual bool StageIn( int slot, const vector< string > &files )     { return true; }
+    virtual bool StageOut( int slot, const vector< string > &files )    { return true; }
+    virtual void Cleanup( int slot, const vector< string > &files )     {}
+
+    virtual int Launch( int slot, ProcessUtil &proc, const string &path, const string &cmd, const vector<string> &opts ) = 0;
+    virtual string PrettyCmd( int slot, const string &path, const string &cmd, const vector<string> &opts ) = 0;
+
+    // Spec is "local", "ssh:host1,host2,..." or "batch:<njob>:<launch command>",
+    // e.g. "batch:16:srun -N 1 -n 1".  Returns a local backend for an empty or bad spec.
+    static ExecBackend* Create( const string &spec );
+
+    // Spec from the VSP_EXEC_BACKEND environment variable.
+    static ExecBackend* CreateFromEnv();
+
+protected:
+
+    static string ShellQuote( const string &str );
+    static string ShellCmd( const string &exe, const vector<string> &opts );
+    static string JoinPath( const string &path, const string &cmd );
+    static string AbsolutePath( const string &file );
+    static int ForkShell( ProcessUtil &proc, const string &command );
+    static int RunShell( const string &command );
+};
+
+//==== Run As A Local Child Process ====//
+class LocalExecBackend : public ExecBackend
+{
+public:
+
+    virtual bool IsLocal() const                        { return true; }
+    virtual int GetNumSlots() const                     { return 1; }
+    virtual string GetName() const                      { return string( "local" ); }
+
+    virtual int Launch( int slot, ProcessUtil &proc, const string &path, const string &cmd, const vector<string> &opts );
+    virtual string PrettyCmd( int slot, const string &path, const string &cmd, const vector<string> &opts );
+};
+
+//==== Run On Remote Hosts Over SSH, One Slot Per Host ====//
+// Files are copied with scp to the same absolute path on the remote host.  The
+// solver is expected at the local path, or in VSP_EXEC_REMOTE_PATH when set.
+class SSHExecBackend : public ExecBackend
+{
+public:
+
+    SSHExecBackend( const vector< string > &host_vec );
+
+    virtual int GetNumSlots() const                     { return ( int )m_HostVec.size(); }
+    virtual string GetName() const                      { return string( "ssh" ); }
+
+    virtual bool StageIn( int slot, const vector< string > &files );
+    virtual bool StageOut( int slot, const vector< string > &files );
+    virtual void Cleanup( int slot, const vector< string > &files );
+
+    virtual int Launch( int slot, ProcessUtil &proc, const string &path, const string &cmd, const vector<string> &opts );
+    virtual string PrettyCmd( int slot, const string &path, const string &cmd, const vector<string> &opts );
+
+protected:
+
+    const string & GetHost( int slot ) const            { return m_HostVec[ slot % m_HostVec.size() ]; }
+    string RemoteCmd( int slot, const string &path, const string &cmd, const vector<string> &opts );
+
+    vector< string > m_HostVec;
+    string m_RemotePath;
+};
+
+//==== Run Through A Blocking Scheduler Launcher Such As srun ====//
+// The launcher must stay in the foreground for the life of the job and forward
+// its output.  A shared file system is assumed, so nothing is staged.
+class BatchExecBackend : public ExecBackend
+{
+public:
+
+    BatchExecBackend( int njob, const string &launch_cmd );
+
+    virtual int GetNumSlots() const                     { return m_NumJob; }
+    virtual string GetName() const                      { return string( "batch" ); }
+
+    virtual int Launch( int slot, ProcessUtil &proc, const string &path, const string &cmd, const vector<string> &opts );
+    virtual string PrettyCmd( int slot, const string &path, const string &cmd, const vector<string> &opts );
+
+protected:
+
+    int m_NumJob;
+    string m_LaunchCmd;
+};
+
 #endif
 
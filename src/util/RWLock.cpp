@@ -0,0 +1,95 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// RWLock.cpp: Reader-writer lock for state read by other threads during updates.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "RWLock.h"
+
+//==== Address Unique To The Calling Thread ====//
+static const void* CurrentThreadToken()
+{
+    static thread_local char token;
+    return &token;
+}
+
+RWLock::RWLock()
+{
+    m_NumReaders = 0;
+    m_WriteDepth = 0;
+    m_WriterID = NULL;
+}
+
+bool RWLock::IsWriter() const
+{
+    return m_WriteDepth > 0 && m_WriterID == CurrentThreadToken();
+}
+
+//==== Shared Access, Nested Inside The Writer's Own Lock ====//
+void RWLock::LockRead()
+{
+    std::unique_lock< std::mutex > lock( m_Mutex );
+
+    if ( IsWriter() )
+    {
+        m_WriteDepth++;
+        return;
+    }
+
+    while ( m_WriteDepth > 0 )
+    {
+        m_Cond.wait( lock );
+    }
+    m_NumReaders++;
+}
+
+void RWLock::UnlockRead()
+{
+    std::unique_lock< std::mutex > lock( m_Mutex );
+
+    if ( IsWriter() )
+    {
+        m_WriteDepth--;
+        return;
+    }
+
+    m_NumReaders--;
+    if ( m_NumReaders == 0 )
+    {
+        m_Cond.notify_all();
+    }
+}
+
+//==== Exclusive Access ====//
+void RWLock::LockWrite()
+{
+    std::unique_lock< std::mutex > lock( m_Mutex );
+
+    if ( IsWriter() )
+    {
+        m_WriteDepth++;
+        return;
+    }
+
+    while ( m_WriteDepth > 0 || m_NumReaders > 0 )
+    {
+        m_Cond.wait( lock );
+    }
+    m_WriterID = CurrentThreadToken();
+    m_WriteDepth = 1;
+}
+
+void RWLock::UnlockWrite()
+{
+    std::unique_lock< std::mutex > lock( m_Mutex );
+
+    m_WriteDepth--;
+    if ( m_WriteDepth == 0 )
+    {
+        m_WriterID = NULL;
+        m_Cond.notify_all();
+    }
+}
@@ -0,0 +1,96 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// RWLock.h: Reader-writer lock for state read by other threads during updates.
+//
+// Any number of readers may hold the lock together, a writer holds it alone.
+// The writing thread may take the lock again, for reading or writing, so an
+// update that reads back its own state does not block itself.  Readers are
+// not held back by waiting writers, so nested reads cannot deadlock; a thread
+// holding a read lock must not ask for the write lock.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(VSP_RW_LOCK__INCLUDED_)
+#define VSP_RW_LOCK__INCLUDED_
+
+#include <mutex>
+#include <condition_variable>
+
+class RWLock
+{
+public:
+    RWLock();
+
+    void LockRead();
+    void UnlockRead();
+    void LockWrite();
+    void UnlockWrite();
+
+private:
+    RWLock( RWLock const& copy );                   // Not Implemented
+    RWLock& operator=( RWLock const& copy );        // Not Implemented
+
+    bool IsWriter() const;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_Cond;
+    int m_NumReaders;
+    int m_WriteDepth;                               // Nested Locks Held By The Writer
+    const void* m_WriterID;                         // Token Of The Writing Thread
+};
+
+//==== Scoped Locks, A NULL Lock Is Skipped ====//
+class ReadLockGuard
+{
+public:
+    ReadLockGuard( RWLock* lock ) : m_Lock( lock )
+    {
+        if ( m_Lock )
+        {
+            m_Lock->LockRead();
+        }
+    }
+    ~ReadLockGuard()
+    {
+        if ( m_Lock )
+        {
+            m_Lock->UnlockRead();
+        }
+    }
+
+private:
+    ReadLockGuard( ReadLockGuard const& copy );                 // Not Implemented
+    ReadLockGuard& operator=( ReadLockGuard const& copy );      // Not Implemented
+
+    RWLock* m_Lock;
+};
+
+class WriteLockGuard
+{
+public:
+    WriteLockGuard( RWLock* lock ) : m_Lock( lock )
+    {
+        if ( m_Lock )
+        {
+            m_Lock->LockWrite();
+        }
+    }
+    ~WriteLockGuard()
+    {
+        if ( m_Lock )
+        {
+            m_Lock->UnlockWrite();
+        }
+    }
+
+private:
+    WriteLockGuard( WriteLockGuard const& copy );               // Not Implemented
+    WriteLockGuard& operator=( WriteLockGuard const& copy );    // Not Implemented
+
+    RWLock* m_Lock;
+};
+
+#endif
@@ -117,6 +117,24 @@ T Clamp( const T& value, const T& low, const T& high )
 //=== Return Index to Closest Element in Vector
 int ClosestElement( const vector< double > & vec, double const & val );
 
+//==== Approximate Heap Bytes Held By A Vector And Any Nested Vectors ====//
+template < class T >
+size_t vector_mem_bytes( const vector< T > & vec )
+{
+    return vec.capacity() * sizeof( T );
+}
+
+template < class T >
+size_t vector_mem_bytes( const vector< vector< T > > & vec )
+{
+    size_t bytes = vec.capacity() * sizeof( vector< T > );
+    for ( int i = 0 ; i < ( int )vec.size() ; i++ )
+    {
+        bytes += vector_mem_bytes( vec[i] );
+    }
+    return bytes;
+}
+
 // Return int with sign of passed val.
 template < typename T >
 int sgn( T val )
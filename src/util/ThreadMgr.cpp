@@ -0,0 +1,54 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// ThreadMgr.cpp: Process wide thread budget for every parallel code path.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "ThreadMgr.h"
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <thread>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+//==== Constructor ====//
+ThreadMgrSingleton::ThreadMgrSingleton()
+{
+#ifdef _OPENMP
+    m_DefaultNumThreads = omp_get_max_threads();
+#else
+    m_DefaultNumThreads = std::max( 1, ( int )std::thread::hardware_concurrency() );
+#endif
+    m_NumThreads = m_DefaultNumThreads;
+
+    const char* num_env = getenv( "VSP_NUM_THREADS" );
+    if ( num_env && atoi( num_env ) > 0 )
+    {
+        SetNumThreads( atoi( num_env ) );
+    }
+}
+
+void ThreadMgrSingleton::SetNumThreads( int num )
+{
+    m_NumThreads = ( num < 1 ) ? m_DefaultNumThreads : num;
+    ApplyToThread();
+}
+
+void ThreadMgrSingleton::ApplyToThread() const
+{
+#ifdef _OPENMP
+    omp_set_num_threads( m_NumThreads );
+#endif
+}
+
+int ThreadMgrSingleton::LimitThreads( int num ) const
+{
+    return std::max( 1, std::min( num, ( int )m_NumThreads ) );
+}
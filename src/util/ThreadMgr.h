@@ -0,0 +1,58 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// ThreadMgr.h: Process wide thread budget for every parallel code path.
+//
+// The parallel loops of geom_core, cfd_mesh and the exporters all run on the
+// OpenMP runtime, whose single thread pool and dynamic scheduling are shared
+// by the whole process.  ThreadMgr holds the number of threads that pool may
+// use, so one setting bounds every parallel stage.  External solvers such as
+// VSPAERO are given at most the same number of threads.
+//
+// The VSP_NUM_THREADS environment variable sets the budget at startup,
+// otherwise the OpenMP default (OMP_NUM_THREADS or the number of cores) is
+// used.  OpenMP keeps the thread count per thread, so threads started through
+// ProcessUtil::StartThread adopt the budget before they run; other threads
+// call ApplyToThread.
+//
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(VSP_THREAD_MGR__INCLUDED_)
+#define VSP_THREAD_MGR__INCLUDED_
+
+#include <atomic>
+
+class ThreadMgrSingleton
+{
+public:
+    static ThreadMgrSingleton& getInstance()
+    {
+        static ThreadMgrSingleton instance;
+        return instance;
+    }
+
+    // Applies to the calling thread at once and to threads started afterward.  < 1 restores the default.
+    void SetNumThreads( int num );
+    int GetNumThreads() const                   { return m_NumThreads; }
+    int GetDefaultNumThreads() const            { return m_DefaultNumThreads; }
+
+    // Use the budget for parallel regions started by the calling thread.
+    void ApplyToThread() const;
+
+    // Thread count to hand a solver that asked for num, at least one.
+    int LimitThreads( int num ) const;
+
+private:
+    ThreadMgrSingleton();
+    ThreadMgrSingleton( ThreadMgrSingleton const& copy );          // Not Implemented
+    ThreadMgrSingleton& operator=( ThreadMgrSingleton const& copy ); // Not Implemented
+
+    std::atomic< int > m_NumThreads;
+    int m_DefaultNumThreads;
+};
+
+#define ThreadMgr ThreadMgrSingleton::getInstance()
+
+#endif
@@ -9,17 +9,22 @@
 //==== Generate A Unique Random String of Length =====//
 string GenerateRandomID( int length )
 {
-    static bool seed = false;
-    if ( !seed )
-    {
-        seed = true;
-        srand( ( unsigned int )time( NULL ) );
-    }
+    char str[256];
 
-    static char str[256];
-    for ( int i = 0 ; i < length ; i++ )
+    // Parms may be created while Geoms update concurrently, so the shared rand() state is serialized.
+    #pragma omp critical ( RandomID )
     {
-        str[i] = ( char )( ( rand() % 26 ) + 65 );
+        static bool seed = false;
+        if ( !seed )
+        {
+            seed = true;
+            srand( ( unsigned int )time( NULL ) );
+        }
+
+        for ( int i = 0 ; i < length ; i++ )
+        {
+            str[i] = ( char )( ( rand() % 26 ) + 65 );
+        }
     }
     return string( str, length );
 }
@@ -129,3 +134,13 @@ double linterp( double a, double b, double frac )
 {
     return a + frac * ( b - a );
 }
+
+unsigned long long HashBytes( unsigned long long h, const void* ptr, size_t size )
+{
+    const unsigned char* c = ( const unsigned char* )ptr;
+    for ( size_t i = 0 ; i < size ; i++ )
+    {
+        h = ( h ^ ( unsigned long long )c[i] ) * 1099511628211ULL;
+    }
+    return h;
+}
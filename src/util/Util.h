@@ -49,6 +49,10 @@ vector <double> logspace( double a, double b, double n);
 
 double linterp( double a, double b, double frac );
 
+//==== FNV-1a Hash Of A Block Of Bytes, Chain Blocks By Passing The Previous Hash ====//
+const unsigned long long HASH_SEED = 14695981039346656037ULL;
+unsigned long long HashBytes( unsigned long long h, const void* ptr, size_t size );
+
 template <typename T> T clamp( T val, T min, T max )
 {
     if ( val < min )
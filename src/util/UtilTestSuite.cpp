@@ -5,6 +5,9 @@
 //
 //////////////////////////////////////////////////////////////////////
 
+// Ahead of the STEP headers, whose nullptr macro <thread> cannot parse
+#include <thread>
+
 #include "UtilTestSuite.h"
 
 #include <float.h>
@@ -127,6 +130,51 @@ void UtilTestSuite::MessageMgrTest()
     //==== Send A String Message To Base5.  Base5 was simultaneously named & registered ====//
     MessageMgr::getInstance().Send( "Base5", "Sent_Message5" );
     TEST_ASSERT( mbt5.m_Data.m_String.compare( "Sent_Message5" ) == 0 );
+
+    //==== Queued Delivery Of Messages Sent From A Worker Thread ====//
+    MessageBaseTest mbtQ;
+    mbtQ.Register( "BaseQ" );
+    mbtQ.SetQueuedDelivery( true );         // This Thread Owns The Queue
+    MessageBaseTest mbtQLost;
+    mbtQLost.Register( "BaseQLost" );
+    mbtQLost.SetQueuedDelivery( true );
+    MessageBaseTest mbtQSender;
+    mbtQSender.Register( "BaseQSender" );
+
+    MessageData from_data;
+    from_data.m_String = "Queued_From";
+
+    std::thread worker( [ &mbtQSender, &from_data ]()
+    {
+        MessageMgr::getInstance().Send( "BaseQ", "Queued_A" );
+        MessageMgr::getInstance().Send( "BaseQ", "Queued_B" );
+        MessageMgr::getInstance().Send( "BaseQ", "Queued_A" );
+        MessageMgr::getInstance().Send( "BaseQ", &mbtQSender, from_data );
+        MessageMgr::getInstance().Send( "BaseQ", "Queued_C" );
+        MessageMgr::getInstance().Send( "BaseQLost", "Queued_Lost" );
+    } );
+    worker.join();
+
+    TEST_ASSERT( mbtQ.m_DataVec.size() == 0 );
+    TEST_ASSERT( mbtQLost.m_DataVec.size() == 0 );
+
+    //==== Unregistering Drops Messages To And From That Base ====//
+    mbtQSender.UnRegister();
+    mbtQLost.UnRegister();
+
+    TEST_ASSERT( mbtQ.DeliverQueuedMessages() == 3 );
+    TEST_ASSERT( mbtQ.m_DataVec.size() == 3 );
+    if ( mbtQ.m_DataVec.size() == 3 )
+    {
+        // The repeated A is coalesced into its later copy, after B.
+        TEST_ASSERT( mbtQ.m_DataVec[0].m_String.compare( "Queued_B" ) == 0 );
+        TEST_ASSERT( mbtQ.m_DataVec[1].m_String.compare( "Queued_A" ) == 0 );
+        TEST_ASSERT( mbtQ.m_DataVec[2].m_String.compare( "Queued_C" ) == 0 );
+    }
+    TEST_ASSERT( mbtQ.DeliverQueuedMessages() == 0 );
+
+    TEST_ASSERT( mbtQLost.DeliverQueuedMessages() == 0 );
+    TEST_ASSERT( mbtQLost.m_DataVec.size() == 0 );
 }
 
 //==== Test String Utilities =====//
@@ -66,6 +66,7 @@ public:
     bool m_ValidFrom;
     size_t m_FromPtrID;
     MessageData m_Data;
+    vector< MessageData > m_DataVec;        // Every Message In Delivery Order
     void MessageCallback( const MessageBase* from, const MessageData& data )
     {
         m_ValidFrom = false;
@@ -75,6 +76,7 @@ public:
             m_ValidFrom = true;
         }
         m_Data = data;
+        m_DataVec.push_back( data );
     }
 
 };
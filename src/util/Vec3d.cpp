@@ -21,28 +21,6 @@ using std::cout;
 using std::endl;
 using std::vector;
 
-//****** Constructor:  vec3d x() ******//
-vec3d::vec3d()
-{
-    v[0] = v[1] = v[2] = 0.0;
-}
-
-//****** Constructor:  vec3d x(1.,0.,3.) ******//
-vec3d::vec3d( double xx, double yy, double zz )
-{
-    v[0] = xx;
-    v[1] = yy;
-    v[2] = zz;
-}
-
-//******* vec3d x = y ******//
-vec3d::vec3d( const vec3d& a )
-{
-    v[0] = a.v[0];
-    v[1] = a.v[1];
-    v[2] = a.v[2];
-}
-
 vec3d::vec3d( const threed_point_type &a )
 {
     v[0] = a.x();
@@ -71,20 +49,6 @@ vec3d::vec3d( const std::vector<double> &a )
     v[2] = a[2];
 }
 
-//****** Equals:  x = y ******
-vec3d& vec3d::operator=( const vec3d& a )
-{
-    if ( this == &a )
-    {
-        return *this;
-    }
-
-    v[0] = a.v[0];
-    v[1] = a.v[1];
-    v[2] = a.v[2];
-    return *this;
-}
-
 vec3d& vec3d::operator=( const vec2d& a )
 {
     v[0] = a.v[0];
@@ -37,15 +37,35 @@ private:
 
 
 public:
+#ifdef VSP_VEC3D_ALIGNED
+    // Padded to four doubles so arrays of points fill whole vector registers.
+    // The fourth entry is unused.
+    alignas( 16 ) double v[4];
+#else
     double v[3];
+#endif
 
-    vec3d();           // vec3d x or new vec3d
+    // Defined here so copies and constructions inline into point loops.
+    vec3d()            // vec3d x or new vec3d
+    {
+        v[0] = v[1] = v[2] = 0.0;
+    }
 
     ~vec3d()  {}        // delete vec3d
 
-    vec3d( double xx, double yy, double zz );
+    vec3d( double xx, double yy, double zz )
+    {
+        v[0] = xx;
+        v[1] = yy;
+        v[2] = zz;
+    }
 
-    vec3d( const vec3d& a ); // vec3d x = y
+    vec3d( const vec3d& a ) // vec3d x = y
+    {
+        v[0] = a.v[0];
+        v[1] = a.v[1];
+        v[2] = a.v[2];
+    }
 
     vec3d( const threed_point_type &a );
 
@@ -53,7 +73,13 @@ public:
     vec3d( const float a[3] );
     vec3d( const std::vector<double> &a );
 
-    vec3d& operator=( const vec3d& a ); // x = y
+    vec3d& operator=( const vec3d& a ) // x = y
+    {
+        v[0] = a.v[0];
+        v[1] = a.v[1];
+        v[2] = a.v[2];
+        return *this;
+    }
     vec3d& operator=( const vec2d& a );
     vec3d& operator=( double a );      // x = 35.
     vec3d& operator=( const threed_point_type &a );
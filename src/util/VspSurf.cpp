@@ -20,6 +20,10 @@
 #include "Cluster.h"
 #include "Util.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "eli/geom/surface/piecewise_body_of_revolution_creator.hpp"
 #include "eli/geom/surface/piecewise_multicap_surface_creator.hpp"
 #include "eli/geom/intersect/minimum_distance_surface.hpp"
@@ -60,6 +64,8 @@ VspSurf::VspSurf()
     m_FoilSurf = NULL;
     m_LECluster = 1.0;
     m_TECluster = 1.0;
+    m_AdaptTessFlag = false;
+    m_AdaptTessTol = 0.01;
     m_SkinClosedFlag = 0;
 }
 
@@ -80,6 +86,12 @@ void VspSurf::SetRootTipClustering( const vector < double > &root, const vector
     m_TipCluster = tip;
 }
 
+void VspSurf::SetAdaptTess( bool flag, double tol )
+{
+    m_AdaptTessFlag = flag;
+    m_AdaptTessTol = tol;
+}
+
 int VspSurf::GetNumSectU() const
 {
     return m_Surface.number_u_patches();
@@ -90,6 +102,39 @@ int VspSurf::GetNumSectW() const
     return m_Surface.number_v_patches();
 }
 
+//==== Patch Control Points And Stored Skinning Inputs ====//
+size_t VspSurf::MemoryUsage() const
+{
+    size_t bytes = sizeof( VspSurf );
+
+    piecewise_surface_type::index_type nupatch = m_Surface.number_u_patches();
+    piecewise_surface_type::index_type nwpatch = m_Surface.number_v_patches();
+    if ( nupatch > 0 && nwpatch > 0 )
+    {
+        // Degree queries are not const in Code-Eli, but do not modify the surface.
+        piecewise_surface_type & surf = const_cast < piecewise_surface_type & > ( m_Surface );
+        piecewise_surface_type::index_type umin, umax, wmin, wmax;
+        surf.degree_u( umin, umax );
+        surf.degree_v( wmin, wmax );
+
+        size_t patch_bytes = sizeof( surface_patch_type ) + ( umax + 1 ) * ( wmax + 1 ) * 3 * sizeof( double );
+        bytes += nupatch * nwpatch * patch_bytes;
+
+        // The skin cache, when present, is a copy of m_Surface.
+        if ( m_SkinCache.m_Surface.number_u_patches() > 0 )
+        {
+            bytes += nupatch * nwpatch * patch_bytes;
+        }
+    }
+
+    bytes += vector_mem_bytes( m_UFeature ) + vector_mem_bytes( m_WFeature );
+    bytes += vector_mem_bytes( m_USkip ) + vector_mem_bytes( m_WSkip );
+    bytes += vector_mem_bytes( m_RootCluster ) + vector_mem_bytes( m_TipCluster );
+    bytes += vector_mem_bytes( m_SkinRibVec ) + vector_mem_bytes( m_SkinDegreeVec ) + vector_mem_bytes( m_SkinParmVec );
+
+    return bytes;
+}
+
 double VspSurf::GetUMax() const
 {
   return m_Surface.get_umax();
@@ -102,23 +147,31 @@ double VspSurf::GetWMax() const
 
 void VspSurf::ReverseUDirection()
 {
+    ClearPatchEval();
+
     m_Surface.reverse_u();
 }
 
 void VspSurf::ReverseWDirection()
 {
+    ClearPatchEval();
+
     m_Surface.reverse_v();
 }
 
 //==== Flip U/W Directions =====//
 void VspSurf::SwapUWDirections()
 {
+    ClearPatchEval();
+
     m_Surface.swap_uv();
 }
 
 //==== Transform Control Points =====//
 void VspSurf::Transform( Matrix4d & mat )
 {
+    ClearPatchEval();
+
     surface_rotation_matrix_type rmat;
     double *mmat( mat.data() );
     surface_point_type trans;
@@ -220,6 +273,89 @@ double VspSurf::FindNearest01( double &u, double &w, const vec3d &pt, const doub
     return dist;
 }
 
+//==== Project Many Points, Seeding Each Search From A Sampled Point Tree ====//
+// Every patch is sampled on a small grid and the samples indexed in a kd-tree.  The
+// nearest sample seeds a local search; if that search ends farther away than its seed,
+// the point falls back to the global search.
+void VspSurf::FindNearest01( const vector < vec3d > &pts, vector < double > &us, vector < double > &ws, vector < double > &ds ) const
+{
+    int npt = pts.size();
+    us.resize( npt );
+    ws.resize( npt );
+    ds.resize( npt );
+
+    if ( npt == 0 || m_Surface.number_u_patches() == 0 || m_Surface.number_v_patches() == 0 )
+    {
+        return;
+    }
+
+    const int nsub = 4;
+
+    vector < double > upmap, vpmap;
+    m_Surface.get_pmap_u( upmap );
+    m_Surface.get_pmap_v( vpmap );
+
+    vector < double > u, v;
+    for ( int i = 0; i < ( int )upmap.size() - 1; i++ )
+    {
+        for ( int k = 0; k < nsub; k++ )
+        {
+            u.push_back( upmap[i] + ( upmap[i + 1] - upmap[i] ) * k / nsub );
+        }
+    }
+    u.push_back( upmap.back() );
+
+    for ( int j = 0; j < ( int )vpmap.size() - 1; j++ )
+    {
+        for ( int k = 0; k < nsub; k++ )
+        {
+            v.push_back( vpmap[j] + ( vpmap[j + 1] - vpmap[j] ) * k / nsub );
+        }
+    }
+    v.push_back( vpmap.back() );
+
+    vector< vector< vec3d > > pnts, norms, uw_pnts;
+    Tesselate( u, v, pnts, norms, uw_pnts );
+
+    int nv = v.size();
+
+    PntNodeCloud cloud;
+    cloud.ReserveMorePntNodes( u.size() * nv );
+    for ( int i = 0; i < ( int )u.size(); i++ )
+    {
+        for ( int j = 0; j < nv; j++ )
+        {
+            cloud.AddPntNode( pnts[i][j] );
+        }
+    }
+
+    PNTree index( 3, cloud, KDTreeSingleIndexAdaptorParams( 10 ) );
+    index.buildIndex();
+
+    double umax = GetUMax();
+    double wmax = GetWMax();
+
+    #pragma omp parallel for schedule( dynamic, 64 )
+    for ( int k = 0; k < npt; k++ )
+    {
+        size_t iseed = 0;
+        double dseed2 = 0.0;
+        index.knnSearch( &pts[k][0], 1, &iseed, &dseed2 );
+
+        double uk, wk;
+        double d = FindNearest( uk, wk, pts[k], u[ iseed / nv ], v[ iseed % nv ] );
+
+        if ( d > sqrt( dseed2 ) )
+        {
+            d = FindNearest( uk, wk, pts[k] );
+        }
+
+        us[k] = uk / umax;
+        ws[k] = wk / wmax;
+        ds[k] = d;
+    }
+}
+
 void VspSurf::FindDistanceAngle( double &u, double &w, const vec3d &pt, const vec3d &dir, const double &d, const double &theta, const double &u0, const double &w0 ) const
 {
     surface_point_type p, dr;
@@ -398,6 +534,8 @@ Matrix4d VspSurf::CompTransCoordSys( const double &u, const double &w )
 
 void VspSurf::CreateBodyRevolution( const VspCurve &input_crv, bool match_uparm )
 {
+    ClearPatchEval();
+
     eli::geom::surface::create_body_of_revolution( m_Surface, input_crv.GetCurve(), 0, true, match_uparm );
 
     ResetFlipNormal();
@@ -468,8 +606,193 @@ void VspSurf::CreateDisk( double dia, int ix, int iy )
     SkinC0( crv_vec, false );
 }
 
+//==== Re-Skin Only The Segments Next To Changed Ribs ====//
+// Interior C0 ribs decouple the skinning solve, so each run of segments between them depends
+// on its own ribs alone.  Runs holding a changed rib are skinned by themselves and spliced
+// into surf, which holds the skin of old_ribs.  Returns false when a full skin is needed.
+static bool ReskinChangedBlocks( piecewise_surface_type & surf, const vector< rib_data_type > & old_ribs,
+                                 const vector< rib_data_type > & ribs, const vector < int > &degree, const vector < double > & param )
+{
+    int nrib = ribs.size();
+    if ( nrib < 3 || ( int )old_ribs.size() != nrib || surf.number_u_patches() != nrib - 1 )
+    {
+        return false;
+    }
+
+    vector< bool > changed( nrib, false );
+    int nchanged = 0;
+    for ( int i = 0 ; i < nrib ; i++ )
+    {
+        if ( ribs[i] != old_ribs[i] )
+        {
+            changed[i] = true;
+            nchanged++;
+        }
+    }
+
+    if ( nchanged == 0 )
+    {
+        return true;
+    }
+    else if ( nchanged == nrib )
+    {
+        return false;
+    }
+
+    //==== Blocks End At Ribs That Are C0 Both Before And Now ====//
+    vector< int > bound;
+    bound.push_back( 0 );
+    for ( int i = 1 ; i < nrib - 1 ; i++ )
+    {
+        if ( ribs[i].get_continuity() == rib_data_type::C0 && old_ribs[i].get_continuity() == rib_data_type::C0 )
+        {
+            bound.push_back( i );
+        }
+    }
+    bound.push_back( nrib - 1 );
+
+    if ( bound.size() < 3 )
+    {
+        return false;
+    }
+
+    //==== V Joints As The Skinning Creator Finds Them ====//
+    surface_tolerance_type tol;
+    vector< double > rjoints;
+    ribs[0].get_joints( std::back_inserter( rjoints ) );
+    for ( int i = 1 ; i < nrib ; i++ )
+    {
+        vector< double > jts, jts_out;
+        ribs[i].get_joints( std::back_inserter( jts ) );
+        std::set_union( rjoints.begin(), rjoints.end(), jts.begin(), jts.end(), std::back_inserter( jts_out ),
+                        [&tol]( const double & x1, const double & x2 )->bool { return tol.approximately_less_than( x1, x2 ); } );
+        std::swap( rjoints, jts_out );
+    }
+
+    int njoint = rjoints.size();
+    vector< double > joints( njoint );
+    joints[0] = rjoints[0];
+    for ( int j = 0 ; j < njoint - 1 ; j++ )
+    {
+        joints[j + 1] = joints[j] + ( rjoints[j + 1] - rjoints[j] );
+    }
+
+    if ( surf.number_v_patches() != njoint - 1 )
+    {
+        return false;
+    }
+
+    //==== Split All Ribs To The Common Joints And Find Each Strip Degree ====//
+    vector< rib_data_type > rib_states( ribs );
+    vector< surface_index_type > max_jdegs( njoint - 1, 0 );
+    for ( int i = 0 ; i < nrib ; i++ )
+    {
+        vector< surface_index_type > jdegs;
+        rib_states[i].split( joints.begin(), joints.end(), std::back_inserter( jdegs ) );
+        for ( int j = 0 ; j < njoint - 1 ; j++ )
+        {
+            max_jdegs[j] = std::max( max_jdegs[j], jdegs[j] );
+        }
+    }
+
+    // Unchanged blocks keep their patches, so strip degrees must not move.
+    vector< double > pmap;
+    surf.get_pmap_v( pmap );
+    for ( int j = 0 ; j < njoint - 1 ; j++ )
+    {
+        surface_patch_type patch;
+        surf.get( patch, 0, j );
+        if ( patch.degree_v() != max_jdegs[j] || !tol.approximately_equal( pmap[j], joints[j] ) )
+        {
+            return false;
+        }
+    }
+
+    for ( int k = 0 ; k < ( int )bound.size() - 1 ; k++ )
+    {
+        int ista = bound[k];
+        int iend = bound[k + 1];
+
+        bool block_changed = false;
+        for ( int i = ista ; i <= iend ; i++ )
+        {
+            block_changed = block_changed || changed[i];
+        }
+
+        if ( !block_changed )
+        {
+            continue;
+        }
+
+        vector< rib_data_type > block_ribs( rib_states.begin() + ista, rib_states.begin() + iend + 1 );
+        for ( int i = 0 ; i < ( int )block_ribs.size() ; i++ )
+        {
+            block_ribs[i].promote( max_jdegs.begin(), max_jdegs.end() );
+        }
+
+        // The outer side of a block end belongs to the neighboring block.
+        block_ribs[0].unset_left_fp();
+        block_ribs[0].unset_left_fpp();
+        block_ribs.back().unset_right_fp();
+        block_ribs.back().unset_right_fpp();
+
+        std::vector<typename general_creator_type::index_type> max_degree( degree.begin() + ista, degree.begin() + iend );
+
+        general_creator_type gc;
+        if ( !gc.set_conditions( block_ribs, max_degree, false ) )
+        {
+            return false;
+        }
+
+        gc.set_u0( param[ista] );
+        for ( int i = 0 ; i < gc.get_number_u_segments() ; i++ )
+        {
+            gc.set_segment_du( param[ista + i + 1] - param[ista + i], i );
+        }
+
+        piecewise_surface_type block_surf;
+        if ( !gc.create( block_surf ) || block_surf.number_v_patches() != njoint - 1 )
+        {
+            return false;
+        }
+
+        for ( int i = 0 ; i < iend - ista ; i++ )
+        {
+            for ( int j = 0 ; j < njoint - 1 ; j++ )
+            {
+                surface_patch_type patch;
+                block_surf.get( patch, i, j );
+                if ( surf.set( patch, ista + i, j ) != piecewise_surface_type::NO_ERRORS )
+                {
+                    return false;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
 void VspSurf::SkinRibs( const vector<rib_data_type> &ribs, const vector < int > &degree, const vector < double > & param, bool closed_flag )
 {
+    ClearPatchEval();
+
+    //==== Splice Into The Last Skin When Only Some Sections Changed ====//
+    if ( !closed_flag && !m_SkinClosedFlag && m_SkinType == SKIN_RIBS && m_SkinCache.m_Surface.number_u_patches() > 0 &&
+         degree == m_SkinDegreeVec && param == m_SkinParmVec )
+    {
+        if ( ReskinChangedBlocks( m_SkinCache.m_Surface, m_SkinRibVec, ribs, degree, param ) )
+        {
+            m_Surface = m_SkinCache.m_Surface;
+
+            ResetFlipNormal();
+            ResetUWSkip();
+
+            m_SkinRibVec = ribs;
+            return;
+        }
+    }
+
     general_creator_type gc;
     surface_index_type nrib, i;
 
@@ -505,6 +828,11 @@ void VspSurf::SkinRibs( const vector<rib_data_type> &ribs, const vector < int >
     if ( !creat )
     {
         printf( "Failure in SkinRibs create\n" );
+        m_SkinCache.m_Surface.clear();
+    }
+    else
+    {
+        m_SkinCache.m_Surface = m_Surface;
     }
 
     ResetFlipNormal();
@@ -521,6 +849,8 @@ void VspSurf::SkinRibs( const vector<rib_data_type> &ribs, const vector < int >
 
 void VspSurf::SkinRibs( const vector<rib_data_type> &ribs, const vector < double > & param, bool closed_flag )
 {
+    ClearPatchEval();
+
     surface_index_type nrib;
     nrib = ribs.size();
     vector< int > degree( nrib - 1, 0 );
@@ -529,6 +859,8 @@ void VspSurf::SkinRibs( const vector<rib_data_type> &ribs, const vector < double
 
 void VspSurf::SkinRibs( const vector<rib_data_type> &ribs, const vector < int > &degree, bool closed_flag )
 {
+    ClearPatchEval();
+
     surface_index_type nrib;
     nrib = ribs.size();
     vector< double > param( nrib );
@@ -542,6 +874,8 @@ void VspSurf::SkinRibs( const vector<rib_data_type> &ribs, const vector < int >
 //==== Interpolate A Set Of Points =====//
 void VspSurf::SkinRibs( const vector<rib_data_type> &ribs, bool closed_flag )
 {
+    ClearPatchEval();
+
     surface_index_type nrib;
     nrib = ribs.size();
     vector< int > degree( nrib - 1, 0 );
@@ -550,6 +884,8 @@ void VspSurf::SkinRibs( const vector<rib_data_type> &ribs, bool closed_flag )
 
 void VspSurf::SkinCubicSpline( const vector<rib_data_type> &ribs, const vector<double> &param, const vector <double> &tdisc, const vector < int > &degree, bool closed_flag )
 {
+    ClearPatchEval();
+
     spline_creator_type sc;
     surface_index_type nrib, i;
 
@@ -596,6 +932,8 @@ void VspSurf::SkinCubicSpline( const vector<rib_data_type> &ribs, const vector<d
 //==== Interpolate A Set Of Points =====//
 void VspSurf::SkinCubicSpline( const vector<rib_data_type> &ribs, const vector<double> &param, const vector <double> &tdisc, bool closed_flag )
 {
+    ClearPatchEval();
+
     surface_index_type nrib;
     nrib = ribs.size();
     vector< int > degree( nrib - 1, 0 );
@@ -605,6 +943,8 @@ void VspSurf::SkinCubicSpline( const vector<rib_data_type> &ribs, const vector<d
 //==== Interpolate A Set Of Points =====//
 void VspSurf::SkinCubicSpline( const vector<rib_data_type> &ribs, const vector<double> &param, bool closed_flag )
 {
+    ClearPatchEval();
+
     surface_index_type nrib;
     nrib = ribs.size();
     vector< int > degree( nrib - 1, 0 );
@@ -722,6 +1062,218 @@ void VspSurf::SkinC2( const vector< VspCurve > &input_crv_vec, bool closed_flag
     SkinCX( input_crv_vec, rib_data_type::C2, closed_flag );
 }
 
+//===== Bernstein Basis And Its Derivative Of Degree N =====//
+template < int N >
+static inline void BernsteinBasis( double t, double * b, double * db );
+
+template <>
+inline void BernsteinBasis< 1 >( double t, double * b, double * db )
+{
+    b[0] = 1.0 - t;
+    b[1] = t;
+    db[0] = -1.0;
+    db[1] = 1.0;
+}
+
+template <>
+inline void BernsteinBasis< 3 >( double t, double * b, double * db )
+{
+    double s = 1.0 - t;
+    b[0] = s * s * s;
+    b[1] = 3.0 * t * s * s;
+    b[2] = 3.0 * t * t * s;
+    b[3] = t * t * t;
+    db[0] = -3.0 * s * s;
+    db[1] = 3.0 * s * ( s - 2.0 * t );
+    db[2] = 3.0 * t * ( 2.0 * s - t );
+    db[3] = 3.0 * t * t;
+}
+
+//===== Point Or First Derivative Of One Tensor Product Bezier Patch =====//
+// cp holds ( NU + 1 ) x ( NW + 1 ) points, u major.  Fixed sizes let the
+// compiler unroll and vectorize the sums.
+template < int NU, int NW >
+static void EvalBezierPatch( const double * cp, double s, double t, int type, vec3d & rtn )
+{
+    double bu[ NU + 1 ], dbu[ NU + 1 ];
+    double bw[ NW + 1 ], dbw[ NW + 1 ];
+    BernsteinBasis< NU >( s, bu, dbu );
+    BernsteinBasis< NW >( t, bw, dbw );
+
+    const double * wu = ( type == VspPatchEval::EVAL_TAN_U ) ? dbu : bu;
+    const double * ww = ( type == VspPatchEval::EVAL_TAN_W ) ? dbw : bw;
+
+    double x = 0, y = 0, z = 0;
+    for ( int i = 0; i <= NU; i++ )
+    {
+        double rx = 0, ry = 0, rz = 0;
+        const double * row = cp + i * ( NW + 1 ) * 3;
+        for ( int j = 0; j <= NW; j++ )
+        {
+            rx += ww[j] * row[ 3 * j ];
+            ry += ww[j] * row[ 3 * j + 1 ];
+            rz += ww[j] * row[ 3 * j + 2 ];
+        }
+        x += wu[i] * rx;
+        y += wu[i] * ry;
+        z += wu[i] * rz;
+    }
+    rtn.set_xyz( x, y, z );
+}
+
+void VspPatchEval::Build( const piecewise_surface_type & surf )
+{
+    surf.get_pmap_u( m_UMap );
+    surf.get_pmap_v( m_WMap );
+
+    int nu = surf.number_u_patches();
+    int nw = surf.number_v_patches();
+
+    m_DegU.assign( nu * nw, -1 );
+    m_DegW.assign( nu * nw, -1 );
+    m_Offset.assign( nu * nw, -1 );
+    m_CP.clear();
+
+    surface_patch_type patch;
+    for ( int ip = 0; ip < nu; ip++ )
+    {
+        for ( int jp = 0; jp < nw; jp++ )
+        {
+            surf.get( patch, ip, jp );
+
+            int degu = patch.degree_u();
+            int degw = patch.degree_v();
+            if ( ( degu != 1 && degu != 3 ) || ( degw != 1 && degw != 3 ) )
+            {
+                continue;
+            }
+
+            int k = ip * nw + jp;
+            m_DegU[k] = degu;
+            m_DegW[k] = degw;
+            m_Offset[k] = ( int )m_CP.size();
+
+            for ( int i = 0; i <= degu; i++ )
+            {
+                for ( int j = 0; j <= degw; j++ )
+                {
+                    surface_point_type p = patch.get_control_point( i, j );
+                    m_CP.push_back( p.x() );
+                    m_CP.push_back( p.y() );
+                    m_CP.push_back( p.z() );
+                }
+            }
+        }
+    }
+}
+
+//===== Patch Index And Local Parameter, As Code-Eli's find_segment =====//
+bool VspPatchEval::FindPatch( const vector < double > & pmap, double p, int & k, double & t )
+{
+    int n = ( int )pmap.size() - 1;
+    if ( n < 1 || p < pmap[0] || p > pmap[n] )
+    {
+        return false;
+    }
+
+    k = ( int )( upper_bound( pmap.begin(), pmap.begin() + n, p ) - pmap.begin() );
+    if ( k > 0 )
+    {
+        k--;
+    }
+
+    surface_tolerance_type tol;
+    double delta = pmap[ k + 1 ] - pmap[k];
+
+    if ( tol.approximately_equal( p, pmap[k] ) )
+    {
+        t = 0.0;
+    }
+    else if ( tol.approximately_equal( p, pmap[k] + delta ) )
+    {
+        t = 1.0;
+    }
+    else
+    {
+        t = clamp( ( p - pmap[k] ) / delta, 0.0, 1.0 );
+    }
+    return true;
+}
+
+bool VspPatchEval::Eval( double u, double w, int type, vec3d & rtn ) const
+{
+    int ip, jp;
+    double s, t;
+    if ( !FindPatch( m_UMap, u, ip, s ) || !FindPatch( m_WMap, w, jp, t ) )
+    {
+        return false;
+    }
+
+    int k = ip * ( ( int )m_WMap.size() - 1 ) + jp;
+    if ( m_Offset[k] < 0 )
+    {
+        return false;
+    }
+
+    const double * cp = &m_CP[ m_Offset[k] ];
+    int deg = m_DegU[k] * 4 + m_DegW[k];
+
+    switch ( deg )
+    {
+    case 15:
+        EvalBezierPatch< 3, 3 >( cp, s, t, type, rtn );
+        break;
+    case 13:
+        EvalBezierPatch< 3, 1 >( cp, s, t, type, rtn );
+        break;
+    case 7:
+        EvalBezierPatch< 1, 3 >( cp, s, t, type, rtn );
+        break;
+    default:
+        EvalBezierPatch< 1, 1 >( cp, s, t, type, rtn );
+        break;
+    }
+
+    //==== Derivatives Of The Local Parameter ====//
+    if ( type == EVAL_TAN_U )
+    {
+        rtn = rtn / ( m_UMap[ ip + 1 ] - m_UMap[ip] );
+    }
+    else if ( type == EVAL_TAN_W )
+    {
+        rtn = rtn / ( m_WMap[ jp + 1 ] - m_WMap[jp] );
+    }
+    return true;
+}
+
+//===== Fixed Degree Evaluators For The Current Surface =====//
+// Built once under a lock; threads evaluating concurrently then share it.
+const VspPatchEval * VspSurf::GetPatchEval() const
+{
+    std::shared_ptr < const VspPatchEval > eval = std::atomic_load( &m_PatchEval );
+    if ( !eval )
+    {
+        #pragma omp critical( vsp_surf_patch_eval )
+        {
+            eval = std::atomic_load( &m_PatchEval );
+            if ( !eval )
+            {
+                std::shared_ptr < VspPatchEval > built = std::make_shared < VspPatchEval > ();
+                built->Build( m_Surface );
+                eval = built;
+                std::atomic_store( &m_PatchEval, eval );
+            }
+        }
+    }
+    return eval.get();
+}
+
+//===== Called Before Anything Changes m_Surface =====//
+void VspSurf::ClearPatchEval()
+{
+    std::atomic_store( &m_PatchEval, std::shared_ptr < const VspPatchEval > () );
+}
+
 //===== Compute Point On Surf Given  U V (Between 0 1 ) =====//
 vec3d VspSurf::CompPnt01( double u, double v ) const
 {
@@ -792,6 +1344,11 @@ vec3d VspSurf::CompTanUW( double u, double v ) const
 vec3d VspSurf::CompTanU( double u, double v ) const
 {
     vec3d rtn;
+    if ( GetPatchEval()->Eval( u, v, VspPatchEval::EVAL_TAN_U, rtn ) )
+    {
+        return rtn;
+    }
+
     surface_point_type p( m_Surface.f_u( u, v ) );
 
     rtn.set_xyz( p.x(), p.y(), p.z() );
@@ -802,6 +1359,11 @@ vec3d VspSurf::CompTanU( double u, double v ) const
 vec3d VspSurf::CompTanW( double u, double v ) const
 {
     vec3d rtn;
+    if ( GetPatchEval()->Eval( u, v, VspPatchEval::EVAL_TAN_W, rtn ) )
+    {
+        return rtn;
+    }
+
     surface_point_type p( m_Surface.f_v( u, v ) );
 
     rtn.set_xyz( p.x(), p.y(), p.z() );
@@ -812,6 +1374,11 @@ vec3d VspSurf::CompTanW( double u, double v ) const
 vec3d VspSurf::CompPnt( double u, double v ) const
 {
     vec3d rtn;
+    if ( GetPatchEval()->Eval( u, v, VspPatchEval::EVAL_PNT, rtn ) )
+    {
+        return rtn;
+    }
+
     surface_point_type p( m_Surface.f( u, v ) );
 
     rtn.set_xyz( p.x(), p.y(), p.z() );
@@ -839,6 +1406,68 @@ vec3d VspSurf::CompNorm01( double u01, double v01 ) const
     return CompNorm( u01 * GetUMax(), v01 * GetWMax() );
 }
 
+//===== Compute Many Points Given 0-1 U W, Grouped By Patch =====//
+void VspSurf::CompPnt01( const vector < double > &us, const vector < double > &ws, vector < vec3d > &pts ) const
+{
+    vector < int > order;
+    SortByPatch01( us, ws, order );
+
+    pts.resize( order.size() );
+
+    #pragma omp parallel for schedule( static )
+    for ( int k = 0; k < ( int )order.size(); k++ )
+    {
+        int i = order[k];
+        pts[i] = CompPnt01( clamp( us[i], 0.0, 1.0 ), clamp( ws[i], 0.0, 1.0 ) );
+    }
+}
+
+//===== Compute Many Normals Given 0-1 U W, Grouped By Patch =====//
+void VspSurf::CompNorm01( const vector < double > &us, const vector < double > &ws, vector < vec3d > &norms ) const
+{
+    vector < int > order;
+    SortByPatch01( us, ws, order );
+
+    norms.resize( order.size() );
+
+    #pragma omp parallel for schedule( static )
+    for ( int k = 0; k < ( int )order.size(); k++ )
+    {
+        int i = order[k];
+        norms[i] = CompNorm01( clamp( us[i], 0.0, 1.0 ), clamp( ws[i], 0.0, 1.0 ) );
+    }
+}
+
+//===== Order 0-1 U W Queries So Queries On The Same Patch Are Adjacent =====//
+void VspSurf::SortByPatch01( const vector < double > &us, const vector < double > &ws, vector < int > &order ) const
+{
+    int n = min( us.size(), ws.size() );
+
+    vector < double > upmap, vpmap;
+    m_Surface.get_pmap_u( upmap );
+    m_Surface.get_pmap_v( vpmap );
+
+    double umax = GetUMax();
+    double wmax = GetWMax();
+    int nvpatch = max( ( int )vpmap.size() - 1, 1 );
+
+    vector < pair < int, int > > key_vec( n );
+    for ( int i = 0; i < n; i++ )
+    {
+        int ip = upper_bound( upmap.begin(), upmap.end(), clamp( us[i], 0.0, 1.0 ) * umax ) - upmap.begin();
+        int jp = upper_bound( vpmap.begin(), vpmap.end(), clamp( ws[i], 0.0, 1.0 ) * wmax ) - vpmap.begin();
+        key_vec[i] = make_pair( ip * ( nvpatch + 2 ) + jp, i );
+    }
+
+    sort( key_vec.begin(), key_vec.end() );
+
+    order.resize( n );
+    for ( int i = 0; i < n; i++ )
+    {
+        order[i] = key_vec[i].second;
+    }
+}
+
 //===== Compute Surface Curvature Metrics Given  U W =====//
 void VspSurf::CompCurvature( double u, double w, double& k1, double& k2, double& ka, double& kg ) const
 {
@@ -1069,6 +1698,125 @@ void VspSurf::FlagDuplicate( VspSurf *othersurf )
     }
 }
 
+//==== Redistribute Tessellation Fractions By Surface Curvature ====//
+// t holds increasing fractions from 0 to 1 of one or more parameter spans, span r running from
+// p0[r] to p1[r] in U (udir) or W.  The turning of the surface along the spans, sampled across
+// the surface, places points so no chord deviates from the surface by more than m_AdaptTessTol
+// of its length.  The input spacing is the coarsest allowed anywhere and the number of segments
+// is kept a multiple of nmult.
+void VspSurf::AdaptTess( vector < double > &t, const vector < double > &p0, const vector < double > &p1, bool udir, int nmult ) const
+{
+    const int nseg = ( int )t.size() - 1;
+    const int nsegmax = 1000;
+
+    if ( !m_AdaptTessFlag || m_AdaptTessTol <= 0.0 || nseg < 1 )
+    {
+        return;
+    }
+
+    // Parameters across the spans to sample the curvature along
+    vector < double > across;
+    if ( udir )
+    {
+        int ncross = 16;
+        double w0 = m_Surface.get_v0();
+        double dw = m_Surface.get_vmax() - w0;
+        for ( int i = 0; i <= ncross; i++ )
+        {
+            across.push_back( w0 + dw * static_cast<double>( i ) / ncross );
+        }
+    }
+    else
+    {
+        vector < double > upmap;
+        m_Surface.get_pmap_u( upmap );
+        for ( int i = 0; i < ( int )upmap.size(); i++ )
+        {
+            across.push_back( upmap[i] );
+            if ( i < ( int )upmap.size() - 1 )
+            {
+                across.push_back( 0.5 * ( upmap[i] + upmap[i + 1] ) );
+            }
+        }
+    }
+
+    // Segments per unit fraction, starting from the input spacing
+    const int nsamp = max( 4 * nseg, 32 );
+    vector < double > g( nsamp + 1 );
+    int iseg = 0;
+    for ( int k = 0; k <= nsamp; k++ )
+    {
+        double ts = static_cast<double>( k ) / nsamp;
+        while ( iseg < nseg - 1 && ts > t[ iseg + 1 ] )
+        {
+            iseg++;
+        }
+        double dt = t[ iseg + 1 ] - t[ iseg ];
+        g[k] = dt > 0.0 ? 1.0 / dt : 0.0;
+    }
+
+    for ( int r = 0; r < ( int )p0.size(); r++ )
+    {
+        double dp = p1[r] - p0[r];
+
+        for ( int c = 0; c < ( int )across.size(); c++ )
+        {
+            // Skip lines collapsed to a point, such as the ends of a body
+            vec3d pa = udir ? CompPnt( p0[r], across[c] ) : CompPnt( across[c], p0[r] );
+            vec3d pb = udir ? CompPnt( p1[r], across[c] ) : CompPnt( across[c], p1[r] );
+            vec3d pm = udir ? CompPnt( p0[r] + 0.5 * dp, across[c] ) : CompPnt( across[c], p0[r] + 0.5 * dp );
+            double len = dist( pa, pm ) + dist( pm, pb );
+            if ( len <= 0.0 )
+            {
+                continue;
+            }
+
+            for ( int k = 0; k <= nsamp; k++ )
+            {
+                double p = p0[r] + dp * static_cast<double>( k ) / nsamp;
+
+                vec3d d1 = ( udir ? CompTanU( p, across[c] ) : CompTanW( across[c], p ) ) * dp;
+                vec3d d2 = ( udir ? CompTanUU( p, across[c] ) : CompTanWW( across[c], p ) ) * ( dp * dp );
+
+                double speed = d1.mag();
+                if ( speed > 1e-6 * len )
+                {
+                    // A chord turning through angle a deviates by about a / 8 of its length.
+                    double turn = cross( d1, d2 ).mag() / ( speed * speed );
+                    g[k] = max( g[k], turn / ( 8.0 * m_AdaptTessTol ) );
+                }
+            }
+        }
+    }
+
+    // Equidistribute the segments
+    vector < double > G( nsamp + 1, 0.0 );
+    for ( int k = 1; k <= nsamp; k++ )
+    {
+        G[k] = G[k - 1] + 0.5 * ( g[k - 1] + g[k] ) / nsamp;
+    }
+
+    int n = ( int )ceil( G[nsamp] - 1e-6 );
+    n = min( max( n, nseg ), max( nseg, nsegmax ) );
+    n = nmult * ( ( n + nmult - 1 ) / nmult );
+
+    t.resize( n + 1 );
+    t[0] = 0.0;
+    int k = 0;
+    for ( int i = 1; i < n; i++ )
+    {
+        double target = G[nsamp] * static_cast<double>( i ) / n;
+        while ( k < nsamp - 1 && G[k + 1] < target )
+        {
+            k++;
+        }
+        double dG = G[k + 1] - G[k];
+        double frac = dG > 0.0 ? ( target - G[k] ) / dG : 0.0;
+        t[i] = ( k + frac ) / nsamp;
+    }
+    t[n] = 1.0;
+}
+
 void VspSurf::MakeUTess( const vector<int> &num_u, vector<double> &u, const std::vector<int> & umerge ) const
 {
     if ( umerge.size() != 0 )
@@ -1106,8 +1854,8 @@ void VspSurf::MakeUTess( const vector<int> &num_u, vector<double> &u, const std:
         double ustart = m_Surface.get_u0();
         double uend = ustart;
 
-        u.resize( nu );
-        int iu = 0;
+        u.clear();
+        u.reserve( nu );
 
         for ( int i = 0; i < nusect; i++ )
         {
@@ -1125,10 +1873,16 @@ void VspSurf::MakeUTess( const vector<int> &num_u, vector<double> &u, const std:
 
             if ( !uskip[i] )
             {
-                for ( int isecttess = 0; isecttess < num_u[i] - 1; ++isecttess )
+                vector < double > t( num_u[i] );
+                for ( int isecttess = 0; isecttess < num_u[i]; ++isecttess )
                 {
-                    u[iu] = ustart + du * Cluster(static_cast<double>( isecttess ) / (num_u[i] - 1), m_RootCluster[i], m_TipCluster[i]);
-                    iu++;
+                    t[isecttess] = Cluster(static_cast<double>( isecttess ) / (num_u[i] - 1), m_RootCluster[i], m_TipCluster[i]);
+                }
+                AdaptTess( t, vector < double > ( 1, ustart ), vector < double > ( 1, uend ), true, 1 );
+
+                for ( int isecttess = 0; isecttess < ( int )t.size() - 1; ++isecttess )
+                {
+                    u.push_back( ustart + du * t[isecttess] );
                 }
             }
 
@@ -1138,7 +1892,7 @@ void VspSurf::MakeUTess( const vector<int> &num_u, vector<double> &u, const std:
             }
 
         }
-        u.back() = ustart;
+        u.push_back( ustart );
 
 
     }
@@ -1164,10 +1918,10 @@ void VspSurf::MakeUTess( const vector<int> &num_u, vector<double> &u, const std:
         // calculate the u and v parameterizations
         umin = m_Surface.get_u0();
 
-        u.resize( nu );
+        u.clear();
+        u.reserve( nu );
         double uumin( umin );
         size_t iusect;
-        size_t iu = 0;
         for ( iusect = 0; iusect < (size_t)nusect; ++iusect )
         {
             double du, dv;
@@ -1176,10 +1930,16 @@ void VspSurf::MakeUTess( const vector<int> &num_u, vector<double> &u, const std:
 
             if ( !m_USkip[ iusect] )
             {
-                for ( int isecttess = 0; isecttess < num_u[iusect] - 1; ++isecttess )
+                vector < double > t( num_u[iusect] );
+                for ( int isecttess = 0; isecttess < num_u[iusect]; ++isecttess )
+                {
+                    t[isecttess] = Cluster( static_cast<double>( isecttess ) / ( num_u[iusect] - 1 ), m_RootCluster[iusect], m_TipCluster[iusect] );
+                }
+                AdaptTess( t, vector < double > ( 1, uumin ), vector < double > ( 1, uumin + du ), true, 1 );
+
+                for ( int isecttess = 0; isecttess < ( int )t.size() - 1; ++isecttess )
                 {
-                    u[iu] = uumin + du * Cluster( static_cast<double>( isecttess ) / ( num_u[iusect] - 1 ), m_RootCluster[iusect], m_TipCluster[iusect] );
-                    iu++;
+                    u.push_back( uumin + du * t[isecttess] );
                 }
             }
             if ( !( iusect == nusect - 1 && m_USkip[ iusect ] ) )
@@ -1187,7 +1947,7 @@ void VspSurf::MakeUTess( const vector<int> &num_u, vector<double> &u, const std:
                 uumin += du;
             }
         }
-        u.back() = uumin;
+        u.push_back( uumin );
     }
 }
 
@@ -1214,8 +1974,39 @@ void VspSurf::MakeVTess( int num_v, std::vector<double> &vtess, const int &n_cap
         vlelow = vle - TMAGIC;
         vleup = vle + TMAGIC;
 
-        vtess.resize(nv);
         int jle = ( nv - 1 ) / 2;
+
+        // Fractions of the lower surface from the TE and of the upper surface from the LE
+        vector < double > tlow( jle + 1 ), tup( nv - jle );
+        for ( int j = 0; j <= jle; ++j )
+        {
+            tlow[j] = Cluster( 2.0 * static_cast<double>( j ) / ( nv - 1 ), m_TECluster, m_LECluster );
+        }
+        for ( int j = jle; j < nv; ++j )
+        {
+            tup[j - jle] = 1.0 - Cluster( 1.0 - 2.0 * static_cast<double>( j - jle ) / ( nv - 1 ), m_TECluster, m_LECluster );
+        }
+
+        if ( m_AdaptTessFlag )
+        {
+            // Adapt both surfaces together so upper and lower points stay paired
+            vector < double > p0( 2 ), p1( 2 );
+            p0[0] = vmin;
+            p1[0] = vlelow;
+            p0[1] = vmax;
+            p1[1] = vleup;
+            AdaptTess( tlow, p0, p1, false, 2 );
+
+            jle = tlow.size() - 1;
+            nv = 2 * jle + 1;
+            tup.resize( jle + 1 );
+            for ( int j = 0; j <= jle; ++j )
+            {
+                tup[j] = 1.0 - tlow[ jle - j ];
+            }
+        }
+
+        vtess.resize(nv);
         int j = 0;
         if ( degen )
         {
@@ -1224,7 +2015,7 @@ void VspSurf::MakeVTess( int num_v, std::vector<double> &vtess, const int &n_cap
         }
         for ( ; j < jle; ++j )
         {
-            vtess[j] = vmin + ( vlelow - vmin ) * Cluster( 2.0 * static_cast<double>( j ) / ( nv - 1 ), m_TECluster, m_LECluster );
+            vtess[j] = vmin + ( vlelow - vmin ) * tlow[j];
         }
         if ( degen )
         {
@@ -1233,7 +2024,7 @@ void VspSurf::MakeVTess( int num_v, std::vector<double> &vtess, const int &n_cap
         }
         for ( ; j < nv; ++j )
         {
-            vtess[j] = vleup + ( vmax - vleup ) * ( 1.0 - Cluster( 1.0 - 2.0 * static_cast<double>( j - jle ) / ( nv - 1 ), m_TECluster, m_LECluster ));
+            vtess[j] = vleup + ( vmax - vleup ) * tup[j - jle];
         }
         if ( degen )
         {
@@ -1293,6 +2084,14 @@ void VspSurf::MakeVTess( int num_v, std::vector<double> &vtess, const int &n_cap
         vmin += TMAGIC;
         vmax -= TMAGIC;
 
+        vector < double > t( nv );
+        for ( int j = 0; j < nv; ++j )
+        {
+            t[j] = Cluster( static_cast<double>( j ) / ( nv - 1 ), m_TECluster, m_LECluster );
+        }
+        AdaptTess( t, vector < double > ( 1, vmin ), vector < double > ( 1, vmax ), false, 1 );
+        nv = t.size();
+
         vtess.resize(nv);
         int j = 0;
         if ( degen )
@@ -1302,7 +2101,7 @@ void VspSurf::MakeVTess( int num_v, std::vector<double> &vtess, const int &n_cap
         }
         for ( ; j < nv; ++j )
         {
-            vtess[j] = vmin + ( vmax - vmin ) * Cluster( static_cast<double>( j ) / ( nv - 1 ), m_TECluster, m_LECluster );
+            vtess[j] = vmin + ( vmax - vmin ) * t[j];
         }
         if ( degen )
         {
@@ -1346,7 +2145,23 @@ void VspSurf::MakeVTess( int num_v, std::vector<double> &vtess, const int &n_cap
         sit=std::unique( vtess.begin(), vtess.end() );
         vtess.resize( distance( vtess.begin(), sit ) );
     }
-    else // Magic values not employed on this surface.
+    else if ( m_AdaptTessFlag ) // Magic values not employed on this surface.
+    {
+        vector < double > t( nv );
+        for ( int j = 0; j < nv; ++j )
+        {
+            t[j] = static_cast<double>( j ) / ( nv - 1 );
+        }
+        AdaptTess( t, vector < double > ( 1, vmin ), vector < double > ( 1, vmax ), false, 1 );
+        nv = t.size();
+
+        vtess.resize(nv);
+        for ( int j = 0; j < nv; ++j )
+        {
+            vtess[j] = vmin + ( vmax - vmin ) * t[j];
+        }
+    }
+    else
     {
         vtess.resize(nv);
         for ( int j = 0; j < nv; ++j )
@@ -1415,61 +2230,90 @@ void VspSurf::SplitTesselate( const vector<int> &num_u, int num_v, std::vector<
 
 void VspSurf::Tesselate( const vector<double> &u, const vector<double> &v, std::vector< vector< vec3d > > & pnts,  std::vector< vector< vec3d > > & norms,  std::vector< vector< vec3d > > & uw_pnts ) const
 {
-    unsigned int nu = u.size();
-    unsigned int nv = v.size();
-
-    vector < vector < surface_point_type > > ptmat, nmat;
-
-    m_Surface.f_pt_normal_grid( u, v, ptmat, nmat);
+    int nu = u.size();
+    int nv = v.size();
 
     // resize pnts and norms
     pnts.resize( nu );
     norms.resize( nu );
     uw_pnts.resize( nu );
-    for ( surface_index_type i = 0; i < nu; ++i )
+    for ( int i = 0; i < nu; ++i )
     {
         pnts[i].resize( nv );
         norms[i].resize( nv );
         uw_pnts[i].resize( nv );
+    }
+
+    //==== Split Large Grids Into Blocks Of U Rows Evaluated Concurrently ====//
+    // Each block is a single grid evaluation, so basis functions are still shared
+    // along its rows.  Nested calls run on the calling thread.
+    int num_blocks = 1;
+#ifdef _OPENMP
+    if ( !omp_in_parallel() && nu * nv >= 4096 )
+    {
+        num_blocks = min( nu, 4 * omp_get_max_threads() );
+    }
+#endif
 
-        for ( surface_index_type j = 0; j < nv; j++ )
+    #pragma omp parallel for schedule( dynamic, 1 ) if ( num_blocks > 1 )
+    for ( int iblock = 0; iblock < num_blocks; iblock++ )
+    {
+        int istart = ( iblock * nu ) / num_blocks;
+        int iend = ( ( iblock + 1 ) * nu ) / num_blocks;
+
+        vector < double > ublock( u.begin() + istart, u.begin() + iend );
+        vector < vector < surface_point_type > > ptmat, nmat;
+
+        m_Surface.f_pt_normal_grid( ublock, v, ptmat, nmat );
+
+        for ( int i = istart; i < iend; i++ )
         {
-            pnts[i][j] = ptmat[i][j];
+            TesselateRow( u[i], v, ptmat[ i - istart ], nmat[ i - istart ], pnts[i], norms[i], uw_pnts[i] );
+        }
+    }
+}
+
+//==== Fill One Row Of A Tessellation From Evaluated Points And Normals ====//
+void VspSurf::TesselateRow( double u, const vector<double> &v, const vector < surface_point_type > &ptvec, const vector < surface_point_type > &nvec,
+                            vector< vec3d > & pnts, vector< vec3d > & norms, vector< vec3d > & uw_pnts ) const
+{
+    for ( int j = 0; j < ( int )v.size(); j++ )
+    {
+        pnts[j] = ptvec[j];
 
-            vec3d norm = nmat[i][j];
-            if ( norm.mag() < 1e-6 ) // Zero normal vector
+        vec3d norm = nvec[j];
+        if ( norm.mag() < 1e-6 ) // Zero normal vector
+        {
+            double tmax = GetWMax();
+            double thalf = 0.5 * GetWMax();
+            if ( v[j] <= TMAGIC ) // Near TE lower
             {
-                double tmax = GetWMax();
-                double thalf = 0.5 * GetWMax();
-                if ( v[j] <= TMAGIC ) // Near TE lower
-                {
-                    norm = CompNorm( u[i], TMAGIC + 1e-6 );
-                }
-                else if ( v[j] <= thalf && v[j] >= ( thalf - TMAGIC ) ) // Near leading edge
-                {
-                    norm = CompNorm( u[i], thalf - ( TMAGIC + 1e-6 ) );
-                }
-                else if ( v[j] >= thalf && v[j] <= ( thalf + TMAGIC ) ) // Near leading edge
-                {
-                    norm = CompNorm( u[i], thalf + TMAGIC + 1e-6 );
-                }
-                else if ( v[j] >= ( tmax - TMAGIC ) ) // Near TE upper
-                {
-                    norm = CompNorm( u[i], tmax - ( TMAGIC + 1e-6 ) );
-                }
-                norm.normalize();
+                norm = CompNorm( u, TMAGIC + 1e-6 );
             }
-
-            if ( m_FlipNormal )
+            else if ( v[j] <= thalf && v[j] >= ( thalf - TMAGIC ) ) // Near leading edge
             {
-                norms[i][j] = -1.0 * norm;
+                norm = CompNorm( u, thalf - ( TMAGIC + 1e-6 ) );
             }
-            else
+            else if ( v[j] >= thalf && v[j] <= ( thalf + TMAGIC ) ) // Near leading edge
             {
-                norms[i][j] = norm;
+                norm = CompNorm( u, thalf + TMAGIC + 1e-6 );
             }
-            uw_pnts[i][j].set_xyz( u[i], v[j], 0.0 );
+            else if ( v[j] >= ( tmax - TMAGIC ) ) // Near TE upper
+            {
+                norm = CompNorm( u, tmax - ( TMAGIC + 1e-6 ) );
+            }
+            norm.normalize();
         }
+
+        if ( m_FlipNormal )
+        {
+            norms[j] = -1.0 * norm;
+        }
+        else
+        {
+            norms[j] = norm;
+        }
+        uw_pnts[j].set_xyz( u, v[j], 0.0 );
     }
 }
 
@@ -1720,6 +2564,8 @@ void VspSurf::BuildFeatureLines( bool force_xsec_flag)
 
 bool VspSurf::CapUMin(int CapType, double len, double str, double offset, bool swflag)
 {
+    ClearPatchEval();
+
     if (CapType == vsp::NO_END_CAP)
     {
         ResetUWSkip();
@@ -1768,6 +2614,8 @@ bool VspSurf::CapUMin(int CapType, double len, double str, double offset, bool s
 
 bool VspSurf::CapUMax(int CapType, double len, double str, double offset, bool swflag)
 {
+    ClearPatchEval();
+
     if (CapType == vsp::NO_END_CAP)
     {
       ResetUWSkip();
@@ -2008,6 +2856,12 @@ void VspSurf::ToSTEP_BSpline_Quilt( STEPutil * step, vector<SdaiB_spline_surface
 {
     vector < piecewise_surface_type > surfvec = PrepCADSurfs( splitsurf, tocubic, tol, trimte, USplit, WSplit );
 
+    ToSTEP_BSpline_Quilt( step, surfs, surfvec, splitsurf, mergepts );
+}
+
+//==== Write Surfaces Already Prepared By PrepCADSurfs ====//
+void VspSurf::ToSTEP_BSpline_Quilt( STEPutil * step, vector<SdaiB_spline_surface_with_knots *> &surfs, const vector < piecewise_surface_type > &surfvec, bool splitsurf, bool mergepts )
+{
     //==== Compute Tol ====//
     BndBox bbox;
     GetBoundingBox( bbox );
@@ -2044,6 +2898,12 @@ void VspSurf::ToIGES( IGESutil* iges, bool splitsurf, bool tocubic, double tol,
 {
     vector < piecewise_surface_type > surfvec = PrepCADSurfs( splitsurf, tocubic, tol, trimTE, USplit, WSplit );
 
+    ToIGES( iges, surfvec, splitsurf, labelprefix, labelSplitNo, delim );
+}
+
+//==== Write Surfaces Already Prepared By PrepCADSurfs ====//
+void VspSurf::ToIGES( IGESutil* iges, const vector < piecewise_surface_type > &surfvec, bool splitsurf, const string &labelprefix, bool labelSplitNo, const string &delim )
+{
     for ( int is = 0; is < surfvec.size(); is++ )
     {
         piecewise_surface_type s = surfvec[is];
@@ -2107,6 +2967,8 @@ vector < piecewise_surface_type > VspSurf::PrepCADSurfs( bool splitsurf, bool to
 
 void VspSurf::Offset( const vec3d &offvec )
 {
+    ClearPatchEval();
+
     threed_point_type p;
     p << offvec.x(), offvec.y(), offvec.z();
 
@@ -2133,26 +2995,36 @@ void VspSurf::OffsetZ( double z )
 
 void VspSurf::Scale( double s )
 {
+    ClearPatchEval();
+
     m_Surface.scale( s );
 }
 
 void VspSurf::ScaleX( double s )
 {
+    ClearPatchEval();
+
     m_Surface.scale_x( s );
 }
 
 void VspSurf::ScaleY( double s )
 {
+    ClearPatchEval();
+
     m_Surface.scale_y( s );
 }
 
 void VspSurf::ScaleZ( double s )
 {
+    ClearPatchEval();
+
     m_Surface.scale_z( s );
 }
 
 void VspSurf::MakePlaneSurf( const vec3d &ptA, const vec3d &ptB, const vec3d &ptC, const vec3d &ptD )
 {
+    ClearPatchEval();
+
     // This function is used to construct a plane, using the four inputs as corner points
     // If the inputs are not truly planar, the function will work, but the surface will be 
     // constructed via bi-linear interpolation
@@ -40,8 +40,43 @@ typedef eli::geom::surface::connection_data<double, 3, surface_tolerance_type> r
 
 #include <vector>
 #include <string>
+#include <memory>
 using std::vector;
 
+//==== Result Of The Last Rib Skin, Tied To One Surface Object ====//
+// Copies start empty so surfaces copied for symmetry or output don't carry it.
+class VspSkinCache
+{
+public:
+    VspSkinCache()                                          {}
+    VspSkinCache( const VspSkinCache & )                    {}
+    VspSkinCache & operator=( const VspSkinCache & )        { m_Surface.clear(); return *this; }
+
+    piecewise_surface_type m_Surface;
+};
+
+//==== Control Points Of The Degree 1 And 3 Patches, Laid Out For Direct Evaluation ====//
+// Eval matches Code-Eli's patch lookup and returns false where the generic
+// Code-Eli evaluation must be used (other degrees or out of range parameters).
+class VspPatchEval
+{
+public:
+    enum { EVAL_PNT, EVAL_TAN_U, EVAL_TAN_W };
+
+    void Build( const piecewise_surface_type & surf );
+    bool Eval( double u, double w, int type, vec3d & rtn ) const;
+
+protected:
+    static bool FindPatch( const vector < double > & pmap, double p, int & k, double & t );
+
+    vector < double > m_UMap;                   // Patch boundaries
+    vector < double > m_WMap;
+    vector < int > m_DegU;                      // Per patch, u major
+    vector < int > m_DegW;
+    vector < int > m_Offset;                    // First control point value in m_CP
+    vector < double > m_CP;                     // x, y, z of each control point, u major
+};
+
 void SplitSurfsU( vector< piecewise_surface_type > &surfvec, const vector < double > &USplit );
 void SplitSurfsW( vector< piecewise_surface_type > &surfvec, const vector < double > &WSplit );
 
@@ -110,6 +145,7 @@ public:
 
     double FindNearest01( double &u, double &w, const vec3d &pt ) const;
     double FindNearest01( double &u, double &w, const vec3d &pt, const double &u0, const double &w0 ) const;
+    void FindNearest01( const vector < vec3d > &pts, vector < double > &us, vector < double > &ws, vector < double > &ds ) const;
 
     void FindDistanceAngle( double &u, double &w, const vec3d &pt, const vec3d &dir, const double &d, const double &theta, const double &u0, const double &w0 ) const;
     void GuessDistanceAngle( double &du, double &dw, const vec3d &udir, const vec3d & wdir, const double &d, const double &theta ) const;
@@ -141,6 +177,9 @@ public:
     vec3d CompNorm( double u, double v ) const;
     vec3d CompNorm01( double u, double v ) const;
 
+    void CompPnt01( const vector < double > &us, const vector < double > &ws, vector < vec3d > &pts ) const;
+    void CompNorm01( const vector < double > &us, const vector < double > &ws, vector < vec3d > &norms ) const;
+
     void CompCurvature( double u, double w, double& k1, double& k2, double& ka, double& kg ) const;
     void CompCurvature01( double u, double w, double& k1, double& k2, double& ka, double& kg ) const;
 
@@ -172,6 +211,7 @@ public:
 
     void SetClustering( const double &le, const double &te );
     void SetRootTipClustering( const vector < double > &root, const vector < double > &tip );
+    void SetAdaptTess( bool flag, double tol );
 
     void MakeUTess( const vector<int> &num_u, std::vector<double> &utess, const std::vector<int> & umerge ) const;
     void MakeVTess( int num_v, std::vector<double> &vtess, const int &n_cap, bool degen ) const;
@@ -196,18 +236,24 @@ public:
 
     void ToSTEP_Bez_Patches( STEPutil * step, vector<SdaiBezier_surface *> &surfs );
     void ToSTEP_BSpline_Quilt( STEPutil * step, vector<SdaiB_spline_surface_with_knots *> &surfs, bool splitsurf, bool mergepts, bool tocubic, double tol, bool trimte, const vector < double > &USplit, const vector < double > &WSplit );
+    void ToSTEP_BSpline_Quilt( STEPutil * step, vector<SdaiB_spline_surface_with_knots *> &surfs, const vector < piecewise_surface_type > &surfvec, bool splitsurf, bool mergepts );
 
     void ToIGES( IGESutil* iges, bool splitsurf, bool tocubic, double tol, bool trimTE, const vector < double > &USplit, const vector < double > &WSplit, const string &labelprefix, bool labelSplitNo, const string &delim );
+    void ToIGES( IGESutil* iges, const vector < piecewise_surface_type > &surfvec, bool splitsurf, const string &labelprefix, bool labelSplitNo, const string &delim );
 
-    // Apply STEP or IGES settings to this VSPSurf in preparation for export
+    // Apply STEP or IGES settings to this VSPSurf in preparation for export.
+    // Only reads this surface, so surfaces may be prepared concurrently.
     vector < piecewise_surface_type > PrepCADSurfs( bool splitsurf, bool tocubic, double tol, bool trimTE, const vector < double >& USplit, const vector < double >& WSplit );
 
     void SetUSkipFirst( bool f );
     void SetUSkipLast( bool f );
     void SetWSkipFirst( bool f );
     void SetWSkipLast( bool f );
+    const vector < bool > & GetUSkip() const                { return m_USkip; }
+    const vector < bool > & GetWSkip() const                { return m_WSkip; }
 
-    piecewise_surface_type* GetBezierSurface()           { return &m_Surface; }
+    // Callers may change the surface through this pointer.
+    piecewise_surface_type* GetBezierSurface()           { ClearPatchEval(); return &m_Surface; }
 
     enum { SKIN_NONE, SKIN_BODY_REV, SKIN_RIBS };
 
@@ -233,6 +279,8 @@ public:
     int GetNumSectU() const;
     int GetNumSectW() const;
 
+    size_t MemoryUsage() const;                             // Approximate, for memory accounting
+
     void Offset( const vec3d &offvec );
     void OffsetX( double x );
     void OffsetY( double y );
@@ -252,10 +300,21 @@ public:
 protected:
 
     void Tesselate( const vector<double> &utess, const vector<double> &vtess, std::vector< vector< vec3d > > & pnts,  std::vector< vector< vec3d > > & norms,  std::vector< vector< vec3d > > & uw_pnts ) const;
+    void TesselateRow( double u, const vector<double> &v, const vector < piecewise_surface_type::point_type > &ptvec, const vector < piecewise_surface_type::point_type > &nvec,
+                       vector< vec3d > & pnts, vector< vec3d > & norms, vector< vec3d > & uw_pnts ) const;
     void SplitTesselate( const vector<double> &usplit, const vector<double> &vsplit, const vector<double> &u, const vector<double> &v, std::vector< vector< vector< vec3d > > > & pnts,  std::vector< vector< vector< vec3d > > > & norms ) const;
 
+    void SortByPatch01( const vector < double > &us, const vector < double > &ws, vector < int > &order ) const;
+
+    void AdaptTess( vector < double > &t, const vector < double > &p0, const vector < double > &p1, bool udir, int nmult ) const;
+
     static bool CheckValidPatch( const piecewise_surface_type &surf );
 
+    //==== Fixed Degree Evaluators, Built On First Use And Shared Read Only By Copies ====//
+    const VspPatchEval * GetPatchEval() const;
+    void ClearPatchEval();
+    mutable std::shared_ptr < const VspPatchEval > m_PatchEval;
+
     bool m_FlipNormal;
     bool m_MagicVParm;
     bool m_HalfBOR;
@@ -275,6 +334,10 @@ protected:
     vector < double > m_RootCluster;
     vector < double > m_TipCluster;
 
+    // Curvature adaptive tessellation, tolerance on chord deviation over chord length
+    bool m_AdaptTessFlag;
+    double m_AdaptTessTol;
+
 
     //==== Store Skinning Inputs =====//
     int m_SkinType;
@@ -283,6 +346,7 @@ protected:
     vector< int > m_SkinDegreeVec;
     vector< double > m_SkinParmVec;
     int m_SkinClosedFlag;
+    VspSkinCache m_SkinCache;
 
     int m_CloneIndex;
     Matrix4d m_CloneMat;
@@ -7,6 +7,8 @@
 #include "main.h"
 #include "VSP_Geom_API.h"
 #include "DesignVarMgr.h"
+#include "ScriptMgr.h"
+#include "ResultsMgr.h"
 
 // Bitwise adds ecode to the current exit status code and returns to current exit status code
 int vsp_add_and_get_estatus( unsigned int ecode )
@@ -23,6 +25,245 @@ void vsp_exit()
     exit( exit_status );
 }
 
+//==== Split A Server Command Line Into Words - Double Quotes Group Words ====//
+static vector< string > splitServerLine( const string & line )
+{
+    vector< string > words;
+    string word;
+    bool in_word = false;
+    bool in_quote = false;
+
+    for ( int i = 0 ; i < ( int )line.size() ; i++ )
+    {
+        char c = line[i];
+        if ( c == '"' )
+        {
+            in_quote = !in_quote;
+            in_word = true;
+        }
+        else if ( !in_quote && ( c == ' ' || c == '\t' || c == '\r' || c == '\n' ) )
+        {
+            if ( in_word )
+            {
+                words.push_back( word );
+                word.clear();
+            }
+            in_word = false;
+        }
+        else
+        {
+            word.push_back( c );
+            in_word = true;
+        }
+    }
+    if ( in_word )
+    {
+        words.push_back( word );
+    }
+    return words;
+}
+
+//==== Read One Line Of Any Length ====//
+static bool readServerLine( FILE* in, string & line )
+{
+    line.clear();
+
+    char buff[512];
+    while ( fgets( buff, 512, in ) )
+    {
+        line.append( buff );
+        if ( line[ line.size() - 1 ] == '\n' )
+        {
+            return true;
+        }
+    }
+    return !line.empty();
+}
+
+//==== Report Status Of The Last Command ====//
+static void serverStatus( FILE* out )
+{
+    if ( vsp::ErrorMgr.GetErrorLastCallFlag() && vsp::ErrorMgr.GetNumTotalErrors() > 0 )
+    {
+        vsp::ErrorObj err = vsp::ErrorMgr.PopLastError();
+        fprintf( out, "ERR %d %s\n", ( int )err.GetErrorCode(), err.GetErrorString().c_str() );
+    }
+    else
+    {
+        fprintf( out, "OK\n" );
+    }
+}
+
+//=====================================================//
+//===== Server Mode - Run Commands From A Pipe    =====//
+//=====================================================//
+// Keeps the vehicle, script engine and analyses resident and runs one
+// command per line read from in.  Every command is answered on out with
+// any data lines followed by a final OK or ERR <code> <message> line.
+//
+//   load <file>                                Clear the model and read a file
+//   clear                                      Clear the model
+//   set <parm_id> <val>                        Set a parm by ID
+//   setname <container_id> <parm> <group> <val> Set a parm by name
+//   get <parm_id>                              VAL <val>
+//   update                                     Update the vehicle
+//   defaults <analysis>                        Reset analysis inputs
+//   input <analysis> <name> int|double|string <val> ...
+//   run <analysis>                             RESULT <results_id>
+//   results <results_id>                       Results table lines, then END
+//   delresults <results_id>                    Delete a results entry
+//   script <file> [function]                   Run a script function
+//   quit                                       Exit server mode
+int serverMode( Vehicle* vPtr, FILE* in, FILE* out )
+{
+    string line;
+
+    fprintf( out, "READY %s\n", VSPVERSION1 );
+    fflush( out );
+
+    while ( readServerLine( in, line ) )
+    {
+        vector< string > words = splitServerLine( line );
+        if ( words.empty() )
+        {
+            continue;
+        }
+
+        const string & cmd = words[0];
+        int nword = ( int )words.size();
+
+        vsp::ErrorMgr.NoError();
+
+        if ( cmd == "quit" || cmd == "exit" )
+        {
+            fprintf( out, "OK\n" );
+            fflush( out );
+            break;
+        }
+        else if ( cmd == "load" && nword == 2 )
+        {
+            vsp::ClearVSPModel();
+            vsp::ReadVSPFile( words[1] );
+            serverStatus( out );
+        }
+        else if ( cmd == "clear" )
+        {
+            vsp::ClearVSPModel();
+            serverStatus( out );
+        }
+        else if ( cmd == "set" && nword == 3 )
+        {
+            vsp::SetParmVal( words[1], atof( words[2].c_str() ) );
+            serverStatus( out );
+        }
+        else if ( cmd == "setname" && nword == 5 )
+        {
+            vsp::SetParmVal( words[1], words[2], words[3], atof( words[4].c_str() ) );
+            serverStatus( out );
+        }
+        else if ( cmd == "get" && nword == 2 )
+        {
+            double val = vsp::GetParmVal( words[1] );
+            if ( !vsp::ErrorMgr.GetErrorLastCallFlag() )
+            {
+                fprintf( out, "VAL %.17g\n", val );
+            }
+            serverStatus( out );
+        }
+        else if ( cmd == "update" )
+        {
+            vsp::Update();
+            serverStatus( out );
+        }
+        else if ( cmd == "defaults" && nword == 2 )
+        {
+            vsp::SetAnalysisInputDefaults( words[1] );
+            serverStatus( out );
+        }
+        else if ( cmd == "input" && nword >= 5 )
+        {
+            const string & type = words[3];
+            if ( type == "int" )
+            {
+                vector< int > vals;
+                for ( int i = 4 ; i < nword ; i++ )
+                {
+                    vals.push_back( atoi( words[i].c_str() ) );
+                }
+                vsp::SetIntAnalysisInput( words[1], words[2], vals );
+                serverStatus( out );
+            }
+            else if ( type == "double" )
+            {
+                vector< double > vals;
+                for ( int i = 4 ; i < nword ; i++ )
+                {
+                    vals.push_back( atof( words[i].c_str() ) );
+                }
+                vsp::SetDoubleAnalysisInput( words[1], words[2], vals );
+                serverStatus( out );
+            }
+            else if ( type == "string" )
+            {
+                vector< string > vals( words.begin() + 4, words.end() );
+                vsp::SetStringAnalysisInput( words[1], words[2], vals );
+                serverStatus( out );
+            }
+            else
+            {
+                fprintf( out, "ERR %d Unknown input type %s\n", ( int )vsp::VSP_INVALID_TYPE, type.c_str() );
+            }
+        }
+        else if ( cmd == "run" && nword == 2 )
+        {
+            string res_id = vsp::ExecAnalysis( words[1] );
+            if ( !res_id.empty() )
+            {
+                fprintf( out, "RESULT %s\n", res_id.c_str() );
+            }
+            serverStatus( out );
+        }
+        else if ( cmd == "results" && nword == 2 )
+        {
+            if ( ResultsMgr.ValidResultsID( words[1] ) )
+            {
+                ResultsMgr.PrintResults( out, words[1] );
+                fprintf( out, "END\n" );
+                fprintf( out, "OK\n" );
+            }
+            else
+            {
+                fprintf( out, "ERR %d Invalid results ID %s\n", ( int )vsp::VSP_INVALID_ID, words[1].c_str() );
+            }
+        }
+        else if ( cmd == "delresults" && nword == 2 )
+        {
+            vsp::DeleteResult( words[1] );
+            serverStatus( out );
+        }
+        else if ( cmd == "script" && ( nword == 2 || nword == 3 ) )
+        {
+            if ( nword == 3 )
+            {
+                vPtr->RunScript( words[1], words[2] );
+            }
+            else
+            {
+                vPtr->RunScript( words[1] );
+            }
+            fprintf( out, "OK\n" );
+        }
+        else
+        {
+            fprintf( out, "ERR %d Unknown command %s\n", ( int )vsp::VSP_CANT_FIND_NAME, cmd.c_str() );
+        }
+
+        fflush( out );
+    }
+
+    return 1;
+}
+
 //=====================================================//
 //===== Batch Mode Check - Parse the Command Line =====//
 //=====================================================//
@@ -34,6 +275,7 @@ int batchMode( int argc, char *argv[], Vehicle* vPtr )
     int desModeFlag = 0;
     int xddmModeFlag = 0;
     int genDocFlag = 0;
+    int serverModeFlag = 0;
     int vspFileFlag = 0;
 
     string vsp_filename;
@@ -53,6 +295,13 @@ int batchMode( int argc, char *argv[], Vehicle* vPtr )
                 scriptModeFlag = 1;
             }
         }
+        else if ( strcmp( argv[i], "-scriptcache" ) == 0 )
+        {
+            if ( i + 1 < argc )
+            {
+                ScriptMgr.SetByteCodeCacheDir( string( argv[++i] ) );
+            }
+        }
         else if ( strcmp( argv[i], "-des" ) == 0 )
         {
             if ( i + 1 < argc )
@@ -69,6 +318,10 @@ int batchMode( int argc, char *argv[], Vehicle* vPtr )
                 xddmModeFlag = 1;
             }
         }
+        else if ( strcmp( argv[i], "-server" ) == 0 )
+        {
+            serverModeFlag = 1;
+        }
         else if ( strcmp( argv[i], "-doc" ) == 0 )
         {
             genDocFlag = 1;
@@ -92,6 +345,8 @@ int batchMode( int argc, char *argv[], Vehicle* vPtr )
             printf( "  -help              This message\n" );
             printf( "  -des <desfile>     Set variables according to *.des file\n" );
             printf( "  -xddm <xddmfile>   Set variables according to *.xddm file\n" );
+            printf( "  -scriptcache <dir> Cache compiled scripts in <dir>\n" );
+            printf( "  -server            Run commands read from stdin, one per line\n" );
             printf( "  -doc               Generate an API header file for Doxygen (openvsp_as.h)\n" );
             printf( "\n" );
             printf( "-----------------------------------------------------------\n" );
@@ -123,6 +378,11 @@ int batchMode( int argc, char *argv[], Vehicle* vPtr )
         return 1; // Exit VSP
     }
 
+    if ( serverModeFlag )
+    {
+        return serverMode( vPtr, stdin, stdout );
+    }
+
     if ( scriptModeFlag )
     {
         // Read Script File
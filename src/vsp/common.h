@@ -12,5 +12,6 @@
 int vsp_add_and_get_estatus( unsigned int ecode );
 void vsp_exit();
 int batchMode( int argc, char *argv[], Vehicle* vPtr );
+int serverMode( Vehicle* vPtr, FILE* in, FILE* out );
 
 #endif // VSPCOMMON__INCLUDED_
@@ -0,0 +1,533 @@
+//
+// This file is released under the terms of the NASA Open Source Agreement (NOSA)
+// version 1.3 as detailed in the LICENSE file which accompanies this software.
+//
+
+// vspbench_main.cpp: Timing benchmarks for the main OpenVSP computations.
+//
+// Builds canonical transport, fighter and multi-rotor models, scales their
+// tessellation, times each computation and writes the timings as JSON.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "main.h"
+#include "VSP_Geom_API.h"
+#include "FileUtil.h"
+
+using std::string;
+using std::vector;
+
+//==== Benchmark Settings ====//
+struct BenchOptions
+{
+    BenchOptions()
+    {
+        m_Tess = 1.0;
+        m_Repeat = 3;
+        m_NumRotor = 8;
+        m_OutFile = "vspbench.json";
+    }
+
+    double m_Tess;                      // Multiplies every tessellation Parm and divides mesh edge lengths
+    int m_Repeat;
+    int m_NumRotor;
+    string m_OutFile;
+    vector< string > m_ModelVec;
+    vector< string > m_StageVec;
+};
+
+//==== Timings Of One Stage On One Model ====//
+struct BenchResult
+{
+    string m_Model;
+    string m_Stage;
+    vector< double > m_Seconds;
+};
+
+//==== Model Under Test ====//
+struct BenchModel
+{
+    string m_Name;
+    string m_UpdateGeomID;              // Geom driven by the Update stage
+    string m_UpdateParm;
+    string m_UpdateGroup;
+    string m_FeaGeomID;                 // Geom carrying the FEA structure
+    bool m_FeaWingFlag;                 // Add spars and ribs, else skin only
+};
+
+static double WallTime()
+{
+    return std::chrono::duration< double >( std::chrono::steady_clock::now().time_since_epoch() ).count();
+}
+
+static bool Contains( const vector< string > & vec, const string & val )
+{
+    return vec.empty() || std::find( vec.begin(), vec.end(), val ) != vec.end();
+}
+
+static void SplitList( const string & str, vector< string > & vec )
+{
+    vec.clear();
+    size_t start = 0;
+    while ( start <= str.size() )
+    {
+        size_t end = str.find( ',', start );
+        if ( end == string::npos )
+        {
+            end = str.size();
+        }
+        if ( end > start )
+        {
+            vec.push_back( str.substr( start, end - start ) );
+        }
+        start = end + 1;
+    }
+}
+
+//==== Tessellation Knob ====//
+static void ScaleTessParm( const string & parm_id, double tess )
+{
+    if ( !parm_id.empty() )
+    {
+        vsp::SetParmVal( parm_id, std::max( 2.0, ( double )( int )( vsp::GetParmVal( parm_id ) * tess + 0.5 ) ) );
+    }
+}
+
+static void ScaleTess( const string & geom_id, double tess )
+{
+    ScaleTessParm( vsp::GetParm( geom_id, "Tess_W", "Shape" ), tess );
+
+    int num_surf = vsp::GetNumXSecSurfs( geom_id );
+    if ( num_surf == 0 )
+    {
+        ScaleTessParm( vsp::GetParm( geom_id, "Tess_U", "Shape" ), tess );
+    }
+
+    for ( int s = 0 ; s < num_surf ; s++ )
+    {
+        string xsec_surf_id = vsp::GetXSecSurf( geom_id, s );
+        for ( int i = 0 ; i < vsp::GetNumXSec( xsec_surf_id ) ; i++ )
+        {
+            ScaleTessParm( vsp::GetXSecParm( vsp::GetXSec( xsec_surf_id, i ), "SectTess_U" ), tess );
+        }
+    }
+
+    // Lookups of Parms a Geom type does not have are expected
+    while ( vsp::ErrorMgr.GetNumTotalErrors() > 0 )
+    {
+        vsp::ErrorMgr.PopLastError();
+    }
+}
+
+//==== Geometry Helpers ====//
+static string AddWing( const string & name, double span, double root_chord, double tip_chord, double sweep,
+                       double x, double z, double rot_x, bool sym )
+{
+    string wing_id = vsp::AddGeom( "WING" );
+    vsp::SetGeomName( wing_id, name );
+    vsp::SetParmVal( wing_id, "Span", "XSec_1", span );
+    vsp::SetParmVal( wing_id, "Root_Chord", "XSec_1", root_chord );
+    vsp::SetParmVal( wing_id, "Tip_Chord", "XSec_1", tip_chord );
+    vsp::SetParmVal( wing_id, "Sweep", "XSec_1", sweep );
+    vsp::SetParmVal( wing_id, "X_Rel_Location", "XForm", x );
+    vsp::SetParmVal( wing_id, "Z_Rel_Location", "XForm", z );
+    vsp::SetParmVal( wing_id, "X_Rel_Rotation", "XForm", rot_x );
+    if ( !sym )
+    {
+        vsp::SetParmVal( wing_id, "Sym_Planar_Flag", "Sym", 0 );
+    }
+    return wing_id;
+}
+
+static string AddPod( const string & name, double length, double fine_ratio, double x, double y, double z, bool sym )
+{
+    string pod_id = vsp::AddGeom( "POD" );
+    vsp::SetGeomName( pod_id, name );
+    vsp::SetParmVal( pod_id, "Length", "Design", length );
+    vsp::SetParmVal( pod_id, "FineRatio", "Design", fine_ratio );
+    vsp::SetParmVal( pod_id, "X_Rel_Location", "XForm", x );
+    vsp::SetParmVal( pod_id, "Y_Rel_Location", "XForm", y );
+    vsp::SetParmVal( pod_id, "Z_Rel_Location", "XForm", z );
+    if ( sym )
+    {
+        vsp::SetParmVal( pod_id, "Sym_Planar_Flag", "Sym", vsp::SYM_XZ );
+    }
+    return pod_id;
+}
+
+static void AddWingStructure( const string & wing_id, int num_rib )
+{
+    int struct_ind = vsp::AddFeaStruct( wing_id );
+
+    vsp::AddFeaPart( wing_id, struct_ind, vsp::FEA_SPAR );
+    string aft_spar_id = vsp::AddFeaPart( wing_id, struct_ind, vsp::FEA_SPAR );
+    vsp::SetParmVal( vsp::FindParm( aft_spar_id, "RelCenterLocation", "FeaPart" ), 0.7 );
+
+    for ( int i = 0 ; i < num_rib ; i++ )
+    {
+        string rib_id = vsp::AddFeaPart( wing_id, struct_ind, vsp::FEA_RIB );
+        vsp::SetParmVal( vsp::FindParm( rib_id, "RelCenterLocation", "FeaPart" ), ( i + 1.0 ) / ( num_rib + 1.0 ) );
+    }
+}
+
+//==== Canonical Models ====//
+static BenchModel BuildTransport()
+{
+    BenchModel model;
+    model.m_Name = "transport";
+
+    string fuse_id = vsp::AddGeom( "FUSELAGE" );
+    vsp::SetGeomName( fuse_id, "Fuselage" );
+    vsp::SetParmVal( fuse_id, "Length", "Design", 40.0 );
+
+    string wing_id = AddWing( "Wing", 17.0, 7.0, 1.5, 30.0, 14.0, -1.0, 0.0, true );
+    AddWing( "HTail", 6.0, 3.5, 1.2, 35.0, 34.0, 0.5, 0.0, true );
+    AddWing( "VTail", 7.0, 5.0, 1.8, 40.0, 33.0, 1.0, 90.0, false );
+    AddPod( "Nacelle", 4.5, 2.5, 12.0, 6.0, -2.0, true );
+
+    model.m_UpdateGeomID = wing_id;
+    model.m_UpdateParm = "Span";
+    model.m_UpdateGroup = "XSec_1";
+    model.m_FeaGeomID = wing_id;
+    model.m_FeaWingFlag = true;
+    return model;
+}
+
+static BenchModel BuildFighter()
+{
+    BenchModel model;
+    model.m_Name = "fighter";
+
+    string fuse_id = vsp::AddGeom( "FUSELAGE" );
+    vsp::SetGeomName( fuse_id, "Fuselage" );
+    vsp::SetParmVal( fuse_id, "Length", "Design", 16.0 );
+
+    string wing_id = AddWing( "Wing", 5.0, 6.5, 1.0, 45.0, 6.0, 0.0, 0.0, true );
+    AddWing( "HTail", 2.5, 2.5, 0.8, 40.0, 13.0, 0.0, 0.0, true );
+    string vtail_id = AddWing( "VTail", 3.0, 3.0, 1.0, 45.0, 12.0, 0.5, 70.0, true );
+    vsp::SetParmVal( vtail_id, "Y_Rel_Location", "XForm", 1.0 );
+    AddPod( "Intake", 5.0, 4.0, 4.0, 1.2, -0.3, true );
+
+    model.m_UpdateGeomID = wing_id;
+    model.m_UpdateParm = "Sweep";
+    model.m_UpdateGroup = "XSec_1";
+    model.m_FeaGeomID = wing_id;
+    model.m_FeaWingFlag = true;
+    return model;
+}
+
+static BenchModel BuildMultiRotor( int num_rotor )
+{
+    BenchModel model;
+    model.m_Name = "multirotor";
+
+    string body_id = AddPod( "Body", 3.0, 3.0, -1.5, 0.0, 0.0, false );
+
+    for ( int i = 0 ; i < num_rotor ; i++ )
+    {
+        double theta = 2.0 * 3.14159265358979 * i / num_rotor;
+
+        string arm_id = AddPod( "Arm", 2.5, 20.0, 0.0, 0.0, 0.0, false );
+        vsp::SetParmVal( arm_id, "Z_Rel_Rotation", "XForm", theta * 180.0 / 3.14159265358979 );
+
+        string prop_id = vsp::AddGeom( "PROP" );
+        vsp::SetGeomName( prop_id, "Rotor" );
+        vsp::SetParmVal( prop_id, "Diameter", "Design", 2.0 );
+        vsp::SetParmVal( prop_id, "X_Rel_Location", "XForm", 2.5 * cos( theta ) );
+        vsp::SetParmVal( prop_id, "Y_Rel_Location", "XForm", 2.5 * sin( theta ) );
+        vsp::SetParmVal( prop_id, "Z_Rel_Location", "XForm", 0.3 );
+        vsp::SetParmVal( prop_id, "Y_Rel_Rotation", "XForm", -90.0 );
+    }
+
+    model.m_UpdateGeomID = body_id;
+    model.m_UpdateParm = "Length";
+    model.m_UpdateGroup = "Design";
+    model.m_FeaGeomID = body_id;
+    model.m_FeaWingFlag = false;
+    return model;
+}
+
+static BenchModel BuildModel( const string & name, const BenchOptions & opt )
+{
+    vsp::VSPRenew();
+
+    BenchModel model;
+    if ( name == "fighter" )
+    {
+        model = BuildFighter();
+    }
+    else if ( name == "multirotor" )
+    {
+        model = BuildMultiRotor( opt.m_NumRotor );
+    }
+    else
+    {
+        model = BuildTransport();
+    }
+
+    vector< string > geom_vec = vsp::FindGeoms();
+    for ( int i = 0 ; i < ( int )geom_vec.size() ; i++ )
+    {
+        ScaleTess( geom_vec[i], opt.m_Tess );
+    }
+
+    if ( model.m_FeaWingFlag )
+    {
+        AddWingStructure( model.m_FeaGeomID, 8 );
+    }
+    else
+    {
+        vsp::AddFeaStruct( model.m_FeaGeomID );
+    }
+    vsp::SetFeaMeshVal( model.m_FeaGeomID, 0, vsp::CFD_MAX_EDGE_LEN, 0.5 / opt.m_Tess );
+    vsp::SetFeaMeshVal( model.m_FeaGeomID, 0, vsp::CFD_MIN_EDGE_LEN, 0.05 / opt.m_Tess );
+
+    vsp::SetVSP3FileName( "vspbench_" + model.m_Name + ".vsp3" );
+    vsp::Update();
+    vsp::ErrorMgr.PopErrorAndPrint( stdout );
+
+    return model;
+}
+
+//==== Stages ====//
+static void RunUpdate( const BenchModel & model )
+{
+    string parm_id = vsp::GetParm( model.m_UpdateGeomID, model.m_UpdateParm, model.m_UpdateGroup );
+    double val = vsp::GetParmVal( parm_id );
+
+    for ( int i = 0 ; i < 10 ; i++ )
+    {
+        vsp::SetParmVal( parm_id, val * ( 1.0 + 0.01 * ( i % 2 + 1 ) ) );
+        vsp::Update();
+    }
+    vsp::SetParmVal( parm_id, val );
+    vsp::Update();
+}
+
+static void RunStage( const string & stage, const BenchModel & model, const BenchOptions & opt )
+{
+    if ( stage == "Update" )
+    {
+        RunUpdate( model );
+    }
+    else if ( stage == "CompGeom" )
+    {
+        vsp::ComputeCompGeom( vsp::SET_ALL, false, vsp::NO_FILE_TYPE );
+    }
+    else if ( stage == "MassProps" )
+    {
+        vsp::ComputeMassProps( vsp::SET_ALL, ( int )( 20 * opt.m_Tess ) );
+    }
+    else if ( stage == "DegenGeom" )
+    {
+        vsp::ComputeDegenGeom( vsp::SET_ALL, vsp::NO_FILE_TYPE );
+    }
+    else if ( stage == "ParasiteDrag" )
+    {
+        vsp::SetAnalysisInputDefaults( "ParasiteDrag" );
+        vsp::ExecAnalysis( "ParasiteDrag" );
+    }
+    else if ( stage == "CFDMesh" )
+    {
+        vsp::SetCFDMeshVal( vsp::CFD_MAX_EDGE_LEN, 1.0 / opt.m_Tess );
+        vsp::SetCFDMeshVal( vsp::CFD_MIN_EDGE_LEN, 0.1 / opt.m_Tess );
+        vsp::ComputeCFDMesh( vsp::SET_ALL, vsp::NO_FILE_TYPE );
+    }
+    else if ( stage == "FEAMesh" )
+    {
+        vsp::ComputeFeaMesh( model.m_FeaGeomID, 0, vsp::FEA_STL_FILE_NAME );
+    }
+    else if ( stage == "VSPAERO" )
+    {
+        vsp::SetAnalysisInputDefaults( "VSPAEROComputeGeometry" );
+        vsp::ExecAnalysis( "VSPAEROComputeGeometry" );
+
+        vsp::SetAnalysisInputDefaults( "VSPAEROSweep" );
+        vsp::SetIntAnalysisInput( "VSPAEROSweep", "AlphaNpts", vector< int >( 1, 1 ) );
+        vsp::SetIntAnalysisInput( "VSPAEROSweep", "MachNpts", vector< int >( 1, 1 ) );
+        vsp::SetIntAnalysisInput( "VSPAEROSweep", "WakeNumIter", vector< int >( 1, 3 ) );
+        vsp::ExecAnalysis( "VSPAEROSweep" );
+    }
+
+    vsp::DeleteAllResults();
+}
+
+//==== JSON Output ====//
+static void WriteJSON( FILE* fid, const BenchOptions & opt, const vector< BenchResult > & result_vec )
+{
+    int num_thread = 1;
+#ifdef _OPENMP
+    num_thread = omp_get_max_threads();
+#endif
+
+    fprintf( fid, "{\n" );
+    fprintf( fid, "  \"version\": \"%s\",\n", VSPVERSION4 );
+    fprintf( fid, "  \"threads\": %d,\n", num_thread );
+    fprintf( fid, "  \"tess\": %g,\n", opt.m_Tess );
+    fprintf( fid, "  \"repeat\": %d,\n", opt.m_Repeat );
+    fprintf( fid, "  \"results\": [\n" );
+
+    for ( int i = 0 ; i < ( int )result_vec.size() ; i++ )
+    {
+        const BenchResult & res = result_vec[i];
+
+        double tmin = 0.0, tsum = 0.0;
+        for ( int j = 0 ; j < ( int )res.m_Seconds.size() ; j++ )
+        {
+            tmin = ( j == 0 ) ? res.m_Seconds[j] : std::min( tmin, res.m_Seconds[j] );
+            tsum += res.m_Seconds[j];
+        }
+        double tmean = res.m_Seconds.empty() ? 0.0 : tsum / res.m_Seconds.size();
+
+        fprintf( fid, "    { \"model\": \"%s\", \"stage\": \"%s\", \"min\": %.6f, \"mean\": %.6f, \"seconds\": [",
+                 res.m_Model.c_str(), res.m_Stage.c_str(), tmin, tmean );
+        for ( int j = 0 ; j < ( int )res.m_Seconds.size() ; j++ )
+        {
+            fprintf( fid, "%s%.6f", j ? ", " : " ", res.m_Seconds[j] );
+        }
+        fprintf( fid, " ] }%s\n", ( i + 1 < ( int )result_vec.size() ) ? "," : "" );
+    }
+
+    fprintf( fid, "  ]\n" );
+    fprintf( fid, "}\n" );
+}
+
+static void PrintUsage()
+{
+    printf( "Usage: vspbench [options]\n" );
+    printf( "  -model <list>   Comma separated models: transport, fighter, multirotor (default all)\n" );
+    printf( "  -stage <list>   Comma separated stages: Update, CompGeom, MassProps, DegenGeom,\n" );
+    printf( "                  ParasiteDrag, CFDMesh, FEAMesh, VSPAERO (default all)\n" );
+    printf( "  -tess <val>     Tessellation multiplier (default 1)\n" );
+    printf( "  -repeat <n>     Timed runs of each stage (default 3)\n" );
+    printf( "  -rotors <n>     Rotors on the multirotor model (default 8)\n" );
+    printf( "  -o <file>       JSON output file (default vspbench.json)\n" );
+}
+
+//========================================================//
+//========================= Main =========================//
+int main( int argc, char** argv )
+{
+    BenchOptions opt;
+
+    for ( int i = 1 ; i < argc ; i++ )
+    {
+        bool has_val = ( i + 1 < argc );
+
+        if ( strcmp( argv[i], "-model" ) == 0 && has_val )
+        {
+            SplitList( argv[++i], opt.m_ModelVec );
+        }
+        else if ( strcmp( argv[i], "-stage" ) == 0 && has_val )
+        {
+            SplitList( argv[++i], opt.m_StageVec );
+        }
+        else if ( strcmp( argv[i], "-tess" ) == 0 && has_val )
+        {
+            opt.m_Tess = std::max( 0.1, atof( argv[++i] ) );
+        }
+        else if ( strcmp( argv[i], "-repeat" ) == 0 && has_val )
+        {
+            opt.m_Repeat = std::max( 1, atoi( argv[++i] ) );
+        }
+        else if ( strcmp( argv[i], "-rotors" ) == 0 && has_val )
+        {
+            opt.m_NumRotor = std::max( 1, atoi( argv[++i] ) );
+        }
+        else if ( strcmp( argv[i], "-o" ) == 0 && has_val )
+        {
+            opt.m_OutFile = argv[++i];
+        }
+        else
+        {
+            PrintUsage();
+            return 1;
+        }
+    }
+
+    vsp::VSPCheckSetup();
+    vsp::ErrorMgr.PopErrorAndPrint( stdout );
+
+    const char* model_names[] = { "transport", "fighter", "multirotor" };
+    const char* stage_names[] = { "Update", "CompGeom", "MassProps", "DegenGeom", "ParasiteDrag", "CFDMesh", "FEAMesh", "VSPAERO" };
+
+#ifdef WIN32
+    string vspaero_cmd = "vspaero.exe";
+#else
+    string vspaero_cmd = "vspaero";
+#endif
+    bool vspaero_found = CheckForFile( vsp::GetVSPExePath(), vspaero_cmd );
+
+    vector< BenchResult > result_vec;
+
+    for ( int m = 0 ; m < 3 ; m++ )
+    {
+        if ( !Contains( opt.m_ModelVec, model_names[m] ) )
+        {
+            continue;
+        }
+
+        for ( int s = 0 ; s < 8 ; s++ )
+        {
+            string stage = stage_names[s];
+            if ( !Contains( opt.m_StageVec, stage ) )
+            {
+                continue;
+            }
+            if ( stage == "VSPAERO" && !vspaero_found )
+            {
+                printf( "%-12s %-14s skipped, VSPAERO solver not found\n", model_names[m], stage.c_str() );
+                continue;
+            }
+
+            // Each stage starts from a fresh model so caches from earlier stages do not help it
+            BenchModel model = BuildModel( model_names[m], opt );
+
+            BenchResult res;
+            res.m_Model = model.m_Name;
+            res.m_Stage = stage;
+
+            for ( int r = 0 ; r < opt.m_Repeat ; r++ )
+            {
+                vsp::InvalidateAnalysisCache();
+
+                double t0 = WallTime();
+                RunStage( stage, model, opt );
+                res.m_Seconds.push_back( WallTime() - t0 );
+            }
+            vsp::ErrorMgr.PopErrorAndPrint( stdout );
+
+            printf( "%-12s %-14s %10.4f s (first %.4f s)\n", res.m_Model.c_str(), stage.c_str(),
+                    *std::min_element( res.m_Seconds.begin(), res.m_Seconds.end() ), res.m_Seconds[0] );
+
+            result_vec.push_back( res );
+        }
+    }
+
+    FILE* fid = fopen( opt.m_OutFile.c_str(), "w" );
+    if ( !fid )
+    {
+        printf( "Could not open %s\n", opt.m_OutFile.c_str() );
+        return 1;
+    }
+    WriteJSON( fid, opt, result_vec );
+    fclose( fid );
+
+    printf( "Wrote %s\n", opt.m_OutFile.c_str() );
+
+    return 0;
+}
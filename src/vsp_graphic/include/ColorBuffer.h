@@ -26,6 +26,10 @@ public:
     */
     void bind();
     /*!
+    * Bind color buffer starting at a byte offset.
+    */
+    void bind( unsigned int offset );
+    /*!
     * Overwrite VBO, unbind color buffer.
     */
     void unbind();
@@ -0,0 +1,107 @@
+#ifndef _VSP_GRAPHIC_FRAME_STATS_H
+#define _VSP_GRAPHIC_FRAME_STATS_H
+
+namespace VSPGraphic
+{
+/*!
+* FrameStats Class.
+* Counts draw calls and uploaded buffer bytes between resets, and times
+* GPU drawing with timer queries.
+*/
+class FrameStats
+{
+public:
+    /*!
+    * Constructor.
+    */
+    FrameStats();
+    /*!
+    * Destructor.
+    */
+    virtual ~FrameStats();
+
+public:
+    /*!
+    * Return the static instance of FrameStats.
+    */
+    static FrameStats & getInstance()
+    {
+        static FrameStats instance;
+        return instance;
+    }
+
+public:
+    /*!
+    * Zero the draw call and upload counters.
+    */
+    void reset();
+
+    /*!
+    * Count one draw call.
+    */
+    void addDrawCall()
+    {
+        _drawCalls++;
+    }
+    /*!
+    * Count bytes uploaded to a buffer object.
+    */
+    void addUploadBytes( unsigned int bytes )
+    {
+        _uploadBytes += bytes;
+    }
+
+    /*!
+    * Draw calls since the last reset.
+    */
+    unsigned int getDrawCalls()
+    {
+        return _drawCalls;
+    }
+    /*!
+    * Bytes uploaded since the last reset.
+    */
+    double getUploadBytes()
+    {
+        return _uploadBytes;
+    }
+
+public:
+    /*!
+    * Enable or disable GPU timer queries.
+    */
+    void setGpuTiming( bool flag );
+    /*!
+    * Start timing GPU work.  Does nothing unless GPU timing is enabled.
+    */
+    void beginGpuTimer();
+    /*!
+    * Stop timing GPU work.
+    */
+    void endGpuTimer();
+    /*!
+    * GPU time in milliseconds of the latest finished query.  Results
+    * arrive a frame or two late, so reading them never stalls the pipeline.
+    */
+    double getGpuTime()
+    {
+        return _gpuTime;
+    }
+
+private:
+    unsigned int _drawCalls;
+    double _uploadBytes;
+
+    bool _gpuTiming;
+    bool _active;
+    int _current;
+    unsigned int _queries[2];
+    bool _pending[2];
+    double _gpuTime;
+};
+
+// FrameStats Singleton
+#define FrameStatsSingle FrameStats::getInstance()
+
+}
+#endif
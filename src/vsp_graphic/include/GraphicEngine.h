@@ -40,7 +40,9 @@ public:
     };
 
     /*!
-    * Dump screen data to JPEG image.
+    * Dump screen data to PNG image.
+    * With framebuffer support the image is drawn offscreen at any size,
+    * in tiles once it is larger than the framebuffer limits.
     */
     void dumpScreenImage( std::string fileName, int width, int height, bool transparentBG, bool framebufferSupported, int filetype );
 
@@ -61,9 +63,20 @@ public:
     */
     Display * getDisplay();
 
+private:
+    int _maxFramebufferSize();
+    bool _bindFramebuffer( int width, int height );
+    void _releaseFramebuffer();
+
 private:
     Scene * _scene;
     Display * _display;
+
+    unsigned int _fbo;
+    unsigned int _fboColor;
+    unsigned int _fboDepth;
+    int _fboWidth;
+    int _fboHeight;
 };
 }
 #endif
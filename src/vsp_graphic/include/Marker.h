@@ -2,6 +2,7 @@
 #define _VSP_GRAPHIC_MARKER_OBJECT_H
 
 #include "Renderable.h"
+#include "OpenGLHeaders.h"
 
 namespace VSPGraphic
 {
@@ -31,6 +32,12 @@ protected:
     */
     virtual void _draw();
 
+    /*!
+    * Draw a few points or lines computed at draw time, such as a ruler
+    * following the mouse.  Uses a buffer of its own, not _vBuffer.
+    */
+    void _drawOverlay( GLenum primitive, const std::vector< glm::vec3 > & pnts );
+
 private:
     void _draw_Points( float r, float g, float b, float a = 1.f, float size = 0.f );
     void _draw_Points();
@@ -40,6 +47,8 @@ private:
 
     void _draw_VBuffer();
     void _draw_EBuffer();
+
+    VertexBuffer * _overlayBuffer;
 };
 }
 #endif
@@ -37,6 +37,20 @@ public:
     * Get source.
     */
     Renderable * getSource();
+    /*!
+    * First color id in this Pickable's block.
+    */
+    unsigned int getIdStart()
+    {
+        return _colorIndexRange.start;
+    }
+    /*!
+    * Last color id in this Pickable's block.
+    */
+    unsigned int getIdEnd()
+    {
+        return _colorIndexRange.end;
+    }
 
 public:
     /*!
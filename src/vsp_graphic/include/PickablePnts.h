@@ -10,6 +10,7 @@
 namespace VSPGraphic
 {
 class Renderable;
+class VertexBuffer;
 
 /*!
 * Pickable Points.  Derived from Pickable.  This class
@@ -78,6 +79,9 @@ private:
     float _pickRange;
     float _pointSize;
     std::set< int > _highlightedId;
+
+    VertexBuffer * _hlBuffer;
+
 };
 }
 #endif
@@ -5,6 +5,8 @@
 #include "SceneObject.h"
 #include "glm/glm.hpp"
 
+#include <vector>
+
 namespace VSPGraphic
 {
 class VertexBuffer;
@@ -37,6 +39,10 @@ public:
     * Reset Vertex Buffer append location to start of the buffer.
     */
     virtual void emptyVBuffer();
+    /*!
+    * Replace the contents of Vertex Buffer with a block of data in one upload.
+    */
+    virtual void loadVBuffer( void * mem_ptr, unsigned int mem_size );
 
 public:
     /*!
@@ -49,11 +55,39 @@ public:
     */
     virtual void emptyEBuffer();
     /*!
+    * Replace the contents of Element Buffer with a block of data in one upload.
+    */
+    virtual void loadEBuffer( void * mem_ptr, unsigned int mem_size );
+    /*!
     * Enable or Disable Element Buffer usage.  Enable this will activate Element Indexing.
     * Disabled by default.
     */
     void enableEBuffer( bool enable );
 
+public:
+    /*!
+    * Replace the contents of a coarser level of detail Element Buffer.  Levels
+    * start at one, zero is the Element Buffer itself.
+    */
+    void loadLodEBuffer( unsigned int level, void * mem_ptr, unsigned int mem_size );
+    /*!
+    * Remove all coarser level of detail Element Buffers.
+    */
+    void clearLodEBuffers();
+    /*!
+    * Set bounding box of the vertex data, used to pick a level of detail
+    * from the size on screen and to skip objects outside the view.
+    */
+    void setBoundingBox( const glm::vec3 & min, const glm::vec3 & max );
+    /*!
+    * Get bounding box of all instances.  Return false if no bounding box is set.
+    */
+    bool getBoundingBox( glm::vec3 & min_out, glm::vec3 & max_out );
+    /*!
+    * Get a count that changes whenever the bounding box or instances change.
+    */
+    unsigned int getBoundRevision();
+
 public:
     /*!
     * Push a block of data from memory to the back of Color Buffer.
@@ -133,8 +167,34 @@ public:
     Common::VSPenum getRenderStyle();
     /*!
     * Get vertex at specific buffer index.
+    * With instances, indices run through every instance in turn, and the
+    * vertex is returned in its instance's transformed position.
     */
     glm::vec3 getVertexVec( unsigned int bufferIndex );
+    /*!
+    * Get number of vertices drawn, counting each instance.
+    */
+    unsigned int getInstancedVertexSize();
+
+public:
+    /*!
+    * Set instance transformations.  When not empty, the buffers hold one copy
+    * of the geometry, which is drawn once per transformation.  Empty by default.
+    */
+    void setInstances( const std::vector<glm::mat4> & xforms );
+    /*!
+    * Get number of times the buffers are drawn.  Always at least one.
+    */
+    unsigned int getNumInstances();
+    /*!
+    * Apply an instance transformation to the current model view matrix.
+    * Return true if the transformation mirrors, so polygon facing must flip.
+    */
+    bool pushInstance( unsigned int index );
+    /*!
+    * Restore model view matrix after pushInstance().
+    */
+    void popInstance();
 
 public:
     /*!
@@ -167,6 +227,12 @@ protected:
     float _getPointSize();
     float _getTextSize();
 
+    /*!
+    * Get the Element Buffer for the level of detail that suits the current
+    * model view, projection and viewport.
+    */
+    ElementBuffer * _getLodEBuffer();
+
 protected:
     struct Color
     {
@@ -190,6 +256,16 @@ private:
     bool _eBufferFlag, _cBufferFlag;
 
     bool _facingCWFlag;
+
+    std::vector<glm::mat4> _instances;
+
+    std::vector<ElementBuffer *> _lodEBuffers;
+
+    bool _boundFlag;
+    glm::vec3 _boundMin, _boundMax;
+    glm::vec3 _boundCenter;
+    float _boundRadius;
+    unsigned int _boundRevision;
 };
 }
 #endif
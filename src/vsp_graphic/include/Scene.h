@@ -7,6 +7,8 @@
 
 #include "Common.h"
 
+#include "glm/glm.hpp"
+
 namespace VSPGraphic
 {
 class Lighting;
@@ -136,7 +138,8 @@ public:
     */
     virtual void predraw();
     /*!
-    * Draw Scene.
+    * Draw Scene.  Objects with a bounding box outside the view frustum of the
+    * current projection and modelview matrix are skipped.
     */
     virtual void draw();
 
@@ -159,6 +162,24 @@ private:
     void _clearSelections();
     void _removeSelections(Renderable * source);
 
+    void _updateBVH();
+    int _buildBVH( int first, int count );
+    void _cullBVH( const glm::vec4 planes[6] );
+
+    /*
+    * Bounding Volume Hierarchy node.  Leaves hold a range of _bvhObjects,
+    * inner nodes hold two children.
+    */
+    struct BVHNode
+    {
+        glm::vec3 min;
+        glm::vec3 max;
+        int left;
+        int right;
+        int first;
+        int count;
+    };
+
 private:
     std::vector<SceneObject*> _sceneList;
     std::vector<Selectable*> _selections;
@@ -175,6 +196,17 @@ private:
 
     Pickable * _highlighted;
     std::set< PickablePnts* > _preselected;
+
+    // Hierarchy over bounded objects, rebuilt when objects or their bounds change.
+    std::vector<BVHNode> _bvhNodes;
+    std::vector<int> _bvhObjects;
+    std::vector<glm::vec3> _bvhMin;
+    std::vector<glm::vec3> _bvhMax;
+    std::vector<unsigned int> _bvhRevisions;
+    std::vector<SceneObject*> _bvhSceneList;
+
+    // Objects found outside the view frustum in the current draw.
+    std::vector<bool> _culled;
 };
 }
 #endif
@@ -6,6 +6,7 @@
 namespace VSPGraphic
 {
 class Renderable;
+class VertexBuffer;
 
 /*!
 * Selected Point.
@@ -42,6 +43,11 @@ protected:
 
 protected:
     unsigned int _index;
+
+private:
+    void _drawSelected();
+
+    VertexBuffer * _pntBuffer;
 };
 }
 #endif
@@ -17,6 +17,7 @@ namespace VSPGraphic
     public:
         /*!
         * Constructor.
+        * image - image to upload.  If NULL, the texture stays empty until load().
         */
         Texture2D( Image * image );
         /*!
@@ -33,6 +34,11 @@ namespace VSPGraphic
         */
         virtual void unbind();
 
+        /*!
+        * Upload image to this texture, replacing any image it holds.
+        */
+        virtual void load( Image * image );
+
         int getImWidth()
         {
             return _imWidth;
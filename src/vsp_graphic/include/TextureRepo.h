@@ -30,13 +30,31 @@ public:
     * fileName - file path + name of the texture file.
     */
     Texture2D * get2DTexture( const char * fileName );
+    /*!
+    * Get 2D texture to repository.  If deferLoad, a new texture is
+    * returned empty and its file is decoded later by loadPending(),
+    * so many new textures don't stall a single frame.
+    *
+    * fileName - file path + name of the texture file.
+    * deferLoad - queue decoding instead of loading now.
+    */
+    Texture2D * get2DTexture( const char * fileName, bool deferLoad );
+
+    /*!
+    * Decode and upload up to maxLoads queued textures.  Return true
+    * if queued textures remain.
+    */
+    bool loadPending( int maxLoads );
 
 private:
     struct TextureInfo
     {
         std::string fileName;
         Texture2D * texture;
+        bool pending;
     };
+
+    void _load( TextureInfo & tInfo );
     std::vector<TextureInfo> _textureRepo;
 };
 }
@@ -30,6 +30,13 @@ public:
     */
     virtual void append( void * mem_ptr, unsigned int mem_size );
     /*!
+    * Replace the contents of the buffer with a single upload.
+    * Reallocates storage if needed, without copying the old contents back.
+    * mem_ptr - data pointer.
+    * mem_size - data size in bytes.
+    */
+    virtual void load( void * mem_ptr, unsigned int mem_size );
+    /*!
     * Reset append location.  Does not dispose buffer.
     */
     virtual void empty();
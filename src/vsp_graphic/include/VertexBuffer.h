@@ -2,6 +2,9 @@
 #define _VSP_VERTEX_BUFFER_H
 
 #include "VBO.h"
+#include "glm/glm.hpp"
+
+#include <vector>
 
 namespace VSPGraphic
 {
@@ -31,6 +34,13 @@ public:
     */
     void drawElem( GLenum primitive, unsigned int index_size, void * indices );
 
+public:
+    /*!
+    * Replace the buffer contents with positions only.  Normals and texture
+    * coordinates are zeroed.  Used by overlays rebuilt every frame.
+    */
+    void loadPositions( const std::vector< glm::vec3 > & pnts );
+
 public:
     /*!
     * Return number of vertices.
@@ -5,11 +5,14 @@
 #include "Common.h"
 #include "glm/glm.hpp"
 
+#include <vector>
+
 namespace VSPGraphic
 {
 class TextMgr;
 class Camera;
 class Background;
+class VertexBuffer;
 
 /*!
 * Viewport Class.
@@ -47,6 +50,22 @@ public:
      */
     virtual void resizeViewport( int x, int y, int width, int height, float screenSizeDiffRatio );
 
+    /*!
+    * Render only the part of this viewport inside a tile of the full image.
+    * (x, y) - lower left corner of the tile in image pixels.
+    * The tile becomes the GL viewport, so images larger than the
+    * framebuffer can be drawn one tile at a time.
+    */
+    void setTile( int x, int y, int width, int height );
+    /*!
+    * Render the whole viewport again.
+    */
+    void clearTile();
+    /*!
+    * False if the current tile does not overlap this viewport.
+    */
+    bool inTile();
+
     /*!
     * Draw border.
     * If selected, draw border in red.
@@ -141,6 +160,10 @@ public:
     */
     void showGridOverlay( bool showFlag );
 
+private:
+    void _drawOverlay( GLenum primitive, const std::vector< glm::vec3 > & pnts );
+    void _loadTileProjection();
+
 private:
     int _x;
     int _y;
@@ -153,9 +176,18 @@ private:
 
     float _screenSizeDiffRatio;
 
+    bool _tiled;
+    int _tileX;
+    int _tileY;
+    int _tileWidth;
+    int _tileHeight;
+
     Camera* _camera;
     Background * _background;
 
+    VertexBuffer * _overlayBuffer;
+    VertexBuffer * _gridBuffer;
+
     TextMgr * _textMgr;
 };
 }
@@ -12,10 +12,15 @@ ColorBuffer::~ColorBuffer()
 }
 
 void ColorBuffer::bind()
+{
+    bind( 0 );
+}
+
+void ColorBuffer::bind( unsigned int offset )
 {
     // Bind Color Buffer
     VBO::bind();
-    glColorPointer( COLOR_SIZE, GL_UNSIGNED_BYTE, 0, ( void * )0 );
+    glColorPointer( COLOR_SIZE, GL_UNSIGNED_BYTE, 0, ( char * )0 + offset );
     VBO::unbind();
 
     // Enable Color Buffer
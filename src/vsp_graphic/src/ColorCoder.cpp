@@ -33,10 +33,11 @@ void ColorCoder::genCodeBlock( int size, unsigned int * start_out, unsigned int
                 newStart = _freelist[i].start;
 
                 _freelist[i].start += size;
-                if( _freelist[i].start == _freelist[i].end )
+                if( ( int )_freelist[i].start > _freelist[i].end )
                 {
                     _freelist.erase( _freelist.begin() + i );
                 }
+                break;
             }
         }
     }
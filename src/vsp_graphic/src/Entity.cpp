@@ -328,27 +328,35 @@ void Entity::_draw_Wire_EBuffer()
 
 void Entity::_draw_VBuffer()
 {
-    if( _getFacingCWFlag() )
+    for( unsigned int i = 0; i < getNumInstances(); i++ )
     {
-        glFrontFace(GL_CW);
-    }
-    else
-    {
-        glFrontFace(GL_CCW);
-    }
-
-    switch( getPrimType() )
-    {
-    case Common::VSP_TRIANGLES:
-        _vBuffer->draw( GL_TRIANGLES );
-        break;
-
-    case Common::VSP_QUADS:
-        _vBuffer->draw( GL_QUADS );
-        break;
-
-    default:
-        break;
+        // Mirrored instances reverse the winding.
+        bool mirrored = pushInstance( i );
+
+        if( _getFacingCWFlag() != mirrored )
+        {
+            glFrontFace(GL_CW);
+        }
+        else
+        {
+            glFrontFace(GL_CCW);
+        }
+
+        switch( getPrimType() )
+        {
+        case Common::VSP_TRIANGLES:
+            _vBuffer->draw( GL_TRIANGLES );
+            break;
+
+        case Common::VSP_QUADS:
+            _vBuffer->draw( GL_QUADS );
+            break;
+
+        default:
+            break;
+        }
+
+        popInstance();
     }
 
     glFrontFace(GL_CCW);
@@ -356,31 +364,42 @@ void Entity::_draw_VBuffer()
 
 void Entity::_draw_EBuffer()
 {
-    if( _getFacingCWFlag() )
-    {
-        glFrontFace(GL_CW);
-    }
-    else
-    {
-        glFrontFace(GL_CCW);
-    }
+    ElementBuffer * eBuffer;
 
-    switch( getPrimType() )
+    for( unsigned int i = 0; i < getNumInstances(); i++ )
     {
-    case Common::VSP_TRIANGLES:
-        _eBuffer->bind();
-        _vBuffer->drawElem( GL_TRIANGLES, _eBuffer->getElemSize(), ( void* )0 );
-        _eBuffer->unbind();
-        break;
-
-    case Common::VSP_QUADS:
-        _eBuffer->bind();
-        _vBuffer->drawElem( GL_QUADS, _eBuffer->getElemSize(), ( void* )0 );
-        _eBuffer->unbind();
-        break;
-
-    default:
-        break;
+        // Mirrored instances reverse the winding.
+        bool mirrored = pushInstance( i );
+
+        if( _getFacingCWFlag() != mirrored )
+        {
+            glFrontFace(GL_CW);
+        }
+        else
+        {
+            glFrontFace(GL_CCW);
+        }
+
+        switch( getPrimType() )
+        {
+        case Common::VSP_TRIANGLES:
+            _eBuffer->bind();
+            _vBuffer->drawElem( GL_TRIANGLES, _eBuffer->getElemSize(), ( void* )0 );
+            _eBuffer->unbind();
+            break;
+
+        case Common::VSP_QUADS:
+            eBuffer = _getLodEBuffer();
+            eBuffer->bind();
+            _vBuffer->drawElem( GL_QUADS, eBuffer->getElemSize(), ( void* )0 );
+            eBuffer->unbind();
+            break;
+
+        default:
+            break;
+        }
+
+        popInstance();
     }
 
     glFrontFace(GL_CCW);
@@ -0,0 +1,81 @@
+#include "OpenGLHeaders.h"
+#include "FrameStats.h"
+
+namespace VSPGraphic
+{
+FrameStats::FrameStats()
+{
+    _drawCalls = 0;
+    _uploadBytes = 0;
+
+    _gpuTiming = false;
+    _active = false;
+    _current = 0;
+    _queries[0] = _queries[1] = 0;
+    _pending[0] = _pending[1] = false;
+    _gpuTime = 0;
+}
+FrameStats::~FrameStats()
+{
+    // Queries are not deleted, the GL context is gone by the time the
+    // singleton is destroyed.
+}
+
+void FrameStats::reset()
+{
+    _drawCalls = 0;
+    _uploadBytes = 0;
+}
+
+void FrameStats::setGpuTiming( bool flag )
+{
+    static GLboolean supported = glewIsSupported( "GL_ARB_timer_query" );
+
+    _gpuTiming = flag && supported;
+}
+
+void FrameStats::beginGpuTimer()
+{
+    if( !_gpuTiming || _active )
+    {
+        return;
+    }
+
+    if( _queries[0] == 0 )
+    {
+        glGenQueries( 2, _queries );
+    }
+
+    // Alternate between two queries, collecting the older one's result.
+    if( _pending[_current] )
+    {
+        GLint available = 0;
+        glGetQueryObjectiv( _queries[_current], GL_QUERY_RESULT_AVAILABLE, &available );
+        if( !available )
+        {
+            return;
+        }
+
+        GLuint64 ns = 0;
+        glGetQueryObjectui64v( _queries[_current], GL_QUERY_RESULT, &ns );
+        _gpuTime = ( double )ns * 1.0e-6;
+        _pending[_current] = false;
+    }
+
+    glBeginQuery( GL_TIME_ELAPSED, _queries[_current] );
+    _active = true;
+}
+
+void FrameStats::endGpuTimer()
+{
+    if( !_active )
+    {
+        return;
+    }
+
+    glEndQuery( GL_TIME_ELAPSED );
+    _pending[_current] = true;
+    _current = 1 - _current;
+    _active = false;
+}
+}
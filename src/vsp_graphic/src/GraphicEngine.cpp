@@ -8,42 +8,53 @@
 #include "OpenGLHeaders.h"
 #include "stb_image_write.h"
 #include "LayoutMgr.h"
+#include "FrameStats.h"
 #include <string.h>
 
+#include <algorithm>
+
 #include <assert.h>
 
+#define MAX_TILE_SIZE 4096
+
 namespace VSPGraphic
 {
 GraphicEngine::GraphicEngine()
 {
     _scene = new Scene();
     _display = new Display();
+
+    _fbo = _fboColor = _fboDepth = 0;
+    _fboWidth = _fboHeight = 0;
 }
 GraphicEngine::~GraphicEngine()
 {
+    _releaseFramebuffer();
+
     delete _scene;
     delete _display;
 }
 
 void GraphicEngine::draw()
 {
+    FrameStatsSingle.beginGpuTimer();
     _display->draw( _scene, 0xFFFFFFFF, 0xFFFFFFFF );
+    FrameStatsSingle.endGpuTimer();
 }
 
 void GraphicEngine::draw( int mouseX, int mouseY )
 {
+    FrameStatsSingle.beginGpuTimer();
     _display->predraw( _scene, mouseX, mouseY );
     _display->draw( _scene, mouseX, mouseY );
+    FrameStatsSingle.endGpuTimer();
 }
 
 void GraphicEngine::dumpScreenImage( std::string fileName, int width, int height, bool transparentBG, bool framebufferSupported, int filetype )
 {
-    GLuint color;
-    GLuint depth;
-    GLuint fbo;
     int oldWidth, oldHeight;
     // width * height * RGB
-    std::vector<unsigned char> data(width * height * 4, 0);
+    std::vector<unsigned char> data( ( size_t )width * height * 4, 0 );
 
     std::vector< VSPGraphic::Viewport * > vports = _display->getLayoutMgr()->getViewports();
     if ( transparentBG )
@@ -57,6 +68,14 @@ void GraphicEngine::dumpScreenImage( std::string fileName, int width, int height
         }
     }
 
+    // Images larger than the framebuffer limits are drawn one tile at a time.
+    int tileSize = 0;
+    if ( framebufferSupported )
+    {
+        tileSize = _maxFramebufferSize();
+        framebufferSupported = _bindFramebuffer( std::min( width, tileSize ), std::min( height, tileSize ) );
+    }
+
     if ( framebufferSupported )
     {
         oldWidth = _display->getLayoutMgr()->screenWidth();
@@ -64,30 +83,52 @@ void GraphicEngine::dumpScreenImage( std::string fileName, int width, int height
 
         _display->resizeScreenshot( width, height );
 
-        glGenTextures(1, &color);
-        glBindTexture(GL_TEXTURE_2D, color);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
-        glBindTexture(GL_TEXTURE_2D, 0);
+        glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+        glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+        glPixelStorei( GL_PACK_ROW_LENGTH, width );
 
-        glGenRenderbuffers(1, &depth);
-        glBindRenderbuffer(GL_RENDERBUFFER, depth);
-        glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT, width, height);
-        glBindRenderbuffer(GL_RENDERBUFFER, 0);
+        bool tiled = width > tileSize || height > tileSize;
 
-        glGenFramebuffers(1, &fbo);
-        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, color, 0);
-        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depth);
+        for ( int ty = 0; ty < height; ty += tileSize )
+        {
+            for ( int tx = 0; tx < width; tx += tileSize )
+            {
+                int tw = std::min( tileSize, width - tx );
+                int th = std::min( tileSize, height - ty );
 
-        _display->draw( _scene, 0xFFFFFFFF, 0xFFFFFFFF );
-        _display->resizeScreenshot( oldWidth, oldHeight );
+                if ( tiled )
+                {
+                    for ( int i = 0; i < vports.size(); i++ )
+                    {
+                        if ( vports[i] )
+                        {
+                            vports[i]->setTile( tx, ty, tw, th );
+                        }
+                    }
+                    glViewport( 0, 0, tw, th );
+                    glDisable( GL_SCISSOR_TEST );
+                    glClearColor( 1.0f, 1.0f, 1.0f, 0.0f );
+                    glClear( GL_COLOR_BUFFER_BIT );
+                }
 
-        glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
-        glPixelStorei( GL_PACK_ALIGNMENT, 1 );
-        glReadPixels( 0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, &data[0] );
+                _display->draw( _scene, 0xFFFFFFFF, 0xFFFFFFFF );
+
+                glReadPixels( 0, 0, tw, th, GL_RGBA, GL_UNSIGNED_BYTE, &data[ ( ( size_t )ty * width + tx ) * 4 ] );
+            }
+        }
+
+        for ( int i = 0; i < vports.size(); i++ )
+        {
+            if ( vports[i] )
+            {
+                vports[i]->clearTile();
+            }
+        }
+
+        glPixelStorei( GL_PACK_ROW_LENGTH, 0 );
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+        _display->resizeScreenshot( oldWidth, oldHeight );
     }
     else
     {
@@ -109,12 +150,12 @@ void GraphicEngine::dumpScreenImage( std::string fileName, int width, int height
     }
 
     // Flip data top to bottom.
-    std::vector<unsigned char> flipdat(width * height * 4, 0);
+    std::vector<unsigned char> flipdat( ( size_t )width * height * 4, 0 );
     int scanLen = 4 * width;
     for ( int i = 0 ; i < height; i++ )
     {
-        unsigned char* srcLine = &data[ i * scanLen ];
-        unsigned char* dstLine = &flipdat[ (height - i - 1) * scanLen ];
+        unsigned char* srcLine = &data[ ( size_t )i * scanLen ];
+        unsigned char* dstLine = &flipdat[ ( size_t )( height - i - 1 ) * scanLen ];
         memcpy(  dstLine, srcLine, scanLen );
     }
 
@@ -128,6 +169,79 @@ void GraphicEngine::dumpScreenImage( std::string fileName, int width, int height
     }
 }
 
+int GraphicEngine::_maxFramebufferSize()
+{
+    GLint maxRenderbuffer = 0;
+    GLint maxViewport[2] = { 0, 0 };
+    glGetIntegerv( GL_MAX_RENDERBUFFER_SIZE, &maxRenderbuffer );
+    glGetIntegerv( GL_MAX_VIEWPORT_DIMS, maxViewport );
+
+    // Bound the size of one tile so huge images do not need a huge framebuffer.
+    int size = MAX_TILE_SIZE;
+    if ( maxRenderbuffer > 0 )
+    {
+        size = std::min( size, ( int )maxRenderbuffer );
+    }
+    if ( maxViewport[0] > 0 && maxViewport[1] > 0 )
+    {
+        size = std::min( size, ( int )std::min( maxViewport[0], maxViewport[1] ) );
+    }
+    return size;
+}
+
+bool GraphicEngine::_bindFramebuffer( int width, int height )
+{
+    // Reuse the framebuffer while successive screenshots keep the same size.
+    if ( _fbo && ( width != _fboWidth || height != _fboHeight ) )
+    {
+        _releaseFramebuffer();
+    }
+
+    if ( !_fbo )
+    {
+        glGenRenderbuffers( 1, &_fboColor );
+        glBindRenderbuffer( GL_RENDERBUFFER, _fboColor );
+        glRenderbufferStorage( GL_RENDERBUFFER, GL_RGBA8, width, height );
+
+        glGenRenderbuffers( 1, &_fboDepth );
+        glBindRenderbuffer( GL_RENDERBUFFER, _fboDepth );
+        glRenderbufferStorage( GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height );
+        glBindRenderbuffer( GL_RENDERBUFFER, 0 );
+
+        glGenFramebuffers( 1, &_fbo );
+        glBindFramebuffer( GL_FRAMEBUFFER, _fbo );
+        glFramebufferRenderbuffer( GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, _fboColor );
+        glFramebufferRenderbuffer( GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, _fboDepth );
+
+        _fboWidth = width;
+        _fboHeight = height;
+    }
+    else
+    {
+        glBindFramebuffer( GL_FRAMEBUFFER, _fbo );
+    }
+
+    if ( glCheckFramebufferStatus( GL_FRAMEBUFFER ) != GL_FRAMEBUFFER_COMPLETE )
+    {
+        glBindFramebuffer( GL_FRAMEBUFFER, 0 );
+        _releaseFramebuffer();
+        return false;
+    }
+    return true;
+}
+
+void GraphicEngine::_releaseFramebuffer()
+{
+    if ( _fbo )
+    {
+        glDeleteFramebuffers( 1, &_fbo );
+        glDeleteRenderbuffers( 1, &_fboColor );
+        glDeleteRenderbuffers( 1, &_fboDepth );
+    }
+    _fbo = _fboColor = _fboDepth = 0;
+    _fboWidth = _fboHeight = 0;
+}
+
 void GraphicEngine::initGlew()
 {
     GLenum error = glewInit();
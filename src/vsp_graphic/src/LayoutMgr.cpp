@@ -7,6 +7,8 @@
 #include "Probe.h"
 
 #include <assert.h>
+#include <algorithm>
+#include <cstdlib>
 
 namespace VSPGraphic
 {
@@ -102,10 +104,42 @@ void LayoutMgr::resizeScreenshot( int width, int height, float screenSizeDiffRat
 
 void LayoutMgr::predraw( Scene * scene, int x, int y )
 {
+    // Nothing to pick, no need for a color index pass.
+    if( !scene->isPickingEnabled() )
+    {
+        return;
+    }
+
+    // Only pixels under the cursor, or under the selection box, are read back.
+    // Scissor the color index pass to them so its fill cost stays small.
+    int pickX = x;
+    int pickY = y;
+    int pickW = 1;
+    int pickH = 1;
+    if ( _startx != -1 )
+    {
+        pickX = std::min( _startx, x );
+        pickY = std::min( _starty, y );
+        pickW = std::abs( x - _startx ) + 1;
+        pickH = std::abs( y - _starty ) + 1;
+    }
+
     // Preprocessing
     for( int i = 0; i < ( int )_viewportList.size(); i++ )
     {
-        _viewportList[i]->bind();
+        Viewport * vp = _viewportList[i];
+
+        int x0 = std::max( pickX, vp->x() );
+        int y0 = std::max( pickY, vp->y() );
+        int x1 = std::min( pickX + pickW, vp->x() + vp->width() );
+        int y1 = std::min( pickY + pickH, vp->y() + vp->height() );
+        if( x1 <= x0 || y1 <= y0 )
+        {
+            continue;
+        }
+
+        vp->bind();
+        glScissor( x0, y0, x1 - x0, y1 - y0 );
 
         glClearColor( 0.0f, 0.0f, 0.0f, 0.0f );
         glClearDepth( 1.0 );
@@ -145,6 +179,12 @@ void LayoutMgr::draw( Scene * scene, int x, int y )
 {
     for( int i = 0; i < ( int )_viewportList.size(); i++ )
     {
+        // Skip viewports outside the screenshot tile being drawn.
+        if( !_viewportList[i]->inTile() )
+        {
+            continue;
+        }
+
         // Set projection and modelview matrix.
         _viewportList[i]->bind();
 
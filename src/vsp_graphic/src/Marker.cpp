@@ -10,9 +10,11 @@ namespace VSPGraphic
 {
 Marker::Marker() : Renderable()
 {
+    _overlayBuffer = NULL;
 }
 Marker::~Marker()
 {
+    delete _overlayBuffer;
 }
 
 void Marker::_predraw()
@@ -44,6 +46,16 @@ void Marker::_draw()
     }
 }
 
+void Marker::_drawOverlay( GLenum primitive, const std::vector< glm::vec3 > & pnts )
+{
+    if( !_overlayBuffer )
+    {
+        _overlayBuffer = new VertexBuffer();
+    }
+    _overlayBuffer->loadPositions( pnts );
+    _overlayBuffer->draw( primitive );
+}
+
 void Marker::_draw_Points()
 {
     bool cBufferEnabled = _getCBufferFlag();
@@ -58,7 +58,13 @@ void Pickable::_genColorBlock(bool geomPicking)
     // free block before create.
     _delColorBlock();
 
+    // Point picking needs an index for every vertex of every instance, geometry
+    // picking shares one block across instances.
     unsigned int vbSize = _rSource->getVBuffer()->getVertexSize();
+    if(!geomPicking)
+    {
+        vbSize = _rSource->getInstancedVertexSize();
+    }
 
     // Allocate enough space for the block (four bytes per vertex).
     std::vector<unsigned char> colorblock;
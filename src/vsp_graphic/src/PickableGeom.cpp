@@ -3,7 +3,6 @@
 #include "VertexBuffer.h"
 #include "ElementBuffer.h"
 #include "ColorBuffer.h"
-#include "Entity.h"
 
 namespace VSPGraphic
 {
@@ -22,18 +21,66 @@ void PickableGeom::update()
 
 void PickableGeom::_predraw()
 {
-    // FIXME: Only Cross Section Geometries are selectable for now.
-    if(dynamic_cast<Entity*>(_rSource))
+    ElementBuffer * eBuffer = _rSource->getEBuffer();
+    VertexBuffer * vBuffer = _rSource->getVBuffer();
+
+    // Triangles, quads, lines and points all write this object's color id.
+    GLenum mode;
+    switch(_rSource->getPrimType())
     {
-        ElementBuffer * eBuffer = _rSource->getEBuffer();
-        VertexBuffer * vBuffer = _rSource->getVBuffer();
+    case Common::VSP_TRIANGLES:
+        mode = GL_TRIANGLES;
+        break;
+
+    case Common::VSP_QUADS:
+        mode = GL_QUADS;
+        break;
+
+    case Common::VSP_LINES:
+        mode = GL_LINES;
+        break;
+
+    case Common::VSP_LINE_STRIP:
+        mode = GL_LINE_STRIP;
+        break;
+
+    case Common::VSP_LINE_LOOP:
+        mode = GL_LINE_LOOP;
+        break;
+
+    case Common::VSP_POINTS:
+        mode = GL_POINTS;
+        break;
+
+    default:
+        return;
+    }
 
-        _cIndexBuffer->bind();
+    bool useElem = _rSource->getEBufferFlag() && ( mode == GL_TRIANGLES || mode == GL_QUADS );
+
+    _cIndexBuffer->bind();
+    if(useElem)
+    {
         eBuffer->bind();
-        vBuffer->drawElem(GL_QUADS, eBuffer->getElemSize(), (void*)0);
+    }
+    for(unsigned int i = 0; i < _rSource->getNumInstances(); i++)
+    {
+        _rSource->pushInstance(i);
+        if(useElem)
+        {
+            vBuffer->drawElem(mode, eBuffer->getElemSize(), (void*)0);
+        }
+        else
+        {
+            vBuffer->draw(mode);
+        }
+        _rSource->popInstance();
+    }
+    if(useElem)
+    {
         eBuffer->unbind();
-        _cIndexBuffer->unbind();
     }
+    _cIndexBuffer->unbind();
 }
 
 void PickableGeom::_draw()
@@ -50,7 +97,12 @@ void PickableGeom::_draw()
             glColor3f(1.0f, 0.0f, 0.0f);
 
             eBuffer->bind();
-            vBuffer->drawElem(GL_QUADS, eBuffer->getElemSize(), (void*)0);
+            for(unsigned int i = 0; i < _rSource->getNumInstances(); i++)
+            {
+                _rSource->pushInstance(i);
+                vBuffer->drawElem(GL_QUADS, eBuffer->getElemSize(), (void*)0);
+                _rSource->popInstance();
+            }
             eBuffer->unbind();
         }
 
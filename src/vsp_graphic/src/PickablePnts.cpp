@@ -9,10 +9,12 @@ PickablePnts::PickablePnts(Renderable * source) : Pickable(source)
 {
     _pickRange = 20.0f;
     _pointSize = 10.0f;
+    _hlBuffer = NULL;
 }
 PickablePnts::~PickablePnts()
 {
     _delColorBlock();
+    delete _hlBuffer;
 }
 
 bool PickablePnts::processPickingResult(unsigned int pickedId)
@@ -57,7 +59,7 @@ void PickablePnts::reset()
 std::vector<glm::vec3> PickablePnts::getAllPnts()
 {
     std::vector<glm::vec3> vertList;
-    int numOfVert = _rSource->getVBuffer()->getVertexSize();
+    int numOfVert = _rSource->getInstancedVertexSize();
 
     for( unsigned int i = 0; i < numOfVert; i++)
     {
@@ -75,9 +77,16 @@ void PickablePnts::_predraw()
 {
     glPointSize(_pickRange);
 
-    _cIndexBuffer->bind();
-    _rSource->getVBuffer()->draw(GL_POINTS);
-    _cIndexBuffer->unbind();
+    // Each instance uses its own block of color indices.
+    unsigned int vbSize = _rSource->getVBuffer()->getVertexSize();
+    for(unsigned int i = 0; i < _rSource->getNumInstances(); i++)
+    {
+        _rSource->pushInstance(i);
+        _cIndexBuffer->bind(i * vbSize * 4);
+        _rSource->getVBuffer()->draw(GL_POINTS);
+        _cIndexBuffer->unbind();
+        _rSource->popInstance();
+    }
 }
 
 void PickablePnts::_draw()
@@ -85,11 +94,17 @@ void PickablePnts::_draw()
     glColor3f(0.f, 1.f, 0.f);
     glPointSize(_pointSize);
 
-    _rSource->getVBuffer()->draw(GL_POINTS);
+    for(unsigned int i = 0; i < _rSource->getNumInstances(); i++)
+    {
+        _rSource->pushInstance(i);
+        _rSource->getVBuffer()->draw(GL_POINTS);
+        _rSource->popInstance();
+    }
 
     if(_highlighted)
     {
         std::vector< int > index = getIndex();
+        std::vector< glm::vec3 > hlPoints;
         for ( unsigned int i = 0; i < index.size(); i++ )
         {
 
@@ -97,12 +112,22 @@ void PickablePnts::_draw()
 
             if(hlPoint != glm::vec3(0xFFFFFFFF))
             {
-                glColor3f(1.f, 0.f, 0.f);
-                glPointSize(_pointSize * 1.2f);
-                glBegin(GL_POINTS);
-                glVertex3f(hlPoint[0], hlPoint[1], hlPoint[2]);
-                glEnd();
+                hlPoints.push_back(hlPoint);
+            }
+        }
+
+        // All highlighted points go up in one buffer and one draw.
+        if(!hlPoints.empty())
+        {
+            if(!_hlBuffer)
+            {
+                _hlBuffer = new VertexBuffer();
             }
+            _hlBuffer->loadPositions(hlPoints);
+
+            glColor3f(1.f, 0.f, 0.f);
+            glPointSize(_pointSize * 1.2f);
+            _hlBuffer->draw(GL_POINTS);
         }
 
         // reset highlights so highlighted point turns off
@@ -74,14 +74,12 @@ void Probe::_draw()
     {
         probeEnd = _v1 + _norm * _len;
 
-        glBegin(GL_POINTS);
-        glVertex3f(_v1[0], _v1[1], _v1[2]);
-        glEnd();
+        _drawOverlay(GL_POINTS, std::vector< glm::vec3 >(1, _v1));
 
-        glBegin(GL_LINE_STRIP);
-        glVertex3f(_v1[0], _v1[1], _v1[2]);
-        glVertex3f(probeEnd.x, probeEnd.y, probeEnd.z);
-        glEnd();
+        std::vector< glm::vec3 > pnts;
+        pnts.push_back(_v1);
+        pnts.push_back(probeEnd);
+        _drawOverlay(GL_LINE_STRIP, pnts);
 
         textLocation = probeEnd;
 
@@ -91,19 +89,19 @@ void Probe::_draw()
     {
         glm::vec3 v2 = _mouseLocInWorld;
 
-        glBegin(GL_LINES);
-        glVertex3f(_v1[0], _v1[1], _v1[2]);
+        std::vector< glm::vec3 > pnts;
+        pnts.push_back(_v1);
         if(_mouseLocInWorld != glm::vec3(0xFFFFFFFF))
         {
             float len = glm::length( _mouseLocInWorld - _v1 );
             v2 = _v1 + _norm * len;
-            glVertex3f( v2.x, v2.y, v2.z);
+            pnts.push_back(v2);
         }
         else
         {
-            glVertex3f(_v1[0], _v1[1], _v1[2]);
+            pnts.push_back(_v1);
         }
-        glEnd();
+        _drawOverlay(GL_LINES, pnts);
 
         textLocation = v2;
     }
@@ -1,9 +1,15 @@
+#include "OpenGLHeaders.h"
+
 #include "Renderable.h"
 
 #include "VertexBuffer.h"
 #include "ColorBuffer.h"
 #include "ElementBuffer.h"
 
+#include <cmath>
+
+#define LOD_FULL_DETAIL_SIZE    (400.f)     // on screen diameter in pixels drawn at full detail
+
 namespace VSPGraphic
 {
 Renderable::Renderable() : SceneObject()
@@ -28,12 +34,18 @@ Renderable::Renderable() : SceneObject()
     _cBufferFlag = _eBufferFlag = false;
 
     _facingCWFlag = false;
+
+    _boundFlag = false;
+    _boundRadius = 0.f;
+    _boundRevision = 0;
 }
 Renderable::~Renderable()
 {
     delete _vBuffer;
     delete _cBuffer;
     delete _eBuffer;
+
+    clearLodEBuffers();
 }
 
 void Renderable::appendVBuffer( void * mem_ptr, unsigned int mem_size )
@@ -46,6 +58,11 @@ void Renderable::emptyVBuffer()
     _vBuffer->empty();
 }
 
+void Renderable::loadVBuffer( void * mem_ptr, unsigned int mem_size )
+{
+    _vBuffer->load( mem_ptr, mem_size );
+}
+
 void Renderable::appendEBuffer( void * mem_ptr, unsigned int mem_size )
 {
     _eBuffer->append( mem_ptr, mem_size );
@@ -56,11 +73,130 @@ void Renderable::emptyEBuffer()
     _eBuffer->empty();
 }
 
+void Renderable::loadEBuffer( void * mem_ptr, unsigned int mem_size )
+{
+    _eBuffer->load( mem_ptr, mem_size );
+}
+
 void Renderable::enableEBuffer( bool enable )
 {
     _eBufferFlag = enable;
 }
 
+void Renderable::loadLodEBuffer( unsigned int level, void * mem_ptr, unsigned int mem_size )
+{
+    if( level == 0 )
+    {
+        loadEBuffer( mem_ptr, mem_size );
+        return;
+    }
+
+    while( _lodEBuffers.size() < level )
+    {
+        _lodEBuffers.push_back( new ElementBuffer() );
+    }
+    _lodEBuffers[level - 1]->load( mem_ptr, mem_size );
+}
+
+void Renderable::clearLodEBuffers()
+{
+    for( int i = 0; i < ( int )_lodEBuffers.size(); i++ )
+    {
+        delete _lodEBuffers[i];
+    }
+    _lodEBuffers.clear();
+}
+
+void Renderable::setBoundingBox( const glm::vec3 & min, const glm::vec3 & max )
+{
+    _boundFlag = true;
+    _boundMin = min;
+    _boundMax = max;
+
+    _boundCenter = 0.5f * ( min + max );
+    _boundRadius = 0.5f * glm::length( max - min );
+
+    _boundRevision++;
+}
+
+bool Renderable::getBoundingBox( glm::vec3 & min_out, glm::vec3 & max_out )
+{
+    if( !_boundFlag )
+    {
+        return false;
+    }
+
+    if( _instances.empty() )
+    {
+        min_out = _boundMin;
+        max_out = _boundMax;
+        return true;
+    }
+
+    // Box around every instance's transformed corners.
+    min_out = glm::vec3( 1e30f );
+    max_out = glm::vec3( -1e30f );
+    for( int i = 0; i < ( int )_instances.size(); i++ )
+    {
+        for( int c = 0; c < 8; c++ )
+        {
+            glm::vec4 p( c & 1 ? _boundMax.x : _boundMin.x,
+                         c & 2 ? _boundMax.y : _boundMin.y,
+                         c & 4 ? _boundMax.z : _boundMin.z, 1.f );
+            glm::vec3 q = glm::vec3( _instances[i] * p );
+            min_out = glm::min( min_out, q );
+            max_out = glm::max( max_out, q );
+        }
+    }
+    return true;
+}
+
+unsigned int Renderable::getBoundRevision()
+{
+    return _boundRevision;
+}
+
+ElementBuffer * Renderable::_getLodEBuffer()
+{
+    if( _lodEBuffers.empty() || _boundRadius <= 0.f )
+    {
+        return _eBuffer;
+    }
+
+    // Project the bounding sphere to find its diameter in pixels.
+    glm::mat4 mv, proj;
+    GLint vp[4];
+    glGetFloatv( GL_MODELVIEW_MATRIX, &mv[0][0] );
+    glGetFloatv( GL_PROJECTION_MATRIX, &proj[0][0] );
+    glGetIntegerv( GL_VIEWPORT, vp );
+
+    glm::vec4 eyeCenter = mv * glm::vec4( _boundCenter, 1.f );
+    float eyeRadius = _boundRadius * glm::length( glm::vec3( mv[0] ) );
+
+    glm::vec4 clipCenter = proj * eyeCenter;
+    if( clipCenter.w <= 0.f )
+    {
+        return _eBuffer;
+    }
+
+    float diameter = eyeRadius * std::abs( proj[0][0] ) / clipCenter.w * vp[2];
+
+    // Each coarser level steps over twice as many rows and columns.
+    unsigned int level = 0;
+    float size = LOD_FULL_DETAIL_SIZE;
+    while( level < _lodEBuffers.size() && diameter < size )
+    {
+        level++;
+        size *= 0.5f;
+    }
+
+    if( level == 0 )
+    {
+        return _eBuffer;
+    }
+    return _lodEBuffers[level - 1];
+}
+
 void Renderable::appendCBuffer( void * mem_ptr, unsigned int mem_size )
 {
     _cBuffer->append( mem_ptr, mem_size );
@@ -152,9 +288,61 @@ glm::vec3 Renderable::getVertexVec( unsigned int bufferIndex )
 {
     float temp[3];
 
-    _vBuffer->getVertex3f(bufferIndex, temp);
+    if( _instances.empty() )
+    {
+        _vBuffer->getVertex3f(bufferIndex, temp);
+
+        return glm::vec3(temp[0], temp[1], temp[2]);
+    }
+
+    unsigned int vSize = _vBuffer->getVertexSize();
+    if( vSize == 0 || bufferIndex >= vSize * _instances.size() )
+    {
+        return glm::vec3( 0xFFFFFFFF );
+    }
+
+    _vBuffer->getVertex3f( bufferIndex % vSize, temp );
+
+    glm::vec4 v = _instances[bufferIndex / vSize] * glm::vec4( temp[0], temp[1], temp[2], 1.f );
+
+    return glm::vec3( v );
+}
+
+unsigned int Renderable::getInstancedVertexSize()
+{
+    return _vBuffer->getVertexSize() * getNumInstances();
+}
+
+void Renderable::setInstances( const std::vector<glm::mat4> & xforms )
+{
+    _instances = xforms;
+    _boundRevision++;
+}
 
-    return glm::vec3(temp[0], temp[1], temp[2]);
+unsigned int Renderable::getNumInstances()
+{
+    return _instances.empty() ? 1 : _instances.size();
+}
+
+bool Renderable::pushInstance( unsigned int index )
+{
+    if( index >= _instances.size() )
+    {
+        return false;
+    }
+
+    glPushMatrix();
+    glMultMatrixf( &_instances[index][0][0] );
+
+    return glm::determinant( glm::mat3( _instances[index] ) ) < 0.f;
+}
+
+void Renderable::popInstance()
+{
+    if( !_instances.empty() )
+    {
+        glPopMatrix();
+    }
 }
 
 VertexBuffer * Renderable::getVBuffer()
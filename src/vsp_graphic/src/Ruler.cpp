@@ -95,17 +95,17 @@ void Ruler::_draw()
         rulerStart = _v1 + _offset;
         rulerEnd = _v2 + _offset;
 
-        glBegin(GL_POINTS);
-        glVertex3f(_v1[0], _v1[1], _v1[2]);
-        glVertex3f(_v2[0], _v2[1], _v2[2]);
-        glEnd();
-
-        glBegin(GL_LINE_STRIP);
-        glVertex3f(_v1[0], _v1[1], _v1[2]);
-        glVertex3f(rulerStart.x, rulerStart.y, rulerStart.z);
-        glVertex3f(rulerEnd.x, rulerEnd.y, rulerEnd.z);
-        glVertex3f(_v2[0], _v2[1], _v2[2]);
-        glEnd();
+        std::vector< glm::vec3 > pnts;
+        pnts.push_back(_v1);
+        pnts.push_back(_v2);
+        _drawOverlay(GL_POINTS, pnts);
+
+        pnts.clear();
+        pnts.push_back(_v1);
+        pnts.push_back(rulerStart);
+        pnts.push_back(rulerEnd);
+        pnts.push_back(_v2);
+        _drawOverlay(GL_LINE_STRIP, pnts);
 
         textLocation = (rulerStart + rulerEnd) * 0.5f;
     }
@@ -125,29 +125,29 @@ void Ruler::_draw()
             rulerEnd = _v2;
         }
 
-        glBegin(GL_LINE_STRIP);
-        glVertex3f(_v1[0], _v1[1], _v1[2]);
-        glVertex3f(rulerStart.x, rulerStart.y, rulerStart.z);
-        glVertex3f(rulerEnd.x, rulerEnd.y, rulerEnd.z);
-        glVertex3f(_v2[0], _v2[1], _v2[2]);
-        glEnd();
+        std::vector< glm::vec3 > pnts;
+        pnts.push_back(_v1);
+        pnts.push_back(rulerStart);
+        pnts.push_back(rulerEnd);
+        pnts.push_back(_v2);
+        _drawOverlay(GL_LINE_STRIP, pnts);
 
         textLocation = (rulerStart + rulerEnd) * 0.5f;
     }
     // First stage of ruler.
     else if(_v1 != glm::vec3(0xFFFFFFFF) && _v2 == glm::vec3(0xFFFFFFFF))
     {
-        glBegin(GL_LINES);
-        glVertex3f(_v1[0], _v1[1], _v1[2]);
+        std::vector< glm::vec3 > pnts;
+        pnts.push_back(_v1);
         if(_mouseLocInWorld != glm::vec3(0xFFFFFFFF))
         {
-            glVertex3f(_mouseLocInWorld.x, _mouseLocInWorld.y, _mouseLocInWorld.z);
+            pnts.push_back(_mouseLocInWorld);
         }
         else
         {
-            glVertex3f(_v1[0], _v1[1], _v1[2]);
+            pnts.push_back(_v1);
         }
-        glEnd();
+        _drawOverlay(GL_LINES, pnts);
 
         textLocation = (_mouseLocInWorld + _v1) * 0.5f;
     }
@@ -17,6 +17,9 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <algorithm>
+
+#define BVH_LEAF_SIZE   (4)     // objects per hierarchy leaf
 
 namespace VSPGraphic
 {
@@ -231,12 +234,24 @@ void Scene::activatePicking(int x, int y)
     }
 }
 
+/*!
+* Order Pickables by their color id blocks.
+*/
+class PickableIdLess
+{
+public:
+    bool operator()( Pickable * a, Pickable * b ) const
+    {
+        return a->getIdStart() < b->getIdStart();
+    }
+};
+
 void Scene::preSelectBox(int x1, int y1, int x2, int y2)
 {
     _preselected.clear();
 
-    int w = abs( x2 - x1 );
-    int h = abs( y2 - y1 );
+    int w = abs( x2 - x1 ) + 1;
+    int h = abs( y2 - y1 ) + 1;
 
     int x, y;
 
@@ -251,62 +266,62 @@ void Scene::preSelectBox(int x1, int y1, int x2, int y2)
         y = y2;
 
     int bpp = 4;
-    int scanLen = bpp * ( w + 1 );
-
-    unsigned char * index = new unsigned char[( h + 1 ) * scanLen];
-    for ( int i = 0; i < ( h + 1 ) * scanLen; i++ )
-    {
-        index[i] = 0x00;
-    }
+    int scanLen = bpp * w;
 
-    glReadPixels( x, y, w, h, GL_RGBA, GL_UNSIGNED_BYTE, index );
+    // The whole box in one read back.
+    std::vector< unsigned char > index( h * scanLen, 0x00 );
 
+    glPixelStorei( GL_PACK_ALIGNMENT, 4 );
+    glReadPixels( x, y, w, h, GL_RGBA, GL_UNSIGNED_BYTE, &index[0] );
 
     std::set< unsigned int > ids;
     std::set< unsigned int >::iterator it;
 
-    for ( int i = 0; i < h + 1; i++ )
+    for ( int i = 0; i < h * w; i++ )
     {
-        for ( int j = 0; j < w + 1; j++ )
-        {
-            unsigned char * idx = index + (i * scanLen + j * bpp);
-            unsigned int id = 0;
-            bytesToUInt(idx, &id);
+        unsigned int id = 0;
+        bytesToUInt( &index[i * bpp], &id );
 
-            if(id)
-            {
-                ids.insert(id);
-            }
+        if(id)
+        {
+            ids.insert(id);
         }
     }
 
+    std::vector< PickablePnts* > pickables;
     for(int k = 0; k < (int)_sceneList.size(); k++)
     {
         PickablePnts * pickable = dynamic_cast<PickablePnts*>(_sceneList[k]);
         if(pickable)
         {
             pickable->reset();
+            pickables.push_back( pickable );
         }
     }
 
+    // Ids and blocks are both sorted, so one sweep matches every id to its owner.
+    std::sort( pickables.begin(), pickables.end(), PickableIdLess() );
 
+    int k = 0;
     for ( it = ids.begin(); it != ids.end(); ++it )
     {
         unsigned int id = (*it);
 
-        for(int k = 0; k < (int)_sceneList.size(); k++)
+        while ( k < (int)pickables.size() && pickables[k]->getIdEnd() < id )
         {
-            PickablePnts * pickable = dynamic_cast<PickablePnts*>(_sceneList[k]);
-            if(pickable)
-            {
-                if( pickable->processPickingResult(id) )
-                {
-                    _preselected.insert( pickable );
-                }
-            }
+            k++;
+        }
+
+        if ( k == (int)pickables.size() )
+        {
+            break;
+        }
+
+        if ( id >= pickables[k]->getIdStart() && pickables[k]->processPickingResult(id) )
+        {
+            _preselected.insert( pickables[k] );
         }
     }
-    delete [] index;
 }
 
 bool Scene::selectBox()
@@ -576,9 +591,31 @@ void Scene::draw()
 
     _clip->predraw();
 
+    // View frustum planes of the bound viewport ( Gribb / Hartmann ), pointing inward.
+    glm::mat4 mv, proj;
+    glGetFloatv( GL_MODELVIEW_MATRIX, &mv[0][0] );
+    glGetFloatv( GL_PROJECTION_MATRIX, &proj[0][0] );
+    glm::mat4 m = glm::transpose( proj * mv );
+
+    glm::vec4 planes[6];
+    planes[0] = m[3] + m[0];
+    planes[1] = m[3] - m[0];
+    planes[2] = m[3] + m[1];
+    planes[3] = m[3] - m[1];
+    planes[4] = m[3] + m[2];
+    planes[5] = m[3] - m[2];
+
+    _updateBVH();
+    _cullBVH( planes );
+
     // Draw markers and entities that are not transparent.  Store transparent entities to render later.
     for( int i = 0; i < (int)_sceneList.size(); i++ )
     {
+        if( _culled[i] )
+        {
+            continue;
+        }
+
         Entity * entity = dynamic_cast<Entity*>( _sceneList[i] );
         if( entity && entity->isTransparent() && 
             ( entity->getRenderStyle() == Common::VSP_DRAW_MESH_SHADED || entity->getRenderStyle() == Common::VSP_DRAW_MESH_TEXTURED ))
@@ -619,6 +656,173 @@ void Scene::draw()
     _clip->postdraw();
 }
 
+void Scene::_updateBVH()
+{
+    bool rebuild = _bvhSceneList != _sceneList;
+
+    if( !rebuild )
+    {
+        for( int i = 0; i < (int)_sceneList.size(); i++ )
+        {
+            Entity * entity = dynamic_cast<Entity*>( _sceneList[i] );
+            if( entity && entity->getBoundRevision() != _bvhRevisions[i] )
+            {
+                rebuild = true;
+                break;
+            }
+        }
+    }
+
+    if( !rebuild )
+    {
+        return;
+    }
+
+    _bvhSceneList = _sceneList;
+    _bvhRevisions.assign( _sceneList.size(), 0 );
+    _bvhMin.resize( _sceneList.size() );
+    _bvhMax.resize( _sceneList.size() );
+    _bvhObjects.clear();
+    _bvhNodes.clear();
+
+    // Only entities are culled, markers and labels have on screen sizes.
+    for( int i = 0; i < (int)_sceneList.size(); i++ )
+    {
+        Entity * entity = dynamic_cast<Entity*>( _sceneList[i] );
+        if( entity )
+        {
+            _bvhRevisions[i] = entity->getBoundRevision();
+            if( entity->getBoundingBox( _bvhMin[i], _bvhMax[i] ) )
+            {
+                _bvhObjects.push_back( i );
+            }
+        }
+    }
+
+    if( !_bvhObjects.empty() )
+    {
+        _buildBVH( 0, _bvhObjects.size() );
+    }
+}
+
+// Functor to order objects by box center along one axis.
+class BVHCenterLess
+{
+public:
+    BVHCenterLess( const std::vector<glm::vec3> & min, const std::vector<glm::vec3> & max, int axis ) :
+        _min( min ), _max( max ), _axis( axis ) {}
+
+    bool operator()( int a, int b ) const
+    {
+        return _min[a][_axis] + _max[a][_axis] < _min[b][_axis] + _max[b][_axis];
+    }
+
+private:
+    const std::vector<glm::vec3> & _min;
+    const std::vector<glm::vec3> & _max;
+    int _axis;
+};
+
+int Scene::_buildBVH( int first, int count )
+{
+    BVHNode node;
+    node.min = _bvhMin[_bvhObjects[first]];
+    node.max = _bvhMax[_bvhObjects[first]];
+    for( int i = first + 1; i < first + count; i++ )
+    {
+        node.min = glm::min( node.min, _bvhMin[_bvhObjects[i]] );
+        node.max = glm::max( node.max, _bvhMax[_bvhObjects[i]] );
+    }
+    node.left = node.right = -1;
+    node.first = first;
+    node.count = count;
+
+    int index = _bvhNodes.size();
+    _bvhNodes.push_back( node );
+
+    if( count <= BVH_LEAF_SIZE )
+    {
+        return index;
+    }
+
+    // Median split along the longest axis.
+    glm::vec3 ext = node.max - node.min;
+    int axis = 0;
+    if( ext[1] > ext[axis] ) axis = 1;
+    if( ext[2] > ext[axis] ) axis = 2;
+
+    int half = count / 2;
+    std::nth_element( _bvhObjects.begin() + first, _bvhObjects.begin() + first + half,
+                      _bvhObjects.begin() + first + count, BVHCenterLess( _bvhMin, _bvhMax, axis ) );
+
+    int left = _buildBVH( first, half );
+    int right = _buildBVH( first + half, count - half );
+
+    _bvhNodes[index].left = left;
+    _bvhNodes[index].right = right;
+    _bvhNodes[index].count = 0;
+
+    return index;
+}
+
+// A box is outside if its most inward corner is behind any frustum plane.
+static bool BoxOutsideFrustum( const glm::vec4 planes[6], const glm::vec3 & min, const glm::vec3 & max )
+{
+    for( int p = 0; p < 6; p++ )
+    {
+        glm::vec3 corner( planes[p].x >= 0.f ? max.x : min.x,
+                          planes[p].y >= 0.f ? max.y : min.y,
+                          planes[p].z >= 0.f ? max.z : min.z );
+        if( glm::dot( glm::vec3( planes[p] ), corner ) + planes[p].w < 0.f )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Scene::_cullBVH( const glm::vec4 planes[6] )
+{
+    // Unbounded objects are always drawn, bounded ones only if a visible leaf holds them.
+    _culled.assign( _sceneList.size(), false );
+    for( int i = 0; i < (int)_bvhObjects.size(); i++ )
+    {
+        _culled[_bvhObjects[i]] = true;
+    }
+
+    if( _bvhNodes.empty() )
+    {
+        return;
+    }
+
+    std::vector<int> stack;
+    stack.push_back( 0 );
+    while( !stack.empty() )
+    {
+        const BVHNode & node = _bvhNodes[stack.back()];
+        stack.pop_back();
+
+        if( BoxOutsideFrustum( planes, node.min, node.max ) )
+        {
+            continue;
+        }
+
+        if( node.count > 0 )
+        {
+            for( int i = node.first; i < node.first + node.count; i++ )
+            {
+                int obj = _bvhObjects[i];
+                _culled[obj] = BoxOutsideFrustum( planes, _bvhMin[obj], _bvhMax[obj] );
+            }
+        }
+        else
+        {
+            stack.push_back( node.left );
+            stack.push_back( node.right );
+        }
+    }
+}
+
 void Scene::showSelection()
 {
     _showSelection = true;
@@ -1,5 +1,6 @@
 #include "SelectedPnt.h"
 #include "Renderable.h"
+#include "VertexBuffer.h"
 #include "OpenGLHeaders.h"
 
 namespace VSPGraphic
@@ -7,9 +8,11 @@ namespace VSPGraphic
 SelectedPnt::SelectedPnt(Renderable * source, unsigned int index) : SelectedGeom(source)
 {
     _index = index;
+    _pntBuffer = NULL;
 }
 SelectedPnt::~SelectedPnt()
 {
+    delete _pntBuffer;
 }
 
 unsigned int SelectedPnt::getIndex()
@@ -21,20 +24,24 @@ void SelectedPnt::_predraw()
 {
     glPointSize(20);
     glColor4f(1, 1, 1, 1);
-    glm::vec3 selected = _rSource->getVertexVec(_index);
-    glBegin(GL_POINTS);
-    glVertex3f(selected[0], selected[1], selected[2]);
-    glEnd();
+    _drawSelected();
 }
 
 void SelectedPnt::_draw()
 {
     glPointSize(12);
     glColor3f(0, 0, 1);
-    glm::vec3 selected = _rSource->getVertexVec(_index);
-    glBegin(GL_POINTS);
-    glVertex3f(selected[0], selected[1], selected[2]);
-    glEnd();
+    _drawSelected();
+}
+
+void SelectedPnt::_drawSelected()
+{
+    if(!_pntBuffer)
+    {
+        _pntBuffer = new VertexBuffer();
+    }
+    _pntBuffer->loadPositions(std::vector< glm::vec3 >(1, _rSource->getVertexVec(_index)));
+    _pntBuffer->draw(GL_POINTS);
 }
 }
 
@@ -9,7 +9,13 @@ namespace VSPGraphic
         _textureID = 0;
         _imWidth = 0;
         _imHeight = 0;
-        _initialize( image );
+
+        glGenTextures( 1, &_textureID );
+
+        if( image )
+        {
+            _initialize( image );
+        }
     }
     Texture2D::~Texture2D()
     {
@@ -30,10 +36,13 @@ namespace VSPGraphic
         glDisable( GL_TEXTURE_2D );
     }
 
-    void Texture2D::_initialize( Image * image )
+    void Texture2D::load( Image * image )
     {
-        glGenTextures( 1, &_textureID );
+        _initialize( image );
+    }
 
+    void Texture2D::_initialize( Image * image )
+    {
         if( !image->isValid() )
         {
             return;
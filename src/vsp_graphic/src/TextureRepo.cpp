@@ -18,6 +18,11 @@ TextureRepo::~TextureRepo()
 }
 
 Texture2D * TextureRepo::get2DTexture( const char * fileName )
+{
+    return get2DTexture( fileName, false );
+}
+
+Texture2D * TextureRepo::get2DTexture( const char * fileName, bool deferLoad )
 {
     // First check if this file has been loaded before.
     std::string fn = fileName;
@@ -25,20 +30,53 @@ Texture2D * TextureRepo::get2DTexture( const char * fileName )
     {
         if( _textureRepo[i].fileName == fn )
         {
+            // Someone needs it now, finish the queued load.
+            if( _textureRepo[i].pending && !deferLoad )
+            {
+                _load( _textureRepo[i] );
+            }
             return _textureRepo[i].texture;
         }
     }
 
     // If new file, create new texture.
-    Image image( fileName );
-    Texture2D * texture = new Texture2D( &image );
-
     TextureInfo tInfo;
     tInfo.fileName = fileName;
-    tInfo.texture = texture;
+    tInfo.texture = new Texture2D( NULL );
+    tInfo.pending = true;
+
+    if( !deferLoad )
+    {
+        _load( tInfo );
+    }
 
     _textureRepo.push_back( tInfo );
 
-    return texture;
+    return tInfo.texture;
+}
+
+bool TextureRepo::loadPending( int maxLoads )
+{
+    int numLoads = 0;
+    for( int i = 0; i < ( int )_textureRepo.size(); i++ )
+    {
+        if( _textureRepo[i].pending )
+        {
+            if( numLoads == maxLoads )
+            {
+                return true;
+            }
+            _load( _textureRepo[i] );
+            numLoads++;
+        }
+    }
+    return false;
+}
+
+void TextureRepo::_load( TextureInfo & tInfo )
+{
+    Image image( tInfo.fileName );
+    tInfo.texture->load( &image );
+    tInfo.pending = false;
 }
 }
@@ -4,6 +4,7 @@
 #include <cstdlib>
 
 #include "VBO.h"
+#include "FrameStats.h"
 
 #define BUFFER_INITIAL      (1024)        // initial buffer size
 #define BUFFER_INCREMENT    (1024)        // buffer increment size
@@ -79,6 +80,31 @@ void VBO::append( void * mem_ptr, unsigned int mem_size )
     glBindBuffer( _buffer_Type, _id );
     glBufferSubData( _buffer_Type, _start, _end - _start, mem_ptr );
     glBindBuffer( _buffer_Type, 0 );
+
+    FrameStatsSingle.addUploadBytes( mem_size );
+}
+
+void VBO::load( void * mem_ptr, unsigned int mem_size )
+{
+    if ( !_support )
+    {
+        return;
+    }
+
+    _start = 0;
+    _end = mem_size;
+
+    glBindBuffer( _buffer_Type, _id );
+    if( _end > _size )
+    {
+        // Old contents are discarded, so respecify the storage in place.
+        _size = BUFFER_INCREMENT * ( ( int )( mem_size / BUFFER_INCREMENT ) + ( mem_size % BUFFER_INCREMENT == 0 ? 0 : 1 ) );
+        glBufferData( _buffer_Type, _size, NULL, GL_DYNAMIC_DRAW );
+    }
+    glBufferSubData( _buffer_Type, 0, _end, mem_ptr );
+    glBindBuffer( _buffer_Type, 0 );
+
+    FrameStatsSingle.addUploadBytes( mem_size );
 }
 
 void VBO::empty()
@@ -113,28 +139,37 @@ void VBO::unbind()
 
 bool VBO::_extend( unsigned int mem_size )
 {
-    void * temp = malloc( _size );
+    // Only data in front of the append location is still in use.
+    unsigned int keepSize = _start;
+    void * temp = NULL;
 
-    if( temp == NULL )
+    if( keepSize > 0 )
     {
-        assert( false ); // Failed to allocate memory.
-        return false;
-    }
+        temp = malloc( keepSize );
 
-    glBindBuffer( _buffer_Type, _id );
-    glGetBufferSubData( _buffer_Type, 0, _size, temp );
-    glBindBuffer( _buffer_Type, 0 );
+        if( temp == NULL )
+        {
+            assert( false ); // Failed to allocate memory.
+            return false;
+        }
+
+        glBindBuffer( _buffer_Type, _id );
+        glGetBufferSubData( _buffer_Type, 0, keepSize, temp );
+        glBindBuffer( _buffer_Type, 0 );
+    }
     glDeleteBuffers( 1, &_id );
 
-    unsigned int oldSize = _size;
     _size = _size + BUFFER_INCREMENT * ( ( int )( mem_size / BUFFER_INCREMENT ) + ( mem_size % BUFFER_INCREMENT == 0 ? 0 : 1 ) );
 
     glGenBuffers( 1, &_id );
     glBindBuffer( _buffer_Type, _id );
     glBufferData( _buffer_Type, _size, NULL, GL_DYNAMIC_DRAW );
-    glBufferSubData( _buffer_Type, 0, oldSize, temp );
+    if( temp )
+    {
+        glBufferSubData( _buffer_Type, 0, keepSize, temp );
+        free( temp );
+    }
     glBindBuffer( _buffer_Type, 0 );
-    free( temp );
 
     return true;
 }
@@ -1,4 +1,5 @@
 #include "VertexBuffer.h"
+#include "FrameStats.h"
 
 #define VERTEX_SIZE     3       // x, y, z 
 #define NORMAL_SIZE     3       // Nx, Ny, Nz
@@ -33,6 +34,7 @@ void VertexBuffer::draw( GLenum primitive )
     glEnableClientState( GL_NORMAL_ARRAY );
 
     glDrawArrays( primitive, 0, _getDataSize() / VERTEX_DATA_SIZE );
+    FrameStatsSingle.addDrawCall();
 
     glDisableClientState( GL_NORMAL_ARRAY );
     glDisableClientState( GL_VERTEX_ARRAY );
@@ -51,11 +53,32 @@ void VertexBuffer::drawElem( GLenum primitive, unsigned int index_size, void * i
     glEnableClientState( GL_NORMAL_ARRAY );
 
     glDrawElements( primitive, index_size, GL_UNSIGNED_INT, indices );
+    FrameStatsSingle.addDrawCall();
 
     glDisableClientState( GL_NORMAL_ARRAY );
     glDisableClientState( GL_VERTEX_ARRAY );
 }
 
+void VertexBuffer::loadPositions( const std::vector< glm::vec3 > & pnts )
+{
+    const unsigned int stride = VERTEX_DATA_SIZE / sizeof( float );
+
+    std::vector< float > data( pnts.size() * stride, 0.f );
+    for( unsigned int i = 0; i < pnts.size(); i++ )
+    {
+        data[i * stride + 0] = pnts[i].x;
+        data[i * stride + 1] = pnts[i].y;
+        data[i * stride + 2] = pnts[i].z;
+    }
+
+    if( data.empty() )
+    {
+        empty();
+        return;
+    }
+    load( &data[0], data.size() * sizeof( float ) );
+}
+
 unsigned int VertexBuffer::getVertexSize()
 {
     return _getDataSize() / VERTEX_DATA_SIZE;
@@ -10,6 +10,9 @@
 #include "ArcballCam.h"
 
 #include "Background.h"
+#include "VertexBuffer.h"
+
+#include <algorithm>
 
 #define BORDER_LINEWIDTH 1.0f
 #define BORDER_OFFSET 0.009f
@@ -36,9 +39,13 @@ Viewport::Viewport( int x, int y, int width, int height )
 
     // can't initialize here because no context is created.
     _background = NULL;
+    _overlayBuffer = NULL;
+    _gridBuffer = NULL;
 
     _showBorders = _showArrows = true;
     _showGrid = false;
+
+    clearTile();
 }
 Viewport::~Viewport()
 {
@@ -49,6 +56,24 @@ Viewport::~Viewport()
     {
         delete _background;
     }
+    if( _overlayBuffer )
+    {
+        delete _overlayBuffer;
+    }
+    if( _gridBuffer )
+    {
+        delete _gridBuffer;
+    }
+}
+
+void Viewport::_drawOverlay( GLenum primitive, const std::vector< glm::vec3 > & pnts )
+{
+    if( !_overlayBuffer )
+    {
+        _overlayBuffer = new VertexBuffer();
+    }
+    _overlayBuffer->loadPositions( pnts );
+    _overlayBuffer->draw( primitive );
 }
 
 void Viewport::resizeViewport( int x, int y, int width, int height, float screenSizeDiffRatio )
@@ -73,15 +98,81 @@ void Viewport::resize( int x, int y, int width, int height )
     _camera->resize( _x, _y, _vWidth, _vHeight );
 }
 
+void Viewport::setTile( int x, int y, int width, int height )
+{
+    _tiled = true;
+    _tileX = x;
+    _tileY = y;
+    _tileWidth = width;
+    _tileHeight = height;
+}
+
+void Viewport::clearTile()
+{
+    _tiled = false;
+    _tileX = _tileY = 0;
+    _tileWidth = _tileHeight = 0;
+}
+
+bool Viewport::inTile()
+{
+    if( !_tiled )
+    {
+        return true;
+    }
+    return _x < _tileX + _tileWidth && _tileX < _x + _vWidth &&
+           _y < _tileY + _tileHeight && _tileY < _y + _vHeight;
+}
+
+void Viewport::_loadTileProjection()
+{
+    glLoadIdentity();
+
+    if( !_tiled || !inTile() )
+    {
+        return;
+    }
+
+    // Map the part of this viewport inside the tile onto the whole GL viewport.
+    int x0 = std::max( _x, _tileX );
+    int x1 = std::min( _x + _vWidth, _tileX + _tileWidth );
+    int y0 = std::max( _y, _tileY );
+    int y1 = std::min( _y + _vHeight, _tileY + _tileHeight );
+
+    glm::mat4 tileMat( 1.0f );
+    tileMat[0][0] = ( float )_vWidth / ( x1 - x0 );
+    tileMat[1][1] = ( float )_vHeight / ( y1 - y0 );
+    tileMat[3][0] = ( float )( _vWidth - 2 * ( x0 - _x ) ) / ( x1 - x0 ) - 1.0f;
+    tileMat[3][1] = ( float )( _vHeight - 2 * ( y0 - _y ) ) / ( y1 - y0 ) - 1.0f;
+
+    glMultMatrixf( &tileMat[0][0] );
+}
+
 void Viewport::bind()
 {
-    glViewport( _x, _y, _vWidth, _vHeight );
-    glScissor( _x, _y, _vWidth, _vHeight );
+    int x = _x;
+    int y = _y;
+    int width = _vWidth;
+    int height = _vHeight;
+
+    if( _tiled )
+    {
+        // Clip to the tile, in the tile's own pixel frame.
+        x = std::max( _x, _tileX );
+        y = std::max( _y, _tileY );
+        width = std::max( std::min( _x + _vWidth, _tileX + _tileWidth ) - x, 0 );
+        height = std::max( std::min( _y + _vHeight, _tileY + _tileHeight ) - y, 0 );
+        x -= _tileX;
+        y -= _tileY;
+    }
+
+    glViewport( x, y, width, height );
+    glScissor( x, y, width, height );
     glEnable( GL_SCISSOR_TEST );
 
     // Apply Projection.
     glMatrixMode( GL_PROJECTION );
-    glLoadIdentity();
+    _loadTileProjection();
     glMultMatrixf( &_camera->getProjectionMatrix()[0][0] );
 
     // Apply Model View.
@@ -113,7 +204,7 @@ void Viewport::drawBorder( bool selected )
 
     glMatrixMode( GL_PROJECTION );
     glPushMatrix();
-    glLoadIdentity();
+    _loadTileProjection();
 
     glMatrixMode( GL_MODELVIEW );
     glLoadIdentity();
@@ -123,12 +214,12 @@ void Viewport::drawBorder( bool selected )
     float offsetW = BORDER_OFFSET * ( float )( _vWidth > _vHeight ? ( float )_vHeight / _vWidth : 1.0f );
 
     glLineWidth( BORDER_LINEWIDTH * _screenSizeDiffRatio );
-    glBegin( GL_LINE_LOOP );
-    glVertex2f( -1 + offsetW, 1 - offsetH );
-    glVertex2f( 1 - offsetW, 1 - offsetH );
-    glVertex2f( 1 - offsetW, -1 + offsetH );
-    glVertex2f( -1 + offsetW, -1 + offsetH );
-    glEnd();
+    std::vector< glm::vec3 > pnts( 4 );
+    pnts[0] = glm::vec3( -1 + offsetW, 1 - offsetH, 0.0f );
+    pnts[1] = glm::vec3( 1 - offsetW, 1 - offsetH, 0.0f );
+    pnts[2] = glm::vec3( 1 - offsetW, -1 + offsetH, 0.0f );
+    pnts[3] = glm::vec3( -1 + offsetW, -1 + offsetH, 0.0f );
+    _drawOverlay( GL_LINE_LOOP, pnts );
 
     glMatrixMode( GL_PROJECTION );
     glPopMatrix();
@@ -162,7 +253,7 @@ void Viewport::drawXYZArrows()
 
     // Apply Projection and Modelview matrix.
     glMatrixMode( GL_PROJECTION );
-    glLoadIdentity();
+    _loadTileProjection();
     glMultMatrixf( &projectionMatrix[0][0] );
 
     glMatrixMode( GL_MODELVIEW );
@@ -176,26 +267,26 @@ void Viewport::drawXYZArrows()
     glLineWidth( 1.5f * _screenSizeDiffRatio );
     glClear( GL_DEPTH_BUFFER_BIT );
 
-    glBegin( GL_LINES );
+    // Color is per draw, so each axis is its own line.
+    std::vector< glm::vec3 > pnts( 2, glm::vec3( 0.0f ) );
+
     glColor3ub( 255, 0, 0 );
-    glVertex3d( 0.0, 0.0, 0.0 );
-    glVertex3d( ARROW_LENGTH, 0.0, 0.0 );
+    pnts[1] = glm::vec3( ARROW_LENGTH, 0.0f, 0.0f );
+    _drawOverlay( GL_LINES, pnts );
 
     glColor3ub( 0, 255, 0 );
-    glVertex3d( 0.0, 0.0, 0.0 );
-    glVertex3d( 0.0, ARROW_LENGTH, 0.0 );
+    pnts[1] = glm::vec3( 0.0f, ARROW_LENGTH, 0.0f );
+    _drawOverlay( GL_LINES, pnts );
 
     glColor3ub( 0, 0, 255 );
-    glVertex3d( 0.0, 0.0, 0.0 );
-    glVertex3d( 0.0, 0.0, ARROW_LENGTH );
-    glEnd();
+    pnts[1] = glm::vec3( 0.0f, 0.0f, ARROW_LENGTH );
+    _drawOverlay( GL_LINES, pnts );
 
     glEnable( GL_POINT_SMOOTH );
     glPointSize( 3.0 );
-    glBegin( GL_POINTS );
     glColor3ub( 0, 0, 0 );
-    glVertex3d( 0.0, 0.0, 0.0 );
-    glEnd();
+    pnts.resize( 1 );
+    _drawOverlay( GL_POINTS, pnts );
 
     glDisable( GL_POINT_SMOOTH );
     glDisable( GL_LINE_SMOOTH );
@@ -247,7 +338,7 @@ void Viewport::drawGridOverlay()
 
     // Apply Projection and Modelview matrix.
     glMatrixMode( GL_PROJECTION );
-    glLoadIdentity();
+    _loadTileProjection();
     glMultMatrixf( &_camera->getProjectionMatrix()[0][0] );
 
     glMatrixMode( GL_MODELVIEW );
@@ -256,26 +347,32 @@ void Viewport::drawGridOverlay()
     glColor4f( 0.8f, 0.8f, 0.8f, 1.0f );
     glLineWidth( 0.3f * _screenSizeDiffRatio);
 
-    glBegin( GL_LINES );
-    for ( float i = -5.0f; i <= 5.0f; i += 0.5f )
-    {
-        glVertex2f( -5, i );
-        glVertex2f( 5, i );
-    }
-    for ( float i = -5.0f; i <= 5.0f; i += 0.5f )
+    // Grid never changes, so it is uploaded once.
+    if( !_gridBuffer )
     {
-        glVertex2f( i, -5 );
-        glVertex2f( i, 5 );
+        std::vector< glm::vec3 > gridPnts;
+        for ( float i = -5.0f; i <= 5.0f; i += 0.5f )
+        {
+            gridPnts.push_back( glm::vec3( -5, i, 0 ) );
+            gridPnts.push_back( glm::vec3( 5, i, 0 ) );
+        }
+        for ( float i = -5.0f; i <= 5.0f; i += 0.5f )
+        {
+            gridPnts.push_back( glm::vec3( i, -5, 0 ) );
+            gridPnts.push_back( glm::vec3( i, 5, 0 ) );
+        }
+        _gridBuffer = new VertexBuffer();
+        _gridBuffer->loadPositions( gridPnts );
     }
-    glEnd();
+    _gridBuffer->draw( GL_LINES );
 
     glColor3f( 0.1f, 0.1f, 0.1f );
-    glBegin( GL_LINES );
-    glVertex2f( -5, 0 );
-    glVertex2f( 5, 0 );
-    glVertex2f( 0, -5 );
-    glVertex2f( 0, 5 );
-    glEnd();
+    std::vector< glm::vec3 > axisPnts( 4 );
+    axisPnts[0] = glm::vec3( -5, 0, 0 );
+    axisPnts[1] = glm::vec3( 5, 0, 0 );
+    axisPnts[2] = glm::vec3( 0, -5, 0 );
+    axisPnts[3] = glm::vec3( 0, 5, 0 );
+    _drawOverlay( GL_LINES, axisPnts );
 }
 
 void Viewport::drawBackground()
@@ -286,7 +383,7 @@ void Viewport::drawBackground()
     }
 
     glMatrixMode( GL_PROJECTION );
-    glLoadIdentity();
+    _loadTileProjection();
 
     glMatrixMode( GL_MODELVIEW );
     glLoadIdentity();
@@ -346,7 +443,7 @@ void Viewport::drawRectangle( int startx, int starty, int x, int y )
 {
     glMatrixMode( GL_PROJECTION );
     glPushMatrix();
-    glLoadIdentity();
+    _loadTileProjection();
 
     glMatrixMode( GL_MODELVIEW );
     glLoadIdentity();
@@ -360,12 +457,12 @@ void Viewport::drawRectangle( int startx, int starty, int x, int y )
     float sy = 2.0f*(float)y/(float)_vHeight - 1.0f;
 
     glLineWidth( BORDER_LINEWIDTH * _screenSizeDiffRatio );
-    glBegin( GL_LINE_LOOP );
-    glVertex2f( sstartx , sstarty );
-    glVertex2f( sx , sstarty );
-    glVertex2f( sx , sy );
-    glVertex2f( sstartx , sy );
-    glEnd();
+    std::vector< glm::vec3 > pnts( 4 );
+    pnts[0] = glm::vec3( sstartx, sstarty, 0.0f );
+    pnts[1] = glm::vec3( sx, sstarty, 0.0f );
+    pnts[2] = glm::vec3( sx, sy, 0.0f );
+    pnts[3] = glm::vec3( sstartx, sy, 0.0f );
+    _drawOverlay( GL_LINE_LOOP, pnts );
 
     glMatrixMode( GL_PROJECTION );
     glPopMatrix();
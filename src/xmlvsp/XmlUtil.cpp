@@ -7,6 +7,66 @@
 #include "XmlUtil.h"
 #include "StringUtil.h"
 #include <cfloat>
+#include <unordered_map>
+
+using std::unordered_map;
+
+//==== Children Of One Node Grouped By Name ====//
+struct XmlChildIndex
+{
+    xmlNodePtr m_First;                                     // Detects Children Added Or Removed Since Indexing
+    xmlNodePtr m_Last;
+    unordered_map< string, vector< xmlNodePtr > > m_NameMap;
+};
+
+static int s_NodeIndexDepth = 0;
+static unordered_map< xmlNodePtr, XmlChildIndex > s_NodeIndexMap;
+
+static const vector< xmlNodePtr > * FindIndexedChildren( xmlNodePtr node, const char * name )
+{
+    static const vector< xmlNodePtr > empty_vec;
+
+    XmlChildIndex & index = s_NodeIndexMap[ node ];
+    if ( index.m_NameMap.empty() || index.m_First != node->children || index.m_Last != node->last )
+    {
+        index.m_First = node->children;
+        index.m_Last = node->last;
+        index.m_NameMap.clear();
+
+        for ( xmlNodePtr iter_node = node->xmlChildrenNode ; iter_node != NULL ; iter_node = iter_node->next )
+        {
+            if ( iter_node->name )
+            {
+                index.m_NameMap[ ( const char * )iter_node->name ].push_back( iter_node );
+            }
+        }
+    }
+
+    unordered_map< string, vector< xmlNodePtr > >::const_iterator iter = index.m_NameMap.find( name );
+    if ( iter == index.m_NameMap.end() )
+    {
+        return &empty_vec;
+    }
+    return &iter->second;
+}
+
+void XmlUtil::BeginNodeIndex()
+{
+    s_NodeIndexDepth++;
+}
+
+void XmlUtil::EndNodeIndex()
+{
+    if ( s_NodeIndexDepth > 0 )
+    {
+        s_NodeIndexDepth--;
+    }
+
+    if ( s_NodeIndexDepth == 0 )
+    {
+        s_NodeIndexMap.clear();
+    }
+}
 
 //==== Get Number of Same Names ====//
 unsigned int XmlUtil::GetNumNames( xmlNodePtr node, const char * name )
@@ -14,6 +74,11 @@ unsigned int XmlUtil::GetNumNames( xmlNodePtr node, const char * name )
     int num;
     xmlNodePtr iter_node;
 
+    if ( s_NodeIndexDepth > 0 && node )
+    {
+        return ( unsigned int )FindIndexedChildren( node, name )->size();
+    }
+
     num = 0;
     iter_node = node->xmlChildrenNode;
 
@@ -41,6 +106,16 @@ xmlNodePtr XmlUtil::GetNodeDbg( xmlNodePtr node, const char * name, int id, cons
         return NULL;
     }
 
+    if ( s_NodeIndexDepth > 0 )
+    {
+        const vector< xmlNodePtr > * child_vec = FindIndexedChildren( node, name );
+        if ( id >= 0 && id < ( int )child_vec->size() )
+        {
+            return ( *child_vec )[ id ];
+        }
+        return NULL;
+    }
+
     static bool once = false;
     if ( !once && id > 100 )
     {
@@ -24,6 +24,12 @@ namespace XmlUtil
 {
 unsigned int GetNumNames( xmlNodePtr node, const char * name );
 
+//==== Index Children By Name While Decoding An Unchanging Document ====//
+// Between BeginNodeIndex and the matching EndNodeIndex, GetNode and GetNumNames
+// index each node's children on first use, so repeated lookups are not linear.
+void BeginNodeIndex();
+void EndNodeIndex();
+
 #define GetNode( node, name, num ) GetNodeDbg( node, name, num, __FILE__, __LINE__ )
 xmlNodePtr GetNodeDbg( xmlNodePtr node, const char * name, int num, const char* file, int lineno );
 